@@ -0,0 +1,3267 @@
+// Generated by generate_agari_table.py - do not edit by hand
+//
+// Every complete shape of one tile type: values 1-9 with 0-4 copies each,
+// split into groups (triplets / consecutives) plus at most one pair.
+// Shapes are packed 3 bits per value and stored in a perfect-hash table.
+#pragma once
+
+const int AGARI_SHAPE_COUNT = 21743;
+const int AGARI_BUCKET_BITS = 13;
+const int AGARI_SLOT_BITS = 15;
+const unsigned int AGARI_EMPTY_SLOT = 0xFFFFFFFF;
+
+const unsigned short agariSeeds[1 << AGARI_BUCKET_BITS] = {
+    0x0, 0x1, 0x5, 0xC, 0xD, 0x1, 0x1, 0x3, 0x3, 0x12, 0x0, 0x16, 0x4, 0x2, 0x0, 0x3,
+    0x0, 0x0, 0x2, 0x0, 0x1, 0x7, 0x0, 0x0, 0x1, 0xD, 0x0, 0x10, 0x0, 0x5, 0x8, 0x4,
+    0x2, 0x0, 0x0, 0x2, 0x5, 0x0, 0x2, 0x4, 0x1, 0x1, 0x3, 0x1, 0x4, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0x1, 0x2, 0x1, 0x0, 0x0, 0x0, 0x1, 0x14, 0x5, 0x2, 0x3, 0x0, 0x2, 0xD,
+    0x6, 0x0, 0x0, 0x7, 0x0, 0x0, 0x4, 0x0, 0x1, 0x2, 0x7, 0x0, 0x0, 0x2, 0x4, 0x6,
+    0x0, 0x3, 0x0, 0x1, 0x0, 0x1, 0x3, 0x1, 0x0, 0x4, 0x2, 0x3, 0x0, 0x0, 0x1, 0x2,
+    0x1, 0x0, 0x12, 0x0, 0x0, 0x1, 0x1, 0x0, 0x4, 0xA, 0x2, 0x0, 0x0, 0x3, 0xC, 0x0,
+    0x0, 0x2, 0x4, 0x0, 0x1, 0x1, 0x1, 0x3, 0x0, 0x2, 0x0, 0x4, 0x0, 0x1, 0x2, 0x0,
+    0x6, 0x2, 0x0, 0x1, 0x1, 0x0, 0x4, 0x2, 0x0, 0x1, 0x12, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x3, 0x6, 0x1, 0x2, 0x1A, 0x1, 0x0, 0x0, 0x7, 0x0, 0x4, 0x4, 0x0, 0x0, 0x0, 0xB,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x3, 0x7, 0x2, 0x2, 0x0, 0x3, 0x0, 0x0, 0x1, 0x4,
+    0x5, 0x0, 0x6, 0x0, 0x1, 0x1, 0x0, 0x2, 0x5, 0x3, 0x0, 0x4, 0x5, 0x6, 0x5, 0x1,
+    0x4, 0x3, 0x0, 0x1, 0x0, 0x4, 0x0, 0x0, 0x1, 0x0, 0x4, 0x0, 0x0, 0x0, 0x4, 0x3,
+    0x4, 0x0, 0x0, 0x1, 0x0, 0x3, 0x3, 0xD, 0x3, 0x0, 0x10, 0xE, 0x0, 0x0, 0x0, 0x4,
+    0x1, 0x2, 0x0, 0x1, 0x3, 0x0, 0x3, 0x0, 0x1, 0x0, 0x0, 0x1, 0x2, 0x2, 0x4, 0x2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x1, 0x0, 0x2, 0x0, 0x0, 0x5, 0x1, 0x0, 0x4, 0x1,
+    0x0, 0x1, 0xD, 0x0, 0x0, 0x2, 0x0, 0x1, 0x5, 0x7, 0x1, 0x0, 0x5, 0x0, 0x0, 0x0,
+    0x0, 0xA, 0x1, 0xE, 0x2, 0x1, 0x6, 0xB, 0x8, 0x0, 0x1, 0x5, 0x5, 0x2, 0x0, 0x3,
+    0x2, 0x5, 0x4, 0x0, 0x4, 0x2, 0x4, 0x5, 0x3, 0x1, 0x0, 0x0, 0x0, 0xB, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0x1, 0x3, 0x6, 0x4, 0x2, 0x6, 0x5, 0x4, 0x0, 0x3, 0x2, 0x1,
+    0x0, 0x0, 0x2, 0x2, 0x0, 0x0, 0x4, 0x0, 0x2, 0x4, 0x9, 0x0, 0x0, 0x0, 0x6, 0x1,
+    0x0, 0x1, 0x1, 0x0, 0x5, 0x2, 0x5, 0x0, 0x0, 0x4, 0x6, 0x0, 0x7, 0x0, 0x1, 0x1,
+    0x1, 0x0, 0x5, 0x0, 0x0, 0x0, 0x2, 0x1, 0x7, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0, 0x3,
+    0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0x5, 0x0, 0x0, 0x3, 0xB, 0x11, 0x0, 0x1, 0x5, 0x1,
+    0x0, 0x0, 0xE, 0x1, 0x5, 0x1, 0x0, 0x0, 0x3, 0x0, 0x6, 0x18, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x5, 0x2, 0x3, 0x0, 0x0, 0x5, 0x3, 0x2, 0x0, 0x1, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x6, 0x0, 0x0, 0x5, 0x0, 0x4, 0x0, 0x2, 0x5, 0x2, 0x2, 0x1, 0xE,
+    0x0, 0x0, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x3, 0x7, 0x2, 0x0, 0x4, 0x3, 0x0, 0x5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x0, 0x10, 0x1, 0x0, 0x2, 0x1, 0x1, 0x1, 0x0, 0x1,
+    0x4, 0x1, 0x2, 0x0, 0x4, 0x0, 0xC, 0x4, 0x0, 0x1, 0x0, 0x0, 0xA, 0xD, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0xC, 0x0, 0x2, 0x3, 0x0, 0x0, 0x3, 0x1, 0x0, 0x0, 0x3, 0x9, 0x1,
+    0x0, 0x7, 0x5, 0x9, 0x0, 0x3, 0x7, 0x7, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0x5, 0x4, 0x0, 0x1, 0x0, 0x5, 0x6, 0x5, 0x1, 0x4, 0x2, 0x8, 0x4, 0x0, 0x1, 0x6,
+    0x0, 0x9, 0x0, 0x1, 0x0, 0xC, 0x0, 0x1, 0x6, 0x4, 0x0, 0x6, 0x15, 0x0, 0x1, 0x5,
+    0x6, 0x4, 0x7, 0x3, 0x2, 0x2, 0x0, 0x3, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x1, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x1, 0x1, 0x5, 0x9, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x4, 0x1, 0x2, 0x0, 0x1, 0x1, 0x0, 0x0,
+    0x6, 0x9, 0x5, 0x0, 0x1, 0x3, 0x0, 0xC, 0x4, 0x8, 0x1, 0x7, 0x5, 0x1, 0x0, 0x0,
+    0x0, 0x3, 0x2, 0x2, 0x0, 0x0, 0xC, 0x3, 0x0, 0x0, 0x5, 0x4, 0x0, 0x0, 0x6, 0x6,
+    0x1, 0x3, 0x1, 0x4, 0x5, 0x2, 0x0, 0x1, 0x3, 0x2, 0xF, 0x0, 0x2, 0x0, 0x3, 0x3,
+    0x4, 0x2, 0x1, 0x1, 0x0, 0x0, 0x4, 0x1, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1,
+    0x6, 0x1, 0x1, 0x0, 0xD, 0x2, 0x0, 0x0, 0x0, 0x1, 0x2, 0x0, 0x2, 0x1, 0x6, 0xA,
+    0x2, 0x0, 0x0, 0x2, 0x0, 0x1, 0x3, 0xD, 0x1, 0x5, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x1, 0x1, 0x0, 0x2, 0x3, 0x1, 0x4, 0x0, 0x1, 0x3, 0x2, 0x12, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x7, 0x2, 0x1, 0x5, 0x0, 0x0, 0xA, 0x0, 0x2, 0x0, 0x0, 0x0, 0x2,
+    0x1, 0x0, 0x1, 0x0, 0x3, 0x3, 0x1, 0x0, 0x0, 0x0, 0x3, 0x0, 0xB, 0x0, 0x6, 0x0,
+    0x0, 0x6, 0x0, 0x4, 0x6, 0x0, 0x6, 0x2, 0x0, 0x0, 0x2, 0x1, 0x0, 0x5, 0x0, 0x3,
+    0x2, 0x1, 0xF, 0x4, 0x1, 0x2, 0x0, 0x0, 0x2, 0x6, 0x1, 0x2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xE, 0xC, 0x3, 0x0, 0x5, 0xC, 0x0, 0x9, 0x2, 0x0, 0x8, 0x0, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x3, 0x3, 0x1, 0x5, 0x1, 0x0, 0x2, 0x0, 0x2, 0x0, 0x1, 0x1,
+    0xD, 0x0, 0x2, 0x2, 0x0, 0x0, 0xE, 0x5, 0x5, 0x0, 0x6, 0x2, 0x1, 0x1, 0x5, 0x0,
+    0xF, 0x2, 0x2, 0x5, 0x0, 0x0, 0x0, 0x4, 0x4, 0x2, 0xB, 0x29, 0x1, 0x4, 0x0, 0x0,
+    0x6, 0x3, 0x2, 0x0, 0x7, 0x0, 0x3, 0x2, 0x4, 0x0, 0x0, 0x0, 0x3, 0x7, 0x0, 0x1,
+    0x9, 0x1, 0x0, 0x7, 0x1, 0x0, 0x3, 0x0, 0x0, 0x3, 0x2, 0x1, 0x12, 0x1, 0x9, 0x2,
+    0x0, 0x0, 0x6, 0x2, 0xB, 0x1, 0x2, 0x0, 0x0, 0x6, 0x0, 0x15, 0x0, 0xD, 0x1, 0x0,
+    0x0, 0x0, 0x4, 0x8, 0x0, 0x0, 0x3, 0x2, 0x1, 0x1, 0x0, 0x1D, 0x0, 0x1, 0x0, 0x0,
+    0x3, 0x2, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1, 0x5, 0x4, 0x1, 0x1, 0x4, 0x0, 0x6, 0x1,
+    0x4, 0x1, 0x0, 0x0, 0xB, 0x3, 0x9, 0x7, 0x0, 0x1, 0x0, 0x0, 0x3, 0x3, 0x6, 0x0,
+    0x0, 0x0, 0x1, 0x1, 0x0, 0x2, 0x1, 0x0, 0x0, 0x0, 0x5, 0x2, 0x0, 0x9, 0x0, 0x0,
+    0x3, 0x1, 0x6, 0x1, 0x1, 0x5, 0x1, 0x0, 0x3, 0x1, 0xE, 0x5, 0x0, 0x3, 0x0, 0x5,
+    0x8, 0x3, 0x0, 0x0, 0x2, 0x0, 0x1, 0x5, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x4, 0x5, 0x3, 0x1, 0x3, 0x3, 0x5, 0x0, 0x3, 0x4, 0x4, 0x0, 0x5, 0x1, 0x3,
+    0x2, 0x0, 0x6, 0x0, 0x2, 0x4, 0x2, 0x0, 0x0, 0x4, 0x6, 0x2, 0x7, 0x3, 0x1, 0x2,
+    0x0, 0x1, 0x0, 0x26, 0x2, 0xA, 0x3, 0x1, 0x0, 0x9, 0x0, 0x3, 0xD, 0xF, 0x2, 0x0,
+    0x1, 0x0, 0x1, 0x8, 0x0, 0x0, 0x2, 0x5, 0x0, 0x0, 0x0, 0x4, 0x1, 0x0, 0x6, 0x1,
+    0x6, 0x2, 0x5, 0x5, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x2, 0x3, 0x0, 0x0, 0x3, 0x0,
+    0x5, 0x1, 0x1, 0x4, 0x0, 0x2, 0x3, 0x4, 0x0, 0x1, 0x0, 0x6, 0x0, 0x3, 0x0, 0x2,
+    0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0xB, 0x0, 0x6,
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x2, 0x11, 0x4, 0x6, 0x0, 0x5, 0x0, 0x0, 0x6, 0x1, 0x1,
+    0x0, 0x1, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0xF, 0x0, 0x3, 0x1, 0x6, 0x0, 0x3, 0x1,
+    0x0, 0x0, 0x2, 0xA, 0x7, 0x2, 0x5, 0x1, 0x0, 0x0, 0x2, 0x1, 0x0, 0x0, 0x4, 0x0,
+    0x0, 0x7, 0x1, 0x0, 0x0, 0x5, 0x0, 0x1, 0x0, 0x7, 0x8, 0xD, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x0, 0x7, 0x0, 0x6, 0x8, 0x2, 0x4, 0xA, 0x0, 0x0, 0x1, 0x2, 0x5, 0x3, 0x1,
+    0x6, 0x1, 0x4, 0x0, 0x3, 0x0, 0x0, 0x2, 0x1, 0x0, 0x2, 0xA, 0x7, 0x0, 0x0, 0x8,
+    0x1, 0x7, 0x0, 0x0, 0x2, 0x8, 0x0, 0x4, 0x1, 0x2, 0x9, 0x0, 0x0, 0x3, 0x2, 0x1,
+    0x0, 0x0, 0x5, 0x1, 0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0xB, 0x4, 0x0,
+    0x7, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7, 0x6, 0x4, 0x1, 0x1, 0x1, 0x0, 0x4, 0x0, 0x0,
+    0x3, 0x13, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x2, 0x0, 0x0, 0x5, 0x2, 0x2,
+    0x4, 0x4, 0xA, 0x4, 0x1A, 0x0, 0x0, 0x1, 0x5, 0x0, 0x4, 0x1, 0x1, 0x4, 0x1, 0x0,
+    0x0, 0x3, 0x3, 0x0, 0x8, 0x0, 0x0, 0x7, 0x0, 0x1, 0x0, 0x1, 0x2, 0x4, 0x6, 0x1,
+    0x1, 0x2, 0x0, 0x0, 0x1, 0x6, 0x3, 0x1, 0x1, 0x8, 0x0, 0x0, 0x2, 0xB, 0x0, 0x9,
+    0x2, 0xB, 0x1, 0x3, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x3,
+    0x0, 0x3, 0x3, 0x4, 0x5, 0x4, 0x0, 0x19, 0x0, 0x4, 0xC, 0x4, 0x0, 0x2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0x5, 0x3, 0x1, 0x2, 0x7, 0x0, 0x1, 0x1, 0x0,
+    0x3, 0x0, 0x2, 0xC, 0x0, 0x2, 0x0, 0x0, 0x0, 0x9, 0x6, 0x0, 0x0, 0x6, 0x8, 0xD,
+    0x6, 0x2, 0x0, 0x3, 0x0, 0x6, 0x0, 0x0, 0x5, 0xE, 0x0, 0x0, 0x0, 0x1, 0x8, 0x4,
+    0x1, 0x0, 0x4, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x4, 0x0, 0x0,
+    0x6, 0x0, 0x6, 0x0, 0x1, 0x0, 0x6, 0x9, 0x0, 0xF, 0x0, 0x1, 0x1, 0x0, 0x4, 0xA,
+    0x1, 0x1, 0x7, 0x1, 0x1, 0x4, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1B, 0x1,
+    0x0, 0x0, 0x2, 0x0, 0x0, 0x1, 0x3, 0x0, 0x0, 0x2, 0x1, 0x14, 0x0, 0x1, 0x1, 0x1,
+    0x8, 0x3, 0x0, 0x4, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0xA, 0x1, 0x0, 0x1, 0x6,
+    0x2, 0x0, 0xB, 0x3, 0x0, 0x1, 0xE, 0x0, 0x0, 0x1, 0x1, 0x3, 0x3, 0x0, 0x7, 0x3,
+    0x0, 0x9, 0x0, 0x8, 0x1, 0x15, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x2, 0x1, 0x0, 0x0,
+    0x3, 0x0, 0x6, 0x0, 0xD, 0x0, 0x5, 0xA, 0x1, 0x2, 0x0, 0x2, 0x2, 0x0, 0x5, 0x4,
+    0x0, 0x1, 0x6, 0x0, 0x11, 0x0, 0x9, 0x0, 0x1, 0x2, 0x6, 0x0, 0x0, 0x1, 0x3, 0x0,
+    0x8, 0x0, 0x0, 0x0, 0x1, 0xB, 0x1, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x0, 0x7, 0x5, 0xA, 0x2, 0x4, 0x0, 0x9, 0x0, 0x1, 0xB, 0x6, 0x1, 0x8, 0x0, 0x0,
+    0x1, 0x2, 0x3, 0x0, 0x22, 0x2, 0x1, 0x3, 0x1, 0x2, 0x3, 0x7, 0xB, 0x12, 0x0, 0x5,
+    0x0, 0x0, 0x8, 0x5, 0x1, 0x4, 0x1, 0x7, 0x7, 0x0, 0x6, 0x4, 0x11, 0x8, 0x0, 0x14,
+    0x0, 0x2, 0x0, 0x1, 0x12, 0xF, 0x0, 0x3, 0x1, 0x3, 0x2, 0x0, 0x1D, 0x0, 0x4, 0x0,
+    0x3, 0x0, 0x5, 0x3, 0x5, 0x3, 0x4, 0xB, 0xA, 0x1, 0x1, 0x1, 0x2, 0x4, 0x1, 0x2,
+    0x1, 0x0, 0x0, 0x0, 0xD, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x4, 0x1, 0x5, 0x0,
+    0x6, 0x2, 0x2, 0xA, 0x8, 0x3, 0x9, 0x7, 0x2, 0x0, 0xB, 0x9, 0x0, 0x8, 0x3, 0x9,
+    0x6, 0x6, 0x1, 0x3, 0x0, 0x0, 0x5, 0x0, 0x3, 0x4, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x9, 0x1, 0x0, 0xD, 0x0, 0x0, 0xB, 0x0, 0x7, 0x2, 0x1, 0x0, 0x3, 0x9,
+    0x0, 0x8, 0x4, 0x0, 0x3, 0x0, 0x4, 0x6, 0x8, 0x0, 0x1, 0x5, 0x1, 0x0, 0x0, 0x1,
+    0x0, 0x0, 0x4, 0x2, 0x0, 0x0, 0x1, 0x0, 0xC, 0x0, 0x8, 0x10, 0x4, 0x4, 0x1, 0x0,
+    0x0, 0x1, 0x2, 0x0, 0x0, 0x1, 0x2, 0x0, 0xB, 0x0, 0x1, 0x7, 0x4, 0x0, 0x1, 0x1,
+    0xB, 0x4, 0x0, 0x10, 0x1, 0x7, 0x1, 0x1, 0x1, 0x3, 0x14, 0x1, 0x2, 0x5, 0x8, 0x6,
+    0x0, 0x8, 0x1, 0x0, 0x3, 0x3, 0x0, 0x0, 0x4, 0x8, 0x0, 0x2, 0x0, 0x1, 0xA, 0x4,
+    0x5, 0x0, 0x0, 0x0, 0x1, 0x0, 0x4, 0x0, 0x1, 0x1, 0x7, 0x2, 0x0, 0x1, 0x4, 0x0,
+    0x2, 0x2, 0x0, 0x6, 0x0, 0x2, 0x0, 0x0, 0x1, 0x4, 0x0, 0x1, 0xD, 0x1, 0x22, 0x0,
+    0x1, 0x2, 0x1, 0x8, 0x0, 0x7, 0x1, 0x0, 0x4, 0x5, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0,
+    0xB, 0x3, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x5, 0x2, 0x2, 0x1, 0x4, 0x2, 0x5, 0x0,
+    0x1, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0, 0x4, 0x2, 0x5, 0x0, 0x6, 0x4, 0x0, 0x1C, 0x4,
+    0x9, 0x0, 0x8, 0x0, 0x1, 0x0, 0x1, 0x4, 0x1, 0x3, 0x0, 0x3, 0x1, 0x0, 0x5, 0x1,
+    0x2, 0x0, 0x1, 0x5, 0x0, 0x0, 0x1, 0x2, 0x2, 0x1, 0x0, 0x4, 0x0, 0x0, 0xF, 0x1,
+    0x5, 0x1, 0x0, 0x1, 0x0, 0xD, 0x0, 0x2, 0x4, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x7,
+    0x13, 0x2, 0x4, 0x0, 0x4, 0x5, 0x0, 0x0, 0x0, 0xB, 0x0, 0x4, 0x0, 0x4, 0x4, 0x0,
+    0x3, 0x9, 0x0, 0x1, 0x4, 0x4, 0x9, 0x0, 0x0, 0x0, 0x0, 0xB, 0x22, 0x1, 0x1, 0x0,
+    0x1, 0x3, 0x1, 0x1, 0xC, 0x0, 0x0, 0x0, 0x4, 0x2, 0x0, 0x0, 0x1, 0x4, 0x1, 0x1,
+    0x0, 0x0, 0x4, 0x0, 0x6, 0x3, 0x5, 0x7, 0x1, 0x4, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1,
+    0x3, 0x1, 0x2, 0xB, 0x1, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1, 0x0, 0xC, 0x0, 0x0, 0x0,
+    0x6, 0x7, 0x0, 0x0, 0x4, 0x6, 0x1, 0x0, 0x4, 0x2, 0x0, 0x0, 0x0, 0x1, 0x0, 0xC,
+    0x5, 0x12, 0x2, 0x1, 0x0, 0x0, 0x1, 0x2, 0xD, 0x0, 0x4, 0x2, 0x0, 0x2, 0x2, 0x23,
+    0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x7, 0x0, 0x4, 0x3, 0x4, 0x4, 0x0, 0x1, 0x1, 0x9,
+    0x9, 0x0, 0x0, 0x0, 0xD, 0x1, 0x0, 0x1, 0x5, 0x0, 0x0, 0x0, 0x1, 0x3, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x3, 0x4, 0x0, 0x11, 0x0, 0x0, 0x1,
+    0x1, 0x6, 0x4, 0x0, 0x9, 0x3, 0x0, 0x5, 0x1, 0x1, 0x9, 0x0, 0x2, 0x3, 0x2, 0x0,
+    0x0, 0x7, 0x6, 0x0, 0x1, 0x3, 0x5, 0x7, 0x1, 0xC, 0x0, 0x9, 0x0, 0x1, 0x2, 0x0,
+    0x0, 0x2, 0x0, 0xA, 0x0, 0x14, 0x5, 0x3, 0x0, 0xD, 0x1, 0x1, 0xB, 0x0, 0xE, 0x9,
+    0x0, 0x9, 0x2, 0x0, 0x0, 0x4, 0x6, 0x0, 0x1, 0x0, 0x1, 0x4, 0x0, 0x2, 0x1D, 0x1,
+    0x6, 0x3, 0x2, 0x0, 0x1, 0x0, 0x0, 0x1, 0x3, 0x2, 0x1, 0xA, 0x0, 0x0, 0x4, 0x5,
+    0x0, 0x8, 0x1, 0x1, 0x1, 0x0, 0x0, 0x6, 0x1, 0x0, 0x8, 0x3, 0x0, 0x3, 0x6, 0x0,
+    0x0, 0x1, 0x10, 0x3, 0x0, 0xB, 0x0, 0x3, 0x6, 0x4, 0x5, 0x0, 0x0, 0x0, 0x1, 0xF,
+    0x0, 0x2, 0x0, 0x2, 0x0, 0x1, 0x0, 0x8, 0xD, 0x0, 0x2, 0x2, 0x1, 0x2, 0x1, 0x0,
+    0x1, 0x1, 0x1, 0x11, 0x6, 0x0, 0x0, 0x2, 0x0, 0x1D, 0x1, 0x5, 0x0, 0x0, 0x0, 0x1,
+    0x5, 0x6, 0x3, 0x2, 0x6, 0x2, 0x7, 0x15, 0x6, 0x0, 0x1, 0x0, 0x0, 0x2, 0x0, 0x8,
+    0x0, 0x9, 0x1, 0x1, 0x2, 0x0, 0x3, 0x1, 0x8, 0x0, 0xB, 0x7, 0x0, 0x3, 0x7, 0x5,
+    0x1, 0x2, 0x1, 0x0, 0x0, 0x1, 0x0, 0x9, 0x5, 0x1, 0x3, 0x1, 0x0, 0x4, 0x0, 0x0,
+    0x1, 0x0, 0x12, 0x23, 0x4, 0x4, 0x2, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x4, 0x2, 0x4,
+    0xB, 0x5, 0xA, 0x3, 0x0, 0x0, 0x4, 0x0, 0x6, 0x1, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0,
+    0x8, 0x9, 0x9, 0x4, 0x4, 0x3, 0x0, 0x5, 0x7, 0x1, 0xD, 0x0, 0x0, 0x6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0x4, 0x0, 0x0, 0x7, 0x0, 0x6, 0x8, 0x6, 0x0, 0x2, 0x5, 0x0,
+    0x5, 0x0, 0x4, 0x0, 0x4, 0x1, 0x0, 0x9, 0x0, 0x0, 0x8, 0x0, 0x1, 0x1, 0x8, 0x8,
+    0x0, 0x0, 0x4, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1, 0x1, 0x1, 0x0, 0x0, 0x1, 0x0, 0x2,
+    0xB, 0x9, 0x0, 0x1, 0xB, 0x0, 0x0, 0x0, 0xF, 0x0, 0x0, 0x5, 0x2, 0x1, 0x1, 0x0,
+    0x0, 0xD, 0x2, 0x1, 0x4, 0x0, 0x0, 0x3, 0x0, 0x0, 0x6, 0x8, 0x1, 0x2, 0x6, 0x2,
+    0x4, 0xF, 0x0, 0x20, 0x4, 0x1, 0x0, 0xF, 0x0, 0x2, 0x1, 0x0, 0x7, 0x0, 0x0, 0x0,
+    0x4, 0x6, 0x8, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x1, 0x2, 0x6, 0x3,
+    0x1, 0x0, 0x0, 0x2, 0xE, 0x1, 0x0, 0x5, 0x2, 0x4, 0x1, 0x0, 0x3, 0x10, 0x0, 0x0,
+    0x1, 0x3, 0x16, 0x0, 0x2, 0x4, 0x4, 0x1, 0x2, 0x0, 0x0, 0x0, 0x2, 0x1, 0x1, 0x0,
+    0x0, 0x1, 0x0, 0x5, 0x2, 0x6, 0x0, 0xE, 0x2, 0x0, 0x4, 0x0, 0x2, 0x0, 0x4, 0x1,
+    0x0, 0x7, 0x1, 0x4, 0x6, 0x0, 0x0, 0x9, 0x0, 0x0, 0x4, 0x1, 0x8, 0x0, 0x5, 0x4,
+    0x1, 0x1, 0x10, 0x4, 0x0, 0x1, 0x6, 0x0, 0x0, 0x3, 0x3, 0x0, 0x1, 0x9, 0x4, 0x0,
+    0x9, 0x1, 0x1, 0x1, 0xC, 0x0, 0x12, 0x0, 0x0, 0x4, 0x9, 0xB, 0x0, 0x26, 0x5, 0x8,
+    0x4, 0x0, 0x1, 0x1, 0x1, 0x1, 0x19, 0x9, 0x1, 0x1, 0x3, 0x0, 0x3, 0x0, 0x0, 0x0,
+    0x4, 0x3, 0x0, 0x5, 0xA, 0x0, 0x3, 0x4, 0x0, 0x5, 0x1, 0x2, 0x0, 0x1, 0x4, 0x2,
+    0x3, 0x1, 0x4, 0x4, 0x2, 0x4, 0x2, 0xA, 0x0, 0x3, 0x0, 0x6, 0x4, 0x3, 0x0, 0x0,
+    0x1, 0x1, 0x4, 0x20, 0x3, 0x0, 0x0, 0x6, 0x2, 0x7, 0x0, 0x0, 0x10, 0x2, 0x0, 0x14,
+    0x0, 0x1, 0x1, 0x3, 0x8, 0x2, 0x0, 0x1, 0x0, 0x0, 0x2, 0x0, 0x1, 0x7, 0x5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x3, 0x5, 0xD, 0x14, 0x0, 0xC, 0x0, 0x2, 0x0, 0x0, 0x2,
+    0x0, 0x3, 0x2, 0x3, 0x7, 0x6, 0x2, 0xA, 0xF, 0x0, 0x0, 0x1, 0x22, 0x2, 0x0, 0x1,
+    0x3, 0x3, 0x0, 0x0, 0x1, 0x3, 0x5, 0x4, 0x1, 0x0, 0x1, 0x4, 0x5, 0x6, 0x2, 0x0,
+    0x3, 0x0, 0x6, 0x0, 0x5, 0x0, 0x3, 0x1, 0x8, 0x0, 0x1, 0x6, 0x0, 0x8, 0x1, 0x9,
+    0x1, 0x0, 0x1, 0x5, 0x7, 0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x8, 0x1, 0x5, 0x1, 0x4,
+    0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x3, 0x17, 0x1, 0x1, 0xA, 0x4, 0x0, 0x0, 0x0, 0x1,
+    0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x9, 0x0, 0x1, 0x2, 0x2, 0x3,
+    0x0, 0x4, 0x0, 0x1, 0x4, 0x1, 0x0, 0xC, 0x2, 0xA, 0x0, 0x2, 0x6, 0x1, 0x1, 0x10,
+    0x4, 0x2, 0x6, 0x9, 0x0, 0x13, 0x0, 0x1, 0x0, 0x1, 0x3, 0x0, 0x0, 0x0, 0x9, 0x0,
+    0x4, 0x1, 0x5, 0x6, 0x4, 0x0, 0x1, 0x5, 0x0, 0x1, 0x0, 0x0, 0x1, 0xB, 0x5, 0x3,
+    0x4, 0x0, 0x1, 0x1, 0x1, 0x0, 0x2, 0x0, 0x6, 0x0, 0x0, 0x0, 0x1, 0x1, 0x2, 0x0,
+    0x1, 0x4, 0x0, 0x0, 0x5, 0x1, 0x3, 0x28, 0x5, 0x16, 0x9, 0x4, 0xF, 0x0, 0x1, 0x1,
+    0x0, 0x1, 0x2, 0x0, 0x7, 0x2D, 0x3, 0x5, 0x0, 0x0, 0x2, 0x1, 0x8, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0x4, 0x8, 0x7, 0x9, 0x0, 0xE, 0x1, 0x0, 0x0, 0x4, 0x4, 0x7, 0x1, 0x1,
+    0xA, 0x3, 0x0, 0x2, 0x1, 0x0, 0x1, 0x1, 0x4, 0x6, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0,
+    0x0, 0x9, 0x1, 0x0, 0x0, 0x2, 0xB, 0x0, 0xF, 0x1, 0x1, 0x2, 0x0, 0x0, 0x4, 0x5,
+    0x0, 0x9, 0x2, 0x0, 0x1, 0xA, 0x9, 0x0, 0x4, 0xA, 0xB, 0x4, 0xE, 0x0, 0x1, 0x0,
+    0x2, 0x3, 0x0, 0x9, 0x2, 0x0, 0x0, 0x1, 0x2, 0x5, 0x4, 0x4, 0x2, 0x0, 0x3, 0x9,
+    0x3, 0x1, 0x3, 0x2, 0x7, 0x2, 0x3, 0x0, 0x7, 0x1, 0xB, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0x5, 0x0, 0x0, 0x9, 0x5, 0x0, 0x7, 0x0, 0x3, 0x0, 0x3, 0x0, 0x1, 0x0, 0x4, 0x2,
+    0x1, 0x4, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE, 0x2, 0x0, 0x4, 0x0, 0x1, 0x4,
+    0x4, 0x0, 0x1, 0x5, 0x0, 0xB, 0x1F, 0x3, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0,
+    0x3, 0x5, 0x0, 0x0, 0x1, 0x3, 0x0, 0x0, 0x3, 0x7, 0x2, 0x6, 0x0, 0x0, 0x0, 0x4,
+    0x14, 0x8, 0x2, 0x2, 0x8, 0x19, 0x0, 0x1, 0x0, 0x3, 0x0, 0x4, 0x0, 0x5, 0x0, 0x1,
+    0x0, 0x0, 0x1, 0x6, 0x0, 0x0, 0x4, 0x7, 0x3, 0x0, 0x1, 0x9, 0x6, 0x1, 0x0, 0x8,
+    0x5, 0x3, 0xB, 0x4, 0x1, 0x4, 0x5, 0x1, 0x5, 0x18, 0x40, 0x5, 0x0, 0x1, 0xB, 0x0,
+    0x2, 0x0, 0x9, 0x7, 0xB, 0x1, 0x4, 0x1, 0x0, 0x0, 0x7, 0x0, 0x3, 0x1, 0x1, 0x2,
+    0x0, 0x0, 0x6, 0x1, 0x3, 0x2, 0x7, 0x3, 0x0, 0x3, 0x1, 0x5, 0x0, 0x8, 0x1B, 0x7,
+    0x0, 0x1, 0x1, 0x0, 0x7, 0x2, 0x4, 0x2, 0x0, 0x6, 0x0, 0x0, 0x7, 0x1, 0x1, 0x1,
+    0x6, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x5, 0x1, 0x9, 0x1, 0x4, 0x4, 0x1, 0xA, 0x6,
+    0x0, 0x2, 0x20, 0x1, 0x0, 0x4, 0x5, 0x3, 0x1, 0x9, 0x0, 0x1, 0x0, 0x4, 0x1, 0x1,
+    0xB, 0x4, 0x2, 0x0, 0x0, 0x6, 0x4, 0x2, 0x0, 0xC, 0x0, 0x6, 0x0, 0x5, 0x0, 0x5,
+    0x2, 0x4, 0x1, 0x6, 0x1, 0xD, 0x3, 0x1, 0x0, 0x0, 0x9, 0x0, 0x0, 0x1, 0x5, 0x4,
+    0x3, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x11, 0x0, 0x5, 0x2,
+    0x0, 0x1, 0x0, 0x8, 0x0, 0x4, 0x4, 0x9, 0x5, 0x1, 0x0, 0x2, 0x7, 0x1, 0x0, 0x4,
+    0x3, 0x4, 0x2, 0x4, 0x12, 0x8, 0x0, 0x0, 0x2, 0x0, 0x4, 0x0, 0x0, 0x2, 0xF, 0x4,
+    0x0, 0x2, 0x0, 0x5, 0x6, 0x1, 0x0, 0x4, 0x12, 0x0, 0x5, 0x2, 0x0, 0x1, 0x0, 0x3,
+    0x9, 0x9, 0x7, 0x7, 0x3, 0xC, 0x7, 0x4, 0x0, 0x7, 0x4, 0x9, 0x1, 0x5, 0x1, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0x0, 0x11, 0x3, 0xC, 0x3, 0x0, 0x0, 0x1A, 0x5, 0x0, 0x1, 0x4,
+    0x3, 0xE, 0x1, 0x4, 0x0, 0x2, 0x6, 0x2, 0xA, 0x1, 0x3, 0x2, 0x6, 0x1, 0x4, 0x1,
+    0xB, 0x7, 0xA, 0x4, 0x5, 0x7, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0xA, 0x0, 0x0, 0x4,
+    0x5, 0x0, 0x5, 0x2, 0x0, 0x2, 0x23, 0x6, 0x1, 0x1, 0x9, 0x5, 0x0, 0x5, 0x1, 0x0,
+    0xD, 0x6, 0x1, 0x0, 0x5, 0x0, 0x10, 0x0, 0x5, 0x4, 0x0, 0x2, 0x1, 0x2, 0x0, 0x5,
+    0x0, 0x0, 0x7, 0xF, 0x4, 0x2, 0x0, 0x18, 0x2, 0x9, 0x5, 0x6, 0x0, 0x2, 0x1, 0x0,
+    0x2, 0x0, 0x14, 0x0, 0x4, 0x0, 0x0, 0x1, 0x1, 0x1D, 0x5, 0x2, 0x2, 0x1, 0x0, 0x4,
+    0x5, 0x2, 0x2, 0x19, 0x7, 0x11, 0x0, 0x0, 0x0, 0x20, 0x9, 0x0, 0x3, 0x4, 0x2, 0xA,
+    0x1, 0x1, 0x4, 0x2, 0x0, 0x0, 0x4, 0x5, 0xA, 0x0, 0x1, 0x0, 0x0, 0x1, 0x6, 0x7,
+    0x0, 0x5, 0x2, 0x0, 0x0, 0x20, 0x2, 0x0, 0x0, 0x21, 0x0, 0x1, 0x0, 0xE, 0x1, 0x0,
+    0x4, 0xA, 0x3, 0x2, 0x4, 0x1, 0x3, 0x1, 0x2, 0x6, 0x8, 0x1, 0x6, 0xF, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0x4, 0x1, 0x8, 0x3, 0x1, 0x1, 0x5, 0x3, 0x0, 0x1, 0x2, 0x5, 0x2,
+    0x4, 0x1, 0x1, 0x8, 0x1, 0x9, 0x8, 0x7, 0x4, 0x0, 0x1B, 0x2, 0x0, 0x1, 0x2, 0x8,
+    0x0, 0x0, 0x6, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x2, 0x0, 0x1, 0x0,
+    0x4, 0x24, 0x0, 0x0, 0x0, 0x3, 0x1, 0x3, 0x35, 0x2, 0x6, 0xD, 0x2, 0x1, 0x1, 0x4,
+    0x1, 0x5, 0x4, 0x5, 0x4, 0x1, 0x2, 0x1, 0x1, 0x1, 0x5, 0x0, 0x0, 0x0, 0x5, 0x0,
+    0x2, 0x0, 0x3, 0x5, 0x0, 0x1, 0x0, 0x10, 0x0, 0x3, 0x1, 0x3, 0x1, 0x1, 0x5, 0x3,
+    0x0, 0x1, 0xE, 0x21, 0x0, 0x0, 0x0, 0x1, 0x1, 0x0, 0x3, 0x0, 0x1, 0x0, 0x3, 0x1,
+    0x4, 0x0, 0x2, 0x0, 0x0, 0x0, 0x1, 0x3, 0x0, 0x3, 0x11, 0x3, 0x0, 0x0, 0x1, 0x4,
+    0x1, 0x1, 0x0, 0x4, 0x0, 0x1, 0x4, 0x4, 0x3, 0x9, 0x0, 0xC, 0x0, 0x1, 0xD, 0x0,
+    0x5, 0x0, 0x8, 0x2, 0x0, 0x0, 0x1, 0xA, 0x0, 0x8, 0x0, 0x1, 0x4, 0xA, 0x0, 0x1,
+    0x6, 0x0, 0x4, 0x0, 0x0, 0x3, 0x6, 0x0, 0x1, 0x0, 0x1, 0x0, 0x3, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0xC, 0x0, 0x0, 0x4, 0x1, 0x6, 0x1, 0x0, 0x6, 0x4, 0x9, 0xA, 0x0, 0xC,
+    0x0, 0x1, 0x0, 0x3, 0xB, 0x0, 0x8, 0x4, 0x0, 0x8, 0x7, 0x20, 0x4, 0x0, 0x2, 0x4,
+    0x0, 0x1, 0x4, 0x1, 0x4, 0x3, 0x1, 0x0, 0x0, 0x0, 0x8, 0xB, 0x0, 0x8, 0x7, 0xB,
+    0x10, 0xB, 0x0, 0x1, 0x1, 0x1, 0x4, 0x5, 0xF, 0x0, 0x7, 0x5, 0x6, 0x0, 0x0, 0x7,
+    0x4, 0x6, 0x1, 0xC, 0x11, 0x1, 0x1, 0x7, 0xB, 0x0, 0x3, 0x1, 0x7, 0x26, 0x9, 0x6,
+    0x23, 0xB, 0x0, 0x0, 0xF, 0x0, 0x0, 0x3, 0x2, 0x1, 0x0, 0x4, 0x3, 0x1B, 0xC, 0x0,
+    0x2, 0xE, 0xD, 0x1, 0x9, 0x11, 0x1, 0x0, 0x6, 0x0, 0x1, 0x0, 0xF, 0x0, 0x1, 0x6,
+    0x2, 0x0, 0x8, 0x1, 0xA, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x3, 0x0, 0x1,
+    0x0, 0x2, 0x2, 0x0, 0x6, 0x4, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC, 0x1, 0x1, 0x4,
+    0xC, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1, 0x0, 0x10, 0xE, 0x3, 0x0, 0x1, 0x0, 0x9, 0x2,
+    0x6, 0x12, 0x1, 0x13, 0x4, 0x3, 0x14, 0x1, 0x2, 0x25, 0x4, 0x0, 0x7, 0x6, 0x1, 0x3,
+    0x4, 0x6, 0xA, 0x1, 0x14, 0x7, 0x4, 0x0, 0x1, 0x0, 0x6, 0x1, 0xB, 0xA, 0x5, 0x0,
+    0x5, 0x2, 0x7, 0x1, 0x17, 0xA, 0x4, 0x0, 0x2, 0x1, 0x0, 0x0, 0x11, 0x0, 0x0, 0x0,
+    0x0, 0xB, 0x7, 0x0, 0xD, 0x9, 0x0, 0xF, 0x9, 0xF, 0x0, 0xC, 0x0, 0x3, 0x0, 0x0,
+    0x6, 0x0, 0x0, 0x6, 0x0, 0x0, 0x1, 0x1, 0x0, 0x3, 0x3, 0x1, 0x0, 0x8, 0x1, 0x3,
+    0x3, 0x0, 0xB, 0x7, 0x1, 0x0, 0x0, 0x8, 0x0, 0x3, 0xE, 0x1, 0x1, 0x6, 0x1, 0x7,
+    0x8, 0x0, 0x2, 0x0, 0xD, 0x0, 0x5, 0x0, 0x0, 0x0, 0x0, 0x1, 0x5, 0x3, 0x5, 0x0,
+    0x1, 0x0, 0xA, 0x4, 0xE, 0x1, 0x0, 0x1, 0x3, 0x0, 0x1, 0x2, 0x2, 0x7, 0x1, 0x14,
+    0x10, 0x6, 0x3, 0x1, 0x6, 0x5, 0x6, 0x1, 0x5, 0x4, 0x0, 0x0, 0xA, 0xA, 0x3, 0x0,
+    0xF, 0x0, 0x0, 0x0, 0xE, 0x0, 0x7, 0x0, 0x0, 0xB, 0xE, 0x0, 0x0, 0x0, 0x7, 0x4,
+    0x4, 0x2, 0x5, 0x1, 0x0, 0x0, 0x0, 0x1, 0x1, 0x4, 0xD, 0x1D, 0x0, 0x0, 0x10, 0x1,
+    0x0, 0x7, 0x3, 0xA, 0x2, 0x4, 0xA, 0x0, 0x3, 0x6, 0x3, 0x0, 0x0, 0x7, 0x1, 0x1,
+    0x0, 0xD, 0x8, 0x0, 0x0, 0x5, 0x4, 0x6, 0x0, 0xE, 0x3, 0x0, 0x0, 0x1, 0x14, 0xE,
+    0x0, 0x3, 0x0, 0xA, 0x2, 0x1, 0x5, 0x1, 0x9, 0x0, 0x1, 0xA, 0x1, 0xD, 0x0, 0x0,
+    0x17, 0x5, 0x0, 0x3, 0x0, 0x2, 0x4, 0x8, 0x0, 0xB, 0x8, 0x0, 0x1, 0x1, 0xE, 0x0,
+    0x3, 0xC, 0x0, 0x1, 0x5, 0xE, 0x6, 0x0, 0xC, 0x4, 0x0, 0x2, 0x2, 0xF, 0xC, 0x0,
+    0x4, 0x5, 0x3, 0x1, 0x1, 0x1, 0x8, 0x6, 0x0, 0x0, 0x5, 0x2, 0x4, 0x2, 0x2, 0x0,
+    0x9, 0x0, 0x1D, 0x26, 0x6, 0x1, 0x6, 0x6, 0x0, 0x5, 0x8, 0x3, 0x0, 0x0, 0x2, 0x0,
+    0x0, 0x4, 0xB, 0x1, 0x0, 0x6, 0x0, 0x4, 0x0, 0x1, 0x0, 0x0, 0x4, 0x0, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x9, 0x0, 0x3, 0x1, 0x0, 0x1, 0x2, 0x1, 0x14, 0x1, 0x3, 0x7, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x1, 0x0, 0x1, 0x4, 0x5, 0x14, 0x0, 0x2,
+    0x1, 0x7, 0x3, 0x3, 0x3, 0x2, 0x3, 0x3, 0x0, 0x0, 0x10, 0x0, 0x0, 0x6, 0x1, 0x6,
+    0x6, 0x5, 0x5, 0x0, 0x3, 0xC, 0x4, 0x1, 0x0, 0x6, 0x8, 0x6, 0x2, 0x6, 0x4, 0x0,
+    0x1, 0x11, 0x0, 0x2, 0x3, 0xD, 0x0, 0x0, 0x1, 0x2, 0x2, 0x6, 0xC, 0x0, 0x0, 0x0,
+    0x0, 0x19, 0x1, 0x1, 0x0, 0x0, 0x8, 0x0, 0x3, 0x3, 0x1, 0x1, 0x4, 0x8, 0x6, 0x4,
+    0x0, 0x0, 0x5, 0x3, 0xB, 0x6, 0x0, 0x5, 0x1E, 0x8, 0x3, 0x5, 0x9, 0x4, 0x3, 0x1,
+    0x7, 0x5, 0x2, 0x6, 0x1, 0x7, 0x4, 0xD, 0x1, 0x1, 0x4, 0x8, 0x4, 0xC, 0x0, 0xE,
+    0x1, 0x8, 0xF, 0x3, 0x8, 0x8, 0x6, 0x0, 0xA, 0x1, 0x2, 0x16, 0xA, 0x2, 0x3, 0x3,
+    0x1, 0x1, 0x5, 0x0, 0x2, 0x9, 0x1, 0x1, 0x4, 0x5, 0x0, 0x6, 0x2, 0x9, 0x0, 0x1,
+    0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0xF, 0x2, 0x8, 0x0, 0x0, 0x3, 0x5, 0x3, 0x1, 0x3,
+    0x6, 0x0, 0x1, 0x1, 0x9, 0x14, 0x7, 0x1, 0x11, 0x0, 0x6, 0x4, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0x0, 0x5, 0x0, 0x1, 0x0, 0x0, 0x7, 0x4, 0xE, 0x0, 0x1, 0x0, 0x0, 0x2,
+    0x7, 0x8, 0x0, 0x0, 0xA, 0x1, 0x10, 0x11, 0x3, 0x6, 0x0, 0x3, 0x0, 0x23, 0x0, 0x0,
+    0x0, 0x4, 0x19, 0x6, 0x4, 0x9, 0x0, 0x1, 0xC, 0x1, 0x0, 0x7, 0x0, 0x5, 0x0, 0x12,
+    0xB, 0x1, 0x0, 0x0, 0x1, 0x0, 0x1, 0x6, 0x0, 0x0, 0x3, 0x0, 0x1, 0x0, 0x3, 0x0,
+    0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x1, 0x5, 0x0, 0x1, 0x0, 0x2, 0x8,
+    0x1, 0x1, 0x4, 0x0, 0x5, 0x0, 0xF, 0x0, 0x0, 0x2, 0x2B, 0x0, 0x2, 0x0, 0x1, 0x8,
+    0xC, 0x2, 0x1, 0x4, 0x0, 0x2, 0x4, 0x0, 0x1, 0x0, 0x1, 0xC, 0x4, 0x4, 0x1, 0x3,
+    0x5, 0x9, 0x0, 0x2, 0xD, 0x0, 0x3, 0x5, 0x2, 0x0, 0x1, 0x4, 0x0, 0x7, 0x1, 0x0,
+    0x0, 0x6, 0x1, 0x4, 0x0, 0x5, 0x0, 0x15, 0x0, 0x0, 0x2, 0x3, 0x4, 0x3, 0x0, 0x1,
+    0x6, 0x0, 0xA, 0x6, 0x1, 0x1, 0x9, 0x2, 0x3, 0x6, 0x8, 0xB, 0x1, 0x0, 0x17, 0x9,
+    0xD, 0xA, 0x3, 0x1, 0x34, 0x5, 0x2, 0x0, 0x5, 0x2, 0x5, 0x0, 0x0, 0x0, 0x10, 0x0,
+    0x1, 0x5, 0x0, 0x2, 0x7, 0x2, 0x4, 0x0, 0x2, 0x1, 0x0, 0x8, 0x2, 0x6, 0x1, 0x0,
+    0x0, 0xF, 0x0, 0x0, 0x8, 0x2, 0x4, 0x9, 0x0, 0x4, 0x4, 0x1, 0x2, 0x5, 0x8, 0x0,
+    0x0, 0x0, 0x1, 0x0, 0x0, 0x1, 0x4, 0x1, 0x14, 0x8, 0xD, 0x0, 0x2, 0x0, 0x0, 0x0,
+    0x0, 0x10, 0x1, 0xB, 0x0, 0x1, 0x4, 0x5, 0x0, 0x7, 0x4, 0x0, 0x0, 0x1, 0x2, 0x6,
+    0x1, 0x0, 0x14, 0x4, 0x0, 0x4, 0xD, 0x5, 0x5, 0x16, 0x0, 0x3, 0x4, 0x0, 0x0, 0x5,
+    0x19, 0x2, 0x1, 0x2, 0x3, 0x0, 0x2, 0xF, 0x0, 0x1, 0x0, 0x2, 0x5, 0x1, 0x3, 0x4,
+    0x2, 0x2, 0xB, 0x4, 0x16, 0x1, 0x6, 0xD, 0x3, 0x0, 0x0, 0x6, 0x0, 0x7, 0x6, 0x11,
+    0xD, 0x1, 0x6, 0x5, 0x9, 0x0, 0x2, 0x6, 0x0, 0x0, 0x5, 0x5, 0x0, 0x5, 0x5, 0x6,
+    0x0, 0x11, 0x0, 0x5, 0x0, 0xC, 0x0, 0x1, 0x0, 0x6, 0x8, 0x0, 0x1, 0x0, 0x4, 0x6,
+    0x7, 0x4, 0x1, 0x5, 0x3, 0x4, 0x2, 0x1, 0x8, 0x1, 0x1, 0x9, 0x0, 0x2, 0x8, 0x8,
+    0x0, 0x1, 0x1, 0x2, 0x2, 0x6, 0x0, 0x11, 0x4, 0x0, 0x0, 0x4, 0x1, 0x1, 0x2, 0x0,
+    0x1B, 0x6, 0x7, 0x1, 0x0, 0x7, 0x2, 0x4, 0xE, 0x0, 0x9, 0x1, 0x0, 0x1, 0x5, 0x1,
+    0x0, 0xA, 0x2, 0x0, 0x4, 0x0, 0x0, 0x1, 0x1, 0xF, 0x16, 0x2, 0x10, 0x0, 0x8, 0x0,
+    0x0, 0x0, 0x4, 0x17, 0x5, 0x6, 0x0, 0x0, 0x0, 0x0, 0x2, 0xE, 0x9, 0x1, 0x5, 0x0,
+    0x7, 0x0, 0xB, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x2, 0x7, 0x5, 0x5, 0x4, 0x0, 0x11, 0x2, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x2, 0x9,
+    0x6, 0x2, 0x1, 0x3, 0x1, 0x4, 0x2, 0x0, 0x1, 0x1, 0x1, 0x1, 0x6, 0x3, 0x1, 0x8,
+    0x0, 0x7, 0x0, 0x0, 0x0, 0x1, 0x9, 0x9, 0x5, 0x0, 0x5, 0xE, 0x0, 0x4, 0x0, 0x0,
+    0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x3, 0x1, 0x7, 0x5, 0x0, 0x2, 0x11, 0x7, 0x0,
+    0x2, 0xC, 0x3, 0x3, 0x2, 0x8, 0x1, 0x3, 0x0, 0x7, 0x0, 0x6, 0x0, 0x1, 0x0, 0x3,
+    0x0, 0x0, 0x1, 0x2, 0x6, 0x5, 0x22, 0x4, 0x7, 0x1, 0x2, 0x0, 0x8, 0x0, 0x5, 0x1,
+    0x0, 0x1, 0x1, 0x3, 0x0, 0x0, 0x0, 0x0, 0x4, 0x6, 0x1, 0x0, 0x0, 0x0, 0x1E, 0x3,
+    0x0, 0xE, 0x4, 0x4, 0x0, 0x3, 0x0, 0x1, 0x2, 0x4, 0x0, 0x2, 0x6, 0x0, 0x3, 0x0,
+    0x1, 0x1, 0x6, 0x17, 0x4, 0x12, 0x9, 0x0, 0x4, 0x4, 0x0, 0x4, 0x1, 0x4, 0x5, 0x1,
+    0x2, 0x1, 0x8, 0x5, 0x1B, 0x0, 0x0, 0x5, 0x0, 0x0, 0x1, 0x2, 0x1, 0x3, 0x8, 0x0,
+    0x2, 0x3, 0x9, 0x5, 0x0, 0x1, 0x1, 0x35, 0x15, 0x6, 0xC, 0x2, 0x9, 0x0, 0x0, 0x2,
+    0x0, 0x0, 0x1, 0x3, 0x0, 0x7, 0x9, 0x2, 0x5, 0xC, 0x2, 0x0, 0x9, 0x1, 0x3, 0x1,
+    0x0, 0x11, 0x0, 0x9, 0x0, 0x16, 0x1, 0x1, 0x3, 0x1, 0x0, 0x1, 0x5, 0x0, 0x2, 0x0,
+    0x0, 0x4, 0x2, 0x4, 0x6, 0x3, 0x9, 0xF, 0x8, 0x1, 0x2, 0x6, 0x0, 0x21, 0x2, 0x0,
+    0x3, 0x1, 0x7, 0x11, 0x2, 0x0, 0x0, 0x0, 0x2, 0x5, 0x12, 0x0, 0x2, 0x0, 0x1, 0x4,
+    0x0, 0x8, 0x0, 0x1, 0x0, 0x0, 0x5, 0x0, 0x4, 0x8, 0x0, 0x4, 0x9, 0x4, 0x0, 0x0,
+    0x5, 0x4, 0x7, 0x4, 0xF, 0x1, 0x6, 0x3, 0x3, 0x4, 0xA, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0x0, 0x8, 0x0, 0x0, 0x1C, 0x3, 0x1, 0x0, 0x7, 0x7, 0x0, 0x0, 0x5,
+    0x8, 0x7, 0x2, 0x9, 0x0, 0x2, 0x18, 0x0, 0x1, 0x0, 0x1, 0x1A, 0x0, 0x0, 0x2, 0x44,
+    0x7, 0x4, 0x2, 0x0, 0x1, 0x1F, 0x1, 0x2, 0x8, 0x7, 0x6, 0x4, 0x0, 0x1, 0x4, 0x3,
+    0x6, 0x4, 0x5, 0x0, 0x2, 0x0, 0x4, 0x8, 0x10, 0xD, 0x9, 0x9, 0x0, 0x4, 0x5, 0x1,
+    0x3, 0x0, 0x1A, 0x6, 0x1, 0x1, 0x2, 0x0, 0x0, 0x9, 0x1, 0xC, 0xB, 0x0, 0x1, 0x1,
+    0x0, 0x3, 0x1, 0x3, 0x1, 0x10, 0x13, 0x4, 0x0, 0x17, 0x0, 0x2, 0x6, 0x4, 0x0, 0x0,
+    0x2, 0x1, 0x1, 0x0, 0x10, 0x0, 0x2, 0x0, 0x0, 0x4, 0x3, 0x1, 0x6, 0x8, 0x5, 0x1,
+    0x5, 0x5, 0xF, 0x2, 0x0, 0x0, 0x0, 0x5, 0x5, 0x0, 0x4, 0x0, 0x0, 0x0, 0xF, 0xA,
+    0x20, 0x1, 0x0, 0xA, 0x11, 0x0, 0x0, 0x1, 0x14, 0x2, 0x2, 0x6, 0x3, 0x0, 0x1, 0x0,
+    0x0, 0x0, 0x8, 0x5, 0x1, 0x4, 0x6, 0x3, 0x0, 0x7, 0x0, 0x6, 0x2, 0x0, 0x0, 0x5,
+    0x1, 0x5, 0x0, 0x4, 0x3, 0x4, 0x2, 0xA, 0x5, 0xA, 0x0, 0x0, 0x3, 0x4, 0x9, 0xC,
+    0x1, 0x0, 0x3, 0x0, 0x0, 0x1, 0x2, 0x2, 0x6, 0x0, 0x8, 0x4, 0x1, 0xA, 0xC, 0x2,
+    0x4, 0x0, 0x0, 0x2, 0x2, 0x5, 0x15, 0x0, 0x3, 0xD, 0x2, 0x5, 0x7, 0x1, 0x0, 0x1,
+    0x2, 0x1, 0x12, 0x11, 0x1D, 0x1, 0x0, 0x1, 0x4, 0x3, 0xB, 0x0, 0x2, 0x1A, 0x2, 0x1,
+    0x1D, 0x0, 0x1, 0x5, 0x4, 0x2, 0x7, 0x3, 0x0, 0x0, 0x1, 0x4, 0x0, 0x0, 0x4, 0x0,
+    0x0, 0x1C, 0x0, 0xF, 0x0, 0x0, 0x16, 0xC, 0x1, 0x0, 0x2, 0x1, 0x10, 0x2, 0x0, 0x1,
+    0x6, 0x0, 0x6, 0x1E, 0x1, 0x3, 0x1, 0x0, 0xD, 0x1, 0x5, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x1, 0x1, 0x8, 0x7, 0x11, 0x0, 0x5, 0x0, 0x2, 0x4, 0x7, 0x0, 0xA, 0x1A, 0x2, 0x7,
+    0x0, 0x5, 0x1, 0x6, 0x4, 0x14, 0x4, 0xB, 0x1, 0x6, 0x0, 0x1, 0xC, 0x0, 0x0, 0x6,
+    0x9, 0x0, 0x0, 0x0, 0x0, 0x3, 0x0, 0xD, 0x0, 0x4, 0x0, 0x1, 0x32, 0x1, 0x7, 0x1,
+    0x1, 0x5, 0x0, 0x5, 0x5, 0x4, 0x2, 0x1, 0x5, 0x3, 0x1, 0x1, 0x2, 0xD, 0x6, 0x1,
+    0x0, 0x0, 0x9, 0x3, 0xB, 0x4, 0x0, 0x6, 0x3, 0x0, 0x0, 0x2, 0x0, 0x1, 0x4, 0x1,
+    0x0, 0x0, 0x4, 0x2, 0x4, 0x3, 0x4, 0x4, 0x0, 0x0, 0x2, 0x1, 0x1, 0x9, 0x1, 0x2,
+    0xC, 0x0, 0x9, 0x6, 0x1, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0x5, 0x6, 0x22, 0xE,
+    0x1, 0x0, 0x4, 0xC, 0x2, 0x7, 0x3, 0x2, 0x0, 0x0, 0x15, 0x9, 0x0, 0xE, 0x0, 0x4,
+    0x0, 0x0, 0x0, 0x0, 0xE, 0x2, 0x8, 0x0, 0x7, 0x0, 0x0, 0x2, 0x12, 0x0, 0x6, 0x1,
+    0x16, 0x5, 0x1, 0x0, 0xE, 0x0, 0x4, 0x0, 0x0, 0x12, 0x0, 0x0, 0x5, 0x20, 0x3, 0x4,
+    0xA, 0xC, 0x7, 0x1, 0x1, 0x14, 0x1D, 0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x2, 0x0, 0x6,
+    0x3, 0x0, 0x0, 0x1, 0x0, 0xA, 0x8, 0x2, 0x5, 0x7, 0x3, 0x3, 0x2, 0x5, 0x4, 0x3,
+    0x13, 0xA, 0x0, 0x0, 0xF, 0x24, 0x0, 0x0, 0xB, 0x8, 0x1, 0x7, 0x1, 0x1, 0x4, 0x3,
+    0x16, 0x0, 0x2, 0x0, 0x0, 0x5, 0x2, 0x7, 0x1, 0x0, 0xF, 0x6, 0x5, 0x0, 0x1, 0x3,
+    0x26, 0x1, 0x1, 0x0, 0xA, 0x0, 0x2, 0x2, 0x0, 0x0, 0x0, 0x0, 0x1, 0x2, 0x1, 0x1,
+    0x4, 0x4, 0x3, 0x1, 0x8, 0x4, 0x2, 0x0, 0x8, 0x1, 0x5, 0x1, 0xA, 0x6, 0x0, 0xD,
+    0x7, 0x1, 0x7, 0x6, 0x0, 0x0, 0x1, 0x0, 0x0, 0x6, 0x7, 0x0, 0x1, 0x4, 0x2, 0x0,
+    0x1, 0x4, 0x0, 0x6, 0x1E, 0x0, 0x11, 0x1, 0x1, 0xD, 0x0, 0x2, 0xB, 0x0, 0x0, 0xA,
+    0x5, 0x0, 0xC, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x5, 0x4, 0x28, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x3, 0x2, 0x0, 0x1A, 0x1, 0x4, 0x0, 0x0, 0x1, 0xC, 0x9, 0x2,
+    0x1, 0x6, 0x0, 0x7, 0x2, 0x31, 0x0, 0x6, 0xE, 0x11, 0x1, 0x21, 0x0, 0x3, 0x2, 0x16,
+    0x3, 0x9, 0x0, 0x9, 0xD, 0x6, 0x5, 0x1, 0x4, 0x20, 0x0, 0x2, 0xF, 0xB, 0x5, 0x0,
+    0x15, 0x1, 0x5, 0x2, 0xB, 0xB, 0x0, 0x0, 0x9, 0x1C, 0x0, 0x0, 0x5, 0x4, 0x3, 0x1,
+    0x0, 0x1, 0x6, 0x0, 0x9, 0x4, 0x0, 0xB, 0xB, 0x0, 0x0, 0x4, 0x0, 0x1, 0x3, 0x23,
+    0x1, 0x2, 0x1, 0x2, 0x1, 0x6, 0x0, 0x8, 0x2, 0x2, 0x4, 0x0, 0xC, 0x2, 0x0, 0x0,
+    0x1, 0x1, 0x2, 0x2, 0x5, 0xA, 0xE, 0x1, 0x0, 0x0, 0x1, 0x1, 0x0, 0x3, 0x3, 0x7,
+    0x7, 0x0, 0x5, 0x3, 0x4, 0x0, 0x7, 0x0, 0x15, 0x5, 0x17, 0x1, 0x2, 0xF, 0x4, 0x13,
+    0x3, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1D, 0x4, 0x0, 0x5, 0x0, 0x1, 0x5, 0x7, 0x2, 0xA,
+    0x1, 0x0, 0x1, 0x0, 0x0, 0x9, 0x9, 0x0, 0xC, 0x1, 0x2, 0x1, 0x1, 0x4, 0x1, 0x0,
+    0x1, 0x0, 0x1, 0x14, 0x11, 0x0, 0x7, 0x0, 0x1, 0x6, 0x7, 0x2, 0x2, 0x0, 0x6, 0x0,
+    0x2, 0x8, 0x0, 0x1, 0x11, 0x2, 0x4, 0x3, 0x5, 0x4, 0x3, 0x0, 0x7, 0x6, 0x13, 0xF,
+    0x0, 0x8, 0x5, 0x3, 0x3, 0x3, 0x1, 0x1, 0x9, 0x0, 0x2, 0x2, 0x0, 0x1, 0x2, 0x1,
+    0x3, 0xA, 0x5, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0x14, 0x4, 0x3, 0x1, 0x1, 0x4,
+    0x0, 0x5, 0x1, 0x5, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x5, 0x1, 0x0, 0xC, 0xC, 0x0,
+    0x8, 0x1, 0x2, 0x8, 0xB, 0x0, 0x0, 0x6, 0x1, 0x1, 0x0, 0x2, 0x21, 0x14, 0x13, 0x4,
+    0x4, 0x5, 0x1, 0x1B, 0x4, 0x3, 0x14, 0x2, 0xA, 0x1D, 0x3, 0x9, 0x8, 0x0, 0x0, 0x0,
+    0xF, 0xD, 0x7, 0x4, 0x5, 0x4, 0x2, 0x0, 0x27, 0x5, 0x11, 0x4, 0x2, 0x1, 0xB, 0x17,
+    0x0, 0x3, 0x0, 0x1, 0xC, 0x0, 0x2, 0x8, 0x5, 0x1, 0x3, 0x14, 0xD, 0x6, 0x0, 0x6,
+    0x5B, 0x1, 0xD, 0x0, 0x1, 0x9, 0x4, 0x10, 0x3, 0xD, 0x0, 0x1, 0x6, 0x1, 0x0, 0x0,
+    0x0, 0x2, 0x0, 0x7, 0xA, 0x0, 0x10, 0x0, 0x1, 0x3, 0x0, 0x0, 0x5, 0x2, 0x9, 0x5,
+    0x1, 0x4, 0x6, 0x9, 0x0, 0x0, 0x6, 0x4, 0x0, 0x4, 0x1, 0x0, 0x2, 0xD, 0xC, 0x8,
+    0x1, 0x1, 0x0, 0x26, 0x0, 0x8, 0xA, 0x0, 0x2, 0x5, 0x0, 0x0, 0x1, 0x8, 0x0, 0x2,
+    0x0, 0x1, 0x2, 0x0, 0x0, 0x6, 0x1, 0x3, 0x6, 0x0, 0x2, 0x6, 0x0, 0x1, 0x5, 0x3,
+    0x3, 0x0, 0x2, 0x9, 0x0, 0x7, 0x19, 0x0, 0x0, 0x0, 0x4, 0xC, 0x1, 0x24, 0x0, 0x1D,
+    0x5, 0x3, 0x4, 0x0, 0x7, 0x0, 0x0, 0xF, 0x3, 0x1, 0x2, 0x0, 0x3, 0x3, 0x2, 0x1,
+    0x0, 0x12, 0x0, 0x16, 0x6, 0xC, 0x2, 0x0, 0x4, 0x1, 0x1, 0x2, 0x1, 0x3, 0x2, 0xB,
+    0x0, 0x4, 0x3, 0x2, 0x5, 0x2, 0x0, 0x0, 0x0, 0x2, 0x1, 0x1, 0x1, 0x17, 0x5, 0x3,
+    0x0, 0x19, 0xB, 0x4, 0x7, 0x1, 0x1, 0xB, 0x4, 0x0, 0x5, 0x1, 0x8, 0x0, 0x4, 0x5,
+    0x2, 0x2, 0x4, 0x0, 0x6, 0x20, 0x2, 0x0, 0x1, 0xC, 0xF, 0x0, 0x0, 0x8, 0xE, 0x4,
+    0x1, 0x10, 0x0, 0x8, 0x0, 0x10, 0x11, 0x1, 0x0, 0x1, 0x5, 0x3, 0x20, 0x4, 0x5, 0x0,
+    0x2, 0x9, 0x20, 0x0, 0x4, 0x3, 0x7, 0x1, 0xD, 0x1, 0xF, 0x2, 0x9, 0x1, 0x0, 0x0,
+    0x10, 0x8, 0xF, 0x0, 0x0, 0x0, 0x7, 0x0, 0xE, 0x7, 0x1, 0x1, 0xF, 0x0, 0xA, 0x0,
+    0xC, 0x3, 0x1A, 0x0, 0x9, 0x2, 0x4, 0x1, 0x7, 0x5, 0x1, 0x0, 0x4, 0x8, 0x2, 0xA,
+    0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x16, 0x0, 0x5, 0x1, 0x1, 0x0, 0x0, 0x5, 0x9,
+    0x4, 0x0, 0x2, 0x0, 0x1, 0x0, 0x7, 0x0, 0xC, 0x9, 0x0, 0x0, 0x1, 0x2, 0x5, 0x8,
+    0x22, 0x0, 0x0, 0x6, 0x0, 0x0, 0x1, 0x0, 0x9, 0x5, 0x0, 0x1, 0xA, 0x4, 0x0, 0xA,
+    0x0, 0x0, 0xB, 0x0, 0x0, 0xE, 0x1A, 0xF, 0x8, 0x0, 0xC, 0x0, 0xB, 0x0, 0x7, 0x1,
+    0x4, 0x4, 0x1, 0x1, 0x1, 0x2, 0x18, 0x3, 0x0, 0x6, 0x8, 0x6, 0x2, 0x0, 0x7, 0x8,
+    0x1, 0x2, 0xD, 0x2, 0x1, 0x4, 0x4, 0x26, 0x1, 0x0, 0x5, 0x2, 0x1, 0x2, 0x1E, 0x2,
+    0xC, 0x0, 0x1, 0x5, 0x1, 0x3, 0x1, 0x9, 0x0, 0x19, 0xE, 0x5, 0xA, 0x3, 0x6, 0x3,
+    0x1, 0x9, 0x0, 0x3, 0x0, 0x0, 0x0, 0x4, 0x7, 0x0, 0x6, 0x22, 0x0, 0x0, 0x4, 0x2,
+    0x5, 0x6, 0x6, 0x0, 0x1, 0x0, 0x2, 0x7, 0x1, 0x0, 0x2, 0x1, 0x1, 0x0, 0x1, 0x0,
+    0x0, 0xE, 0x0, 0x1, 0x1A, 0x10, 0x1, 0x0, 0x5, 0x1, 0x1, 0x6, 0x8, 0x2A, 0x1, 0x4,
+    0x3, 0x7, 0x0, 0x8, 0x5, 0x1, 0x4, 0x2, 0x4, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x16,
+    0xF, 0x2, 0x0, 0xD, 0x2A, 0x17, 0x6, 0x20, 0x7, 0x0, 0x1, 0x6, 0x0, 0x5, 0x10, 0x1,
+    0x5, 0x6, 0xD, 0x2, 0x6, 0x2, 0xA, 0x3, 0x2, 0x13, 0x0, 0x0, 0x3, 0x0, 0x0, 0x16,
+    0x0, 0x1, 0x0, 0xB, 0x5, 0x1, 0x14, 0xB, 0x0, 0x0, 0x2, 0x4, 0x1, 0x0, 0x0, 0x5,
+    0x0, 0x0, 0x1, 0x8, 0x5, 0x7, 0x0, 0x0, 0x0, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x2,
+    0x0, 0x9, 0x3, 0x1, 0x4, 0x1, 0x6, 0xA, 0x8, 0x33, 0xD, 0x3, 0x3, 0x0, 0x3, 0x4,
+    0x1, 0x0, 0x3, 0x4, 0x7, 0x0, 0x0, 0x1, 0x4, 0x0, 0x9, 0x7, 0x10, 0x2, 0x3, 0x2,
+    0xF, 0x3, 0x0, 0x0, 0xA, 0x1, 0x5, 0x0, 0x1, 0x1, 0x0, 0x0, 0x0, 0x1, 0x0, 0x2,
+    0x13, 0x0, 0x6, 0x3, 0x0, 0x0, 0x0, 0x16, 0x3, 0x3, 0x5, 0x3, 0x12, 0x4, 0x5, 0x4,
+    0xF, 0x0, 0x4, 0x10, 0x0, 0x1, 0x10, 0x0, 0x0, 0xE, 0x0, 0x4, 0x7, 0x2, 0x0, 0x5,
+    0x1, 0x0, 0x0, 0x3, 0x0, 0xB, 0x6, 0x8, 0x1, 0x3, 0x0, 0x3, 0x4, 0x0, 0xB, 0x0,
+    0xF, 0x0, 0x0, 0x0, 0x0, 0x8, 0x19, 0x4, 0x0, 0x7, 0x1, 0x1, 0x4, 0x0, 0x0, 0xD,
+    0x9, 0x2, 0x3, 0x0, 0x0, 0x0, 0x1, 0x3, 0x0, 0x1, 0x5, 0x7, 0xD, 0xF, 0x1, 0x0,
+    0x6, 0x1, 0x2, 0x0, 0x0, 0x0, 0x0, 0xF, 0xE, 0x29, 0x0, 0x4, 0x0, 0x1, 0x1B, 0x1,
+    0x2, 0x0, 0x6, 0x0, 0x2, 0x2, 0x24, 0x5, 0x1, 0x1, 0x1, 0x0, 0x2, 0x0, 0x0, 0x3,
+    0x2, 0x9, 0x0, 0x4, 0x9, 0x1E, 0x0, 0x4, 0x2, 0x18, 0x3, 0x0, 0x0, 0x8, 0x2, 0x7,
+    0x2, 0x0, 0x0, 0x4, 0x3, 0x0, 0x12, 0x0, 0x5, 0x0, 0x1, 0x0, 0x1, 0x2, 0x0, 0x4,
+    0x0, 0x1, 0xB, 0x1, 0x8, 0xE, 0x0, 0x5, 0x5, 0x0, 0x3, 0x0, 0x1, 0x0, 0xD, 0xF,
+    0x2, 0x5, 0x0, 0x4, 0x9, 0x0, 0x0, 0x0, 0x3, 0xE, 0x0, 0x6, 0x34, 0x12, 0x0, 0x1F,
+    0x0, 0x2, 0x18, 0x1E, 0x4, 0x6, 0x0, 0x11, 0x3, 0x2, 0x5, 0x4, 0x0, 0x0, 0x2, 0x0,
+    0x3, 0x4, 0x1A, 0x4, 0x2, 0x1, 0x13, 0x4, 0x10, 0x0, 0x1, 0x11, 0x0, 0x32, 0x0, 0x5,
+    0x3, 0x4, 0x8, 0x6, 0x11, 0x1, 0xC, 0xC, 0x2, 0x9, 0x1E, 0x0, 0x3, 0xE, 0xC, 0x7,
+    0x3, 0x0, 0x0, 0x7, 0x1, 0x6, 0x4, 0xF, 0x3, 0x0, 0x0, 0x8, 0x4, 0xE, 0x0, 0x3,
+    0x8, 0x0, 0x0, 0x4, 0xC, 0x25, 0x0, 0x2, 0x1, 0x3, 0x2, 0x0, 0x5, 0x1, 0x12, 0x1,
+    0x8, 0x0, 0x0, 0x0, 0x4, 0x5, 0x0, 0x0, 0x3, 0x1D, 0x0, 0x0, 0x1, 0x0, 0x7, 0x7,
+    0x1, 0x0, 0x2, 0x0, 0x1, 0x0, 0x1, 0x2, 0x4, 0x1, 0x3, 0x3, 0x0, 0xA, 0x2, 0x4,
+    0x0, 0x0, 0x1D, 0x4, 0x2, 0xB, 0x0, 0x4, 0x0, 0x7, 0xB, 0x3, 0x1, 0x0, 0x6, 0x4,
+    0x1, 0x11, 0x9, 0x0, 0x1, 0x0, 0x3, 0x4, 0x9, 0x0, 0x0, 0x1, 0xD, 0x1, 0xB, 0x0,
+    0x3, 0x4, 0x4, 0x2, 0x5, 0x5, 0x1, 0x3, 0x0, 0x0, 0x0, 0x1, 0x18, 0x6, 0x0, 0xC,
+    0x6, 0x11, 0x1, 0x3, 0x3, 0x0, 0x0, 0xF, 0x9, 0x1, 0x0, 0x0, 0x24, 0x1, 0x0, 0x2,
+    0x32, 0x2, 0x1, 0x21, 0x0, 0x15, 0xE, 0x5, 0x0, 0x0, 0x0, 0x3, 0x3, 0x0, 0x6, 0x2B,
+    0x0, 0x2, 0x0, 0x7, 0xD, 0x4, 0x11, 0x0, 0x15, 0x5, 0x0, 0x7, 0x2, 0x27, 0x3, 0x0,
+    0x1, 0x2, 0xE, 0x0, 0x3, 0x0, 0x19, 0x1, 0x2, 0x1, 0x1, 0xB, 0x3, 0x1, 0x3, 0x2,
+    0x7, 0x0, 0x0, 0x0, 0x7, 0xB, 0x2, 0x2, 0x6, 0x1, 0x0, 0x2, 0x3, 0x0, 0x8, 0x0,
+    0x0, 0x4, 0x1, 0x0, 0xC, 0x0, 0x1, 0x5, 0xD, 0x6, 0x0, 0x3, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x2, 0x0, 0x0, 0x0, 0x11, 0x2, 0x2, 0x10, 0x1, 0x7, 0x9, 0x1D, 0x5, 0x5, 0x5,
+    0x7, 0x1, 0x2, 0x1, 0x0, 0x0, 0x1B, 0x13, 0x4, 0x0, 0x0, 0x6, 0x0, 0x1, 0xF, 0x1,
+    0x3, 0x4, 0xC, 0x2, 0xB, 0x1, 0x1, 0x6, 0xE, 0x9, 0x5, 0x3, 0x2, 0x10, 0x2, 0xC,
+    0x0, 0x0, 0x10, 0xA, 0x19, 0x5, 0x1, 0x17, 0x0, 0xE, 0x0, 0x0, 0x7, 0x7, 0x4, 0x1,
+    0x7, 0x0, 0x0, 0x0, 0x16, 0x0, 0x7, 0x0, 0x1E, 0x5, 0x11, 0x1F, 0x1, 0x3, 0x4, 0x1,
+    0x10, 0x0, 0x2, 0x2, 0x3, 0x6, 0x0, 0x8, 0x9, 0x0, 0x8, 0xC, 0x3, 0xB, 0x7, 0x3,
+    0x0, 0x0, 0x0, 0x1, 0xC, 0x1, 0x5, 0x0, 0x1D, 0x0, 0x0, 0x4, 0x7, 0x8, 0x1, 0x0,
+    0x0, 0x15, 0x1, 0x6, 0xE, 0x2D, 0x0, 0x6, 0x1, 0x1, 0x0, 0x0, 0x14, 0x1, 0x2, 0x1,
+    0x1, 0xA, 0x0, 0x2, 0x0, 0x0, 0x10, 0xB, 0x1, 0x5, 0xF, 0x1, 0x2, 0xC, 0x0, 0xA,
+    0x1, 0x5, 0x6, 0x1, 0x0, 0x0, 0x2, 0xA, 0x1, 0x0, 0x9, 0x0, 0x4, 0x3, 0x2, 0x1,
+    0x8, 0xC, 0x5, 0x1, 0x5, 0xF, 0x0, 0x0, 0x9, 0x4, 0x0, 0x9, 0x7, 0x0, 0xA, 0x1,
+    0x2, 0x6, 0xD, 0x2, 0x0, 0x1, 0x5, 0x11, 0x20, 0x0, 0x1, 0x3, 0x0, 0xB, 0x4, 0x27,
+    0x9, 0x3, 0x1, 0x0, 0x6, 0x8, 0x14, 0x1, 0x0, 0x2, 0x0, 0xC, 0x3, 0x1, 0x6, 0x5,
+    0xD, 0x1, 0x7, 0x0, 0x9, 0x4, 0x0, 0x2, 0x3, 0xE, 0x6, 0x2, 0x0, 0x24, 0xB, 0x1,
+    0x0, 0x6, 0x0, 0x4, 0x0, 0x1, 0xD, 0x10, 0x2, 0x9, 0x1, 0x15, 0x4, 0x1, 0x3, 0x3,
+    0x1, 0x2, 0x2, 0x11, 0x3, 0x0, 0x0, 0x8, 0x3, 0x0, 0x1, 0x6, 0x2, 0x8, 0x5, 0x2F,
+    0xE, 0x1, 0x7, 0x6, 0x7, 0xE, 0x3, 0x3, 0x0, 0xA, 0x0, 0x4, 0x0, 0x4, 0x1B, 0x16,
+    0x4, 0x3, 0x3, 0x7, 0x0, 0x3, 0x0, 0x5, 0x6, 0x1, 0x6, 0x7, 0x3, 0x1, 0x0, 0xA,
+    0x0, 0x3, 0xE, 0x10, 0x5, 0x3, 0x1, 0x7, 0x6, 0x0, 0x6, 0x5, 0x0, 0x1, 0x20, 0x4,
+    0x46, 0x0, 0x1, 0x0, 0x0, 0x0, 0x1, 0xA, 0x0, 0x2, 0x7, 0xE, 0x1, 0x0, 0x0, 0x4,
+    0x0, 0xD, 0xA, 0x0, 0x8, 0x7, 0x6, 0x1, 0x0, 0x1, 0x1, 0x0, 0x1, 0xE, 0x7, 0x0,
+    0x4, 0x0, 0x9, 0x2, 0x3, 0x4, 0x4, 0x8, 0x6, 0x1, 0x9, 0x2, 0x1, 0x6, 0x7, 0x0,
+    0xB, 0x0, 0xB, 0x4, 0x4, 0x0, 0x3, 0x0, 0x3, 0x4, 0x2, 0x11, 0x5, 0x0, 0x2, 0x0,
+    0x6, 0x0, 0x0, 0x10, 0xC, 0x5, 0x0, 0x0, 0x0, 0x1, 0x0, 0x3, 0x3, 0x3, 0xA, 0x0,
+    0x0, 0x5, 0x9, 0x6, 0x2, 0xA, 0xE, 0x0, 0xC, 0x5, 0x0, 0x0, 0x29, 0x0, 0x2, 0x0,
+    0x2A, 0xF, 0xB, 0x2, 0x0, 0x0, 0x0, 0x2, 0x0, 0x16, 0x3, 0x5, 0x2, 0xE, 0x0, 0x13,
+    0x4, 0x14, 0x0, 0x3, 0x7, 0x23, 0x5, 0xC, 0x3, 0x0, 0x0, 0x0, 0x5, 0x0, 0x0, 0x0,
+    0x2, 0x1, 0x15, 0x1, 0x5, 0x17, 0x0, 0x12, 0x1, 0x0, 0xA, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2C, 0x6, 0x4, 0x5, 0x11, 0x8, 0xF, 0x2, 0x11, 0x3, 0x12, 0x0, 0xE, 0x3, 0x3, 0x2A,
+    0x0, 0x3, 0x3, 0x0, 0x5, 0x0, 0x9, 0x1, 0x0, 0x2, 0x1, 0x0, 0x1, 0x0, 0x4, 0x3,
+    0x1, 0x0, 0x7, 0x0, 0x2, 0x7, 0x0, 0x0, 0x5, 0x4, 0x15, 0x1, 0x1, 0x4, 0x6, 0x3,
+    0x0, 0xD, 0x1, 0xB, 0x0, 0x4, 0x13, 0x11, 0x11, 0xC, 0x0, 0x1, 0x0, 0x4, 0x12, 0x2,
+    0x0, 0x3, 0x2, 0x11, 0x1, 0x6, 0x5, 0x2, 0x0, 0x5, 0x0, 0x6, 0x1, 0x4, 0x4, 0x3,
+    0x0, 0xA, 0x1, 0x4, 0x0, 0x0, 0xC, 0x0, 0x0, 0x3, 0x1, 0x6, 0x7, 0x5, 0xC, 0x0,
+    0x0, 0x8, 0x2, 0x0, 0x9, 0x10, 0x19, 0x6, 0x0, 0x0, 0x0, 0x14, 0x1, 0x4, 0x2, 0x1,
+    0x2, 0x5, 0x7, 0x0, 0x1, 0x1, 0x1, 0x0, 0x8, 0x0, 0x25, 0xA, 0x0, 0x2, 0x0, 0x1,
+    0x2, 0xA, 0x27, 0xC, 0x1, 0xE, 0x2, 0x0, 0x1, 0x0, 0x6, 0x0, 0x9, 0x2, 0x2, 0x0,
+    0x10, 0x3, 0xE, 0x5, 0xC, 0x0, 0x2, 0x3, 0x4, 0x1, 0x2, 0x2, 0x0, 0x3, 0x1, 0x4,
+    0x2E, 0x4, 0x8, 0x6, 0x9, 0x19, 0x0, 0xE, 0x2, 0xE, 0x2A, 0x5, 0x2, 0x8, 0x0, 0x8,
+    0x0, 0x12, 0x5, 0x1, 0x0, 0xE, 0x0, 0x0, 0xA, 0x4, 0x3, 0x2, 0x3, 0x5, 0x1, 0xD,
+    0x4, 0xF, 0x4, 0x2, 0x1, 0x20, 0x5, 0x0, 0x0, 0x0, 0x0, 0x1, 0x4, 0x2, 0x5, 0x3,
+    0x4, 0x9, 0x0, 0x3, 0x1, 0x2A, 0x0, 0x2, 0x1, 0x4, 0x0, 0x1, 0x4, 0xA, 0x0, 0x0,
+    0x2, 0x5, 0xF, 0x0, 0x4, 0x0, 0x2, 0x11, 0x0, 0x17, 0x4, 0x1, 0x7, 0xA, 0x1, 0x5,
+    0x4, 0x7, 0x4, 0xF, 0x6, 0x2, 0x1, 0x1, 0x0, 0x1, 0x0, 0x0, 0x0, 0x0, 0x1, 0xC,
+    0xB, 0x2, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x4, 0x1, 0x6, 0x0, 0x0, 0x21, 0x5, 0x0,
+    0x3, 0x2, 0x5, 0x1, 0x0, 0x2, 0x11, 0x2, 0x3, 0x4, 0x4, 0x8, 0x2, 0xE, 0x0, 0x2,
+    0xC, 0x0, 0x0, 0x12, 0x0, 0x0, 0x6, 0x5, 0x3, 0x5, 0x3, 0x0, 0xA, 0x0, 0x2, 0x0,
+    0x0, 0xA, 0xA, 0x6, 0x0, 0x5, 0x2, 0x4, 0x6, 0x8, 0x5, 0x7, 0x1, 0x0, 0x1, 0x11,
+    0x1, 0xA, 0x0, 0x17, 0x3, 0x24, 0x16, 0x4, 0x0, 0x2, 0x0, 0x0, 0x4, 0x3, 0x1, 0x2,
+    0x5, 0x0, 0x4, 0x4, 0x0, 0x1, 0x0, 0x8, 0x0, 0x4, 0x12, 0x0, 0x0, 0x7, 0x5, 0x0,
+    0x5, 0xA, 0x1C, 0x8, 0x0, 0x23, 0x7, 0x5, 0x8, 0x0, 0x7, 0x13, 0x9, 0x23, 0x1D, 0x6,
+    0x1, 0x0, 0x0, 0x4, 0x3, 0xE, 0x0, 0x0, 0x5, 0x2, 0x0, 0x2, 0x3, 0x28, 0x1, 0x6,
+    0x1, 0x2, 0x0, 0xB, 0x0, 0x2, 0x7, 0x29, 0x9, 0x7, 0x6, 0x20, 0x0, 0x14, 0x0, 0x0,
+    0x7, 0x1, 0x4, 0x14, 0x9, 0x29, 0x3, 0x7, 0x1, 0x8, 0x1A, 0x0, 0x6, 0x0, 0x11, 0x3,
+    0xF, 0x0, 0x5, 0x1, 0x7, 0x8, 0x1, 0x0, 0x5, 0x1, 0x3, 0x6, 0x3, 0x4, 0x1, 0x0,
+    0x2, 0xB, 0x7, 0x0, 0x0, 0x4, 0x9, 0x0, 0x1, 0x0, 0x2, 0x1, 0x2, 0x0, 0x0, 0x2,
+    0x8, 0x1, 0x0, 0x9, 0x6, 0x16, 0x2, 0x1, 0xC, 0x12, 0x5, 0x0, 0x1, 0x4, 0x5, 0x0,
+    0x1A, 0xA, 0x1, 0x1, 0x0, 0x6, 0x0, 0x1, 0xA, 0xB, 0x6, 0x15, 0xF, 0xE, 0x1, 0x0,
+    0x0, 0x0, 0xD, 0x0, 0x22, 0x2, 0x7, 0x1, 0x1, 0x0, 0xB, 0x20, 0x10, 0x1, 0x0, 0x3,
+    0x4, 0x0, 0x1, 0x1, 0x6, 0x15, 0x1, 0xF, 0x6, 0x2, 0x2, 0x4, 0x3, 0x1, 0x14, 0x9,
+    0x15, 0x7, 0x0, 0x3, 0x3, 0x0, 0x6, 0x0, 0x4, 0x6, 0x4, 0xE, 0x3, 0x1, 0x4, 0xE,
+    0x3, 0x4, 0x11, 0x1, 0x4, 0x4, 0x3, 0x0, 0x0, 0x5, 0x4, 0x8, 0x6, 0x0, 0x7, 0xB,
+    0xA, 0x0, 0x3, 0x1, 0x45, 0x0, 0x4, 0x0, 0x2, 0x0, 0x14, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0x5, 0x2, 0x0, 0x8, 0x7, 0x0, 0x2, 0x4, 0x0, 0x1, 0x1E, 0x8, 0x4, 0x7, 0x0, 0x1,
+    0x1, 0x0, 0x0, 0x3, 0x2, 0x0, 0x1, 0x4, 0x4, 0x0, 0x2, 0x2, 0x0, 0xE, 0x4, 0x0,
+    0x9, 0x1, 0x6, 0x2, 0x0, 0x3, 0x0, 0x0, 0xB, 0xF, 0x1, 0x6, 0x4, 0x7, 0x2, 0x5,
+    0x8, 0x1, 0x6, 0x0, 0x0, 0x0, 0x1C, 0x20, 0x4, 0x6, 0x0, 0x1, 0x1, 0x10, 0x4, 0x9,
+    0x5, 0x31, 0x0, 0x0, 0x0, 0x11, 0x0, 0x19, 0xC, 0x0, 0x0, 0x0, 0xC, 0x1, 0x4, 0x2,
+    0x5, 0x3, 0x1, 0x1A, 0x14, 0x1, 0x1, 0x0, 0x2, 0x1, 0x1, 0x9, 0x0, 0x0, 0x26, 0x1,
+    0x33, 0xC, 0x0, 0x6, 0x0, 0x1C, 0x1, 0x11, 0x3, 0x0, 0x33, 0x39, 0xF, 0x5, 0x6, 0x0,
+    0x10, 0x2, 0x0, 0x4, 0x5, 0x2, 0x0, 0x1, 0x0, 0x2, 0x1, 0x4, 0x1, 0x1, 0x0, 0x3,
+    0x3, 0x1C, 0x1, 0x0, 0x0, 0x7, 0x1, 0x2, 0x7, 0x4, 0x0, 0x8, 0x14, 0x20, 0x0, 0x0,
+    0x0, 0x1F, 0xF, 0x0, 0x3, 0x0, 0xA, 0x2, 0x1A, 0x8, 0x1, 0x1, 0x0, 0x0, 0xB, 0x11,
+    0xC, 0x0, 0x6, 0x6, 0x1, 0x3, 0xC, 0x2, 0xE, 0x3, 0x2, 0x8, 0x0, 0x0, 0x1, 0x5,
+    0x4, 0x4, 0xA, 0xC, 0x6, 0x1, 0x0, 0x1, 0x9, 0x1, 0x0, 0x0, 0x1, 0x5, 0x3, 0x0,
+    0x4, 0x19, 0x19, 0x2, 0x9, 0x2, 0x8, 0x0, 0x4, 0x1, 0x0, 0x1, 0x0, 0x0, 0x2C, 0x2,
+    0x5, 0x3, 0x0, 0x4, 0x6, 0x6, 0x0, 0xC, 0x16, 0x3, 0x6, 0x14, 0x1, 0x3, 0xE, 0x7,
+    0x1, 0x7, 0x1, 0x4, 0x0, 0x2, 0x8, 0x1, 0x1, 0x4, 0x2, 0x1B, 0x1, 0x2, 0x7, 0xA,
+    0x4, 0x1, 0x0, 0x1, 0x5, 0xD, 0x0, 0xA, 0x0, 0x7, 0x0, 0x1, 0x4, 0xB, 0x9, 0x3,
+    0x0, 0x0, 0xA, 0x0, 0x1, 0x6, 0x6, 0x0, 0x0, 0x0, 0x15, 0x1, 0x2, 0x0, 0x9, 0x3,
+    0x1, 0x0, 0x0, 0x0, 0x3, 0x0, 0xE, 0x0, 0x0, 0x0, 0x0, 0x1, 0x27, 0x0, 0x9, 0x13,
+    0x6, 0x0, 0x2, 0x0, 0x8, 0x0, 0x0, 0x0, 0x3, 0x0, 0x0, 0x6, 0x1C, 0x26, 0x0, 0x4,
+    0x0, 0xA, 0x0, 0x1, 0x0, 0x4, 0x7, 0x0, 0x3, 0x2, 0x0, 0x3, 0x0, 0x0, 0x1, 0x2,
+    0x0, 0x1, 0x2B, 0x6, 0x0, 0x1, 0x0, 0x0, 0x10, 0x4, 0x5, 0x3, 0x0, 0x8, 0x29, 0xB,
+    0x0, 0x0, 0x29, 0x8, 0x1, 0x8, 0xC, 0x1, 0x0, 0x68, 0x0, 0x7, 0x0, 0x0, 0x2D, 0x14,
+    0x5, 0x17, 0x3, 0xE, 0x0, 0x3, 0x16, 0x4, 0xF, 0x0, 0x14, 0x4, 0x2, 0xD, 0xA, 0x0,
+    0x8, 0x4, 0x0, 0x4, 0x0, 0x4, 0x4, 0x6, 0x0, 0x0, 0x2, 0x1, 0x28, 0x0, 0x1, 0xD,
+    0x0, 0x1, 0x1, 0x0, 0xC, 0x4, 0x11, 0x5, 0x7, 0x0, 0x25, 0x0, 0x3, 0xC, 0x25, 0x6,
+    0x0, 0x1, 0x1, 0xA, 0x3, 0x5, 0x3, 0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0,
+    0x1, 0x10, 0x3, 0x4, 0x4, 0x4, 0x4, 0x0, 0xC, 0x2, 0x9, 0x5, 0x0, 0x0, 0x5, 0x1,
+    0x0, 0x0, 0x4, 0x8, 0x12, 0x0, 0xB, 0x2, 0x5, 0x0, 0x4, 0x0, 0x3, 0x6, 0x0, 0x0,
+    0x0, 0x1, 0xF, 0x4, 0x0, 0xA, 0x2F, 0x2, 0x5, 0xA, 0x4, 0x0, 0x2, 0x4, 0x1C, 0x1,
+};
+
+const unsigned int agariSlots[1 << AGARI_SLOT_BITS] = {
+    0x0, 0x34A0049, 0x3604240, 0xFFFFFFFF, 0xFFFFFFFF, 0x12D9243, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3891400, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x13006C9, 0xC0610, 0xFFFFFFFF, 0xFFFFFFFF, 0x24C250, 0x309240, 0x130010B, 0xD06C3, 0xFFFFFFFF, 0x2E1243, 0x264640, 0xFFFFFFFF,
+    0x6C9298, 0xDB002, 0x3610603, 0xFFFFFFFF, 0xFFFFFFFF, 0x3086C9, 0xFFFFFFFF, 0x230C240, 0x400320, 0x24B112, 0x2049018, 0x350C,
+    0x1889013, 0xDA489, 0x63000, 0x2E0109, 0x4C921B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3461000, 0xFFFFFFFF, 0x13000,
+    0xFFFFFFFF, 0x24E1000, 0xFFFFFFFF, 0x10C240, 0x1242480, 0xA708, 0x448A248, 0x4C0D8, 0x1090CC, 0x89909, 0x1259292, 0x21518,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3649002, 0x1850, 0xFFFFFFFF, 0xFFFFFFFF, 0x3089508, 0x24A480, 0x1858600, 0x10323, 0x1C803,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x328C000, 0x60A4D8, 0xFFFFFFFF, 0x1C249, 0x49400, 0x12A3440, 0x3018260, 0x30C3602, 0x32D2, 0xFFFFFFFF,
+    0x20016D3, 0x2CB6C0, 0x36CB200, 0x1719, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4D90C2, 0x6D1289, 0xC2308,
+    0xFFFFFFFF, 0x681843, 0x12D2083, 0xFFFFFFFF, 0xFFFFFFFF, 0x324064C, 0xFFFFFFFF, 0x388A240, 0x30CA243, 0x6C0098, 0xFFFFFFFF, 0x32532C0,
+    0x4A309, 0xFFFFFFFF, 0x60150B, 0xC518, 0xC9508, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30CC280, 0x4299049, 0x1309000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x24C842, 0x309840, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C8258, 0xFFFFFFFF, 0x30112D2, 0x9B213, 0x16A1049, 0xC0098, 0xDB600,
+    0x4024CC, 0x2481658, 0x449618, 0xFFFFFFFF, 0xC2692, 0x5A2A1, 0x61000, 0x69224A, 0x308708, 0x18318, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x20C3092, 0x6124C9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x10A242, 0xFFFFFFFF, 0xFFFFFFFF, 0x4488248, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2DA418, 0x12414A0, 0x891610, 0xC92DA, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1249218, 0xFFFFFFFF, 0x649449, 0x3609210, 0xFFFFFFFF,
+    0x603318, 0x621448, 0x3490248, 0x3240308, 0xFFFFFFFF, 0x59600, 0x2480418, 0xFFFFFFFF, 0xFFFFFFFF, 0x2A2243, 0xFFFFFFFF, 0x1498003,
+    0x4D24C0, 0x12496C3, 0xFFFFFFFF, 0x128B092, 0x1652403, 0xFFFFFFFF, 0x249824A, 0xFFFFFFFF, 0x180E4, 0xFFFFFFFF, 0x4902000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xCB203, 0x652688, 0x4992D0, 0x30192C3, 0x1240248, 0x2860018, 0x4488003, 0x3600248, 0x2291490, 0x424448,
+    0x248C210, 0xFFFFFFFF, 0xFFFFFFFF, 0x1640692, 0x20C3308, 0xFFFFFFFF, 0xFFFFFFFF, 0x125C218, 0x50B480, 0x8D1218, 0xFFFFFFFF, 0x6046C8,
+    0x621213, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1840018, 0x60C440, 0x80, 0x2912000, 0x226001B, 0xFFFFFFFF, 0xFFFFFFFF, 0x260083,
+    0xFFFFFFFF, 0x3052283, 0xFFFFFFFF, 0x424C200, 0xFFFFFFFF, 0x3082A1, 0x22480D8, 0x2A1490, 0xFFFFFFFF, 0x15112C0, 0x18404C0, 0x522,
+    0x30E4, 0xFFFFFFFF, 0xFFFFFFFF, 0x61603, 0x30C0291, 0xFFFFFFFF, 0x9883, 0x3249310, 0x4B24B, 0x30042C0, 0x424218, 0x30DB240,
+    0xA8A1, 0xFFFFFFFF, 0xFFFFFFFF, 0x148B24A, 0xFFFFFFFF, 0x619261, 0x3062218, 0x3243018, 0x3300003, 0x14880C9, 0x4C92C0, 0x4640061,
+    0x13642, 0xFFFFFFFF, 0x361A440, 0x852840, 0x60C213, 0xFFFFFFFF, 0xFFFFFFFF, 0x1640908, 0x62508, 0x425A049, 0x1242503, 0x624600,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x46C8000, 0x6CB249, 0xC0464, 0x1289092, 0xFFFFFFFF, 0x2483013, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x30004A0, 0x30C1643, 0x125301B, 0x1B2A1, 0xC9203, 0x20180C3, 0x4250618, 0x908403, 0x30DB010, 0x291092,
+    0xCB800, 0x711249, 0x300924C, 0x603243, 0xFFFFFFFF, 0x4488610, 0x3908000, 0x34C9800, 0x300B849, 0x2542C0, 0x6C1258, 0xCC260,
+    0x12922D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x92610, 0xFFFFFFFF, 0xFFFFFFFF, 0x15080C0, 0x20218C0, 0x2DB240, 0x60A442, 0x12580C0, 0x1319250,
+    0x2000618, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3490059, 0x29A2D0, 0xFFFFFFFF, 0x1840063, 0x2481842, 0x4289018, 0xC1258, 0x5100C3,
+    0x18C0848, 0x68B680, 0x2600C3, 0x3661240, 0x42A1400, 0x3900600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3098C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3611243, 0x24C310, 0x124061A, 0x6C0003, 0xFFFFFFFF, 0xFFFFFFFF, 0x4692200, 0x2480109, 0x124005C, 0x61B400, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x28C9248, 0x122200, 0x10061, 0x23292, 0xFFFFFFFF, 0x2021690, 0x24861B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x200C8C0,
+    0x4258049, 0x112603, 0x3003, 0x1304250, 0xFFFFFFFF, 0x4A1300, 0xFFFFFFFF, 0x26044C, 0x98000, 0x130C3, 0x3112200, 0xFFFFFFFF,
+    0x30106C0, 0x46C8600, 0x8910C2, 0xFFFFFFFF, 0x230804C, 0x300264C, 0x24B0C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x3400493, 0x34C0049, 0xFFFFFFFF,
+    0x2652203, 0x36490C0, 0x44D3, 0xC9802, 0xFFFFFFFF, 0x20C2483, 0x2518049, 0xFFFFFFFF, 0xC24C, 0xFFFFFFFF, 0xFFFFFFFF, 0x3009848,
+    0x692098, 0x204C01B, 0xFFFFFFFF, 0x3680600, 0xFFFFFFFF, 0x63458, 0x123003, 0x452203, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x26D8600,
+    0x30CB448, 0x30490C0, 0x4488098, 0xD3003, 0x52261, 0x14A02C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x1302482, 0x662203, 0x2C804C, 0x24B44C,
+    0xFFFFFFFF, 0x1258109, 0xFFFFFFFF, 0x128C01A, 0xFFFFFFFF, 0xFFFFFFFF, 0x4D8600, 0x3709002, 0xC1850, 0x664240, 0xFFFFFFFF, 0x8249B,
+    0x16E3, 0xFFFFFFFF, 0xFFFFFFFF, 0x6610C9, 0xFFFFFFFF, 0x2481289, 0x1249511, 0x13090C3, 0x128C4C0, 0x1640600, 0x109400, 0xFFFFFFFF,
+    0x44A258, 0x3400709, 0xFFFFFFFF, 0x49291, 0x3002308, 0x2480708, 0x304944C, 0xFFFFFFFF, 0xFFFFFFFF, 0x61680, 0x1489289, 0x3021448,
+    0xFFFFFFFF, 0x305C0C0, 0x65A258, 0x4240258, 0x14A0098, 0x204C291, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4258648, 0x24865C, 0xFFFFFFFF,
+    0x892250, 0x3243092, 0x49128B, 0xFFFFFFFF, 0xFFFFFFFF, 0x492, 0x136C0, 0xFFFFFFFF, 0x664010, 0x300064B, 0xFFFFFFFF, 0x364A240,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x4008DA, 0xFFFFFFFF, 0x301A01B, 0x12492C3, 0x224B092, 0xFFFFFFFF, 0x4961A, 0x20C0493, 0x816D3, 0xFFFFFFFF,
+    0x6D3600, 0x1289112, 0xFFFFFFFF, 0xFFFFFFFF, 0x600263, 0xFFFFFFFF, 0xFFFFFFFF, 0x659000, 0x4900080, 0x683603, 0x610308, 0xFFFFFFFF,
+    0x294289, 0xD8318, 0xFFFFFFFF, 0x12C064C, 0x190A240, 0x452803, 0xFFFFFFFF, 0x4C0C3, 0x42500D8, 0x12D32C0, 0xFFFFFFFF, 0x30496C0,
+    0x1891218, 0x52860, 0x300B8C0, 0xFFFFFFFF, 0x318092, 0x13493, 0xFFFFFFFF, 0x522A2, 0x3013649, 0xFFFFFFFF, 0x168C003, 0x1864C,
+    0xFFFFFFFF, 0x4904D8, 0x2DB2C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x2249889, 0x2880248, 0xFFFFFFFF, 0x1843258, 0x814A3, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x5C061, 0x694000, 0x1250860, 0xFFFFFFFF, 0x13096C0, 0x20026E0, 0x3004498, 0x252688, 0xFFFFFFFF, 0x94A4, 0xFFFFFFFF,
+    0x49893, 0x848683, 0x14A1200, 0x30C9202, 0xA4C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x63260, 0x603092, 0x124325B, 0x14E1049, 0x42C0018,
+    0xFFFFFFFF, 0x616C2, 0xFFFFFFFF, 0xC500, 0xFFFFFFFF, 0xFFFFFFFF, 0x36000D3, 0xFFFFFFFF, 0x60A858, 0x3492003, 0x1302291, 0xFFFFFFFF,
+    0x361B080, 0x24B25B, 0x124A45A, 0x2064, 0xFFFFFFFF, 0x3248858, 0x20C0018, 0x42580C9, 0x30A848, 0x28512C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x300324A, 0x4C3649, 0x30A291, 0x6C92C9, 0xFFFFFFFF, 0x7080D8, 0x30000C9, 0x25245A, 0x2512, 0xFFFFFFFF, 0x128C2C8, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1242003, 0x19004C0, 0xC30E1, 0x3421200, 0xFFFFFFFF, 0xFFFFFFFF, 0x121600, 0x311490, 0x1300018, 0xCC440, 0xFFFFFFFF,
+    0x36C0010, 0xFFFFFFFF, 0x125B418, 0xFFFFFFFF, 0x65B640, 0xFFFFFFFF, 0x36D00C0, 0x6180D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x491658, 0x3303018,
+    0xFFFFFFFF, 0x3648018, 0x341B, 0xFFFFFFFF, 0x66024B, 0x2022500, 0x2480403, 0x30D2200, 0x4649800, 0xFFFFFFFF, 0x324C200, 0x300301B,
+    0xFFFFFFFF, 0x12C0, 0xFFFFFFFF, 0x368A440, 0x12A2448, 0xFFFFFFFF, 0x301884A, 0x30B080, 0x180C0, 0x16D0013, 0x711200, 0x20C0291,
+    0xFFFFFFFF, 0x89A280, 0x2254203, 0x30800C0, 0xFFFFFFFF, 0x18442C0, 0x89261, 0x45B4C0, 0x3401300, 0xFFFFFFFF, 0xFFFFFFFF, 0x20D80C3,
+    0x618461, 0x205B4C0, 0x3061418, 0x65B410, 0xFFFFFFFF, 0x300C259, 0x30C924B, 0xA502, 0x2909240, 0x49311, 0x148C480, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3490002, 0x3109080, 0xFFFFFFFF, 0x4259240, 0x4300449, 0xFFFFFFFF, 0x22DA049, 0xFFFFFFFF, 0x2CB01B, 0xFFFFFFFF, 0x260061,
+    0x30884A, 0x10124, 0x13180C2, 0xFFFFFFFF, 0x3289248, 0xFFFFFFFF, 0x124A499, 0xC3240, 0xFFFFFFFF, 0x84801A, 0x248121, 0xFFFFFFFF,
+    0x320680, 0xFFFFFFFF, 0x2009800, 0xFFFFFFFF, 0xFFFFFFFF, 0x260510, 0x3200C2, 0xC26C0, 0x449B000, 0x2291248, 0x424203, 0x1242603,
+    0xA88C, 0x28830C0, 0x4C25B, 0x20C30C3, 0x909640, 0x1242049, 0x6C3013, 0xC4700, 0xFFFFFFFF, 0x300A48B, 0x6018C3, 0xFFFFFFFF,
+    0x130005C, 0x26012A1, 0x129924B, 0x24A603, 0x329A210, 0xFFFFFFFF, 0x14648, 0xFFFFFFFF, 0x2891018, 0x24A04C, 0x124924C, 0xFFFFFFFF,
+    0x224B000, 0x4850049, 0x26C8610, 0x44C90C0, 0x124B849, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2483002, 0x2E0, 0x8930C0,
+    0x1899018, 0x32480A2, 0xFFFFFFFF, 0x30C004C, 0x1303, 0x3402483, 0x3858049, 0x4B003, 0x4250603, 0xFFFFFFFF, 0x30B0C2, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x148B002, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4488602, 0x4A48B, 0xFFFFFFFF, 0x1241843, 0x6C1243, 0xFFFFFFFF,
+    0x24D90C0, 0x1299018, 0xFFFFFFFF, 0x3022648, 0x14418, 0xFFFFFFFF, 0xFFFFFFFF, 0x200A4D2, 0x10C083, 0xFFFFFFFF, 0x125C249, 0x649243,
+    0x660603, 0xFFFFFFFF, 0xFFFFFFFF, 0x60B448, 0x6C0109, 0x31090C2, 0xFFFFFFFF, 0x2CB618, 0x698109, 0x4258, 0x30E10C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x80894, 0x2498602, 0x1263448, 0xC2260, 0x3083600, 0x26490C3, 0x3018659, 0xFFFFFFFF, 0x6D2203, 0x651460,
+    0x3083049, 0xFFFFFFFF, 0x301809B, 0x986C3, 0xFFFFFFFF, 0x1292649, 0x2009849, 0x424800, 0x11A488, 0xFFFFFFFF, 0xC9462, 0x18A1002,
+    0xFFFFFFFF, 0x20C36C0, 0x602482, 0x4490C0, 0x50A258, 0x496E1, 0xFFFFFFFF, 0x6008E0, 0x8C690, 0x44B6C8, 0x18890C2, 0x4A703,
+    0x2DC018, 0x601900, 0xFFFFFFFF, 0xFFFFFFFF, 0xD0661, 0xFFFFFFFF, 0xFFFFFFFF, 0x4300248, 0x1689618, 0xFFFFFFFF, 0x648490, 0x3601508,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x8910C0, 0xFFFFFFFF, 0x324A24B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x8D9, 0x1928C, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x251849, 0x32A4000, 0xB218, 0x1B889, 0xFFFFFFFF, 0x590C0, 0xFFFFFFFF, 0x168C0C0, 0x44C000, 0xC24D9, 0x4B04C, 0x148B602,
+    0x692083, 0xFFFFFFFF, 0xFFFFFFFF, 0x260064C, 0xFFFFFFFF, 0x109061, 0x30C20D8, 0xFFFFFFFF, 0x6C0262, 0xFFFFFFFF, 0xE1061, 0x409508,
+    0x25B049, 0xFFFFFFFF, 0xFFFFFFFF, 0xCC291, 0xFFFFFFFF, 0x683490, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x62302,
+    0xFFFFFFFF, 0x6C0708, 0xFFFFFFFF, 0xD2460, 0xFFFFFFFF, 0x184064B, 0x60B491, 0x4289602, 0x3054448, 0xFFFFFFFF, 0xFFFFFFFF, 0x248025B,
+    0x30C041B, 0x16A2240, 0xFFFFFFFF, 0xFFFFFFFF, 0x3001888, 0xFFFFFFFF, 0xFFFFFFFF, 0x184DB, 0x519448, 0xFFFFFFFF, 0x20C0692, 0x3018698,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4A85A, 0x30038C8, 0x82910, 0xFFFFFFFF, 0x3848248, 0xFFFFFFFF, 0x200C448, 0xFFFFFFFF, 0x8A688,
+    0xFFFFFFFF, 0x3409491, 0xC94A1, 0xFFFFFFFF, 0x683260, 0x122240, 0x449109, 0xFFFFFFFF, 0x1643092, 0x4C2E0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3490418, 0x24C92C8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12446C8, 0x13000C9, 0xFFFFFFFF, 0x1649261, 0x3094600, 0xFFFFFFFF, 0x6096C0,
+    0xFFFFFFFF, 0x6E3200, 0x4241700, 0x5B818, 0x1858248, 0x922E0, 0x14D12C8, 0xFFFFFFFF, 0x4858400, 0xFFFFFFFF, 0xFFFFFFFF, 0xB818,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x4904B, 0xFFFFFFFF, 0x30C3248, 0xFFFFFFFF, 0xFFFFFFFF, 0x1292458, 0xFFFFFFFF, 0x14980D8, 0x3021203, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x4240013, 0x109660, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xE4210, 0x4258400, 0x6006DA, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x448B240, 0xFFFFFFFF, 0x5284B, 0x601703, 0x61A0C3, 0xFFFFFFFF, 0x340C2C0, 0xFFFFFFFF, 0x425A440, 0xFFFFFFFF, 0x284B, 0xFFFFFFFF,
+    0x260A443, 0x3601300, 0xFFFFFFFF, 0x261242, 0x364B018, 0x1C21B, 0x1289490, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x946C0, 0xC02A1,
+    0xFFFFFFFF, 0x5C049, 0x20C1258, 0x600018, 0x121, 0x294602, 0xD8691, 0x309B018, 0x860010, 0x60261B, 0x449263, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x84B243, 0x12D2059, 0xFFFFFFFF, 0x313249, 0xC3303, 0xFFFFFFFF, 0x6324B, 0x6004C0, 0x2061649, 0xFFFFFFFF, 0x42C0003,
+    0x4243403, 0xFFFFFFFF, 0x6014E1, 0xFFFFFFFF, 0x4520000, 0xFFFFFFFF, 0x3604250, 0xFFFFFFFF, 0x14A00C2, 0x92449, 0x3052210, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3449308, 0xFFFFFFFF, 0x124A443, 0x3400618, 0x24D4200, 0x3092049, 0x12C1300, 0x30925A, 0x4658, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2320003, 0x170A440, 0x61301B, 0x321640, 0xFFFFFFFF, 0xFFFFFFFF, 0x7080C3, 0xFFFFFFFF, 0x249B010, 0x1C48A, 0x291258, 0x49648,
+    0xFFFFFFFF, 0x2E06C0, 0x309700, 0xFFFFFFFF, 0x1312218, 0xFFFFFFFF, 0x63018, 0x24830C9, 0xB292, 0x1300002, 0xDB4C0, 0x4240610,
+    0x20C9249, 0x602883, 0xFFFFFFFF, 0x290B000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x450B000, 0x1302049, 0xFFFFFFFF, 0x491640,
+    0x12C4258, 0xFFFFFFFF, 0x848, 0xFFFFFFFF, 0x1641300, 0x3892200, 0xFFFFFFFF, 0x124C802, 0x3491240, 0x1309802, 0x2001243, 0x3003000,
+    0x1498000, 0xFFFFFFFF, 0x1309249, 0xFFFFFFFF, 0x3263000, 0x2CC258, 0xFFFFFFFF, 0x262880, 0x22482DA, 0x649300, 0x49418, 0x3002482,
+    0x30C3610, 0x428C240, 0xC18C0, 0x200010C, 0xFFFFFFFF, 0xFFFFFFFF, 0x60005C, 0x3049013, 0xC1302, 0x48402C8, 0xFFFFFFFF, 0x3001909,
+    0x14A1800, 0x1258613, 0x2914C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x14A1242, 0x3291680, 0x38C8049, 0xFFFFFFFF, 0x42C0603, 0x84810B, 0x229A203,
+    0x258891, 0x2064248, 0x3063440, 0x4A321, 0xFFFFFFFF, 0x2582DA, 0x59, 0x14D3000, 0x24D2202, 0xFFFFFFFF, 0xFFFFFFFF, 0x24B840,
+    0x1242709, 0x1B000, 0xFFFFFFFF, 0x709240, 0x2486C9, 0x81858, 0xFFFFFFFF, 0x19463, 0x6490D0, 0xFFFFFFFF, 0x1840492, 0x3649289,
+    0x4DB000, 0xFFFFFFFF, 0x6614C0, 0xFFFFFFFF, 0x18D8049, 0xFFFFFFFF, 0x311018, 0x291858, 0x3119018, 0x1652648, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1888049, 0x4C248, 0x2D4249, 0xFFFFFFFF, 0x84300, 0x304984A, 0x24249, 0x490CC, 0xFFFFFFFF, 0x2544C8, 0x1240493,
+    0x3848098, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1253109, 0x6C2480, 0xD004C, 0x3303600, 0xFFFFFFFF, 0x69A480, 0x9225B,
+    0xFFFFFFFF, 0x3243490, 0x709000, 0x2E0600, 0xFFFFFFFF, 0x30804C, 0xFFFFFFFF, 0xFFFFFFFF, 0x36192C0, 0x3003602, 0xFFFFFFFF, 0x30A649,
+    0x1309848, 0xFFFFFFFF, 0x403891, 0x1841289, 0x1858648, 0x6C90C3, 0x649900, 0xFFFFFFFF, 0x2291003, 0xFFFFFFFF, 0x61128C, 0xFFFFFFFF,
+    0x305A243, 0x128C0C9, 0x4A0600, 0x264A300, 0x8984C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x61858, 0x1190C3, 0x99900, 0xC688,
+    0x484B200, 0x1299003, 0x12C3600, 0xFFFFFFFF, 0x1250308, 0x11840, 0xFFFFFFFF, 0xFFFFFFFF, 0x1700260, 0x20492DA, 0x1258092, 0xFFFFFFFF,
+    0xD241A, 0xFFFFFFFF, 0x248260, 0x1240708, 0x14D3600, 0x131A248, 0x16D9280, 0xFFFFFFFF, 0xFFFFFFFF, 0x911049, 0x125A0D8, 0xFFFFFFFF,
+    0x324944B, 0x709840, 0xFFFFFFFF, 0x4D9000, 0x3052298, 0x6496D0, 0x490318, 0x20C0649, 0x36C9049, 0x1252803, 0x32C8092, 0x651448,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x254603, 0x4DB049, 0x1A4CB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C1888, 0x1254840, 0xFFFFFFFF, 0xC944B,
+    0x4A2410, 0x61059, 0x908648, 0xA144B, 0x50A240, 0x496CC, 0x2500308, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x600318, 0x25C840, 0x890649, 0xFFFFFFFF, 0x492248, 0x1491448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x5348B,
+    0x4124C3, 0x3289600, 0x30D0248, 0x1263200, 0x1289660, 0x360A840, 0x2484DB, 0xFFFFFFFF, 0x1900418, 0xFFFFFFFF, 0x4842000, 0x16E0248,
+    0x1841888, 0xFFFFFFFF, 0x448B, 0x6CC280, 0x1899049, 0x2018692, 0xFFFFFFFF, 0x260308, 0x9661, 0xC921A, 0xFFFFFFFF, 0x20180D8,
+    0x908418, 0xFFFFFFFF, 0xA688, 0x1C2D8, 0x49492, 0xFFFFFFFF, 0x1196C0, 0x1240862, 0x8A1049, 0x3680018, 0xFFFFFFFF, 0x3619200,
+    0x6000DB, 0x12402A4, 0x10860, 0xFFFFFFFF, 0x424301A, 0xFFFFFFFF, 0x4300013, 0x4D2400, 0x6D8080, 0x3851202, 0xFFFFFFFF, 0x3009709,
+    0x60A45A, 0xFFFFFFFF, 0x2248248, 0x2A1603, 0xFFFFFFFF, 0xFFFFFFFF, 0x1243308, 0x125A6C0, 0xC024A, 0xFFFFFFFF, 0x3093240, 0x251603,
+    0x4D9600, 0x6C9490, 0x340125B, 0xFFFFFFFF, 0x3000294, 0x3010908, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4841250, 0xFFFFFFFF, 0x12D2002,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xC4888, 0x34C0291, 0x2021203, 0x8131B, 0x314210, 0x3400121, 0xC42C0, 0x4A289, 0x4092C0, 0x601488,
+    0x125A000, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C889, 0x20CA440, 0x252509, 0x931C, 0xFFFFFFFF, 0x648018, 0x49708, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x30498C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x1511200, 0x1840403, 0x60B249, 0x1261203, 0xC0018, 0xFFFFFFFF, 0xFFFFFFFF, 0x85801B, 0xFFFFFFFF,
+    0x1263800, 0xC2618, 0x4840002, 0x3001643, 0xFFFFFFFF, 0xFFFFFFFF, 0x130A440, 0xFFFFFFFF, 0x4689248, 0x3002661, 0xFFFFFFFF, 0x90B,
+    0xB803, 0xFFFFFFFF, 0xFFFFFFFF, 0x3003680, 0x20D8848, 0xFFFFFFFF, 0x1A2DA, 0xC9818, 0x200C200, 0x3000509, 0x601258, 0x312442,
+    0x384A600, 0x2003908, 0xFFFFFFFF, 0x10964B, 0xFFFFFFFF, 0x44A4A0, 0xFFFFFFFF, 0x3419300, 0x494D9, 0x3010000, 0x123018, 0x452218,
+    0x3109248, 0x492618, 0x64488, 0x4300610, 0x1244480, 0x30490DA, 0x42C1240, 0xD3018, 0xFFFFFFFF, 0xFFFFFFFF, 0x61B0D0, 0x14488,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2649248, 0x35090C0, 0x1242320, 0x18063, 0xC0848, 0x4000C3, 0x3308610, 0x3019800, 0x6DB, 0x1300318,
+    0x32484A0, 0xFFFFFFFF, 0x1844242, 0x254200, 0x4289059, 0xFFFFFFFF, 0x385B000, 0xFFFFFFFF, 0x860000, 0x4D9080, 0xFFFFFFFF, 0x1B0CC,
+    0x4498049, 0x2021800, 0x109418, 0x602049, 0xFFFFFFFF, 0x32C8109, 0xFFFFFFFF, 0x20C010C, 0x3018109, 0xFFFFFFFF, 0xFFFFFFFF, 0x29A213,
+    0xFFFFFFFF, 0x4252480, 0x259843, 0x609800, 0x1301243, 0xC94CB, 0xFFFFFFFF, 0x610DA, 0xFFFFFFFF, 0x2603, 0x125C640, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C0509, 0x3054800, 0xFFFFFFFF, 0x492880, 0x689460, 0x12D86C0, 0x4A3, 0xC0059, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x24906C0, 0x890109, 0xFFFFFFFF, 0x4840049, 0x3004240, 0x301B610, 0x30B289, 0x44901B, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x84844C, 0x8010C, 0x308109, 0x192E2, 0x3848600, 0xFFFFFFFF, 0x40C24C, 0x14986C0, 0xFFFFFFFF, 0x2251292, 0xC9859, 0x659018,
+    0x683618, 0x30C00D8, 0xFFFFFFFF, 0x304A253, 0xC929B, 0x490613, 0x62488, 0x1242482, 0x31A203, 0x24C9680, 0xFFFFFFFF, 0x4C0DA,
+    0x12C4243, 0xFFFFFFFF, 0xFFFFFFFF, 0x24C90C2, 0x1289010, 0xFFFFFFFF, 0x229B440, 0x1240322, 0x185B, 0xFFFFFFFF, 0x12990C3, 0x2C8661,
+    0x41804C, 0x168C018, 0x623448, 0x1C800, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C3109, 0xFFFFFFFF, 0x14D10C0, 0x291010, 0x49403, 0xFFFFFFFF,
+    0x36CA240, 0x98891, 0xFFFFFFFF, 0x2A10C3, 0x1292810, 0x860602, 0x1498490, 0x171B, 0x3049000, 0xFFFFFFFF, 0xFFFFFFFF, 0x424B2C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x304B600, 0xFFFFFFFF, 0x848698, 0x10C018, 0xFFFFFFFF, 0xFFFFFFFF, 0xC3308, 0x659848, 0x3618010, 0xFFFFFFFF,
+    0x6030A2, 0x600, 0x3240092, 0xFFFFFFFF, 0x165B049, 0xFFFFFFFF, 0x12416D2, 0x3052800, 0x26024C9, 0xD4403, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x14D4002, 0x4491210, 0xFFFFFFFF, 0xFFFFFFFF, 0x81843, 0x308262, 0xFFFFFFFF, 0xFFFFFFFF, 0x663049, 0x2E0260, 0x81289,
+    0x613600, 0xFFFFFFFF, 0xFFFFFFFF, 0x16492D8, 0x3004840, 0xFFFFFFFF, 0x9848, 0x294400, 0x4840080, 0x84B602, 0x61003, 0xFFFFFFFF,
+    0x1250092, 0x1312800, 0xFFFFFFFF, 0x40C849, 0x20C04D9, 0x600858, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3313200, 0xFFFFFFFF, 0x601899,
+    0xFFFFFFFF, 0xC9898, 0xFFFFFFFF, 0x30A2018, 0x20D8308, 0x12414A2, 0xFFFFFFFF, 0xFFFFFFFF, 0x49064B, 0x10C289, 0x24A01B, 0x2848308,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2012461, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x124C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x1709218, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2A2240, 0xFFFFFFFF, 0x4261202, 0x1850308, 0x285A400, 0x1C842, 0x3418248, 0xFFFFFFFF, 0x11B200, 0x1858083, 0x428B248,
+    0xC348B, 0x324A0C0, 0x425001B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x858308, 0x2480311, 0x1862400, 0xFFFFFFFF,
+    0x4488018, 0x65A400, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3258018, 0x344C049, 0x30C9260, 0x6C0698, 0x4616C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x248248, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x25092C0, 0x260648, 0x125A0C0, 0x1309603,
+    0x66104B, 0x708248, 0x113258, 0x1249491, 0x11719, 0xFFFFFFFF, 0x2003649, 0x413700, 0xFFFFFFFF, 0x249801A, 0x19494, 0x340324B,
+    0x3261250, 0x2CA483, 0x18404C3, 0x613642, 0xFFFFFFFF, 0xC00DA, 0xFFFFFFFF, 0x61600, 0x1498291, 0x980D8, 0xC440, 0xFFFFFFFF,
+    0x3600013, 0x3098291, 0xFFFFFFFF, 0x4E1218, 0x340A440, 0xFFFFFFFF, 0x3080908, 0x63649, 0x20E1203, 0x30D80C2, 0x384B240, 0xE1260,
+    0xFFFFFFFF, 0x30A2600, 0x258692, 0xB30C, 0xFFFFFFFF, 0xE2289, 0xFFFFFFFF, 0x14A04C0, 0x8A503, 0xFFFFFFFF, 0xFFFFFFFF, 0x490683,
+    0x708018, 0x24A064, 0x619700, 0x1825B, 0x64C04B, 0x4900D3, 0x54491, 0x30100C0, 0x1900400, 0x322003, 0x2A1260, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2494E1, 0x3649080, 0xC1488, 0x32480C0, 0x4900002, 0x3003061, 0x251261, 0xC213, 0xFFFFFFFF, 0xFFFFFFFF, 0x3098061,
+    0x30014D3, 0x11B249, 0xA1200, 0xC090A, 0xFFFFFFFF, 0x25000C0, 0x301C480, 0x12D3240, 0x9B4C8, 0x3680003, 0x3603400, 0x2022440,
+    0x6000C9, 0x30C0509, 0xFFFFFFFF, 0x4488059, 0x4240449, 0x1700848, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x493018, 0x622D8,
+    0x602109, 0x308400, 0x12892, 0x2910002, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x680, 0xFFFFFFFF, 0x3248449, 0xFFFFFFFF, 0x1841640,
+    0xFFFFFFFF, 0x16A4, 0x45B400, 0x5100C0, 0x2898000, 0x300185A, 0x2600C2, 0x26CA, 0x305901B, 0xDC203, 0x30012A1, 0x26490D8,
+    0xFFFFFFFF, 0xA440, 0x21813, 0x20030C0, 0x848063, 0x3291018, 0x42894C0, 0x340010C, 0xC011C, 0x3600610, 0x30048C0, 0x83908,
+    0x12506C0, 0xC489, 0xFFFFFFFF, 0xFFFFFFFF, 0x3004300, 0x20E1800, 0xFFFFFFFF, 0xFFFFFFFF, 0x1318002, 0x2619243, 0x361B000, 0x4C98C0,
+    0xFFFFFFFF, 0x12662, 0x131A600, 0x1649803, 0xFFFFFFFF, 0x25B291, 0x4644240, 0x44882C8, 0xFFFFFFFF, 0x708618, 0x858003, 0xFFFFFFFF,
+    0x6C9249, 0x224B618, 0x4906D0, 0x400894, 0x24B680, 0x3510049, 0x322600, 0xFFFFFFFF, 0x490112, 0xFFFFFFFF, 0x24B0C2, 0x1903002,
+    0x14D22C0, 0x1321248, 0xFFFFFFFF, 0xFFFFFFFF, 0x2652200, 0xFFFFFFFF, 0xFFFFFFFF, 0xC9803, 0xFFFFFFFF, 0xFFFFFFFF, 0x836D8, 0x618613,
+    0x3059291, 0xFFFFFFFF, 0xFFFFFFFF, 0x861242, 0xFFFFFFFF, 0xFFFFFFFF, 0x2600661, 0xFFFFFFFF, 0xFFFFFFFF, 0x10A643, 0x4CC249, 0x3049680,
+    0x188A480, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6016E0, 0x30490C9, 0x29B450, 0x4B518, 0x52263, 0xFFFFFFFF, 0x30D0600, 0x1242,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3010490, 0x2263, 0x3843, 0xFFFFFFFF, 0x4689000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3490098,
+    0x324B04B, 0x52709, 0x1494280, 0x12C9292, 0x4D804C, 0xFFFFFFFF, 0xD8660, 0x6610C0, 0xFFFFFFFF, 0x4C06C0, 0x1250263, 0x1C690,
+    0x20036C3, 0xFFFFFFFF, 0x3009618, 0x4309280, 0x44A25B, 0xFFFFFFFF, 0xFFFFFFFF, 0x49294, 0x698603, 0x600493, 0xFFFFFFFF, 0x21292,
+    0x4A2A1, 0x64240, 0xFFFFFFFF, 0x8A6A0, 0x10661, 0x648603, 0x424025B, 0x610C2, 0xFFFFFFFF, 0xFFFFFFFF, 0x14240, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12436C2, 0xFFFFFFFF, 0xC0602, 0xFFFFFFFF, 0xFFFFFFFF, 0x2480A2, 0x30D2410, 0x320600, 0x324825B,
+    0xFFFFFFFF, 0x300064C, 0x260492, 0xFFFFFFFF, 0xFFFFFFFF, 0x128B260, 0x129A300, 0x20C3600, 0x12492E1, 0x449003, 0xFFFFFFFF, 0x2308092,
+    0x18C0092, 0x2483648, 0x2499448, 0xFFFFFFFF, 0x2161B, 0x49063, 0xFFFFFFFF, 0x600260, 0x601843, 0xFFFFFFFF, 0xC150B, 0x659003,
+    0xFFFFFFFF, 0x11A289, 0xFFFFFFFF, 0x96D8, 0xFFFFFFFF, 0x4C683, 0x3311049, 0xFFFFFFFF, 0x618094, 0x130201B, 0x2604840, 0xFFFFFFFF,
+    0x30092D3, 0x600709, 0x452249, 0x30496C2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x890490, 0xFFFFFFFF, 0xD304C, 0x662800,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x4649203, 0xFFFFFFFF, 0xFFFFFFFF, 0x34D1049, 0x2649260, 0x12E1218, 0x18092, 0x32C8248, 0x12894A0, 0xFFFFFFFF,
+    0x248311, 0xFFFFFFFF, 0x1A692, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x600000, 0x9C450, 0x12624C0, 0xC12D8, 0xFFFFFFFF, 0x34D8248,
+    0xFFFFFFFF, 0x312240, 0x2914A0, 0x48412C0, 0x34D9240, 0x109449, 0xFFFFFFFF, 0xA4C3, 0x8A4000, 0x3109600, 0xFFFFFFFF, 0x1489888,
+    0x258860, 0x3049490, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1491603, 0x94000, 0x13260, 0xFFFFFFFF, 0x36000D0, 0x30892C3, 0x18D2400,
+    0x602518, 0xFFFFFFFF, 0x649660, 0xFFFFFFFF, 0x17000D8, 0x24B258, 0x20E12C0, 0x32C801B, 0xFFFFFFFF, 0x324B418, 0x499600, 0x2480E1,
+    0x1244700, 0xFFFFFFFF, 0xFFFFFFFF, 0x200148B, 0xFFFFFFFF, 0x1120D8, 0xFFFFFFFF, 0x320080, 0x3112280, 0x5A289, 0x30000D0, 0xFFFFFFFF,
+    0x2514, 0x198D1, 0xFFFFFFFF, 0x49660, 0x30184C0, 0x600862, 0xFFFFFFFF, 0x34030D8, 0x3421203, 0x4A024B, 0xFFFFFFFF, 0x1240461,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x61492, 0x36C0013, 0x6012C3, 0x9710, 0x4489250, 0x4C6C0, 0x30098D0, 0xFFFFFFFF, 0x30CC049,
+    0x1302061, 0xFFFFFFFF, 0x4850000, 0x400248, 0x603308, 0x9325A, 0x13004C3, 0x2911200, 0x26C8013, 0x1709200, 0x2480400, 0x168C600,
+    0x6CC210, 0xFFFFFFFF, 0x2CB24B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1B248, 0xFFFFFFFF, 0xFFFFFFFF, 0x248911, 0x30D00C0, 0xFFFFFFFF,
+    0x30534C0, 0x2880291, 0xFFFFFFFF, 0xFFFFFFFF, 0x4DB248, 0x125244B, 0xFFFFFFFF, 0x30800C3, 0x4A0018, 0x24802E0, 0xFFFFFFFF, 0x6D0291,
+    0x3401303, 0xFFFFFFFF, 0x61260, 0x10C602, 0x124125B, 0x94E3, 0x24CB018, 0xFFFFFFFF, 0x62299, 0xFFFFFFFF, 0x61948A, 0x1303400,
+    0xFFFFFFFF, 0x8D1200, 0x229A218, 0x12406D0, 0xFFFFFFFF, 0x3490003, 0x3109083, 0xFFFFFFFF, 0x4259249, 0x1241700, 0x64, 0x14D3018,
+    0xD0291, 0x164A440, 0xFFFFFFFF, 0x924A0, 0x2109308, 0x1B01B, 0xFFFFFFFF, 0x5B402, 0x328924B, 0x80291, 0x428B000, 0x224C258,
+    0x2094480, 0x20C0061, 0xFFFFFFFF, 0x98692, 0x14DA200, 0xFFFFFFFF, 0x1292603, 0x30006C3, 0x112109, 0x2630D0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x200924C, 0x229124B, 0x14A0003, 0xFFFFFFFF, 0x305A488, 0xC2109, 0x4C262, 0x2019300, 0xFFFFFFFF, 0x619250, 0x24C924A, 0x34C0109,
+    0xFFFFFFFF, 0x24801A, 0x6002E0, 0xFFFFFFFF, 0xFFFFFFFF, 0x36004A0, 0x3089690, 0xFFFFFFFF, 0x25C258, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x204C0C3, 0x1303680, 0xFFFFFFFF, 0x1509300, 0xFFFFFFFF, 0x3289018, 0x1243510, 0x13030C0, 0x2A1248, 0xFFFFFFFF,
+    0x3003618, 0x248044C, 0x12DB0C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xDB400, 0xFFFFFFFF, 0x30C0049, 0x1300, 0x1B291, 0x511300, 0x34D10C0,
+    0x2291018, 0x261302, 0x9A498, 0xFFFFFFFF, 0xFFFFFFFF, 0x30806C0, 0xFFFFFFFF, 0x89861, 0xFFFFFFFF, 0x4488600, 0x2004300, 0x3612480,
+    0x20D86C0, 0x1241858, 0xC6A0, 0x6D8610, 0x129901B, 0x148A480, 0xFFFFFFFF, 0x124129C, 0x9522, 0xFFFFFFFF, 0x3258049, 0x622C3,
+    0x300C298, 0x30C9291, 0x1300890, 0x3109680, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1240720, 0x304C0D0, 0x2A101B, 0xFFFFFFFF, 0x184004C,
+    0x260660, 0x610600, 0xFFFFFFFF, 0x3418600, 0xFFFFFFFF, 0x1842649, 0x261689, 0x2498600, 0xC3840, 0xD8059, 0xFFFFFFFF, 0x20C0661,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x6D2200, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3291003, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30032C8, 0x1849848,
+    0x1240049, 0xFFFFFFFF, 0x1311840, 0xFFFFFFFF, 0x1700603, 0x602483, 0x1242649, 0xA1460, 0x3243600, 0x4C2A1, 0x684243, 0x6034A0,
+    0x619292, 0xFFFFFFFF, 0x3681840, 0xFFFFFFFF, 0xFFFFFFFF, 0x600320, 0x4640092, 0x30492E0, 0xFFFFFFFF, 0x708600, 0x24A649, 0x4D2648,
+    0x1249849, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x683109, 0x2709003, 0x1151A, 0xFFFFFFFF, 0xFFFFFFFF, 0x424944A, 0xFFFFFFFF, 0x20528C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x4842018, 0x499458, 0x251848, 0x98493, 0x1900, 0xFFFFFFFF, 0xFFFFFFFF, 0x2291618, 0x20D8260, 0x1253049,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12D2248, 0x204C000, 0xA698, 0x3692240, 0x1641840, 0x202144B, 0x3023200, 0x6C1842,
+    0x12418, 0xFFFFFFFF, 0xE2648, 0x40950B, 0x1241899, 0x304A689, 0xFFFFFFFF, 0xFFFFFFFF, 0x52249, 0xFFFFFFFF, 0x12412D4, 0x6C9000,
+    0x649840, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x128C0, 0x2A1618, 0xFFFFFFFF, 0x1511448, 0xFFFFFFFF, 0xFFFFFFFF, 0x621283,
+    0xC1840, 0xFFFFFFFF, 0xFFFFFFFF, 0x119000, 0x16D2, 0xFFFFFFFF, 0x4840248, 0xFFFFFFFF, 0xFFFFFFFF, 0x83490, 0xFFFFFFFF, 0x6D2800,
+    0xFFFFFFFF, 0x848649, 0xFFFFFFFF, 0x12D201A, 0x3712, 0xFFFFFFFF, 0xFFFFFFFF, 0x26D3200, 0x202121B, 0x4C944B, 0x9B2C2, 0x384824A,
+    0xFFFFFFFF, 0x4A2A3, 0x1498308, 0x6014A2, 0x206104C, 0xFFFFFFFF, 0xFFFFFFFF, 0x62690, 0x18492D0, 0x6024CB, 0xFFFFFFFF, 0x232C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x248649, 0x201B, 0x34880D8, 0x4700248, 0xFFFFFFFF, 0x300A509, 0xFFFFFFFF, 0x60B261, 0xFFFFFFFF, 0xD4840,
+    0xFFFFFFFF, 0x2DA4C0, 0x6096C3, 0x124C448, 0x146D0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x185824A, 0x921B, 0xFFFFFFFF, 0x519218,
+    0x36092C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x30D8018, 0xC3092, 0xFFFFFFFF, 0xFFFFFFFF, 0x251883, 0x1240418, 0x9B092, 0x3409818, 0xFFFFFFFF,
+    0x200C218, 0x860248, 0x602848, 0xFFFFFFFF, 0x4489200, 0x1640860, 0x424001A, 0x248A840, 0x204C049, 0x304B24B, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x148B083, 0x25B649, 0xFFFFFFFF, 0x1245C, 0x24C9098, 0x52849, 0xFFFFFFFF, 0xFFFFFFFF, 0x24B, 0x3491200, 0x510248, 0xFFFFFFFF,
+    0x3000400, 0x609493, 0x2848, 0xFFFFFFFF, 0xFFFFFFFF, 0x3260403, 0xFFFFFFFF, 0x920C9, 0x14D1098, 0x13192C0, 0x200324B, 0xFFFFFFFF,
+    0x2483418, 0xFFFFFFFF, 0x4889, 0xC02A4, 0xFFFFFFFF, 0x5C04C, 0x249318, 0x30C301A, 0x42C3, 0xC12C3, 0xFFFFFFFF, 0x3004480,
+    0x86001A, 0x449260, 0x3212C0, 0x34180C0, 0xFFFFFFFF, 0x1488858, 0x14A1203, 0xFFFFFFFF, 0x304B018, 0x260301B, 0x8480C2, 0x1488291,
+    0x603080, 0x124324B, 0xFFFFFFFF, 0x448B010, 0x5261B, 0x8604C0, 0x258294, 0x1B, 0xFFFFFFFF, 0xC94E0, 0x200930C, 0x14A00C9,
+    0x602500, 0xFFFFFFFF, 0x2600908, 0xFFFFFFFF, 0xFFFFFFFF, 0x24B248, 0xFFFFFFFF, 0x1261810, 0x32430C0, 0xFFFFFFFF, 0x2013689, 0x2480CC,
+    0x94490, 0x465B, 0xFFFFFFFF, 0x42C9800, 0x409200, 0x2E1258, 0x124C489, 0x981A, 0x4840059, 0x200249B, 0x300425A, 0x30C1242,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xC3691, 0xFFFFFFFF, 0x84B01A, 0x80124, 0x30C2C0, 0xC0513, 0x16D1250, 0xFFFFFFFF, 0x40C261, 0x30C06D0,
+    0xFFFFFFFF, 0x3848059, 0xFFFFFFFF, 0x200C249, 0xFFFFFFFF, 0x204C649, 0x618680, 0x4489240, 0x8C80C3, 0xFFFFFFFF, 0x412449, 0x2490000,
+    0xFFFFFFFF, 0xCA2D2, 0x490063, 0xFFFFFFFF, 0x425B002, 0x84A, 0x6C02E0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3012658, 0x9424B,
+    0x6CC200, 0xFFFFFFFF, 0x12A1403, 0x2018618, 0x24A49A, 0x926C2, 0xFFFFFFFF, 0xFFFFFFFF, 0x4930C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x899249,
+    0x1C242, 0x12894C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x36494C0, 0x2499242, 0xC02E3, 0xFFFFFFFF, 0x4A0003, 0x1840112, 0x8924C, 0x4310,
+    0x294648, 0xD86D0, 0x3001902, 0xFFFFFFFF, 0xFFFFFFFF, 0x94CB, 0x1C700, 0x3251298, 0x1488890, 0xFFFFFFFF, 0xFFFFFFFF, 0x6D22C0,
+    0xFFFFFFFF, 0x521248, 0x1701240, 0xFFFFFFFF, 0x61A490, 0x6C4250, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x260610, 0x44C308, 0x14D3003,
+    0xD4418, 0x325B049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3052259, 0xD12A1, 0x3092648, 0x3018600, 0xFFFFFFFF, 0x8922C0, 0xFFFFFFFF,
+    0x3243109, 0xFFFFFFFF, 0x20C004C, 0xFFFFFFFF, 0x4D9, 0x1A48C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x31101B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x61018, 0x252489, 0xFFFFFFFF, 0xFFFFFFFF, 0xC36D0, 0x4C24A, 0x84B059, 0x90804B, 0xFFFFFFFF, 0x3049858, 0xFFFFFFFF,
+    0x3080320, 0xFFFFFFFF, 0x1240492, 0xFFFFFFFF, 0x1361B, 0x2601289, 0x360304B, 0xFFFFFFFF, 0x1719400, 0x6186C2, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4240094, 0xFFFFFFFF, 0x8061B, 0x21090C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x709018, 0x3289003, 0x308049, 0xFFFFFFFF, 0x64A480, 0xFFFFFFFF,
+    0x3003603, 0x721400, 0xFFFFFFFF, 0x18A1, 0x1899003, 0x2001289, 0x18D10C0, 0x41C240, 0x2602CB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x36C9280, 0xFFFFFFFF, 0x292643, 0x324A0D8, 0x4C01A, 0x41B6C0, 0x60065C, 0x311848, 0xC0322, 0xFFFFFFFF, 0x3084289,
+    0xFFFFFFFF, 0x1241842, 0xC68B, 0x24CB600, 0xFFFFFFFF, 0x3089448, 0x12C3603, 0xFFFFFFFF, 0x1185B, 0x3059109, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x6036C0, 0x44A303, 0x3243260, 0x16416D0, 0xFFFFFFFF, 0x1493218, 0x2492410, 0x2851448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x9B, 0x1309618, 0xFFFFFFFF, 0xFFFFFFFF, 0x403661, 0x24B889, 0xFFFFFFFF, 0x1B04B, 0xD28C0, 0x49B200, 0xFFFFFFFF,
+    0x24B2CB, 0xFFFFFFFF, 0xFFFFFFFF, 0x649112, 0xFFFFFFFF, 0x249700, 0x30C3403, 0x9B260, 0xC16D2, 0x3248308, 0x6161A, 0x4252400,
+    0xFFFFFFFF, 0xC458, 0xFFFFFFFF, 0xFFFFFFFF, 0x5A300, 0x301A0D8, 0x84900, 0x92DA, 0xFFFFFFFF, 0xFFFFFFFF, 0x8484D8, 0x3009493,
+    0x20E1218, 0x1300649, 0x14E4000, 0x49112, 0x2022688, 0x4C92D8, 0x1243092, 0x30492CB, 0x131A018, 0x164921B, 0xFFFFFFFF, 0x25C289,
+    0xFFFFFFFF, 0x6C921A, 0xFFFFFFFF, 0x709610, 0x3890248, 0x8064C, 0x308648, 0x6CA243, 0xFFFFFFFF, 0x26C0308, 0x30100DB, 0x612403,
+    0x348B, 0xFFFFFFFF, 0x4842003, 0xFFFFFFFF, 0x41C840, 0x3649098, 0x6224C0, 0x130C440, 0xFFFFFFFF, 0x3003083, 0x20D824B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xC921B, 0x4C600, 0x26CA0C0, 0x861200, 0xFFFFFFFF, 0xA68B, 0x305A289, 0x2003308, 0x25000D8, 0xFFFFFFFF, 0x8C44B,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1299603, 0x20CC218, 0x69824B, 0xFFFFFFFF, 0xFFFFFFFF, 0xC96C3, 0xFFFFFFFF, 0x1491210, 0xFFFFFFFF, 0x1249600,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x300C2C9, 0x204930B, 0x308418, 0xFFFFFFFF, 0x324A000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x698,
+    0x3240121, 0x3248461, 0x2CB649, 0x3019203, 0x4D9602, 0x32024A, 0x1B648, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x92510, 0xFFFFFFFF,
+    0x2883248, 0x42CA440, 0x2019488, 0x4C00D8, 0xFFFFFFFF, 0x48C3000, 0xFFFFFFFF, 0x3253800, 0xFFFFFFFF, 0x3291010, 0x19000D0, 0x44800C3,
+    0xDA0C3, 0xFFFFFFFF, 0x4092C3, 0x301A6C0, 0xFFFFFFFF, 0x188B248, 0xCC04C, 0xFFFFFFFF, 0x2DA002, 0x609210, 0x1258461, 0x64801B,
+    0xFFFFFFFF, 0x4C2C8, 0x9080D0, 0xFFFFFFFF, 0x2003, 0xFFFFFFFF, 0xE12C0, 0xFFFFFFFF, 0x2DC049, 0x12430D8, 0x3049308, 0xC001A,
+    0xFFFFFFFF, 0x36C00C0, 0xFFFFFFFF, 0x61B300, 0x6C9260, 0x4840003, 0x662448, 0x3000061, 0x8324B, 0x30B248, 0xFFFFFFFF, 0x519203,
+    0x3610000, 0x248513, 0x800C0, 0x61244B, 0xFFFFFFFF, 0x34C0061, 0x2004488, 0xFFFFFFFF, 0x4C9203, 0x249A440, 0x34014D1, 0xFFFFFFFF,
+    0x200C203, 0x691092, 0x60125B, 0x30DA049, 0xC925C, 0x164084B, 0x62460, 0x109648, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6542C0,
+    0x3619800, 0x6006C2, 0xFFFFFFFF, 0x3049698, 0x310924A, 0xFFFFFFFF, 0x4243610, 0x601700, 0x1244483, 0x893018, 0xC9709, 0x53858,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x61B0C9, 0x1448B, 0xFFFFFFFF, 0x2018003, 0x3013061, 0x83018, 0x3858, 0xC084A, 0xFFFFFFFF, 0x499810,
+    0x24C483, 0x6A2049, 0x124B680, 0x22492A1, 0x6600C0, 0xFFFFFFFF, 0x1122D0, 0x30C044C, 0x11C, 0x42A3000, 0x1292213, 0x309B000,
+    0x301A260, 0x260119, 0xFFFFFFFF, 0xFFFFFFFF, 0x20036D8, 0x1488848, 0x42124C, 0x8C818, 0x304B003, 0x292498, 0x4A888, 0x4A3018,
+    0x301810B, 0xFFFFFFFF, 0x3404300, 0x22889, 0xFFFFFFFF, 0x2DA600, 0xFFFFFFFF, 0x1244253, 0x6D8449, 0x510003, 0x3601689, 0xFFFFFFFF,
+    0x260002, 0x6C3680, 0xFFFFFFFF, 0x8C9300, 0x403000, 0x2649018, 0x603510, 0x6C30C2, 0xC0618, 0xD2261, 0xFFFFFFFF, 0x1843018,
+    0x98618, 0x4640, 0xFFFFFFFF, 0x2263000, 0x59248, 0xFFFFFFFF, 0x364A250, 0x9800, 0xFFFFFFFF, 0x519800, 0x5B849, 0x4192A1,
+    0x30D8602, 0x182DA, 0x2880490, 0xFFFFFFFF, 0x84B000, 0x3291403, 0x3509, 0xFFFFFFFF, 0xFFFFFFFF, 0x200C803, 0x33082C8, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4A1240, 0xFFFFFFFF, 0x60129C, 0x312488, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C698, 0x6248A, 0xFFFFFFFF,
+    0x6C0890, 0x305A300, 0xFFFFFFFF, 0x4C0D0, 0x24B003, 0x600720, 0x1300490, 0xFFFFFFFF, 0x1289000, 0xFFFFFFFF, 0xFFFFFFFF, 0x124C800,
+    0x30E1280, 0xFFFFFFFF, 0xFFFFFFFF, 0x2018600, 0x83618, 0x1299, 0x18661, 0xFFFFFFFF, 0xFFFFFFFF, 0x2CC240, 0xFFFFFFFF, 0x612818,
+    0x291002, 0xC3449, 0xFFFFFFFF, 0x4249283, 0x4C1289, 0x32DA, 0x3840092, 0xD3500, 0x3612410, 0x309B600, 0x694018, 0x3049002,
+    0xC28C9, 0xFFFFFFFF, 0x1508600, 0xFFFFFFFF, 0x602649, 0x449291, 0xFFFFFFFF, 0xFFFFFFFF, 0x3002908, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x24CC000, 0xE4018, 0xFFFFFFFF, 0xFFFFFFFF, 0x603, 0x1301842, 0x3109059, 0x4A30C, 0x344B480, 0xFFFFFFFF, 0x260600, 0xC50A,
+    0xFFFFFFFF, 0x36000E1, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3492018, 0x128C400, 0xFFFFFFFF, 0x12C030B, 0x4C004C, 0x1259508, 0x340064C,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x309289, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x430B200, 0x311000, 0x294403,
+    0xFFFFFFFF, 0x84B600, 0x692248, 0x6114A0, 0xFFFFFFFF, 0x1889610, 0xFFFFFFFF, 0x148864B, 0xFFFFFFFF, 0x6124C2, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x42D2010, 0x18C9448, 0xFFFFFFFF, 0xFFFFFFFF, 0x13603, 0xCC458, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4240080, 0xFFFFFFFF, 0x24B600, 0xFFFFFFFF, 0xFFFFFFFF, 0x1289610, 0x490092, 0x24B04B, 0xFFFFFFFF, 0x94848, 0x13004D8, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3621600, 0xFFFFFFFF, 0xFFFFFFFF, 0x3241300, 0x1299109, 0x12A4000, 0xFFFFFFFF, 0x124C283, 0xFFFFFFFF, 0xFFFFFFFF, 0x20920C3,
+    0xFFFFFFFF, 0x3289490, 0x38D9, 0xFFFFFFFF, 0xC3488, 0xFFFFFFFF, 0x49C440, 0x30182A1, 0x331B, 0xFFFFFFFF, 0xC030B, 0x30800D8,
+    0x33080D0, 0x30C3080, 0x9830B, 0xFFFFFFFF, 0x50C000, 0x3251880, 0xFFFFFFFF, 0xFFFFFFFF, 0x1909049, 0x2908248, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x170024B, 0x3023640, 0x1258083, 0xFFFFFFFF, 0x324324B, 0x49322, 0x4302000, 0xFFFFFFFF, 0xFFFFFFFF, 0x3109098, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x258308, 0x304A508, 0xFFFFFFFF, 0xD4449, 0xFFFFFFFF, 0x24A294, 0x1249493, 0x2248692, 0xFFFFFFFF, 0xFFFFFFFF, 0x330A003,
+    0x328A840, 0xFFFFFFFF, 0xFFFFFFFF, 0xC069B, 0x4858010, 0x3899200, 0x249718, 0x46C8, 0x2121B, 0xFFFFFFFF, 0x402512, 0x8580C0,
+    0x124001B, 0x31104C, 0x3849200, 0x3251649, 0x3089203, 0x692289, 0x1242618, 0x4E1203, 0xFFFFFFFF, 0x521600, 0x1488698, 0x170001B,
+    0x1242064, 0x61A848, 0x1889098, 0xFFFFFFFF, 0x4258010, 0x10A289, 0x12404C3, 0x2851200, 0x3681258, 0xFFFFFFFF, 0x36C1640, 0x121098,
+    0x60C203, 0x44C109, 0xFFFFFFFF, 0x3258291, 0xFFFFFFFF, 0xFFFFFFFF, 0x4D3640, 0xFFFFFFFF, 0x64948B, 0xFFFFFFFF, 0xFFFFFFFF, 0x24B080,
+    0x46430C0, 0x1250B, 0x3248680, 0xFFFFFFFF, 0xFFFFFFFF, 0x248301A, 0x18D8, 0xC148A, 0x2260291, 0xFFFFFFFF, 0x301A440, 0x30C1640,
+    0x131B, 0xC9202, 0x48D8000, 0x30014D1, 0x861203, 0x830DB, 0x3918, 0x291094, 0x30806D8, 0x848293, 0x4888000, 0x60324A,
+    0x1300400, 0x2600064, 0x2004318, 0x1520003, 0x30C30C9, 0x1240293, 0x4481300, 0x50C049, 0x65A449, 0x40A500, 0x6026CA, 0x449320,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3602880, 0x42530C0, 0x60A440, 0x30D0003, 0x26030D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x248291, 0xFFFFFFFF, 0x3243,
+    0xFFFFFFFF, 0x3080003, 0x3308002, 0x24A891, 0x260683, 0x16A1, 0x2260061, 0xFFFFFFFF, 0xFFFFFFFF, 0x20D8000, 0x12D9300, 0x321250,
+    0x341804C, 0x128C488, 0x2503000, 0x4C00C3, 0x2109, 0xA443, 0x21810, 0xFFFFFFFF, 0x849643, 0x301C250, 0x314200, 0xB460,
+    0x18A0003, 0x3089800, 0x30032E0, 0x2480112, 0x98C2, 0xFFFFFFFF, 0xFFFFFFFF, 0x5A318, 0x61083, 0x1850000, 0x930C, 0x10064,
+    0x3243618, 0x84B0C9, 0x14886D0, 0x3294080, 0x4508049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x249643, 0x12430D0, 0x2851249, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x42406C2, 0x112049, 0x1249860, 0x6C924B, 0x2A3400, 0xD4258, 0xFFFFFFFF, 0x419243, 0x12492A2, 0x3661010, 0x1289691,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1903000, 0xFFFFFFFF, 0xC4643, 0xFFFFFFFF, 0x3002092, 0x119248, 0x36490C9, 0xC810, 0x3248112,
+    0xFFFFFFFF, 0x20C2498, 0x301A480, 0x618610, 0x50901B, 0xC924B, 0xFFFFFFFF, 0x683003, 0x908449, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3009292, 0x4C9690, 0xA2260, 0xFFFFFFFF, 0xFFFFFFFF, 0x682483, 0x60010C, 0x2052203, 0x893003, 0x1892200, 0x4B503,
+    0x26D8049, 0xFFFFFFFF, 0x2049908, 0x1302480, 0x23508, 0x34D1000, 0xFFFFFFFF, 0x83003, 0x30B002, 0x3053442, 0x324B602, 0x4689003,
+    0x68C249, 0xFFFFFFFF, 0x6C2, 0x89A202, 0x324B049, 0x2898600, 0x30124D0, 0x36E1000, 0x109, 0xFFFFFFFF, 0x6610C2, 0x2018493,
+    0xFFFFFFFF, 0x32A2240, 0x9463, 0x291461, 0x3691000, 0x424C280, 0x4C010C, 0x2848049, 0xFFFFFFFF, 0xFFFFFFFF, 0x18A0600, 0x1488262,
+    0xFFFFFFFF, 0x124065C, 0x6C004B, 0x3109002, 0xFFFFFFFF, 0x64243, 0x38A1000, 0x12400A2, 0x30E1003, 0xFFFFFFFF, 0x3600094, 0x610C9,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2649003, 0xFFFFFFFF, 0x3618, 0xFFFFFFFF, 0x64A643, 0xFFFFFFFF, 0x858600,
+    0xFFFFFFFF, 0x490, 0x136C3, 0x128A250, 0xFFFFFFFF, 0xFFFFFFFF, 0x928C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x2883600, 0x2019843, 0x4262400,
+    0x9230A, 0xFFFFFFFF, 0xFFFFFFFF, 0x34C0649, 0x400323, 0x119848, 0x30C224B, 0xFFFFFFFF, 0x292250, 0x4A643, 0xFFFFFFFF, 0x24804D8,
+    0x311458, 0x1A308, 0x16D2248, 0x2002910, 0x64002, 0x90A000, 0xFFFFFFFF, 0xC294, 0x3418308, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x891002, 0x304C840, 0x32524C0, 0x3618248, 0x30092DA, 0x1852410, 0x893600, 0xFFFFFFFF, 0xD3600, 0xFFFFFFFF, 0xFFFFFFFF, 0x30CB480,
+    0x263, 0xFFFFFFFF, 0x2894000, 0x360B200, 0x4300080, 0x30B602, 0xFFFFFFFF, 0x225A4C0, 0xFFFFFFFF, 0x709449, 0x2E3600, 0xFFFFFFFF,
+    0x18094, 0xFFFFFFFF, 0x2003260, 0xFFFFFFFF, 0x301824A, 0x48A0, 0xFFFFFFFF, 0xC1899, 0xFFFFFFFF, 0x40944B, 0x2481888, 0xFFFFFFFF,
+    0xC12DB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x312243, 0xFFFFFFFF, 0xD80E1, 0x18C0308, 0x62242, 0x30C9210, 0xFFFFFFFF,
+    0x21891, 0xE4000, 0xFFFFFFFF, 0xFFFFFFFF, 0x69B200, 0x3049492, 0x6DA018, 0x3603243, 0x308C448, 0xFFFFFFFF, 0x12400E1, 0x311109,
+    0xFFFFFFFF, 0x36000DA, 0x61109, 0x300C6C0, 0x61830A, 0x100C3, 0x1318080, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x124A450, 0x32C8018,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3018018, 0x9B202, 0xFFFFFFFF, 0x1322400, 0x2018860, 0x419889, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4034D9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1889600, 0x49663, 0x32600D0, 0x301B080, 0xFFFFFFFF, 0xFFFFFFFF, 0xC46C8,
+    0x659600, 0x1489658, 0x6002A4, 0xFFFFFFFF, 0x3049262, 0x22512C0, 0x3909200, 0xFFFFFFFF, 0x12104B, 0x1241488, 0xC2D0, 0xFFFFFFFF,
+    0x4240063, 0x12C0692, 0x6038C8, 0x6180D8, 0xFFFFFFFF, 0x42C0848, 0x4C109, 0x12C00DB, 0x12434D1, 0x860, 0x304C2C8, 0xCB309,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2A1, 0xFFFFFFFF, 0xFFFFFFFF, 0x201861B, 0x43000C2, 0x926D0, 0xFFFFFFFF, 0x18692, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x24B4D1, 0x2612C0, 0x180D3, 0x649318, 0x16D0000, 0x18C1488, 0x3018291, 0xFFFFFFFF, 0x38400C0, 0xFFFFFFFF, 0x2000121,
+    0x33080C2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xCC213, 0x2009494, 0x62842, 0x2489649, 0x30C9810, 0x1888291, 0xFFFFFFFF, 0x308A443,
+    0x30096A0, 0xFFFFFFFF, 0x28480C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x400018, 0x1701258, 0x12406E1, 0x94600, 0x13860, 0xFFFFFFFF, 0x16426C8,
+    0x1489310, 0x4CA500, 0xFFFFFFFF, 0x131B240, 0xFFFFFFFF, 0xFFFFFFFF, 0x18500C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x3418003, 0xD8013, 0x709258,
+    0x24B2A1, 0x2498000, 0x3692, 0xD22D8, 0x3900000, 0x300384A, 0x3011303, 0x4DB018, 0xFFFFFFFF, 0xC00C9, 0x20014D1, 0x300328C,
+    0x41C488, 0x249A049, 0xFFFFFFFF, 0x3249300, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1254258, 0x2908000, 0xCA440, 0x4A0848, 0x862440,
+    0x124204C, 0xA2443, 0x216A0, 0x651309, 0x490E4, 0x36C0610, 0xFFFFFFFF, 0x1300061, 0x3681243, 0x3604640, 0x2023680, 0xFFFFFFFF,
+    0x601309, 0xA4480, 0xD0064, 0xFFFFFFFF, 0x3009908, 0x12C3291, 0x93850, 0x14D1248, 0xFFFFFFFF, 0x2012492, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x308063, 0x304C300, 0xFFFFFFFF, 0xFFFFFFFF, 0x1498618, 0x2494D3, 0x20522C3, 0x323010, 0x652213, 0xFFFFFFFF, 0xFFFFFFFF, 0x2618C0,
+    0x4D924A, 0xC2490, 0xFFFFFFFF, 0x2899240, 0x229101B, 0x6112A1, 0x3903, 0x291080, 0x30806C3, 0x4250049, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xB683, 0x461248, 0xFFFFFFFF, 0xFFFFFFFF, 0x1190D8, 0x604253, 0xFFFFFFFF, 0xFFFFFFFF, 0x3089460, 0x5221A, 0xFFFFFFFF, 0x28486C0,
+    0x9520, 0x6D8059, 0x8D1800, 0x6802DA, 0xFFFFFFFF, 0x1259689, 0x3490600, 0x1319240, 0xE14C8, 0xFFFFFFFF, 0x8C309, 0xFFFFFFFF,
+    0x3049510, 0x29A2C2, 0x1649460, 0x41B000, 0x18506C0, 0x4289000, 0xC1243, 0xD02DA, 0xFFFFFFFF, 0x859240, 0xFFFFFFFF, 0x321242,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1842092, 0x93508, 0x36D3, 0xFFFFFFFF, 0x3080490, 0xFFFFFFFF, 0x24C302, 0x986C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x34C1289, 0x858109, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2019900, 0x2489458, 0xFFFFFFFF, 0x188C240,
+    0x3243603, 0xFFFFFFFF, 0xFFFFFFFF, 0x20490C0, 0xFFFFFFFF, 0x18890C0, 0x3243049, 0x4A700, 0xFFFFFFFF, 0x698490, 0x304A8C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1210C9, 0x14691, 0x648493, 0xD4243, 0xFFFFFFFF, 0x3289618, 0x308660, 0x2482, 0x3403600,
+    0x663440, 0x4249448, 0x30116D0, 0x3080A2, 0x34A0, 0x340304C, 0x4901A, 0x468A240, 0x301944B, 0xFFFFFFFF, 0xFFFFFFFF, 0x128B6C0,
+    0x8C8600, 0x3003092, 0x30C0092, 0x618600, 0x1B2D2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C0320, 0xA6A0, 0x2109000, 0x16D0098,
+    0x1640260, 0x148B04B, 0x8C460, 0x6C0260, 0x4480308, 0xDA308, 0x4A4D1, 0x6940C0, 0x699840, 0x125A24B, 0xFFFFFFFF, 0x3258649,
+    0x493600, 0x2DA24A, 0x12412DB, 0xFFFFFFFF, 0x648260, 0x49304B, 0x413888, 0xFFFFFFFF, 0x30C92D0, 0x2112800, 0x4492400, 0x2000649,
+    0x54292, 0x264A240, 0x621280, 0x1300311, 0xC1843, 0x129C0C0, 0x184009B, 0x3019218, 0x98263, 0x1B659, 0x3249498, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2490308, 0xFFFFFFFF, 0x291449, 0xC9003, 0xFFFFFFFF, 0x20C4840, 0x4C4289, 0xFFFFFFFF, 0xC0708, 0x20046D0, 0x1488258,
+    0x30180E1, 0x1240649, 0xB491, 0xFFFFFFFF, 0xFFFFFFFF, 0x3003311, 0x14A0648, 0xFFFFFFFF, 0x125A018, 0xFFFFFFFF, 0x3600080, 0x2DA018,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xD2800, 0x16DB200, 0xFFFFFFFF, 0xFFFFFFFF, 0x892240, 0x6C04D8, 0x649059, 0x1511218, 0x300A510,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x453489, 0x3248248, 0x664000, 0x3621202, 0x60C280, 0x124C44A, 0x224B649, 0x2092291, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x84840, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C92D2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xC3094, 0x1289109, 0x596C3, 0x254443,
+    0x4C9218, 0xFFFFFFFF, 0x384801A, 0xFFFFFFFF, 0x3000521, 0x30C00D3, 0x204C600, 0x96C0, 0x3409261, 0xD8308, 0x412403, 0xFFFFFFFF,
+    0x313480, 0xA6E1, 0xFFFFFFFF, 0x44A0010, 0x63480, 0xFFFFFFFF, 0xB700, 0xFFFFFFFF, 0xFFFFFFFF, 0x23112C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x44880C9, 0x51024B, 0xFFFFFFFF, 0xFFFFFFFF, 0x92680, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x201801B, 0x264A840, 0x920C3,
+    0x2248294, 0x19658, 0x128C04B, 0xFFFFFFFF, 0x30114D1, 0x4289648, 0x34900C9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C92C3, 0x311203,
+    0x3059649, 0x64B308, 0xFFFFFFFF, 0xFFFFFFFF, 0x1499488, 0xFFFFFFFF, 0x18521, 0xFFFFFFFF, 0x1508018, 0x2021818, 0x602061, 0x125801B,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x8480D0, 0x40C491, 0x8C261, 0xFFFFFFFF, 0xFFFFFFFF, 0x16D9202, 0x34CC200, 0xFFFFFFFF, 0x12400C9, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x36000C0, 0x361A049, 0x301084B, 0x32930C0, 0x305221A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24B24A, 0xFFFFFFFF, 0x6C30C0,
+    0x6E1202, 0x2003018, 0xFFFFFFFF, 0x2480C0, 0x124B460, 0x1301700, 0xFFFFFFFF, 0xFFFFFFFF, 0x201884B, 0x83860, 0x60C2C2, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2018294, 0xFFFFFFFF, 0xFFFFFFFF, 0x3661080, 0xFFFFFFFF, 0x2000908, 0x42494C8, 0x693242, 0x262500, 0x3488003, 0xC30D3,
+    0xFFFFFFFF, 0x4251240, 0x2480510, 0x920400, 0xFFFFFFFF, 0x4489800, 0x2009693, 0x4A1258, 0x300B448, 0x8A4A1, 0x61B240, 0x13100C0,
+    0xFFFFFFFF, 0x36130C0, 0xFFFFFFFF, 0x6180C2, 0xFFFFFFFF, 0xFFFFFFFF, 0x3259240, 0x1488509, 0x24B01B, 0x2849300, 0x3491800, 0x510848,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x622440, 0x6CC202, 0xFFFFFFFF, 0x522D3, 0x24A490, 0x4C0848, 0xFFFFFFFF, 0x1C818, 0x2003848,
+    0x2C80C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x19693, 0x34C3003, 0xFFFFFFFF, 0x18406D0, 0x364C080, 0x48D1, 0x1A6C0, 0xFFFFFFFF,
+    0x5C092, 0x860610, 0xFFFFFFFF, 0xC649, 0xFFFFFFFF, 0xFFFFFFFF, 0x6124A, 0xFFFFFFFF, 0xFFFFFFFF, 0x304B618, 0x6D8000, 0x200A48C,
+    0x2D18C0, 0x4310049, 0x1258059, 0xFFFFFFFF, 0xFFFFFFFF, 0x400000, 0x3618049, 0x6030C2, 0x618, 0xFFFFFFFF, 0x510618, 0x36006C0,
+    0x3452200, 0x124010B, 0x5C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24B843, 0x60A889, 0xFFFFFFFF, 0x130901B, 0x2003618, 0x403064,
+    0x2486CC, 0x124A48B, 0x3709400, 0x4480600, 0x288004C, 0x3300109, 0x3018049, 0xFFFFFFFF, 0x1261298, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x30C1842, 0x1520, 0x985C, 0xFFFFFFFF, 0xD84A0, 0x3099840, 0x25248B, 0x3488600, 0x34036C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x3099289,
+    0x600893, 0x6C3000, 0xC3119, 0x521018, 0x490DB, 0xFFFFFFFF, 0x1243059, 0x61A260, 0x130004B, 0xFFFFFFFF, 0x1642480, 0xFFFFFFFF,
+    0x2490603, 0x890049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x649461, 0xFFFFFFFF, 0x709013, 0x4302248,
+    0xFFFFFFFF, 0x3449, 0xFFFFFFFF, 0x42420D8, 0xFFFFFFFF, 0x1498600, 0x263449, 0x1262648, 0xFFFFFFFF, 0x708490, 0xFFFFFFFF, 0x609511,
+    0x428A240, 0xFFFFFFFF, 0xC2480, 0x34C3600, 0xFFFFFFFF, 0xFFFFFFFF, 0x9A480, 0x196E0, 0xD9292, 0x849840, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3049618, 0x24C9003, 0xFFFFFFFF, 0x8D90C0, 0x30192D8, 0x254298, 0xFFFFFFFF, 0x6D8600, 0x3600258, 0x308944B, 0x300B261, 0x1241289,
+    0x1258659, 0x291510, 0x4C4C0, 0x400600, 0x44CC000, 0x1243889, 0xFFFFFFFF, 0x269B200, 0x26C0092, 0xFFFFFFFF, 0x249842, 0x12432CB,
+    0xFFFFFFFF, 0x64A253, 0x660049, 0xFFFFFFFF, 0x249289, 0x30CB2C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x424B203, 0xFFFFFFFF, 0x6092E1, 0xFFFFFFFF,
+    0x1B049, 0xFFFFFFFF, 0x12A2249, 0x3018648, 0xFFFFFFFF, 0xFFFFFFFF, 0x3403260, 0x32488C8, 0xFFFFFFFF, 0x18404D8, 0xFFFFFFFF, 0x311618,
+    0xFFFFFFFF, 0x324830A, 0x4252402, 0xFFFFFFFF, 0xFFFFFFFF, 0xC44B, 0x1888649, 0xFFFFFFFF, 0x5A303, 0x83320, 0x61825B, 0x92DB,
+    0x26124C0, 0xFFFFFFFF, 0x3618418, 0x603490, 0xFFFFFFFF, 0xFFFFFFFF, 0x368024B, 0x16414A0, 0xFFFFFFFF, 0x12404D8, 0xB321, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x200C2D8, 0x640C2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1242518, 0xFFFFFFFF, 0x6494A0,
+    0xD2690, 0x4900E1, 0x3289049, 0xFFFFFFFF, 0x3840248, 0x4661200, 0x308024B, 0x26C8083, 0x41B260, 0x2608C8, 0x3499600, 0x32E0248,
+    0x32480DA, 0x151A400, 0x11A243, 0x994A0, 0x44C003, 0x16D0648, 0x4C61A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x292689, 0x4849202,
+    0x1294448, 0xFFFFFFFF, 0x6006A2, 0x44B483, 0xFFFFFFFF, 0xFFFFFFFF, 0x3603418, 0xFFFFFFFF, 0x1241888, 0x304909B, 0xFFFFFFFF, 0xCC280,
+    0x40A518, 0x12C3649, 0x1249603, 0x2109490, 0x131824A, 0x310B248, 0x3890018, 0x18D2002, 0x30841B, 0x304B0D8, 0x24500, 0xFFFFFFFF,
+    0x4249200, 0xFFFFFFFF, 0xFFFFFFFF, 0x3258, 0x6E2400, 0x3080018, 0xFFFFFFFF, 0x3019200, 0xD8, 0x320248, 0x3249491, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2600D8, 0x205B418, 0xFFFFFFFF, 0xD8080, 0x3251202, 0x16612C0, 0x8030B, 0xA45A, 0xFFFFFFFF, 0xFFFFFFFF, 0x20030D8,
+    0x2652448, 0x8C218, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4A28C, 0x2509200, 0x248C600, 0x61884A, 0xC9491, 0xFFFFFFFF, 0x6109B,
+    0x1850018, 0x30C9649, 0x9321, 0x1318018, 0x4C2CB, 0x4241253, 0x600911, 0x2000, 0x125948A, 0x21710, 0x1649818, 0x425C200,
+    0x3011258, 0x60B24C, 0x304930A, 0xFFFFFFFF, 0x3600510, 0x36C00C2, 0x2480010, 0x1488, 0x130DB, 0x511488, 0x4240119, 0x3000063,
+    0x1721200, 0x2498403, 0xFFFFFFFF, 0xFFFFFFFF, 0x3080848, 0x20C301B, 0x612449, 0x3080C9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x119260,
+    0x4C9200, 0xFFFFFFFF, 0xC981A, 0xFFFFFFFF, 0xFFFFFFFF, 0x1849649, 0x2489810, 0x6D1488, 0x340924C, 0xFFFFFFFF, 0x6244B, 0xFFFFFFFF,
+    0x4E2600, 0xFFFFFFFF, 0x16D00C0, 0x490010, 0xFFFFFFFF, 0x248403, 0xFFFFFFFF, 0x1244C, 0xFFFFFFFF, 0xFFFFFFFF, 0x849310, 0x698291,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3248010, 0xFFFFFFFF, 0x61311, 0x1241309, 0x124C202, 0xFFFFFFFF, 0x209204C, 0xFFFFFFFF, 0xFFFFFFFF, 0x1858000,
+    0x30B01A, 0xFFFFFFFF, 0x2A1649, 0x2500003, 0x24C488, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6600C3, 0xFFFFFFFF, 0x24930C, 0x30C3000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30002DA, 0x12D2600, 0x4D9083, 0x1850C, 0xFFFFFFFF, 0x164061B, 0x4253000, 0x2049248, 0x1258003,
+    0xA499, 0xDA6C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x603061, 0x6C0061, 0xFFFFFFFF, 0x3109018, 0xFFFFFFFF, 0xFFFFFFFF, 0x1244250, 0x2,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x683291, 0x260003, 0x6182E0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C0000, 0x262600, 0x619302,
+    0x64A658, 0xFFFFFFFF, 0xFFFFFFFF, 0x720003, 0x9861B, 0x340004C, 0xFFFFFFFF, 0xFFFFFFFF, 0x5924B, 0x2480059, 0xFFFFFFFF, 0x319300,
+    0xFFFFFFFF, 0x28910C0, 0x20C3618, 0x1499240, 0x16890C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x848449, 0x1488602, 0x3291400, 0x30D804B, 0x1312203,
+    0x34C4240, 0x200C800, 0x409693, 0x82711, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x300310B, 0x14A3002, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x109691, 0xFFFFFFFF, 0x3488490, 0x6D9242, 0xFFFFFFFF, 0xFFFFFFFF, 0x24B002, 0xFFFFFFFF, 0x1303049, 0x24C90C0,
+    0xFFFFFFFF, 0x4A0109, 0x604300, 0x1858, 0x3049119, 0x2092649, 0xFFFFFFFF, 0x59018, 0x4300098, 0x30B610, 0x11900, 0xFFFFFFFF,
+    0x4006C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x30B059, 0x32C9840, 0x2A4248, 0xFFFFFFFF, 0x249909, 0x60061B, 0x1252403, 0xFFFFFFFF, 0x652649,
+    0x30008D9, 0x20C128C, 0x60004B, 0x42D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x62818, 0x1849458, 0x4D90C9, 0x1258602, 0x1B10B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x421292, 0x3509000, 0x3488260, 0x2603049, 0x3602248, 0x8480D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C00A2, 0x510600, 0x325B600,
+    0x30A2248, 0x3012413, 0x49, 0x14858, 0xC9511, 0x4C900, 0xFFFFFFFF, 0x30224C0, 0xFFFFFFFF, 0x116D0, 0x128C403, 0x403049,
+    0xFFFFFFFF, 0x364824B, 0x210A300, 0xFFFFFFFF, 0x6490C0, 0xFFFFFFFF, 0x328A243, 0x8128C, 0x468C, 0xFFFFFFFF, 0x492308, 0xFFFFFFFF,
+    0x2480092, 0x30C0258, 0xFFFFFFFF, 0x305C000, 0x20024CC, 0xFFFFFFFF, 0x692240, 0x449061, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3294000, 0x1243600, 0x1889059, 0xFFFFFFFF, 0x3602018, 0x4A4400, 0xFFFFFFFF, 0x124304B, 0xFFFFFFFF, 0x12924C8, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x609618, 0xFFFFFFFF, 0xFFFFFFFF, 0xC92E1, 0xFFFFFFFF, 0x24B602, 0x9224A, 0xFFFFFFFF, 0x1319448, 0x44A0080, 0x490094, 0x12C4289,
+    0xFFFFFFFF, 0x12592D8, 0xFFFFFFFF, 0x65C0C0, 0x42420C0, 0x20CC2C0, 0x1244508, 0xFFFFFFFF, 0xFFFFFFFF, 0x3248083, 0xFFFFFFFF, 0x1841258,
+    0xFFFFFFFF, 0x1C840, 0xFFFFFFFF, 0xFFFFFFFF, 0x424C440, 0x692010, 0x4DA240, 0x1C289, 0xC08CB, 0x4C01B, 0x148841B, 0x253261,
+    0xFFFFFFFF, 0x3049603, 0x2001719, 0xFFFFFFFF, 0x18C9218, 0x3021603, 0xFFFFFFFF, 0x340C218, 0x1508649, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x225A400, 0xFFFFFFFF, 0x14888C8, 0xFFFFFFFF, 0x92018, 0x6C3258, 0x3240692, 0x16400DB, 0xFFFFFFFF, 0xFFFFFFFF, 0x94618,
+    0x621210, 0x44884C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x4891200, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x360C600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4309202, 0x20C3, 0x19498, 0xFFFFFFFF, 0x848000, 0x3011300, 0x2052508, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3081488, 0xFFFFFFFF, 0x24800D3, 0xFFFFFFFF, 0xFFFFFFFF, 0x34026C8, 0x48400C2, 0x3001703, 0x300C600, 0x61824A, 0x92C2,
+    0x2912CB, 0xFFFFFFFF, 0x2019318, 0xFFFFFFFF, 0xFFFFFFFF, 0x2064600, 0xFFFFFFFF, 0xFFFFFFFF, 0x14880D0, 0x6018D8, 0x44C6C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x261B248, 0xFFFFFFFF, 0x329A200, 0x92848, 0xFFFFFFFF, 0xCA900, 0x42400C3, 0x24A061, 0x1851488, 0x1249263, 0x6D92C0,
+    0x2093243, 0x3260003, 0x3018400, 0x3649648, 0xFFFFFFFF, 0x13030D0, 0x324B240, 0xFFFFFFFF, 0x41B248, 0x918018, 0xFFFFFFFF, 0xC148B,
+    0x32480CC, 0xFFFFFFFF, 0x252843, 0x185B240, 0xC210, 0x1C888, 0x8C801B, 0x1652449, 0x830D8, 0x18580C2, 0x42A1080, 0x24603,
+    0xFFFFFFFF, 0x4250061, 0x30C3680, 0xFFFFFFFF, 0x1259200, 0x50C600, 0x288C200, 0x20CC200, 0x3024200, 0x1250908, 0x3049080, 0xDB300,
+    0x424044C, 0x4300000, 0xFFFFFFFF, 0x125B240, 0xFFFFFFFF, 0xFFFFFFFF, 0x490461, 0x148B4C0, 0x92059, 0xFFFFFFFF, 0x64925B, 0x1640121,
+    0xFFFFFFFF, 0x10A508, 0x258908, 0xA2109, 0x2112218, 0x3080000, 0x3308003, 0x1840061, 0xC9, 0x1301300, 0x3418618, 0x708291,
+    0x201B01B, 0xFFFFFFFF, 0x60930B, 0x3403848, 0x324A490, 0xFFFFFFFF, 0xFFFFFFFF, 0x3011900, 0xFFFFFFFF, 0xFFFFFFFF, 0xC06D8, 0xFFFFFFFF,
+    0x18430C9, 0x3019690, 0x986D8, 0x304941B, 0xFFFFFFFF, 0xFFFFFFFF, 0x1489243, 0x1240063, 0x618848, 0x3849242, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3004309, 0x4313000, 0x2109248, 0x340A489, 0x310B003, 0x361B002, 0x684258, 0x32914C0, 0xB909, 0x3243061, 0xD2218, 0x719248,
+    0x3011240, 0x124050C, 0x3013, 0x24CA2C0, 0x200C309, 0x858000, 0xFFFFFFFF, 0x60C259, 0x6C9248, 0x3112202, 0xFFFFFFFF, 0x300005C,
+    0x1859800, 0x2493, 0x3403618, 0x2883003, 0x3609298, 0x3010109, 0x301B000, 0x1900449, 0x1A883, 0x651249, 0xFFFFFFFF, 0x2501240,
+    0x251860, 0x94308, 0xFFFFFFFF, 0x661300, 0x590DB, 0x301A482, 0x258000, 0x9690, 0x188B000, 0xFFFFFFFF, 0x3311003, 0x4888600,
+    0x603840, 0xA124C, 0x3061013, 0x1509258, 0xFFFFFFFF, 0x3009294, 0x1240893, 0x130044C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x25B061,
+    0xFFFFFFFF, 0x30490C3, 0xFFFFFFFF, 0x15086C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x12586C2, 0x18613, 0x128B000, 0xFFFFFFFF, 0x248891, 0x60A48B,
+    0x92092, 0x3840600, 0x1289461, 0x3080603, 0x2E3003, 0x4C1240, 0x621298, 0xFFFFFFFF, 0x2004240, 0xFFFFFFFF, 0x20D8603, 0x2606D0,
+    0x99858, 0x510109, 0x1292200, 0x5A488, 0x4C06C3, 0x4D9059, 0xFFFFFFFF, 0xFFFFFFFF, 0x1294800, 0x32602C8, 0x149A480, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1640049, 0xFFFFFFFF, 0x603059, 0x1240660, 0x21294, 0xFFFFFFFF, 0x4B898, 0xFFFFFFFF, 0x1850603, 0x1244240,
+    0x2109848, 0x310B600, 0x4B2DA, 0x4A2480, 0x20496D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x648049, 0xFFFFFFFF, 0x248660, 0xFFFFFFFF, 0x3610,
+    0xFFFFFFFF, 0x36020C0, 0x63109, 0x858603, 0x98603, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xC264C, 0xFFFFFFFF, 0x2018260, 0x24B6C0, 0xFFFFFFFF, 0x182C8, 0xC3660, 0xFFFFFFFF, 0x2500260, 0x2049000, 0xFFFFFFFF, 0x292253,
+    0x1289119, 0x49064, 0x424A4C0, 0x12C9508, 0x4508, 0xC1508, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x601289, 0x304A242, 0x4489218,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30CC003, 0x61809B, 0x1303602, 0xFFFFFFFF, 0x4C0C9, 0xFFFFFFFF, 0x60070B, 0xFFFFFFFF, 0x6DA248,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x30216C0, 0x260, 0x3491218, 0x32412D2, 0x360030A, 0x59000, 0x912240, 0x2860, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x26CA018, 0x1661448, 0x4C0260, 0xFFFFFFFF, 0x130A240, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x301825B, 0x709, 0x293600, 0x189C000,
+    0x499280, 0x409448, 0x328B480, 0x99889, 0x1A0D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x62803, 0x614289, 0xFFFFFFFF, 0x1309109, 0x324A500,
+    0x2D4448, 0x10944C, 0x30C9213, 0x348824B, 0x29A800, 0x492DA, 0xFFFFFFFF, 0x698649, 0x3024600, 0x30E1600, 0x212D8, 0x4240858,
+    0x36C0248, 0xFFFFFFFF, 0xFFFFFFFF, 0x14843, 0xFFFFFFFF, 0x2009321, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x24B260, 0x93488, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C8248, 0x42580D0, 0x301801B, 0x3092, 0x13709, 0xFFFFFFFF, 0x3000692,
+    0x25144A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C830B, 0x301A061, 0x611488, 0x18308, 0x1889602, 0x16D024A, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x6C041B, 0x21649, 0x324B300, 0x300A450, 0x601888, 0xFFFFFFFF, 0x22512C3, 0xFFFFFFFF, 0x65904C, 0x851210,
+    0x30C1700, 0x618698, 0xFFFFFFFF, 0xFFFFFFFF, 0x200A6D1, 0xFFFFFFFF, 0xFFFFFFFF, 0xA12C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x40024B, 0xFFFFFFFF,
+    0x4318000, 0x862, 0xFFFFFFFF, 0xD3642, 0x360B800, 0xFFFFFFFF, 0xFFFFFFFF, 0x622450, 0xFFFFFFFF, 0x4920C3, 0x42430D0, 0x14912C0,
+    0x30C0018, 0x18694, 0xFFFFFFFF, 0x2003860, 0x3098018, 0x301B400, 0x30B083, 0x3843248, 0xFFFFFFFF, 0x308324B, 0x330B240, 0xFFFFFFFF,
+    0x330B, 0xFFFFFFFF, 0xC4498, 0x2311200, 0x30034C0, 0x184C600, 0x61A000, 0x22453, 0x32E00C0, 0x1292280, 0x680848, 0x30C9800,
+    0x284B248, 0x384A440, 0x8C9488, 0x3601253, 0xFFFFFFFF, 0x603698, 0x6C324A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x94603,
+    0x6C00CC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1840010, 0x1240121, 0x1A000, 0xFFFFFFFF, 0x3600119, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x321200, 0x3418000, 0x2624200, 0xFFFFFFFF, 0xFFFFFFFF, 0x3698, 0xFFFFFFFF, 0xFFFFFFFF, 0x848013, 0x409818, 0x600403, 0xFFFFFFFF,
+    0x21202, 0x652440, 0x2C8908, 0x860403, 0x1849810, 0x449649, 0x18908, 0x3249302, 0xFFFFFFFF, 0x14A0000, 0x301B680, 0x3488618,
+    0xCA443, 0x3602600, 0x3449248, 0x1700003, 0x84318, 0x619242, 0x1889083, 0xFFFFFFFF, 0x2501300, 0xFFFFFFFF, 0x894DA, 0x1300063,
+    0xFFFFFFFF, 0x1642498, 0x5244B, 0xFFFFFFFF, 0x12414D1, 0xFFFFFFFF, 0x131B010, 0x3609802, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x125C480,
+    0xFFFFFFFF, 0x18C0000, 0x44D1400, 0x60B682, 0x8A1, 0x3403000, 0x2604300, 0x4926C0, 0xFFFFFFFF, 0x918003, 0x4480, 0xFFFFFFFF,
+    0x20012A4, 0x3309240, 0x692602, 0xFFFFFFFF, 0x1253003, 0x1310000, 0x8C8003, 0x84B400, 0x692049, 0x30D0109, 0x205C640, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1488449, 0x253292, 0x2849240, 0x46124B, 0x24C9018, 0x3253448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x10848, 0x2930C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x92603, 0xFFFFFFFF, 0x1319800, 0x49918, 0x12C3061, 0xFFFFFFFF, 0x1259690, 0x14D101A, 0x310C240,
+    0x4A30C0, 0xFFFFFFFF, 0x12448C0, 0x3490049, 0xFFFFFFFF, 0x2260603, 0xFFFFFFFF, 0x3012480, 0xFFFFFFFF, 0x4250, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3289848, 0x99240, 0x14D14C0, 0x1B061, 0xFFFFFFFF, 0xFFFFFFFF, 0x30144C0, 0x2498049, 0x3840490, 0xC06C9, 0x26C82C8,
+    0x20C4243, 0x603002, 0x1240602, 0xFFFFFFFF, 0x652489, 0x3253218, 0x2291848, 0x124004C, 0x44C24B, 0x6D4240, 0x18A1010, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x14A004B, 0xA8D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x1640493, 0x4909000, 0x30C2308, 0x6C3059, 0x3062250, 0x310C010, 0xFFFFFFFF,
+    0x24804C, 0x2586C3, 0x1304240, 0xFFFFFFFF, 0x1299291, 0xFFFFFFFF, 0x36C0098, 0x12DC240, 0xFFFFFFFF, 0xFFFFFFFF, 0xD4240, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2483, 0x224B04C, 0xC3613, 0x324A248, 0xFFFFFFFF, 0x84243, 0x34A3, 0xFFFFFFFF, 0x2A1291, 0x26C8098, 0xFFFFFFFF,
+    0x2483049, 0xB21B, 0xFFFFFFFF, 0x2609508, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C0094, 0x618602, 0x34024C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x3449603,
+    0x28C9003, 0x2109003, 0xFFFFFFFF, 0xFFFFFFFF, 0x2021460, 0xFFFFFFFF, 0xFFFFFFFF, 0x12524D0, 0x24C9059, 0x164128C, 0x4242018, 0x2542D0,
+    0x12402C8, 0x125A248, 0xC96D8, 0xFFFFFFFF, 0x612E0, 0x699289, 0x124961B, 0x6C9003, 0x6D8098, 0x4241498, 0xFFFFFFFF, 0x25A4D0,
+    0x3488308, 0x3490648, 0x128944C, 0x309224A, 0x41B603, 0xFFFFFFFF, 0x4850, 0x1261448, 0x64B880, 0x8D9003, 0x1840094, 0x25161B,
+    0x99843, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x859289, 0xFFFFFFFF, 0x9928C, 0xC9000, 0xFFFFFFFF, 0x30012D2, 0xFFFFFFFF, 0x603602,
+    0x313218, 0xC32C8, 0x3083092, 0xFFFFFFFF, 0x4C9448, 0x98709, 0xFFFFFFFF, 0x6524C8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x190C000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x65A240, 0xFFFFFFFF, 0x20496C0, 0x365A400, 0x304B480, 0x649613, 0x49025B, 0xFFFFFFFF, 0xFFFFFFFF, 0x1259498,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3012849, 0x2052460, 0xFFFFFFFF, 0xFFFFFFFF, 0x324824A, 0x708649, 0xFFFFFFFF, 0xFFFFFFFF, 0x14A3,
+    0x64B092, 0x484001A, 0x3001658, 0xFFFFFFFF, 0x12492D0, 0x921A, 0x3403649, 0xFFFFFFFF, 0x84841B, 0xFFFFFFFF, 0x908, 0x192D4,
+    0xC04DB, 0xFFFFFFFF, 0x30020C0, 0x600258, 0x124041B, 0x4481488, 0x48404C0, 0xFFFFFFFF, 0x30030E1, 0x2512D3, 0x96C3, 0x2109603,
+    0xD830A, 0xFFFFFFFF, 0xFFFFFFFF, 0x602294, 0x30D84C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x301001B, 0x30CA450, 0x6C02A1, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x719049, 0xFFFFFFFF, 0x911210, 0xFFFFFFFF, 0xFFFFFFFF, 0x3248018, 0x493648, 0xFFFFFFFF, 0x124C218, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x324A618, 0x4249810, 0x36C9202, 0x920C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2480858, 0xFFFFFFFF, 0x3400294, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x59493, 0x25421A, 0x613248, 0xFFFFFFFF, 0x22600C3, 0xFFFFFFFF, 0x30018D1, 0xFFFFFFFF, 0xFFFFFFFF, 0x188824B, 0xFFFFFFFF,
+    0x150801B, 0x300964C, 0x3291648, 0x125801A, 0x21883, 0xFFFFFFFF, 0xFFFFFFFF, 0x301C2C0, 0x204A289, 0x9B308, 0xFFFFFFFF, 0x3422440,
+    0x4A1488, 0xFFFFFFFF, 0x18, 0x4641258, 0x510018, 0x493418, 0xFFFFFFFF, 0x3010848, 0x609261, 0xFFFFFFFF, 0x2910400, 0x36026C0,
+    0x1661200, 0x4C001B, 0x2491258, 0xFFFFFFFF, 0x3248848, 0x200301B, 0x12C1303, 0x3018002, 0x3080, 0x3400064, 0xDA000, 0x5A843,
+    0xFFFFFFFF, 0x2604C3, 0x1918400, 0xFFFFFFFF, 0x64B0D8, 0x34D8000, 0x1499258, 0x2498449, 0xFFFFFFFF, 0x1C491, 0xFFFFFFFF, 0x848461,
+    0x908010, 0x30D1300, 0x6C0400, 0x34030C3, 0x49094, 0x6301B, 0x3021802, 0x610908, 0xC880, 0xFFFFFFFF, 0x4B692, 0x18CA440,
+    0xFFFFFFFF, 0x4494D9, 0xC2C3, 0xFFFFFFFF, 0x2618061, 0xFFFFFFFF, 0x3509248, 0x6180C0, 0xFFFFFFFF, 0x2603291, 0x3602490, 0x148B0C9,
+    0x1240908, 0xFFFFFFFF, 0xC0403, 0xFFFFFFFF, 0x8D2440, 0xFFFFFFFF, 0x260848, 0x622442, 0x30630C0, 0x2001240, 0x522D0, 0x1841250,
+    0x6A4200, 0x2891, 0xFFFFFFFF, 0x128C648, 0x164B680, 0x248908, 0x61125B, 0x180C2, 0xC3461, 0xD9253, 0xFFFFFFFF, 0x119649,
+    0xFFFFFFFF, 0x21122C0, 0xC18C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x601640, 0xFFFFFFFF, 0x3049018, 0x293061, 0xFFFFFFFF, 0x201B0C0, 0x36D3000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x300C249, 0x603683, 0x1251300, 0x218C0, 0xFFFFFFFF, 0x361804B, 0x63291, 0x124328C,
+    0x30494C0, 0x4610D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x3452203, 0x601520, 0x1302880, 0xFFFFFFFF, 0xFFFFFFFF, 0x42402CB, 0x24B84A, 0x92490,
+    0x304B500, 0x1B003, 0x200361B, 0x33006C0, 0x24B28C, 0x1900610, 0xFFFFFFFF, 0x6490DA, 0xDA600, 0x40981B, 0x301804B, 0x30A880,
+    0x3404240, 0x32482C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x2481689, 0x919240, 0xFFFFFFFF, 0xDC640, 0x12A10D0, 0x3004299, 0x908610, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x128C300, 0xE1802, 0x2D1690, 0x1243618, 0x4E2200, 0x2922C0, 0xFFFFFFFF, 0x490D3, 0x36C0602, 0xFFFFFFFF, 0x130004C,
+    0x13106C0, 0xFFFFFFFF, 0x64083, 0xFFFFFFFF, 0x2490600, 0xFFFFFFFF, 0x64B000, 0x129A258, 0x33110C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x1302092,
+    0xFFFFFFFF, 0x709002, 0x36182C8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x164C249, 0x689292, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x324809B, 0x12A1449, 0xFFFFFFFF, 0x30C001A, 0x611840, 0x186C0, 0x654800, 0xFFFFFFFF, 0x85A480, 0xFFFFFFFF, 0xFFFFFFFF, 0x291061,
+    0xFFFFFFFF, 0x4C010, 0x109013, 0x600660, 0x304961A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6000A2, 0x604240, 0x304905C, 0x1313049,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x124128B, 0x14400, 0x3061449, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C304C, 0x1258098, 0x14D1003, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1240709, 0xFFFFFFFF, 0x1388A, 0x3244289, 0x42408C8, 0x24928C, 0x259900, 0x98, 0x1262418, 0xFFFFFFFF,
+    0x662640, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x224B260, 0xFFFFFFFF, 0xFFFFFFFF, 0x2482248, 0x3082C8, 0xFFFFFFFF, 0xC4850, 0x324B488,
+    0x30920D0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2251448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1253260, 0xFFFFFFFF, 0xFFFFFFFF, 0x8C9840,
+    0x300C618, 0xFFFFFFFF, 0x92E1, 0x24848, 0xFFFFFFFF, 0x4C291, 0xFFFFFFFF, 0x603492, 0xFFFFFFFF, 0x292302, 0xFFFFFFFF, 0xE1283,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2851203, 0x26012D2, 0xFFFFFFFF, 0xFFFFFFFF, 0x20C92D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x4491600, 0xD0092, 0x42400DA,
+    0xFFFFFFFF, 0x261448, 0xFFFFFFFF, 0xC201B, 0xFFFFFFFF, 0x8532C0, 0x3018418, 0x932C3, 0x16A4000, 0x3248691, 0xFFFFFFFF, 0x3003649,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x652249, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C1658, 0x2912, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x26D2400,
+    0x2489213, 0xA1218, 0x24C9600, 0x16D0080, 0x4C05C, 0x3002500, 0x8C448, 0x44B480, 0x130041B, 0xCB261, 0x61890, 0x1489498,
+    0x6000E4, 0xFFFFFFFF, 0x224C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1444C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x30C92C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x36180D0, 0x24988B, 0xFFFFFFFF, 0x3400248, 0xFFFFFFFF, 0xFFFFFFFF, 0x330801A, 0xFFFFFFFF,
+    0x9824B, 0x130C210, 0x3249488, 0x2898018, 0x24B8C8, 0xFFFFFFFF, 0x26E0, 0xFFFFFFFF, 0x3251200, 0x7092C8, 0x3018680, 0x301B248,
+    0x284801B, 0x461603, 0x1294218, 0xFFFFFFFF, 0x30180CC, 0x8C21B, 0xFFFFFFFF, 0x4488400, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x258248,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x609202, 0x2109260, 0x310B018, 0xE1880, 0x413643, 0x600918, 0xFFFFFFFF,
+    0x304C488, 0x3680291, 0xFFFFFFFF, 0x301125B, 0x249658, 0x46400C3, 0x13000D0, 0xFFFFFFFF, 0x36030D0, 0x858018, 0xFFFFFFFF, 0x9801B,
+    0x1885B, 0x3249250, 0xFFFFFFFF, 0x412509, 0x83248, 0xFFFFFFFF, 0x3840848, 0x4842600, 0x3261640, 0x4C148B, 0x93302, 0x911,
+    0xC04C3, 0xFFFFFFFF, 0x1488013, 0x11A840, 0xFFFFFFFF, 0xFFFFFFFF, 0x3848003, 0xFFFFFFFF, 0x20186D8, 0x30C00C3, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xC9260, 0x4C659, 0x3009860, 0xFFFFFFFF, 0xFFFFFFFF, 0x384A049, 0xD9310, 0x44A0000, 0x248400, 0xFFFFFFFF, 0x1259258, 0x304C258,
+    0xFFFFFFFF, 0xE1092, 0x1491802, 0x12402E0, 0xFFFFFFFF, 0xFFFFFFFF, 0x3248003, 0x4244640, 0x4300059, 0xFFFFFFFF, 0x12586C0, 0x2248848,
+    0x3121080, 0x2C8061, 0x3014648, 0x308449, 0x385B, 0xC084B, 0xFFFFFFFF, 0x424924B, 0x24C48A, 0xFFFFFFFF, 0x3294, 0x2881243,
+    0x324C640, 0x34522C0, 0x254203, 0x98291, 0x4481240, 0x293018, 0x3251802, 0x30002DC, 0xFFFFFFFF, 0x2721, 0xFFFFFFFF, 0xD80C3,
+    0xFFFFFFFF, 0x5B4C0, 0x12D204B, 0xFFFFFFFF, 0xFFFFFFFF, 0x2309300, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C0063, 0x29A218, 0xFFFFFFFF,
+    0x4A2D2, 0xFFFFFFFF, 0x6014D3, 0x125A04C, 0x6DB010, 0xFFFFFFFF, 0x493403, 0x2DA04B, 0x60924C, 0x1425B, 0x648061, 0x1511800,
+    0xFFFFFFFF, 0x4C0003, 0xFFFFFFFF, 0x3493000, 0x649080, 0xFFFFFFFF, 0x858618, 0x1840449, 0x4289403, 0x3054249, 0xD3291, 0xFFFFFFFF,
+    0x14914C8, 0x2604A0, 0x3660049, 0x13121, 0x64B0C3, 0x709680, 0x3001689, 0x36486C0, 0x24E1, 0x130A488, 0x519249, 0x401918,
+    0x32890D8, 0x4C9800, 0xFFFFFFFF, 0x4480490, 0xFFFFFFFF, 0x4994C8, 0x20C14D1, 0x1243000, 0x9B0C0, 0x3848049, 0xFFFFFFFF, 0x4A1243,
+    0x41C300, 0x3021210, 0x304A25A, 0x3409292, 0x261804C, 0x683061, 0x1703000, 0x619690, 0x891010, 0xFFFFFFFF, 0x4C0E1, 0xFFFFFFFF,
+    0x6032E0, 0x2052818, 0x1303059, 0x3248603, 0xFFFFFFFF, 0x1702480, 0x124080, 0x3649018, 0x31C240, 0x648891, 0x360B218, 0x113450,
+    0x8361B, 0x129C, 0x144C3, 0xFFFFFFFF, 0x4241508, 0xFFFFFFFF, 0x1858049, 0x14D10C9, 0x130A258, 0xFFFFFFFF, 0x4042A1, 0x3019842,
+    0x600610, 0x32DC, 0x32C9289, 0xFFFFFFFF, 0x409460, 0x24802CB, 0x30C304B, 0x3049003, 0xFFFFFFFF, 0xD86C2, 0x4253600, 0x86004B,
+    0x449294, 0x1B119, 0x23448, 0x3251283, 0x2021849, 0xFFFFFFFF, 0xFFFFFFFF, 0x12818, 0x3421448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x30494A0, 0x659291, 0xE2488, 0x2DA648, 0x60984B, 0x9401B, 0x3052802, 0xFFFFFFFF, 0x403600, 0x4C0603, 0x26004C,
+    0x2649, 0xFFFFFFFF, 0x4902C8, 0x400493, 0xFFFFFFFF, 0xFFFFFFFF, 0x13032C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x720049, 0xFFFFFFFF, 0x428C002,
+    0x4689, 0xC00A2, 0xFFFFFFFF, 0xFFFFFFFF, 0x2480094, 0x150B, 0x9849, 0x32492D8, 0xD8490, 0x309824B, 0x264C0C0, 0xFFFFFFFF,
+    0xA858, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1243603, 0x9B6C0, 0xC3109, 0xFFFFFFFF, 0x2311448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x22512D8, 0xFFFFFFFF, 0x424064B, 0xFFFFFFFF, 0x60961B, 0x13049, 0xFFFFFFFF, 0xFFFFFFFF, 0x34496C0, 0xFFFFFFFF, 0x12424C9, 0xFFFFFFFF,
+    0xCA300, 0xFFFFFFFF, 0x3609213, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C0311, 0x324030B, 0xFFFFFFFF, 0xFFFFFFFF, 0x911280, 0x364904B, 0x1A248,
+    0x64B490, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C0000, 0x12D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x2CC289, 0xFFFFFFFF, 0xFFFFFFFF, 0x30D8418, 0x224830B,
+    0x324A0C3, 0x42492C2, 0x3009210, 0x30C3648, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000918, 0x860648, 0x3021618, 0x61A01B, 0x462243,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x10C059, 0xFFFFFFFF, 0xA2688, 0x1319218,
+    0x330024B, 0x71C000, 0xFFFFFFFF, 0x621218, 0x1301888, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x125A0C3, 0x1262403, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x20CA500, 0x6092C0, 0xFFFFFFFF, 0x4512000, 0x6496C0, 0x49030A, 0x1843648, 0xFFFFFFFF, 0x6216C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2480691, 0x30C3418, 0x3841488, 0x21213, 0x652458, 0x30032A1, 0x251493, 0xFFFFFFFF, 0x311049, 0x48400C9, 0x8C824B,
+    0x84B648, 0x11B480, 0x4E1200, 0x125841B, 0x2908018, 0xFFFFFFFF, 0x1700018, 0x3018509, 0xFFFFFFFF, 0x3848680, 0x3109400, 0x164148B,
+    0x250C200, 0x4889240, 0x31824B, 0x13649, 0xFFFFFFFF, 0x5245B, 0xFFFFFFFF, 0x2580D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x3249203, 0x400860,
+    0x3000013, 0x124A840, 0x891098, 0x18248, 0x4900D0, 0x3609259, 0x3018403, 0xFFFFFFFF, 0x1264210, 0x2112448, 0x324B243, 0xFFFFFFFF,
+    0x418692, 0x6A3240, 0x4498, 0x2A2289, 0x32480C2, 0xFFFFFFFF, 0x1134C0, 0x9948B, 0x9649, 0xFFFFFFFF, 0x4C603, 0x848858,
+    0x692059, 0x61801A, 0x3400908, 0xD92C0, 0x3252442, 0x20C4488, 0x254880, 0xFFFFFFFF, 0x384B010, 0xFFFFFFFF, 0x3600848, 0x148948A,
+    0x1240294, 0x44C490, 0x2930D8, 0xFFFFFFFF, 0x20094DA, 0x300B292, 0x9261A, 0xFFFFFFFF, 0xFFFFFFFF, 0x15080C3, 0xFFFFFFFF, 0x24885B,
+    0x261203, 0x18010, 0xFFFFFFFF, 0xD2448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C1700, 0xFFFFFFFF, 0x16E0018, 0x3003403, 0x17180C0,
+    0xFFFFFFFF, 0x1309649, 0xC125B, 0x4934C0, 0x330A600, 0x2481258, 0x9925B, 0x1918002, 0x12898C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x2491300,
+    0x30D9800, 0xFFFFFFFF, 0xFFFFFFFF, 0x4925B, 0xFFFFFFFF, 0x60301B, 0x311649, 0xFFFFFFFF, 0x22630C0, 0x61648, 0x698003, 0x4CA443,
+    0x44C260, 0xFFFFFFFF, 0x6534C0, 0xFFFFFFFF, 0x1700618, 0x602498, 0x210924B, 0xFFFFFFFF, 0xFFFFFFFF, 0x4241240, 0xFFFFFFFF, 0x20490DB,
+    0x2248000, 0xD221B, 0xFFFFFFFF, 0x4243840, 0x248064, 0x12430C3, 0xFFFFFFFF, 0x131A049, 0x2C884B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x130C0, 0x3249240, 0x3260610, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6494D1, 0x709080, 0x20C3003, 0x84258, 0x30C250,
+    0x322049, 0x12890D8, 0x2501243, 0x41B291, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2512A2, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x291698, 0x4C648, 0xFFFFFFFF, 0x603848, 0xFFFFFFFF, 0xFFFFFFFF, 0x2910D8, 0x1509243, 0x148C640, 0x60328C, 0x1240891, 0x1259243,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4300602, 0x348A480, 0xFFFFFFFF, 0xFFFFFFFF, 0x4240492, 0x10B0C0, 0x261803, 0x102DA, 0xFFFFFFFF,
+    0x64C418, 0x26C06C0, 0xFFFFFFFF, 0x261249, 0x304B109, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C1243, 0x263840, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3248492, 0xFFFFFFFF, 0x721240, 0x10C, 0xFFFFFFFF, 0xC129C, 0x1292202, 0x5A48B, 0x20D8049, 0x2848603, 0x9460, 0x64C300,
+    0xD9689, 0x2500490, 0x603618, 0xFFFFFFFF, 0xA48C, 0xC0720, 0x3611289, 0x1489850, 0x1240663, 0x6C004C, 0x304C013, 0xC4300,
+    0x200C460, 0x64248, 0x69804C, 0x125B610, 0x29C800, 0xFFFFFFFF, 0x610CC, 0x412648, 0xFFFFFFFF, 0x449121, 0xFFFFFFFF, 0x310B049,
+    0xFFFFFFFF, 0x248661, 0xFFFFFFFF, 0x361A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24C243, 0x1243109, 0x622648, 0xC004B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x32A1003, 0x320049, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000094, 0x84858, 0x24D9, 0xFFFFFFFF, 0x649510, 0x401903,
+    0xFFFFFFFF, 0x2049003, 0xFFFFFFFF, 0xFFFFFFFF, 0x128910B, 0xFFFFFFFF, 0xFFFFFFFF, 0x258600, 0xFFFFFFFF, 0x6D0490, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x64013, 0x121003, 0x2109618, 0xFFFFFFFF, 0x42D4000, 0xFFFFFFFF, 0x68304C, 0x2489280, 0x1259842, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x6032CB, 0x2052803, 0xFFFFFFFF, 0x2604289, 0x3603488, 0xFFFFFFFF, 0xFFFFFFFF, 0x1240318, 0x108DA, 0x32DC000, 0xFFFFFFFF, 0x1491280,
+    0x83600, 0x1258708, 0xFFFFFFFF, 0xFFFFFFFF, 0x4689600, 0xFFFFFFFF, 0x24B490, 0x3893, 0x18098, 0xFFFFFFFF, 0x2004843, 0x2E3049,
+    0x253218, 0x32CB, 0x3401889, 0x64A300, 0xFFFFFFFF, 0x12C92D8, 0x260708, 0x6CC0C0, 0x293049, 0xFFFFFFFF, 0x2294000, 0x300B200,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1640649, 0x3009661, 0x603659, 0x61944B, 0x12803, 0x21898, 0xE144A, 0xFFFFFFFF, 0x603098,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3600698, 0x36C024A, 0x3012403, 0xFFFFFFFF, 0xFFFFFFFF, 0x648649, 0xFFFFFFFF, 0xFFFFFFFF, 0x2490248,
+    0x623203, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x264904C, 0x9348A, 0xFFFFFFFF, 0xC0648, 0x2A4003, 0x164C448, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4DB, 0xFFFFFFFF, 0xDA018, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x320083, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C8308, 0x12D2400, 0x251B,
+    0x1830B, 0x23203, 0x34C3248, 0xFFFFFFFF, 0x30184C3, 0x3488018, 0xFFFFFFFF, 0xFFFFFFFF, 0x3602003, 0x849498, 0x601889, 0xFFFFFFFF,
+    0x304A840, 0xCC448, 0xFFFFFFFF, 0x2DA403, 0x30CC600, 0x61B258, 0x13100D8, 0xC92CC, 0xFFFFFFFF, 0x148A0C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3683248, 0x490083, 0x3609202, 0x3009319, 0x93258, 0x452292, 0xFFFFFFFF, 0xD3649, 0xFFFFFFFF, 0x4303240, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C0860, 0x610248, 0x291602, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x248918, 0x60A502, 0x180DB,
+    0x16D0018, 0x34C3018, 0x3308680, 0x600603, 0xFFFFFFFF, 0xFFFFFFFF, 0x3248510, 0x4992C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x61A003, 0x340C203,
+    0xCC21A, 0xFFFFFFFF, 0xFFFFFFFF, 0x20D80C0, 0x312289, 0x24CB000, 0x498D9, 0x62289, 0x10C04B, 0x92000, 0xA513, 0x448A049,
+    0x129C600, 0xFFFFFFFF, 0xFFFFFFFF, 0x20E2440, 0x6C00D0, 0x32400C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x4303010, 0x1240123, 0x6D84C0, 0xFFFFFFFF,
+    0x53698, 0xFFFFFFFF, 0x259318, 0x623249, 0x18461, 0x13180C9, 0xFFFFFFFF, 0x3001253, 0xFFFFFFFF, 0x9B802, 0x22480C3, 0xFFFFFFFF,
+    0x491310, 0x3018063, 0x3019640, 0x30DA, 0x3404258, 0x652448, 0x30006D3, 0x24800C0, 0xFFFFFFFF, 0x3200C9, 0x1890A, 0x3600000,
+    0x5A2D2, 0xFFFFFFFF, 0x12500C0, 0xFFFFFFFF, 0xCA442, 0x3860000, 0x2024203, 0x10925B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x659649,
+    0x4A0291, 0x14A2049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x148A6C0, 0x60130C, 0x1910000, 0xC312, 0xC930B, 0x40084B,
+    0xFFFFFFFF, 0x3648618, 0xFFFFFFFF, 0x114D4, 0xFFFFFFFF, 0x360924B, 0xFFFFFFFF, 0x262440, 0x8A4, 0x13030C9, 0x1289083, 0xFFFFFFFF,
+    0x2494D1, 0x124B292, 0xFFFFFFFF, 0xFFFFFFFF, 0x3081243, 0x30004A3, 0x1842880, 0x2602E0, 0xC203, 0x1310003, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x830C0, 0x3900, 0xFFFFFFFF, 0x291083, 0xFFFFFFFF, 0x20C02DA, 0xFFFFFFFF, 0x61A603, 0xFFFFFFFF, 0xCC810, 0x1641243, 0xFFFFFFFF,
+    0x4889010, 0xFFFFFFFF, 0xFFFFFFFF, 0x261B003, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x92600, 0x6D1300, 0xFFFFFFFF, 0x3121010, 0xFFFFFFFF,
+    0x1851243, 0x210A488, 0x18003, 0x32406C0, 0xFFFFFFFF, 0x331A200, 0x12432E0, 0x349004B, 0x64B848, 0xFFFFFFFF, 0xFFFFFFFF, 0x2492A3,
+    0x1244309, 0xFFFFFFFF, 0x226004C, 0x164A489, 0x3001850, 0xFFFFFFFF, 0xFFFFFFFF, 0x14D4080, 0x64810C, 0xFFFFFFFF, 0x848613, 0x802DA,
+    0x36D0, 0x32CC240, 0xFFFFFFFF, 0x70A2C0, 0xFFFFFFFF, 0x603000, 0x9B298, 0xFFFFFFFF, 0xFFFFFFFF, 0x3600602, 0x2502480, 0xFFFFFFFF,
+    0x4D94C0, 0x1B509, 0xFFFFFFFF, 0x84A092, 0x109858, 0x259240, 0x2848490, 0xCA488, 0xFFFFFFFF, 0x14886C9, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xA2489, 0x64901B, 0x65C248, 0xFFFFFFFF, 0x248049, 0x6044C9, 0x13000A2, 0x22708, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2053443,
+    0xFFFFFFFF, 0x23700, 0x2308600, 0xFFFFFFFF, 0x80664, 0x30D4400, 0x3661000, 0x512480, 0x3609280, 0xFFFFFFFF, 0x3648092, 0x8E3,
+    0xC0492, 0xFFFFFFFF, 0x49013, 0x3003660, 0x4C2480, 0xC803, 0x3841289, 0xFFFFFFFF, 0xFFFFFFFF, 0x30030A2, 0xFFFFFFFF, 0x125304C,
+    0x18719, 0xD82CB, 0x5B6C8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2003320, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x48C00C0,
+    0x4488648, 0x65C018, 0xFFFFFFFF, 0x258490, 0x12418A0, 0xFFFFFFFF, 0xCC298, 0x1299061, 0x22940C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x18602,
+    0x649843, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x324A01B, 0x4249210, 0x2498A0, 0x364C010, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2260649, 0x26C9448, 0x30124C0, 0x940C0, 0x4289049, 0x26092D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x808DA, 0x2498648, 0xFFFFFFFF, 0xC3889,
+    0x325121A, 0xFFFFFFFF, 0x2649109, 0x3719, 0x19508, 0xC32CB, 0xFFFFFFFF, 0x848094, 0xFFFFFFFF, 0x9B2C9, 0xB494, 0xFFFFFFFF,
+    0x4B883, 0x2509218, 0x258260, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x424024B, 0x3098308, 0x30C1300, 0x31A410, 0x304B482, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x24864B, 0xFFFFFFFF, 0xFFFFFFFF, 0x2600308, 0xFFFFFFFF, 0x3092010, 0xFFFFFFFF, 0x262018, 0xFFFFFFFF, 0xFFFFFFFF, 0x659109,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x130C000, 0xFFFFFFFF, 0x360C440, 0xFFFFFFFF, 0x12492C0, 0xFFFFFFFF, 0x2612400, 0x36092C2,
+    0xFFFFFFFF, 0x4C14A0, 0x36480D8, 0x1264280, 0xC3098, 0xFFFFFFFF, 0x30020C3, 0x254448, 0x314003, 0xFFFFFFFF, 0x4843080, 0x59109,
+    0x40A68B, 0x28C9600, 0xC283, 0x4489203, 0x38580C0, 0x8488C8, 0x148B648, 0x2049490, 0xFFFFFFFF, 0x6D9218, 0xFFFFFFFF, 0x848308,
+    0x10A689, 0x12408CB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x18D1600, 0xFFFFFFFF, 0x6042D8, 0x6C9603, 0xFFFFFFFF, 0x324801A, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x92683, 0x6C9049, 0xFFFFFFFF, 0x360C210, 0x85A400, 0x4C024B, 0x261250, 0x899218, 0x6492C8, 0x4000DB, 0x250001B,
+    0x3019818, 0x6212C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x4900400, 0x18400D8, 0x28DA000, 0x124C6C0, 0x6D024B, 0x16D2003, 0x40A440, 0xFFFFFFFF,
+    0x834D9, 0xFFFFFFFF, 0x291490, 0xD80D0, 0x84B240, 0x184A442, 0x602064, 0xFFFFFFFF, 0xC330A, 0x3908400, 0x2D12C3, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3489258, 0x6DA003, 0x424084A, 0xFFFFFFFF, 0x1718018, 0x12400D0, 0xFFFFFFFF, 0x2609203, 0x4B308, 0x852450, 0x60A840,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x148B300, 0xFFFFFFFF, 0xFFFFFFFF, 0x1261800, 0x649092, 0x360A440, 0x2480DB, 0x12CC200,
+    0x1900013, 0xFFFFFFFF, 0xFFFFFFFF, 0x52508, 0x2481640, 0x60C2C9, 0x14E4, 0xFFFFFFFF, 0x42C9249, 0x30000C3, 0x345B400, 0x30C1250,
+    0x9261, 0xFFFFFFFF, 0xFFFFFFFF, 0x18C00C0, 0x3291418, 0x30D9640, 0x30DC200, 0xC30D8, 0xE1202, 0x64600, 0x600294, 0x1243018,
+    0x1300000, 0xFFFFFFFF, 0x1508848, 0x36C0002, 0x30C0119, 0x125B400, 0xC2C9, 0x509092, 0xFFFFFFFF, 0x3010618, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3061080, 0xFFFFFFFF, 0xFFFFFFFF, 0x24B018, 0x3648000, 0x6C4480, 0xFFFFFFFF, 0x3248618, 0x15200C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x293,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3000449, 0x1841253, 0x124C259, 0x899800, 0x1B240, 0x200384B, 0x2500618, 0x24B4C3, 0x92109, 0x180C3,
+    0x654203, 0x324A092, 0x2CA6C8, 0x814D4, 0x3651800, 0x6D0848, 0xC4483, 0x3084258, 0x20C12A1, 0x601643, 0x4D80C0, 0x22440,
+    0xCC202, 0xFFFFFFFF, 0x1658003, 0x2049860, 0x125861A, 0x23460, 0xD8119, 0xFFFFFFFF, 0x10C013, 0x4C4300, 0x1251303, 0x218D0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x10A498, 0x600509, 0x31B018, 0xFFFFFFFF, 0x3244258, 0x4243449, 0x12C2498, 0x63, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1854240, 0x2664, 0x125B0C0, 0x649691, 0x70924A, 0xFFFFFFFF, 0x2486C0, 0x3680, 0xFFFFFFFF, 0x6490D8,
+    0x491300, 0xFFFFFFFF, 0x12C9690, 0x30C2, 0x6D0618, 0x128A2C3, 0xFFFFFFFF, 0x30006C0, 0x30C1850, 0x9863, 0xFFFFFFFF, 0x23086C0,
+    0x3082480, 0xFFFFFFFF, 0x908602, 0x92A2, 0x1311240, 0x8C9243, 0x8484A0, 0x109248, 0x124361A, 0x619240, 0x2922C3, 0xFFFFFFFF,
+    0x1489689, 0x69B000, 0x124305C, 0x2064018, 0x24CA250, 0x4240659, 0x614C3, 0x12D8049, 0xFFFFFFFF, 0xC309, 0x294300, 0x53450,
+    0x12C06C0, 0x24B61A, 0x93842, 0xFFFFFFFF, 0x30610C2, 0x3300490, 0xFFFFFFFF, 0x24B05C, 0x3186C0, 0xC3002, 0x3240320, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1A260, 0x652202, 0x2C86C3, 0x300304C, 0xFFFFFFFF, 0xFFFFFFFF, 0x186C3, 0x2308490, 0x330A248,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x49461, 0x3449003, 0x600661, 0xFFFFFFFF, 0xFFFFFFFF, 0xC1909, 0xFFFFFFFF, 0x4A0049,
+    0x60168C, 0x89292, 0xA4800, 0xFFFFFFFF, 0xFFFFFFFF, 0x61293, 0xFFFFFFFF, 0x124128C, 0xFFFFFFFF, 0x225A418, 0x3121000, 0x1701840,
+    0x9082C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x42C0649, 0xFFFFFFFF, 0x248263, 0x204A300, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4243488, 0xFFFFFFFF,
+    0x25C4C0, 0x14D3049, 0xFFFFFFFF, 0xD8603, 0x424B200, 0xFFFFFFFF, 0x2054680, 0xFFFFFFFF, 0xFFFFFFFF, 0x3260258, 0x18C0260, 0x248712,
+    0x36C3, 0xFFFFFFFF, 0xD2309, 0x128A8C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x46E0, 0xFFFFFFFF, 0x128A302, 0x30814A0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3694000, 0x1643600, 0xFFFFFFFF, 0x1849280, 0x6C3602, 0xFFFFFFFF, 0xD9508, 0x4C293, 0xFFFFFFFF, 0x28CA240,
+    0x130064B, 0x649000, 0xFFFFFFFF, 0xFFFFFFFF, 0x64680, 0x12DB202, 0x319840, 0x64B600, 0xFFFFFFFF, 0x851283, 0x30212D0, 0x2596D0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2891049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1258311, 0xC3610, 0x20124C3, 0x2C9289, 0x24B09B, 0x308092,
+    0xFFFFFFFF, 0x652800, 0x200188C, 0x300364B, 0x24950B, 0x314, 0x2251218, 0xFFFFFFFF, 0xFFFFFFFF, 0x41C289, 0x30C0083, 0xFFFFFFFF,
+    0x13092D0, 0xFFFFFFFF, 0x2291049, 0xFFFFFFFF, 0xFFFFFFFF, 0x2848248, 0xFFFFFFFF, 0x494A0, 0x4A0649, 0x300A840, 0x603262, 0x190B200,
+    0x3240248, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x36512C0, 0x6D0308, 0xFFFFFFFF, 0x129904C, 0xFFFFFFFF, 0x4300018, 0x60944A, 0x14D1600,
+    0xFFFFFFFF, 0x36012C0, 0xFFFFFFFF, 0x2049320, 0x12438C8, 0x14D1049, 0x42C3248, 0x26C00D8, 0xFFFFFFFF, 0x1243311, 0xFFFFFFFF, 0x384001B,
+    0xFFFFFFFF, 0x3308010, 0x3003418, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xD0308, 0x8DA010, 0xFFFFFFFF, 0x2600C0, 0x26E2, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x5B480, 0x301B243, 0x124A510, 0x2124, 0xFFFFFFFF, 0xFFFFFFFF, 0x2501488, 0xFFFFFFFF, 0x46D0010, 0xFFFFFFFF, 0xC1718,
+    0x3089818, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C890, 0x84A0C3, 0x185001B, 0x6182A1, 0xFFFFFFFF, 0x29C218,
+    0x49024A, 0x6800D8, 0x36D8010, 0x6192C0, 0x1303248, 0xFFFFFFFF, 0xFFFFFFFF, 0x24965B, 0x1240521, 0x46400C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x8512C2, 0x112061, 0xFFFFFFFF, 0x148B, 0x131B080, 0x128B24B, 0xFFFFFFFF, 0xFFFFFFFF, 0x30D0291, 0xFFFFFFFF, 0xFFFFFFFF, 0x308084B,
+    0x330B400, 0x301B018, 0x36480C3, 0x192C0, 0xC3083, 0x26C80C2, 0x40131B, 0x30C0680, 0x44C600, 0xB24C, 0x652280, 0x129244A,
+    0x3000513, 0x8A458, 0x1253061, 0x1B303, 0x16D3240, 0x4B092, 0x30980C0, 0xFFFFFFFF, 0x1259818, 0x6D9203, 0x3424200, 0x4A3248,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x12449, 0x1303018, 0x4700000, 0x2D2500, 0x36C3010, 0x205221B, 0x30490E1, 0x22502, 0x36002E0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4D2449, 0x14D1648, 0x6D80C9, 0x128B018, 0xFFFFFFFF, 0x12C30D8, 0x261253, 0x3840618, 0xFFFFFFFF, 0x308061B, 0x1662440,
+    0x4C1258, 0x6E1, 0xFFFFFFFF, 0x26098C0, 0xFFFFFFFF, 0x4026C8, 0x3019250, 0x4D9648, 0x29301B, 0xD8683, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x261700, 0x30D30C0, 0x18513, 0xD80C0, 0x5B4C2, 0x20C3291, 0x301B289, 0x304B000, 0xFFFFFFFF, 0x1640061, 0x8480C9, 0x909250,
+    0xFFFFFFFF, 0x61A440, 0x448B002, 0xE2440, 0x84A6C0, 0x691308, 0x1241689, 0x169B400, 0x18A1080, 0x490848, 0x610E1, 0xFFFFFFFF,
+    0x609259, 0x100C0, 0x4658049, 0xFFFFFFFF, 0x109308, 0x3011858, 0xFFFFFFFF, 0x1261802, 0x128924B, 0xFFFFFFFF, 0x184044C, 0x24C25A,
+    0x3064, 0x1261249, 0x4840600, 0x26C9242, 0x3000660, 0x168C248, 0x14D1, 0x6D0003, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x11B400,
+    0x3086C0, 0x182E0, 0xFFFFFFFF, 0x1488610, 0xFFFFFFFF, 0xFFFFFFFF, 0x3513, 0x19302, 0x4A658, 0xFFFFFFFF, 0x258618, 0xFFFFFFFF,
+    0x1A320, 0xC9860, 0x4240602, 0x30986C0, 0x602880, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4B0C0, 0x201C300, 0x3010603, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x34490C3, 0x24B000, 0x1259299, 0xFFFFFFFF, 0x1289018, 0x129C248, 0xFFFFFFFF, 0xFFFFFFFF, 0x304A700,
+    0xFFFFFFFF, 0x42C1289, 0x70B003, 0xFFFFFFFF, 0xFFFFFFFF, 0x144D1, 0xFFFFFFFF, 0xFFFFFFFF, 0x4249848, 0xFFFFFFFF, 0x3648490, 0x1968C,
+    0x1C24C, 0xD9242, 0x400109, 0x3019849, 0x720, 0x32E3, 0xFFFFFFFF, 0xDB840, 0x18C2480, 0x3019289, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xD86C0, 0xFFFFFFFF, 0x40A489, 0x60264C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1508049, 0x62258, 0x69A203, 0x619460, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x409909, 0xFFFFFFFF, 0x61A482, 0x293500, 0x510603, 0x4A313, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C, 0x648661,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x260049, 0x305224B, 0xFFFFFFFF, 0x2003603, 0x400490, 0x12C1900, 0x262649, 0x1261848, 0xC0661,
+    0xFFFFFFFF, 0x3002248, 0xFFFFFFFF, 0x30928B, 0x6D0600, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000683, 0x83891, 0xFFFFFFFF, 0x188E0, 0xFFFFFFFF,
+    0x2C9900, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x19902, 0xFFFFFFFF, 0xFFFFFFFF, 0x3009448, 0x908049, 0xFFFFFFFF, 0xFFFFFFFF, 0x360201B,
+    0x1488094, 0xFFFFFFFF, 0xFFFFFFFF, 0x61A248, 0x3848083, 0x4B6C0, 0x1658260, 0xFFFFFFFF, 0x8A4D2, 0x1909280, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x24B603, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x360921A, 0x401840, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C0318, 0xFFFFFFFF, 0x660260,
+    0x5961B, 0xFFFFFFFF, 0x3649049, 0xFFFFFFFF, 0xFFFFFFFF, 0x4920D8, 0x3309218, 0xFFFFFFFF, 0x270C000, 0x291618, 0xD8260, 0x4249880,
+    0x300149B, 0xFFFFFFFF, 0xFFFFFFFF, 0xC3492, 0x4944C, 0x2D144B, 0x3009213, 0x600648, 0x9B490, 0xFFFFFFFF, 0xFFFFFFFF, 0x5C0C0,
+    0x2480308, 0xFFFFFFFF, 0x462240, 0x2252688, 0xFFFFFFFF, 0xFFFFFFFF, 0x602692, 0xFFFFFFFF, 0x9514, 0xFFFFFFFF, 0x32512C9, 0x3449490,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xA521, 0xFFFFFFFF, 0x1644289, 0x1493200, 0x2492400, 0x649, 0x210B480, 0x29A298, 0xFFFFFFFF, 0x3012459,
+    0x26064B, 0xFFFFFFFF, 0x6CC000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6092D3, 0x321218, 0xFFFFFFFF, 0x341801B, 0x49B203, 0x149A402,
+    0x309888, 0x22480DB, 0xC3258, 0x3900018, 0xFFFFFFFF, 0x3019658, 0x30D9203, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x260509, 0x305C049, 0x1310248, 0xFFFFFFFF, 0x3001700, 0xFFFFFFFF, 0x92C9, 0xFFFFFFFF, 0xCA458, 0x8484C3, 0x344A840, 0xFFFFFFFF,
+    0x30D80D0, 0xFFFFFFFF, 0xCB480, 0x4A6E0, 0x14880DA, 0xFFFFFFFF, 0x61A291, 0x13643, 0xFFFFFFFF, 0x4240683, 0xFFFFFFFF, 0x260400,
+    0x6C9210, 0xFFFFFFFF, 0x26180C0, 0x2C8248, 0xFFFFFFFF, 0xFFFFFFFF, 0x1824A, 0x3240908, 0x2308018, 0x18C001B, 0x24B083, 0x30D1258,
+    0x1259309, 0x3248683, 0x4242109, 0x6892C0, 0xFFFFFFFF, 0x60C6C0, 0x3841258, 0x32480C9, 0x3081258, 0x201B248, 0x2481488, 0x1321,
+    0xC218, 0x8C8018, 0x70C080, 0x3009813, 0x693640, 0x1251488, 0x291098, 0xD92C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x248B800, 0x3049648,
+    0x461260, 0xFFFFFFFF, 0xFFFFFFFF, 0x3019309, 0x6000D3, 0xFFFFFFFF, 0x4489640, 0x492003, 0x4243010, 0x1491200, 0x8B8C8, 0xFFFFFFFF,
+    0xCA6D0, 0xFFFFFFFF, 0x3300848, 0x1493800, 0x308403, 0x18018, 0xFFFFFFFF, 0x26C00C3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2249243,
+    0x29A2C0, 0x1512440, 0xFFFFFFFF, 0x24A898, 0xC2, 0xC125A, 0x32E0000, 0x12A1258, 0x859258, 0x609312, 0x12E4200, 0xFFFFFFFF,
+    0x648121, 0xFFFFFFFF, 0xFFFFFFFF, 0x818D2, 0x2848000, 0xC32A1, 0xFFFFFFFF, 0x201A498, 0x3019689, 0x3649300, 0x4703, 0xC1700,
+    0x3600618, 0x61649, 0x18D80C0, 0x1241643, 0x98CC, 0xFFFFFFFF, 0xDB0D0, 0xFFFFFFFF, 0x30C1309, 0xFFFFFFFF, 0x9309, 0xCA4A0,
+    0xFFFFFFFF, 0x848510, 0x9080C2, 0x1243680, 0xFFFFFFFF, 0xFFFFFFFF, 0x8E00C0, 0x248063, 0x4C9309, 0xFFFFFFFF, 0xC0003, 0xFFFFFFFF,
+    0x164924C, 0x300B508, 0xFFFFFFFF, 0xFFFFFFFF, 0x18848, 0x3249243, 0x424010B, 0x17030C0, 0x2709018, 0x249B, 0xC204C, 0x324B840,
+    0xFFFFFFFF, 0x20C3000, 0x262490, 0xFFFFFFFF, 0xC4640, 0x3081858, 0x1488000, 0x24804A0, 0xFFFFFFFF, 0x44C9, 0xC14D3, 0xFFFFFFFF,
+    0x6141B, 0x252889, 0xFFFFFFFF, 0x188B018, 0x4482480, 0x4C649, 0x201810C, 0x861240, 0x1259803, 0x2109018, 0xC3510, 0x490002,
+    0x2500109, 0x204A48B, 0xFFFFFFFF, 0x304C243, 0xFFFFFFFF, 0x3603449, 0x2022489, 0x600112, 0x893000, 0xFFFFFFFF, 0x8CB0C0, 0x42D8600,
+    0x4300049, 0xFFFFFFFF, 0x12586C9, 0xFFFFFFFF, 0x4904A0, 0x709418, 0xFFFFFFFF, 0x30844C, 0x18059, 0xFFFFFFFF, 0x3602308, 0x3092258,
+    0x689690, 0x6CC, 0x3289, 0x64A2C3, 0x128A488, 0xFFFFFFFF, 0x1841689, 0x2606C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x2898049, 0xFFFFFFFF,
+    0x260109, 0x270C, 0x6D1240, 0xC901B, 0x4C418, 0xFFFFFFFF, 0x60361A, 0xFFFFFFFF, 0x21859, 0xFFFFFFFF, 0x164004C, 0x300230B,
+    0x184B448, 0x314248, 0xC4302, 0x3600659, 0x3089849, 0xFFFFFFFF, 0x30CB218, 0x3110C0, 0xFFFFFFFF, 0x360009B, 0x4240260, 0x185004C,
+    0xFFFFFFFF, 0x14D1403, 0x232D8, 0x42C3600, 0x3009508, 0x1704240, 0xFFFFFFFF, 0x31B440, 0x2600320, 0xFFFFFFFF, 0xFFFFFFFF, 0x24C240,
+    0x124310B, 0xFFFFFFFF, 0x21210C0, 0xFFFFFFFF, 0x721010, 0xFFFFFFFF, 0x32A1000, 0xC2649, 0xFFFFFFFF, 0x12A2640, 0x3010709, 0x301B602,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x651849, 0x401900, 0x24B10B, 0xFFFFFFFF, 0xFFFFFFFF, 0x1889003, 0x3248708, 0x30020D8, 0x119291, 0xFFFFFFFF,
+    0xC849, 0x22648, 0xFFFFFFFF, 0x30046C8, 0xFFFFFFFF, 0x611900, 0xC29B, 0x188B049, 0x490600, 0xFFFFFFFF, 0xFFFFFFFF, 0x618098,
+    0x304B260, 0x291119, 0x4C0CC, 0x30092D8, 0x600712, 0x12DB600, 0xFFFFFFFF, 0xD3603, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1840,
+    0x6C9618, 0x510260, 0xFFFFFFFF, 0x1491283, 0xFFFFFFFF, 0x125B2C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x404843, 0xFFFFFFFF, 0x124A688, 0x3889,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x4016D3, 0x24831B, 0x2499218, 0xFFFFFFFF, 0x4480248, 0xDA248, 0x30008C8, 0x824C9, 0x4D8092, 0xFFFFFFFF,
+    0x130C280, 0x16D2018, 0x84A248, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3691049, 0x49890, 0x3312400, 0x25A413, 0x6C0648, 0x304C610,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1300258, 0x310904B, 0x129C003, 0x851448, 0x698092, 0x6188C8, 0x1318648,
+    0x3698248, 0xFFFFFFFF, 0x412691, 0xFFFFFFFF, 0x14289, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24B262, 0x1243708, 0xFFFFFFFF, 0xC064B,
+    0xFFFFFFFF, 0x70A240, 0x2E024B, 0xFFFFFFFF, 0x309B, 0xFFFFFFFF, 0xFFFFFFFF, 0x4243300, 0x30C0248, 0x16896C0, 0x188CB, 0x2261488,
+    0xFFFFFFFF, 0x30000DB, 0x1849213, 0xFFFFFFFF, 0xFFFFFFFF, 0x654448, 0x18C00D8, 0xFFFFFFFF, 0x24820C3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1488083, 0x4D8308, 0xFFFFFFFF, 0xFFFFFFFF, 0x522010, 0xFFFFFFFF, 0x20C9261, 0x2489880, 0x891602, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1096C0, 0xFFFFFFFF, 0x891049, 0x32DA000, 0x1289603, 0x54448, 0x12C00D8, 0x1240918, 0x12592C3, 0xFFFFFFFF, 0x660248,
+    0x3002003, 0x1494440, 0x1888, 0xFFFFFFFF, 0x4840400, 0x42430C0, 0x3309203, 0x8364C, 0x30B648, 0x1869B, 0xD824A, 0x2C80DB,
+    0x5B648, 0x24B4D8, 0xFFFFFFFF, 0x130A289, 0x2309488, 0x4042D2, 0xFFFFFFFF, 0x30C2049, 0xFFFFFFFF, 0xFFFFFFFF, 0x324B0D0, 0x300090A,
+    0x30034C3, 0xFFFFFFFF, 0xFFFFFFFF, 0xC1321, 0xFFFFFFFF, 0x62849, 0x4C3308, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x164324B, 0xFFFFFFFF,
+    0x4212C0, 0x28480C0, 0xA503, 0x292508, 0x49318, 0x361C200, 0x69B248, 0x621200, 0x6C00D3, 0x42C0061, 0xFFFFFFFF, 0x1494202,
+    0x12C9203, 0x124C600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2649649, 0x2490291, 0x308858, 0x6CA442, 0x324A440, 0x2C9488, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x308293, 0x1948A, 0xFFFFFFFF, 0x4858000, 0x44D1080, 0x30C084A, 0x9B259, 0xC00CC, 0x128A2D8, 0x3003291, 0x24800C2,
+    0xFFFFFFFF, 0x1B4C0, 0xC26C8, 0x3082498, 0xFFFFFFFF, 0xFFFFFFFF, 0x619818, 0x1258400, 0x3860002, 0x1643018, 0x2019303, 0x301B0C2,
+    0xFFFFFFFF, 0x44830C0, 0xFFFFFFFF, 0x3300000, 0x40C2C0, 0x60448A, 0x400, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x614D8, 0x1853000,
+    0x891648, 0x3052603, 0xFFFFFFFF, 0x490680, 0x3000000, 0xFFFFFFFF, 0x12598C0, 0xFFFFFFFF, 0x660848, 0x42D9240, 0x1843403, 0x262443,
+    0xFFFFFFFF, 0x19253, 0xFFFFFFFF, 0x12A3018, 0xFFFFFFFF, 0x610848, 0x3841243, 0x652218, 0x4843000, 0x3003063, 0x1498061, 0x130C,
+    0x186DA, 0xFFFFFFFF, 0xFFFFFFFF, 0x3009803, 0x2482490, 0x30DB000, 0xFFFFFFFF, 0x651690, 0x2311800, 0x344901B, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x4A0061, 0x149B0C0, 0x4312200, 0x318003, 0x3063000, 0x24E1400, 0xFFFFFFFF, 0x148A490, 0x1242898, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x40061B, 0x24B400, 0x30C9298, 0x6C3289, 0x3680490, 0x8D1249, 0x4242480, 0x1840613, 0xFFFFFFFF, 0x1A603,
+    0x42C4240, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xD8618, 0xFFFFFFFF, 0xFFFFFFFF, 0x264C248, 0x308890, 0x22486C0,
+    0x324A480, 0x848610, 0x2D1803, 0x24C8C0, 0x612648, 0x21803, 0xFFFFFFFF, 0x3080493, 0xFFFFFFFF, 0x301C242, 0x3049400, 0xC0109,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x98109, 0x206101B, 0xFFFFFFFF, 0xFFFFFFFF, 0x2024800, 0x1700600, 0x259243, 0xFFFFFFFF, 0xCA48B,
+    0xFFFFFFFF, 0x40C8C0, 0x248610, 0x1242092, 0xFFFFFFFF, 0x3240490, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x60C802, 0xFFFFFFFF, 0x513000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x258109, 0xFFFFFFFF, 0xFFFFFFFF, 0x2308603, 0x4906C2, 0xFFFFFFFF, 0xFFFFFFFF, 0x1249292, 0x2248490, 0x128C243,
+    0x3609283, 0x3289061, 0x932D8, 0x30C242, 0x3403049, 0x3080263, 0x49010, 0x4186C0, 0xFFFFFFFF, 0xC802, 0x1310603, 0xDB449,
+    0xFFFFFFFF, 0x251294, 0x30C0098, 0x44C018, 0x131004C, 0x1293442, 0x3098092, 0x20D9289, 0x61804B, 0xFFFFFFFF, 0xCA258, 0xFFFFFFFF,
+    0x3009283, 0x3018311, 0xFFFFFFFF, 0x2936C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x293109, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1854400, 0xFFFFFFFF, 0xFFFFFFFF, 0x648263, 0x490490, 0x109510, 0xFFFFFFFF, 0xFFFFFFFF, 0x2248260, 0x128C010, 0xFFFFFFFF,
+    0x264A243, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x201B600, 0x41B04C, 0x428904B, 0x13320, 0xFFFFFFFF, 0xD8659, 0xFFFFFFFF,
+    0x692400, 0x99289, 0x1B0A2, 0x294010, 0x4C403, 0x40310C, 0xFFFFFFFF, 0xFFFFFFFF, 0x4652400, 0x1312410, 0xFFFFFFFF, 0x1488248,
+    0xFFFFFFFF, 0x6C001A, 0x304C003, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1240092, 0xFFFFFFFF, 0xFFFFFFFF, 0x3254280, 0xFFFFFFFF, 0x692300,
+    0xFFFFFFFF, 0xA918, 0x6D9448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x248A4C0, 0x3602, 0x4640C0, 0xFFFFFFFF, 0x1511203, 0x689448,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xD3260, 0x12A1610, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3609880, 0x14924C0, 0x83263,
+    0x2709049, 0xFFFFFFFF, 0xC3659, 0x49610, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x292243, 0xFFFFFFFF, 0x20044A0, 0xFFFFFFFF, 0x30C3258,
+    0xB261, 0x2251261, 0x3254600, 0x32620C0, 0x64003, 0x30C00C9, 0xFFFFFFFF, 0xCA858, 0xFFFFFFFF, 0x424001B, 0x3009883, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x291109, 0x26C024B, 0x14884C0, 0x3010018, 0x61A688, 0xA2291, 0x26000D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x622403, 0xFFFFFFFF, 0x42404C0, 0xFFFFFFFF, 0x3013642, 0x124C21A, 0x1309213, 0x128C602, 0xFFFFFFFF, 0x85A402, 0xFFFFFFFF, 0x1259700,
+    0x12909, 0x1321600, 0x4249259, 0x1840691, 0x30C2003, 0x6212C0, 0xC1889, 0xFFFFFFFF, 0xFFFFFFFF, 0x251661, 0x94109, 0x311213,
+    0x6D0248, 0x341B248, 0x40A45B, 0xFFFFFFFF, 0x618418, 0x9494, 0xFFFFFFFF, 0xFFFFFFFF, 0x68024B, 0x603648, 0x3648308, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x492C8, 0x8480DA, 0x4C9491, 0x124324A, 0x6C1658, 0xFFFFFFFF, 0x4240848, 0x7120C0, 0x12400D3, 0x89024B, 0x2252500,
+    0xFFFFFFFF, 0x36000C9, 0xFFFFFFFF, 0x14A00D0, 0x125B098, 0xFFFFFFFF, 0x649648, 0x3092602, 0x248692, 0xFFFFFFFF, 0x2061, 0x2248064,
+    0x3602109, 0x360A442, 0x12CC218, 0xFFFFFFFF, 0x4C0, 0x2263018, 0x661488, 0x5250A, 0xFFFFFFFF, 0x263080, 0x6D0018, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x30000C2, 0x252450, 0x61148B, 0xA840, 0x292842, 0x32600C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x619200, 0x19309, 0xC30DA,
+    0xE1203, 0xFFFFFFFF, 0x2518D0, 0x9B0D8, 0x3841300, 0xFFFFFFFF, 0x308C200, 0x300B460, 0x30C010B, 0xC2C2, 0x1318403, 0xFFFFFFFF,
+    0x424005C, 0xFFFFFFFF, 0x6022DA, 0xFFFFFFFF, 0x3061083, 0xFFFFFFFF, 0x34490D8, 0x1090E1, 0x308010, 0xFFFFFFFF, 0xFFFFFFFF, 0x3248613,
+    0x26C8000, 0xFFFFFFFF, 0xFFFFFFFF, 0x1309810, 0x3241303, 0x661258, 0x522D8, 0x30C0002, 0x926C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x3263002,
+    0x3098000, 0x4C0291, 0x46CB000, 0x196A1, 0x3419243, 0x34C3000, 0x5C650, 0xFFFFFFFF, 0x2499249, 0x2249303, 0x3901240, 0x849253,
+    0x1840119, 0x30C4640, 0x4318, 0xC130C, 0x16D2049, 0xFFFFFFFF, 0x2481302, 0xFFFFFFFF, 0xA4203, 0xFFFFFFFF, 0x3601243, 0x3618610,
+    0x30A1800, 0xFFFFFFFF, 0x1125B, 0x3683003, 0x3603840, 0x54200, 0x32910D0, 0x12406D3, 0x304C083, 0x42C004C, 0x36006C2, 0x3301240,
+    0xFFFFFFFF, 0x1640, 0x125B680, 0xFFFFFFFF, 0x3600109, 0xFFFFFFFF, 0x6092A2, 0x125B0C2, 0x1B01A, 0xFFFFFFFF, 0xFFFFFFFF, 0x2486D3,
+    0x24B291, 0x3683, 0x12718, 0x2003061, 0x491302, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x128A2C0, 0x30006C2, 0x24800A2,
+    0x2630C2, 0xFFFFFFFF, 0xFFFFFFFF, 0x3082483, 0xFFFFFFFF, 0x184924B, 0x619803, 0x1254243, 0x24810, 0x49691, 0x680049, 0x600891,
+    0xFFFFFFFF, 0x6C0449, 0x3109403, 0x3603610, 0x851800, 0x12C1240, 0xFFFFFFFF, 0x3049293, 0xFFFFFFFF, 0x3600492, 0x64080, 0xFFFFFFFF,
+    0x1258890, 0x319243, 0x3064240, 0x53453, 0xFFFFFFFF, 0x24B618, 0x618109, 0xFFFFFFFF, 0xCA318, 0x401858, 0x63500, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xC3013, 0x2001843, 0xFFFFFFFF, 0x36C3080, 0x30C0600, 0x9B000, 0x1B843, 0x652200, 0x2018661, 0x41C243, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xC2483, 0x4B000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x16D0049, 0x3252418, 0x3449000, 0x8151A, 0x4D86C0,
+    0x21460, 0xC44C9, 0x30816D0, 0x4A004C, 0x248B218, 0x9C4C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x3600260, 0xFFFFFFFF, 0xFFFFFFFF, 0x12544C0,
+    0x14403, 0xFFFFFFFF, 0x54800, 0x148B488, 0x30C9280, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x400049, 0x3452800, 0x1240712, 0x661,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24929C, 0x2661003, 0x4242, 0xFFFFFFFF, 0xD8602, 0xFFFFFFFF, 0x3013490, 0x924D8, 0x18492,
+    0xFFFFFFFF, 0x2308260, 0xFFFFFFFF, 0x24B2D2, 0x270A240, 0xFFFFFFFF, 0x2880092, 0xFFFFFFFF, 0x409849, 0xFFFFFFFF, 0xB448, 0xFFFFFFFF,
+    0x3248311, 0x4A250, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x18A1000, 0x308921B, 0x62643, 0x3022400, 0x619840, 0x2912E0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x12C0260, 0x1243659, 0xFFFFFFFF, 0x649002, 0x325A402, 0xFFFFFFFF, 0x600314, 0x1243094, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x36C0083, 0x12D8092, 0x618708, 0xFFFFFFFF, 0x3249218, 0xFFFFFFFF, 0x2C8260, 0xFFFFFFFF, 0xFFFFFFFF, 0x19840, 0xC3603,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x328904C, 0x3490, 0x1A860, 0x42C0308, 0x499448, 0x6892D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x301A458, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3449600, 0x109610, 0x602248, 0xFFFFFFFF, 0xCA240, 0x3252450,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x12524C0, 0x6C0258, 0x324024B, 0x4242000, 0xFFFFFFFF, 0x124002, 0x892D8, 0x30490A2, 0xCC283, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x6184D8, 0xFFFFFFFF, 0x29C448, 0x42D8018, 0x18D2010, 0x603708, 0x12580E1, 0x224824B, 0x649260, 0xFFFFFFFF,
+    0x249888, 0x2661600, 0x3260, 0x3840018, 0xFFFFFFFF, 0x499213, 0x300341B, 0xFFFFFFFF, 0xE4, 0xFFFFFFFF, 0xD030B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x5B483, 0x18420C3, 0x2848018, 0xFFFFFFFF, 0xFFFFFFFF, 0x4A850, 0x848083,
+    0x30180D0, 0xA2000, 0x293482, 0x3240018, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6D00D8, 0x341B0C0, 0x20092C0, 0xFFFFFFFF,
+    0x252510, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1509488, 0x2DC600, 0x204A6D0, 0x1300691, 0xFFFFFFFF, 0xE12C9, 0x4A718, 0x854440,
+    0x12430E1, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C9203, 0x2480002, 0xFFFFFFFF, 0xFFFFFFFF, 0xD00D8, 0x324925A, 0xFFFFFFFF, 0x3289649,
+    0x938C0, 0x464A440, 0xC2064, 0x48500C0, 0x2019258, 0x248521, 0x3080DA, 0x192C3, 0x64A508, 0x200448B, 0x3003698, 0x30C0683,
+    0xB249, 0xFFFFFFFF, 0xFFFFFFFF, 0x5A6D0, 0x30030D0, 0x2512C0, 0x44C049, 0xFFFFFFFF, 0xCA843, 0x30980C3, 0x18E1200, 0x2538C0,
+    0xA6D1, 0xFFFFFFFF, 0x3240848, 0x4242600, 0x3010003, 0x6006E1, 0x125925A, 0x26000C3, 0x1299649, 0x3619250, 0x689203, 0x12DB018,
+    0xFFFFFFFF, 0x2092600, 0x3248000, 0x52283, 0xFFFFFFFF, 0x124C203, 0x4299248, 0x260A440, 0xFFFFFFFF, 0xFFFFFFFF, 0x185801A, 0x30D0061,
+    0x3708003, 0x324A049, 0xFFFFFFFF, 0x3891080, 0x2480848, 0x309488, 0xFFFFFFFF, 0x20000C0, 0x4026CB, 0x249313, 0x25164C, 0x123,
+    0xC2891, 0x1292210, 0x30002E0, 0x4C06D8, 0x1689308, 0xFFFFFFFF, 0x1B0D3, 0x1508000, 0x4253003, 0xFFFFFFFF, 0xFFFFFFFF, 0xA4A1,
+    0xFFFFFFFF, 0x26C0003, 0x63248, 0x3018112, 0x61A443, 0x2863000, 0xFFFFFFFF, 0x2920000, 0x409309, 0x20DB0C0, 0xFFFFFFFF, 0x125A061,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1098C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x2248618, 0xD125B, 0x8D4200, 0xFFFFFFFF, 0x114203, 0x204C, 0x126CB,
+    0x649083, 0x1511249, 0x418848, 0x2052491, 0x126124B, 0x320610, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x32A1018, 0x1250618, 0x188A1,
+    0xDB013, 0xFFFFFFFF, 0x11B402, 0x16890D8, 0xFFFFFFFF, 0x1C480, 0x3080891, 0x361004C, 0x24C700, 0x3510, 0x3848602, 0xFFFFFFFF,
+    0x20044D1, 0x30036C0, 0x90A600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x200C24C, 0x84A490, 0x6012A1, 0x4D9300, 0x23682, 0x24E1010,
+    0x4B0C3, 0x1659243, 0xFFFFFFFF, 0x4643600, 0x26006C3, 0x4700600, 0x26C1840, 0x689803, 0x6048C0, 0x13004A0, 0xFFFFFFFF, 0x128901A,
+    0x52883, 0xFFFFFFFF, 0x3649000, 0x1913000, 0xFFFFFFFF, 0x3248049, 0x522C3, 0xFFFFFFFF, 0x124C24B, 0x8914C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x201804C, 0x328C018, 0xFFFFFFFF, 0xFFFFFFFF, 0x29101B, 0x70A480, 0x2500049, 0x18406C0, 0x1692200, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x712200, 0x149B018, 0xFFFFFFFF, 0x6D0260, 0xFFFFFFFF, 0xFFFFFFFF, 0x2294018, 0x20DC240, 0xFFFFFFFF, 0xFFFFFFFF, 0xD8109, 0x8486C0,
+    0x344C018, 0x69A200, 0x6C0660, 0xFFFFFFFF, 0x26C0049, 0x14882CB, 0xFFFFFFFF, 0xFFFFFFFF, 0x125A649, 0xFFFFFFFF, 0x129C018, 0x1658490,
+    0x112200, 0xFFFFFFFF, 0x106C0, 0x510049, 0x493449, 0xFFFFFFFF, 0xFFFFFFFF, 0x12D9289, 0x10109, 0xFFFFFFFF, 0xFFFFFFFF, 0x2649061,
+    0x36C9000, 0x309842, 0xC0660, 0x6490C2, 0xFFFFFFFF, 0x184304B, 0xFFFFFFFF, 0xFFFFFFFF, 0xC4242, 0x2263049, 0x3262248, 0x1498260,
+    0x610493, 0x9C240, 0xFFFFFFFF, 0x653442, 0xFFFFFFFF, 0x1499289, 0x12D2418, 0xFFFFFFFF, 0x23218, 0xFFFFFFFF, 0x848490, 0x300944B,
+    0x4C9849, 0xFFFFFFFF, 0xFFFFFFFF, 0x490C3, 0x63049, 0x10A253, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12D8018,
+    0xFFFFFFFF, 0x1304C, 0xFFFFFFFF, 0x1643490, 0xFFFFFFFF, 0xFFFFFFFF, 0x1689000, 0xFFFFFFFF, 0xCA303, 0x709003, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1261618, 0x6E1003, 0x661840, 0x3002018, 0x25B109, 0x94291, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x29161A, 0x324A688, 0x2500649, 0x20D24C0, 0x1692800, 0xFFFFFFFF, 0xFFFFFFFF, 0x3252400, 0xFFFFFFFF, 0x301C448, 0x3322,
+    0x4902, 0xC0314, 0xFFFFFFFF, 0x20C12D2, 0x600092, 0x449891, 0x304904B, 0xFFFFFFFF, 0x8CB049, 0xFFFFFFFF, 0xFFFFFFFF, 0x4492DA,
+    0xFFFFFFFF, 0x225A403, 0x1644840, 0x1094A0, 0x12D20D0, 0x9201A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x148830A, 0x6030D3, 0x20616C0,
+    0xFFFFFFFF, 0x64A243, 0x52690, 0xFFFFFFFF, 0x12442D8, 0xFFFFFFFF, 0x3052848, 0x2618308, 0x493488, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1309049, 0xFFFFFFFF, 0x424C210, 0x149A400, 0xFFFFFFFF, 0x34904C0, 0xC4842, 0xFFFFFFFF, 0x2D1218, 0x600400, 0x613650, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x41830B, 0x2518248, 0xFFFFFFFF, 0x2252458, 0xFFFFFFFF, 0x3613248, 0x3000121, 0x30C12C0, 0x92D0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3449260, 0x1243648, 0xFFFFFFFF, 0xFFFFFFFF, 0x16D9600, 0x40C2D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x403, 0x3241488,
+    0x36004C0, 0x4243240, 0x90A0C0, 0x609661, 0xFFFFFFFF, 0xFFFFFFFF, 0x42400C9, 0x2C824B, 0x24B64B, 0x92291, 0x13020C0, 0x128964B,
+    0x4900DA, 0xFFFFFFFF, 0xFFFFFFFF, 0x262458, 0x3403018, 0x3114200, 0x34C0018, 0x26E2000, 0x691600, 0x4D8248, 0xFFFFFFFF, 0xDB418,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x30C0061, 0xFFFFFFFF, 0x13092C0, 0x260A500, 0x403308, 0x148A003, 0x18580D0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4C049, 0x12C001B, 0x600691, 0x6C024A, 0xFFFFFFFF, 0x3080121, 0xFFFFFFFF, 0x6000D0, 0x30C30C0, 0x3112C2, 0x448C200, 0x492000,
+    0x4243013, 0x8600D0, 0x92618, 0xFFFFFFFF, 0x648248, 0xFFFFFFFF, 0x2C8018, 0xFFFFFFFF, 0x38C80C0, 0xFFFFFFFF, 0x3243291, 0x491488,
+    0x36180C0, 0x4302049, 0x324B, 0x1A61B, 0x513248, 0x499202, 0x300084B, 0x6098D0, 0xC3, 0x1330B, 0x3689249, 0x201B018,
+    0xFFFFFFFF, 0x2600CC, 0x26C8, 0x30522C2, 0x4841240, 0x18C0291, 0x421203, 0x30C480, 0x125125B, 0x2181A, 0x1294203, 0x20C00C0,
+    0x24806C9, 0x30D9249, 0x3123, 0xC42C3, 0x360061A, 0x20C26C8, 0x30C18C0, 0x1240061, 0x34A0003, 0x294488, 0x360005C, 0x300C649,
+    0x30C1302, 0x9312, 0x291311, 0x306124A, 0x3300618, 0x30094C8, 0x6034C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xD2203, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3018, 0xC0000, 0x3249803, 0x3000613, 0x3013848, 0x92890, 0x8900C3, 0xC261B, 0x2308618, 0x3000059, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x490119, 0xFFFFFFFF, 0x24B0CC, 0x3080C0, 0x3709240, 0x32486C9, 0xFFFFFFFF, 0x40C203, 0x691649,
+    0x36490D0, 0xC81A, 0xC14D1, 0xFFFFFFFF, 0x1841300, 0x2489800, 0xFFFFFFFF, 0xC259, 0xC9249, 0x1293450, 0x861249, 0xFFFFFFFF,
+    0x348B000, 0x2910DA, 0xD9300, 0x8482E0, 0x300929B, 0x603291, 0x318618, 0x368004C, 0xFFFFFFFF, 0x3084300, 0x20CC249, 0x25C648,
+    0x61B680, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C861B, 0x418003, 0x61B0C2, 0x1240, 0xFFFFFFFF, 0x1508109, 0xFFFFFFFF, 0xFFFFFFFF, 0x384A,
+    0x11300, 0xD2491, 0x324B610, 0x42582C8, 0x2482DC, 0x32A1, 0x384004C, 0x32E0600, 0x52710, 0x330804B, 0x1122C0, 0x263289,
+    0xC12A3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2711, 0x6D1243, 0x2612648, 0x3614400, 0x20C06C0, 0x844D1, 0x6C0610,
+    0x24C9403, 0x200310C, 0x4A3003, 0x681243, 0x6004A0, 0xFFFFFFFF, 0x1313440, 0xFFFFFFFF, 0x64258, 0x1850600, 0x618890, 0xC4C8,
+    0xFFFFFFFF, 0x2619840, 0x4241840, 0x300C688, 0xFFFFFFFF, 0x4299000, 0x131804B, 0x2012648, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x44D1000, 0x2480600, 0xFFFFFFFF, 0xFFFFFFFF, 0x128A258, 0x524E0, 0x112092, 0xFFFFFFFF, 0x1250600, 0x4649448,
+    0x3112248, 0x2018263, 0x24B6C2, 0x806D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x20008DA, 0x1488600, 0x20C304C, 0xFFFFFFFF, 0xFFFFFFFF, 0x29225A,
+    0x324B2C8, 0x148804C, 0xFFFFFFFF, 0xFFFFFFFF, 0x4520, 0xC9848, 0xFFFFFFFF, 0x6401A, 0x6910C0, 0x6144C0, 0xC298, 0xFFFFFFFF,
+    0x24E1002, 0x3009898, 0xFFFFFFFF, 0x1259840, 0xFFFFFFFF, 0x3061059, 0x26C0260, 0x1090C2, 0x69B440, 0xFFFFFFFF, 0x8A10C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1489508, 0x12DB049, 0x304910B, 0xFFFFFFFF, 0xD0490, 0xFFFFFFFF, 0x418049, 0x261842, 0x6C9061, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x328C003, 0x124A698, 0xFFFFFFFF, 0x291000, 0x3080649, 0x3308648, 0x24830A, 0x1900258, 0xFFFFFFFF, 0xC18A0, 0x2004289,
+    0x3612400, 0x30C3013, 0xFFFFFFFF, 0xFFFFFFFF, 0xC9618, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2848649, 0xFFFFFFFF, 0xFFFFFFFF, 0x2003709,
+    0x680260, 0x1242248, 0xFFFFFFFF, 0x2444A, 0xFFFFFFFF, 0xFFFFFFFF, 0x30A1218, 0x204A28C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3603258,
+    0xFFFFFFFF, 0x1850649, 0xFFFFFFFF, 0x2609218, 0xFFFFFFFF, 0xFFFFFFFF, 0x3010860, 0x618311, 0x224864C, 0xFFFFFFFF, 0xFFFFFFFF, 0x4249600,
+    0x12C4488, 0x30825B, 0xFFFFFFFF, 0xFFFFFFFF, 0x70A242, 0x4014A3, 0x1709448, 0x4DC, 0x448001B, 0x128A299, 0xFFFFFFFF, 0x3000698,
+    0x30C024A, 0x4DC002, 0xFFFFFFFF, 0xFFFFFFFF, 0x84A018, 0x26E0080, 0x4C04D9, 0xFFFFFFFF, 0xC20DB, 0xFFFFFFFF, 0xFFFFFFFF, 0x1488648,
+    0xFFFFFFFF, 0x348801B, 0x292299, 0x42D2002, 0x4A68C, 0xFFFFFFFF, 0xFFFFFFFF, 0x24A1210, 0xFFFFFFFF, 0xFFFFFFFF, 0x1658248, 0x36C0018,
+    0x248C440, 0x304A28B, 0x34092C0, 0x360148A, 0x425A000, 0x1096C2, 0x89104B, 0xFFFFFFFF, 0x3061098, 0xE16C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2052849, 0x1261603, 0xC0418, 0xFFFFFFFF, 0x1840248, 0x249498, 0x1889, 0x4511200, 0x4840403, 0x4240510, 0x43000C9, 0x83649,
+    0xFFFFFFFF, 0x291603, 0xFFFFFFFF, 0xFFFFFFFF, 0x3018858, 0x93700, 0xFFFFFFFF, 0x305B800, 0x3419258, 0x26CB080, 0x3009202, 0xFFFFFFFF,
+    0x330A, 0x4480291, 0xFFFFFFFF, 0x409491, 0x300B803, 0x19012C0, 0xFFFFFFFF, 0x22458, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x10248, 0x44980C0, 0x16D3080, 0x109490, 0xFFFFFFFF, 0x30C9259, 0x1300858, 0xFFFFFFFF, 0x49320, 0xFFFFFFFF, 0x600521, 0xFFFFFFFF,
+    0x1300291, 0x2609818, 0x660018, 0xFFFFFFFF, 0x1853248, 0x1658, 0x6DB080, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x610018, 0x30D3018,
+    0xFFFFFFFF, 0x2A4600, 0x5B418, 0xFFFFFFFF, 0xFFFFFFFF, 0x369B, 0xFFFFFFFF, 0x2309258, 0x18C1258, 0x85B248, 0x9B248, 0x30D0,
+    0xC00D3, 0xFFFFFFFF, 0x409261, 0xFFFFFFFF, 0x44964C, 0xFFFFFFFF, 0x2252443, 0xFFFFFFFF, 0x3000119, 0x83308, 0x449092, 0x1311258,
+    0x8C9258, 0xFFFFFFFF, 0x1488683, 0x301B0C9, 0xFFFFFFFF, 0x2922D8, 0xFFFFFFFF, 0x3602049, 0x40C2C3, 0x604480, 0xFFFFFFFF, 0x2251309,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x601310, 0x3659248, 0x64B01B, 0xFFFFFFFF, 0x49324A, 0x4301240, 0x2490061, 0x348B0C0, 0xFFFFFFFF,
+    0x4900C9, 0x3260000, 0x1843400, 0x60B680, 0x1264202, 0xC301A, 0xFFFFFFFF, 0x3309800, 0xFFFFFFFF, 0x18C0, 0x1B858, 0x324C250,
+    0x49A442, 0x3004643, 0x30C0059, 0x30B680, 0x186D8, 0x128B0C0, 0x848848, 0xFFFFFFFF, 0xFFFFFFFF, 0x30D8449, 0x1811C, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x12C0000, 0x124084A, 0xFFFFFFFF, 0x384B002, 0x308010C, 0x4A49B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x22499, 0x12922C9,
+    0x52213, 0xFFFFFFFF, 0xFFFFFFFF, 0x891418, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24B403, 0x2848109, 0x125C250, 0x29A880, 0xFFFFFFFF,
+    0x300A708, 0x604700, 0x621249, 0x2249240, 0xFFFFFFFF, 0xFFFFFFFF, 0x1840059, 0x24A883, 0x610618, 0x224B848, 0xD861A, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x261690, 0x99258, 0x321249, 0xD805C, 0xFFFFFFFF, 0x41A498, 0xFFFFFFFF, 0x9B848, 0x2248109, 0x4924A, 0x848059,
+    0x24806C0, 0x1240613, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x860449, 0xFFFFFFFF, 0x449692, 0xFFFFFFFF, 0xFFFFFFFF, 0x148B840,
+    0x122218, 0x125010C, 0x125B000, 0x2908049, 0xFFFFFFFF, 0x20C3109, 0xFFFFFFFF, 0x1259460, 0x1300660, 0xD2200, 0x491242, 0x24805C,
+    0x601910, 0x125A480, 0xFFFFFFFF, 0xFFFFFFFF, 0x493840, 0x3000600, 0x263002, 0x1910049, 0x224B600, 0xFFFFFFFF, 0x12A1013, 0x264C018,
+    0x4C3003, 0x2480, 0xFFFFFFFF, 0x3080860, 0x18C0049, 0xFFFFFFFF, 0xFFFFFFFF, 0x19299, 0xFFFFFFFF, 0x3081840, 0x5C248, 0x18402CB,
+    0x190C, 0xC800, 0x64B500, 0xFFFFFFFF, 0x309B210, 0x251292, 0x30DA003, 0xFFFFFFFF, 0x128B109, 0xFFFFFFFF, 0x12C0603, 0x3294400,
+    0xFFFFFFFF, 0x2910C3, 0xCA25B, 0x8482CB, 0x40C690, 0x25B603, 0x318600, 0x24CA640, 0x3241840, 0x1641289, 0xFFFFFFFF, 0x204B498,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x52259, 0x18D1003, 0x1851840, 0x30E2240, 0xC9121, 0x490492, 0x680320, 0xFFFFFFFF, 0x1242308,
+    0x14D2640, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x364C002, 0x4853, 0xC1842, 0xFFFFFFFF, 0x12A4400, 0x1840098, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xC1289, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1249508, 0xFFFFFFFF, 0xFFFFFFFF, 0x42496C0, 0x20C3260, 0x168A300, 0x2498083,
+    0x461618, 0xFFFFFFFF, 0x848098, 0x1488260, 0xFFFFFFFF, 0xFFFFFFFF, 0x293490, 0xFFFFFFFF, 0x150B600, 0x20C9448, 0x1240094, 0x44C291,
+    0x23888, 0x20092D8, 0x84A0D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x232C3, 0x490260, 0x1700092, 0xFFFFFFFF, 0x123248, 0xFFFFFFFF,
+    0x64905C, 0x4242291, 0x4258083, 0xFFFFFFFF, 0x304C, 0xFFFFFFFF, 0xFFFFFFFF, 0x524CB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x18C0649, 0x425A0C0, 0xFFFFFFFF, 0x899448, 0x19899, 0xFFFFFFFF, 0xFFFFFFFF, 0x18408C8, 0x84289, 0x12616C0, 0xC04D8,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x251891, 0x1240400, 0x1253650, 0xFFFFFFFF, 0x8C8649, 0xFFFFFFFF, 0x3021200, 0x618649, 0xFFFFFFFF, 0x2916D0,
+    0xFFFFFFFF, 0x84B488, 0x300C443, 0x30DB080, 0x2109049, 0x3240860, 0x2012400, 0x853200, 0x30C2109, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x68921B, 0xFFFFFFFF, 0xFFFFFFFF, 0x44880D0, 0xFFFFFFFF, 0x42404C3, 0x300B309, 0x1241300, 0xFFFFFFFF, 0x4649200, 0x3112000,
+    0x3601310, 0x114448, 0x920CC, 0x3862, 0x6492CB, 0xD9218, 0xFFFFFFFF, 0x253200, 0x309498, 0xFFFFFFFF, 0xC188B, 0x32484C3,
+    0xFFFFFFFF, 0x18D8248, 0x30C0461, 0x42D2, 0xFFFFFFFF, 0xFFFFFFFF, 0x20184D9, 0x30C1488, 0x6100DB, 0xFFFFFFFF, 0xC9049, 0x200A443,
+    0x3001318, 0x90824A, 0x30C9203, 0xFFFFFFFF, 0xFFFFFFFF, 0x492CB, 0x2021261, 0x1240691, 0xFFFFFFFF, 0x2601488, 0x42C0000, 0x3600683,
+    0x4300400, 0x25C449, 0xFFFFFFFF, 0xFFFFFFFF, 0xD0248, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x125B083, 0xFFFFFFFF, 0xFFFFFFFF, 0x491888,
+    0x4258680, 0x124A453, 0x3490449, 0xFFFFFFFF, 0x128A842, 0x42580C0, 0x30112A1, 0x25B308, 0x3083, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000680,
+    0x2480061, 0xFFFFFFFF, 0x6D001B, 0x4841640, 0x2009200, 0x84A003, 0x1849200, 0x9263, 0x292840, 0x1289708, 0x2C9318, 0x680018,
+    0x908018, 0xFFFFFFFF, 0x19318, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3021810, 0xFFFFFFFF, 0x384C200, 0x522000, 0x851203, 0x10B248,
+    0x48A0000, 0x61B248, 0x291708, 0xE3249, 0x1659258, 0x20D9300, 0x20E4200, 0x1258293, 0x26006D8, 0xFFFFFFFF, 0x148B0D0, 0x422500,
+    0x4318002, 0xFFFFFFFF, 0xFFFFFFFF, 0x52898, 0xFFFFFFFF, 0x112448, 0x294, 0x6C1310, 0xFFFFFFFF, 0x522DA, 0x418061, 0x30C0003,
+    0x2894, 0xFFFFFFFF, 0x3858000, 0x2018061, 0x30130C0, 0x30C2603, 0xFFFFFFFF, 0x180C9, 0x2003291, 0x30922C8, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x48D8, 0x1A6C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C9309, 0x600061, 0x431A, 0xC1318, 0xFFFFFFFF, 0x68084B, 0x10B018, 0x1241250,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x498C8, 0xFFFFFFFF, 0x488B000, 0xFFFFFFFF, 0x1259640, 0x2603061, 0x54203, 0x14898C0, 0x6030C3, 0xFFFFFFFF,
+    0x2130B, 0x2121248, 0x3123000, 0x1840003, 0x112218, 0x20610D8, 0x13294, 0xFFFFFFFF, 0x150B0C0, 0xFFFFFFFF, 0x260063, 0x308848,
+    0x3053840, 0xD8003, 0x5B400, 0x4C0061, 0xFFFFFFFF, 0x3662200, 0x6E1248, 0x2309243, 0x18C1240, 0x248112, 0xFFFFFFFF, 0x509,
+    0xC4258, 0xDA049, 0x84A600, 0x691248, 0xFFFFFFFF, 0x13094C8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C30C3, 0xFFFFFFFF, 0x19900,
+    0xFFFFFFFF, 0x3252648, 0x3614240, 0x908059, 0x348804C, 0x1300603, 0x29A600, 0xE1249, 0xFFFFFFFF, 0xFFFFFFFF, 0xC8C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x36C0049, 0xFFFFFFFF, 0x61B289, 0x13064, 0xFFFFFFFF, 0xFFFFFFFF, 0x3010661, 0x249004C, 0x61810B, 0x19803,
+    0xD2658, 0x2C9240, 0x2484A3, 0xFFFFFFFF, 0x894, 0x19243, 0xFFFFFFFF, 0xFFFFFFFF, 0x85B003, 0x30C0602, 0x323002, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3000492, 0x4C0891, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2003891, 0x400721, 0xFFFFFFFF, 0xFFFFFFFF, 0x1889403, 0x2600603,
+    0x49464, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2860600, 0xCC800, 0xFFFFFFFF, 0xFFFFFFFF, 0x3292249, 0x3049063, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x52203, 0xFFFFFFFF, 0xFFFFFFFF, 0x3659003, 0x3064010, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C0490, 0x1243890, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3891000, 0x1840600, 0x12432D2, 0x13891, 0xFFFFFFFF, 0xFFFFFFFF, 0x3452249, 0xFFFFFFFF, 0x4243, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C8493,
+    0x3000263, 0xFFFFFFFF, 0xFFFFFFFF, 0x18490, 0xFFFFFFFF, 0x848603, 0x2512080, 0x248224B, 0xFFFFFFFF, 0x3404840, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3018092, 0x1900098, 0x310B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1841508, 0xFFFFFFFF, 0x30A308, 0x3849218, 0xFFFFFFFF, 0x61063,
+    0x109848, 0x248944A, 0xFFFFFFFF, 0xFFFFFFFF, 0x8C9289, 0x680092, 0x12C1843, 0x619289, 0xFFFFFFFF, 0x3062240, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x8950B, 0x1244689, 0xFFFFFFFF, 0xFFFFFFFF, 0x4243258, 0x640C0, 0x204C6C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x324921B, 0x3094000, 0x264C003,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x19842, 0xFFFFFFFF, 0xFFFFFFFF, 0x2E3210, 0x612410, 0x9B603, 0xFFFFFFFF, 0x324B258, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x124B2C0, 0x9B04C, 0xFFFFFFFF, 0x4B600, 0x201B260, 0x18412D8, 0x30A0D8, 0x18708, 0xC24CB, 0x4498248, 0x229104C, 0x60224B,
+    0x9A4C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x494A3, 0x109059, 0x30C20C3, 0x12524C2, 0x12410, 0xFFFFFFFF, 0x52803, 0xFFFFFFFF, 0x121449,
+    0x3659600, 0x6D8648, 0xFFFFFFFF, 0x49201B, 0x149121A, 0x12412D2, 0x894002, 0x1888308, 0xC910C, 0xFFFFFFFF, 0x20D2403, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x324A003, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1300308, 0x64A299, 0x3603300, 0x5C003, 0x248024A, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x53708, 0xFFFFFFFF, 0x4D9049, 0x1B094, 0xFFFFFFFF, 0x3083649, 0x30012C3, 0x421218, 0x313203,
+    0x4483248, 0x3692002, 0x848080, 0x148824A, 0x30180D3, 0xFFFFFFFF, 0x8A2400, 0xDA0C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x34A0018, 0xFFFFFFFF, 0x40B8C8, 0x2DA010, 0x609213, 0x348B248, 0xFFFFFFFF, 0x49719, 0xFFFFFFFF, 0x1092CB, 0x6034D8, 0x224801B,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x300A502, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C8860, 0x248001A, 0xFFFFFFFF, 0x18862,
+    0x128B248, 0x36980C0, 0x2649490, 0x24A0C0, 0x1902000, 0x6CA289, 0xFFFFFFFF, 0x709098, 0xFFFFFFFF, 0x4C1488, 0x34D4, 0x3840291,
+    0x20018D2, 0xFFFFFFFF, 0x3003691, 0x251880, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2512CC, 0x30C00C2, 0x3652440, 0xCA840,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x611318, 0xFFFFFFFF, 0x324084B, 0x490018, 0xFFFFFFFF, 0x109098, 0x30CA442, 0xFFFFFFFF, 0x22542C0,
+    0xFFFFFFFF, 0x854210, 0x4889080, 0xFFFFFFFF, 0xFFFFFFFF, 0xCC2C9, 0x52280, 0x148A500, 0x1241313, 0x30A000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4910000, 0x30C9308, 0x899200, 0xFFFFFFFF, 0xD9200, 0x542C3, 0x1840680, 0x262291, 0x6E4, 0xC0293, 0x3080061,
+    0xFFFFFFFF, 0x3019253, 0x30C3010, 0x124, 0x22600C0, 0xFFFFFFFF, 0x30002E3, 0x8090B, 0x3652210, 0x313800, 0xFFFFFFFF, 0xD80C2,
+    0x3001303, 0xFFFFFFFF, 0x30C2490, 0x1258002, 0x324061B, 0x30830C3, 0x3002320, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3240049, 0x20098C3,
+    0x40930C, 0x1718003, 0x2061092, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x10C488, 0x1850061, 0x6198C0, 0x224861B, 0x648064, 0x16430C0,
+    0x10930A, 0x1242109, 0x624202, 0x29A6C0, 0x310C080, 0xFFFFFFFF, 0x2480C3, 0x3649243, 0xFFFFFFFF, 0xFFFFFFFF, 0xD06D8, 0xFFFFFFFF,
+    0x18D8003, 0x14D4, 0x324200, 0x484004B, 0x12A1080, 0xFFFFFFFF, 0x30C1243, 0x3086D0, 0x29124B, 0xC3683, 0xFFFFFFFF, 0x1488618,
+    0x908003, 0x612483, 0x19300, 0xDA490, 0x49083, 0x20C9800, 0x124044C, 0xFFFFFFFF, 0x22660, 0x6522C9, 0x2009690, 0x300B44B,
+    0x14A3000, 0x12530C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x109698, 0xFFFFFFFF, 0x1258260, 0xFFFFFFFF, 0x3602480, 0xFFFFFFFF, 0x24844C,
+    0x80000, 0x1304640, 0x3684240, 0x3248600, 0xFFFFFFFF, 0xFFFFFFFF, 0x604309, 0xFFFFFFFF, 0x2609460, 0x522C2, 0x3302480, 0xFFFFFFFF,
+    0x12A3, 0x1309248, 0x324A649, 0xD9803, 0x2649291, 0xFFFFFFFF, 0x30D4240, 0x1C253, 0x12894C3, 0x3080661, 0x20C0263, 0x60B508,
+    0x48C3, 0x12614C8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C0492, 0x4303, 0xFFFFFFFF, 0x8CB003, 0x84B840, 0x10B003, 0x204984B,
+    0x61B000, 0x2914C0, 0x150804C, 0x148B449, 0xFFFFFFFF, 0xFFFFFFFF, 0x304B04C, 0x2600490, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x61B,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x112202, 0x12416E0, 0x106C3, 0x51004C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2494400,
+    0xFFFFFFFF, 0x64C240, 0x1643109, 0x36C9003, 0x4C0049, 0xFFFFFFFF, 0x19460, 0xFFFFFFFF, 0x660490, 0x24C299, 0x190004B, 0xFFFFFFFF,
+    0xC4243, 0xFFFFFFFF, 0x59291, 0x85C240, 0x30C1840, 0x984B, 0x291848, 0x3119000, 0x680603, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4C243, 0x848492, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2601840, 0x200C849, 0xFFFFFFFF, 0x6018A0, 0x9B109, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4240648, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4240083, 0xFFFFFFFF, 0x204C0C0, 0x365A240, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x24B049, 0x30232C0, 0xA2308, 0xFFFFFFFF, 0x1289059, 0x300201B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x59061, 0xFFFFFFFF, 0x610263, 0xFFFFFFFF, 0x1309280, 0x36096C0, 0x300148A, 0x11B218, 0x2498258, 0x196D0, 0x1289510,
+    0x128C0C0, 0x848260, 0xFFFFFFFF, 0xFFFFFFFF, 0x21448, 0xFFFFFFFF, 0x8CB600, 0x300B818, 0x600094, 0x61B600, 0xFFFFFFFF, 0x1292298,
+    0x4B493, 0xFFFFFFFF, 0xFFFFFFFF, 0x1258648, 0x23491, 0xFFFFFFFF, 0xFFFFFFFF, 0x184A4C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xD2413,
+    0x40C508, 0x248258, 0xFFFFFFFF, 0x125A688, 0x64A240, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C9218, 0x94061, 0x1A01B, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2DA0D0, 0xFFFFFFFF, 0x6092D0, 0xFFFFFFFF, 0xD12D2, 0x200364C, 0x300284B, 0x248709, 0x1900648, 0x194A0, 0x649109, 0x30920C2,
+    0x2D121B, 0x11C000, 0x46D2, 0xFFFFFFFF, 0xFFFFFFFF, 0x26D1600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x131024B, 0x360001B, 0x4B260,
+    0x30042C3, 0x24984C0, 0x46D2000, 0xFFFFFFFF, 0x496C2, 0x2024218, 0x422688, 0x248A450, 0xFFFFFFFF, 0x216C3, 0x521049, 0x14880D8,
+    0xFFFFFFFF, 0x418, 0x38480D0, 0xD064C, 0x36004C3, 0x4243243, 0x36DA000, 0x26041B, 0x13092, 0x64C610, 0x490691, 0x300001A,
+    0x3013248, 0x92293, 0xFFFFFFFF, 0x6E1600, 0x70904B, 0xFFFFFFFF, 0x20D3640, 0x308080, 0x224948B, 0x324B248, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4289258, 0x2251200, 0xFFFFFFFF, 0xFFFFFFFF, 0x4180DB, 0x1249710, 0x30A0C3, 0x13092C2, 0xFFFFFFFF, 0x40330B, 0x109600,
+    0x12E12C0, 0xFFFFFFFF, 0xC0918, 0xE1600, 0x3009259, 0x422443, 0x124085B, 0x1259218, 0xFFFFFFFF, 0xE1049, 0x36C0400, 0x3021649,
+    0x3112C0, 0x318018, 0x3241258, 0x3258600, 0xFFFFFFFF, 0xFFFFFFFF, 0x6184C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x301301B, 0x60A458,
+    0x92061, 0xFFFFFFFF, 0xFFFFFFFF, 0x36180C2, 0xFFFFFFFF, 0xFFFFFFFF, 0x324A, 0x6CC600, 0xFFFFFFFF, 0x300084A, 0xFFFFFFFF, 0x4D8018,
+    0xD0, 0xFFFFFFFF, 0xFFFFFFFF, 0x403692, 0x33180C0, 0x2600C9, 0x1918010, 0x649708, 0xFFFFFFFF, 0x330A049, 0x24B300, 0x1900680,
+    0xFFFFFFFF, 0x1289311, 0xFFFFFFFF, 0x20C00C3, 0x600464, 0x4711, 0x21259, 0xC1703, 0xFFFFFFFF, 0x863010, 0x30C4480, 0x98D0,
+    0x34A0000, 0xFFFFFFFF, 0x3600059, 0x3004310, 0x252502, 0x618293, 0x29C200, 0xFFFFFFFF, 0xFFFFFFFF, 0x2D42C0, 0x3023448, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x148810B, 0xFFFFFFFF, 0x12430CC, 0x13689, 0x24D2600, 0xFFFFFFFF, 0x3000618, 0x68A443, 0x12D80C3, 0x8900C0,
+    0xD00C3, 0xFFFFFFFF, 0x26E0000, 0x2482600, 0x1250003, 0xFFFFFFFF, 0xFFFFFFFF, 0x3260059, 0xFFFFFFFF, 0x800C3, 0x3080C3, 0x14DA600,
+    0x12890D3, 0xFFFFFFFF, 0x18418C0, 0xFFFFFFFF, 0x1921, 0xFFFFFFFF, 0x2001300, 0x12A14C0, 0x149C240, 0x601250, 0xC25C, 0xFFFFFFFF,
+    0x230B0C0, 0x4C64B, 0x3311018, 0xFFFFFFFF, 0x619640, 0x2910E1, 0x494D8, 0x4C092, 0xFFFFFFFF, 0x898C0, 0x1259249, 0x2604243,
+    0x492603, 0x618C8, 0x20C9690, 0xFFFFFFFF, 0xC710, 0xFFFFFFFF, 0x4240490, 0x2C8618, 0x3013618, 0x2493003, 0x125B289, 0xFFFFFFFF,
+    0x42D8049, 0xFFFFFFFF, 0x69A2C0, 0x920A2, 0x11303, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x328C, 0x3709010, 0xFFFFFFFF,
+    0x308004C, 0x3003449, 0x4C3848, 0x30A490, 0xC12A1, 0x6610D0, 0x4036D8, 0x421803, 0x614258, 0xFFFFFFFF, 0xC9018, 0x28806C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3240600, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C9460, 0x204A25B, 0xFFFFFFFF, 0x3109003, 0xFFFFFFFF,
+    0x61691, 0x4CA489, 0x1244258, 0x10664, 0x6DB002, 0x31190C0, 0x6806C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xD2818, 0x4C303,
+    0x300950A, 0xFFFFFFFF, 0xFFFFFFFF, 0x13006C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x4258098, 0x2480602, 0xFFFFFFFF, 0xFFFFFFFF, 0x128A25A, 0x1649292,
+    0x858049, 0x4D9400, 0x125061B, 0x130C018, 0xD8449, 0x53500, 0x806C0, 0x16890C0, 0xFFFFFFFF, 0x32CB049, 0xFFFFFFFF, 0x201928C,
+    0x301B049, 0x1252648, 0x1A8D0, 0x651292, 0x2000320, 0xFFFFFFFF, 0xFFFFFFFF, 0x1693440, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x64018,
+    0x121010, 0x618660, 0x3061610, 0xFFFFFFFF, 0xE3218, 0x300C458, 0x30C944A, 0x1259849, 0x2109061, 0xFFFFFFFF, 0x49513, 0x30092C9,
+    0x350A240, 0x1259289, 0x26016D0, 0x1289003, 0xFFFFFFFF, 0x418603, 0x2052249, 0x1843, 0x260944B, 0x128B603, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x261849, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x18D2080, 0x184224B, 0x26128B, 0x3840649, 0xFFFFFFFF, 0x491508, 0xFFFFFFFF, 0x149B600,
+    0x1252410, 0xFFFFFFFF, 0x64A302, 0xFFFFFFFF, 0x18400C3, 0x254218, 0xFFFFFFFF, 0x34012D2, 0x1292249, 0x200944B, 0x300030A, 0x252698,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6224C, 0xFFFFFFFF, 0x619448, 0x24458, 0x209B2C0, 0xFFFFFFFF, 0x300A68A, 0x46D0080,
+    0x6C0092, 0xFFFFFFFF, 0x4A302, 0x14892D8, 0x10B490, 0x12D824B, 0x22DA018, 0xCC0C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x24A248, 0x609280,
+    0x1428C, 0x648092, 0xFFFFFFFF, 0x4249603, 0x3011889, 0xFFFFFFFF, 0x1944B, 0xFFFFFFFF, 0x4912D8, 0x858649, 0x60B2C0, 0x9864C,
+    0xFFFFFFFF, 0x32482A1, 0x36A2000, 0x3003258, 0x251448, 0x44961B, 0xFFFFFFFF, 0x3251603, 0x84A01B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x18314, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2049049, 0xFFFFFFFF, 0x464000, 0xE121A, 0x2D2688, 0x300A458, 0xFFFFFFFF, 0xC898,
+    0xFFFFFFFF, 0x308C218, 0x36C001A, 0x10C840, 0x1241498, 0xFFFFFFFF, 0xC92D3, 0x4C6D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x6180E1, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x603300, 0x863, 0xFFFFFFFF, 0x2000248, 0x3301488, 0x184024A, 0xFFFFFFFF, 0x14D3248, 0xFFFFFFFF,
+    0xD3092, 0x5904C, 0x251210, 0x264448, 0xFFFFFFFF, 0x18680, 0xFFFFFFFF, 0x300148B, 0x692002, 0x3084D8, 0x30D8400, 0x29104B,
+    0x26212C0, 0x848248, 0xFFFFFFFF, 0xFFFFFFFF, 0x2249318, 0x2600018, 0x4992C9, 0x3000908, 0x82512, 0xFFFFFFFF, 0xFFFFFFFF, 0x2245A,
+    0x4240403, 0x165801B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x16D04C0, 0x498E0, 0x109492, 0x25A459, 0xA510, 0x29A848, 0xFFFFFFFF,
+    0x5421B, 0xFFFFFFFF, 0x1244888, 0x3490010, 0x22900, 0x3248400, 0x3301258, 0x184001A, 0xFFFFFFFF, 0x14882, 0x34A00C0, 0x32426C8,
+    0x42402E0, 0xFFFFFFFF, 0x6092C3, 0x6CA450, 0xFFFFFFFF, 0xFFFFFFFF, 0x424C202, 0x3014488, 0xFFFFFFFF, 0x1948B, 0x2880061, 0x12A3248,
+    0x330B010, 0x30C0848, 0x30DB, 0x34000C0, 0xC00D8, 0xFFFFFFFF, 0x68A500, 0x1240010, 0x36600C0, 0xFFFFFFFF, 0xDB080, 0x3254202,
+    0x419318, 0x2049649, 0x10018, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x20C30D8, 0xFFFFFFFF, 0x6C0461, 0xFFFFFFFF, 0x3109418, 0xFFFFFFFF,
+    0x12C125B, 0x6018D1, 0x1301643, 0x34098C0, 0xFFFFFFFF, 0x1658291, 0x425A600, 0x1853018, 0x890061, 0xFFFFFFFF, 0x493240, 0x148A109,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2308000, 0x3002600, 0xFFFFFFFF, 0xFFFFFFFF, 0x1264200, 0xC3018, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x9B01B, 0x6CC248, 0xD8848, 0x3081240, 0x2518003, 0xFFFFFFFF, 0xC21A, 0x291649, 0xFFFFFFFF, 0x2C8121, 0x3009800,
+    0xFFFFFFFF, 0x390A, 0x18121, 0x4499240, 0xFFFFFFFF, 0x148B003, 0x4CC203, 0xFFFFFFFF, 0xFFFFFFFF, 0x2311249, 0x1658618, 0x6000C0,
+    0x121418, 0x304A658, 0xC96A0, 0xFFFFFFFF, 0x4243000, 0xFFFFFFFF, 0x3659018, 0xFFFFFFFF, 0x6D9640, 0x493013, 0xFFFFFFFF, 0x25A498,
+    0xA26C0, 0x1889300, 0x32406C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C9803, 0x62124B, 0x2112200, 0x3240109, 0xFFFFFFFF, 0xFFFFFFFF, 0x6098C0,
+    0x4289013, 0x1A049, 0x661080, 0xFFFFFFFF, 0x2481250, 0x2498610, 0x14318, 0x184A0, 0xD1303, 0x2503003, 0x3018660, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x34006C0, 0x49248, 0x2D1249, 0x3291013, 0x1240610, 0xFFFFFFFF, 0x2124C, 0x4B84B, 0x1489240, 0x14A0610, 0x6130C3,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x150B003, 0x30042D8, 0x122203, 0x125B003, 0x4508600, 0xFFFFFFFF, 0x3602649, 0x14886C2, 0x30C9061, 0x6C4640,
+    0x210A258, 0x3240493, 0xFFFFFFFF, 0x1488109, 0xFFFFFFFF, 0xFFFFFFFF, 0x1301689, 0xFFFFFFFF, 0x26C2480, 0x34610C0, 0x1210D0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3260600, 0xFFFFFFFF, 0xFFFFFFFF, 0x19858, 0x6494C0, 0x49010B, 0xFFFFFFFF, 0x723000, 0x309689, 0xFFFFFFFF,
+    0xC3059, 0xFFFFFFFF, 0x4186C3, 0x2480492, 0x322, 0xFFFFFFFF, 0xFFFFFFFF, 0x4B61B, 0xFFFFFFFF, 0x692648, 0x1250493, 0x1310049,
+    0x8C804C, 0x84B449, 0x300150B, 0xFFFFFFFF, 0xFFFFFFFF, 0x6D2480, 0xFFFFFFFF, 0xFFFFFFFF, 0x20C0320, 0xFFFFFFFF, 0x6C1850, 0x3063600,
+    0x3240263, 0x52818, 0xFFFFFFFF, 0x12402CB, 0x3521000, 0xFFFFFFFF, 0x200950B, 0x493610, 0x3013603, 0x9264B, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x20D2418, 0xFFFFFFFF, 0x2248263, 0xFFFFFFFF, 0xFFFFFFFF, 0x3092248, 0x1840659, 0x4858, 0x1A64C, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x30124C9, 0x24A8C9, 0xFFFFFFFF, 0x1B660, 0xD44C0, 0xFFFFFFFF, 0x24A30B, 0xFFFFFFFF, 0x124950A, 0x2248709, 0xFFFFFFFF,
+    0x2D1849, 0x4C16D0, 0x81900, 0xFFFFFFFF, 0xC0712, 0xFFFFFFFF, 0x84809B, 0xFFFFFFFF, 0x204A240, 0xFFFFFFFF, 0x461061, 0x3600648,
+    0xFFFFFFFF, 0x90A248, 0x1240098, 0x125B600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x259289, 0x350C000, 0xFFFFFFFF, 0xCA4D1, 0x491840,
+    0xFFFFFFFF, 0x248648, 0xFFFFFFFF, 0xFFFFFFFF, 0xD224C, 0x2013658, 0x4258080, 0x263600, 0xFFFFFFFF, 0x13699, 0xFFFFFFFF, 0x661449,
+    0x418260, 0xFFFFFFFF, 0x30A24B, 0x1309448, 0xD16D0, 0x490708, 0xFFFFFFFF, 0x1902018, 0xFFFFFFFF, 0xFFFFFFFF, 0x12896C9, 0x5C848,
+    0x24B0D8, 0x8428C, 0xFFFFFFFF, 0xFFFFFFFF, 0x200030B, 0xFFFFFFFF, 0x184B203, 0xFFFFFFFF, 0xB264, 0x294840, 0xFFFFFFFF, 0x61449,
+    0x184C202, 0x61864B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x412400, 0x28C9049, 0x38C8248, 0xFFFFFFFF, 0xFFFFFFFF, 0x2012403, 0x30092CC,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x52859, 0xFFFFFFFF, 0x2584D9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4243083, 0x3013640,
+    0xFFFFFFFF, 0x38D2000, 0x1864B, 0x32580D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x36A1200, 0x20C024B, 0x264A289,
+    0x190024A, 0x4899, 0x1321049, 0x20000DB, 0xFFFFFFFF, 0x3019242, 0x60C500, 0x4481258, 0xFFFFFFFF, 0x12A12C8, 0xFFFFFFFF, 0x30C148A,
+    0xFFFFFFFF, 0x224B308, 0xFFFFFFFF, 0x4C449, 0x300131A, 0x25A400, 0x24980D0, 0x304C602, 0xFFFFFFFF, 0x3618013, 0xFFFFFFFF, 0x603083,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x14892C0, 0xFFFFFFFF, 0x30CB249, 0x890248, 0xFFFFFFFF, 0xD024B, 0xFFFFFFFF, 0xFFFFFFFF, 0x329B400,
+    0x12584C0, 0xFFFFFFFF, 0xD2849, 0x3009511, 0x425B240, 0x30824A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C1318, 0x30D2448,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3003243, 0x2604C0, 0x14E1, 0xFFFFFFFF, 0xFFFFFFFF, 0x84A000, 0xFFFFFFFF, 0x30C1258, 0x1249319,
+    0x198D8, 0x200090B, 0xFFFFFFFF, 0x68001B, 0x1242000, 0x1692448, 0xC0521, 0x3084488, 0x8E0018, 0x64602, 0xFFFFFFFF, 0x1300010,
+    0xFFFFFFFF, 0x8CB248, 0x308C203, 0x36C0000, 0x602898, 0x970C, 0xD0018, 0x129B800, 0x30098C2, 0x24A003, 0x204C092, 0x1258291,
+    0xFFFFFFFF, 0x4850003, 0x12C00C3, 0x3010064, 0x124B800, 0xFFFFFFFF, 0x324861A, 0xFFFFFFFF, 0xFFFFFFFF, 0x25B0D8, 0x94260, 0x10908,
+    0x3249640, 0x42430C9, 0x26D80C0, 0x12E1800, 0xFFFFFFFF, 0xFFFFFFFF, 0x3112049, 0xFFFFFFFF, 0x4C0294, 0x253803, 0xFFFFFFFF, 0x649311,
+    0xD9258, 0x400121, 0x24C4C9, 0xFFFFFFFF, 0x2249300, 0x1A6CA, 0x324B0C0, 0x849250, 0xFFFFFFFF, 0x9C488, 0x2860003, 0x1313018,
+    0x8CB018, 0x61258, 0x300C810, 0x610121, 0xFFFFFFFF, 0x2253680, 0x4C488, 0x3889248, 0xFFFFFFFF, 0x1258063, 0x125C200, 0xFFFFFFFF,
+    0x848119, 0x14882E0, 0xFFFFFFFF, 0x890848, 0x1892600, 0xD084B, 0xFFFFFFFF, 0x24925A, 0x609860, 0x106DB, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x53688, 0x1842603, 0x261643, 0x1258509, 0x1B010, 0x4902E0, 0x494480, 0x2E0848, 0x3511240, 0xFFFFFFFF, 0xFFFFFFFF, 0x2003064,
+    0x4014D1, 0x18D8600, 0x510, 0x1A498, 0xC425A, 0x51B400, 0x721080, 0x1849802, 0x614648, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x419303, 0x4C30C0, 0x284B000, 0x10003, 0x2308109, 0x18C0109, 0x10924B, 0x60344C, 0x4E2210, 0x1300610, 0xFFFFFFFF, 0xE1248,
+    0x10B848, 0x248B448, 0xC8C2, 0x2121018, 0xFFFFFFFF, 0xFFFFFFFF, 0x24A600, 0xFFFFFFFF, 0xC30B, 0x5090D8, 0x4850600, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x93840, 0xFFFFFFFF, 0xFFFFFFFF, 0x494250, 0x70901A, 0x3014243, 0x9328B, 0x19242, 0x3248660, 0x26C804B, 0x3003610,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3858600, 0x52319, 0x3098603, 0x691018, 0x428A250, 0x186C9, 0x3419840, 0xFFFFFFFF, 0x201C243,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1810B, 0x34C0490, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1A709, 0xE101B, 0xFFFFFFFF, 0x1190C0,
+    0x3292250, 0xFFFFFFFF, 0xCC248, 0x3601842, 0x201B109, 0xFFFFFFFF, 0x61B059, 0xA4249, 0x2940D0, 0x150C240, 0xFFFFFFFF, 0x25A480,
+    0xFFFFFFFF, 0x6C06C0, 0x3412418, 0xFFFFFFFF, 0x40004C, 0x1840602, 0x60B44B, 0x3049509, 0x64A25A, 0x492482, 0x10B500, 0xFFFFFFFF,
+    0x264800, 0x1B613, 0xFFFFFFFF, 0x2C8490, 0x3000262, 0x610049, 0xFFFFFFFF, 0x3843600, 0xFFFFFFFF, 0x49B218, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x40984C, 0x430A240, 0xFFFFFFFF, 0xFFFFFFFF, 0x1A4D9, 0xFFFFFFFF, 0x3000708, 0xFFFFFFFF, 0x284B600,
+    0x10600, 0x340944B, 0x3089200, 0x61061, 0x10984A, 0xFFFFFFFF, 0xFFFFFFFF, 0x3062800, 0x496DA, 0xFFFFFFFF, 0x69B600, 0x1243660,
+    0x3049890, 0x3062242, 0xFFFFFFFF, 0x36C0648, 0x12DB210, 0x318260, 0xFFFFFFFF, 0xFFFFFFFF, 0x36004D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x61B2C8,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x12A1002, 0x300C500, 0x93888, 0x2109109, 0xC3600, 0xFFFFFFFF, 0x12A3600, 0x248201B, 0x308098, 0x3493,
+    0xFFFFFFFF, 0x49002, 0xFFFFFFFF, 0x2E0092, 0x4D9840, 0xFFFFFFFF, 0x32480E1, 0x4B603, 0x309B202, 0xFFFFFFFF, 0x260318, 0x1B2C8,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x109618, 0xFFFFFFFF, 0x12514A0, 0x384A000, 0xFFFFFFFF, 0xFFFFFFFF, 0x20C0308, 0x89892, 0x3049660, 0xC4508,
+    0xFFFFFFFF, 0x52800, 0xFFFFFFFF, 0x892DB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2594A0, 0x61B098, 0x3851210,
+    0x200A518, 0x3609603, 0x20D2400, 0x30C92C9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3263, 0x130030A, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x14916C0, 0x2480248, 0x6098C9, 0xFFFFFFFF, 0x128B482, 0xFFFFFFFF, 0x30002A1, 0x2482848, 0xFFFFFFFF, 0x184D8, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x30012C0, 0x12D2010, 0x3708, 0x1312402, 0xDA688, 0x4A853, 0x40C44B, 0x4C26C8, 0xFFFFFFFF, 0x1A518, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x48C9200, 0xFFFFFFFF, 0x3089261, 0x10C449, 0x3022450, 0xFFFFFFFF, 0x649600, 0xE4440,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x6192C3, 0x1303258, 0x649049, 0xFFFFFFFF, 0x3092000, 0xFFFFFFFF, 0xFFFFFFFF, 0x3049311, 0x3249818, 0xFFFFFFFF,
+    0x3621200, 0xFFFFFFFF, 0x1249883, 0x18860, 0xFFFFFFFF, 0x2C9889, 0x12C3308, 0x2482618, 0x125001B, 0x182A4, 0xFFFFFFFF, 0x49600,
+    0x3018461, 0xFFFFFFFF, 0x30D801A, 0x21600, 0xDA458, 0x148801A, 0x149B248, 0x254440, 0xFFFFFFFF, 0xFFFFFFFF, 0x324C2C0, 0xFFFFFFFF,
+    0x184C210, 0x25801B, 0xFFFFFFFF, 0xC2503, 0xFFFFFFFF, 0x3449649, 0x2482500, 0xFFFFFFFF, 0x6C3418, 0xCA289, 0xE4202, 0x42500C3,
+    0x604888, 0xFFFFFFFF, 0x214E0, 0x24C9083, 0x424204C, 0xFFFFFFFF, 0x12418D1, 0x248, 0x22509, 0x26026C8, 0xFFFFFFFF, 0x1491259,
+    0x1241318, 0x618510, 0x1309202, 0xD1488, 0x403248, 0xFFFFFFFF, 0x1858018, 0x6C3300, 0x1C218, 0x663248, 0x5C603, 0x1843243,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x48C0000, 0x3080064, 0x3309640, 0x600002, 0x1700, 0xC600, 0xC2898, 0xDB243, 0xFFFFFFFF, 0x602618,
+    0x618400, 0xFFFFFFFF, 0x294049, 0xD80C9, 0x5B4C9, 0x30186D0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2314200, 0x3618003, 0x3291080,
+    0x3489243, 0xFFFFFFFF, 0x12926C0, 0x4A2DB, 0x361A600, 0x121258, 0x4641243, 0x1301253, 0xFFFFFFFF, 0x84A109, 0x852440, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x131C200, 0xFFFFFFFF, 0x403018, 0x248680, 0xFFFFFFFF, 0xFFFFFFFF, 0x30622C0, 0xFFFFFFFF, 0x26C9800, 0x2480C2, 0x1900000,
+    0x1300119, 0xC1643, 0xFFFFFFFF, 0x2320000, 0xFFFFFFFF, 0x4D9418, 0x14708, 0x3249292, 0xFFFFFFFF, 0xFFFFFFFF, 0x1842490, 0xFFFFFFFF,
+    0x182E3, 0x3859240, 0xFFFFFFFF, 0x40C818, 0x30184A0, 0x308112, 0xC30CC, 0x16D1242, 0xFFFFFFFF, 0x148805C, 0x4C924C, 0xFFFFFFFF,
+    0x2601243, 0x6522C2, 0x3603000, 0x25130B, 0x258064, 0x890003, 0x6D9800, 0xFFFFFFFF, 0x1659240, 0x10C258, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1891800, 0x49005C, 0xFFFFFFFF, 0x689800, 0xFFFFFFFF, 0xFFFFFFFF, 0x2600109, 0xE10D8, 0x689249, 0x25B0C3, 0x30A603, 0x1309800,
+    0x324804C, 0x661240, 0x403848, 0x6094C8, 0x12A4, 0x11918, 0x6482DA, 0x18C3003, 0x1843840, 0x168A488, 0x30C640, 0xC0890,
+    0x128C080, 0x250004C, 0xFFFFFFFF, 0x600613, 0x723, 0xC02DA, 0x22606C0, 0x849243, 0x251692, 0x30C0490, 0x1250891, 0x1313000,
+    0xD86C9, 0x3000320, 0x300B203, 0x61B002, 0x38C8600, 0x188C400, 0x26C0600, 0x681858, 0x4310018, 0x284C240, 0x125804C, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xA2092, 0x31B000, 0xFFFFFFFF, 0x4A310, 0x12C2483, 0xFFFFFFFF, 0x20610C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x661013, 0xFFFFFFFF, 0x26004B, 0x92492, 0x142A1, 0x128984A, 0xFFFFFFFF, 0x20C0603, 0x1900602, 0x6CB448, 0x6490CC, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2E1840, 0x60B2D8, 0x453500, 0x1A483, 0x4840648, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C0262, 0xFFFFFFFF, 0x2092308, 0x12A10C2,
+    0x30016D2, 0x692258, 0xFFFFFFFF, 0x291291, 0xC36C9, 0x3083490, 0x63618, 0x24820D8, 0x30C9000, 0x464018, 0xFFFFFFFF, 0x8E0049,
+    0x1488098, 0x30C0708, 0x28E1000, 0x4488258, 0x2121003, 0x4240649, 0xFFFFFFFF, 0x6028C9, 0x10493, 0x34092D8, 0xFFFFFFFF, 0x53440,
+    0x1703049, 0x80603, 0x308602, 0xFFFFFFFF, 0x490098, 0x3092418, 0x8004C, 0x30CA4C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x324864B, 0x528C0,
+    0xFFFFFFFF, 0x18A3, 0xFFFFFFFF, 0x1899000, 0x3262018, 0x201864C, 0x2662240, 0x60950A, 0x1309283, 0x128C680, 0x400709, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x849842, 0x3009218, 0x254848, 0x309508, 0x340030B, 0xFFFFFFFF, 0xE1003, 0x64400,
+    0x248030A, 0x61B602, 0xFFFFFFFF, 0xFFFFFFFF, 0x4240418, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C2248, 0xFFFFFFFF, 0xFFFFFFFF, 0x3610308, 0x30096C0,
+    0x3509049, 0x12861, 0xFFFFFFFF, 0x3602291, 0x425824A, 0xFFFFFFFF, 0x25B490, 0xA20D8, 0x3248418, 0xFFFFFFFF, 0x18D4000, 0xFFFFFFFF,
+    0x609891, 0x6C9448, 0x64B260, 0xFFFFFFFF, 0x300024B, 0x6092DA, 0x924C0, 0xC2248, 0x324A458, 0x326024A, 0x24870B, 0xFFFFFFFF,
+    0x124A4C0, 0xC3260, 0xFFFFFFFF, 0x848010, 0x24C2C3, 0x2620C3, 0x12612D0, 0x34000D8, 0x3119600, 0x61610, 0x3004888, 0xFFFFFFFF,
+    0xC443, 0x23818, 0x42C92C0, 0x6105C, 0xFFFFFFFF, 0x618258, 0xFFFFFFFF, 0x23261, 0x496C3, 0x2292289, 0x908083, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x24283, 0xFFFFFFFF, 0x10A299, 0x600308, 0x60B200, 0x318248, 0x32D12C0, 0x4243248, 0xFFFFFFFF, 0x601300, 0x1689603,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x42400C2, 0x3000010, 0x168904C, 0x308649, 0xFFFFFFFF, 0x649492, 0x401889, 0x300261B, 0x2482003, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C9491, 0xFFFFFFFF, 0xFFFFFFFF, 0x1A291, 0x42C1300, 0xFFFFFFFF, 0x248148A, 0x614449, 0x1B293,
+    0xC9213, 0xFFFFFFFF, 0x2503248, 0x36D0018, 0xFFFFFFFF, 0x8A1600, 0xC34D8, 0xE1603, 0x849888, 0x422458, 0x2849258, 0x3049649,
+    0xFFFFFFFF, 0x3908010, 0x20C1318, 0x251710, 0xC6C0, 0x3049092, 0x324125B, 0x3600291, 0x4300003, 0xFFFFFFFF, 0x6184C3, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x24B41B, 0x93640, 0x128A0, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C8403, 0xFFFFFFFF, 0xFFFFFFFF, 0x691, 0x1A618,
+    0x324B018, 0xFFFFFFFF, 0x2492C0, 0x263248, 0x1A061, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C324B, 0x12494E0, 0x184C3, 0x2308291,
+    0x34C0848, 0x4030DB, 0x602000, 0x124A502, 0xFFFFFFFF, 0x28800C3, 0x4A840, 0x2D1261, 0x30180C0, 0x428C080, 0xC0123, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x98D3, 0x6D8400, 0x3600061, 0xFFFFFFFF, 0xFFFFFFFF, 0x25925B, 0x125B018, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4258610, 0x60B800, 0x1300683, 0xFFFFFFFF, 0x49125A, 0x6826C8, 0x10A2D8, 0x301A, 0x3400000, 0x2601300, 0x36030C0,
+    0x300061A, 0x2480003, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x34D1248, 0x1664200, 0x4C3018, 0x30B240, 0x18293, 0x6494D8, 0x18C0061,
+    0x248510, 0x301B002, 0x4D8848, 0x1A891, 0xDA440, 0xFFFFFFFF, 0x2E00C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x2692600, 0x30812A1, 0x3000510,
+    0x148A603, 0x2489802, 0x312440, 0x2261300, 0xFFFFFFFF, 0x40B683, 0x683018, 0x618063, 0xFFFFFFFF, 0x1C310, 0xD9309, 0x84C480,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3049683, 0x3241858, 0x26C1240, 0xFFFFFFFF, 0x60011C, 0xFFFFFFFF, 0x318061, 0x64884B, 0x369B000, 0x1491249,
+    0x1241303, 0x2493000, 0x4642480, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x26124C, 0x30D004C, 0x2249858, 0xFFFFFFFF, 0x26C0109, 0x2482E0,
+    0xFFFFFFFF, 0x3291, 0xFFFFFFFF, 0x652603, 0x201B618, 0x1122C9, 0x82498, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2CB0C0, 0x24B900,
+    0x260112, 0x1B0C3, 0xFFFFFFFF, 0x49860, 0x20C06C3, 0x36C90C0, 0x2711010, 0xA49C, 0xC48C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x89693,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xC4309, 0xFFFFFFFF, 0xFFFFFFFF, 0x258263, 0xC4D2, 0xFFFFFFFF, 0x2602483, 0x200A8D0, 0xFFFFFFFF, 0x609249,
+    0x1258490, 0x2248603, 0xFFFFFFFF, 0x4241289, 0xFFFFFFFF, 0x30C90C3, 0x1912200, 0xCB508, 0x663018, 0xFFFFFFFF, 0x24968C, 0x60B292,
+    0x4A0, 0xFFFFFFFF, 0xFFFFFFFF, 0x402483, 0xFFFFFFFF, 0x30A260, 0x18891, 0xD0109, 0x662480, 0x2C82DA, 0x4C0490, 0x125004C,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x7090C9, 0x18C4240, 0x301B04B, 0x125264A, 0x2251849, 0xFFFFFFFF, 0x2001900, 0xFFFFFFFF, 0x2483098, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x84A480, 0x40A6A0, 0x121013, 0xFFFFFFFF, 0xFFFFFFFF, 0xC9294, 0x4C691, 0x40B6C9, 0x25A64A, 0x61C240,
+    0x649400, 0x490049, 0x201241B, 0x30092D0, 0x204A4D1, 0x30496D0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1240320, 0x462300,
+    0xD3049, 0xFFFFFFFF, 0xFFFFFFFF, 0x10B109, 0x30D0649, 0x144C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x30104D9, 0x80493, 0x30B04B, 0xFFFFFFFF,
+    0x64A8C0, 0x2004840, 0x2E0490, 0x30C201B, 0xFFFFFFFF, 0x1A6A0, 0x2A10C0, 0xFFFFFFFF, 0x12C92C0, 0x60004C, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3000314, 0x20D8092, 0xFFFFFFFF, 0xFFFFFFFF, 0x1B112, 0x498A1, 0x3001313, 0x344C000, 0x25A41A, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x34C0308, 0xFFFFFFFF, 0x11C0C0, 0x8C292, 0x6C0094, 0xCC688, 0x4A300, 0x85144A, 0x911000, 0x124428B, 0xFFFFFFFF, 0xD1840,
+    0x4241888, 0xFFFFFFFF, 0xFFFFFFFF, 0x1249448, 0x14D1449, 0xFFFFFFFF, 0x663600, 0xFFFFFFFF, 0x80260, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x12E2018, 0xFFFFFFFF, 0xC0092, 0xFFFFFFFF, 0x4024C9, 0x12CA688, 0x4D9449, 0xFFFFFFFF, 0x3499210, 0xFFFFFFFF,
+    0x30000DA, 0x80709, 0x1689109, 0x1831B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x204904C, 0xFFFFFFFF, 0x2254448, 0x34C00D8,
+    0xFFFFFFFF, 0x121610, 0xFFFFFFFF, 0xB2C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x10B260, 0x124149B, 0x3124C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x24A018, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3609203, 0x10910B, 0x4318010, 0x6C030A, 0x3413640, 0x200024B, 0xFFFFFFFF,
+    0x698308, 0x124B249, 0x320418, 0x2609491, 0xFFFFFFFF, 0x360B249, 0x14912C2, 0x2602A1, 0x3661400, 0xFFFFFFFF, 0xFFFFFFFF, 0x3001488,
+    0x253818, 0xFFFFFFFF, 0x180E1, 0xFFFFFFFF, 0x3083248, 0x711218, 0xFFFFFFFF, 0x1252459, 0xFFFFFFFF, 0xDA291, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x185A0C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x300B249, 0x3293248, 0x3652280, 0xFFFFFFFF, 0x44A0400, 0xE4600, 0xFFFFFFFF,
+    0x2521200, 0x4640848, 0x3062448, 0xFFFFFFFF, 0x54218, 0x12C148B, 0xFFFFFFFF, 0x6C00D8, 0x29A280, 0xD0860, 0xFFFFFFFF, 0x24A848,
+    0x609880, 0x13012C0, 0xFFFFFFFF, 0x36042C0, 0x2DA0C0, 0xFFFFFFFF, 0x1689260, 0xFFFFFFFF, 0x13180D0, 0x4241309, 0x2649092, 0x81889,
+    0x2498013, 0x3843018, 0xFFFFFFFF, 0x848002, 0x2D1203, 0x2483243, 0x3092C0, 0xFFFFFFFF, 0x1292618, 0x34D8600, 0x3003293, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x211B400, 0xFFFFFFFF, 0x201C488, 0xFFFFFFFF, 0x4C30D8, 0x6C2003, 0x2693240, 0xFFFFFFFF, 0x8484C0, 0x10A840, 0xFFFFFFFF,
+    0x4508003, 0x448B400, 0x360204C, 0x4258003, 0x248013, 0x25B248, 0x6C148A, 0x293308, 0x659092, 0xFFFFFFFF, 0x601313, 0x1249810,
+    0xFFFFFFFF, 0x3242498, 0x4244250, 0xFFFFFFFF, 0xFFFFFFFF, 0x61C2C0, 0x6CB800, 0x1289648, 0x400294, 0x3014258, 0xFFFFFFFF, 0x30D1240,
+    0x1925A, 0x128909B, 0x660291, 0x3002049, 0xFFFFFFFF, 0x18C3, 0xFFFFFFFF, 0x20012A1, 0x3098618, 0x4180C3, 0x610291, 0x131A,
+    0x3059248, 0xFFFFFFFF, 0x201C258, 0xFFFFFFFF, 0xFFFFFFFF, 0x3911, 0x260061B, 0xFFFFFFFF, 0x148B013, 0x12C0003, 0x4CC200, 0x3848449,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x20C1303, 0x6000C2, 0x206124B, 0x1084B, 0xFFFFFFFF, 0x261B000, 0x8600C0, 0xFFFFFFFF, 0x449308, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x54818, 0x248848, 0x421309, 0x9204C, 0xFFFFFFFF, 0x1289403, 0x4242482, 0xFFFFFFFF, 0x3649403, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x324B003, 0x165B0C0, 0x44D2200, 0x6098C2, 0x1301302, 0xFFFFFFFF, 0xFFFFFFFF, 0x3001858, 0x2481243, 0x12494C8, 0x184A3, 0xC384A,
+    0x3083618, 0x4030C0, 0x2482260, 0xFFFFFFFF, 0x34006C3, 0xC3291, 0x6630C0, 0x201A483, 0x24806C2, 0x309302, 0x2124B, 0xFFFFFFFF,
+    0xDB680, 0xFFFFFFFF, 0xFFFFFFFF, 0x2061018, 0x1B510, 0xDB0C0, 0x360004B, 0x148A260, 0x204C248, 0x930B, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2024249, 0x25B848, 0x348C240, 0x18890D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x10A2C0, 0xFFFFFFFF, 0x125A489, 0x513003, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x260449, 0x304A309, 0x64B061, 0x3260602, 0x400891, 0x10C300, 0x2494240, 0x19853, 0x6494C3, 0x18C004C,
+    0xFFFFFFFF, 0x2483610, 0x9B618, 0xFFFFFFFF, 0xFFFFFFFF, 0x20018A1, 0xFFFFFFFF, 0xFFFFFFFF, 0x1910, 0x6D3000, 0x8C8603, 0xFFFFFFFF,
+    0x4261280, 0xFFFFFFFF, 0xC24B, 0x294248, 0xFFFFFFFF, 0x3613049, 0x3001508, 0x204C018, 0xFFFFFFFF, 0x3061002, 0xFFFFFFFF, 0x1488490,
+    0x12C0049, 0x6006C3, 0x2061848, 0xFFFFFFFF, 0xFFFFFFFF, 0x4243600, 0xFFFFFFFF, 0x25B04C, 0x449908, 0x3063049, 0x5225C, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x609458, 0x894010, 0xCA708, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1804B, 0x649291, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x12C9849, 0xFFFFFFFF, 0x130B218, 0xFFFFFFFF, 0xFFFFFFFF, 0x418490, 0x119003, 0x429C, 0xFFFFFFFF, 0x3418649, 0xFFFFFFFF, 0x692418,
+    0xFFFFFFFF, 0x945B, 0xFFFFFFFF, 0x4984A, 0x30012DB, 0x80323, 0x3291610, 0x1251289, 0xC32D2, 0xFFFFFFFF, 0x40C460, 0x603049,
+    0x9B2D0, 0x3049449, 0x14E1003, 0x360064B, 0xFFFFFFFF, 0x251508, 0x204C848, 0x6C2649, 0xFFFFFFFF, 0x65A243, 0xFFFFFFFF, 0x1719000,
+    0xFFFFFFFF, 0x130224B, 0x649618, 0xFFFFFFFF, 0x1488708, 0x2049109, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x248098, 0x258709,
+    0x6C9848, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x419840, 0xFFFFFFFF, 0x30A248, 0x130944A, 0x2308649, 0x403493, 0x24A0DB, 0x12492DA,
+    0x449000, 0xFFFFFFFF, 0x128C289, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x192D8, 0xC30A2, 0xFFFFFFFF, 0x151C000, 0x4C24C9, 0x42892C8,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3600418, 0x20C921B, 0x3021213, 0x1253092, 0x23658, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24A3200,
+    0x3061049, 0xFFFFFFFF, 0xFFFFFFFF, 0x63489, 0x1852402, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x124030A, 0x258,
+    0xFFFFFFFF, 0x65A4C0, 0x2C8649, 0xFFFFFFFF, 0x30A018, 0x3052448, 0x1309218, 0x128C610, 0x70C000, 0x24B488, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x288024B, 0x4242500, 0xFFFFFFFF, 0x24830B, 0x3649488, 0x1A68B, 0x324B083, 0x8D9049, 0x41B092, 0x8921B, 0x1718, 0x294610,
+    0x36892C0, 0x708308, 0xFFFFFFFF, 0x80920, 0x61841B, 0x1888248, 0xFFFFFFFF, 0x3099488, 0x300130C, 0x25A403, 0xFFFFFFFF, 0x14E1600,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2483300, 0x1243258, 0x6C0083, 0xFFFFFFFF, 0x360324A, 0x71A400, 0x1491600, 0x259889, 0x13248, 0xFFFFFFFF,
+    0x4240291, 0xFFFFFFFF, 0xFFFFFFFF, 0x4E12C0, 0xFFFFFFFF, 0x340A500, 0xFFFFFFFF, 0x2512000, 0x1842000, 0x364B, 0xFFFFFFFF, 0x1289262,
+    0x3092059, 0x2480DA, 0x2480603, 0x190001A, 0x1A458, 0xFFFFFFFF, 0x16492C0, 0x1120C0, 0x60C2D0, 0xFFFFFFFF, 0x130C049, 0x230B248,
+    0x151A002, 0x1849203, 0x30C125A, 0x9249, 0x1888018, 0xD948A, 0xFFFFFFFF, 0x184B800, 0x60084B, 0xFFFFFFFF, 0x292289, 0x6512C0,
+    0xFFFFFFFF, 0x14A2000, 0x1240464, 0x4294200, 0x3849640, 0x3081303, 0x6404B, 0x6910D8, 0x12530D8, 0xC2CC, 0xD001B, 0x4B0DB,
+    0xFFFFFFFF, 0x12C324B, 0x1249203, 0xFFFFFFFF, 0xCB8C0, 0xFFFFFFFF, 0x853249, 0x80018, 0x30801A, 0x2600121, 0xFFFFFFFF, 0x1641318,
+    0x2E0018, 0x25B0C0, 0x3491250, 0xFFFFFFFF, 0x3248063, 0x2CB248, 0x149801B, 0xFFFFFFFF, 0x6C9092, 0x1309259, 0x2880848, 0x4930D0,
+    0x24B4C0, 0xFFFFFFFF, 0x180CC, 0xFFFFFFFF, 0xD925A, 0x400124, 0xFFFFFFFF, 0x89818, 0xFFFFFFFF, 0x2600003, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x24818C0, 0x3651249, 0x2244C, 0xC964C, 0xFFFFFFFF, 0x859300, 0xFFFFFFFF, 0x94DC, 0x2914D8, 0xDC2C0, 0x4C48B, 0xFFFFFFFF,
+    0x204A889, 0x2711080, 0x1303403, 0xFFFFFFFF, 0x1644258, 0xFFFFFFFF, 0x6030C9, 0x6C00C0, 0xFFFFFFFF, 0x2000000, 0xFFFFFFFF, 0x4303002,
+    0x30214C8, 0xFFFFFFFF, 0x24D2210, 0x2891248, 0x42DB000, 0x80848, 0x261640, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C30C0, 0x20C0618, 0x36C9018,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x6490E1, 0x3083003, 0x3003840, 0x24810B, 0x46A1, 0x1A49A, 0xC4250, 0x2009803, 0x409249, 0x1240000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x20182DA, 0x300010C, 0x3293000, 0xFFFFFFFF, 0xFFFFFFFF, 0x6518C0, 0x4969B, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x6C044C, 0x3062200, 0xFFFFFFFF, 0x4251289, 0x423680, 0x6002DC, 0x4640049, 0xFFFFFFFF, 0xFFFFFFFF, 0x851249, 0x601303, 0x1249800,
+    0x6C2490, 0x131B002, 0x42400A2, 0x53458, 0x300C4C8, 0xA1309, 0xFFFFFFFF, 0xFFFFFFFF, 0x164C800, 0x12C010C, 0x80049, 0x3648049,
+    0xC0449, 0x6E1018, 0x12A3003, 0x85B000, 0x251802, 0xFFFFFFFF, 0x224A480, 0xFFFFFFFF, 0xFFFFFFFF, 0x41C258, 0xFFFFFFFF, 0x4D9240,
+    0x45C640, 0x3418260, 0x7094C0, 0x24B509, 0x2482480, 0xFFFFFFFF, 0xFFFFFFFF, 0x209B448, 0x4A0603, 0x109018, 0xFFFFFFFF, 0x8A1018,
+    0x260004C, 0x4A48A, 0x5C0D8, 0x4889002, 0x25B003, 0x304A640, 0x22489, 0xFFFFFFFF, 0x148A482, 0xFFFFFFFF, 0x614300, 0x951B,
+    0xFFFFFFFF, 0x49044C, 0x1094C0, 0xFFFFFFFF, 0x6C06C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x54249, 0x3618098, 0x1240719, 0xFFFFFFFF, 0x13898,
+    0x2260600, 0x66004C, 0x112259, 0xFFFFFFFF, 0x1689, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x264242, 0xFFFFFFFF, 0x3059003,
+    0xD8049, 0x5B449, 0xFFFFFFFF, 0x61264A, 0xFFFFFFFF, 0x64A700, 0xFFFFFFFF, 0x18C1289, 0x3018094, 0x1240600, 0x16A10C0, 0xFFFFFFFF,
+    0x4A25A, 0x201B490, 0x20DB049, 0x30DA248, 0x3499280, 0xCC018, 0x4C858, 0xFFFFFFFF, 0x2524D8, 0x4490C3, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x496D8, 0x12C1858, 0x908098, 0xFFFFFFFF, 0x216D8, 0x3109449, 0x3619448, 0xFFFFFFFF, 0x69B049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x6836C0, 0x1210C0, 0x319289, 0x64B04C, 0xFFFFFFFF, 0x12A1000, 0x3014840, 0x2490092, 0x19843, 0xFFFFFFFF, 0x2621448,
+    0x20124C0, 0x24B0A2, 0x8DA, 0x1928B, 0x64A4C9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4DC400, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1498092, 0x251283, 0xFFFFFFFF, 0x3409218, 0x24DA240, 0xFFFFFFFF, 0x10961A, 0x421448, 0x6112D2, 0xFFFFFFFF, 0xE1618, 0xFFFFFFFF,
+    0x344904C, 0x25B600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x8492D8, 0xFFFFFFFF, 0x204B480, 0x3112D0, 0xFFFFFFFF, 0x36002A1, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x30C9880, 0x891449, 0x512800, 0xFFFFFFFF, 0x40064C, 0xFFFFFFFF, 0x93658, 0x452690, 0x448A0C0, 0x660649, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2A104C, 0x499218, 0x1840083, 0x251618, 0x4D9610, 0x3059603, 0xFFFFFFFF, 0xFFFFFFFF, 0x4194A0,
+    0x4C3260, 0xFFFFFFFF, 0x1B098, 0x16D0418, 0xFFFFFFFF, 0x3018691, 0x12D2013, 0x370B, 0x1312400, 0x2000522, 0x40C448, 0xFFFFFFFF,
+    0x1240648, 0xFFFFFFFF, 0x46104C, 0xFFFFFFFF, 0x3003308, 0xFFFFFFFF, 0x8A68B, 0xFFFFFFFF, 0xFFFFFFFF, 0x1643649, 0x148A291, 0x18492C9,
+    0x30CC210, 0xA900, 0xFFFFFFFF, 0x490258, 0xFFFFFFFF, 0xFFFFFFFF, 0x621600, 0x1300698, 0xFFFFFFFF, 0x2013643, 0x248083, 0x4319200,
+    0x3049318, 0x13000DA, 0x64B649, 0x12A1600, 0x418248, 0x2493248, 0x8900D8, 0xFFFFFFFF, 0x3249261, 0xFFFFFFFF, 0x301A000, 0x1902003,
+    0x9213, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x800D8, 0x3080D8, 0x34D8, 0xFFFFFFFF, 0x3080291, 0x20C148B, 0x60024B, 0xFFFFFFFF,
+    0x1B8C8, 0xFFFFFFFF, 0x2889200, 0xFFFFFFFF, 0x86024A, 0xFFFFFFFF, 0x1B30A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3023800, 0xFFFFFFFF,
+    0x1302000, 0xFFFFFFFF, 0x490013, 0x248418, 0x898D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x3680061, 0x4A50B, 0x3619242, 0x60C600, 0x6C12C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x10B0D8, 0xFFFFFFFF, 0x22DB240, 0x648294, 0x4904C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x1858013, 0x1131B,
+    0xC0858, 0x324A04C, 0x5C600, 0x81488, 0xFFFFFFFF, 0x34900C0, 0x2A1092, 0xFFFFFFFF, 0xFFFFFFFF, 0x600013, 0x12E3240, 0xFFFFFFFF,
+    0x294600, 0xFFFFFFFF, 0x2CB0D8, 0x80908, 0x1250291, 0xFFFFFFFF, 0x325124B, 0x20194D1, 0x3009649, 0xFFFFFFFF, 0x428B0C0, 0x384B400,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x18CC200, 0x1243240, 0xFFFFFFFF, 0xFFFFFFFF, 0x2618848, 0x4A2D8, 0xFFFFFFFF, 0x12400C2, 0x10, 0x2602498,
+    0xFFFFFFFF, 0x852442, 0x4242C0, 0x260018, 0xFFFFFFFF, 0xD1258, 0x4C318, 0x680121, 0x248683, 0x124A440, 0x2248061, 0xD3848,
+    0xFFFFFFFF, 0x20C0003, 0x1843013, 0x1900002, 0x1A440, 0xFFFFFFFF, 0x1299308, 0xFFFFFFFF, 0xFFFFFFFF, 0x9813, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x7080C0, 0x3004250, 0x252442, 0x124930B, 0x1C483, 0xFFFFFFFF, 0x3099240, 0x680000, 0x301C640, 0x351A, 0x3848610, 0x2001918,
+    0x8E0000, 0x24830C0, 0xFFFFFFFF, 0x1300003, 0x293291, 0xFFFFFFFF, 0x2D3680, 0x90A049, 0x1909248, 0x13018, 0xFFFFFFFF, 0x4240049,
+    0x344C248, 0x14A1448, 0x61C249, 0xFFFFFFFF, 0xFFFFFFFF, 0x4242649, 0x689818, 0xFFFFFFFF, 0x3403, 0xFFFFFFFF, 0x4700049, 0xFFFFFFFF,
+    0x41861B, 0xFFFFFFFF, 0x2052261, 0xFFFFFFFF, 0xD3061, 0xFFFFFFFF, 0x2DA2C8, 0x6094CB, 0x1249692, 0x144D8, 0x230B000, 0x4930C2,
+    0xFFFFFFFF, 0x611243, 0x42A1000, 0xFFFFFFFF, 0x128C083, 0x3002483, 0xFFFFFFFF, 0x4289680, 0x3844240, 0xFFFFFFFF, 0x3084243, 0x849240,
+    0x1840109, 0x6106C3, 0x3049010, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000322, 0xFFFFFFFF, 0x61010C, 0x94DA, 0x18A2200, 0xFFFFFFFF, 0x3618602,
+    0x12C3000, 0x1242263, 0xFFFFFFFF, 0xFFFFFFFF, 0x3083109, 0xFFFFFFFF, 0x12406C9, 0x31B003, 0xFFFFFFFF, 0xFFFFFFFF, 0x4A31A, 0x301241A,
+    0x1240109, 0xFFFFFFFF, 0xFFFFFFFF, 0xD1858, 0x2CB003, 0xFFFFFFFF, 0x1249460, 0xFFFFFFFF, 0x18449, 0x64C248, 0x20C0600, 0x12CC800,
+    0x168A258, 0xFFFFFFFF, 0xFFFFFFFF, 0x1289293, 0x2CA480, 0x30128C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x7086C0, 0x3621280, 0xFFFFFFFF,
+    0x9C243, 0xFFFFFFFF, 0x653440, 0x12A10C0, 0x61013, 0x11B448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x49680, 0x3889000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1300602, 0xFFFFFFFF, 0xFFFFFFFF, 0x344A243, 0x30C32C8, 0xFFFFFFFF, 0x2121000, 0x65A648, 0xFFFFFFFF, 0x8602C8, 0x25C240,
+    0x1302649, 0xFFFFFFFF, 0x4B109, 0x1659289, 0x80600, 0x308603, 0xFFFFFFFF, 0x2600709, 0x4900A2, 0x3303049, 0x2E0603, 0xFFFFFFFF,
+    0x124D0, 0x513440, 0x2001840, 0x40128C, 0x1841840, 0x60C688, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x224B490, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x230B, 0x305A240, 0xD9289, 0x3084840, 0x1840708, 0x24808C8, 0x1692249,
+    0x3400308, 0xCB21B, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C04D8, 0x3049059, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x11843,
+    0x2940C9, 0x32512D0, 0x30096C3, 0x1852800, 0x44A300, 0x30E3200, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x324841B, 0xFFFFFFFF, 0x2CB600, 0x609898, 0x94, 0x1B603, 0x510092, 0x661059, 0x3622400, 0x4C064C, 0x2692, 0xFFFFFFFF,
+    0x64C289, 0x3260248, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x209B203, 0x3002294, 0x3018080, 0x3092C3, 0x311603, 0x34000DB,
+    0x4A243, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C02A1, 0x9894, 0xCC000, 0xDB098, 0x68064C, 0x301A0C3, 0x1863200, 0x1C508, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3009491, 0x4CC448, 0xFFFFFFFF, 0x1300648, 0xFFFFFFFF, 0x49109, 0x344A289, 0x60B203, 0xFFFFFFFF, 0x1300080, 0x324148B,
+    0x424324A, 0x26D8248, 0x30212C2, 0xFFFFFFFF, 0x1310109, 0xFFFFFFFF, 0x709600, 0x24B649, 0x3510018, 0xFFFFFFFF, 0x18258, 0x2000860,
+    0x709049, 0x2E3200, 0x612402, 0xFFFFFFFF, 0xFFFFFFFF, 0x12890A2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1A294, 0xC1498, 0xFFFFFFFF,
+    0x3003080, 0x691049, 0x124C2D0, 0x3059260, 0x3409200, 0x4C618, 0x109613, 0x2489203, 0x618000, 0xFFFFFFFF, 0xFFFFFFFF, 0x3611488,
+    0x2D1491, 0x30198C0, 0x6C0248, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x851600, 0x698248, 0x6C2848, 0xFFFFFFFF, 0xE3640, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x6026D8, 0x11889, 0xFFFFFFFF, 0x2092000, 0x3618680, 0x2DB250, 0x43100C0, 0xFFFFFFFF, 0x64A840, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2482A1, 0xFFFFFFFF, 0x622840, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C9261, 0x260691, 0x45B418, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2600D3, 0x205B400, 0x30522D0, 0xD1318, 0x49B249, 0x3002891, 0x602003, 0xA453, 0x34006D8, 0x20030C3, 0x4A842, 0x30180C2,
+    0x81303, 0x46D0002, 0x1A503, 0x324001B, 0x148925A, 0xFFFFFFFF, 0x30C02E0, 0xC493, 0x1310291, 0x3601640, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x30CC200, 0xFFFFFFFF, 0x1318010, 0xFFFFFFFF, 0x3610109, 0xFFFFFFFF, 0x60B803, 0x45244B, 0xFFFFFFFF, 0x491258, 0x1489700, 0xFFFFFFFF,
+    0x1240510, 0x3400003, 0x260C200, 0x524A1, 0x300061B, 0xFFFFFFFF, 0xFFFFFFFF, 0x320010, 0xD8403, 0x5B800, 0x41925B, 0x2482603,
+    0x124A889, 0xFFFFFFFF, 0x64C098, 0x491700, 0x24B0D0, 0x301B01A, 0x30D8002, 0x2251800, 0xDA443, 0x1488002, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x48C1240, 0xFFFFFFFF, 0x201B291, 0x1841302, 0x8A443, 0x96A3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x90B010, 0x12514D1,
+    0x6C3400, 0xFFFFFFFF, 0x4C094, 0x109080, 0x6006D8, 0xFFFFFFFF, 0x14E1248, 0xFFFFFFFF, 0xFFFFFFFF, 0x36C3002, 0x89309, 0x311308,
+    0x1892210, 0x65A488, 0xFFFFFFFF, 0x61308, 0x1241302, 0x618509, 0xFFFFFFFF, 0xFFFFFFFF, 0x34D1018, 0xFFFFFFFF, 0x364B000, 0x30B010,
+    0x18061, 0x42C06C0, 0xFFFFFFFF, 0x229A2C0, 0xFFFFFFFF, 0x89A210, 0x1A661, 0x3244300, 0x49924B, 0x20D8618, 0x112, 0xFFFFFFFF,
+    0x293003, 0xFFFFFFFF, 0xFFFFFFFF, 0x18D9240, 0x1251858, 0x32C86C0, 0xFFFFFFFF, 0x49862, 0xFFFFFFFF, 0x30186C0, 0xFFFFFFFF, 0x21860,
+    0xFFFFFFFF, 0x492A4, 0x681240, 0x604640, 0x6C0059, 0x212A2, 0xFFFFFFFF, 0xFFFFFFFF, 0x1489299, 0x3021458, 0x9912, 0x1301242,
+    0x36000A2, 0x3121400, 0x12C0891, 0x2592A1, 0x125B059, 0x1303840, 0x491850, 0x68010C, 0x3014400, 0xFFFFFFFF, 0x13006C2, 0xC061A,
+    0x491299, 0xFFFFFFFF, 0x44D1002, 0x3063, 0xFFFFFFFF, 0xFFFFFFFF, 0x360B448, 0x2C8891, 0x248004C, 0x30D3440, 0x18890, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x24B6D0, 0x92318, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3002692, 0x842A1, 0xFFFFFFFF, 0xFFFFFFFF, 0x2001903,
+    0xFFFFFFFF, 0x1488049, 0x601853, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x148A649, 0x2489848, 0xFFFFFFFF, 0x2916C0, 0x200A6A0,
+    0x22910C0, 0x109683, 0x603890, 0x348B049, 0x649403, 0x4C0D3, 0x4258403, 0x600719, 0x12408E0, 0x1300492, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4259448, 0x12D8490, 0x124B218, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C2308, 0x18663, 0x128B04C, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4C1843, 0x3890, 0xFFFFFFFF, 0x2880260, 0x499848, 0x249900, 0x25321B, 0xFFFFFFFF, 0xFFFFFFFF, 0x64A309, 0x1649508,
+    0x18400D3, 0x249A248, 0xFFFFFFFF, 0x2241B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x32D2018, 0xFFFFFFFF, 0x344C003,
+    0x12D2080, 0x124224B, 0xFFFFFFFF, 0x3240649, 0xFFFFFFFF, 0x165B600, 0x69B210, 0x204A2A1, 0x1300260, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x911003, 0x891840, 0xFFFFFFFF, 0xD0260, 0xFFFFFFFF, 0x12C3490, 0xFFFFFFFF, 0xA1508, 0x116D3, 0xFFFFFFFF, 0x54682, 0x3014449,
+    0x80263, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3308418, 0x2496D0, 0x2664000, 0x9B210, 0xFFFFFFFF, 0x3249888, 0x858092, 0xFFFFFFFF,
+    0x32A1049, 0xFFFFFFFF, 0x189A240, 0x200921B, 0x2019889, 0xFFFFFFFF, 0xFFFFFFFF, 0x9280, 0xFFFFFFFF, 0x3692400, 0x1488649, 0x3289109,
+    0x30D8080, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C9261, 0xFFFFFFFF, 0x22691, 0xFFFFFFFF, 0xE2243, 0x691109, 0x6012D4,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4241658, 0x1096C9, 0x30C9490, 0x114A0, 0xFFFFFFFF, 0x164030B, 0xFFFFFFFF, 0x12C16D0, 0x4CC2C0,
+    0x62144A, 0xFFFFFFFF, 0xE1109, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x64B482, 0xFFFFFFFF, 0xFFFFFFFF, 0x25121B, 0x12D2,
+    0x1B25B, 0x20920C0, 0xFFFFFFFF, 0x1652400, 0x1858080, 0x38D2, 0x291049, 0xFFFFFFFF, 0x26C84C0, 0xFFFFFFFF, 0x30C2061, 0x124B700,
+    0xC030A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C04C3, 0x1909600, 0x3401318, 0x65A403, 0xFFFFFFFF, 0x14A0248, 0x124284B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x253700, 0xFFFFFFFF, 0x1284C, 0x3243248, 0xD2402, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C00DA,
+    0xFFFFFFFF, 0x661602, 0xFFFFFFFF, 0x6980D8, 0x609883, 0xFFFFFFFF, 0x2260018, 0xFFFFFFFF, 0xFFFFFFFF, 0x261658, 0x168A840, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x5B41A, 0x26E1200, 0xFFFFFFFF, 0x2498010, 0xC0694, 0x2A4049, 0x3308449, 0x3019643, 0x2483240, 0x524, 0x30542C0,
+    0xDA061, 0x409264, 0xFFFFFFFF, 0x124001A, 0x125324B, 0xFFFFFFFF, 0x3600018, 0x3000123, 0x14A0010, 0x3293018, 0x92C0, 0x2324C,
+    0xFFFFFFFF, 0x148B240, 0x109260, 0x922000, 0x4508000, 0x24C9258, 0x4A6D0, 0x4258000, 0x25B24B, 0xFFFFFFFF, 0xFFFFFFFF, 0xC98C2,
+    0x3258848, 0x84A500, 0x112003, 0x1249818, 0xFFFFFFFF, 0x26180C3, 0xFFFFFFFF, 0x109708, 0x6A1203, 0xFFFFFFFF, 0xFFFFFFFF, 0x200084B,
+    0x2C9258, 0x12C0121, 0xFFFFFFFF, 0x309643, 0x19258, 0x651203, 0x5964C, 0x2483010, 0x20522C0, 0xFFFFFFFF, 0x3720000, 0xFFFFFFFF,
+    0x3262049, 0x24A500, 0x83692, 0x1253018, 0xFFFFFFFF, 0x4B018, 0x84884A, 0x908400, 0xFFFFFFFF, 0x1C2C3, 0xC34C0, 0xFFFFFFFF,
+    0x109000, 0x600683, 0x1240848, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x860680, 0x30C30C2, 0xFFFFFFFF, 0x304A643, 0x3241243, 0x1658061,
+    0x8600C2, 0x1242883, 0xFFFFFFFF, 0x6DC200, 0xFFFFFFFF, 0x2C8000, 0x24884A, 0x12422DA, 0x3490610, 0x512218, 0x4703000, 0xFFFFFFFF,
+    0x12C14D1, 0x60B460, 0x13018C0, 0x31090D0, 0x659308, 0x526C3, 0xFFFFFFFF, 0x124C649, 0x1A04C, 0x2092490, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x610061, 0x370B000, 0xD8061, 0xFFFFFFFF, 0x2C94D1, 0x301C800, 0x36E1, 0xFFFFFFFF, 0xC3293, 0x34DA200, 0xFFFFFFFF,
+    0x30C0890, 0x9B291, 0x21249, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000720, 0x1240059, 0x920000, 0x2252489, 0x360004C, 0x61080, 0xFFFFFFFF,
+    0x8B680, 0x125B002, 0xCA499, 0x1643061, 0x26C3003, 0xFFFFFFFF, 0xFFFFFFFF, 0x61A880, 0x13122C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x6C9802, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1249859, 0x304A310, 0xFFFFFFFF, 0x493289, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x124929B, 0x2248493, 0x34C0603, 0x4002DA, 0x3002649, 0x3649680, 0xFFFFFFFF, 0xC3061, 0x12890CC, 0xFFFFFFFF, 0x249520, 0x36490C2,
+    0x1253603, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x251298, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x148B610, 0x300984B, 0x602260,
+    0xFFFFFFFF, 0x1C302, 0x494C0, 0x1520600, 0x603289, 0x123000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x682480, 0xFFFFFFFF, 0x61A092,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2618490, 0x2DA258, 0x609460, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x34D1003, 0x68C800, 0xFFFFFFFF, 0x224B,
+    0x1804C, 0x649293, 0x404243, 0xFFFFFFFF, 0x4D8603, 0xFFFFFFFF, 0x3401840, 0xFFFFFFFF, 0xFFFFFFFF, 0x85C400, 0x82480, 0xFFFFFFFF,
+    0x26092C0, 0x4840258, 0xFFFFFFFF, 0x301A24B, 0xFFFFFFFF, 0x2713, 0xC3890, 0xDC240, 0x361024B, 0xFFFFFFFF, 0x3720, 0x6C0603,
+    0x21848, 0xFFFFFFFF, 0xFFFFFFFF, 0x24832C8, 0x6136C0, 0xFFFFFFFF, 0x509848, 0xFFFFFFFF, 0x3003303, 0x25C403, 0x30CB203, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x361A018, 0x1719002, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x636C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x64A640,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x24809B, 0x60C848, 0x304B, 0x4493200, 0xFFFFFFFF, 0x3000648, 0x2514000, 0x124C458, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3000080, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x64C0C2, 0x4961B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3403092, 0xFFFFFFFF,
+    0x49059, 0x20C14A0, 0x89448, 0x613490, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x64000, 0x60128B, 0x44C061, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x200A68B, 0x300C448, 0xFFFFFFFF, 0x1258258, 0x306104B, 0xFFFFFFFF, 0x4C0C2, 0x36C2000, 0x1243488, 0xFFFFFFFF, 0xCB2C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x60C618, 0xFFFFFFFF, 0xFFFFFFFF, 0x5229B, 0x300041B, 0xFFFFFFFF, 0x6094A1, 0x130921A, 0xD14A0, 0x70C002,
+    0x403263, 0x60A4C0, 0x920D3, 0x3400860, 0xD24C0, 0xFFFFFFFF, 0x5C618, 0x814A0, 0x1252402, 0x1A688, 0xFFFFFFFF, 0x201B649,
+    0x149B000, 0x89218, 0x4289098, 0xFFFFFFFF, 0x22600D8, 0x403709, 0xFFFFFFFF, 0x2489600, 0x1251889, 0x294059, 0xFFFFFFFF, 0x4C44C,
+    0x300C218, 0x2049263, 0x38C8018, 0xFFFFFFFF, 0x26C001B, 0xFFFFFFFF, 0x3291098, 0x30D92C0, 0xB4DA, 0x212C9, 0xFFFFFFFF, 0x616C0,
+    0x10B482, 0x1253308, 0x22DA003, 0x8C8308, 0xFFFFFFFF, 0x1659488, 0xFFFFFFFF, 0x12426CA, 0x100D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x248698,
+    0x114218, 0x3648, 0x6E1210, 0x32430D8, 0x3261203, 0x20C001B, 0x3649258, 0x13702, 0xC1658, 0x128A28B, 0x16492C3, 0x301A618,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3499202, 0x324A880, 0x151A000, 0x252458, 0x84889, 0xFFFFFFFF, 0x188801B, 0xD9491, 0x3099258, 0x693250,
+    0x1903080, 0x3220C0, 0x6512C3, 0xFFFFFFFF, 0x300A443, 0x6002A1, 0x24A1200, 0xFFFFFFFF, 0x2601258, 0x3603013, 0xFFFFFFFF, 0x3021259,
+    0x618691, 0x3061648, 0xC92C2, 0x4241643, 0xFFFFFFFF, 0x9084C0, 0x6180D3, 0x11488, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x603303,
+    0x31B248, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C8002, 0x2E001B, 0xFFFFFFFF, 0x320403, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x251203, 0x260291,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x18C3018, 0x301B403, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x20006DB, 0x1488400, 0x8981B, 0x1692218,
+    0xFFFFFFFF, 0x3248509, 0xFFFFFFFF, 0xFFFFFFFF, 0x2484480, 0x4321, 0x1888848, 0xCC200, 0xFFFFFFFF, 0x861640, 0x90B400, 0x3488848,
+    0xFFFFFFFF, 0xC9092, 0x3258000, 0x14A1250, 0xFFFFFFFF, 0x6C3240, 0xCB690, 0x49314, 0x849700, 0xFFFFFFFF, 0x6030D8, 0x4509240,
+    0xFFFFFFFF, 0x2000003, 0xFFFFFFFF, 0x1494200, 0x124011C, 0xFFFFFFFF, 0x2260003, 0xFFFFFFFF, 0x2CB018, 0x8084B, 0x168924B, 0x6CA440,
+    0x310B0C0, 0x2619300, 0x30102DA, 0x4C0064, 0x2498003, 0xFFFFFFFF, 0x12892A1, 0x3092098, 0x24811C, 0xFFFFFFFF, 0xFFFFFFFF, 0xC16A1,
+    0x34C1243, 0x5A889, 0x30006CC, 0x2484250, 0xFFFFFFFF, 0x6D0061, 0xFFFFFFFF, 0xFFFFFFFF, 0x301A092, 0x3293003, 0x4292202, 0xFFFFFFFF,
+    0x8C9240, 0x680061, 0xFFFFFFFF, 0x619249, 0x1300618, 0x24259, 0xFFFFFFFF, 0xFFFFFFFF, 0x26522C0, 0x1243061, 0xFFFFFFFF, 0xC98C0,
+    0x1642483, 0xFFFFFFFF, 0x1853003, 0x329A202, 0x1464B, 0x3242480, 0x708000, 0x6830C0, 0x204C0D8, 0x618112, 0x224B003, 0x36806C0,
+    0xFFFFFFFF, 0x2E0618, 0x24C643, 0x308059, 0x19240, 0x324C800, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C0603, 0xFFFFFFFF, 0x1B84A, 0x324C240,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x611858, 0xFFFFFFFF, 0x186CC, 0xFFFFFFFF, 0x711800, 0xFFFFFFFF, 0x308509, 0xFFFFFFFF, 0xFFFFFFFF, 0x16D0059,
+    0x148B000, 0x10901B, 0xFFFFFFFF, 0x3401900, 0xFFFFFFFF, 0xFFFFFFFF, 0x64418, 0x604243, 0x61B610, 0x2860049, 0xFFFFFFFF, 0x52202,
+    0x165804C, 0xFFFFFFFF, 0x6C2260, 0x6C3840, 0x50A488, 0x16406C0, 0x30096D8, 0x6036D0, 0x14D1010, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x249850, 0x6986C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x184004B, 0x4289002, 0xFFFFFFFF, 0x6486C0, 0xFFFFFFFF, 0x4240318,
+    0x722200, 0x30D3049, 0xFFFFFFFF, 0xFFFFFFFF, 0x2003661, 0xFFFFFFFF, 0x4C4240, 0xFFFFFFFF, 0x22496D0, 0xC06C2, 0x308304C, 0x3612800,
+    0x3291002, 0x1240603, 0x34016D0, 0x3248318, 0x4A25B, 0x4252410, 0x14A0602, 0x44C248, 0x10603, 0xC9458, 0xFFFFFFFF, 0x10C403,
+    0x14A0049, 0x12516D0, 0x24CC400, 0xFFFFFFFF, 0x164304C, 0x109291, 0xFFFFFFFF, 0x1300659, 0xCB498, 0x49121, 0x851848, 0x3012803,
+    0x121680, 0x130009B, 0xFFFFFFFF, 0x6590C0, 0x52462, 0xFFFFFFFF, 0x1210C2, 0x224B603, 0x64B049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x60A698, 0x6CA258, 0xFFFFFFFF, 0x34D2240, 0xFFFFFFFF, 0x2E3202, 0x61241A, 0x22494A0, 0xD36C0, 0xFFFFFFFF, 0x85B049, 0x185A248,
+    0x31B, 0xFFFFFFFF, 0xFFFFFFFF, 0x3098649, 0x30004D8, 0x251280, 0xFFFFFFFF, 0x509003, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x8310C,
+    0xFFFFFFFF, 0x1889449, 0xFFFFFFFF, 0x4C061, 0x10905C, 0x3023203, 0x12524C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x1658649, 0xFFFFFFFF, 0x604289,
+    0xFFFFFFFF, 0x4488083, 0xFFFFFFFF, 0x2DA248, 0xFFFFFFFF, 0x60944B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x14D1059, 0x128C003, 0x2621218, 0xFFFFFFFF, 0xFFFFFFFF, 0x4289600, 0xFFFFFFFF, 0x42C00D8, 0xFFFFFFFF, 0x43004C0, 0x2480258, 0x320258,
+    0xFFFFFFFF, 0xD864B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x944A, 0x294002, 0xFFFFFFFF, 0x848659, 0x3291600, 0x308308, 0x44A240,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x148825B, 0x603013, 0xFFFFFFFF, 0x2061603, 0x22858, 0xFFFFFFFF, 0x300330A, 0xFFFFFFFF, 0x249A0C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x20CA458, 0x14A0083, 0xA903, 0x18880D8, 0xFFFFFFFF, 0x200B8C8, 0x30094E0, 0xFFFFFFFF, 0x452460, 0x210A289,
+    0x6596C0, 0x4A0308, 0xFFFFFFFF, 0xFFFFFFFF, 0x13000D8, 0xFFFFFFFF, 0x2092848, 0xFFFFFFFF, 0x2480018, 0xFFFFFFFF, 0x3660018, 0xFFFFFFFF,
+    0x42C9200, 0xFFFFFFFF, 0xFFFFFFFF, 0x364B248, 0x19889, 0xC3649, 0xFFFFFFFF, 0x4044A0, 0x2482061, 0x60B700, 0xFFFFFFFF, 0x2881488,
+    0xFFFFFFFF, 0x20C1488, 0x2483080, 0xFFFFFFFF, 0x3848013, 0x509600, 0x200131B, 0x20C9203, 0x8A45B, 0x449493, 0x1B300, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x148A061, 0x421491, 0xFFFFFFFF, 0x2603248, 0xCA28C, 0x42500C0, 0x148B080, 0x253309, 0x6C1888, 0x24C9080, 0x3109258,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x25B092, 0x6C12C3, 0x44880C2, 0xFFFFFFFF, 0xFFFFFFFF, 0x4301640, 0x12D9488, 0x1309200, 0xFFFFFFFF, 0x324A603,
+    0x40324B, 0xFFFFFFFF, 0x3860, 0x1264600, 0xFFFFFFFF, 0xFFFFFFFF, 0x4000D8, 0x8148B, 0x488B, 0x34900C2, 0xFFFFFFFF, 0x49A840,
+    0x24931A, 0x251649, 0x4289083, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3004483, 0xFFFFFFFF, 0x2498680, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3289308, 0x24980C2, 0x2848061, 0xFFFFFFFF, 0xFFFFFFFF, 0x1488293, 0xFFFFFFFF, 0x1243243, 0xFFFFFFFF, 0x3240061, 0xE2449, 0xFFFFFFFF,
+    0x14A3240, 0x12400C3, 0x1301250, 0xFFFFFFFF, 0x490858, 0x36C1242, 0xFFFFFFFF, 0x9244C, 0x3052213, 0x64964B, 0x490293, 0x17000C3,
+    0x24B243, 0x124A442, 0x340061B, 0x324884A, 0x4851240, 0x41884B, 0x3649248, 0x1900003, 0xC0063, 0xFFFFFFFF, 0xFFFFFFFF, 0x24A6C3,
+    0xFFFFFFFF, 0x981B, 0xFFFFFFFF, 0xFFFFFFFF, 0x2CC488, 0x3004253, 0x252443, 0xFFFFFFFF, 0x1C488, 0xFFFFFFFF, 0x2D4200, 0x908013,
+    0x60084A, 0x1930C, 0x32D1800, 0x30802DA, 0x1488061, 0x24830C2, 0x1243010, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3003119, 0x12D8003,
+    0xFFFFFFFF, 0x1302603, 0xFFFFFFFF, 0x424004B, 0x42506C0, 0xFFFFFFFF, 0x1242490, 0xFFFFFFFF, 0x649418, 0x491643, 0x148B0C2, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x12498, 0xFFFFFFFF, 0xFFFFFFFF, 0x68924C, 0x60C649, 0x124C810, 0xFFFFFFFF, 0xD4648, 0x493680, 0x1841243, 0x699300,
+    0x36590C0, 0xFFFFFFFF, 0x230B003, 0xFFFFFFFF, 0xFFFFFFFF, 0x611240, 0x48C0600, 0x649303, 0xD924C, 0x5C642, 0x2480890, 0x89800,
+    0xFFFFFFFF, 0x2A10D8, 0xFFFFFFFF, 0x402711, 0x89249, 0x42890C0, 0x304901B, 0x128B500, 0x1293840, 0x10B000, 0x1241240, 0x1909018,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x84B289, 0x12C3003, 0x1243843, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x32910C0, 0xB50B,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2009909, 0x249250, 0x609859, 0x3052810, 0xFFFFFFFF, 0x3258490, 0x40361B, 0x24A263, 0x1249462, 0xFFFFFFFF,
+    0x2880603, 0x3609458, 0xFFFFFFFF, 0x8185B, 0x364C400, 0x224C240, 0xFFFFFFFF, 0xFFFFFFFF, 0x3092083, 0x1843059, 0x1900049, 0x1A480,
+    0xFFFFFFFF, 0x4024E1, 0x3004842, 0x251462, 0x4321000, 0x6D004C, 0xFFFFFFFF, 0x3098260, 0x680600, 0x30C1289, 0x929B, 0x1C4C9,
+    0xFFFFFFFF, 0x4C240, 0xFFFFFFFF, 0x2049064, 0x304C400, 0xCB448, 0x3603602, 0x14880A2, 0x10A25A, 0x6002C8, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4B6C8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xD0049, 0x4B10C, 0x53442, 0xFFFFFFFF, 0x92258, 0xFFFFFFFF, 0x64C018,
+    0xFFFFFFFF, 0x689849, 0x248490, 0x3649610, 0x14D2250, 0x1289063, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3689448,
+    0x12A4010, 0x3000493, 0x611843, 0x28CC, 0x321448, 0x20920D8, 0xFFFFFFFF, 0x30014A2, 0x430C000, 0xFFFFFFFF, 0x196D9, 0x1289509,
+    0x2500092, 0xFFFFFFFF, 0x262308, 0x3049610, 0xC0311, 0xFFFFFFFF, 0x849299, 0x3292240, 0x30C3098, 0xFFFFFFFF, 0xFFFFFFFF, 0x1299000,
+    0x40A4D2, 0xFFFFFFFF, 0x61B04B, 0x950A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6020D8, 0xA509, 0x31B600, 0xFFFFFFFF, 0x8D1203,
+    0x1488311, 0xFFFFFFFF, 0xFFFFFFFF, 0x3853200, 0xFFFFFFFF, 0x200C508, 0x24A860, 0x60C458, 0x92, 0x1B602, 0xFFFFFFFF, 0x12A2800,
+    0xFFFFFFFF, 0x260094, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x403092, 0xFFFFFFFF, 0x46C8248, 0xFFFFFFFF, 0xC324A, 0x1324000, 0x3002291,
+    0x3018083, 0x1900083, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x61613, 0x24800E1, 0x9C289, 0xFFFFFFFF, 0xC9448, 0x4B263, 0x680649,
+    0xFFFFFFFF, 0x30C9603, 0x340A458, 0xFFFFFFFF, 0x36100D8, 0xFFFFFFFF, 0x6008CB, 0xB8D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2DC003,
+    0x25B260, 0x1300083, 0xFFFFFFFF, 0x1299260, 0x3603083, 0x11201B, 0xFFFFFFFF, 0x104D9, 0xFFFFFFFF, 0xFFFFFFFF, 0x493258, 0x3010692,
+    0x1689049, 0x304B308, 0x64C059, 0x3260010, 0x42584C0, 0x24B094, 0xFFFFFFFF, 0xFFFFFFFF, 0x1899600, 0x2001889, 0x330824A, 0xFFFFFFFF,
+    0x308, 0x3401488, 0x32480D3, 0xFFFFFFFF, 0xFFFFFFFF, 0x1849603, 0xFFFFFFFF, 0x13092C9, 0xDC448, 0x3263080, 0x109603, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3009263, 0x1240860, 0x12400, 0x384B000, 0xFFFFFFFF, 0x851603, 0x10B649, 0x12402A1,
+    0x61A061, 0xFFFFFFFF, 0x3600293, 0x4243018, 0x300C880, 0x12412C3, 0x44A900, 0x64824B, 0xFFFFFFFF, 0xFFFFFFFF, 0x14A12C0, 0x93643,
+    0x12580D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x36180C9, 0x68C218, 0x1243300, 0xFFFFFFFF, 0x42C00C3, 0x42434C0, 0x3308018, 0x30C0403, 0xFFFFFFFF,
+    0x6CC049, 0x32E0003, 0x8DA000, 0x419488, 0x609319, 0xFFFFFFFF, 0x1309092, 0xD9658, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x194E1, 0x4A843, 0xFFFFFFFF, 0x30180C3, 0x81318, 0x6C0018, 0x22843, 0xFFFFFFFF, 0x1489253, 0x25824B, 0x61B403, 0x6C2618,
+    0x32D2440, 0x288A440, 0x34D80C0, 0x3022440, 0x30CC202, 0x125B01A, 0x4658003, 0x4970B, 0x30A4200, 0x600908, 0xFFFFFFFF, 0x1303240,
+    0x42C3000, 0x16414D1, 0x630D8, 0x12430D3, 0xFFFFFFFF, 0x13000C3, 0xFFFFFFFF, 0x3600509, 0xFFFFFFFF, 0x260461, 0x6C2500, 0x18858,
+    0x2A3410, 0x709648, 0xFFFFFFFF, 0x308680, 0x9200, 0x18294, 0x651803, 0x404488, 0xFFFFFFFF, 0x3080C2, 0xB800, 0xFFFFFFFF,
+    0x324B289, 0xFFFFFFFF, 0x2E00C3, 0x2634C0, 0xFFFFFFFF, 0x225124C, 0xFFFFFFFF, 0x30030C2, 0x184C200, 0x8A440, 0xC263, 0xFFFFFFFF,
+    0x18C30C0, 0x148A04C, 0x248924B, 0x619643, 0xFFFFFFFF, 0xFFFFFFFF, 0x200B683, 0x30092A2, 0x698848, 0xFFFFFFFF, 0x1303010, 0xFFFFFFFF,
+    0x4A00C0, 0x854200, 0x12418C3, 0x30490D0, 0xFFFFFFFF, 0x131B400, 0x49204C, 0xFFFFFFFF, 0xFFFFFFFF, 0x1250, 0x24CB0C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x24B461, 0x1858003, 0x1258112, 0xC3400, 0xFFFFFFFF, 0x1701300, 0x2498C3, 0x124B682, 0x16A1248, 0x2881240, 0x499249,
+    0x3000890, 0x600003, 0x119, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C3291, 0x449248, 0xFFFFFFFF, 0x16D0449, 0x403121,
+    0xFFFFFFFF, 0x421249, 0xA2603, 0x1889243, 0xFFFFFFFF, 0x309A480, 0x681258, 0x909242, 0xFFFFFFFF, 0x29A203, 0x324004C, 0x8E1240,
+    0x2DA602, 0x609802, 0x9919, 0x4658600, 0x3604242, 0x3089292, 0xFFFFFFFF, 0xFFFFFFFF, 0x891240, 0x1888109, 0xFFFFFFFF, 0x680109,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3400600, 0xC0613, 0xFFFFFFFF, 0x3304240, 0x12DB280, 0x1243112, 0x1300109, 0xFFFFFFFF, 0xFFFFFFFF, 0x419858,
+    0x4C3618, 0x613003, 0xFFFFFFFF, 0xD010C, 0x53509, 0x30000A2, 0x91A200, 0x30D8600, 0xFFFFFFFF, 0xFFFFFFFF, 0x84B002, 0x32890C0,
+    0xFFFFFFFF, 0x30810B, 0x1312200, 0x2000323, 0x30036C2, 0xFFFFFFFF, 0x60185A, 0xC860, 0xFFFFFFFF, 0x2618603, 0xFFFFFFFF, 0x601299,
+    0xFFFFFFFF, 0xA4410, 0xC9298, 0xFFFFFFFF, 0x22910C3, 0x12C0661, 0x891000, 0x31A200, 0x292700, 0x4849280, 0x4A06C0, 0x12C4240,
+    0x6C02C8, 0x12483, 0xD3618, 0x492649, 0x1491848, 0x2493600, 0xFFFFFFFF, 0x3049112, 0xFFFFFFFF, 0x3600318, 0x24A483, 0xFFFFFFFF,
+    0x11903, 0x3851280, 0xFFFFFFFF, 0x404858, 0xFFFFFFFF, 0x261299, 0xFFFFFFFF, 0x19689, 0xFFFFFFFF, 0xFFFFFFFF, 0x248322, 0x600602,
+    0xFFFFFFFF, 0xC02C8, 0x20016D0, 0x3003490, 0x860600, 0xFFFFFFFF, 0x44984B, 0xC12E2, 0xFFFFFFFF, 0xFFFFFFFF, 0x2489618, 0x1909003,
+    0xFFFFFFFF, 0xC230B, 0xFFFFFFFF, 0x20C0709, 0xFFFFFFFF, 0x6C0659, 0xFFFFFFFF, 0x24C9449, 0x492E3, 0x681289, 0x1243260, 0xFFFFFFFF,
+    0x1301840, 0xFFFFFFFF, 0xFFFFFFFF, 0x4259218, 0x12D9840, 0x365C000, 0xFFFFFFFF, 0xD0263, 0x61119, 0x2DA083, 0x1850092, 0x891289,
+    0xFFFFFFFF, 0xD128C, 0x2012691, 0xFFFFFFFF, 0x30C9109, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x5984B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xDB602, 0xFFFFFFFF, 0x2480083, 0x125064C, 0x1B492, 0xFFFFFFFF, 0xFFFFFFFF, 0x61002, 0x8070C, 0x30D0308, 0x12632C0,
+    0x16D0258, 0xFFFFFFFF, 0x63600, 0x253491, 0xFFFFFFFF, 0x305B480, 0x6512D8, 0xFFFFFFFF, 0x10A243, 0x3461600, 0xFFFFFFFF, 0x3848080,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6012D8, 0x30DA0C0, 0xC92D8, 0x490649, 0x308A688, 0x12C3260, 0x124921B, 0x114A3, 0x64C003,
+    0x4C119, 0xFFFFFFFF, 0xFFFFFFFF, 0x3649600, 0x6C0308, 0x36800D8, 0x12996C0, 0x418649, 0x2494A0, 0x2052292, 0xFFFFFFFF, 0xD04D9,
+    0xFFFFFFFF, 0x2CC840, 0x113488, 0x12D4, 0x186A2, 0x64830B, 0xFFFFFFFF, 0x1842291, 0x328C049, 0xFFFFFFFF, 0xC08C8, 0x3080692,
+    0x4250018, 0x1488418, 0xFFFFFFFF, 0xFFFFFFFF, 0x2144B, 0x20042D2, 0x30034D1, 0xFFFFFFFF, 0x30C04C0, 0xFFFFFFFF, 0x22461, 0x4B483,
+    0x680860, 0x10C610, 0x125030B, 0xFFFFFFFF, 0xCA68A, 0x390A000, 0x1700248, 0x12D20C0, 0x92010, 0xA51A, 0xD2403, 0xFFFFFFFF,
+    0x20212C3, 0x24824B, 0x8C2C3, 0x13002A1, 0xFFFFFFFF, 0x2000018, 0x4259242, 0x1212C8, 0xFFFFFFFF, 0x14890, 0x3689200, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x80863, 0xFFFFFFFF, 0x224B24B, 0x6480DB, 0x4249649, 0x300125A, 0x3648291, 0xFFFFFFFF, 0xC0692, 0xFFFFFFFF, 0x84801B,
+    0x1843080, 0x60B309, 0x191A000, 0xC00DB, 0x200981B, 0x30006E1, 0x24800CC, 0xFFFFFFFF, 0x9880, 0xC26D8, 0xFFFFFFFF, 0x4250848,
+    0x14A001A, 0x124261B, 0x92C3, 0x5192C0, 0x36100C0, 0x84B083, 0x20E1200, 0xFFFFFFFF, 0xB8C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x14880CC,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1301640, 0xFFFFFFFF, 0x200C2C0, 0x24A61B, 0x8A500, 0x124981A, 0x14660, 0x64C600, 0x3609800, 0xFFFFFFFF,
+    0x124925C, 0xFFFFFFFF, 0xC2003, 0x4900CC, 0x3891240, 0x2484C0, 0x94880, 0x19261, 0xFFFFFFFF, 0x34C0000, 0x300204C, 0x1840291,
+    0x3649083, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3004640, 0x692610, 0x249B400, 0x29164B, 0xC9200, 0xFFFFFFFF, 0x20180C0, 0x36D0003,
+    0x618010, 0x19703, 0xFFFFFFFF, 0x3083291, 0x148B010, 0x124084B, 0x98908, 0x32C9300, 0x3680000, 0x164125B, 0x20C1300, 0x25B01B,
+    0x6C1253, 0xFFFFFFFF, 0x3258618, 0x4243002, 0xFFFFFFFF, 0x265B400, 0x2062258, 0xFFFFFFFF, 0x1643291, 0xFFFFFFFF, 0x3013018, 0xFFFFFFFF,
+    0x304B0C0, 0x2910000, 0xFFFFFFFF, 0x54261, 0x68C203, 0x683, 0x13002E0, 0x3689800, 0x526C0, 0xFFFFFFFF, 0x41B01B, 0x1244310,
+    0x3401243, 0xC1253, 0x661083, 0xFFFFFFFF, 0x185B002, 0x26C3, 0x29141B, 0xDC200, 0x54700, 0x1843680, 0x2626C0, 0x3082E0,
+    0x194D1, 0x1289308, 0x1640000, 0x18430C2, 0x2483289, 0x30D9240, 0x3400109, 0xFFFFFFFF, 0x712049, 0x2E1300, 0x920002, 0x6C2600,
+    0x3409460, 0xD8509, 0x84B680, 0x14A0059, 0x8B683, 0xA8E0, 0xFFFFFFFF, 0x26C3000, 0x148B289, 0x24861A, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1649800, 0x630C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x453458, 0x26186C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x263000, 0xFFFFFFFF, 0xC2603,
+    0x2092260, 0xFFFFFFFF, 0x419240, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x651800, 0x3260049, 0x1840890, 0x364C240, 0x34902C8, 0x1A880,
+    0x12890D0, 0x59692, 0xFFFFFFFF, 0x30C0660, 0x9B061, 0xC9800, 0xFFFFFFFF, 0x20186C0, 0x41810C, 0xFFFFFFFF, 0x18720, 0xFFFFFFFF,
+    0x4B061, 0x3610490, 0x603843, 0x44A488, 0x1C300, 0xC3509, 0xFFFFFFFF, 0x8E3000, 0x422489, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1520049, 0xFFFFFFFF, 0xA3289, 0x10891, 0xD3000, 0x36002CB, 0xFFFFFFFF, 0x609462, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x400664, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x128C018, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x485A, 0x3401843, 0xFFFFFFFF,
+    0x858260, 0x2480262, 0x124C688, 0xFFFFFFFF, 0xFFFFFFFF, 0x42C9448, 0x201B04C, 0x2E2480, 0x614240, 0x13090C0, 0xFFFFFFFF, 0xDC242,
+    0x2503049, 0xFFFFFFFF, 0x125128C, 0xC0719, 0xFFFFFFFF, 0x849689, 0xFFFFFFFF, 0x1240659, 0xFFFFFFFF, 0x304C002, 0xFFFFFFFF, 0x4B891,
+    0xFFFFFFFF, 0x251511, 0x3110C3, 0x2944C0, 0xFFFFFFFF, 0x610C0, 0xFFFFFFFF, 0x25928C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2292300,
+    0xFFFFFFFF, 0x2492800, 0xFFFFFFFF, 0x649063, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x20640C0, 0x3248258, 0xFFFFFFFF, 0x418263,
+    0x4C3600, 0x26304B, 0x6C9283, 0xFFFFFFFF, 0x4932C8, 0xFFFFFFFF, 0x36CC000, 0xFFFFFFFF, 0xFFFFFFFF, 0x649509, 0x36092D0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x914, 0x21618, 0x1321280, 0x5C291, 0xFFFFFFFF, 0x601840, 0x31144A, 0x32D1218, 0x30812D2, 0xFFFFFFFF, 0x683600,
+    0x302121A, 0x96D9, 0x1310092, 0xFFFFFFFF, 0xFFFFFFFF, 0x300C44A, 0x618092, 0x125825B, 0xFFFFFFFF, 0xFFFFFFFF, 0x30092C3, 0xFFFFFFFF,
+    0x124348B, 0xFFFFFFFF, 0x3241889, 0x3908080, 0xFFFFFFFF, 0xFFFFFFFF, 0x124B203, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000418, 0x26025B,
+    0x168C000, 0x3052458, 0xFFFFFFFF, 0x404840, 0xFFFFFFFF, 0xFFFFFFFF, 0x2294, 0xC0860, 0x128C059, 0xFFFFFFFF, 0xFFFFFFFF, 0x119600,
+    0x70C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3019261, 0x614840, 0xC61B, 0xC12D4, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2489603,
+    0x1254449, 0xFFFFFFFF, 0x200A458, 0x680248, 0x300C21A, 0xFFFFFFFF, 0xFFFFFFFF, 0xC3318, 0xFFFFFFFF, 0x8480E1, 0x60309B, 0x124069B,
+    0x304C04B, 0xFFFFFFFF, 0x3603240, 0x20C9491, 0x12400CC, 0xC503, 0xFFFFFFFF, 0xFFFFFFFF, 0x30892C0, 0xFFFFFFFF, 0x92461, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3259488, 0x2512002, 0xFFFFFFFF, 0x126E0, 0xFFFFFFFF, 0xD2292, 0x3261200, 0x3018010, 0x263648, 0x6CC440,
+    0xC0080, 0x2001488, 0x3003248, 0x1841488, 0x249A003, 0x3499200, 0xFFFFFFFF, 0xFFFFFFFF, 0x3263240, 0x24A121, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xC20C0, 0xFFFFFFFF, 0x2D4218, 0x600860, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x121602, 0x3049258, 0x130001B,
+    0xC9883, 0x360301A, 0x683649, 0x30C42C0, 0x890018, 0xFFFFFFFF, 0x3698000, 0x4240061, 0x30098C9, 0xFFFFFFFF, 0x2109092, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x425B010, 0x308018, 0x858, 0x36800C3, 0xD3640, 0x26C8010, 0x1709203, 0x263418, 0x3180C3, 0xFFFFFFFF,
+    0x200125B, 0x26E0400, 0x1498018, 0x124C249, 0x1302500, 0x2261258, 0xFFFFFFFF, 0xFFFFFFFF, 0x60A509, 0xFFFFFFFF, 0xFFFFFFFF, 0x16D0010,
+    0xFFFFFFFF, 0x4250003, 0x694600, 0x1252449, 0x260001B, 0x324B0C2, 0x16E00C0, 0x41B0D8, 0x4D80D8, 0xFFFFFFFF, 0x4488000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x124125A, 0xFFFFFFFF, 0x6D8013, 0xFFFFFFFF, 0x680294, 0x12C301B, 0x1243858, 0x304C648, 0x340B680, 0xE4049,
+    0x84C2C0, 0x6030D0, 0x12406D8, 0x6C00C2, 0x26014D1, 0x36006D0, 0x1489300, 0x249258, 0x890291, 0xFFFFFFFF, 0x509308, 0x3600112,
+    0xFFFFFFFF, 0x24B858, 0x6C2109, 0x1B018, 0x2880618, 0x12A2218, 0x1842049, 0x3018613, 0x2498002, 0xFFFFFFFF, 0xFFFFFFFF, 0x491309,
+    0x3018059, 0xFFFFFFFF, 0x30CC, 0xC00C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x8580C3, 0x20DB000, 0xFFFFFFFF, 0xC26CA, 0x16D3400, 0x84A04C,
+    0x424200, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xE1800, 0x84C640, 0x6008A1, 0x30C9018, 0x130061A, 0xFFFFFFFF, 0x490E1, 0x148C250,
+    0x6002E3, 0x1244643, 0x464004C, 0xFFFFFFFF, 0x1299248, 0x1521240, 0x3021298, 0x6186D0, 0x188B0C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x24A049,
+    0x602320, 0x308613, 0x30610D0, 0x1640320, 0xFFFFFFFF, 0x24C640, 0x1230C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x2A124B, 0x4012A4, 0x2483000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1B848, 0xD30C3, 0x3003059, 0x251249, 0x4D9248, 0xFFFFFFFF, 0xFFFFFFFF, 0x16D0610, 0x309804C, 0xFFFFFFFF,
+    0x2320, 0x305A258, 0x2600600, 0xDA880, 0x2504240, 0xFFFFFFFF, 0x2712200, 0xFFFFFFFF, 0x24C9013, 0xFFFFFFFF, 0xFFFFFFFF, 0x12D4248,
+    0x6C1242, 0xFFFFFFFF, 0xC9692, 0xFFFFFFFF, 0x12C3618, 0x699240, 0xA1690, 0x1441B, 0x16406C3, 0x3601289, 0xFFFFFFFF, 0x20E1448,
+    0x3490602, 0x512203, 0x1289400, 0x26C4240, 0xFFFFFFFF, 0x603119, 0x304C0C9, 0xD0891, 0x2000049, 0xFFFFFFFF, 0x113840, 0x168C,
+    0x132DA, 0xFFFFFFFF, 0xFFFFFFFF, 0x412708, 0xFFFFFFFF, 0x4D9013, 0x1B059, 0xFFFFFFFF, 0xFFFFFFFF, 0x3001289, 0xFFFFFFFF, 0x36CC,
+    0xC06C3, 0xFFFFFFFF, 0x84804C, 0xFFFFFFFF, 0x3291000, 0xFFFFFFFF, 0xFFFFFFFF, 0x128A309, 0xFFFFFFFF, 0x30032CB, 0x12D4018, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xCC01B, 0xFFFFFFFF, 0x4C3109, 0xFFFFFFFF, 0x6C3610, 0x384A248, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1264A,
+    0xFFFFFFFF, 0xE1291, 0x44CA240, 0x600322, 0x60B218, 0x453440, 0xFFFFFFFF, 0x6590C3, 0x640D0, 0x4300258, 0x1241508, 0xFFFFFFFF,
+    0x209224B, 0x53499, 0x2C9840, 0xFFFFFFFF, 0x1689061, 0x19849, 0xFFFFFFFF, 0x2C928C, 0x3014289, 0x2483600, 0x452309, 0xC0490,
+    0xFFFFFFFF, 0x12A3049, 0x691618, 0x248304B, 0x9B049, 0x224A4C9, 0xFFFFFFFF, 0x30004DB, 0x1849618, 0xFFFFFFFF, 0xFFFFFFFF, 0x2692018,
+    0xFFFFFFFF, 0x148B600, 0x30188C8, 0x6128C0, 0xFFFFFFFF, 0x461848, 0xFFFFFFFF, 0x1488492, 0x3291258, 0xFFFFFFFF, 0xA2248, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x851618, 0x6016D0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x5224B, 0x10C680, 0x12412D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4C510, 0x10C0C2, 0x30C92C2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4249218, 0x249899, 0xFFFFFFFF, 0x4842, 0xC025B, 0xD3490,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x30C0418, 0x428B, 0xFFFFFFFF, 0xFFFFFFFF, 0x300188B, 0x26496C0, 0xFFFFFFFF, 0x6CA4C0, 0x294003, 0x3251213,
+    0x3009600, 0x60201B, 0x308311, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x9B2C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x60149B, 0x24A2400, 0x10649, 0xFFFFFFFF, 0xFFFFFFFF, 0x109890, 0x60921B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x36C0680, 0xFFFFFFFF, 0x126121A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x36C00D0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xD8418, 0x424C600, 0xFFFFFFFF, 0x12492C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x3610018, 0x3010121,
+    0x3289092, 0x918, 0x32C9488, 0x651261, 0xFFFFFFFF, 0x2E00D8, 0x3019488, 0xFFFFFFFF, 0xFFFFFFFF, 0x2001318, 0x4B64C, 0x30030DA,
+    0x4D92C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x2618018, 0x4240010, 0x6920C0, 0x204C04C, 0xFFFFFFFF, 0x260324B, 0xFFFFFFFF, 0x719600, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3240291, 0x659490, 0x4A00D8, 0xFFFFFFFF, 0x61A0C0, 0x130148A, 0x2092618, 0xFFFFFFFF, 0x3000403, 0xFFFFFFFF,
+    0x124131A, 0x14492, 0xFFFFFFFF, 0x4904C0, 0xFFFFFFFF, 0x4C0248, 0xFFFFFFFF, 0x340084B, 0xC3418, 0xFFFFFFFF, 0x1843248, 0x24C498,
+    0x4888, 0x130B249, 0x4843400, 0xFFFFFFFF, 0x20C125B, 0x60001B, 0x311200, 0xC12C0, 0x3251810, 0xFFFFFFFF, 0x860013, 0x249B240,
+    0x30DB400, 0xFFFFFFFF, 0xFFFFFFFF, 0x84B24A, 0x421261, 0x60204C, 0x1258013, 0x1889258, 0xFFFFFFFF, 0x20C0121, 0xFFFFFFFF, 0x1240680,
+    0xFFFFFFFF, 0x4488449, 0x52618, 0xFFFFFFFF, 0x258291, 0x60981A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x60925C, 0x12426C8,
+    0xFFFFFFFF, 0xCA502, 0xFFFFFFFF, 0x17000C0, 0xFFFFFFFF, 0xA2500, 0xFFFFFFFF, 0x324B400, 0x309204B, 0x2480C9, 0x3649240, 0x4289418,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x301A603, 0x609709, 0x14D3, 0xFFFFFFFF, 0x2002498, 0x5A25B, 0x806DB, 0x1250064, 0x224B0C3,
+    0xFFFFFFFF, 0x4964B, 0x2C9300, 0x2483680, 0x612498, 0x34030C0, 0x2164C, 0xFFFFFFFF, 0x1489643, 0x3021800, 0x1243013, 0xFFFFFFFF,
+    0x2618618, 0x3600449, 0xFFFFFFFF, 0x14A3010, 0x44C092, 0x1302618, 0x2603848, 0xFFFFFFFF, 0x22910D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x64941B, 0x3259243, 0x6814D1, 0xFFFFFFFF, 0x1249B, 0xFFFFFFFF, 0x3248610, 0xFFFFFFFF, 0x2E0003, 0x364901A, 0x291, 0xFFFFFFFF,
+    0x32586C0, 0x3003003, 0x24A493, 0x3513000, 0x2883, 0x260A489, 0xFFFFFFFF, 0x403291, 0xFFFFFFFF, 0x1858059, 0x1C258, 0x64930A,
+    0x20006C3, 0x5C649, 0x600618, 0x2499240, 0xFFFFFFFF, 0xFFFFFFFF, 0x2000109, 0x4A0000, 0x30C3059, 0x311249, 0xFFFFFFFF, 0x34186C0,
+    0xFFFFFFFF, 0x61248, 0x1241242, 0x99300, 0xC3900, 0xD8112, 0x26C0603, 0x14A1240, 0x3294240, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xB508, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3318600, 0x260613, 0xFFFFFFFF, 0xFFFFFFFF, 0x661018,
+    0x2DA098, 0x1222C0, 0xFFFFFFFF, 0x1010C, 0xFFFFFFFF, 0x12A2203, 0x684300, 0x3018602, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2000493,
+    0x418891, 0x2480660, 0x428C010, 0xFFFFFFFF, 0x2A2488, 0xFFFFFFFF, 0x3004850, 0x610490, 0x1249908, 0xFFFFFFFF, 0xDB059, 0x12A10C9,
+    0xFFFFFFFF, 0x30C128B, 0x1254240, 0x19909, 0xFFFFFFFF, 0x4250260, 0xFFFFFFFF, 0x3294010, 0x4E2202, 0x2600260, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3019508, 0xFFFFFFFF, 0xB2DB, 0xFFFFFFFF, 0x20096D9, 0xFFFFFFFF, 0xFFFFFFFF, 0x89004C, 0x6C2482, 0xFFFFFFFF, 0x3258260, 0x425A018,
+    0x24B613, 0xFFFFFFFF, 0x31A249, 0xFFFFFFFF, 0x1641900, 0x248492, 0xFFFFFFFF, 0x621458, 0x124D8, 0x128A640, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3649059, 0x2CB, 0xFFFFFFFF, 0x230B600, 0x5230B, 0xFFFFFFFF, 0x2602C8, 0x428A242, 0x1B258, 0xFFFFFFFF, 0x18C3049, 0xFFFFFFFF,
+    0x611289, 0xFFFFFFFF, 0x291063, 0x4C018, 0xFFFFFFFF, 0x600659, 0x89849, 0x3049613, 0xC0320, 0xFFFFFFFF, 0xFFFFFFFF, 0x3292242,
+    0x1240263, 0xFFFFFFFF, 0xFFFFFFFF, 0x4B498, 0x10B04C, 0xFFFFFFFF, 0x2062240, 0x340A688, 0xFFFFFFFF, 0xFFFFFFFF, 0x300C280, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x11289, 0x3244840, 0xFFFFFFFF, 0x249843, 0x124070B, 0xFFFFFFFF, 0xFFFFFFFF, 0x2A1003, 0x52692, 0x12C24C9, 0x60C443,
+    0x454680, 0xFFFFFFFF, 0x3689218, 0xFFFFFFFF, 0x85A800, 0x6092D8, 0xFFFFFFFF, 0xC224B, 0x1289890, 0x3092680, 0x4309210, 0x4DB600,
+    0x322248, 0x6E1280, 0x20004D9, 0x2CA4C9, 0x41B490, 0x2620D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12D4003, 0x9898,
+    0xFFFFFFFF, 0x3119049, 0x4C843, 0x3001718, 0x25A818, 0x92CC, 0x50A243, 0xFFFFFFFF, 0x4C289, 0x6932C0, 0x60348B, 0x125944B,
+    0xFFFFFFFF, 0x4910B, 0xFFFFFFFF, 0x20CC448, 0x60030A, 0xFFFFFFFF, 0xFFFFFFFF, 0x2891600, 0xFFFFFFFF, 0xFFFFFFFF, 0x92858, 0xFFFFFFFF,
+    0x44892C0, 0x42400D3, 0x53489, 0x80649, 0x204C109, 0x1258308, 0xC2018, 0x3260018, 0xFFFFFFFF, 0xFFFFFFFF, 0x46C8018, 0xFFFFFFFF,
+    0x651218, 0x59661, 0xFFFFFFFF, 0xFFFFFFFF, 0x30B, 0xC149B, 0xFFFFFFFF, 0x42E2000, 0x2291600, 0x20D8248, 0x9664, 0xFFFFFFFF,
+    0xC9218, 0x32604C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xCB818, 0x4849200, 0x4C059, 0x300A843, 0x603258, 0x12403, 0xFFFFFFFF,
+    0x522400, 0x5C109, 0x6000DA, 0x61B648, 0x3049094, 0xFFFFFFFF, 0x16D20C0, 0x612CB, 0x1850248, 0xFFFFFFFF, 0x210C049, 0x3851200,
+    0xFFFFFFFF, 0x300C2C2, 0x26121B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xC0248, 0xFFFFFFFF,
+    0x3308013, 0xFFFFFFFF, 0x251600, 0x1262450, 0x464C200, 0x24D2280, 0x3000293, 0x4C0692, 0xFFFFFFFF, 0x26D8, 0xFFFFFFFF, 0x209B800,
+    0xFFFFFFFF, 0x24B308, 0x84488, 0xFFFFFFFF, 0xFFFFFFFF, 0x324B4C0, 0x2021200, 0x12D4600, 0x311C, 0xA2003, 0x21261, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x60148A, 0x618858, 0x98D8, 0xCC049, 0x3601643, 0x68324B, 0x301A109, 0xFFFFFFFF, 0xFFFFFFFF, 0x3680848, 0x26C3018,
+    0x6800C0, 0x9080C0, 0x34880C0, 0x2604488, 0xFFFFFFFF, 0xFFFFFFFF, 0x148C2C0, 0x262000, 0x13000CC, 0x1892440, 0x36030C9, 0xFFFFFFFF,
+    0x10B308, 0xFFFFFFFF, 0x130D8, 0xFFFFFFFF, 0x324924C, 0xFFFFFFFF, 0x4C301B, 0x24900C3, 0x1302109, 0x32CB018, 0x651818, 0x848403,
+    0x301B010, 0x90A, 0x42A2200, 0xC4658, 0xFFFFFFFF, 0x3003683, 0xFFFFFFFF, 0x44E1, 0xFFFFFFFF, 0x3409803, 0xFFFFFFFF, 0x14980C3,
+    0x601253, 0x614488, 0x3409249, 0xC9259, 0x1640848, 0x3449618, 0x603858, 0x61C203, 0xFFFFFFFF, 0xE1649, 0x494DB, 0x12C0061,
+    0xFFFFFFFF, 0x4643003, 0x1303013, 0xFFFFFFFF, 0x849309, 0x36C0449, 0x32922C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x2092603, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x6D80C0, 0xFFFFFFFF, 0x2018000, 0xFFFFFFFF, 0x93689, 0x1C203, 0xC3403, 0x26C8449, 0xFFFFFFFF, 0x2E3018,
+    0x6D0, 0x3401858, 0xFFFFFFFF, 0xFFFFFFFF, 0x20C1243, 0x1844250, 0x125084B, 0x14D30C0, 0x24D9018, 0x201B061, 0x4194D1, 0x301B840,
+    0x3652202, 0x13090D8, 0xFFFFFFFF, 0x12A22C0, 0x20C06D8, 0x253682, 0x6C061A, 0xFFFFFFFF, 0x30804D9, 0xFFFFFFFF, 0x4889400, 0xFFFFFFFF,
+    0x6C005C, 0xCC649, 0x659248, 0x61698, 0x20C9460, 0x12124A, 0x18886C0, 0xC94C8, 0x4C8C8, 0x610D8, 0x20CA489, 0x2600,
+    0x3052200, 0xFFFFFFFF, 0x4C308, 0x38890C0, 0x2049121, 0x12436D0, 0x3400603, 0x42C0490, 0x325A480, 0x1843003, 0x24C253, 0x16A1018,
+    0xFFFFFFFF, 0x3248260, 0xFFFFFFFF, 0x68A489, 0x12D8109, 0x9802, 0xFFFFFFFF, 0x2002483, 0x3610600, 0x4C3061, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x182DC, 0xFFFFFFFF, 0x84B003, 0x32890C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x4483049, 0xFFFFFFFF, 0xFFFFFFFF, 0x694248, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3409849, 0x2618600, 0xFFFFFFFF, 0x12101A, 0x8A489, 0x13003, 0xFFFFFFFF, 0x8CC240, 0xFFFFFFFF, 0xFFFFFFFF, 0x1259850, 0x6C3449,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1090C9, 0x12434A0, 0x4643049, 0xFFFFFFFF, 0x42C0260, 0x26C1289, 0xFFFFFFFF, 0x1241900, 0x1842, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x24A482, 0x261850, 0xFFFFFFFF, 0x13182C8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x261292, 0xFFFFFFFF, 0x32C8260,
+    0x2004858, 0x20C1843, 0x3018262, 0x719, 0xFFFFFFFF, 0xC02CB, 0x499298, 0x3003492, 0x3019292, 0x4D9680, 0x3202C8, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2CB109, 0x421849, 0xFFFFFFFF, 0x1B109, 0xFFFFFFFF, 0xFFFFFFFF, 0x3001321, 0x204A840, 0x44A2A1, 0x29A810, 0xE1458,
+    0x360224B, 0xFFFFFFFF, 0x896D9, 0x6C009B, 0x4610C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x1491618, 0x12416D0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x124944A, 0xFFFFFFFF, 0xD1289, 0x34D2400, 0xFFFFFFFF, 0x1843600, 0x3663, 0x2248092, 0xC065C, 0x3261218,
+    0xFFFFFFFF, 0x248064B, 0x124B491, 0x1261283, 0x128B880, 0x20014A3, 0x3003260, 0xFFFFFFFF, 0x311003, 0xFFFFFFFF, 0xFFFFFFFF, 0x2009218,
+    0x30000E4, 0x32896C0, 0x9283, 0x6CA300, 0xFFFFFFFF, 0x425024B, 0x63603, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3080308, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x25864C, 0x2064000, 0x340C448, 0xFFFFFFFF, 0xFFFFFFFF, 0x6012DB, 0x121059, 0x31A800, 0xFFFFFFFF, 0x129A240, 0x361B400,
+    0x12C4840, 0xFFFFFFFF, 0x384A0C0, 0x64C000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3649602, 0x349024A, 0xFFFFFFFF, 0xFFFFFFFF, 0x2494A2,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x324C218, 0x164A688, 0x14912D0, 0x328C600, 0x124C280, 0x14509, 0x1323200, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x30D00D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C000, 0x4C12D2, 0xFFFFFFFF, 0xFFFFFFFF, 0xC0308, 0xFFFFFFFF, 0xFFFFFFFF, 0x2516C3,
+    0x30C3083, 0x1B708, 0xFFFFFFFF, 0xFFFFFFFF, 0x300B24C, 0x20D80D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xCA688, 0x325801B, 0x681889, 0xFFFFFFFF,
+    0x1258080, 0xFFFFFFFF, 0xFFFFFFFF, 0x4A909, 0xFFFFFFFF, 0x8C2D8, 0x3490018, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24A84B, 0xFFFFFFFF,
+    0x83, 0x1309600, 0xD1889, 0x403649, 0x24A291, 0x260080, 0xFFFFFFFF, 0x6480D8, 0xFFFFFFFF, 0x4241310, 0xFFFFFFFF, 0x428B018,
+    0x1261880, 0xC0698, 0xFFFFFFFF, 0x330B002, 0x301C203, 0x311600, 0x12612C0, 0x21210, 0x34C1258, 0x61602, 0x251491, 0x980DB,
+    0x18918, 0xFFFFFFFF, 0x3600010, 0x6104C, 0xFFFFFFFF, 0x284B018, 0x32CB0C0, 0xCA453, 0x84B080, 0x3618400, 0x2049092, 0xB8CA,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x10A28B, 0x12404C0, 0x13640, 0x131A000, 0xFFFFFFFF, 0x1649203, 0x24A618, 0x601318, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3609810, 0x6830D8, 0x1249249, 0x224B01B, 0x649488, 0x2093240, 0x1514200, 0x30100C3, 0x46C8003, 0x322000,
+    0x2A2840, 0x2000291, 0xFFFFFFFF, 0x2483018, 0x18D1, 0xFFFFFFFF, 0x648908, 0xFFFFFFFF, 0x4900000, 0x251259, 0x124C2C0, 0x3402498,
+    0x2092109, 0xFFFFFFFF, 0x41A6C8, 0x261310, 0xA1203, 0x6D2448, 0xCB803, 0x404318, 0x148B018, 0x603240, 0xB693, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3003510, 0x3019300, 0x25B018, 0xFFFFFFFF, 0x38E0000, 0x34C9249, 0x26D8003, 0x699258, 0x6026C8, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x49301A, 0x684488, 0x20CB680, 0x30D0000, 0x12580C3, 0x1894200, 0xFFFFFFFF, 0xFFFFFFFF, 0x248294, 0x3240, 0x453688, 0xFFFFFFFF,
+    0x708848, 0x1841643, 0x60C489, 0x428901A, 0x3052880, 0xFFFFFFFF, 0x201B003, 0x3001840, 0x2709248, 0x89C200, 0xFFFFFFFF, 0xD9643,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xA442, 0xFFFFFFFF, 0x1640003, 0x3611240, 0x18430C0, 0x309309, 0x3049418, 0xFFFFFFFF, 0x18A0000,
+    0x59308, 0x248010B, 0x2713000, 0x98C0, 0x509248, 0x4B294, 0xFFFFFFFF, 0x1499300, 0x2049692, 0x125844C, 0x648003, 0x2619240,
+    0xFFFFFFFF, 0x248618, 0xFFFFFFFF, 0x12660, 0xFFFFFFFF, 0x3300049, 0x12C12A1, 0x12430C0, 0xFFFFFFFF, 0xC0002, 0x6590D8, 0x52491,
+    0xFFFFFFFF, 0x609690, 0xFFFFFFFF, 0x320002, 0xFFFFFFFF, 0x12A101A, 0xFFFFFFFF, 0x261460, 0x2490, 0x19861, 0x2000891, 0x326004B,
+    0x41B848, 0x1859240, 0x3841840, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2483059, 0x1253618, 0x6D3003, 0x3248109, 0x12A4080, 0x20186C3,
+    0x601243, 0xA1800, 0x9692, 0xFFFFFFFF, 0xFFFFFFFF, 0x309C240, 0x83109, 0x4DA2C0, 0x2910D3, 0xFFFFFFFF, 0x4C083, 0x20C1900,
+    0x3023218, 0xA3840, 0x2604240, 0xFFFFFFFF, 0x200C690, 0xFFFFFFFF, 0x600109, 0x30490C2, 0xFFFFFFFF, 0x3241289, 0x53840, 0xFFFFFFFF,
+    0x602709, 0x304B6C0, 0xFFFFFFFF, 0x662200, 0x709400, 0x24B449, 0xFFFFFFFF, 0x2260, 0xFFFFFFFF, 0xD2483, 0xFFFFFFFF, 0x1840660,
+    0x6C3, 0x2249289, 0x5106C0, 0x661680, 0xFFFFFFFF, 0x82483, 0x609908, 0x45B449, 0xFFFFFFFF, 0xDC800, 0x2018490, 0x248128B,
+    0x614243, 0x294018, 0x3691003, 0x3610260, 0x30012E2, 0x8C800, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2D1292, 0x328A300, 0x3291059,
+    0xFFFFFFFF, 0x188A250, 0x3109000, 0x61683, 0xFFFFFFFF, 0xFFFFFFFF, 0x9909, 0x648600, 0x26C3600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x304B490, 0xFFFFFFFF, 0xFFFFFFFF, 0x148B2C8, 0x2649000, 0xFFFFFFFF, 0x126A1, 0xC0603, 0x5210C0, 0x10A300, 0xFFFFFFFF, 0x98600,
+    0x16A1003, 0xFFFFFFFF, 0xFFFFFFFF, 0x85804C, 0xFFFFFFFF, 0x364A242, 0xFFFFFFFF, 0x64C680, 0xFFFFFFFF, 0x419289, 0x4C3049, 0xFFFFFFFF,
+    0x1C460, 0x64C0C9, 0x30924C0, 0x2652800, 0x816D0, 0xFFFFFFFF, 0x34004D9, 0x4A640, 0xFFFFFFFF, 0x418709, 0x601842, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x311C000, 0x4A2800, 0x2512E1, 0x121000, 0xA4400, 0xFFFFFFFF, 0xFFFFFFFF, 0x683049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x148B098, 0x600708, 0x12408C8, 0xFFFFFFFF, 0x2124000, 0x4243648, 0x18C92C0, 0x1240311, 0x25B, 0x13490,
+    0x50C0C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x260258, 0x30A01B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x60A4C3, 0xFFFFFFFF, 0x2910080,
+    0x324B648, 0x404289, 0x43020C0, 0x4D8649, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4184D9, 0x3651203, 0x42E2, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x44A858, 0x94A1, 0x34180D8, 0xFFFFFFFF, 0x10C002, 0x25A402, 0xFFFFFFFF, 0x24443, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x64840, 0x1240692, 0x3116C0, 0x1300248, 0xFFFFFFFF, 0xFFFFFFFF, 0x4259200, 0x124009B, 0xFFFFFFFF, 0x38492C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x618308, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x248691, 0x1242121, 0x16A1600, 0x6490A2, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2480E4, 0x364924A, 0xFFFFFFFF, 0x131A0C0, 0xFFFFFFFF, 0x300324B, 0x1498248, 0x249A000, 0x1309490, 0xFFFFFFFF, 0x34D8003,
+    0x2018291, 0x24B708, 0xFFFFFFFF, 0x224B0D8, 0x2093300, 0x49661, 0xFFFFFFFF, 0xFFFFFFFF, 0x46D0400, 0xFFFFFFFF, 0xE1210, 0x490A2,
+    0x4251258, 0x89491, 0xC891, 0xFFFFFFFF, 0xCC443, 0x61490, 0x301A500, 0x121049, 0xC2D3, 0x24CB248, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x12C3248, 0xFFFFFFFF, 0xFFFFFFFF, 0x246C0, 0x4850018, 0x3009312, 0x48880C0, 0x3418, 0x1303080, 0xFFFFFFFF, 0xFFFFFFFF, 0x689261,
+    0x249488, 0x30A600, 0x3180C0, 0x1892280, 0x4240509, 0x300301A, 0xFFFFFFFF, 0x125B300, 0x18691, 0xFFFFFFFF, 0xFFFFFFFF, 0x38900C0,
+    0x3018848, 0x30D00C3, 0x1919200, 0xD2508, 0x4250000, 0x1488403, 0xFFFFFFFF, 0x3303, 0x1A6D1, 0x324B0C9, 0x33080C0, 0xFFFFFFFF,
+    0x3292218, 0x311260, 0x340C200, 0xFFFFFFFF, 0x61262, 0x10C600, 0x1241258, 0x94E0, 0xFFFFFFFF, 0x4C490, 0xFFFFFFFF, 0x25A449,
+    0x4E2440, 0x6C0680, 0x42C0618, 0x26C0061, 0x3611300, 0x12D8848, 0xFFFFFFFF, 0x21312, 0xFFFFFFFF, 0x30898C0, 0x24925B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3492600, 0x1318680, 0xFFFFFFFF, 0x113243, 0x610003, 0x1258510, 0x32C8618, 0xD8010, 0x26CB400, 0x184204C, 0x308291,
+    0xFFFFFFFF, 0xC0680, 0xDA618, 0x3002260, 0x249703, 0x46C9240, 0x9B249, 0x1A4A1, 0x652443, 0x3003289, 0xFFFFFFFF, 0x1240003,
+    0x3200C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000112, 0x14A0002, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xE1810, 0x680064, 0xFFFFFFFF, 0xA2440,
+    0x1889080, 0xCB460, 0xFFFFFFFF, 0x248000, 0x119308, 0xC8D0, 0x34A3000, 0x3681240, 0xFFFFFFFF, 0x12C3848, 0x609649, 0xA18C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6830C3, 0x30861A, 0x14D124A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2484A0, 0x93299, 0x1924C,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x300361A, 0x2483003, 0x918000, 0xFFFFFFFF, 0x652210, 0x16E1240, 0x300305C, 0x25124C, 0x28E1, 0x186D0,
+    0xC2493, 0xFFFFFFFF, 0x20C0891, 0x261300, 0x2323, 0x18112, 0xFFFFFFFF, 0x2000721, 0x2E30C0, 0x30C2092, 0xFFFFFFFF, 0x24C9010,
+    0xFFFFFFFF, 0x1641240, 0x2D2489, 0x604250, 0xFFFFFFFF, 0x340C249, 0x3601840, 0xFFFFFFFF, 0x10B061, 0x1241299, 0x11858, 0xFFFFFFFF,
+    0x360128B, 0x493003, 0xFFFFFFFF, 0x8C8C0, 0x44A318, 0x649240, 0x261A480, 0x5424C, 0xFFFFFFFF, 0x664, 0x6C010B, 0x2A1018,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x41B003, 0x4289010, 0x1B610, 0xC1240, 0xFFFFFFFF, 0xFFFFFFFF, 0x80891, 0x30D0490, 0xC2263, 0xC3843,
+    0xFFFFFFFF, 0x3010320, 0xFFFFFFFF, 0x36DA, 0xC3289, 0x209B218, 0x40151A, 0xFFFFFFFF, 0x301C218, 0x9B280, 0xC16E0, 0xFFFFFFFF,
+    0x409292, 0x20D8490, 0xFFFFFFFF, 0xFFFFFFFF, 0xC9460, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x619850, 0x1004C, 0xFFFFFFFF, 0x1640490,
+    0xFFFFFFFF, 0x248603, 0xFFFFFFFF, 0x6C0492, 0x3680260, 0x1299848, 0xFFFFFFFF, 0x12C128C, 0x12430A2, 0xFFFFFFFF, 0xFFFFFFFF, 0x708603,
+    0x430024A, 0x124150B, 0x1249848, 0x304A302, 0xFFFFFFFF, 0x708049, 0x4124D8, 0x30CC0C0, 0x308659, 0xFFFFFFFF, 0xFFFFFFFF, 0x70A640,
+    0xFFFFFFFF, 0x2483602, 0x8E0, 0xC0493, 0x49003, 0x3003659, 0x3019448, 0x30C0649, 0x1903, 0x34014A0, 0xFFFFFFFF, 0x300309B,
+    0x836C3, 0x4D9289, 0xC21B, 0xFFFFFFFF, 0xFFFFFFFF, 0x20C3490, 0x1842308, 0xFFFFFFFF, 0x384A018, 0x24C9610, 0xFFFFFFFF, 0x10A640,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1241B, 0xFFFFFFFF, 0x1299618, 0xFFFFFFFF, 0x3464000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1658092, 0x628C0,
+    0x609448, 0x6184A0, 0x1318258, 0x209201B, 0xFFFFFFFF, 0xFFFFFFFF, 0x92080, 0xFFFFFFFF, 0x512249, 0x128C002, 0x4249213, 0x41B600,
+    0x262248, 0x3490080, 0xC0260, 0xFFFFFFFF, 0xFFFFFFFF, 0x1840080, 0x185A018, 0x428C, 0xC2860, 0xFFFFFFFF, 0x3001889, 0xFFFFFFFF,
+    0x3088C8, 0x944B, 0xD8092, 0xFFFFFFFF, 0x848648, 0x12D2018, 0x9B880, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30180DA,
+    0xA2018, 0xFFFFFFFF, 0xFFFFFFFF, 0x4A29C, 0xFFFFFFFF, 0x30C0308, 0xFFFFFFFF, 0xFFFFFFFF, 0xCC061, 0xFFFFFFFF, 0x2DA01A, 0x60921A,
+    0x210A840, 0xCA4C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x3010248, 0x60B818, 0x2018, 0xFFFFFFFF, 0x34212C0, 0xFFFFFFFF, 0x1840418, 0xFFFFFFFF,
+    0x13000E1, 0x42C1488, 0x42406C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x2709600, 0xFFFFFFFF, 0xD841B, 0x12A1049, 0x2018248, 0xFFFFFFFF, 0x9218,
+    0x1988B, 0xFFFFFFFF, 0x400308, 0xFFFFFFFF, 0xFFFFFFFF, 0xB81B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x301948A, 0x826E0, 0x124B309,
+    0x3848000, 0x3600403, 0x309B248, 0x30030D8, 0x3021202, 0xFFFFFFFF, 0x1B311, 0x261801B, 0xFFFFFFFF, 0xFFFFFFFF, 0x618080, 0x304B248,
+    0xFFFFFFFF, 0x200B698, 0x300A889, 0x1090A2, 0x25B640, 0x4643018, 0x29A458, 0xFFFFFFFF, 0xFFFFFFFF, 0x911200, 0x12418D8, 0xFFFFFFFF,
+    0x3248013, 0xFFFFFFFF, 0xFFFFFFFF, 0x26024B, 0x891488, 0xFFFFFFFF, 0xFFFFFFFF, 0x308A500, 0xFFFFFFFF, 0x262848, 0x621880, 0x1965B,
+    0x2003248, 0xFFFFFFFF, 0x184324A, 0x2499200, 0x6212C2, 0x32C9258, 0x2881258, 0xFFFFFFFF, 0x3019258, 0x30C3018, 0x31121A, 0x1B698,
+    0x20026C8, 0x3004488, 0x113300, 0x4D9098, 0x44A843, 0x34180C3, 0xD80D3, 0x5B4D0, 0x300C202, 0x44A28C, 0x38430C0, 0x2603018,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6DA000, 0x3240064, 0x4243400, 0xFFFFFFFF, 0x14A0680, 0x449709, 0x130125A, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3318003, 0x602503, 0x2618, 0x29080C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x109318, 0x124210C, 0x619310, 0x6E1200, 0x324B403,
+    0x20C0000, 0x1843010, 0x81240, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2320018, 0x22A3400, 0x12498C0, 0x9818, 0xD0121, 0xDB01A,
+    0x400908, 0x24A10C, 0xFFFFFFFF, 0x9259, 0xC3680, 0x49649, 0xFFFFFFFF, 0x693240, 0x3521, 0x19313, 0xC30D0, 0x200C818,
+    0x4251243, 0x2518C9, 0x3049248, 0xFFFFFFFF, 0xFFFFFFFF, 0x4240613, 0x20C924C, 0x30C0112, 0x125B403, 0x1301B, 0xFFFFFFFF, 0x62498,
+    0x1703018, 0x2490003, 0xA720, 0xFFFFFFFF, 0xE4248, 0x4250109, 0xFFFFFFFF, 0x61A6C0, 0x3400, 0x461308, 0x1641303, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x604302, 0xFFFFFFFF, 0xFFFFFFFF, 0x522C9, 0x3003002, 0xFFFFFFFF, 0x926C0, 0x130924B, 0x2261243, 0x3258109, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x12E1249, 0x1C25A, 0xD9249, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C12A1, 0xFFFFFFFF, 0x48C0049, 0xFFFFFFFF, 0x712210, 0x251B000,
+    0x254259, 0x42890C9, 0x305C248, 0x34C2480, 0x2009460, 0xFFFFFFFF, 0x1241243, 0x61844C, 0x2603618, 0x200A489, 0x63848, 0x14A1249,
+    0xFFFFFFFF, 0x11240, 0x42C0600, 0xFFFFFFFF, 0x20C4300, 0x32910C9, 0x12406CC, 0x13848, 0x6DA049, 0xFFFFFFFF, 0xFFFFFFFF, 0x249242,
+    0x124010C, 0x4641289, 0x24D2200, 0x129A488, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1309018, 0x64C24A, 0x403061, 0x2486D8, 0x114249,
+    0xFFFFFFFF, 0x224C243, 0x2880049, 0x4242308, 0x24810C, 0x4DB003, 0xFFFFFFFF, 0x1A489, 0x664080, 0x2320049, 0x2484240, 0x124C4C8,
+    0x151C, 0x224B6C0, 0xD4300, 0x6101B, 0xFFFFFFFF, 0x18582C8, 0x18322, 0xFFFFFFFF, 0x324A308, 0x4254400, 0xFFFFFFFF, 0x1243613,
+    0xFFFFFFFF, 0xC3112, 0xFFFFFFFF, 0x148C242, 0x258661, 0x12536C0, 0x1300049, 0x8C86C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6186C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x490660, 0xFFFFFFFF, 0x12424D9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x709010, 0x3289000, 0xFFFFFFFF, 0x30804B,
+    0xFFFFFFFF, 0x2000263, 0xFFFFFFFF, 0x418661, 0xFFFFFFFF, 0x2C8, 0x2A2258, 0x3248094, 0xFFFFFFFF, 0x184128B, 0x12496D8, 0xFFFFFFFF,
+    0x648320, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1C299, 0x292640, 0x200070C, 0x30024C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x2145B,
+    0xC1902, 0x84928B, 0x6184A, 0x2516C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x65A418, 0x26D1280, 0x860098, 0xFFFFFFFF, 0x950B, 0x210C000,
+    0xFFFFFFFF, 0x3618648, 0x300C283, 0x69A249, 0x14D1000, 0xFFFFFFFF, 0xD2410, 0x1488318, 0x12C14A0, 0x4C9508, 0x659, 0xFFFFFFFF,
+    0x1649448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1070C, 0xFFFFFFFF, 0x708260, 0x2CB049, 0xFFFFFFFF, 0x4D9002, 0xFFFFFFFF, 0x2880649,
+    0x12A2240, 0x301030B, 0x149A410, 0x1252800, 0xFFFFFFFF, 0x12892CB, 0xFFFFFFFF, 0x1843098, 0xFFFFFFFF, 0x30D9218, 0xC16D0, 0x24DC000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x613092, 0x989B, 0x6D0092, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x25A803, 0x6C2018, 0x2600860, 0x496C9,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3603648, 0xFFFFFFFF, 0x600311, 0x12404D9, 0x13658, 0xFFFFFFFF, 0x1649218,
+    0xFFFFFFFF, 0x30212C9, 0x12588C8, 0x104DC, 0xFFFFFFFF, 0x1508308, 0x2512400, 0x26144B, 0x125830A, 0x1263203, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x425B080, 0xFFFFFFFF, 0x8DC, 0x322018, 0x65121B, 0x4012D2, 0xFFFFFFFF, 0x263488, 0x18E2, 0xFFFFFFFF, 0xFFFFFFFF, 0x2291603,
+    0x69104C, 0x611889, 0xFFFFFFFF, 0xFFFFFFFF, 0xD9888, 0x20180DB, 0x4C0308, 0xFFFFFFFF, 0xFFFFFFFF, 0x384A003, 0x164024B, 0x3009261,
+    0x60325B, 0x24992C0, 0x314440, 0x24C9049, 0x3600858, 0xFFFFFFFF, 0x3024202, 0x3112C9, 0x30E1202, 0xFFFFFFFF, 0x4240461, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2062289, 0x14D1602, 0x2619488, 0x424148A, 0x18D2000, 0x602121, 0x12580D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x2621203, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xC024B, 0xFFFFFFFF, 0x499210, 0x858248, 0x98248, 0xDA, 0xC284B, 0x324948A, 0xFFFFFFFF, 0x20D801B,
+    0x2600DA, 0x26DB, 0xFFFFFFFF, 0xDC218, 0x20C3248, 0x24B30A, 0x124A509, 0xA458, 0xFFFFFFFF, 0x1640018, 0x3611258, 0x12CC2C0,
+    0x3654200, 0x44800C0, 0xCC603, 0x4A28B, 0x61659, 0x2481700, 0x61B418, 0x50A840, 0xFFFFFFFF, 0xFFFFFFFF, 0x2DA000, 0x8B698,
+    0xFFFFFFFF, 0x18880C3, 0x2619258, 0x490248, 0xFFFFFFFF, 0xFFFFFFFF, 0x34880C3, 0x1303243, 0xFFFFFFFF, 0x492848, 0x4303400, 0x1240513,
+    0x3054203, 0x260C203, 0xD324B, 0xFFFFFFFF, 0xFFFFFFFF, 0x30D0848, 0x3660000, 0xFFFFFFFF, 0x4240112, 0x3000064, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x9203, 0x519200, 0x3610003, 0x848400, 0x301B013, 0x30D8003, 0x305B402, 0xFFFFFFFF, 0x26C80C0, 0x1844480, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3848002, 0xFFFFFFFF, 0xFFFFFFFF, 0x1841309, 0x4C0908, 0xC261, 0x1309308, 0xFFFFFFFF, 0x62448, 0x68301B, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3680618, 0x16D00C2, 0x4C09B, 0x14A2440, 0x4311240, 0x45221B, 0x2604258, 0xFFFFFFFF, 0x682498, 0xFFFFFFFF, 0x329A600, 0x30490D8,
+    0xD301B, 0x42404A0, 0x412890, 0xFFFFFFFF, 0x124C200, 0x6D80C2, 0x30614C0, 0x662218, 0x3319240, 0x1858002, 0x364B003, 0x14D1083,
+    0xFFFFFFFF, 0x2621249, 0xFFFFFFFF, 0x3019803, 0x98848, 0x32C9243, 0x42C0109, 0xFFFFFFFF, 0x41B061, 0x3019243, 0x1901242, 0xC2880,
+    0x1292203, 0xFFFFFFFF, 0x20C3848, 0x602603, 0xFFFFFFFF, 0x1B0C9, 0x1640618, 0x2021803, 0x253680, 0xFFFFFFFF, 0x1258000, 0x44806C0,
+    0x4A889, 0x4098C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x125A600, 0xC4310, 0xFFFFFFFF, 0x165B003, 0xFFFFFFFF, 0x3, 0x1301240, 0x510000,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x260000, 0x89124A, 0x3052202, 0xFFFFFFFF, 0x4C30A, 0x12C02DA, 0x262603, 0x452491, 0x1303289, 0x2003000,
+    0xFFFFFFFF, 0x1843002, 0x1243119, 0x309243, 0xFFFFFFFF, 0x3249850, 0x3000663, 0xFFFFFFFF, 0x83848, 0x9803, 0xFFFFFFFF, 0xD844C,
+    0x3004243, 0x2482649, 0x3086C2, 0x24E3, 0xFFFFFFFF, 0xFFFFFFFF, 0x4044D1, 0x3018492, 0xFFFFFFFF, 0x1889018, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x40C249, 0x601858, 0xFFFFFFFF, 0xFFFFFFFF, 0xC1520, 0xFFFFFFFF, 0x84A482, 0x3293440, 0xFFFFFFFF, 0x304A250, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x10C24A, 0x1242483, 0x891013, 0x3062640, 0xFFFFFFFF, 0x200B6C9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xCB2D8, 0x42C1840, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3649003, 0xFFFFFFFF, 0xFFFFFFFF, 0x492092, 0x12A1400, 0x12C36C0, 0x364B600, 0x14D4240, 0xFFFFFFFF, 0xFFFFFFFF, 0x4006C0,
+    0x24B4A0, 0xFFFFFFFF, 0x1C240, 0xC344C, 0xFFFFFFFF, 0x4249280, 0x3019850, 0x9B448, 0xFFFFFFFF, 0x64A310, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x600049, 0x4DC240, 0x1B6C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x300B218, 0xFFFFFFFF, 0x304B603, 0x2603600, 0x1508061, 0xFFFFFFFF, 0x3018708,
+    0xFFFFFFFF, 0x2848092, 0x1889289, 0xFFFFFFFF, 0x4A0490, 0x68128C, 0x604689, 0xFFFFFFFF, 0x4610C0, 0xFFFFFFFF, 0x52649, 0x3012410,
+    0x609848, 0xFFFFFFFF, 0xCC0C0, 0x30892D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x264C, 0x1309003, 0x1318098, 0x3609448, 0x40304C, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3400649, 0x3680308, 0xFFFFFFFF, 0x2496D2, 0x2480649, 0x613603, 0x1261280, 0xFFFFFFFF, 0x2CB490, 0x3003262, 0x613049,
+    0x320098, 0x188D9, 0x4840083, 0xFFFFFFFF, 0x300428B, 0x261508, 0x9292, 0xC20D8, 0xFFFFFFFF, 0x711448, 0xFFFFFFFF, 0x1242018,
+    0x3840308, 0x260024B, 0x521000, 0x4A0260, 0xFFFFFFFF, 0xFFFFFFFF, 0x2064003, 0x448824A, 0xFFFFFFFF, 0xFFFFFFFF, 0x11A300, 0x44C0C3,
+    0x6D8258, 0xFFFFFFFF, 0x129A243, 0x6804D9, 0x24892D0, 0xA12D8, 0xFFFFFFFF, 0x32DA010, 0x8D1448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x124CC, 0xFFFFFFFF, 0x42420C3, 0x41864C, 0x248041B, 0x124B261, 0xFFFFFFFF, 0x3248080, 0xFFFFFFFF, 0x43000D0, 0x12496C0, 0xFFFFFFFF,
+    0x291610, 0xD8258, 0xFFFFFFFF, 0x804D9, 0x83092, 0x6D2402, 0xFFFFFFFF, 0x4C003, 0x20C1889, 0xFFFFFFFF, 0xFFFFFFFF, 0x3049600,
+    0x2A1109, 0x209C440, 0xFFFFFFFF, 0x254283, 0x98308, 0xFFFFFFFF, 0xFFFFFFFF, 0x2009491, 0x84A291, 0x14A024A, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x32512C2, 0x308A440, 0xFFFFFFFF, 0x1242294, 0x619498, 0xFFFFFFFF, 0x16400D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x349001A, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1494210, 0x60C44A, 0xFFFFFFFF, 0xFFFFFFFF, 0x661049, 0x164A458, 0x2DA0C2, 0x6092C9, 0x18464, 0xFFFFFFFF,
+    0x2308248, 0xFFFFFFFF, 0x3289260, 0x36A2, 0x1264440, 0xC0683, 0xFFFFFFFF, 0x4014D4, 0x185A440, 0x613640, 0x305C600, 0x4840680,
+    0xDB648, 0x8580D8, 0x1240013, 0x1250692, 0x1B4D8, 0xFFFFFFFF, 0x2009261, 0x3311200, 0x14A0018, 0x4292200, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x28A1200, 0x344924B, 0x1242061, 0x30D80C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x1520248, 0x248018, 0x4C92C3, 0xB309, 0x131A003, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x12414E1, 0xFFFFFFFF, 0xFFFFFFFF, 0x70801B, 0xFFFFFFFF, 0x6A1200, 0x1242500, 0x224B018, 0x64C049, 0x4900D8,
+    0xFFFFFFFF, 0x80064, 0x1259310, 0x19264, 0x1321202, 0xFFFFFFFF, 0x41B24B, 0x251800, 0x428924A, 0xFFFFFFFF, 0xD30D8, 0x3309250,
+    0x24A503, 0x252840, 0x124C2C2, 0xFFFFFFFF, 0x51C200, 0x4C602, 0x2649308, 0x18580C0, 0x30B0D0, 0x18123, 0xFFFFFFFF, 0x148B01A,
+    0x329124A, 0x12D3242, 0x1300403, 0xFFFFFFFF, 0x3908002, 0xFFFFFFFF, 0x30C0510, 0x1240291, 0x3049083, 0xFFFFFFFF, 0x4B4C9, 0x26D8000,
+    0x6026C0, 0x1242891, 0x1258680, 0xFFFFFFFF, 0x16406D8, 0x3890000, 0x60210C, 0x12580C2, 0x4659240, 0x649258, 0x200061B, 0x248293,
+    0x3649400, 0x3489300, 0xFFFFFFFF, 0x324844C, 0x661648, 0xFFFFFFFF, 0x263243, 0xC0, 0x6486D8, 0xD4488, 0x325B0C0, 0x20D8003,
+    0x609309, 0x1918000, 0xFFFFFFFF, 0x324A489, 0x30012A3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xC06DA, 0x51A440, 0xFFFFFFFF, 0x1840509,
+    0x262109, 0xB463, 0xFFFFFFFF, 0x3089803, 0x5930B, 0x12D4000, 0x4E1800, 0x98C3, 0xFFFFFFFF, 0xDB0C9, 0x12C0848, 0x1850003,
+    0x6C2049, 0x2600891, 0x16D02C8, 0x848509, 0x4258600, 0x1243683, 0xFFFFFFFF, 0xFFFFFFFF, 0x369A200, 0xFFFFFFFF, 0x1488112, 0x12430C2,
+    0x125A490, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24A661, 0x98003, 0x320003, 0xFFFFFFFF, 0x2093840, 0x300004C, 0x30106C3, 0x6A1249,
+    0xFFFFFFFF, 0x64C080, 0x34C0600, 0x2019240, 0x24B0C9, 0x1859242, 0x6214C8, 0x32486C2, 0xFFFFFFFF, 0x2323000, 0x3019460, 0xFFFFFFFF,
+    0xC813, 0xFFFFFFFF, 0x590D8, 0xFFFFFFFF, 0x30C00A2, 0x6102DA, 0xFFFFFFFF, 0xFFFFFFFF, 0x4B064, 0x25006C0, 0x602263, 0xFFFFFFFF,
+    0x1C309, 0xFFFFFFFF, 0x4C080, 0x3449061, 0x6006C9, 0x304C240, 0x1303002, 0xFFFFFFFF, 0x409520, 0xFFFFFFFF, 0x60010B, 0x6C1299,
+    0x324128C, 0x4B500, 0x424304B, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C9018, 0xFFFFFFFF, 0x493059, 0xFFFFFFFF, 0x83000, 0x92094, 0x3053440,
+    0x2603109, 0x2000661, 0xFFFFFFFF, 0x41B618, 0xFFFFFFFF, 0x89A200, 0xC1853, 0x16E0049, 0x1844240, 0x60C4C8, 0x30A480, 0x3401289,
+    0x484024A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1254403, 0x3059061, 0x1640603, 0x848660, 0x300961B, 0x603613, 0xA48B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x59908, 0x698600, 0x60305C, 0x6C0049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x698049, 0x613109, 0x30E1000, 0x4489448,
+    0x2618260, 0xFFFFFFFF, 0x6024D9, 0x8B6C9, 0x125B04B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12436C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3300092, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C1508, 0x3491448, 0x510490, 0xFFFFFFFF, 0xFFFFFFFF, 0x6096D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x42C9218,
+    0x300009B, 0x4C304C, 0x92308, 0xFFFFFFFF, 0x198A0, 0x2003493, 0x40030B, 0x24B119, 0xFFFFFFFF, 0xFFFFFFFF, 0x292242, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6D3049, 0x188B600, 0x4B661, 0xFFFFFFFF, 0x3021218, 0x61030B, 0xC292, 0xFFFFFFFF, 0x4C680,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x30CC000, 0x291112, 0xFFFFFFFF, 0x848318, 0x44C9049, 0x12408D9, 0x30496C9, 0xFFFFFFFF, 0x42C024B, 0xFFFFFFFF,
+    0x6824C9, 0x124031B, 0x61A0D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1241310, 0x4649218, 0xFFFFFFFF, 0x662242, 0x3260418,
+    0x36C9210, 0x612800, 0xFFFFFFFF, 0xD24C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x248314, 0xFFFFFFFF, 0x22492D2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3019249, 0x2632C8, 0xFFFFFFFF, 0x3691600, 0xFFFFFFFF, 0x62800, 0x301A291, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x49891, 0x330A0C0,
+    0x14A1218, 0x6C0649, 0x3403308, 0x3109602, 0xE4003, 0x4251488, 0x69B202, 0x4640248, 0x212D0, 0x42C001B, 0x4243418, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x36000D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x2592D2, 0x623200, 0x1318083, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3659, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3093640, 0x6A3400, 0x9B200, 0x318308, 0xDA003, 0x8DA400, 0x3003240, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2A3480, 0x34D8018, 0xFFFFFFFF, 0xFFFFFFFF, 0x449049, 0xFFFFFFFF, 0xFFFFFFFF, 0x1653640, 0xFFFFFFFF, 0x81719,
+    0xFFFFFFFF, 0x21661, 0xE1213, 0x4A0248, 0xFFFFFFFF, 0x89494, 0xFFFFFFFF, 0xFFFFFFFF, 0x3600461, 0xFFFFFFFF, 0x252900, 0x12D801B,
+    0x9713, 0x6D8248, 0x4241640, 0xFFFFFFFF, 0x36D8400, 0xFFFFFFFF, 0x452849, 0xFFFFFFFF, 0x201244C, 0x1701488, 0x1240911, 0x93253,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x36034C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x124B24C, 0x3491249, 0xFFFFFFFF, 0xFFFFFFFF, 0x3003018, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1309260, 0x128B061, 0x404889, 0x3320000, 0x3084C3, 0xFFFFFFFF, 0x180D0, 0xFFFFFFFF, 0x84824B, 0x25324C, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x18C9200, 0x3292200, 0x263300, 0x2860000, 0xC131A, 0xFFFFFFFF, 0x62850, 0x248C202, 0x99318, 0xFFFFFFFF,
+    0x32D2049, 0x4C492, 0xFFFFFFFF, 0x603691, 0xA500, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x36C3400, 0x204A2D2, 0x6C00C9, 0x304C098,
+    0x18A00C0, 0xFFFFFFFF, 0x1491649, 0x12D8291, 0x623800, 0x14880, 0xD0294, 0x164A443, 0xFFFFFFFF, 0x264200, 0x30B403, 0x13180C0,
+    0xD8000, 0x1661249, 0x3018618, 0x9B800, 0xFFFFFFFF, 0x64A6C8, 0x16498C0, 0x3003848, 0x301805C, 0x9B24B, 0x448004C, 0x1899248,
+    0x1649309, 0x30006D0, 0x20DB018, 0x980C3, 0x1B4C3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x252499, 0x6114D1, 0x1888061, 0xFFFFFFFF,
+    0x4C260, 0x1700000, 0x301B0C0, 0x619253, 0x304C418, 0x3243003, 0xFFFFFFFF, 0x248010, 0x12D8618, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x10B291, 0x60C200, 0x304A2C0, 0xC9309, 0xD0061, 0x4241689, 0xFFFFFFFF, 0x124924B, 0x891083, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x309640, 0x1259300, 0x3680109, 0xFFFFFFFF, 0x2E0061, 0x112490, 0x20522D8, 0xFFFFFFFF, 0x324C249, 0xFFFFFFFF,
+    0x2CB291, 0x25124B, 0x30D06C0, 0x6C90D8, 0xFFFFFFFF, 0x34D9400, 0xFFFFFFFF, 0x301B449, 0x618003, 0x38406C0, 0xFFFFFFFF, 0x404303,
+    0x4C1300, 0xFFFFFFFF, 0xB680, 0x2254249, 0x2004303, 0xFFFFFFFF, 0x254280, 0x124185A, 0x6C1240, 0xFFFFFFFF, 0x12922C2, 0x612A1,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x891400, 0xFFFFFFFF, 0x493002, 0x622C0, 0x10C080, 0xFFFFFFFF, 0x112A4, 0x649248, 0x1640109, 0xFFFFFFFF,
+    0x249858, 0xFFFFFFFF, 0xFFFFFFFF, 0x31090C0, 0x3301289, 0x1840049, 0x112260, 0x1244300, 0xC1242, 0x6486C3, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4D9018, 0x428B600, 0x321240, 0x3418049, 0xFFFFFFFF, 0x24B2E0, 0xFFFFFFFF, 0x1252818, 0xFFFFFFFF, 0x4842248, 0x3003889, 0x24C300,
+    0x9B283, 0xFFFFFFFF, 0xC010C, 0x200984C, 0xFFFFFFFF, 0x2653440, 0x124004B, 0xFFFFFFFF, 0xC2709, 0xFFFFFFFF, 0x8E2200, 0x3022418,
+    0x284B049, 0x1889680, 0xFFFFFFFF, 0xFFFFFFFF, 0x170004C, 0xFFFFFFFF, 0xFFFFFFFF, 0x1264B, 0x649010, 0xE1298, 0x24804B, 0x204B6C8,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xC9908, 0x661400, 0x1491458, 0xFFFFFFFF, 0x894240, 0xFFFFFFFF, 0xFFFFFFFF, 0x70804C, 0xFFFFFFFF, 0x30D0260,
+    0x1263218, 0x1984C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x918600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x858490, 0x1498649, 0x1902,
+    0xFFFFFFFF, 0xD3109, 0xFFFFFFFF, 0x590C3, 0x20D9840, 0x2920, 0x18712, 0xFFFFFFFF, 0xFFFFFFFF, 0x20196D0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2910C0, 0xFFFFFFFF, 0x1640263, 0x300A858, 0x600694, 0x44B498, 0x1921000, 0xFFFFFFFF, 0x3619218, 0xFFFFFFFF, 0x124010, 0x6C1289,
+    0xFFFFFFFF, 0x310A240, 0x493602, 0xFFFFFFFF, 0x4D2418, 0xFFFFFFFF, 0x649848, 0xFFFFFFFF, 0xFFFFFFFF, 0x109509, 0x92083, 0x6C32C8,
+    0x64928C, 0x1289449, 0x400092, 0x3011488, 0xFFFFFFFF, 0x126144A, 0xC0262, 0xFFFFFFFF, 0xFFFFFFFF, 0x2492DB, 0x98260, 0x14900,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x610092, 0x34920C0, 0xD8094, 0x84864B, 0xFFFFFFFF, 0x301B258, 0x44A243, 0xFFFFFFFF,
+    0x2A40C0, 0xFFFFFFFF, 0x2021218, 0x3291049, 0xFFFFFFFF, 0x4488418, 0xFFFFFFFF, 0x61660, 0xFFFFFFFF, 0x6014A0, 0x1064C, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x12D24C0, 0x20496C3, 0x44910C, 0x649610, 0xFFFFFFFF, 0xFFFFFFFF, 0x301024B, 0x6192D8, 0x6C3098, 0xFFFFFFFF,
+    0xE12D0, 0xFFFFFFFF, 0x184041B, 0x26201B, 0x1261218, 0xFFFFFFFF, 0x664002, 0x264C600, 0x60C283, 0x149B, 0xFFFFFFFF, 0x4840013,
+    0x12A104B, 0x300165B, 0x261498, 0x30B258, 0x19888, 0xFFFFFFFF, 0x2500248, 0xFFFFFFFF, 0x3080E1, 0x922, 0x192D2, 0x4904C,
+    0x596C0, 0x25444A, 0x30C0691, 0xFFFFFFFF, 0x3848018, 0xFFFFFFFF, 0x30030D3, 0x2512C2, 0x30C00D0, 0xFFFFFFFF, 0x509049, 0x150824B,
+    0x30980D8, 0x6920C2, 0x618083, 0x125824B, 0xFFFFFFFF, 0xFFFFFFFF, 0x14884D8, 0x3023249, 0x125A848, 0x12459, 0x4488680, 0x16412D2,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3491203, 0x648860, 0x492061, 0x1492840, 0x26024A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x26CA000,
+    0xFFFFFFFF, 0x920C2, 0x624440, 0xC0862, 0xFFFFFFFF, 0xFFFFFFFF, 0x2498D8, 0x2499203, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x249321, 0x610692, 0x1A0C0, 0xFFFFFFFF, 0x16D2000, 0x26D1200, 0x18584C0, 0x6100D8, 0xFFFFFFFF, 0x29404B, 0xFFFFFFFF, 0x3001302,
+    0x4C0121, 0x24980C9, 0xFFFFFFFF, 0xC3300, 0x4A8A0, 0x4098D8, 0x1243248, 0xFFFFFFFF, 0x4480109, 0x16D9200, 0xE2450, 0xFFFFFFFF,
+    0x609813, 0x4641240, 0x238C0, 0x2618291, 0xFFFFFFFF, 0xFFFFFFFF, 0x12D9258, 0x100DB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24B24B,
+    0x262618, 0x6C30D0, 0x32430C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x2480D0, 0x60C880, 0x3400061, 0x4480000, 0xFFFFFFFF, 0x409203, 0x24A6CA,
+    0x60C2C0, 0xFFFFFFFF, 0xD8461, 0x3610618, 0xFFFFFFFF, 0x11B410, 0x2500, 0x14DC200, 0xFFFFFFFF, 0x18C00C3, 0x2D4203, 0x253460,
+    0x3488000, 0x19310, 0xFFFFFFFF, 0xFFFFFFFF, 0x1488063, 0x4C9249, 0x304924A, 0x32D1249, 0x2889249, 0xFFFFFFFF, 0xFFFFFFFF, 0x3021249,
+    0x618683, 0x4489242, 0x4B0D8, 0x84B4C0, 0xFFFFFFFF, 0x124249A, 0x31A218, 0xFFFFFFFF, 0x490061, 0x425B000, 0x24B013, 0x84B,
+    0x12494, 0x32402DA, 0xFFFFFFFF, 0xFFFFFFFF, 0x604310, 0x260858, 0x3491242, 0xFFFFFFFF, 0x261B0C0, 0x418064, 0xFFFFFFFF, 0x30A04C,
+    0x2248891, 0xD14D1, 0x18C3000, 0xFFFFFFFF, 0x1851300, 0x2499800, 0x19690, 0x3419240, 0x4249298, 0x1843289, 0x814D1, 0xFFFFFFFF,
+    0xC02E0, 0x16D2600, 0x3003488, 0x41B0C3, 0x613291, 0x31124B, 0x1A109, 0x653680, 0x30044C9, 0x300C800, 0x12502DA, 0x1258610,
+    0xC2320, 0xFFFFFFFF, 0xFFFFFFFF, 0x603680, 0x1242260, 0xFFFFFFFF, 0x260304C, 0xFFFFFFFF, 0x1523000, 0xFFFFFFFF, 0xA3680, 0x188A2C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x12C2480, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3682480, 0x66101A, 0x3318049, 0x260059, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1289858, 0xFFFFFFFF, 0x1700109, 0xFFFFFFFF, 0xFFFFFFFF, 0x32C8049, 0xD22C3, 0x409800, 0x12CC249, 0x812A1, 0xFFFFFFFF, 0x4480049,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x301A649, 0x2053500, 0x9859, 0x294418, 0xFFFFFFFF, 0x6101A, 0x80721, 0x2711400, 0x19910, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3009458, 0x600890, 0x1243610, 0x2424B, 0xFFFFFFFF, 0x490D0, 0x148C240, 0x3021848, 0xFFFFFFFF, 0x260128C, 0x50C248,
+    0x3603049, 0xFFFFFFFF, 0x44E1000, 0x44C0D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x4240092, 0xFFFFFFFF, 0x28C90C0, 0x12582CB, 0x64C01A, 0xFFFFFFFF,
+    0x54460, 0x24B059, 0xFFFFFFFF, 0x14D2242, 0xFFFFFFFF, 0x1289061, 0x528D0, 0x1498603, 0xFFFFFFFF, 0xFFFFFFFF, 0x2261840, 0x52312,
+    0xFFFFFFFF, 0x1498049, 0x124C298, 0x6C90C0, 0xC2482, 0x1652418, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3403490, 0xC34A0, 0x4C013,
+    0x30024CB, 0x3292800, 0x4910, 0xC1900, 0xFFFFFFFF, 0xFFFFFFFF, 0x61848, 0x1241840, 0xFFFFFFFF, 0x6D8602, 0x8C8490, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x618490, 0xC90C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C3049, 0x123440, 0x1128C, 0xD2418, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x112802, 0x648, 0x31B049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24928B, 0xFFFFFFFF, 0x13012D8, 0xFFFFFFFF, 0x34D4000, 0xFFFFFFFF,
+    0x260098, 0x4D9003, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x20C064C, 0x1859448, 0x20D8, 0x22480C0, 0x20004DC, 0xFFFFFFFF, 0x328A289,
+    0x94500, 0xFFFFFFFF, 0x461000, 0x3253203, 0xFFFFFFFF, 0x301A688, 0x996D0, 0xC45B, 0xFFFFFFFF, 0x4C84A, 0x201830B, 0x861448,
+    0x2049661, 0x1254289, 0xFFFFFFFF, 0x4C28C, 0x3889049, 0x4888248, 0x30C9049, 0x304C449, 0xCB491, 0x4911C, 0xFFFFFFFF, 0x12DB200,
+    0x1243098, 0x1365A, 0x5096C0, 0xFFFFFFFF, 0x36C0080, 0x2490649, 0x125B488, 0x21096C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3289603,
+    0x30864B, 0x6CA240, 0x2093258, 0xFFFFFFFF, 0x30100D8, 0x932C0, 0x3488, 0xFFFFFFFF, 0x3080248, 0x3002064, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x6C96C0, 0xC14A0, 0x32480D8, 0x30004C3, 0x18412C3, 0x205B648, 0xFFFFFFFF, 0x305A840, 0x31120C0, 0xFFFFFFFF, 0x4C030B, 0xA121B,
+    0xFFFFFFFF, 0x24618, 0x4C04C, 0x10904C, 0xFFFFFFFF, 0x24A1600, 0x1300418, 0x368001B, 0xE104C, 0xFFFFFFFF, 0x6000E1, 0x3049098,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x492018, 0xFFFFFFFF, 0xFFFFFFFF, 0x1258698, 0x6D8083, 0x65B480, 0xFFFFFFFF, 0x680308, 0x60A453, 0x12580DA,
+    0xCB700, 0xFFFFFFFF, 0x4249202, 0xFFFFFFFF, 0x124330A, 0x69B, 0xFFFFFFFF, 0xFFFFFFFF, 0x85824B, 0x30C0400, 0x260698, 0x1B649,
+    0x64B291, 0xFFFFFFFF, 0xFFFFFFFF, 0x20D8018, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3251203, 0x20C324B, 0x301B240, 0xA45B, 0x461600,
+    0x34C1840, 0x49263, 0x30022DA, 0x119490, 0x6C001B, 0xFFFFFFFF, 0xFFFFFFFF, 0x59320, 0x2509203, 0x12D4049, 0x125A003, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x20CA443, 0x30C1310, 0x618291, 0x50A289, 0xFFFFFFFF, 0x4241250, 0x413640, 0x6034D1, 0x130324A, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1494600, 0x262003, 0x1261202, 0xC001B, 0xFFFFFFFF, 0xFFFFFFFF, 0x12D80D8, 0x98018, 0x3492440, 0x3249253,
+    0xFFFFFFFF, 0x30106D8, 0x24B698, 0x30B24A, 0xFFFFFFFF, 0x2308061, 0x49C600, 0x20C3018, 0x12E2440, 0x93300, 0xC04C0, 0xFFFFFFFF,
+    0x164C2C0, 0xFFFFFFFF, 0x1240403, 0xFFFFFFFF, 0xC14E1, 0x3248119, 0xFFFFFFFF, 0x148A618, 0x2848848, 0xA1818, 0xFFFFFFFF, 0x16D0680,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C098, 0xFFFFFFFF, 0x2532D8, 0xFFFFFFFF, 0x6C0293, 0x29A44A, 0xFFFFFFFF,
+    0x851649, 0x1850848, 0x12402E3, 0x30E1248, 0xCC2C0, 0xFFFFFFFF, 0x16580C0, 0xFFFFFFFF, 0x125A, 0xFFFFFFFF, 0x324A600, 0x4853000,
+    0xFFFFFFFF, 0x8301B, 0x1258119, 0x19640, 0xFFFFFFFF, 0x4000C0, 0x858848, 0x185A600, 0x9884B, 0x32C9240, 0x128A498, 0x3000893,
+    0x254202, 0x30C0449, 0xFFFFFFFF, 0xFFFFFFFF, 0x3251800, 0xFFFFFFFF, 0x2482880, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3691018, 0x62218,
+    0xFFFFFFFF, 0xA2618, 0x188924A, 0xFFFFFFFF, 0x4A88B, 0x4098C3, 0x862049, 0xFFFFFFFF, 0xFFFFFFFF, 0x29A210, 0xFFFFFFFF, 0x148A880,
+    0x121248, 0x124425A, 0x304A48A, 0x64861B, 0x493400, 0x412660, 0x60924B, 0x891248, 0x14258, 0xFFFFFFFF, 0x403003, 0x3009518,
+    0x60B849, 0x619300, 0xC061B, 0x663003, 0xFFFFFFFF, 0x1843000, 0x3512200, 0x4643, 0x260C249, 0x4840602, 0x402498, 0x43002C8,
+    0x9804C, 0x320059, 0x64B0C0, 0x2002480, 0x3004242, 0x1842480, 0xFFFFFFFF, 0x924B, 0x2262480, 0x7090D0, 0x40C800, 0x2482092,
+    0x30D8049, 0xB84C, 0xFFFFFFFF, 0xFFFFFFFF, 0x409690, 0x25861B, 0xFFFFFFFF, 0xFFFFFFFF, 0x6522C0, 0xFFFFFFFF, 0x3003109, 0x8A48C,
+    0xFFFFFFFF, 0x1888490, 0x2618049, 0x490610, 0x3010600, 0x2489298, 0x1303610, 0x24CC240, 0x4950C, 0x34490C0, 0x1090D0, 0xFFFFFFFF,
+    0x452261, 0xFFFFFFFF, 0x1289013, 0xFFFFFFFF, 0x1214C0, 0x1241909, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1658109, 0xFFFFFFFF, 0x2863,
+    0x14D1680, 0xFFFFFFFF, 0xFFFFFFFF, 0x2CC243, 0xFFFFFFFF, 0x2291, 0x291013, 0xFFFFFFFF, 0xFFFFFFFF, 0x249902, 0x254800, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3308098, 0xFFFFFFFF, 0x30C3049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x300031B, 0xFFFFFFFF, 0xFFFFFFFF, 0x312258,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x301B2C8, 0xFFFFFFFF, 0xA2649, 0xFFFFFFFF, 0x4A8C0, 0x14882C8, 0xFFFFFFFF, 0x1244850, 0xFFFFFFFF,
+    0x2251508, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x260603, 0x1301289, 0xFFFFFFFF, 0xFFFFFFFF, 0x2649618, 0x4C0600, 0xFFFFFFFF, 0x14D4010,
+    0xFFFFFFFF, 0x2003600, 0x1843602, 0xFFFFFFFF, 0x93498, 0xC0659, 0xFFFFFFFF, 0x59848, 0x1843049, 0x2483248, 0x9B218, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x30006A2, 0xFFFFFFFF, 0x4DC010, 0x1508, 0xFFFFFFFF, 0x20024C9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x449064, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2292240, 0x30184D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3421218, 0x1488092, 0xFFFFFFFF, 0xFFFFFFFF, 0x22698, 0x2618649,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x258092, 0x30E2400, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2291109, 0xFFFFFFFF, 0x891059, 0x3852400, 0x1289613,
+    0x3092400, 0x109112, 0xFFFFFFFF, 0x14D2240, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1899, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x12A4002, 0x24A4C9, 0x12DB, 0x1B262, 0x341824B, 0xD825B, 0x5B658, 0x69201A, 0x2612D8, 0xFFFFFFFF, 0x3900248, 0xFFFFFFFF,
+    0x42492C0, 0x600649, 0x3318, 0x3049602, 0xFFFFFFFF, 0x30800DB, 0xFFFFFFFF, 0x3021600, 0x61A018, 0x448801A, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x6924C0, 0xFFFFFFFF, 0x125864B, 0xFFFFFFFF, 0x32512C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x12D20C9, 0x28480D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x30CA289, 0x62121A, 0x3681488, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x60C448, 0x1262400, 0x2609261, 0x70824B, 0x2DA0C9,
+    0x18500D8, 0x6092CC, 0x3052280, 0xFFFFFFFF, 0x18C0248, 0x330A000, 0x4309200, 0x30D1488, 0x3403248, 0xC325B, 0x42E1200, 0x1843083,
+    0x2620C0, 0x46CB, 0x12612C2, 0x65244A, 0x712003, 0xFFFFFFFF, 0x24800D0, 0xFFFFFFFF, 0x3849203, 0x8C8248, 0x2291260, 0x184A840,
+    0x249B080, 0x92D8, 0xCA45A, 0xFFFFFFFF, 0x4250291, 0x109262, 0xFFFFFFFF, 0xA2458, 0x324301B, 0x16D12C0, 0x14880D3, 0x604498,
+    0x1243083, 0x13650, 0xFFFFFFFF, 0x4240680, 0xFFFFFFFF, 0x14A3080, 0x60C210, 0x6C9203, 0xC9320, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1249261, 0xFFFFFFFF, 0xFFFFFFFF, 0x42426C0, 0xFFFFFFFF, 0x1859203, 0x1900403, 0x1300510, 0x1289094, 0xFFFFFFFF, 0x1840293, 0xFFFFFFFF,
+    0x4483, 0xFFFFFFFF, 0x4843010, 0x49A450, 0xFFFFFFFF, 0x99488, 0x1313, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x18580C9,
+    0x18109, 0x24600, 0xFFFFFFFF, 0x25000C3, 0x603248, 0xFFFFFFFF, 0xFFFFFFFF, 0xCB249, 0xFFFFFFFF, 0x712280, 0x251709, 0xA3243,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x4B4CB, 0x40A503, 0x122448, 0x1258683, 0x10294, 0xFFFFFFFF, 0x2C801B, 0x10C098, 0x2049308, 0x12580C9,
+    0x18013, 0xD2449, 0x4242490, 0x2021309, 0xFFFFFFFF, 0x621259, 0x224925B, 0x16E0000, 0x3308000, 0x2492A1, 0xFFFFFFFF, 0xCC,
+    0x130C202, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C3248, 0x185B010, 0x1C640, 0xC3858, 0xFFFFFFFF, 0x3002880, 0x4C00C0, 0x1251258, 0x6D2218,
+    0x21818, 0x3083061, 0xFFFFFFFF, 0x24806D0, 0x314202, 0x3849800, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4CA440, 0x98C9, 0x3849240,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3004302, 0x1242661, 0x38CB000, 0x1318003, 0x310B000, 0x129B400, 0x10A888, 0x20490D8, 0x2851800, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x248061, 0x60C810, 0x3010, 0xFFFFFFFF, 0x661418, 0xFFFFFFFF, 0x331B000, 0x6A1800, 0x1B403, 0x42C2480,
+    0x12A1018, 0xFFFFFFFF, 0x419258, 0x922CB, 0x224B061, 0xC2049, 0x2000894, 0x264A488, 0x3018449, 0x46C8049, 0x192A3, 0x34C004C,
+    0x8D9248, 0x18DB000, 0x11924B, 0x191A, 0x32CA480, 0x2882480, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C4240, 0xFFFFFFFF, 0x188B003, 0xFFFFFFFF,
+    0x2018109, 0x36D0049, 0x90B002, 0xA1249, 0xCB849, 0x1641858, 0x148B059, 0xFFFFFFFF, 0x1240890, 0xB6D9, 0x214C8, 0xFFFFFFFF,
+    0x719018, 0xFFFFFFFF, 0xFFFFFFFF, 0x10894, 0xFFFFFFFF, 0x36002C8, 0x3890600, 0xFFFFFFFF, 0x30D0603, 0x18610, 0x511240, 0x709403,
+    0x3010493, 0x261240, 0x92098, 0x128D8, 0xFFFFFFFF, 0x3080600, 0x2E3000, 0xFFFFFFFF, 0xFFFFFFFF, 0xC1858, 0x3248490, 0xFFFFFFFF,
+    0x4261600, 0x119018, 0x42A3, 0xC1299, 0xFFFFFFFF, 0x30018A0, 0xFFFFFFFF, 0x4899000, 0x2709, 0xFFFFFFFF, 0xDC249, 0x62203,
+    0x4C0109, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x84C240, 0xFFFFFFFF, 0xFFFFFFFF, 0x304C01A, 0x29A200, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x30C0318, 0x2061061, 0x6D0109, 0x3064400, 0xE3448, 0x41264B, 0xFFFFFFFF, 0x1258492, 0x14243, 0xFFFFFFFF, 0x26C3049, 0x3011843,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xC0600, 0xFFFFFFFF, 0x36020D8, 0x112649, 0xFFFFFFFF, 0xFFFFFFFF, 0xC004C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x260490, 0x13109, 0xFFFFFFFF, 0xFFFFFFFF, 0x26CA248, 0x4C0493, 0x84843, 0xFFFFFFFF, 0xFFFFFFFF, 0x12896C0, 0x7090C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1889002, 0xC4689, 0xFFFFFFFF, 0x596D8, 0x600262, 0xFFFFFFFF, 0xFFFFFFFF, 0x509618, 0xFFFFFFFF, 0x14980C0, 0x121002,
+    0xFFFFFFFF, 0x304A243, 0xFFFFFFFF, 0xFFFFFFFF, 0x3009891, 0x603889, 0x1258262, 0x2603260, 0xFFFFFFFF, 0x2D1508, 0x4258418, 0x2052800,
+    0xB718, 0x21508, 0x4A520, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x262, 0xFFFFFFFF, 0x3600308, 0x59003, 0x3013650, 0x92698,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x662249, 0x2C8092, 0x24B492, 0x920DA, 0x130A243, 0x6E4000, 0xFFFFFFFF, 0x40428C, 0x2483400, 0x708,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3308083, 0x694003, 0xFFFFFFFF, 0x22418, 0x24D9049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x49B2C0, 0x10C003, 0x30C921A, 0x12800, 0xFFFFFFFF, 0xFFFFFFFF, 0x2D12D8, 0xFFFFFFFF, 0x12406A2, 0x314280,
+    0x212D3, 0x3600691, 0x4259203, 0xFFFFFFFF, 0x61B488, 0xFFFFFFFF, 0x1310308, 0x231A400, 0x6110B, 0x2649600, 0x249024B, 0x3492000,
+    0x4491202, 0x129B480, 0xFFFFFFFF, 0x2486A2, 0xFFFFFFFF, 0xFFFFFFFF, 0x64A689, 0x360A450, 0x689491, 0xFFFFFFFF, 0x9B203, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x52518, 0x3000691, 0x18530C0, 0x449603, 0xFFFFFFFF, 0x32492C3, 0x400920, 0x1849218, 0x124A900, 0x2518, 0x292850,
+    0x3419488, 0xFFFFFFFF, 0x301B083, 0x1861600, 0x1A908, 0xFFFFFFFF, 0x659603, 0x64610, 0xFFFFFFFF, 0x24A1202, 0x3049260, 0xFFFFFFFF,
+    0x3081318, 0x2DA400, 0xFFFFFFFF, 0x609603, 0x6D824A, 0x8C80D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x2490018, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4C10B, 0xFFFFFFFF, 0x60330A, 0x93242, 0x13004C0, 0x3244488, 0x59603, 0x3452448, 0xFFFFFFFF, 0x2A4, 0xFFFFFFFF, 0x3241318,
+    0x4920C0, 0x43000C0, 0x30C0010, 0x12C3, 0x32C8848, 0x42D80C0, 0x709488, 0x114480, 0x2612C3, 0x32C8291, 0x4480848, 0x16D0003,
+    0x20C0294, 0xFFFFFFFF, 0xFFFFFFFF, 0x38400C3, 0xC18D8, 0x2000124, 0x18C9203, 0x89264, 0x312840, 0x22450, 0x4488002, 0x1292283,
+    0x62840, 0x2481310, 0x44A889, 0x6D801A, 0xFFFFFFFF, 0x200A4A1, 0x300C24B, 0x92002, 0x6C3248, 0xFFFFFFFF, 0xFFFFFFFF, 0x3619640,
+    0xFFFFFFFF, 0x12432A1, 0x621203, 0x29A283, 0x1299490, 0x61708, 0x1840000, 0x2490848, 0x2852440, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x18500C3, 0xFFFFFFFF, 0x3492049, 0x29C2C0, 0x4241300, 0xFFFFFFFF, 0x80294, 0x3691, 0xFFFFFFFF, 0xC3243, 0x499649, 0x20C0064,
+    0x30C3400, 0x1901640, 0x323240, 0xFFFFFFFF, 0x20014D4, 0x3098848, 0x1240002, 0xFFFFFFFF, 0x18911, 0xFFFFFFFF, 0x4B248, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2908003, 0xFFFFFFFF, 0x3889018, 0x36D1240, 0xFFFFFFFF, 0x4640618, 0xFFFFFFFF, 0x3243000, 0x851810, 0xFFFFFFFF,
+    0x604483, 0x30492A1, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2580C3, 0x12414D3, 0x1910003, 0xFFFFFFFF, 0x708003, 0x400848, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x12582E0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x328901B, 0x3461, 0x19250, 0xC3010, 0x2001858, 0x1709249, 0x2480449,
+    0x3663000, 0xFFFFFFFF, 0xFFFFFFFF, 0x53900, 0x692600, 0x610294, 0x1302, 0xFFFFFFFF, 0x128B0C3, 0xFFFFFFFF, 0x24B510, 0x830C3,
+    0x618002, 0xFFFFFFFF, 0xFFFFFFFF, 0x4A0618, 0xFFFFFFFF, 0xFFFFFFFF, 0xB682, 0x24C901A, 0xFFFFFFFF, 0x84A880, 0xFFFFFFFF, 0x98320,
+    0x318000, 0x22492, 0x52210, 0x680891, 0x20D8109, 0x1251900, 0xFFFFFFFF, 0xC90D8, 0x325804C, 0xFFFFFFFF, 0x1851240, 0x621802,
+    0x112A1, 0xFFFFFFFF, 0x164010C, 0xFFFFFFFF, 0x28D2200, 0xFFFFFFFF, 0x2112203, 0x200004C, 0xFFFFFFFF, 0x36C02C8, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1B61A, 0x2260049, 0x424B218, 0x113289, 0x1689291, 0x99243, 0x648109, 0xFFFFFFFF, 0x300128B, 0x41A483, 0x249804B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2884240, 0x20C4240, 0x24C309, 0x3112, 0x461018, 0x128A310, 0xFFFFFFFF, 0xFFFFFFFF, 0x691291, 0x32A10C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2009292, 0x2018320, 0x424249, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x248602, 0x20490C3, 0x3488092, 0x29A649,
+    0x324304C, 0x4242248, 0xFFFFFFFF, 0x2586C0, 0xC908, 0xFFFFFFFF, 0xCC4C8, 0xFFFFFFFF, 0x24A64C, 0x1850490, 0x891680, 0x6D82C8,
+    0x3911000, 0x18C0600, 0x80661, 0x30D1840, 0x19850, 0x3403603, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C240, 0x19292, 0x12890C2,
+    0x3080260, 0xFFFFFFFF, 0xFFFFFFFF, 0x323, 0x1B890, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C009B, 0x618603, 0x291680, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4250649, 0x4C1900, 0xA6A2, 0x130A300, 0xFFFFFFFF, 0x1641843, 0x109063, 0x604850, 0x1241A, 0x2600092, 0x4A4D3,
+    0x719003, 0x2509448, 0xFFFFFFFF, 0xFFFFFFFF, 0x310A242, 0x3601888, 0x18D1000, 0xFFFFFFFF, 0x1249618, 0x118A1, 0x64C400, 0x1640709,
+    0xFFFFFFFF, 0x10C0C9, 0x619508, 0x128C3, 0x324A018, 0x200064C, 0x1840648, 0xFFFFFFFF, 0x4640308, 0xFFFFFFFF, 0x324B01A, 0x8D9000,
+    0x2492E2, 0x301921B, 0x16D0, 0xFFFFFFFF, 0x648709, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x9448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x41A4C9, 0x80308, 0xFFFFFFFF, 0xC0709, 0xFFFFFFFF, 0x848092, 0x329104B, 0x124064B, 0x44C848, 0xFFFFFFFF, 0x4B880, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x125A01B, 0xFFFFFFFF, 0x4240248, 0x684840, 0x3022449, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x24864C, 0xFFFFFFFF, 0x12691, 0xD2249, 0x36020C3, 0x12C12D2, 0x604508, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1658308, 0x30A20C0,
+    0x2053489, 0x124C440, 0x6484D9, 0x324A848, 0x5A240, 0x43012C0, 0x24900D8, 0xFFFFFFFF, 0x1C44B, 0xFFFFFFFF, 0x250024B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x130B480, 0x660308, 0xFFFFFFFF, 0x2483083, 0x1253649, 0xFFFFFFFF, 0xFFFFFFFF, 0x200C21B, 0x33092C0, 0x2512C9,
+    0x449490, 0x2109600, 0x50904C, 0x1508248, 0xFFFFFFFF, 0x6920C9, 0x125824A, 0x2600692, 0xFFFFFFFF, 0x4C0A2, 0x63482, 0xFFFFFFFF,
+    0x3489488, 0x38484C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1244498, 0x24A, 0x1301488, 0x42C1258, 0x52292, 0xFFFFFFFF, 0x609491,
+    0x144A0, 0xFFFFFFFF, 0x493080, 0x26CA003, 0x36C9200, 0x12E1200, 0xFFFFFFFF, 0xFFFFFFFF, 0x8D12C0, 0x2500018, 0x119603, 0x98860,
+    0x3400291, 0x2263248, 0x6600D8, 0x59490, 0x18400D0, 0x9C440, 0xFFFFFFFF, 0xC9600, 0xFFFFFFFF, 0x26D1202, 0xFFFFFFFF, 0x9491,
+    0x1B0E1, 0xFFFFFFFF, 0x848691, 0x3001310, 0x4310000, 0x44A289, 0x21880, 0x39000C0, 0x2D12C0, 0xFFFFFFFF, 0x6004C3, 0xFFFFFFFF,
+    0x212C2, 0x3600680, 0x4B8C9, 0x863080, 0x8A6D1, 0xFFFFFFFF, 0xFFFFFFFF, 0x36000C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x26001B, 0x3052218,
+    0xCA509, 0xFFFFFFFF, 0x20242C0, 0x114200, 0xFFFFFFFF, 0x624210, 0x649094, 0x33000C0, 0x401488, 0x12CC203, 0x1900010, 0x4480003,
+    0xFFFFFFFF, 0x2018848, 0x418291, 0x2481643, 0x19100C0, 0x46E0000, 0xFFFFFFFF, 0x40090B, 0x3004258, 0x301A049, 0x925C, 0x29125B,
+    0x23080C0, 0x84B018, 0x18434C0, 0x603400, 0x6C0403, 0xC30C0, 0xFFFFFFFF, 0x3002109, 0x254489, 0x124301B, 0xFFFFFFFF, 0x509649,
+    0x3081300, 0x3004700, 0x302124B, 0x12530C3, 0x125884A, 0x23690, 0x32514C8, 0x36C2600, 0x301061B, 0xFFFFFFFF, 0x130204C, 0x6D9250,
+    0xFFFFFFFF, 0x12C00C0, 0x24B01A, 0x93240, 0x124A2, 0xFFFFFFFF, 0x26C8003, 0xFFFFFFFF, 0x26084A, 0x30D2203, 0xFFFFFFFF, 0x310A2C0,
+    0x26CA600, 0x3003010, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4006D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x42A1010, 0x3400891, 0x654200,
+    0xFFFFFFFF, 0x12C98C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3019299, 0x449860, 0x304901A, 0xC1300, 0x1508618,
+    0x3001910, 0x860059, 0x1258618, 0x6D8003, 0x3418109, 0x65B400, 0x2292488, 0xFFFFFFFF, 0x1243848, 0x218C2, 0xCB682, 0x400003,
+    0x1701243, 0x30CA258, 0x610, 0x1384B, 0x3244243, 0x660000, 0x26DB000, 0x260618, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x24B848, 0x26005C, 0x31A480, 0x1844C, 0x128C418, 0x709243, 0x3018603, 0x124A489, 0x3400661, 0x4480603, 0x16E3000, 0x409803,
+    0x301804C, 0x30C0, 0x14DA202, 0x32482CB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x613061, 0x305C018, 0x4840098, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3488603, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C24B, 0x3889003, 0x20DA480, 0x6C3002, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x12D8603, 0x13618, 0x462488, 0x20A4400, 0x614C0, 0xFFFFFFFF, 0x12D804C, 0x125B449, 0x225A648, 0x3698049, 0x4240098, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x491689, 0x26C8602, 0xFFFFFFFF, 0x344C, 0x124E1, 0x64A483, 0xFFFFFFFF, 0x2E004C, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2113440, 0xFFFFFFFF, 0xFFFFFFFF, 0x3003049, 0x24A4D9, 0x614403, 0x186C2, 0x2261289, 0xFFFFFFFF, 0x692013, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xC08E0, 0xFFFFFFFF, 0x4C002, 0x109010, 0x600663, 0x8A1003, 0x21458, 0x13210C0, 0xFFFFFFFF, 0x2516D8, 0x121400,
+    0x311291, 0x3849448, 0xFFFFFFFF, 0x3004508, 0xFFFFFFFF, 0xFFFFFFFF, 0x9511, 0x24CB049, 0x4C4C3, 0x400603, 0x6036C2, 0xFFFFFFFF,
+    0x125809B, 0xFFFFFFFF, 0x3300248, 0x229A249, 0x248262, 0x65C, 0xFFFFFFFF, 0x64A250, 0x526A0, 0xFFFFFFFF, 0x258320, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2CB04C, 0x36C12C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x32C8649, 0xFFFFFFFF, 0x330A018, 0x248708, 0x818A1, 0xFFFFFFFF,
+    0x224C289, 0xFFFFFFFF, 0x360A4C0, 0x691848, 0xFFFFFFFF, 0xFFFFFFFF, 0x3404289, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3089218, 0x6104B, 0x3022403, 0x618260, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1092A1, 0xFFFFFFFF, 0x30C904C, 0x292300,
+    0x44A1200, 0xFFFFFFFF, 0x10B880, 0x12404DB, 0x3140C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x61509, 0x9284A, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xE32C0, 0x42D8248, 0x24B659, 0x124A858, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x80092, 0x1859218, 0x8C8, 0xFFFFFFFF,
+    0x128A689, 0x3003648, 0x264B480, 0x311, 0x34912C0, 0xC14A2, 0x2898248, 0xFFFFFFFF, 0x11A240, 0xFFFFFFFF, 0x6C9109, 0xC24C9,
+    0xFFFFFFFF, 0x861218, 0x846D0, 0x284824B, 0xFFFFFFFF, 0x24C9602, 0x200330B, 0xFFFFFFFF, 0x30C20C0, 0x3049659, 0xFFFFFFFF, 0x18A0248,
+    0x4242003, 0x2022443, 0x2542C2, 0x2062840, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x10B092, 0x4D2403, 0x125B258, 0xFFFFFFFF, 0x15080D8,
+    0x68030B, 0xFFFFFFFF, 0x204A900, 0xFFFFFFFF, 0xFFFFFFFF, 0x491498, 0x4249203, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6DA0C0, 0x1649491,
+    0x3000858, 0x112291, 0x263258, 0x1B64B, 0x32E0018, 0xFFFFFFFF, 0x3320400, 0xFFFFFFFF, 0xFFFFFFFF, 0x32CB248, 0x3251210, 0x201948B,
+    0x3002898, 0x4C00DB, 0x2121, 0x2248121, 0x20030DB, 0x849658, 0x30180C9, 0x600461, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x24842C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x680692, 0x3022442, 0xFFFFFFFF, 0x9323, 0x448A440, 0xFFFFFFFF, 0x63688,
+    0xFFFFFFFF, 0x1243698, 0x6C04C3, 0xFFFFFFFF, 0xE12C2, 0x4259640, 0x112618, 0x2052448, 0x13000C0, 0xD0692, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x125B4C0, 0x6CA840, 0xFFFFFFFF, 0x2C8291, 0xFFFFFFFF, 0x26148A, 0x9202, 0xFFFFFFFF, 0x2883018, 0x26CB240, 0x2E3248,
+    0x36480C0, 0x91B, 0x1A898, 0x32486C0, 0x1488010, 0xFFFFFFFF, 0xFFFFFFFF, 0x3204C0, 0xC9810, 0x1292448, 0x300050C, 0x14A0400,
+    0x30C4250, 0x4292600, 0xFFFFFFFF, 0x4240000, 0xFFFFFFFF, 0xFFFFFFFF, 0x618061, 0xFFFFFFFF, 0xFFFFFFFF, 0x4242603, 0x109092, 0x6032A1,
+    0x1259253, 0x1244B, 0xFFFFFFFF, 0xFFFFFFFF, 0x1491810, 0x1244488, 0x2052218, 0x6D8680, 0xCC2C2, 0xFFFFFFFF, 0xFFFFFFFF, 0x124130C,
+    0xA42C0, 0xFFFFFFFF, 0x3601309, 0x400692, 0xFFFFFFFF, 0x261258, 0x30B018, 0x36830C0, 0x3080618, 0x2500000, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x6D8, 0xC0291, 0x2004258, 0x3308059, 0x3019240, 0x185A049, 0x34012A1, 0x2609309, 0xD8680, 0x40A443, 0xFFFFFFFF, 0x6100C3,
+    0x18510, 0xFFFFFFFF, 0x1508003, 0x10941B, 0x12D2049, 0x6126C8, 0x1889248, 0xFFFFFFFF, 0x18C1300, 0x2509800, 0x698618, 0xA204C,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x4A2C3, 0xFFFFFFFF, 0x1850618, 0x30E1018, 0x648618, 0xCC092, 0x325B000, 0x2DA049, 0x30CC248, 0x34886C0,
+    0x1318059, 0x4C311, 0xFFFFFFFF, 0x264901B, 0x2491240, 0x2049, 0x31094C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x2480618, 0x3061, 0x1300112,
+    0xC005C, 0xFFFFFFFF, 0xFFFFFFFF, 0x8384B, 0xFFFFFFFF, 0x9810, 0x3249299, 0x53510, 0x2019858, 0x2490109, 0x249B000, 0x29124A,
+    0xFFFFFFFF, 0x34D9010, 0x40C803, 0xFFFFFFFF, 0xB849, 0x293848, 0x652880, 0x4A65B, 0x30036C9, 0x1243003, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4240600, 0x3461003, 0x121018, 0x304A258, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x10C248, 0x30CC018, 0x89101A, 0x6D9240,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1090D3, 0xFFFFFFFF, 0xFFFFFFFF, 0x3248602, 0xFFFFFFFF, 0x401240, 0xFFFFFFFF, 0x94248, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x70B000, 0x2649848, 0x1858602, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2500603, 0xFFFFFFFF, 0x14D10C2, 0x42A1002, 0xFFFFFFFF,
+    0x54309, 0x3019840, 0x60061A, 0xFFFFFFFF, 0xFFFFFFFF, 0x1292800, 0xFFFFFFFF, 0x20C1289, 0x824E1, 0xFFFFFFFF, 0xFFFFFFFF, 0x1508603,
+    0x3000318, 0x860049, 0xFFFFFFFF, 0x1258603, 0xFFFFFFFF, 0xFFFFFFFF, 0x6225A, 0x3509003, 0xFFFFFFFF, 0x3489840, 0x24CC010, 0xFFFFFFFF,
+    0x10A48A, 0xFFFFFFFF, 0x602, 0x6C4240, 0x29A259, 0xFFFFFFFF, 0x851458, 0x12D8260, 0x4B, 0x130128B, 0xFFFFFFFF, 0x16436C0,
+    0x62700, 0x2491840, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x360944A, 0x720600, 0x168A240, 0x3661, 0xFFFFFFFF, 0xFFFFFFFF, 0x300224B,
+    0x2DC0C0, 0xFFFFFFFF, 0x428C000, 0xC009B, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C025B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xDB049, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x30D8648, 0xFFFFFFFF, 0xC36C0, 0xFFFFFFFF, 0x84B049, 0x3294002, 0x6124D0, 0x1312249, 0x659618, 0xFFFFFFFF, 0x3003708,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x24CA242, 0xFFFFFFFF, 0xFFFFFFFF, 0x22916C0, 0x3461049, 0xA4448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1096D0,
+    0x9224B, 0x2063480, 0x64C002, 0xFFFFFFFF, 0x400260, 0x109119, 0xFFFFFFFF, 0x124C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x59618, 0x184025B,
+    0x189C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x418092, 0x4261210, 0xFFFFFFFF, 0x1C849, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x804DC,
+    0x30B098, 0x1C28B, 0xFFFFFFFF, 0x848258, 0x300921A, 0x60064B, 0xFFFFFFFF, 0x38400D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x30034D8, 0x601658,
+    0xFFFFFFFF, 0x50C003, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3509600, 0xFFFFFFFF, 0x2603649, 0x3602848, 0x308A458, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xA518, 0x18892C8, 0xFFFFFFFF, 0x6812D2, 0x4302003, 0x64C, 0x6C00E1, 0x448B080, 0xE24C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x1241718,
+    0x13012C3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x8912C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x18C024B, 0x1842061, 0x8188C, 0xFFFFFFFF,
+    0x1949B, 0x12892C8, 0xFFFFFFFF, 0x24C2C0, 0x60041B, 0x12612C9, 0xFFFFFFFF, 0x4843240, 0x26C92C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x449661,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x4A2400, 0x300C603, 0x61824B, 0xFFFFFFFF, 0x2912C8, 0xFFFFFFFF, 0x1488691, 0xFFFFFFFF, 0x2849488, 0x461490,
+    0xFFFFFFFF, 0x1641488, 0x344A258, 0x2522000, 0x1243080, 0x38480C9, 0xFFFFFFFF, 0x52458, 0xFFFFFFFF, 0x601321, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x4301250, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x18C0018, 0x3002618, 0xFFFFFFFF, 0x309658, 0x340301B,
+    0x651200, 0xFFFFFFFF, 0x2480461, 0x124C880, 0x18DB, 0x3418848, 0x32480C3, 0xFFFFFFFF, 0x251263, 0x1249709, 0x2248908, 0xFFFFFFFF,
+    0x324A6C0, 0x3009810, 0x20D9258, 0x61801B, 0x37080C0, 0xC0911, 0x3252440, 0x12C0018, 0x4888003, 0xFFFFFFFF, 0xB69A, 0x32D4200,
+    0x1641258, 0x20CC203, 0x6000CC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4300002, 0x92613, 0x125B243, 0xFFFFFFFF, 0x3258061,
+    0x42D8000, 0x1700291, 0x261200, 0x621810, 0x512200, 0xD244B, 0xFFFFFFFF, 0x1493249, 0xFFFFFFFF, 0x3840003, 0xFFFFFFFF, 0x2000061,
+    0x3003400, 0xFFFFFFFF, 0x2053688, 0x1301309, 0x130C200, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x26CB, 0x30522C9, 0x4841242, 0xFFFFFFFF,
+    0x3002883, 0x1142C0, 0x210C, 0x194DA, 0xFFFFFFFF, 0x49258, 0x7200C0, 0x60301A, 0x3121, 0xC0121, 0x8C8848, 0x3600613,
+    0x1489250, 0x1241640, 0x98121, 0xFFFFFFFF, 0xD8510, 0xFFFFFFFF, 0x14A1640, 0x60249A, 0x6C204C, 0x29C203, 0x129B402, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x20E1249, 0x318848, 0x26002DA, 0x42C3003, 0xFFFFFFFF, 0x3011243, 0x1240509, 0xFFFFFFFF, 0xFFFFFFFF, 0x1649249, 0x18D1248,
+    0x11204C, 0x263013, 0x320000, 0x2618109, 0x708061, 0x1659300, 0x24B683, 0x1250000, 0x32CB000, 0x2883000, 0xFFFFFFFF, 0x248509,
+    0x301844C, 0xFFFFFFFF, 0xC3063, 0x20002DA, 0x401303, 0xFFFFFFFF, 0xFFFFFFFF, 0x1918, 0xFFFFFFFF, 0x8C8618, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x618618, 0x9693, 0x1C8C0, 0xFFFFFFFF, 0x683000, 0x28C9018, 0x618059, 0x1259800, 0x3680603, 0xFFFFFFFF, 0x14884A0, 0x10A658,
+    0x204A488, 0x1303003, 0x3680049, 0xFFFFFFFF, 0xFFFFFFFF, 0x12DB003, 0x125A260, 0x125B840, 0xFFFFFFFF, 0x53843, 0xFFFFFFFF, 0x261800,
+    0x92659, 0x6C901B, 0x511243, 0x494640, 0x248890, 0x12DA480, 0x3848, 0xFFFFFFFF, 0x2000664, 0x3308600, 0xFFFFFFFF, 0x2492480,
+    0x3293, 0xC185A, 0x2004243, 0x8D9018, 0x11901B, 0x428A640, 0x42A1, 0x340128C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1249518,
+    0x9462, 0xFFFFFFFF, 0x20036C0, 0x62200, 0xFFFFFFFF, 0x8C803, 0xFFFFFFFF, 0xFFFFFFFF, 0x4858080, 0x84C242, 0x1240661, 0x8C249,
+    0x21298, 0x29A202, 0xFFFFFFFF, 0x40A8D0, 0x251518, 0xC4CB, 0x509291, 0x1318602, 0x3600092, 0x3311280, 0xFFFFFFFF, 0x6182CB,
+    0xFFFFFFFF, 0x2619289, 0xFFFFFFFF, 0x3010263, 0xFFFFFFFF, 0x3613, 0xFFFFFFFF, 0xFFFFFFFF, 0x1649849, 0x24C242, 0x263610, 0x493,
+    0xC0049, 0x128A253, 0xFFFFFFFF, 0xFFFFFFFF, 0x98049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x5A258, 0x41928C, 0x24CC, 0xFFFFFFFF,
+    0x2883049, 0x7090C2, 0x2501840, 0x24B109, 0xFFFFFFFF, 0x1889000, 0x6E10C0, 0xFFFFFFFF, 0x1840318, 0x2652249, 0x450B, 0x1A30B,
+    0xC984B, 0x2018709, 0x64010, 0x30C00E1, 0xA1849, 0x509061, 0x1508260, 0xFFFFFFFF, 0x41241B, 0xFFFFFFFF, 0x891003, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x36C2018, 0x123049, 0x45224C, 0x2150A, 0x36008C8, 0xFFFFFFFF, 0x3024280, 0x1240314, 0x3049109, 0x511840,
+    0x53889, 0xFFFFFFFF, 0x83603, 0x260262, 0xFFFFFFFF, 0xFFFFFFFF, 0x662240, 0x85A410, 0x4C1840, 0x920D8, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2003263, 0x248318, 0x119618, 0x32C8, 0x448024B, 0xFFFFFFFF, 0x3612402, 0x18400C0, 0x89200, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x201B092, 0xFFFFFFFF, 0x30C1498, 0xFFFFFFFF, 0xFFFFFFFF, 0x2308308, 0x62243, 0x908258, 0xFFFFFFFF, 0x6C064B, 0x448A018, 0xE1448,
+    0x2293480, 0x6004D8, 0x1244840, 0xFFFFFFFF, 0xFFFFFFFF, 0x522240, 0x64289, 0xFFFFFFFF, 0x12400E4, 0x13263, 0x3851600, 0x42402A1,
+    0x680709, 0xFFFFFFFF, 0x261B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C0308, 0xFFFFFFFF, 0xFFFFFFFF, 0xC0649, 0x2A4000, 0xFFFFFFFF,
+    0x1840461, 0xFFFFFFFF, 0x3094, 0x4480018, 0xFFFFFFFF, 0x409218, 0x149824B, 0xFFFFFFFF, 0x6C92D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x5A28C,
+    0x4C3092, 0x2049603, 0x1830A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24820C0, 0xFFFFFFFF, 0x6C0418, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x60188B, 0xFFFFFFFF, 0x304A842, 0x3862000, 0xFFFFFFFF, 0x201B308, 0x609600, 0xC2D8, 0xFFFFFFFF, 0xC92C9, 0x4C6C9, 0x148A0C3,
+    0x249001B, 0x12582A1, 0x1303648, 0xFFFFFFFF, 0x490080, 0xFFFFFFFF, 0x124B803, 0x3049708, 0x1303083, 0xFFFFFFFF, 0x26C8018, 0x112458,
+    0xFFFFFFFF, 0x134D9, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C8692, 0x1842848, 0x30C0013, 0x9600, 0x291600, 0xFFFFFFFF, 0x2C80D8, 0x692003,
+    0x30D8403, 0x180D8, 0xFFFFFFFF, 0xDA848, 0xFFFFFFFF, 0x3018293, 0x3308, 0x1A6D8, 0xC448A, 0x4992C2, 0x3000911, 0x694049,
+    0xC661, 0x22442, 0xCC210, 0x28980C0, 0xFFFFFFFF, 0x248C200, 0xFFFFFFFF, 0x6D8018, 0x3601250, 0x490418, 0xFFFFFFFF, 0x92003,
+    0x6C3243, 0x1319203, 0x4931B, 0x854600, 0xFFFFFFFF, 0x6030DA, 0x1300293, 0x21319, 0xFFFFFFFF, 0x642C8, 0x1840013, 0x12442C0,
+    0xFFFFFFFF, 0x64B24B, 0x3089309, 0xFFFFFFFF, 0x1858400, 0x61001B, 0x321203, 0xD8018, 0xFFFFFFFF, 0x5B413, 0xFFFFFFFF, 0x12E2600,
+    0x4480618, 0x3900003, 0x59860, 0x2D1200, 0x3018061, 0x30D3, 0xC00C2, 0x32482E0, 0x289B000, 0x860400, 0x4D9488, 0x980C0,
+    0x23800, 0x3600003, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C2880, 0x12500C3, 0xC210C, 0x496A2, 0x4251840, 0x2482109, 0x603461, 0x6C301A,
+    0x24C9248, 0x3421249, 0xFFFFFFFF, 0x604488, 0xFFFFFFFF, 0xFFFFFFFF, 0xCC489, 0xFFFFFFFF, 0x36C0059, 0x2580C0, 0x2490618, 0xFFFFFFFF,
+    0x465B000, 0x4B121, 0xFFFFFFFF, 0x30C94C8, 0x891080, 0x21090D8, 0xFFFFFFFF, 0x18C0003, 0xFFFFFFFF, 0x80061, 0x1259302, 0x1300509,
+    0x64A498, 0x26C8059, 0xFFFFFFFF, 0x30C0610, 0x2E3, 0xFFFFFFFF, 0x3249689, 0x424B448, 0xFFFFFFFF, 0xFFFFFFFF, 0xC200, 0xC2498,
+    0x8C8000, 0xFFFFFFFF, 0x69204B, 0x30B0C9, 0x3908, 0xFFFFFFFF, 0xFFFFFFFF, 0x425004C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2251690,
+    0x3080109, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x448804B, 0xFFFFFFFF, 0xFFFFFFFF, 0x4CB680, 0x891403, 0xFFFFFFFF, 0xC90DB,
+    0x400618, 0x1094C3, 0xFFFFFFFF, 0x14D1018, 0x24C94C0, 0x1319242, 0xFFFFFFFF, 0x3891010, 0x204A318, 0xFFFFFFFF, 0x1A600, 0x31090C9,
+    0xFFFFFFFF, 0x24A880, 0x1244302, 0x321800, 0x2609292, 0xFFFFFFFF, 0x2CB061, 0x859243, 0x185B000, 0x22486C3, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2D1800, 0x3289291, 0x428B049, 0xFFFFFFFF, 0xC328C, 0xFFFFFFFF, 0x3003890, 0x1240618, 0x3119, 0x46101B, 0xFFFFFFFF, 0x3600600,
+    0x30032D2, 0xFFFFFFFF, 0x12506C3, 0x2908600, 0xFFFFFFFF, 0xFFFFFFFF, 0x3449848, 0x124264C, 0xA8D2, 0xFFFFFFFF, 0xCA489, 0xFFFFFFFF,
+    0x1700049, 0xFFFFFFFF, 0x1265B, 0x64901A, 0x150A480, 0x424224B, 0xFFFFFFFF, 0x124240, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x60C24B, 0xFFFFFFFF, 0xFFFFFFFF, 0x4906C0, 0x18C0603, 0xFFFFFFFF, 0x2709000, 0x3661002, 0x32DA080, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x262480, 0x3840260, 0x652810, 0x3081843, 0x2E4240, 0x25184B, 0x98490, 0x1310600, 0xFFFFFFFF, 0x3613600, 0x61400,
+    0xFFFFFFFF, 0x1250490, 0x291683, 0x3251448, 0xFFFFFFFF, 0x28C9000, 0xFFFFFFFF, 0x2848260, 0x188C010, 0x2004900, 0xFFFFFFFF, 0x3009280,
+    0xFFFFFFFF, 0xB6C9, 0xFFFFFFFF, 0x261B600, 0x52810, 0x6016D2, 0xFFFFFFFF, 0x6C128B, 0x29B440, 0xFFFFFFFF, 0x84A308, 0xFFFFFFFF,
+    0x12412E2, 0x14461, 0x64C403, 0xFFFFFFFF, 0xFFFFFFFF, 0x4318400, 0xFFFFFFFF, 0xFFFFFFFF, 0x649289, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x364C000, 0xC0263, 0x2000092, 0xFFFFFFFF, 0x30124C2, 0x940C3, 0x99840, 0x1A092, 0x4709200, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x349A400, 0xD8098, 0xFFFFFFFF, 0x3291602, 0x603603, 0x6D2249, 0xC070B, 0x311B200, 0xFFFFFFFF, 0xFFFFFFFF, 0x204A243,
+    0x188A242, 0x21283, 0x200C44B, 0x4092D8, 0x60148B, 0x30CB200, 0xFFFFFFFF, 0xFFFFFFFF, 0x424024A, 0x361A000, 0x6024C9, 0x92418,
+    0x10092, 0x3860080, 0x4242848, 0x684289, 0xFFFFFFFF, 0x892242, 0x12693, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30D2400,
+    0xFFFFFFFF, 0x324824B, 0x8512D0, 0x3621210, 0xFFFFFFFF, 0x14A2, 0xFFFFFFFF, 0x4840018, 0x5A243, 0x83260, 0x2498418, 0x19892,
+    0xFFFFFFFF, 0x12896C2, 0x54508, 0xFFFFFFFF, 0x920, 0xFFFFFFFF, 0xC04D9, 0xFFFFFFFF, 0xFFFFFFFF, 0x3019491, 0x984D9, 0x293260,
+    0xD88C8, 0x5910C, 0x20C9200, 0x83709, 0x1909210, 0x2916C2, 0xFFFFFFFF, 0xE3203, 0xFFFFFFFF, 0x2049493, 0x1258248, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x361824A, 0x2021491, 0xFFFFFFFF, 0x12461, 0x384B080, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1718248, 0x622400, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x52294, 0xFFFFFFFF, 0x1241321, 0xFFFFFFFF, 0x2092061, 0x1643308, 0xFFFFFFFF, 0xFFFFFFFF, 0x30B003, 0x18083, 0xFFFFFFFF,
+    0x2000692, 0x720248, 0x41B649, 0xFFFFFFFF, 0x3840061, 0xFFFFFFFF, 0xFFFFFFFF, 0x18400C2, 0x2480291, 0x3651200, 0xFFFFFFFF, 0xC9603,
+    0xFFFFFFFF, 0x300448A, 0xFFFFFFFF, 0xFFFFFFFF, 0xC38C8, 0xD80D8, 0x84B258, 0x184A450, 0x2049260, 0x1258018, 0x24440, 0xFFFFFFFF,
+    0x8480C3, 0x18E2000, 0x258848, 0x125A618, 0x212C3, 0x4A2E2, 0x52600, 0xFFFFFFFF, 0x1A, 0x10692, 0x51001B, 0xFFFFFFFF,
+    0x1703248, 0xFFFFFFFF, 0x60A843, 0x18403, 0xFFFFFFFF, 0x16430D8, 0x1661203, 0x4C0018, 0xFFFFFFFF, 0x3493010, 0x128925B, 0x33000C3,
+    0x2480D8, 0x3018003, 0x125A500, 0x13042C0, 0xFFFFFFFF, 0x5A840, 0x1841498, 0x12498D0, 0xFFFFFFFF, 0x30526C0, 0xFFFFFFFF, 0x2500848,
+    0x301A04C, 0x1249312, 0xFFFFFFFF, 0xC3698, 0x23080C3, 0x3610061, 0x908002, 0x603418, 0xFFFFFFFF, 0x24203, 0x49092, 0x1489640,
+    0x600291, 0x124301A, 0x304924B, 0xFFFFFFFF, 0xE3800, 0x36C0003, 0x602891, 0x1258848, 0xC2C0, 0xFFFFFFFF, 0x424004C, 0xFFFFFFFF,
+    0x1242498, 0x6180C3, 0x304B291, 0xFFFFFFFF, 0xFFFFFFFF, 0x4258449, 0x124090A, 0x93243, 0xC0400, 0x131A440, 0x164C203, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x61A109, 0x29B4C0, 0x3112600, 0x300044C, 0x4C084B, 0xFFFFFFFF, 0xFFFFFFFF, 0x6498C8, 0x490510, 0x3260449, 0x36C9248,
+    0x1903400, 0x322440, 0xFFFFFFFF, 0x16D0002, 0xFFFFFFFF, 0x328A488, 0x1692203, 0x34002DA, 0xC4480, 0xFFFFFFFF, 0x849258, 0x600063,
+    0x4313, 0xC64C, 0xCC203, 0xFFFFFFFF, 0x1658000, 0xFFFFFFFF, 0xA4200, 0x294080, 0x65B402, 0x8486D0, 0xFFFFFFFF, 0x124384A,
+    0x125805C, 0x6DA600, 0xFFFFFFFF, 0x3602260, 0x6812A1, 0x12406C2, 0x61A, 0xFFFFFFFF, 0x42C0049, 0x52661, 0x112213, 0x26061A,
+    0xFFFFFFFF, 0x260924C, 0xFFFFFFFF, 0x1661800, 0x4C0618, 0x610000, 0x1911240, 0xFFFFFFFF, 0x709248, 0xFFFFFFFF, 0x2486D0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x324B449, 0xDA603, 0x2CA498, 0x812A4, 0x30D2480, 0x3404243, 0xC4253, 0xFFFFFFFF, 0xFFFFFFFF, 0x2630C0, 0x1523,
+    0xFFFFFFFF, 0x20024E1, 0x34D8049, 0x30016E0, 0xFFFFFFFF, 0xFFFFFFFF, 0x2912A1, 0xFFFFFFFF, 0x1643000, 0x300945B, 0x43090C0, 0x619243,
+    0x3403109, 0xFFFFFFFF, 0x63061, 0x69B003, 0x4C9292, 0x61B840, 0xFFFFFFFF, 0x3698600, 0xFFFFFFFF, 0x20C9292, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x424009B, 0xFFFFFFFF, 0xFFFFFFFF, 0x92262, 0x114D1, 0x30610C0, 0x3259289, 0x1493448, 0x1852480, 0x891, 0xFFFFFFFF,
+    0x3248659, 0xFFFFFFFF, 0x2E0049, 0x364A640, 0xFFFFFFFF, 0xFFFFFFFF, 0x2260260, 0xFFFFFFFF, 0x300304B, 0x609518, 0xFFFFFFFF, 0x1309291,
+    0x16D0600, 0x4032DA, 0xFFFFFFFF, 0x4DA242, 0xFFFFFFFF, 0xFFFFFFFF, 0x128C0D0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6D3440,
+    0xFFFFFFFF, 0x201B6C0, 0x2480318, 0x1240262, 0x462258, 0x1310490, 0x360025B, 0x61291, 0xFFFFFFFF, 0xFFFFFFFF, 0x10263, 0xC90C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x14D1002, 0xFFFFFFFF, 0x660600, 0x4302018, 0x204A303, 0x318490, 0x304C0C0, 0xD3440,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3249448, 0x300025B, 0xFFFFFFFF, 0x4D901A, 0xFFFFFFFF, 0x1B04C, 0xFFFFFFFF,
+    0x709289, 0x24B2C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x649119, 0xFFFFFFFF, 0xFFFFFFFF, 0x689508, 0xFFFFFFFF, 0x1A4D2, 0xFFFFFFFF, 0x3253200,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x311061, 0x130C0C0, 0x8C8260, 0x4C848, 0x10C400, 0x25A800, 0x92E4, 0x2928C0, 0xFFFFFFFF, 0x496D3,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1259448, 0x210A243, 0x649003, 0x325A400, 0xFFFFFFFF, 0x184B2C0, 0x2851218, 0xFFFFFFFF, 0x16424C9, 0x851280,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x890092, 0xFFFFFFFF, 0xFFFFFFFF, 0x18D2240, 0xFFFFFFFF, 0x30D024B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x36C20C0,
+    0x2484D9, 0xFFFFFFFF, 0x384024B, 0xFFFFFFFF, 0x26C8080, 0x424A450, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x8DA240, 0xFFFFFFFF,
+    0x260311, 0xFFFFFFFF, 0x46492C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2489210, 0xFFFFFFFF, 0x32C8308, 0x16D0083, 0xFFFFFFFF, 0x3002518,
+    0x604840, 0xFFFFFFFF, 0xFFFFFFFF, 0x65C000, 0x2022458, 0x119109, 0x124188B, 0xC6D1, 0xC96C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x430001A,
+    0x61B083, 0x1188C, 0xFFFFFFFF, 0x36012C3, 0x3009710, 0x913200, 0x30D0018, 0x112D2, 0x2A1600, 0xFFFFFFFF, 0x30A12C0, 0x249889,
+    0x325B, 0xFFFFFFFF, 0x2A1049, 0x308001B, 0x300085B, 0x260680, 0xE1, 0xFFFFFFFF, 0x26092C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x60A900,
+    0x1250248, 0xC2291, 0xD8083, 0xFFFFFFFF, 0x24B311, 0xFFFFFFFF, 0x1252849, 0xFFFFFFFF, 0x209B249, 0xFFFFFFFF, 0xFFFFFFFF, 0x12E20C0,
+    0x30D9242, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4CA458, 0x1241658, 0x98E1, 0xC9490, 0xFFFFFFFF, 0x84A0C0, 0x252500, 0xA1491,
+    0x6C2061, 0x3061258, 0x4C2D2, 0xFFFFFFFF, 0xFFFFFFFF, 0x1259488, 0x3490403, 0xFFFFFFFF, 0xFFFFFFFF, 0x36C3240, 0x12DB248, 0x893248,
+    0x3054218, 0xFFFFFFFF, 0xFFFFFFFF, 0x8512C0, 0x2480013, 0x10522, 0x1B41B, 0x4840000, 0x3001640, 0xFFFFFFFF, 0x2498400, 0x1263249,
+    0xC2061, 0x128C248, 0x201925B, 0x24B0DA, 0x3080D0, 0x34D9, 0xC3080, 0x4842049, 0x2501258, 0x2652218, 0xFFFFFFFF, 0x44C603,
+    0x29324B, 0xFFFFFFFF, 0x30030C9, 0x20D8291, 0xFFFFFFFF, 0x1310061, 0xC9261, 0x4240003, 0x2018121, 0xFFFFFFFF, 0xA1261, 0x6D9200,
+    0x44A0002, 0x200B680, 0x109094, 0xFFFFFFFF, 0x44B4C9, 0x1300449, 0xFFFFFFFF, 0xFFFFFFFF, 0x689200, 0x124448A, 0xFFFFFFFF, 0x22500,
+    0x36018C0, 0xFFFFFFFF, 0x680908, 0x1249649, 0x1258, 0x511258, 0x3601302, 0x4249802, 0x264924B, 0x26125A, 0x3708000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x26CB010, 0x170C200, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3301300, 0xFFFFFFFF, 0x30C3003, 0x1250848, 0x4481243, 0xFFFFFFFF,
+    0xDB240, 0x309B003, 0xFFFFFFFF, 0x2848618, 0xFFFFFFFF, 0x16D3010, 0x714200, 0x148B403, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2003121,
+    0x8480C0, 0xFFFFFFFF, 0x25884B, 0xA2049, 0x448B000, 0xFFFFFFFF, 0xFFFFFFFF, 0x698061, 0x6014D1, 0x125A049, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4241850, 0x24894C8, 0x61C480, 0xFFFFFFFF, 0x29C249, 0x16430C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x2491243, 0x3488109, 0x1289248, 0x2003003,
+    0x720000, 0x24C258, 0x262049, 0xC0061, 0x128B848, 0x26C9240, 0x3000661, 0x248004B, 0x4D9403, 0xC2661, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1499243, 0xFFFFFFFF, 0x249B002, 0x291248, 0xFFFFFFFF, 0x34D9000, 0x301B059, 0xFFFFFFFF, 0x1252658, 0xC30C3, 0x341A480, 0x63003,
+    0x85B0C0, 0x30C06C0, 0xFFFFFFFF, 0x1B900, 0x65901B, 0x2294248, 0x1498109, 0xFFFFFFFF, 0xC2A2, 0xC92A2, 0x1640891, 0x148A092,
+    0x25A658, 0x891018, 0x18894C0, 0x26006C0, 0x49521, 0x3010049, 0x248449, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x401243, 0x3012648,
+    0xFFFFFFFF, 0x185A, 0xFFFFFFFF, 0xFFFFFFFF, 0x522C0, 0x3453440, 0x2490490, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x548C0, 0xFFFFFFFF,
+    0x185804B, 0xFFFFFFFF, 0xC0891, 0x6606C0, 0x20C1840, 0x254802, 0x9B44A, 0x721, 0x293618, 0xFFFFFFFF, 0x409463, 0x254249,
+    0x26610C0, 0x4300, 0xFFFFFFFF, 0x1292259, 0x309B049, 0x12D2648, 0x4D90C0, 0x1889840, 0xFFFFFFFF, 0xFFFFFFFF, 0x10C01A, 0x602092,
+    0xA4DB, 0x304B049, 0x3692080, 0x4A8D1, 0xFFFFFFFF, 0x1718600, 0x6C4242, 0x212E1, 0xFFFFFFFF, 0x5264C, 0xFFFFFFFF, 0x260602,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x609292, 0x3052249, 0x649680, 0xFFFFFFFF, 0x42412D8, 0x12C0320, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2263600, 0x2003049, 0xFFFFFFFF, 0x328A240, 0x9B21A, 0x2721000, 0x64B6C0, 0xFFFFFFFF, 0x3309448, 0x1499840, 0x61304C,
+    0x29184A, 0xFFFFFFFF, 0x3610649, 0x3004289, 0x2049600, 0xFFFFFFFF, 0x18320, 0xFFFFFFFF, 0x84B04B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3848648, 0x521003, 0x4A1840, 0x6304C, 0xFFFFFFFF, 0x61A24B, 0x24CA240, 0xFFFFFFFF, 0xFFFFFFFF, 0x1703600, 0x122640, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3601498, 0x148A0D8, 0x421508, 0xFFFFFFFF, 0xFFFFFFFF, 0x64944C, 0xFFFFFFFF, 0x401843, 0xFFFFFFFF, 0xFFFFFFFF, 0x1303098,
+    0x29A4C8, 0xFFFFFFFF, 0x1840258, 0x12C9448, 0xFFFFFFFF, 0x1A24B, 0xD4680, 0x2018649, 0xFFFFFFFF, 0x24A4CB, 0x9618, 0x291613,
+    0xFFFFFFFF, 0x40070C, 0x692018, 0xFFFFFFFF, 0xFFFFFFFF, 0x6D2410, 0x3252403, 0x84825B, 0x3019888, 0x60064C, 0x3320, 0x2144A,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3049049, 0x293092, 0x360024A, 0xFFFFFFFF, 0x860080, 0xFFFFFFFF, 0x304B649, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2024448, 0x6020DB, 0x9201B, 0xFFFFFFFF, 0xFFFFFFFF, 0x4A910, 0x1493203, 0xFFFFFFFF, 0x2492402, 0x461109, 0x510649,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x260649, 0x1910248, 0x1A018, 0x3689203, 0x4908C8, 0x300024A, 0x1858418, 0xFFFFFFFF, 0xFFFFFFFF, 0x3418018,
+    0x490308, 0xFFFFFFFF, 0x262688, 0x6CB480, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x248123, 0x600418, 0x30D9200, 0x21218, 0x308148B,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xC448, 0x294449, 0x2009264, 0x4A2402, 0x20D9488, 0x12500DB, 0x464600, 0x3860010, 0x3602618,
+    0x12C0248, 0xFFFFFFFF, 0xFFFFFFFF, 0x2600294, 0xFFFFFFFF, 0xFFFFFFFF, 0x4258018, 0x30C3300, 0x2064049, 0x3063248, 0xFFFFFFFF, 0x129A840,
+    0xFFFFFFFF, 0x2580DB, 0x304A2D8, 0xFFFFFFFF, 0x64C602, 0x42400C0, 0xFFFFFFFF, 0x124A843, 0xFFFFFFFF, 0x1824B, 0xFFFFFFFF, 0x3260013,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1A848, 0x1321200, 0x1289098, 0x424A442, 0x6892C3, 0x449B, 0xFFFFFFFF, 0x2251203, 0xD8858, 0x859488,
+    0x2518018, 0x124C2C9, 0x1310018, 0x3418291, 0x3083848, 0x84B418, 0x80522, 0x618018, 0xC34D1, 0xFFFFFFFF, 0x4C04B, 0x1488461,
+    0x4C1318, 0x1259203, 0x462840, 0xCB24C, 0xFFFFFFFF, 0x863240, 0x2542C9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x8600C9,
+    0x259488, 0xFFFFFFFF, 0xFFFFFFFF, 0x42D8003, 0x3890003, 0x1851258, 0x9205C, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C00C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3248, 0x3491640, 0xFFFFFFFF, 0x499200, 0xFFFFFFFF, 0x3012498, 0x263240, 0x1262440, 0x2308848, 0x661098, 0xFFFFFFFF, 0x24A2DA,
+    0x205B403, 0x224B291, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x8448B, 0xFFFFFFFF, 0xC06E1, 0x164001B, 0x848061, 0x20C4258, 0x19000C0,
+    0x309310, 0x1310848, 0x3240000, 0xFFFFFFFF, 0x69801B, 0x1240064, 0x98DA, 0xFFFFFFFF, 0x3089249, 0xFFFFFFFF, 0x14A4200, 0xFFFFFFFF,
+    0x125B010, 0x291308, 0x4241242, 0x6800C3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6DA440, 0x4242260, 0x1488119, 0x112600, 0x12430C9,
+    0x1368B, 0x3249800, 0x2C8848, 0xFFFFFFFF, 0x263010, 0x2053458, 0x1884A, 0x2A3402, 0x18C0618, 0xFFFFFFFF, 0x922C8, 0x2498,
+    0x32CB003, 0x1289698, 0x709083, 0x6898C0, 0x8425B, 0xFFFFFFFF, 0xFFFFFFFF, 0x65124C, 0xFFFFFFFF, 0x2484640, 0x610891, 0xFFFFFFFF,
+    0x2251249, 0xFFFFFFFF, 0x70B0C0, 0x258003, 0x61861A, 0xFFFFFFFF, 0xC9248, 0xD98C0, 0x40B680, 0x60384A, 0x61805C, 0x210901B,
+    0x24649, 0xD9302, 0x4254240, 0x6006CC, 0x16922C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x492600, 0x4300600, 0x12DB000, 0x2052200, 0x1892202,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x18D1018, 0x1719240, 0x1243, 0xFFFFFFFF, 0x128B003, 0xFFFFFFFF, 0x248893, 0x9209B, 0x3840603, 0xFFFFFFFF,
+    0x324B600, 0x3308602, 0x264A258, 0xFFFFFFFF, 0x6C0, 0x64A2C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x2481850, 0x2606C2, 0xFFFFFFFF, 0x130C248,
+    0xFFFFFFFF, 0x30002C8, 0xFFFFFFFF, 0x26010B, 0xFFFFFFFF, 0xFFFFFFFF, 0x49858, 0x20194A0, 0x603610, 0xA489, 0x292488, 0xC32E0,
+    0x2003109, 0x4A3000, 0x3292640, 0xFFFFFFFF, 0x304C010, 0x18A0049, 0xFFFFFFFF, 0xFFFFFFFF, 0x122800, 0x9908, 0x1318600, 0x3600098,
+    0x4241842, 0xFFFFFFFF, 0xFFFFFFFF, 0x14D1400, 0x2248600, 0xFFFFFFFF, 0x853448, 0x3010260, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x344A300, 0x301128C, 0xFFFFFFFF, 0xFFFFFFFF, 0x3248262, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x60C298, 0x1310C, 0x324928B, 0x70C240,
+    0xFFFFFFFF, 0x24B6C9, 0x92311, 0x182CB, 0x12896D0, 0x2019289, 0x20C3049, 0x30C2248, 0xFFFFFFFF, 0x1A8C9, 0x34C0092, 0xFFFFFFFF,
+    0x30020DB, 0x258603, 0xFFFFFFFF, 0xFFFFFFFF, 0x2A2300, 0xFFFFFFFF, 0x90A018, 0x60128C, 0x304A240, 0xFFFFFFFF, 0xFFFFFFFF, 0x412418,
+    0xFFFFFFFF, 0x2489283, 0x44A4D1, 0x24688, 0x49509, 0x3618258, 0x6032C8, 0x1243490, 0xFFFFFFFF, 0x1289002, 0xFFFFFFFF, 0x10B6C0,
+    0xFFFFFFFF, 0x622418, 0xFFFFFFFF, 0x2609448, 0xFFFFFFFF, 0xFFFFFFFF, 0x261840, 0x30B600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2488D9,
+    0x83049, 0x612803, 0xFFFFFFFF, 0xFFFFFFFF, 0x3300308, 0x4C128C, 0xFFFFFFFF, 0xFFFFFFFF, 0x293603, 0x1292802, 0x499283, 0x20D8649,
+    0x824CC, 0xFFFFFFFF, 0x1A0DB, 0xFFFFFFFF, 0x300030B, 0x4C0709, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4849600, 0x62240, 0x693480,
+    0x8C849, 0x3488248, 0x29A802, 0x492DC, 0xFFFFFFFF, 0x6004D9, 0x1243262, 0x212DA, 0x3109049, 0xFFFFFFFF, 0x3012400, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x14840, 0xFFFFFFFF, 0xFFFFFFFF, 0x2649603, 0xFFFFFFFF, 0x12584C3, 0x30612C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x2649049, 0x3648248,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x128A850, 0x26C824A, 0xFFFFFFFF, 0x32A1600, 0x320648, 0xFFFFFFFF, 0xDA01B, 0x5A858, 0x2480080, 0x4DC000,
+    0x1B488, 0x32492C0, 0xFFFFFFFF, 0x20C3649, 0x3013308, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x20034D9, 0xFFFFFFFF, 0x18592C0, 0x619218,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3602000, 0x300A453, 0x6916C0, 0xFFFFFFFF, 0x22688, 0xCC44A, 0x165824B, 0x30A2000, 0xFFFFFFFF, 0xC2DA,
+    0xFFFFFFFF, 0x3601488, 0x490648, 0xFFFFFFFF, 0x1249210, 0x6180DA, 0x225B640, 0x1289600, 0x3609200, 0xFFFFFFFF, 0x93250, 0x1261600,
+    0xC041B, 0xFFFFFFFF, 0x26C801A, 0x1491880, 0xFFFFFFFF, 0xFFFFFFFF, 0x2260248, 0xFFFFFFFF, 0x3000461, 0x30C001B, 0x61024B, 0x9603,
+    0xD824B, 0xFFFFFFFF, 0x309801B, 0x3320010, 0x612849, 0x180DA, 0x16D001A, 0x711203, 0x3009200, 0xFFFFFFFF, 0xFFFFFFFF, 0x3848400,
+    0x128A508, 0xFFFFFFFF, 0x2294600, 0x20DB248, 0xFFFFFFFF, 0xC1303, 0xCC218, 0x1658018, 0xFFFFFFFF, 0x921200, 0xFFFFFFFF, 0x1311488,
+    0x490400, 0xFFFFFFFF, 0x4212C3, 0x1251318, 0x1259643, 0x1319200, 0xFFFFFFFF, 0x40001B, 0x6030C0, 0xFFFFFFFF, 0x30494D8, 0x32400C0,
+    0x129C049, 0x3452218, 0x184001B, 0x94049, 0x319488, 0x64B248, 0x42418C0, 0x683308, 0xFFFFFFFF, 0x125B0D0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x5B410, 0x3001250, 0xFFFFFFFF, 0xFFFFFFFF, 0x32C8061, 0x42C30C0, 0x4858002, 0x1498848, 0x254600, 0x30D8, 0x21203, 0x32498C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3652600, 0xFFFFFFFF, 0x2252440, 0x3600002, 0xFFFFFFFF, 0xFFFFFFFF, 0x9A6C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x3602603,
+    0x34D9080, 0xFFFFFFFF, 0x619258, 0x4640603, 0xFFFFFFFF, 0xFFFFFFFF, 0x14880C3, 0x6018C0, 0x125A440, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x64098, 0x12D8061, 0xFFFFFFFF, 0x3052600, 0x64B018, 0x4C708, 0x4301242, 0xFFFFFFFF, 0x618119, 0xFFFFFFFF, 0x2308003, 0x4900C3,
+    0x24B063, 0x30D1243, 0x3464, 0x3403003, 0x1289080, 0x59649, 0x251810, 0x61084B, 0x4488, 0xFFFFFFFF, 0xDB403, 0x2C86D8,
+    0xFFFFFFFF, 0x24930C0, 0xC202, 0xFFFFFFFF, 0xFFFFFFFF, 0x84B403, 0x20D9240, 0x261309, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x148844C,
+    0x4C1303, 0x2849243, 0x3840109, 0x24C9000, 0x1292880, 0xFFFFFFFF, 0x604258, 0x61A049, 0xFFFFFFFF, 0xCC259, 0x1643848, 0x18494C8,
+    0x92602, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C4D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C06D0, 0x24CC080, 0x660618, 0x681303, 0x12C9800,
+    0xFFFFFFFF, 0x6C0112, 0xFFFFFFFF, 0xD3458, 0x8514C8, 0x3012483, 0xFFFFFFFF, 0xFFFFFFFF, 0x3418603, 0xD8613, 0x201B000, 0x1850109,
+    0xFFFFFFFF, 0x3059018, 0xC3848, 0xFFFFFFFF, 0x18DA200, 0x248720, 0x1251243, 0xC06CC, 0xFFFFFFFF, 0x84805C, 0x8586C0, 0x301C240,
+    0x1253848, 0xC010B, 0xFFFFFFFF, 0x3600603, 0x863002, 0x30C02C8, 0x9810C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x10C418, 0x204C24B,
+    0x4E1249, 0xFFFFFFFF, 0xFFFFFFFF, 0x3300600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x18890C9, 0x42D2080, 0xFFFFFFFF, 0xFFFFFFFF, 0x3002,
+    0x125A482, 0x3681289, 0x661403, 0xFFFFFFFF, 0xFFFFFFFF, 0x2053440, 0xFFFFFFFF, 0xFFFFFFFF, 0x12A1010, 0xFFFFFFFF, 0x24A092, 0x8910C9,
+    0x224B049, 0x1289683, 0xFFFFFFFF, 0xFFFFFFFF, 0x262482, 0xFFFFFFFF, 0xC305C, 0xFFFFFFFF, 0x4901B, 0xFFFFFFFF, 0x918049, 0x1909,
+    0xFFFFFFFF, 0x308128C, 0x360B2C0, 0x11A258, 0xFFFFFFFF, 0x44C01B, 0x294240, 0xD82C8, 0x3311000, 0x692080, 0x2849840, 0xFFFFFFFF,
+    0x3061000, 0x3080709, 0x148B049, 0x4888018, 0xFFFFFFFF, 0x318603, 0xFFFFFFFF, 0x52813, 0xFFFFFFFF, 0x258493, 0xFFFFFFFF, 0x224D8,
+    0x29B442, 0xFFFFFFFF, 0x300B2C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x18600, 0xFFFFFFFF, 0x36012D8, 0x62309, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x424921A, 0x30114A0, 0x2052690, 0xFFFFFFFF, 0xFFFFFFFF, 0x1321003, 0xFFFFFFFF, 0x859840, 0xFFFFFFFF, 0x16D3, 0x2260092,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x83493, 0x1250260, 0xFFFFFFFF, 0x29144C, 0xD809B, 0x30012D4, 0x603600, 0x308318, 0xFFFFFFFF, 0x2184B,
+    0xFFFFFFFF, 0x409892, 0x30C08C8, 0x4718, 0x188A240, 0xDA0D8, 0x2009892, 0x4092DB, 0x259840, 0xFFFFFFFF, 0xFFFFFFFF, 0x32516C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x122249, 0xFFFFFFFF, 0xFFFFFFFF, 0x3243649, 0xFFFFFFFF, 0x413658, 0x204910C, 0x3600, 0x260030B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x248092, 0x914000, 0x46400D8, 0xFFFFFFFF, 0x128A240, 0xFFFFFFFF, 0x24A692, 0x1249891, 0xFFFFFFFF, 0xFFFFFFFF, 0x128C840,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x12492D3, 0xFFFFFFFF, 0x2612403, 0x49613, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x292240, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1840308, 0x184B200, 0x44C618, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x692680, 0x2512D0, 0xC280, 0x1B318, 0xFFFFFFFF, 0x4240018,
+    0xFFFFFFFF, 0x602291, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C0248, 0x4242618, 0x36C2003, 0x25B650, 0x12463, 0x1891203, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x6042C0, 0xFFFFFFFF, 0x125A291, 0x324801B, 0x325B248, 0x16580D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x10308, 0x649889, 0x493083, 0xFFFFFFFF,
+    0x2488C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x1289492, 0x542D8, 0xFFFFFFFF, 0x12CC448, 0xFFFFFFFF, 0xFFFFFFFF, 0x32484C0, 0xFFFFFFFF, 0x2480293,
+    0x11904C, 0x311210, 0x1A0C3, 0xFFFFFFFF, 0x40A458, 0x692449, 0x185B080, 0x9493, 0x291492, 0x3251259, 0x3610291, 0xFFFFFFFF,
+    0x30C9200, 0x304B01B, 0xFFFFFFFF, 0xFFFFFFFF, 0x30A1200, 0x3019700, 0xFFFFFFFF, 0x304C049, 0xFFFFFFFF, 0x65A840, 0x300B690, 0xFFFFFFFF,
+    0x12400DA, 0xFFFFFFFF, 0x2609200, 0x36000C2, 0x30A3240, 0x260013, 0x125B080, 0x23309, 0xFFFFFFFF, 0x3092610, 0x248694, 0x8024B,
+    0x308248, 0x32C8000, 0x64909B, 0x4912C0, 0x3018000, 0x26204C, 0x1261259, 0x130C600, 0x368C200, 0x70B248, 0x418294, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x330A440, 0xFFFFFFFF, 0x35100C0, 0xA843, 0x291260, 0xFFFFFFFF, 0x30026C0, 0x4C9818, 0x619203,
+    0x314600, 0xC30C9, 0xE1200, 0x59709, 0x2518C0, 0xFFFFFFFF, 0x4640000, 0x1313248, 0x4240618, 0x851200, 0x25180C0, 0x61B243,
+    0x4489249, 0x12934C0, 0x1508291, 0x853800, 0x69A448, 0x6180C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x308B680, 0x1488510, 0x308013, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x401258, 0xFFFFFFFF, 0xFFFFFFFF, 0x320400, 0x510291, 0x324805C, 0x40384B, 0x12CA440, 0x12496A0, 0x18683,
+    0x64C488, 0x4930C0, 0x2C80C3, 0x30C2600, 0x9210B, 0x1C261, 0x128C098, 0xD9250, 0x3002490, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2600000, 0xFFFFFFFF, 0x2D2443, 0x2516A0, 0x6106D8, 0xC1309, 0x8CB000, 0x201B0C3, 0x864200, 0x30C9802, 0x61B013, 0x2603603,
+    0x3601240, 0xFFFFFFFF, 0x3009690, 0x3509018, 0x304B061, 0xCB680, 0x4930A, 0x344A488, 0xFFFFFFFF, 0x1243289, 0x30494C3, 0x2609800,
+    0x4B908, 0xFFFFFFFF, 0xFFFFFFFF, 0x1240112, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C061B, 0x30D3000, 0xFFFFFFFF, 0x649698,
+    0xFFFFFFFF, 0x5B403, 0xFFFFFFFF, 0xFFFFFFFF, 0x32C804C, 0x6490D3, 0x18C1243, 0x18404A0, 0x328A258, 0xFFFFFFFF, 0x1A490, 0xFFFFFFFF,
+    0x2018891, 0x4182DA, 0x2484242, 0x9861, 0x3842480, 0x3418490, 0x84A049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1643003,
+    0x2292258, 0xFFFFFFFF, 0xFFFFFFFF, 0x3488049, 0x21690, 0x18A3000, 0x36C0600, 0x251908, 0x284A480, 0x3049291, 0xFFFFFFFF, 0x3600490,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x6186C9, 0x13061, 0x64B003, 0x261C240, 0xFFFFFFFF, 0x2490049, 0x3648600, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C8600,
+    0x10A700, 0xFFFFFFFF, 0xFFFFFFFF, 0xC3000, 0x3241900, 0xFFFFFFFF, 0x12C9460, 0xFFFFFFFF, 0x9B003, 0x323000, 0x3248098, 0xFFFFFFFF,
+    0x30136C0, 0x92708, 0xFFFFFFFF, 0x1B289, 0xFFFFFFFF, 0x49B448, 0xFFFFFFFF, 0x9A483, 0x2249900, 0xFFFFFFFF, 0x20032DA, 0x2D1460,
+    0x30182C8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1658603, 0x41B109, 0xFFFFFFFF, 0xC692, 0x50C018, 0xFFFFFFFF, 0x300C848,
+    0xFFFFFFFF, 0x618492, 0x6D8049, 0x3683600, 0x3121002, 0xFFFFFFFF, 0x30C9283, 0x304C680, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4258258,
+    0x603109, 0x304C0C2, 0xFFFFFFFF, 0xD3443, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xA2, 0xFFFFFFFF, 0xD8600, 0x4240308, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1309061, 0xFFFFFFFF, 0xFFFFFFFF, 0x468C000, 0x3018649, 0x36C2, 0xFFFFFFFF, 0x64910B, 0x2309289, 0x20C0092, 0x20DB600,
+    0xFFFFFFFF, 0x225144B, 0x128A300, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x98A2, 0x1310260, 0xFFFFFFFF, 0x1643603, 0x148A248, 0x2489448,
+    0x619842, 0x1888092, 0xFFFFFFFF, 0x496D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x210A240, 0x292309, 0x310C000, 0xFFFFFFFF, 0x300A4C3, 0x12D8649,
+    0x13661, 0xFFFFFFFF, 0x49224B, 0x4240698, 0x149144A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x42400D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x922A1,
+    0x18260, 0xFFFFFFFF, 0x709059, 0xFFFFFFFF, 0x2484C3, 0x9B600, 0x2249488, 0x652802, 0xFFFFFFFF, 0x1124C8, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x32480D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x2481498, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x248921A, 0xFFFFFFFF,
+    0xCA243, 0xD92D8, 0xFFFFFFFF, 0x2532C0, 0x604842, 0x125921B, 0x214A1, 0x65C003, 0xFFFFFFFF, 0x4CA688, 0x124000, 0x2061260,
+    0xFFFFFFFF, 0x3089491, 0x1491213, 0x185024B, 0x30CC440, 0x6C2291, 0x32D20C0, 0x4241488, 0xFFFFFFFF, 0x25A4C9, 0x30D001B, 0x14D104B,
+    0x64A850, 0xFFFFFFFF, 0x301148B, 0xFFFFFFFF, 0xFFFFFFFF, 0x340024B, 0xFFFFFFFF, 0x424B800, 0x2492D4, 0xFFFFFFFF, 0x22DA0C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2CB092, 0xFFFFFFFF, 0x4D904B, 0xFFFFFFFF, 0xC2294, 0xFFFFFFFF, 0xFFFFFFFF, 0x301B24A, 0x844A0, 0xFFFFFFFF, 0x651491,
+    0x2613640, 0x148824B, 0x603018, 0x8C200, 0x3711200, 0x4488403, 0xE2400, 0xFFFFFFFF, 0x1849880, 0x124165B, 0xC4A1, 0xC9493,
+    0xFFFFFFFF, 0x610A2, 0x25A849, 0xFFFFFFFF, 0xFFFFFFFF, 0x131801A, 0x49712, 0x1092C8, 0x30C9092, 0x6C04C0, 0x2248018, 0x42C3018,
+    0xFFFFFFFF, 0x851880, 0x205244B, 0x13000D3, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C9200, 0xFFFFFFFF, 0xFFFFFFFF, 0x148A, 0x1B418, 0x3249258,
+    0xFFFFFFFF, 0x80692, 0x1250018, 0x182A1, 0xFFFFFFFF, 0x26C8680, 0x4018D2, 0x301B003, 0x3080D3, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C80C9,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x30A6C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2291649, 0x258018, 0x1909200, 0xC2500, 0xC9263, 0x4C660,
+    0x40B698, 0x30C26C0, 0xA6D3, 0x24C9648, 0x16D00C9, 0x490000, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C0291, 0xCC880, 0xFFFFFFFF, 0x3619249,
+    0xFFFFFFFF, 0x600121, 0x28600C0, 0xCC2D0, 0x3248002, 0x16580C3, 0x1850291, 0x261818, 0x118D2, 0x2092049, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x308461, 0x14D1080, 0xFFFFFFFF, 0x4689018, 0xFFFFFFFF, 0x4C125B, 0xFFFFFFFF, 0xC0294, 0xD0908, 0xFFFFFFFF, 0x858291,
+    0x20D8600, 0x1901250, 0x1B691, 0x129221A, 0x5A4A0, 0x18426C0, 0x20D8061, 0x30B4C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x3001300, 0x30186C9,
+    0x30C2480, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C0000, 0x202124C, 0xFFFFFFFF, 0xFFFFFFFF, 0x125A603, 0xFFFFFFFF, 0xE2442, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xC4E0, 0xFFFFFFFF, 0x325B003, 0x6806D8, 0xFFFFFFFF, 0x260010, 0x3052203, 0x1311300, 0x4241299, 0xFFFFFFFF, 0x3014418,
+    0x46406C0, 0x13006D0, 0x128924A, 0xFFFFFFFF, 0x184301A, 0x2480610, 0x94482, 0xC1640, 0x2609690, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x98064, 0xFFFFFFFF, 0x341B000, 0x300168C, 0x328C248, 0xFFFFFFFF, 0x924C, 0x198C3, 0xFFFFFFFF, 0x20C3061, 0x3014300, 0x204901B,
+    0x19303, 0xC050C, 0x16D1240, 0xFFFFFFFF, 0x36D2200, 0xFFFFFFFF, 0x384804B, 0xFFFFFFFF, 0xFFFFFFFF, 0x3003112, 0x6012A3, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1703003, 0x30C9458, 0x61C250, 0x188C080, 0xFFFFFFFF, 0x490059, 0xFFFFFFFF, 0xFFFFFFFF, 0x4640490,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x52880, 0x301264A, 0x12444C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x128B618, 0x5901B, 0x1491298, 0xFFFFFFFF, 0x894080,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2500600, 0x83061, 0xFFFFFFFF, 0x3891, 0x29101A, 0xD9240, 0xFFFFFFFF, 0x249910, 0x91B000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x660109, 0x30932C0, 0x25424B, 0x4302, 0xFFFFFFFF, 0x3249508, 0xFFFFFFFF, 0xFFFFFFFF, 0x2049848, 0xFFFFFFFF, 0x2344B,
+    0x4711000, 0x1640661, 0x109461, 0xFFFFFFFF, 0x125804B, 0x1281B, 0x8CA480, 0x4A8D8, 0x300A698, 0xFFFFFFFF, 0x61A480, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3012418, 0x94018, 0x894400, 0xFFFFFFFF, 0xD1843, 0x148A308, 0xFFFFFFFF, 0x609294, 0x623218, 0x649683,
+    0x4902CB, 0x54690, 0x81840, 0xFFFFFFFF, 0xFFFFFFFF, 0x2A4018, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x98661, 0x6D0603, 0xC4240,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x25145B, 0xFFFFFFFF, 0x305C003, 0xD8492, 0x30940C0, 0xFFFFFFFF, 0x204961B, 0xFFFFFFFF, 0x2321B, 0xFFFFFFFF,
+    0x2292243, 0x301B098, 0x3291449, 0xFFFFFFFF, 0xFFFFFFFF, 0x4A6A1, 0x4096D9, 0x14A2003, 0x1243049, 0x13600, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4A1289, 0x18496C0, 0xFFFFFFFF, 0x44C0C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3010649, 0xFFFFFFFF, 0xFFFFFFFF, 0x1289618, 0x3609218,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x124D3, 0x6E1000, 0x70B600, 0xFFFFFFFF, 0x12C944B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x691000, 0xFFFFFFFF, 0x961B, 0xFFFFFFFF, 0xD9842, 0x3001498, 0xFFFFFFFF, 0xFFFFFFFF, 0x38E0, 0x291059, 0xFFFFFFFF, 0x2D1448,
+    0x24C508, 0xFFFFFFFF, 0x4900, 0x3848418, 0xFFFFFFFF, 0xFFFFFFFF, 0x248B200, 0x1240258, 0xFFFFFFFF, 0xFFFFFFFF, 0x34C9218, 0xFFFFFFFF,
+    0x69A800, 0x4E1448, 0x9508, 0xFFFFFFFF, 0x1643260, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1488308,
+    0xFFFFFFFF, 0x64B, 0xFFFFFFFF, 0x32400DB, 0xFFFFFFFF, 0x112248, 0x25830B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x8524C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x130904C, 0x230824B, 0x3002848, 0xFFFFFFFF, 0xFFFFFFFF, 0x3400692, 0xC06A2, 0x34C024B, 0xFFFFFFFF, 0x812D2,
+    0x1900080, 0xFFFFFFFF, 0x2121A, 0xFFFFFFFF, 0x418308, 0x24800D8, 0xFFFFFFFF, 0xC44A, 0x128B308, 0x3254210, 0x61049, 0x30C12C3,
+    0x12500D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x496C0, 0x10A850, 0x908080, 0xB8C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x3300018, 0xFFFFFFFF, 0x124309B,
+    0x125A458, 0xFFFFFFFF, 0xFFFFFFFF, 0x200C2C3, 0xFFFFFFFF, 0x60C218, 0x6C9218, 0xFFFFFFFF, 0x129A289, 0x42400CC, 0x24B648, 0x60A688,
+    0xFFFFFFFF, 0x649490, 0x1289659, 0x3092449, 0x1843418, 0x1859200, 0x1A84B, 0x18912C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x30126C8, 0x18D2,
+    0x340148B, 0x20926C0, 0x308125B, 0x3004658, 0x30C0063, 0x30A0C0, 0x131001B, 0xD82A1, 0xFFFFFFFF, 0x148A000, 0x2489200, 0x125148B,
+    0x29109B, 0x324A109, 0x5C6C0, 0x1843300, 0x600698, 0xB698, 0xFFFFFFFF, 0x360084A, 0xFFFFFFFF, 0x3019302, 0x892C0, 0x31801B,
+    0xFFFFFFFF, 0x261B018, 0x612C8, 0x1491202, 0x61B080, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x84B300, 0x4302600, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x32406D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C9818, 0xFFFFFFFF, 0x3494200, 0x324B013, 0x499203, 0xFFFFFFFF, 0x112298, 0x4641300, 0x1301310,
+    0xFFFFFFFF, 0x26CA440, 0xFFFFFFFF, 0x2481253, 0x26C0, 0x22486D8, 0x3418061, 0x36094C8, 0x4309248, 0x2499640, 0x2848003, 0x194D3,
+    0x1294200, 0x849640, 0xFFFFFFFF, 0x19000C2, 0x6C0010, 0x3240003, 0x2009861, 0xFFFFFFFF, 0x2480119, 0x12506D8, 0xC48C, 0x2918C8,
+    0x8C8291, 0xFFFFFFFF, 0x259258, 0xFFFFFFFF, 0x29130A, 0x3061248, 0x4241243, 0x30094CB, 0x60090A, 0xFFFFFFFF, 0x2248003, 0xFFFFFFFF,
+    0x491250, 0x249640, 0xFFFFFFFF, 0x301B, 0x6C9810, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000610, 0x6096A0, 0x32001A, 0x1884B, 0xD00C0,
+    0x4240109, 0x44D3000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x128C258, 0x2C92A1, 0x301010C, 0xFFFFFFFF, 0x192A1, 0x2251803, 0x12890DA,
+    0x401300, 0xFFFFFFFF, 0x44D1, 0xFFFFFFFF, 0x324810B, 0xFFFFFFFF, 0x148A600, 0x30C1689, 0x994D1, 0x294258, 0xC924C, 0xDC480,
+    0xFFFFFFFF, 0x83121, 0x611303, 0xFFFFFFFF, 0xFFFFFFFF, 0x490003, 0x3009298, 0x898C3, 0x1259242, 0x304C248, 0xFFFFFFFF, 0x16412A1,
+    0xFFFFFFFF, 0x12402DA, 0x30490CC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x10B0C3, 0x12428C9, 0x1861A, 0x649858, 0x325C240, 0x3890049,
+    0xFFFFFFFF, 0x261243, 0x125810B, 0xFFFFFFFF, 0x1644300, 0x404258, 0x2482DA, 0x6C9, 0xFFFFFFFF, 0x1321018, 0x3080049, 0x18400A2,
+    0x1122C2, 0x10B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x20D804C, 0x205B449, 0xFFFFFFFF, 0xFFFFFFFF, 0x4985B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x24C9400, 0xFFFFFFFF, 0x4996C0, 0xFFFFFFFF, 0x8C24C, 0xFFFFFFFF, 0x6D06C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1244243, 0x61B449, 0xFFFFFFFF, 0x1508490, 0x6806C3, 0x1719010, 0x6182C8, 0x6C2092, 0x64804C, 0x4C300, 0x36C2248, 0x248663,
+    0x12436C9, 0xFFFFFFFF, 0x2601900, 0xFFFFFFFF, 0xFFFFFFFF, 0x249689, 0x3059, 0x320602, 0x3249842, 0x4240708, 0xFFFFFFFF, 0x2480049,
+    0x1250603, 0x1309458, 0xFFFFFFFF, 0x53502, 0x3000092, 0x301B600, 0xFFFFFFFF, 0xFFFFFFFF, 0x2612418, 0xFFFFFFFF, 0x1488603, 0x80109,
+    0xFFFFFFFF, 0x292258, 0xFFFFFFFF, 0x4252800, 0x24804C3, 0xFFFFFFFF, 0x314018, 0xC9849, 0xFFFFFFFF, 0x20C24C9, 0x6910C3, 0x618659,
+    0x96DB, 0xFFFFFFFF, 0x1509840, 0x680490, 0xFFFFFFFF, 0x30C9448, 0x1303600, 0xFFFFFFFF, 0x325A800, 0x1090C3, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x304C289, 0xFFFFFFFF, 0xE10C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x124B21B, 0x22510, 0xFFFFFFFF, 0x360B203, 0x4300083, 0x260260, 0x1289,
+    0x18659, 0x3112018, 0x70C010, 0x4C0263, 0x261289, 0x30B049, 0x1809B, 0xFFFFFFFF, 0x4689049, 0x4263200, 0x70B, 0x1252413,
+    0xFFFFFFFF, 0xDA24B, 0x3308080, 0x600010, 0x3651218, 0x6D1840, 0xC961B, 0xFFFFFFFF, 0x2294003, 0x1849448, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x164064C, 0x4A3600, 0x204A858, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3618000, 0x603094, 0x464024B, 0x130025B,
+    0xFFFFFFFF, 0x129C000, 0x3012402, 0xFFFFFFFF, 0x30E1049, 0x64864C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12584D8, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1661218, 0x24C840, 0xFFFFFFFF, 0x19448, 0xC064C, 0xFFFFFFFF, 0x33000D8, 0xFFFFFFFF, 0x4D8, 0xFFFFFFFF, 0x6E2240,
+    0xFFFFFFFF, 0x40921B, 0xFFFFFFFF, 0x263098, 0x1B48B, 0xFFFFFFFF, 0x3251600, 0x3098248, 0x1849210, 0xFFFFFFFF, 0xFFFFFFFF, 0xD9498,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x42D2000, 0x4A689, 0x1488080, 0xFFFFFFFF, 0xFFFFFFFF, 0x2268A, 0xFFFFFFFF,
+    0x64059, 0x30A2003, 0x3022840, 0x304A289, 0x463480, 0x8C80C0, 0xFFFFFFFF, 0x24892C0, 0x1249213, 0xFFFFFFFF, 0x32DA002, 0x1289602,
+    0xFFFFFFFF, 0x603311, 0x8C508, 0x12592C0, 0x42C0291, 0x164C218, 0x36C04C0, 0x4300680, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3262000,
+    0x3000464, 0x251213, 0x30D3248, 0x1263640, 0xD8248, 0xFFFFFFFF, 0x30130D8, 0xFFFFFFFF, 0x38CB, 0xFFFFFFFF, 0x654218, 0x499880,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3519200, 0x3848403, 0xFFFFFFFF, 0x33080C9, 0x691490, 0x60165B, 0xFFFFFFFF, 0xFFFFFFFF, 0x30826C8, 0x201B0D8,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xA4218, 0x448A600, 0x3601258, 0x6228B, 0x10C049, 0x3488291, 0xA50C, 0x3109648, 0x12942C0, 0x12C1488,
+    0x9092C0, 0x621202, 0x3490000, 0x32400D8, 0x66001B, 0xFFFFFFFF, 0x12C9200, 0x61B4C0, 0x14889, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C0908,
+    0x3648848, 0xFFFFFFFF, 0xFFFFFFFF, 0xD801B, 0x4241302, 0xFFFFFFFF, 0x2498018, 0xFFFFFFFF, 0xC3248, 0xFFFFFFFF, 0x49C210, 0x2480680,
+    0x263680, 0xFFFFFFFF, 0x21200, 0x324C480, 0x30006D8, 0x24800C3, 0x1240018, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24826C0,
+    0x4292210, 0x1889648, 0x2600848, 0xFFFFFFFF, 0x109258, 0xFFFFFFFF, 0x61925A, 0x22518C0, 0xDA500, 0xFFFFFFFF, 0x14880C2, 0x69B018,
+    0x125A443, 0xFFFFFFFF, 0xC98C9, 0xFFFFFFFF, 0x851259, 0x260403, 0x319258, 0xFFFFFFFF, 0x24E1080, 0x3000002, 0x12C06D8, 0x25A6C8,
+    0xFFFFFFFF, 0x19818, 0x4900C2, 0x400291, 0xFFFFFFFF, 0x308061, 0xFFFFFFFF, 0x2260848, 0x26C1300, 0xFFFFFFFF, 0x251813, 0x2661248,
+    0x3841240, 0x4843002, 0xD884A, 0x4180C0, 0xFFFFFFFF, 0x264480, 0x186D3, 0xFFFFFFFF, 0x4B01B, 0x3613003, 0x3018890, 0x30B0C0,
+    0x18119, 0xFFFFFFFF, 0xFFFFFFFF, 0x3449018, 0x1243400, 0xFFFFFFFF, 0x2600049, 0xFFFFFFFF, 0x18C9249, 0xFFFFFFFF, 0x60425A, 0xFFFFFFFF,
+    0x3063003, 0x3241240, 0xFFFFFFFF, 0x10C648, 0x12412A3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x308A489, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x64924B, 0xFFFFFFFF, 0x681300, 0xFFFFFFFF, 0x94649, 0xFFFFFFFF, 0x29A2C9, 0x492490, 0xFFFFFFFF, 0xFFFFFFFF, 0x4D8003, 0x10721,
+    0x3249460, 0xFFFFFFFF, 0x3001853, 0xFFFFFFFF, 0x30B449, 0x1C643, 0xD1300, 0x2012708, 0x300129C, 0xFFFFFFFF, 0x36D8, 0x21800,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x30180A2, 0x600449, 0x3049403, 0x2251460, 0x200151A, 0x3000719, 0x863000, 0x30C02CB, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1643618, 0x2291291, 0x421690, 0x1250109, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x14886C0, 0x248613, 0x619299, 0x292310, 0x649018,
+    0x491243, 0xFFFFFFFF, 0x601909, 0x1910600, 0x1304242, 0x64B618, 0x492260, 0x851298, 0x60C249, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1249294, 0xC3618, 0x1289680, 0x20124D8, 0xFFFFFFFF, 0x84240, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2480490, 0x2052309, 0x320, 0xFFFFFFFF, 0x652259, 0xFFFFFFFF, 0x691061, 0xFFFFFFFF, 0xFFFFFFFF, 0x294243, 0x3251458,
+    0x2291061, 0x328C0C0, 0xFFFFFFFF, 0x2910C2, 0x3061003, 0xFFFFFFFF, 0x63443, 0x3018318, 0x1243449, 0x461291, 0x3240260, 0x424201B,
+    0x4A4240, 0x604299, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C8603, 0x3013600, 0x92648, 0xFFFFFFFF, 0x18603, 0x3258092, 0xFFFFFFFF,
+    0x681900, 0xFFFFFFFF, 0x621848, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2112249, 0x2A1061, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x41B049, 0x4D8061, 0xFFFFFFFF, 0xC128B, 0xFFFFFFFF, 0xFFFFFFFF, 0x24A308, 0x1251843, 0x294013, 0xFFFFFFFF, 0x4C400, 0x5B498,
+    0xFFFFFFFF, 0x2498098, 0x1950B, 0xFFFFFFFF, 0xFFFFFFFF, 0x20C4289, 0x30C3488, 0xFFFFFFFF, 0x21280, 0xFFFFFFFF, 0xFFFFFFFF, 0x3003318,
+    0x30C030A, 0xFFFFFFFF, 0xFFFFFFFF, 0x3600083, 0xFFFFFFFF, 0x12C0860, 0x1242692, 0xFFFFFFFF, 0xFFFFFFFF, 0x16404D9, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x513600, 0xFFFFFFFF, 0x3092013, 0x248094, 0x30D2402, 0xFFFFFFFF, 0xFFFFFFFF, 0x524C8, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x14A0, 0xFFFFFFFF, 0x260A688, 0xFFFFFFFF, 0x3000083, 0x1858258, 0x24CB, 0x22E3200, 0xD9448, 0x36092C9, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x30D8000, 0xC309B, 0x2000308, 0xFFFFFFFF, 0x184030A, 0x30C0698, 0x314000, 0xFFFFFFFF, 0xDB488, 0x40A688, 0x14A0418, 0x30C00DA,
+    0xFFFFFFFF, 0xC2518, 0xE3200, 0x4253248, 0x3009880, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3083308, 0x853203, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xB703, 0x4700018, 0xFFFFFFFF, 0xFFFFFFFF, 0x601718, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x52298, 0xFFFFFFFF, 0x431A000, 0x1249661,
+    0x6C904C, 0x64C449, 0xFFFFFFFF, 0x3013092, 0x2491488, 0x3493240, 0x1C200, 0x6492D2, 0x8D9600, 0x248308, 0x30C2000, 0xFFFFFFFF,
+    0xC1888, 0xFFFFFFFF, 0x4026E0, 0x3322000, 0x89203, 0x42DB, 0x22403, 0xD8698, 0x30018C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x1C6C8,
+    0xFFFFFFFF, 0xD80DA, 0x4253018, 0x908248, 0x204A843, 0x304C600, 0x3861200, 0x30830D8, 0x14882A1, 0x2546C0, 0x61A458, 0x212C0,
+    0x659260, 0x200C491, 0xFFFFFFFF, 0x12400C0, 0x22DA000, 0xFFFFFFFF, 0x65A289, 0x4B30B, 0x2DB640, 0x2049709, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x649659, 0x4902A1, 0x3010291, 0x30824B, 0x45080C0, 0x649098, 0x4912C3, 0x3308403, 0x720018, 0x12E2000, 0x1262840, 0xC165B,
+    0x3248291, 0x26C9250, 0x18D8018, 0x263083, 0xFFFFFFFF, 0xFFFFFFFF, 0x493300, 0x30016A1, 0x1849202, 0xFFFFFFFF, 0x9264, 0xFFFFFFFF,
+    0x32600C2, 0x2500291, 0x4C9803, 0xB861, 0x1931A, 0xFFFFFFFF, 0xFFFFFFFF, 0x300A440, 0x24830D0, 0x4640003, 0x1300013, 0xFFFFFFFF,
+    0x424061A, 0x851202, 0xFFFFFFFF, 0x9709, 0x13100C3, 0x3698003, 0x26C0848, 0x30098C0, 0x20494D9, 0xFFFFFFFF, 0xFFFFFFFF, 0x1644488,
+    0xFFFFFFFF, 0x300930B, 0x3648003, 0x19200, 0xFFFFFFFF, 0xFFFFFFFF, 0x164C200, 0x11244A, 0xFFFFFFFF, 0x2061308, 0x2A3800, 0x70B018,
+    0xFFFFFFFF, 0x12CA443, 0x260293, 0x1B243, 0xFFFFFFFF, 0x26CA049, 0x3098003, 0x185C200, 0x92119, 0xC08A1, 0x649308, 0x2003294,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x594D9, 0x2D2440, 0x3292203, 0x42890D0, 0x22443, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x10B01B, 0x99303, 0x61B010, 0x24CB003, 0xFFFFFFFF, 0xFFFFFFFF, 0x69A218, 0x25A44B, 0x44A2D2, 0x3683000, 0x49308, 0x2D1309,
+    0x60050C, 0x1243291, 0x4640260, 0x21309, 0x3301243, 0x1489302, 0x249253, 0x1643, 0xC508, 0xFFFFFFFF, 0xFFFFFFFF, 0x1842600,
+    0x259303, 0x30D3003, 0xFFFFFFFF, 0x64C258, 0xFFFFFFFF, 0x24B293, 0xFFFFFFFF, 0x89A600, 0xFFFFFFFF, 0xD22C0, 0x3083000, 0x1844640,
+    0xFFFFFFFF, 0x50C, 0x1A493, 0x5130C0, 0x84A603, 0x20DB003, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x653450, 0xFFFFFFFF, 0x419300,
+    0xFFFFFFFF, 0x188804C, 0xFFFFFFFF, 0x49692, 0x3009462, 0x84303, 0x30C901B, 0x1300600, 0x2601858, 0xFFFFFFFF, 0x12C1243, 0x6002DA,
+    0x3114C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x4B6D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3061680, 0x131B000, 0xFFFFFFFF, 0xFFFFFFFF, 0x3648603,
+    0x308610, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C9243, 0x24B061, 0x30805C, 0x893, 0xC3003, 0x200185B, 0x26C8049, 0x1841850, 0x260890,
+    0x318109, 0x1B840, 0xFFFFFFFF, 0x3098600, 0x1841299, 0xFFFFFFFF, 0xFFFFFFFF, 0x64C4C0, 0x16D0602, 0x2C8109, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1889400, 0x3419289, 0x34C3049, 0x849850, 0x11C248, 0x19002C8, 0xFFFFFFFF, 0xCC802, 0xFFFFFFFF, 0x1658600, 0x121403, 0xC690,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3600262, 0xFFFFFFFF, 0x30C1508, 0x3659000, 0x6D804B, 0xFFFFFFFF, 0x4990A, 0x12C0493, 0x6036C9, 0xFFFFFFFF,
+    0x21908, 0xFFFFFFFF, 0x3300260, 0x112810, 0x60310B, 0xFFFFFFFF, 0x14E10C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x610603, 0x6CC018,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x70C400, 0x24B890, 0x2600A2, 0x1302308, 0x2309840, 0x18C1840, 0x848600, 0x301864B, 0x36C0, 0x4480649,
+    0x12892E0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4D8490, 0xC4299, 0xFFFFFFFF, 0x4A253, 0x418320, 0x4C36C0, 0xC462, 0x1314400,
+    0xFFFFFFFF, 0x151A080, 0x1849283, 0x618262, 0x3488649, 0xFFFFFFFF, 0xFFFFFFFF, 0x3618403, 0x30094A1, 0xFFFFFFFF, 0x6C3049, 0x310C002,
+    0x49119, 0x849508, 0x60031B, 0xFFFFFFFF, 0x1300094, 0xFFFFFFFF, 0x522080, 0x71A240, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2C8263, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x18262, 0xFFFFFFFF, 0xFFFFFFFF, 0x85B600, 0x4318080, 0x308094, 0xFFFFFFFF, 0x3248698,
+    0x49944A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x225121B, 0x20012D2, 0x3003094, 0x252858, 0xFFFFFFFF, 0x1318, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x148A018, 0xFFFFFFFF, 0x2489218, 0xFFFFFFFF, 0x188C000, 0xFFFFFFFF, 0xFFFFFFFF, 0x2532C3, 0xFFFFFFFF, 0x6C025B, 0x24C904B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x30E1210, 0x224C3, 0xFFFFFFFF, 0x1299049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xC9109, 0x4C509,
+    0x12C3092, 0x25A4C2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4840, 0xFFFFFFFF, 0xFFFFFFFF, 0x5C000,
+    0x4303080, 0xFFFFFFFF, 0x890308, 0x189A400, 0x128B480, 0xFFFFFFFF, 0xFFFFFFFF, 0x2600E1, 0x1B092, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x18420C0, 0x313200, 0xFFFFFFFF, 0x3692000, 0x49260, 0x330B080, 0x8C203, 0x1861202, 0x293480, 0xC42D8, 0xE2403, 0x148A848,
+    0x184C440, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x20092C3, 0x18492C2, 0x92400, 0x6C3648, 0xFFFFFFFF, 0x649602, 0x424125A, 0x6800DB,
+    0x12420C0, 0x3490400, 0xFFFFFFFF, 0x26C1488, 0xFFFFFFFF, 0x300A500, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x308C2C0, 0x41824B,
+    0xFFFFFFFF, 0x623640, 0x13184C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x261491, 0x130A450, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24B0E1,
+    0x124B8C0, 0x2251818, 0xFFFFFFFF, 0x401318, 0x1488018, 0x30C3240, 0xFFFFFFFF, 0x323080, 0x652283, 0xFFFFFFFF, 0x1841310, 0x90A003,
+    0x1909202, 0x23640, 0xFFFFFFFF, 0x4240002, 0x301B4C0, 0x2489259, 0x6C0858, 0xFFFFFFFF, 0x1640294, 0x681488, 0x10909B, 0x204A4A0,
+    0x1259240, 0x29A448, 0xFFFFFFFF, 0x4242049, 0x6042C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x6DB240, 0x3604480, 0x61318, 0xFFFFFFFF, 0x124964C,
+    0x224884B, 0x648291, 0x2012890, 0x4249800, 0xFFFFFFFF, 0x125C2C0, 0x13034C0, 0xD9203, 0x4249249, 0x2498D1, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x200425B, 0x499259, 0x301924C, 0x32A1248, 0x1703, 0xFFFFFFFF, 0x1292218, 0x3918000, 0x860002, 0x2642C0, 0xFFFFFFFF,
+    0x6D1258, 0x3251249, 0x848680, 0xFFFFFFFF, 0x204924B, 0x461649, 0x24C9418, 0x1640064, 0x2021249, 0x909240, 0xFFFFFFFF, 0x3489240,
+    0xFFFFFFFF, 0x4A2D4, 0x2509249, 0xFFFFFFFF, 0x9920, 0xFFFFFFFF, 0xC94D9, 0x49084A, 0xFFFFFFFF, 0xFFFFFFFF, 0x12584A0, 0x14D1418,
+    0x1319640, 0x3699240, 0x413689, 0xFFFFFFFF, 0x619309, 0x3493002, 0xE1308, 0xFFFFFFFF, 0x2480613, 0x94480, 0xFFFFFFFF, 0xC0064,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x24A6C0, 0x1902600, 0xFFFFFFFF, 0x1B461, 0xDB010, 0xFFFFFFFF, 0x12CB680, 0x30C1240, 0x198C0, 0xFFFFFFFF,
+    0x2003490, 0x20192A1, 0x603403, 0x30D8059, 0x188901A, 0xC30C2, 0x8E0003, 0x30036D0, 0x2518C2, 0x44C649, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4240603, 0x309B280, 0x251312, 0xFFFFFFFF, 0x23680, 0xD0003, 0x490618, 0x62491, 0xFFFFFFFF, 0x61C242, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3602482, 0x301004C, 0xFFFFFFFF, 0xFFFFFFFF, 0x24C90C9, 0x128901B, 0x16586C0, 0xFFFFFFFF, 0x1241910, 0x1853, 0xCC308, 0x661243,
+    0x12A1418, 0xFFFFFFFF, 0x2880, 0xFFFFFFFF, 0x2092092, 0xFFFFFFFF, 0xFFFFFFFF, 0x83064, 0x38A1, 0x291018, 0xC0893, 0xD9243,
+    0x5C640, 0x30C3600, 0x48C0, 0x4480260, 0x230A480, 0x712202, 0x30008E0, 0x301928B, 0x6106C0, 0x1B6D0, 0x3251848, 0x3098490,
+    0x40A48C, 0x610109, 0x61B003, 0xFFFFFFFF, 0x30836C0, 0x8486C2, 0xFFFFFFFF, 0x2049291, 0xA4E2, 0x2600493, 0x1644240, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3489289, 0x310A640, 0xFFFFFFFF, 0xFFFFFFFF, 0x112203, 0x1244299, 0x20610C3, 0x3719000, 0x661010, 0x425A248,
+    0x10C4C0, 0x124945B, 0xFFFFFFFF, 0x64C243, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x309850, 0xC0663, 0x6490C3, 0x200304C, 0x1840490,
+    0xFFFFFFFF, 0x4289449, 0x1A482, 0xDB610, 0xFFFFFFFF, 0x2480098, 0x251458, 0x984C, 0x1B4A0, 0x64B109, 0xFFFFFFFF, 0x908600,
+    0x2049618, 0xFFFFFFFF, 0xC36C2, 0xFFFFFFFF, 0x8E0600, 0x300944A, 0x30D8098, 0xB892, 0xC310B, 0x490C2, 0x148809B, 0x10A250,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xD0603, 0x4B6C3, 0xFFFFFFFF, 0x6012E2, 0xFFFFFFFF, 0x10490, 0x2618092, 0xFFFFFFFF, 0xFFFFFFFF, 0x12424CB,
+    0x892640, 0xFFFFFFFF, 0x64C010, 0x400263, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x128905C, 0x664400, 0x8516C0, 0xFFFFFFFF,
+    0x18A0, 0xFFFFFFFF, 0x4840418, 0xFFFFFFFF, 0xFFFFFFFF, 0x83661, 0x12E2, 0xFFFFFFFF, 0xD9840, 0x18C0490, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2248308, 0xFFFFFFFF, 0x49449, 0x300921B, 0xFFFFFFFF, 0xFFFFFFFF, 0x130B2C0, 0xC0318, 0x2311218, 0x10B600, 0x124024B, 0x311280,
+    0x304904C, 0xD8708, 0x360024B, 0xFFFFFFFF, 0xFFFFFFFF, 0x1258649, 0x2940C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x63880, 0x92013, 0x3132C0,
+    0x2603092, 0x3412400, 0x3618080, 0x112800, 0xFFFFFFFF, 0xFFFFFFFF, 0x64A242, 0xFFFFFFFF, 0xFFFFFFFF, 0x300B700, 0x12442C3, 0x6CC003,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3000248, 0x36C9600, 0x3510248, 0xFFFFFFFF, 0xFFFFFFFF, 0x128C449, 0x2C94A0, 0x4C0092, 0xFFFFFFFF, 0x194A2,
+    0xC4840, 0x30920C0, 0xFFFFFFFF, 0x254618, 0x46D0, 0xC00E4, 0xC428B, 0xFFFFFFFF, 0x860418, 0x24800DA, 0x351A000, 0xFFFFFFFF,
+    0x2002512, 0x360001A, 0x3311202, 0xFFFFFFFF, 0x1258418, 0xC2121, 0xFFFFFFFF, 0x36100C3, 0xFFFFFFFF, 0x124364B, 0xFFFFFFFF, 0xCB483,
+    0xFFFFFFFF, 0x330001B, 0x254500, 0xFFFFFFFF, 0x1364C, 0x38480C2, 0x28892C0, 0xFFFFFFFF, 0x20C92C3, 0x1689600, 0x6C9213, 0xFFFFFFFF,
+    0x490698, 0x3000018, 0x301324B, 0xFFFFFFFF, 0xFFFFFFFF, 0x230801B, 0xFFFFFFFF, 0x1840858, 0x24B098, 0xFFFFFFFF, 0x12512, 0x47000C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x610860, 0xFFFFFFFF, 0x42CC200, 0x201B24B, 0x4180D8, 0xFFFFFFFF, 0x1324, 0xFFFFFFFF, 0x128B0D8,
+    0x3613018, 0x300981A, 0x2489202, 0x8992C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x201A6C8, 0x600692, 0x1240858, 0x304964B, 0xFFFFFFFF, 0x3603403,
+    0x1489488, 0x3019310, 0x892C3, 0x462289, 0xFFFFFFFF, 0xFFFFFFFF, 0x250A440, 0x25948B, 0x1242880, 0x125B248, 0x225A449, 0x200A500,
+    0x2DB242, 0x24B418, 0xFFFFFFFF, 0x1801A, 0x649262, 0x26C8400, 0x414880, 0x6A2000, 0x61A500, 0x2249258, 0x324B010, 0xFFFFFFFF,
+    0x112280, 0x26324A, 0x1262449, 0x3401240, 0xFFFFFFFF, 0x49B800, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1B063, 0x16D0400, 0x2D1818,
+    0x421200, 0x249C200, 0xFFFFFFFF, 0x28800C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x11C049, 0x4700, 0x6C0013, 0x2125C, 0x30814D1, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x920010, 0x3849249, 0xFFFFFFFF, 0x308924C, 0x3311248, 0x90B240, 0x125B013, 0x18880C0, 0x1318000, 0x84B0C0, 0x3099300,
+    0x6034C3, 0xFFFFFFFF, 0x242C0, 0xFFFFFFFF, 0x491253, 0x20C98C0, 0x2586D8, 0x318291, 0x4701240, 0x513018, 0x42406C0, 0x68A440,
+    0x263018, 0x13026C0, 0xC2600, 0x3249242, 0x534C3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2093289, 0x324A260, 0xFFFFFFFF, 0x24850C,
+    0x3080CC, 0x3403061, 0xFFFFFFFF, 0xFFFFFFFF, 0x4186D8, 0x4C2498, 0x30D22C0, 0x1310618, 0x653840, 0x34DB000, 0x61418, 0x301A489,
+    0xFFFFFFFF, 0x291691, 0xD82E0, 0xFFFFFFFF, 0x12C0618, 0x611300, 0x348B003, 0x3061010, 0xFFFFFFFF, 0xFFFFFFFF, 0x20CC800, 0x6006D3,
+    0x304C24A, 0xCB292, 0xFFFFFFFF, 0x849300, 0xFFFFFFFF, 0x12402DC, 0xFFFFFFFF, 0x13130C0, 0x2009520, 0x2C8600, 0x300B2D8, 0x61B0C0,
+    0x18618, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6A2600, 0x384B, 0x1805C, 0x6492A1, 0x499800, 0xFFFFFFFF, 0xFFFFFFFF, 0x262260,
+    0x3840049, 0x128A48A, 0xFFFFFFFF, 0x149B003, 0x2606C0, 0x4D8049, 0xC2883, 0x32E0049, 0xFFFFFFFF, 0x421800, 0xFFFFFFFF, 0x2848600,
+    0xFFFFFFFF, 0x341C240, 0x4C41B, 0xFFFFFFFF, 0xFFFFFFFF, 0x284804C, 0x19520, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x89690, 0x304C018,
+    0xFFFFFFFF, 0x4A2C0, 0xFFFFFFFF, 0x259858, 0x1244242, 0x990B, 0xFFFFFFFF, 0x4240262, 0xFFFFFFFF, 0x1850049, 0xFFFFFFFF, 0x2109291,
+    0x1318049, 0x201264B, 0x3011840, 0x3014403, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x10A310, 0xFFFFFFFF, 0x8906C0, 0xFFFFFFFF,
+    0xD06C0, 0x42432C8, 0x3000659, 0x263059, 0x6C9291, 0x1B449, 0xFFFFFFFF, 0x3000098, 0xFFFFFFFF, 0x806C3, 0x24DC, 0x64C0D0,
+    0xD9460, 0x34D9002, 0xFFFFFFFF, 0x612480, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2501289, 0x184B218, 0x3651448, 0xC859, 0x18990C0,
+    0xFFFFFFFF, 0x59121, 0x2481508, 0x610320, 0x348B600, 0x32D2248, 0x490602, 0x680493, 0x25A648, 0x619689, 0xFFFFFFFF, 0x3680649,
+    0x49510, 0x853218, 0x6032D2, 0x125928B, 0x21511, 0xE10C3, 0xFFFFFFFF, 0x4300648, 0xFFFFFFFF, 0x22DA248, 0xFFFFFFFF, 0x3600311,
+    0x42404D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x128C, 0x511289, 0x662250, 0xFFFFFFFF, 0x8304C, 0x920E1, 0x388C, 0x34124C0, 0xFFFFFFFF,
+    0x4016D0, 0x3018258, 0x12E2248, 0xFFFFFFFF, 0x32484D8, 0xFFFFFFFF, 0x30008CB, 0x119061, 0xFFFFFFFF, 0x6D4400, 0xFFFFFFFF, 0x8DA080,
+    0x84A24B, 0x184944A, 0x6116D0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x62249, 0x25A410, 0x12512D2, 0x24CC002, 0xFFFFFFFF, 0x492E0,
+    0x300A688, 0x1244842, 0x304C059, 0x29A24B, 0x4A303, 0x616D0, 0xFFFFFFFF, 0x1244289, 0xC511, 0x260921B, 0xFFFFFFFF, 0x61112,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x14D4000, 0xFFFFFFFF, 0x42412C3, 0xFFFFFFFF, 0x1842018, 0x308258, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x24C289, 0x3098, 0x13710, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2604D8, 0x449600, 0x188C8, 0x3858248, 0x151A010, 0x30000D3,
+    0x184921A, 0xA85B, 0x23200, 0x23080D8, 0x4250248, 0x30026D8, 0x6124C0, 0x61921B, 0x188904B, 0xE1218, 0xFFFFFFFF, 0x600293,
+    0xFFFFFFFF, 0x2860248, 0xC9891, 0x659049, 0x851218, 0xFFFFFFFF, 0xFFFFFFFF, 0x26920C0, 0x1318418, 0x3698018, 0x683092, 0x24892C2,
+    0xFFFFFFFF, 0x1259888, 0xFFFFFFFF, 0x5444B, 0xFFFFFFFF, 0xFFFFFFFF, 0x364801B, 0x19218, 0x31092C8, 0xFFFFFFFF, 0x3002000, 0xFFFFFFFF,
+    0x188B, 0x10920, 0x64B480, 0x59049, 0x4261200, 0x1689490, 0xFFFFFFFF, 0x130A840, 0xFFFFFFFF, 0x403294, 0x692000, 0x30C2618,
+    0xFFFFFFFF, 0x29104C, 0x2004889, 0x84824A, 0x3009203, 0xFFFFFFFF, 0xFFFFFFFF, 0x293649, 0x2311203, 0x84A848, 0x300B800, 0x30DA440,
+    0x1A121, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3601242, 0xFFFFFFFF, 0x6020C0, 0x6C0691,
+    0x12849, 0x3683018, 0xE1490, 0xFFFFFFFF, 0x6030E1, 0xA20C0, 0xFFFFFFFF, 0xCC6C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x9404C, 0xFFFFFFFF,
+    0x1A003, 0xFFFFFFFF, 0x4244480, 0xFFFFFFFF, 0x1858403, 0x30B418, 0x6480C3, 0x324A443, 0x2C948B, 0xFFFFFFFF, 0x60B8C0, 0x452508,
+    0xC324B, 0x3261242, 0x848018, 0x248324A, 0x513, 0x224A6C8, 0xC00D0, 0xFFFFFFFF, 0x84A618, 0x691260, 0xFFFFFFFF, 0x23803,
+    0xD84C0, 0x3254200, 0x300011C, 0x12D2449, 0x30B300, 0x23249, 0x3421800, 0x164301B, 0x2024200, 0x248A440, 0x3488061, 0xFFFFFFFF,
+    0xE1259, 0x1658848, 0x300A499, 0x121648, 0x1301658, 0xC98D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x2DA449, 0x1249813, 0x304A2C3, 0xC9312,
+    0x493243, 0x3000003, 0x1492442, 0x3510000, 0xFFFFFFFF, 0xFFFFFFFF, 0x3609249, 0x3002603, 0xFFFFFFFF, 0xFFFFFFFF, 0x1925B, 0xC301B,
+    0x3262600, 0xFFFFFFFF, 0x30C0618, 0x448A, 0xFFFFFFFF, 0x65221A, 0x492109, 0x3309242, 0x30C005C, 0x1309, 0xC249A, 0x32E1240,
+    0xFFFFFFFF, 0x3009802, 0x20D9243, 0x308510, 0x1889418, 0xFFFFFFFF, 0x18C9800, 0x422440, 0x3291248, 0x61A600, 0x3400320, 0x4A498,
+    0x3003509, 0xFFFFFFFF, 0x61A04C, 0x6C1250, 0x4488049, 0x3601850, 0x52218, 0xFFFFFFFF, 0x61C640, 0xFFFFFFFF, 0x34A1240, 0x4C4D1,
+    0xFFFFFFFF, 0x3013003, 0x92049, 0x18002, 0x1319249, 0x400061, 0x1840610, 0xFFFFFFFF, 0x3649418, 0xFFFFFFFF, 0x324B002, 0xFFFFFFFF,
+    0x41B018, 0x2661018, 0x61061B, 0xFFFFFFFF, 0xD8610, 0x3094248, 0x3000258, 0x1858449, 0x42990C0, 0x14303, 0xFFFFFFFF, 0x4030C3,
+    0xFFFFFFFF, 0x612658, 0x1251240, 0x21802, 0x4924B, 0x409861, 0x81300, 0x124B508, 0xFFFFFFFF, 0xC0112, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2514CB, 0xFFFFFFFF, 0xFFFFFFFF, 0x23849, 0x3600049, 0xFFFFFFFF, 0x1849298, 0x1258449, 0xFFFFFFFF, 0xFFFFFFFF, 0x24E2200, 0x684240,
+    0x253508, 0x6C04A0, 0x12648, 0x649013, 0x491240, 0x300A4D8, 0x60C800, 0x3000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000602,
+    0x3510600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C9858, 0x20D2648, 0xFFFFFFFF, 0x249A, 0xC361A, 0x490109, 0x4249458, 0x4309003,
+    0x428C400, 0xFFFFFFFF, 0x130B448, 0x12890C9, 0xFFFFFFFF, 0x30C0659, 0x124B2D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x3081289, 0x61403, 0x836C0,
+    0xFFFFFFFF, 0x1870B, 0x8C8049, 0x1293440, 0x12C0600, 0x4CC800, 0x618049, 0x2910C9, 0x2880308, 0x8482C8, 0x4250092, 0x3018308,
+    0x61A649, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x318049, 0xFFFFFFFF, 0xFFFFFFFF, 0x361A248, 0xFFFFFFFF, 0x204C490,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x344C0C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x2249843, 0xFFFFFFFF, 0x128C013, 0xFFFFFFFF, 0x2482CB, 0x4289610,
+    0x224928C, 0xFFFFFFFF, 0xFFFFFFFF, 0x201B603, 0x9110C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xD0320, 0x4036C0, 0x2503600, 0xFFFFFFFF, 0x1254400,
+    0x1C689, 0xFFFFFFFF, 0x49848, 0x30012D8, 0x80320, 0xFFFFFFFF, 0xFFFFFFFF, 0x3692010, 0x201A4C9, 0xFFFFFFFF, 0x60304B, 0x304C000,
+    0x14E1000, 0xE2418, 0xFFFFFFFF, 0x20C944B, 0x25C400, 0x4496C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x64961A, 0x490262, 0x1092E0, 0x10A8C0, 0x621618, 0xFFFFFFFF, 0x1891448, 0xFFFFFFFF, 0x10A302, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x128A243, 0xE2300, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C9280, 0xD4289, 0x708092, 0x24A0D8, 0x4309600, 0x24C9, 0x3708248,
+    0xFFFFFFFF, 0x3260083, 0x1843488, 0x1859249, 0xFFFFFFFF, 0x192DB, 0x3081889, 0x402910, 0x60025B, 0xFFFFFFFF, 0x311448, 0x2260308,
+    0x652298, 0x49A4C0, 0x860258, 0x618648, 0xFFFFFFFF, 0x3061602, 0xD8311, 0x300C440, 0x6920D0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1641889, 0x34E1200, 0x1852400, 0x318649, 0x26000DB, 0xFFFFFFFF, 0x4242061, 0x689218, 0x1240308, 0x4641488, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4243080, 0x18D1049, 0x1242908, 0x1030B, 0x1309210, 0x260A458, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3708018, 0x18080, 0x324A061,
+    0xFFFFFFFF, 0x1840698, 0x1900248, 0x1252400, 0xFFFFFFFF, 0x4859200, 0xFFFFFFFF, 0x119049, 0x30C3002, 0xC618, 0x22400, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x24812C3, 0xFFFFFFFF, 0x3059092, 0xFFFFFFFF, 0xFFFFFFFF, 0x148B418, 0x603649, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3618018, 0x30CB800, 0xA2061, 0x212CC, 0xFFFFFFFF, 0x20098D8, 0x14892C3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x325B018,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xCA510, 0xFFFFFFFF, 0xFFFFFFFF, 0x1842003, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1289260, 0x42580C2,
+    0x301801A, 0x1900018, 0xFFFFFFFF, 0x3248293, 0xFFFFFFFF, 0x59263, 0x2480063, 0xFFFFFFFF, 0xFFFFFFFF, 0x341B018, 0x18C3248, 0x30000C0,
+    0x252453, 0xFFFFFFFF, 0x1C498, 0xD9488, 0xFFFFFFFF, 0x30026C3, 0x90801A, 0xFFFFFFFF, 0x24210, 0x34C00C3, 0x849488, 0x300A442,
+    0x30C06C9, 0xC883, 0xFFFFFFFF, 0x2312440, 0x200C261, 0x10B24B, 0x124148A, 0x2109649, 0x2942C8, 0xFFFFFFFF, 0x4240059, 0x24A000,
+    0x6180CC, 0xFFFFFFFF, 0xFFFFFFFF, 0x3259258, 0x3009309, 0x248461, 0x12434C3, 0x19203, 0xFFFFFFFF, 0xFFFFFFFF, 0x40125B, 0x12C26C8,
+    0x6C1309, 0x6C9649, 0x3248061, 0x42430C2, 0xFFFFFFFF, 0x251200, 0xFFFFFFFF, 0xFFFFFFFF, 0x3858003, 0x2018064, 0x30130C3, 0x1859640,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x324B680, 0x2500061, 0x300249A, 0x30C204C, 0x311810, 0xC4488, 0xFFFFFFFF, 0xFFFFFFFF, 0x301A880, 0x4D80C3,
+    0xFFFFFFFF, 0xC9649, 0x3119248, 0x3000308, 0x602661, 0x1241253, 0x30590D8, 0x6D8002, 0x498CB, 0x3009692, 0x12C3018, 0x1258061,
+    0x11258, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6030CC, 0x1243293, 0x22DA600, 0xD0848, 0x36006C9, 0x1840002, 0x4303000, 0x6C26C0,
+    0x13291, 0xFFFFFFFF, 0x360010B, 0x3010891, 0x1689248, 0x30B400, 0x1B013, 0xD8002, 0x3001243, 0x3018610, 0xFFFFFFFF, 0x12711,
+    0x3843000, 0x2309240, 0x848003, 0x248119, 0x1900059, 0x30C9, 0xFFFFFFFF, 0x1292600, 0x40924C, 0x1849800, 0x9C258, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x18C06C0, 0x2519240, 0x619800, 0xFFFFFFFF, 0x1311243, 0x49683, 0x3009460, 0xFFFFFFFF, 0x4640600, 0x8A1248,
+    0xFFFFFFFF, 0x490DA, 0x851802, 0x1243063, 0xC8C9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x36C004B, 0xFFFFFFFF, 0x319240, 0x210C248,
+    0x8C8109, 0xFFFFFFFF, 0x12C06C3, 0x168901B, 0xFFFFFFFF, 0x19800, 0xFFFFFFFF, 0xFFFFFFFF, 0x3014240, 0x93289, 0x4522C0, 0xC044C,
+    0xFFFFFFFF, 0x12A3000, 0x30C0613, 0xFFFFFFFF, 0x224A483, 0x652203, 0x200128C, 0x3000490, 0x149804C, 0x28DA, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x201C240, 0x253849, 0xFFFFFFFF, 0x2248320, 0x16D004B, 0x404300, 0x10901A, 0xFFFFFFFF, 0xFFFFFFFF, 0x21462, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x10B618, 0x1241853, 0x311298, 0xFFFFFFFF, 0xCC249, 0x1658049, 0xFFFFFFFF, 0xFFFFFFFF, 0x9518, 0x291509, 0x49908,
+    0x54803, 0xFFFFFFFF, 0x25A483, 0xFFFFFFFF, 0x244C8, 0xFFFFFFFF, 0x1701289, 0x249853, 0x660, 0xFFFFFFFF, 0x32416D0, 0x36032C8,
+    0x20C9508, 0x2661000, 0x1689848, 0x6C9458, 0x514240, 0x4240311, 0x3000260, 0x264240, 0xFFFFFFFF, 0x3059000, 0xFFFFFFFF, 0x848602,
+    0x3002860, 0xFFFFFFFF, 0xFFFFFFFF, 0x3843049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x11C018, 0x310C, 0x461003, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x419900, 0xFFFFFFFF, 0xC460, 0x3409448, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C12D8, 0x6C3600, 0xFFFFFFFF, 0xE1848, 0x3312240,
+    0x12C0263, 0x61928B, 0x6C304B, 0xFFFFFFFF, 0xE1280, 0xFFFFFFFF, 0x89508, 0xFFFFFFFF, 0x31C400, 0x64B603, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x32424C9, 0x2C9843, 0x264C000, 0xFFFFFFFF, 0x4528C0, 0x18263, 0xFFFFFFFF, 0x26C8648, 0x301841B,
+    0x6A2248, 0xFFFFFFFF, 0xC304B, 0x49000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x318, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C8709, 0x4C3490,
+    0x30DA018, 0x18709, 0xFFFFFFFF, 0xFFFFFFFF, 0x404900, 0x42144B, 0x204C003, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x20C030B, 0x603260,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x52802, 0xFFFFFFFF, 0x60428B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x894000, 0xFFFFFFFF, 0x2892400, 0x400649, 0x300C2D0, 0x25A4C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6A2018,
+    0x4843, 0x130B200, 0xD3489, 0x3000860, 0x68A688, 0x12D8308, 0x1A064, 0xFFFFFFFF, 0xFFFFFFFF, 0x424B249, 0xFFFFFFFF, 0x125024B,
+    0x3059049, 0x4498018, 0xFFFFFFFF, 0xFFFFFFFF, 0x12D2003, 0x3709, 0xFFFFFFFF, 0xFFFFFFFF, 0x32612C0, 0x2E0308, 0x1861210, 0x2061600,
+    0x2251491, 0x3253249, 0x5A900, 0x3003300, 0x1240080, 0xFFFFFFFF, 0x6D8418, 0xFFFFFFFF, 0x361A003, 0x2DA003, 0x92403, 0x31A402,
+    0x649603, 0x49024B, 0xFFFFFFFF, 0x36D8000, 0x12420C3, 0x1259491, 0xFFFFFFFF, 0xFFFFFFFF, 0x2013640, 0x14A20C0, 0xFFFFFFFF, 0x38D1200,
+    0x2601318, 0xFFFFFFFF, 0x68A458, 0x248001B, 0xFFFFFFFF, 0xFFFFFFFF, 0xD00DB, 0x534D8, 0x26E0010, 0x1689092, 0x12492C2, 0xFFFFFFFF,
+    0x3113240, 0x848418, 0x24B0C0, 0x800DB, 0x93309, 0x21603, 0x3080294, 0xFFFFFFFF, 0x148801B, 0x30C324A, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3249700, 0x2CB308, 0x14A0403, 0x30C00C0, 0x312450, 0x1B308, 0xFFFFFFFF, 0x20C0908, 0x109659, 0x2848291, 0x348B018, 0xFFFFFFFF,
+    0x65C600, 0x68148B, 0xFFFFFFFF, 0x30CA440, 0x1300461, 0x26000C0, 0x4A508, 0x30A2440, 0x600123, 0x60C603, 0xFFFFFFFF, 0x42C1243,
+    0xFFFFFFFF, 0x418018, 0x2493018, 0x30A003, 0x1309203, 0x128B01B, 0x360C200, 0xFFFFFFFF, 0x1858010, 0x11318, 0x130B800, 0xFFFFFFFF,
+    0x542C0, 0x1840683, 0x124B690, 0x32A4, 0x64A2D8, 0x20000C3, 0x30008A1, 0x2E1488, 0x940D8, 0x42C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x30018C3, 0x421818, 0x618403, 0x1B0D0, 0xC22DA, 0xFFFFFFFF, 0x148884A, 0x253690, 0x38C8000, 0xA4A3, 0x3240618, 0xFFFFFFFF,
+    0x3003900, 0xFFFFFFFF, 0x6C1643, 0x22890, 0x34C1300, 0x20098C0, 0x2DA610, 0x1718000, 0x304A498, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x36C1240, 0x12426C3, 0x4299018, 0xFFFFFFFF, 0xFFFFFFFF, 0x2012660, 0x3010294, 0xFFFFFFFF, 0x6C30C9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x69B0C0, 0x309253, 0x4640109, 0x2263003, 0xFFFFFFFF, 0x40249B, 0x248005C, 0x12498C9, 0x6D0000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x83291, 0x30D8610, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C9303, 0x680003, 0x4C14D1, 0x3648109, 0xC0509, 0xFFFFFFFF, 0xFFFFFFFF, 0x863400,
+    0x1240449, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x360044C, 0x14A0449, 0x30C0109, 0x890000, 0x2861240, 0xD0000, 0x49061A, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x6D9249, 0x16402DA, 0xFFFFFFFF, 0x1090D8, 0x308002, 0x12492, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3649010, 0xFFFFFFFF, 0x324804B, 0x12990D8, 0x2018603, 0x24A498, 0x12A1, 0x3708600, 0xFFFFFFFF, 0x2018049, 0x1842260, 0x4C1858,
+    0x3084A0, 0x1C250, 0x5122C0, 0x40010C, 0x20C1858, 0x2483449, 0x311800, 0xFFFFFFFF, 0x20042A1, 0x3084240, 0x30034A0, 0x251690,
+    0x311248, 0xFFFFFFFF, 0xFFFFFFFF, 0x6124B, 0x692488, 0xFFFFFFFF, 0xFFFFFFFF, 0x30590C0, 0xD810B, 0x62261, 0x2482308, 0xFFFFFFFF,
+    0x1258049, 0x1312480, 0x1644243, 0x2021292, 0x32910C2, 0x12406C0, 0x4641840, 0xFFFFFFFF, 0x4A318, 0xFFFFFFFF, 0x1718049, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xCC0D8, 0x661000, 0xFFFFFFFF, 0xFFFFFFFF, 0x1249458, 0xFFFFFFFF, 0x1289848, 0x4249618, 0x24C850, 0x2491289, 0x2092,
+    0xFFFFFFFF, 0x2000490, 0x3092080, 0x2480659, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12A1680, 0x248009B, 0x30C0260, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3119003, 0x61010, 0xFFFFFFFF, 0xFFFFFFFF, 0x224B109, 0xFFFFFFFF, 0xFFFFFFFF, 0x3610092, 0xFFFFFFFF, 0x1243602, 0x188A640,
+    0xFFFFFFFF, 0x490C0, 0x40C292, 0xFFFFFFFF, 0x124304C, 0x304A850, 0xFFFFFFFF, 0x34C9448, 0x1659840, 0xFFFFFFFF, 0xFFFFFFFF, 0x304B880,
+    0xFFFFFFFF, 0x490659, 0x301064C, 0x1689003, 0xFFFFFFFF, 0xFFFFFFFF, 0x64C013, 0x3092403, 0x24B04C, 0x25B6C0, 0x3490258, 0xFFFFFFFF,
+    0x3248648, 0x401289, 0x1840260, 0x124C848, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x18C3600, 0xFFFFFFFF, 0x168C049, 0x1C850, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2C96D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x29105C, 0xFFFFFFFF, 0x3083260, 0x109003, 0x2483488, 0xFFFFFFFF, 0xC031B, 0xFFFFFFFF,
+    0x712248, 0x10B603, 0x248B203, 0x311283, 0x294680, 0xDB2C8, 0xFFFFFFFF, 0x14A0258, 0x2049891, 0x10260, 0x2940C2, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4212D8, 0x1242291, 0xFFFFFFFF, 0x3412403, 0xFFFFFFFF, 0x20212C0, 0x4258248, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x661610,
+    0xFFFFFFFF, 0x12C921B, 0x124C618, 0xFFFFFFFF, 0x64C840, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C0649, 0x924C3, 0x18493, 0x6496C9, 0x490311,
+    0x3010308, 0x301861A, 0x624280, 0xC3262, 0x34C0248, 0x8DC000, 0xFFFFFFFF, 0x2480698, 0x521, 0xC00E1, 0xFFFFFFFF, 0x4A240,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3059490, 0xD84D8, 0x2292840, 0x2524C0, 0x618248, 0x92D3, 0xC3708, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x12C024B, 0x1243649, 0xFFFFFFFF, 0x24280, 0x3602061, 0x63092, 0xFFFFFFFF, 0xFFFFFFFF, 0x2061490, 0xFFFFFFFF, 0x3603080, 0xFFFFFFFF,
+    0x602908, 0x260418, 0xFFFFFFFF, 0xFFFFFFFF, 0x709602, 0x300001B, 0xFFFFFFFF, 0xFFFFFFFF, 0x13020C3, 0xFFFFFFFF, 0x3602500, 0x2484D8,
+    0x2482000, 0x612400, 0xFFFFFFFF, 0x2000294, 0x424A440, 0x18402A1, 0x4D824B, 0x44A0, 0x45B648, 0x6612C8, 0xFFFFFFFF, 0x18412C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2692000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2910A2, 0x49493, 0x300925C, 0x24834C0,
+    0x1243418, 0x6C024B, 0x21491, 0xFFFFFFFF, 0x8492C0, 0x30C30D0, 0x613308, 0xC6C3, 0x3063018, 0x150B248, 0x1491203, 0xFFFFFFFF,
+    0x125B24A, 0xFFFFFFFF, 0xFFFFFFFF, 0x200A503, 0x248858, 0x92063, 0x12580CC, 0x2910010, 0x3412449, 0x49148A, 0x681318, 0x6A2003,
+    0x694, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000848, 0x112283, 0xFFFFFFFF, 0x1262442, 0xFFFFFFFF, 0x2898003, 0x3263400, 0x41948B, 0xFFFFFFFF,
+    0x184C0, 0x4498003, 0x16D0403, 0x2503018, 0x42121B, 0x1903240, 0x3403291, 0x128930A, 0xFFFFFFFF, 0x1840510, 0x18430D0, 0x30D9250,
+    0x1A500, 0xCC600, 0x4B860, 0x6164B, 0x2514E0, 0xC491, 0x6D00C3, 0xFFFFFFFF, 0x150B018, 0x61092, 0x908680, 0xFFFFFFFF,
+    0x24880, 0xFFFFFFFF, 0x3618449, 0x1700061, 0x36D8002, 0x1300680, 0xFFFFFFFF, 0x3603680, 0xFFFFFFFF, 0x4258059, 0x12430DA, 0x13000C2,
+    0xC0013, 0x36030C2, 0x4243289, 0x2480000, 0x26301A, 0x1B400, 0x3249249, 0xD8400, 0x26E0002, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x260B680, 0xFFFFFFFF, 0x2019243, 0x4309018, 0x34D1, 0x4483003, 0x12890E1, 0x201B848, 0x18402E0, 0xFFFFFFFF, 0xC818, 0x3409800,
+    0x24D9248, 0x403908, 0x20C2480, 0x60125A, 0xA1803, 0xFFFFFFFF, 0x8C8061, 0x3001520, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C3403, 0x306101A,
+    0x1509240, 0x8498C0, 0x6006D0, 0x603293, 0x1303000, 0xFFFFFFFF, 0x26C1243, 0x849302, 0x36C3000, 0xFFFFFFFF, 0x30490D3, 0x648848,
+    0xFFFFFFFF, 0x418000, 0x430004B, 0x92660, 0x1861B, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C30C3, 0x60A499, 0x30D0049, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x26CB000, 0xFFFFFFFF, 0xFFFFFFFF, 0x31B0C0, 0xFFFFFFFF, 0x652600, 0x3308049, 0x249309, 0x364A480, 0x6C94C8, 0xFFFFFFFF, 0x2264240,
+    0xFFFFFFFF, 0x2481299, 0x992A1, 0xFFFFFFFF, 0x1B0C0, 0x16D3002, 0x3611840, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C0613, 0x29248A, 0x492A1,
+    0x8480A2, 0x6004A3, 0x204A258, 0xFFFFFFFF, 0x310901A, 0xFFFFFFFF, 0x6424A, 0x25C418, 0x9C300, 0xFFFFFFFF, 0x2602480, 0xFFFFFFFF,
+    0x610D0, 0xFFFFFFFF, 0x4299003, 0xFFFFFFFF, 0xD1240, 0x26C0490, 0x165A480, 0x30C90C0, 0x361B, 0x2248049, 0xFFFFFFFF, 0x663000,
+    0x3011289, 0x124B448, 0x305C, 0x3400049, 0x3249840, 0x402480, 0xFFFFFFFF, 0x25C300, 0x32004B, 0x1B44C, 0x3249289, 0x2019840,
+    0x83294, 0x1250049, 0xFFFFFFFF, 0x4483600, 0xFFFFFFFF, 0x20C0490, 0x25344B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xDA482, 0xFFFFFFFF,
+    0x89460, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x258049, 0xFFFFFFFF, 0xFFFFFFFF, 0xC9292, 0xFFFFFFFF, 0x388C000,
+    0x204C061, 0xA1292, 0xFFFFFFFF, 0x1509289, 0x2012418, 0x12C0092, 0x1243492, 0x130304B, 0x3680092, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x248B2C0, 0x893049, 0xD0493, 0x128B600, 0x4243098, 0x113442, 0x128B, 0x1865C, 0xFFFFFFFF, 0x128B049, 0xFFFFFFFF, 0x1842248,
+    0x308492, 0xFFFFFFFF, 0xD24D0, 0x308064C, 0x14932C0, 0x112880, 0x712, 0xFFFFFFFF, 0x324B098, 0xFFFFFFFF, 0x112308, 0x301925A,
+    0xFFFFFFFF, 0x1B6C0, 0x129224B, 0x5A4D1, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xC9061, 0xFFFFFFFF, 0x62250, 0x680263, 0x603660,
+    0xA4D8, 0x448A003, 0x1640092, 0xFFFFFFFF, 0xFFFFFFFF, 0x124400, 0xFFFFFFFF, 0x26014A0, 0xFFFFFFFF, 0x36C0258, 0x4300418, 0x920080,
+    0x4299600, 0x2122240, 0x4B320, 0x403603, 0x24A24B, 0x30C96C0, 0x6C20D8, 0xFFFFFFFF, 0x4850248, 0x184201B, 0xFFFFFFFF, 0x365C,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x4014A0, 0x24C28B, 0x60B2C3, 0x98649, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x300069B, 0x30C024B, 0x1250649,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x485A000, 0x301B648, 0x12D2403, 0xFFFFFFFF, 0xFFFFFFFF, 0x2000920, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x464003, 0x308030B, 0xFFFFFFFF, 0x10A240, 0xFFFFFFFF, 0x464001B, 0xFFFFFFFF, 0xE2240, 0x85121A, 0x6012D2, 0x9721, 0xC2E1,
+    0xC92D0, 0xFFFFFFFF, 0x71B200, 0x24892C9, 0x125C448, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C112, 0xFFFFFFFF, 0x12434D8, 0xFFFFFFFF, 0x6CB203,
+    0x1289049, 0xFFFFFFFF, 0x24949B, 0xFFFFFFFF, 0x188C, 0xFFFFFFFF, 0x128B649, 0x3262003, 0x14912C9, 0x30A061, 0x18698, 0x3858018,
+    0xFFFFFFFF, 0x5B64A, 0x4C1889, 0xFFFFFFFF, 0x38C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x401719, 0xFFFFFFFF, 0x3311, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1292848, 0x2D2458, 0x600083, 0xFFFFFFFF, 0xFFFFFFFF, 0x4488010, 0x34C9200, 0x2294049, 0xFFFFFFFF, 0xFFFFFFFF, 0x1024B, 0xFFFFFFFF,
+    0x1643248, 0xFFFFFFFF, 0x6020C3, 0x619491, 0x1303418, 0xFFFFFFFF, 0x4A902, 0x8620C0, 0xFFFFFFFF, 0xA20C3, 0xFFFFFFFF, 0x3248403,
+    0xFFFFFFFF, 0x3012449, 0x1241703, 0x165B, 0x648692, 0x3601700, 0xFFFFFFFF, 0x1842618, 0x6092C2, 0xFFFFFFFF, 0x46580C0, 0xFFFFFFFF,
+    0x3001258, 0x24C888, 0x3694, 0x1303300, 0xC0691, 0x3083018, 0x3003858, 0x918248, 0x30C3, 0x34000C3, 0x260C2C0, 0x712000,
+    0x30006DA, 0x692840, 0xFFFFFFFF, 0x3200D0, 0x3249309, 0x5B8C0, 0x1842500, 0x14A0013, 0x6C2000, 0x260084B, 0xFFFFFFFF, 0x1488680,
+    0x10A842, 0xFFFFFFFF, 0x12526C8, 0x29A618, 0xFFFFFFFF, 0xFFFFFFFF, 0x4258002, 0xFFFFFFFF, 0x304A888, 0xCC490, 0xFFFFFFFF, 0x5244A,
+    0x699488, 0x60964C, 0x6C9200, 0xFFFFFFFF, 0xFFFFFFFF, 0x1492440, 0x603900, 0x3510003, 0x1981B, 0x1289649, 0x2C925B, 0x184084A,
+    0x60B690, 0xFFFFFFFF, 0x4522D8, 0xFFFFFFFF, 0x26C9640, 0x85B018, 0x30C061A, 0x9B018, 0x224A498, 0x3249690, 0x3309249, 0x2518000,
+    0x4D9243, 0x1310, 0x291659, 0xD8291, 0x3613000, 0x4C4488, 0x124A708, 0x30DB002, 0xC34C3, 0x16D1640, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4CC218, 0x1252498, 0x2881300, 0x6526C0, 0x1520000, 0x6016A1, 0xFFFFFFFF, 0x6C125A, 0x2930C3, 0x5221B, 0x62888, 0x4218C0,
+    0x12412A1, 0xFFFFFFFF, 0xFFFFFFFF, 0x3601299, 0xFFFFFFFF, 0x3013000, 0x125C240, 0x18000, 0x64924A, 0xFFFFFFFF, 0x1840618, 0xFFFFFFFF,
+    0x6C0119, 0xFFFFFFFF, 0x660061, 0xFFFFFFFF, 0x12C9249, 0x4D8000, 0x425B, 0xFFFFFFFF, 0xFFFFFFFF, 0x12A1248, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x14300, 0x1C658, 0x324A482, 0x848618, 0x2483840, 0x2498059, 0xFFFFFFFF, 0xC06D3, 0x3900049, 0x201A480, 0x60044C, 0x30C3449,
+    0xFFFFFFFF, 0x4484240, 0x4B848, 0x3000712, 0x2514C8, 0x6130C0, 0x10618, 0xDB0C2, 0x150B000, 0xFFFFFFFF, 0x602480, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3300603, 0x3449291, 0xFFFFFFFF, 0xFFFFFFFF, 0x12658, 0xFFFFFFFF, 0x330004C, 0x10A2C3, 0x171B000, 0x449,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x304A300, 0xFFFFFFFF, 0x4906C9, 0x3094018, 0x4C3000, 0x1249298, 0x1985A,
+    0x64C083, 0x2308049, 0xFFFFFFFF, 0x1843449, 0x262489, 0x1929C, 0xC04A0, 0x49018, 0x18402C8, 0x2518600, 0x44CC, 0x3059848,
+    0xD8890, 0x4B618, 0x3004689, 0xFFFFFFFF, 0xFFFFFFFF, 0x29424A, 0xFFFFFFFF, 0xFFFFFFFF, 0x421460, 0x12D2258, 0x313448, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x63440, 0x6006C0, 0x452200, 0xFFFFFFFF, 0x3241843, 0x4243602, 0xFFFFFFFF, 0x8A8D0, 0x2061291, 0xFFFFFFFF,
+    0x2009508, 0xFFFFFFFF, 0x300B2C0, 0x19090C0, 0xFFFFFFFF, 0x64984A, 0x3609618, 0x62310, 0x10C0D0, 0x124230B, 0x429A240, 0x3240709,
+    0xFFFFFFFF, 0x404240, 0x2482C8, 0x3649449, 0x1A649, 0x1321000, 0xFFFFFFFF, 0x5C018, 0x2480260, 0x61064C, 0xC128C, 0x24D9000,
+    0x4036C3, 0x3001899, 0x4DA640, 0x1251840, 0xFFFFFFFF, 0xD80A2, 0xFFFFFFFF, 0x18420D8, 0x81903, 0x30D8258, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x1489842, 0x254688, 0x60304C, 0xFFFFFFFF, 0x32D1448, 0x3600649, 0xFFFFFFFF, 0x30C0311, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x20092DB,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x9241B, 0x1302248, 0xFFFFFFFF, 0x491842, 0x4250308, 0x12420D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x32DB200, 0xFFFFFFFF,
+    0x68944B, 0xFFFFFFFF, 0x3049, 0xFFFFFFFF, 0x128A242, 0xFFFFFFFF, 0x721002, 0x4C3603, 0xFFFFFFFF, 0x130C003, 0xFFFFFFFF, 0x403490,
+    0xFFFFFFFF, 0x12E1448, 0xFFFFFFFF, 0x64C0C0, 0x49618, 0x4942C0, 0xFFFFFFFF, 0x9B649, 0x48C0248, 0xFFFFFFFF, 0x4905C, 0xFFFFFFFF,
+    0x251898, 0x8944B, 0xC848, 0x1310649, 0xFFFFFFFF, 0x3311600, 0x2512DA, 0x12504D9, 0x2916C9, 0x3061600, 0x200A688, 0xFFFFFFFF,
+    0x11B2C0, 0xFFFFFFFF, 0x210904C, 0x524000, 0x84830A, 0x6814A0, 0x32912C8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x124B200, 0x1301498, 0xFFFFFFFF, 0x34C92C0, 0x2C864C, 0xFFFFFFFF, 0xFFFFFFFF, 0x2248860, 0xFFFFFFFF, 0x128C600, 0x3609649, 0x2488CB,
+    0x30B000, 0xFFFFFFFF, 0xD24C2, 0xD921B, 0x424A840, 0x253203, 0x6212D0, 0x34900D0, 0x24D9600, 0x20000D8, 0x18400DA, 0x24A908,
+    0x311218, 0xC12D2, 0xDB258, 0xFFFFFFFF, 0xFFFFFFFF, 0x24812C0, 0xFFFFFFFF, 0x32D2003, 0xC904C, 0xFFFFFFFF, 0x148B400, 0x12D3640,
+    0xFFFFFFFF, 0xC3311, 0xFFFFFFFF, 0x26C0018, 0x30A1203, 0x1240694, 0x130024B, 0xFFFFFFFF, 0x3603248, 0xFFFFFFFF, 0x4300403, 0x12400D8,
+    0x1302848, 0xFFFFFFFF, 0x36000CC, 0x4240293, 0x36C1250, 0x609263, 0x6C20C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x80248, 0x364C,
+    0xFFFFFFFF, 0x128A840, 0x499603, 0x2E0248, 0x3018013, 0x4C3, 0x6C9880, 0xFFFFFFFF, 0x59260, 0x184148A, 0x609710, 0xFFFFFFFF,
+    0x6C92C0, 0xFFFFFFFF, 0x12A1098, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x291262, 0x2612449, 0x49659, 0x30026CA, 0x60341B, 0xFFFFFFFF,
+    0x24213, 0x34C00C0, 0x84948A, 0x20C9818, 0x3292448, 0xFFFFFFFF, 0x260125B, 0x522002, 0x40A6D1, 0x251319, 0x61B24A, 0x3059308,
+    0x1318400, 0x34CA440, 0x41244C, 0xFFFFFFFF, 0x1249200, 0x1148B, 0xFFFFFFFF, 0xFFFFFFFF, 0x36C2049, 0x248464, 0x12434C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x52891, 0xFFFFFFFF, 0xFFFFFFFF, 0xA3300, 0x1090B, 0x2001258, 0xFFFFFFFF, 0x3003013, 0x251202, 0x4649249, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3263010, 0x253800, 0x60A500, 0x22DA, 0xFFFFFFFF, 0x20006D8, 0x3002493, 0x68C2C0, 0x2499250, 0x1A6C3, 0x2254200,
+    0xFFFFFFFF, 0x4A001B, 0x30C04A0, 0x311259, 0x1A10C, 0xC1313, 0xFFFFFFFF, 0x713240, 0x2481300, 0x61B018, 0x294098, 0xD9700,
+    0xFFFFFFFF, 0x25030C0, 0x30C9249, 0xFFFFFFFF, 0x24489, 0xFFFFFFFF, 0x848112, 0x3618059, 0xFFFFFFFF, 0x6C00C3, 0xFFFFFFFF, 0x660003,
+    0x3603289, 0x11221A, 0x6980C0, 0xFFFFFFFF, 0x510061, 0x2260000, 0x5368A, 0x3893000, 0x1719080, 0x2661, 0x32C8603, 0xFFFFFFFF,
+    0x3001240, 0x24B289, 0xFFFFFFFF, 0x3843003, 0xFFFFFFFF, 0x3261249, 0x3003843, 0x1126C0, 0xFFFFFFFF, 0x14DA210, 0x32E3000, 0xDA04C,
+    0xFFFFFFFF, 0x69124B, 0xFFFFFFFF, 0x6D0049, 0xFFFFFFFF, 0xFFFFFFFF, 0x68061B, 0x30C1299, 0x284B003, 0x10000, 0x34C06C0, 0x49698,
+    0x10924A, 0xFFFFFFFF, 0x6C3003, 0x29A603, 0xE124B, 0x5C308, 0x64648, 0x12404A0, 0xFFFFFFFF, 0x6D30C0, 0xD0618, 0x4240660,
+    0xFFFFFFFF, 0x1249802, 0x2062488, 0x3242483, 0x325C400, 0x5345A, 0xFFFFFFFF, 0x1689018, 0xFFFFFFFF, 0x30610C9, 0xFFFFFFFF, 0x40185B,
+    0x12C0109, 0x1243509, 0x4522C3, 0x64A488, 0xFFFFFFFF, 0x4012A1, 0x251803, 0x2DA, 0x320449, 0xFFFFFFFF, 0x2C86C0, 0x46A1000,
+    0xFFFFFFFF, 0x30A092, 0x1309298, 0xD9850, 0x2C810C, 0x3013109, 0xFFFFFFFF, 0xFFFFFFFF, 0x1810C, 0xD9299, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xC1910, 0xE1018, 0xFFFFFFFF, 0x4889000, 0x25B000, 0x3049061, 0xCC24B, 0xFFFFFFFF, 0x52200, 0x301A308,
+    0x1250320, 0x210C018, 0xFFFFFFFF, 0x490449, 0xFFFFFFFF, 0xFFFFFFFF, 0x12580A2, 0x125C242, 0x3683049, 0x2000600, 0x3891002, 0x24985A,
+    0x663, 0xFFFFFFFF, 0x64A258, 0x3600708, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3001842, 0x4D9010,
+    0xFFFFFFFF, 0x291403, 0xD804B, 0x5B44B, 0x248719, 0xFFFFFFFF, 0x36C9, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24C2D8, 0x30C0858,
+    0x3109, 0xFFFFFFFF, 0xFFFFFFFF, 0x300070B, 0xFFFFFFFF, 0xFFFFFFFF, 0x2061003, 0xC945B, 0xFFFFFFFF, 0x148A24B, 0x8330B, 0x619849,
+    0xFFFFFFFF, 0x1311289, 0x1643049, 0x12C1840, 0x248600, 0xFFFFFFFF, 0x24298, 0xFFFFFFFF, 0xFFFFFFFF, 0x3012800, 0x1853600, 0x24A1280,
+    0x1300098, 0x32414A0, 0x3603098, 0x640C9, 0x1853049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3094003, 0x3013260, 0x1249283, 0x1258318,
+    0xC3602, 0xFFFFFFFF, 0xFFFFFFFF, 0x2482018, 0x30809B, 0x3492, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4D8260, 0xFFFFFFFF,
+    0x65224B, 0xFFFFFFFF, 0x4196D0, 0x30C0080, 0x2910, 0xFFFFFFFF, 0x509000, 0x403320, 0x3320080, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x4849210, 0x4C063, 0x3449049, 0x301830A, 0xA224B, 0x12413, 0xFFFFFFFF, 0x1299600, 0x36C0418, 0x204B483, 0xC6D8, 0x34A0248,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1491218, 0x24896C0, 0xFFFFFFFF, 0x32DA400, 0xFFFFFFFF, 0x3609600, 0x12C04D9, 0xFFFFFFFF, 0x13008C8, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6A2, 0x130B203, 0xC0258, 0x49921A, 0x42592C0, 0x2661049, 0xFFFFFFFF, 0xFFFFFFFF, 0xD8648,
+    0x2C84D9, 0x30002A4, 0x4C4840, 0xFFFFFFFF, 0x184D9, 0xFFFFFFFF, 0x4046D0, 0x24B318, 0x12D2000, 0x30830A, 0xFFFFFFFF, 0x28800D8,
+    0x49C280, 0x20C00DB, 0x124064C, 0xFFFFFFFF, 0x461049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1240083, 0x4496C3, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2DA013, 0x18492C0, 0x619888, 0x4292280, 0xFFFFFFFF, 0x4241258, 0xFFFFFFFF, 0xFFFFFFFF, 0x621603, 0x6C3083, 0x64904B, 0x3092002,
+    0xFFFFFFFF, 0x248080, 0xFFFFFFFF, 0x1261200, 0xFFFFFFFF, 0x492291, 0x8512C9, 0x329A280, 0x1249880, 0xFFFFFFFF, 0xFFFFFFFF, 0x201824B,
+    0x24A0C3, 0x12492CC, 0x308698, 0xFFFFFFFF, 0xFFFFFFFF, 0x49602, 0x3321200, 0x612459, 0x30D8010, 0xFFFFFFFF, 0x652848, 0x40C21B,
+    0x24804C0, 0x30C3243, 0x1253640, 0x293248, 0x2889203, 0xFFFFFFFF, 0x12CA500, 0xFFFFFFFF, 0x44C04C, 0x3860400, 0xFFFFFFFF, 0x2291092,
+    0xFFFFFFFF, 0x619658, 0x1302003, 0xFFFFFFFF, 0x1640291, 0x7112C0, 0x25B642, 0x1259261, 0x1891200, 0x65C049, 0x26C1258, 0x165B248,
+    0x911202, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x260248, 0xFFFFFFFF, 0x6D80D0, 0x32580C3, 0x360C202, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2248291, 0x3400848, 0xFFFFFFFF, 0xFFFFFFFF, 0x2483403, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x492500, 0x3003461, 0x249310,
+    0x311202, 0xFFFFFFFF, 0xFFFFFFFF, 0xDB248, 0xFFFFFFFF, 0x860018, 0x6100C0, 0x1B0D8, 0xD80CC, 0xFFFFFFFF, 0x1842109, 0x184A440,
+    0x38C8003, 0xFFFFFFFF, 0xFFFFFFFF, 0x30830C0, 0x3618002, 0x1240683, 0x3049461, 0xFFFFFFFF, 0xDA109, 0xFFFFFFFF, 0x300B682, 0x12416A1,
+    0x13, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3318000, 0x12426C0, 0x18400, 0x649649, 0x490291, 0x3092600, 0x24B240, 0xFFFFFFFF,
+    0x6C0510, 0x2880000, 0x1289258, 0xFFFFFFFF, 0x248061A, 0x309250, 0x1A443, 0xFFFFFFFF, 0x26C9249, 0x858061, 0xFFFFFFFF, 0x185B400,
+    0xFFFFFFFF, 0x128B291, 0x12A1083, 0xFFFFFFFF, 0x252440, 0x1250061, 0x1888000, 0x3903000, 0x84B013, 0x148861A, 0x30C3840, 0x308119,
+    0x24200, 0x2A1308, 0x12A30C0, 0x20C9803, 0x1243002, 0xFFFFFFFF, 0x2601240, 0x3603003, 0xFFFFFFFF, 0xFFFFFFFF, 0x12D8000, 0x1302600,
+    0xCA889, 0xFFFFFFFF, 0x3098109, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3122200, 0xFFFFFFFF, 0x80003, 0x308003, 0x125A880,
+    0x24C90D0, 0xFFFFFFFF, 0x2E0000, 0x911248, 0x3649013, 0xFFFFFFFF, 0xFFFFFFFF, 0x661248, 0x1841240, 0x1858610, 0xFFFFFFFF, 0x18660,
+    0xD9800, 0x490509, 0xFFFFFFFF, 0xFFFFFFFF, 0x14D10D0, 0x3708049, 0x20006C0, 0x289A200, 0x18406C2, 0x89803, 0x311802, 0x4481840,
+    0xFFFFFFFF, 0x849242, 0x24802C8, 0x982DA, 0x4309, 0x4481289, 0xDB289, 0x3001900, 0x300B21B, 0x4D90D0, 0x94C8, 0x294083,
+    0x3251280, 0x4253049, 0xFFFFFFFF, 0x30D82C8, 0x464248, 0xFFFFFFFF, 0xFFFFFFFF, 0x10A488, 0x12406C3, 0x6C1689, 0xFFFFFFFF, 0x29B840,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x69C240, 0xFFFFFFFF, 0xFFFFFFFF, 0xC9518, 0x2CB000, 0x24A260, 0x609298, 0xFFFFFFFF, 0x48D1000, 0x2880600,
+    0xFFFFFFFF, 0x2486C3, 0x3649840, 0x12708, 0xFFFFFFFF, 0x1289291, 0x2320600, 0x2496E0, 0x262092, 0xFFFFFFFF, 0xC168C, 0x341B600,
+    0x59294, 0x251460, 0x151A, 0x1888600, 0xFFFFFFFF, 0x3251618, 0x2D4800, 0xFFFFFFFF, 0x4DA480, 0x9294, 0x24802, 0x49694,
+    0xFFFFFFFF, 0x30C9003, 0xFFFFFFFF, 0x3049848, 0x2601843, 0x3603600, 0x10A258, 0x6002CB, 0x890600, 0xFFFFFFFF, 0x659061, 0xE2258,
+    0x300B491, 0x3021280, 0xFFFFFFFF, 0x5090C3, 0x2891000, 0x53443, 0xFFFFFFFF, 0x60230B, 0xFFFFFFFF, 0xFFFFFFFF, 0x128961A, 0x3449109,
+    0x3010092, 0x30D2800, 0x124C2, 0xFFFFFFFF, 0x2000260, 0x528C2, 0x1840262, 0x30D2249, 0x1301508, 0xFFFFFFFF, 0x661289, 0x59064,
+    0x609508, 0x614400, 0xFFFFFFFF, 0xD8262, 0x2018092, 0x30014A0, 0xFFFFFFFF, 0xFFFFFFFF, 0x1C292, 0x128C0C2, 0x42492C9, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x1313600, 0xE1000, 0x5C0C3, 0xFFFFFFFF, 0x124025B, 0xFFFFFFFF, 0x30596C0, 0x3254440, 0x4240400, 0xFFFFFFFF,
+    0x28CC000, 0x2062243, 0xCA698, 0xFFFFFFFF, 0x848708, 0xFFFFFFFF, 0xFFFFFFFF, 0x304B092, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24825B,
+    0x12432C8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2061109, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x361A0C0, 0x6A1448,
+    0x12494A1, 0xFFFFFFFF, 0xFFFFFFFF, 0x4004DC, 0xFFFFFFFF, 0xFFFFFFFF, 0x3493080, 0xFFFFFFFF, 0x209B200, 0x2013700, 0x2E0291, 0x2483258,
+    0x9C840, 0xFFFFFFFF, 0x4A242, 0xFFFFFFFF, 0xFFFFFFFF, 0x6104D9, 0x9892, 0xCC003, 0x48400D0, 0xFFFFFFFF, 0x2524C3, 0x30C9600,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x148B258, 0x6008C8, 0xFFFFFFFF, 0x216C0, 0x3680248, 0xFFFFFFFF, 0x425801A, 0x60030B, 0x41B,
+    0x30492C8, 0xFFFFFFFF, 0x52460, 0x20C92C0, 0x8A518, 0xFFFFFFFF, 0x3052618, 0x3249200, 0x400863, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2603308, 0xFFFFFFFF, 0x326001A, 0x2E0649, 0xFFFFFFFF, 0xFFFFFFFF, 0x6E1049, 0x1321210, 0x52908, 0xFFFFFFFF, 0xFFFFFFFF, 0x44A2,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x4900010, 0x301A443, 0x30DA000, 0x2692003, 0x3409203, 0xFFFFFFFF, 0x30014E1, 0x36D0000, 0xFFFFFFFF, 0xA68A,
+    0xFFFFFFFF, 0x3252449, 0x8482A1, 0x12D3250, 0x124341B, 0x21493, 0xFFFFFFFF, 0xFFFFFFFF, 0x1520018, 0x248B249, 0x30E1200, 0x509490,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12412C0, 0xFFFFFFFF, 0x14449, 0xFFFFFFFF, 0x361B240, 0x425B400, 0x60A450, 0xFFFFFFFF, 0x1801B,
+    0x2621200, 0x63308, 0xFFFFFFFF, 0x692, 0x6C42C0, 0x42C00C0, 0x2000064, 0x2014880, 0x1841658, 0x4D801B, 0x125A109, 0x5100D8,
+    0x8DA002, 0xFFFFFFFF, 0xFFFFFFFF, 0x92509, 0x1B083, 0xFFFFFFFF, 0xFFFFFFFF, 0x4030D8, 0x11C600, 0x124A500, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x49262, 0x418908, 0x254649, 0x19000C9, 0x6D3248, 0xFFFFFFFF, 0x23200C0, 0x1489258, 0x6130D8, 0x1253291, 0x6D8403, 0x3600063,
+    0x61094, 0x12C084B, 0x204C260, 0x1250121, 0xFFFFFFFF, 0xFFFFFFFF, 0x44C9248, 0x12C0291, 0xFFFFFFFF, 0x452448, 0xCB4C9, 0xFFFFFFFF,
+    0x425804B, 0xFFFFFFFF, 0x461, 0x13692, 0x2601303, 0xFFFFFFFF, 0xFFFFFFFF, 0x12D80C0, 0xFFFFFFFF, 0x320018, 0x3112210, 0x534C0,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x30B243, 0x18291, 0xD26C8, 0x3259300, 0xFFFFFFFF, 0x2482049, 0x89A440, 0x4483000, 0x12890C0, 0x5C260,
+    0x689309, 0x826C8, 0xFFFFFFFF, 0xC9813, 0x2001303, 0x30030C0, 0x861800, 0x30C4242, 0x1254648, 0xFFFFFFFF, 0xFFFFFFFF, 0x148A049,
+    0x861250, 0x61C200, 0x44A48B, 0x3061018, 0xE4200, 0x109083, 0x4888049, 0x38C9240, 0x3049691, 0xFFFFFFFF, 0x24E3000, 0x3619240,
+    0x600119, 0xFFFFFFFF, 0x6C2880, 0xFFFFFFFF, 0x492049, 0xFFFFFFFF, 0x2594D1, 0x12586D0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C30C0,
+    0x1243900, 0x3840, 0x18064, 0xFFFFFFFF, 0x26CB002, 0x2498C0, 0x4D8618, 0x6D3, 0xFFFFFFFF, 0x324B059, 0x300344C, 0x249302,
+    0x30A482, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2CB0C3, 0x24A320, 0x44924B, 0x1B0C2, 0xFFFFFFFF, 0xDC250, 0x30028C9, 0x81918,
+    0xA2600, 0x224C300, 0x3240603, 0x1294249, 0x84C250, 0x603063, 0xFFFFFFFF, 0x14E1018, 0x3109010, 0x3600660, 0x165B000, 0x609803,
+    0x3110D8, 0x6DB000, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x122242, 0x1254300, 0x1302260, 0xD1243, 0x424128B, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x304C4C0, 0xFFFFFFFF, 0x42C3049, 0xFFFFFFFF, 0xFFFFFFFF, 0x124B44B, 0x136D8, 0xFFFFFFFF, 0x3249849, 0x300065C, 0xFFFFFFFF, 0x30B840,
+    0x32CB600, 0xFFFFFFFF, 0xDB000, 0x20C3603, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xC2092, 0x3260098, 0x2E3280, 0x253448, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xDA480, 0x49061, 0x148804B, 0x89463, 0xC84B, 0x2264B, 0xFFFFFFFF, 0xFFFFFFFF, 0x61461, 0x2512D8, 0x61C800,
+    0xC9291, 0xFFFFFFFF, 0xFFFFFFFF, 0x10C243, 0xFFFFFFFF, 0xA70B, 0xFFFFFFFF, 0x49004C, 0x30A1448, 0x30092E1, 0xFFFFFFFF, 0x6C02CB,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x644C0, 0xFFFFFFFF, 0x205224C, 0xFFFFFFFF, 0xFFFFFFFF, 0x12990C0, 0xFFFFFFFF, 0x113440, 0xFFFFFFFF, 0x10320,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2488E0, 0x80490, 0x30D0092, 0xFFFFFFFF, 0x6492E0, 0x3261448, 0x20C0260, 0x30C2018, 0x1252418, 0xFFFFFFFF,
+    0x200428C, 0xFFFFFFFF, 0x301A848, 0x60001A, 0xFFFFFFFF, 0x1B6C2, 0x2009448, 0x3000311, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1888260,
+    0x4C461, 0x681840, 0x10C010, 0x25A418, 0xA4D2, 0x651508, 0x4A8C3, 0x4A3049, 0x14A2248, 0x1861280, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x12D40C0, 0x890260, 0xFFFFFFFF, 0xD4400, 0x661002, 0x2DA080, 0x609283, 0x124944B, 0x50A300, 0xFFFFFFFF,
+    0x42412C0, 0x2512010, 0x36D8080, 0x308260, 0x1300708, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xC0094, 0x324C448,
+    0x300325B, 0x25144B, 0x98092, 0xFFFFFFFF, 0x1B490, 0xFFFFFFFF, 0x30000D8, 0x4192D2, 0x30C2848, 0x130A4C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x30C2291, 0xFFFFFFFF, 0x1889049, 0x2600248, 0x3253640, 0x300A45A, 0x258649, 0x4640018, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x614A0, 0xFFFFFFFF, 0x891600, 0x34092C3, 0xFFFFFFFF, 0x3258248, 0x412461, 0x92248, 0x6C08C8, 0xFFFFFFFF, 0xE4280, 0x49009B,
+    0x300A900, 0x124B818, 0x124C0, 0x1921B, 0x128904B, 0x854280, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3249658, 0x3309200,
+    0x251218, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x20C0860, 0x301B418, 0x60A510, 0x196D2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x6A20C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x34C1488, 0xFFFFFFFF, 0x409494, 0x600080, 0xFFFFFFFF, 0x4488013, 0xC9661, 0x4B480, 0x344C600,
+    0x1242848, 0xFFFFFFFF, 0xFFFFFFFF, 0x360125A, 0x4C4A0, 0x301B300, 0x30C2500, 0x125C203, 0xFFFFFFFF, 0x4A900, 0xFFFFFFFF, 0x24824A,
+    0x911600, 0x3490013, 0xFFFFFFFF, 0x661600, 0x4259250, 0x301244B, 0x124C603, 0xFFFFFFFF, 0xFFFFFFFF, 0x42402C8, 0x40364C, 0xFFFFFFFF,
+    0x264218, 0x224B248, 0xFFFFFFFF, 0x4004D9, 0x300125B, 0xFFFFFFFF, 0x20C0, 0x19488, 0xFFFFFFFF, 0x308301B, 0x3011318, 0x2480683,
+    0x30E1, 0x4480061, 0xFFFFFFFF, 0x2009818, 0x24800C9, 0xFFFFFFFF, 0x1253248, 0x1B4D1, 0xDB083, 0xFFFFFFFF, 0x1849249, 0x204964C,
+    0x1001B, 0xCA450, 0xFFFFFFFF, 0x148B243, 0x3018510, 0x248A442, 0xB8C0, 0x2600291, 0x4A6D2, 0x14880C0, 0x12C1258, 0x1244658,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x52448, 0x30A2049, 0x601302, 0x60C202, 0x6C9202, 0xFFFFFFFF, 0x4718000, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C34C0,
+    0x3493400, 0x2000848, 0x4900C0, 0x24C658, 0xFFFFFFFF, 0x1261649, 0xFFFFFFFF, 0x34C0003, 0x26CC200, 0xFFFFFFFF, 0x251818, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4840449, 0x59092, 0x11B800, 0x4D9258, 0x964C, 0x305924B, 0xD8293, 0xFFFFFFFF, 0xFFFFFFFF, 0x364B0C0, 0x19700,
+    0x2600618, 0xFFFFFFFF, 0x3009249, 0x600680, 0x1243403, 0xFFFFFFFF, 0x340C800, 0x4A4A0, 0xFFFFFFFF, 0x6000C3, 0x2061248, 0xFFFFFFFF,
+    0x18A1240, 0x4243003, 0x309B0C0, 0x6026C3, 0x44930B, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C8003, 0x24884B, 0x9204B, 0x621800, 0x26030C0,
+    0x1289418, 0x400064, 0x184061A, 0xFFFFFFFF, 0xFFFFFFFF, 0x324010C, 0x324B000, 0xFFFFFFFF, 0x184005C, 0x30D3600, 0x425A, 0xC1250,
+    0xFFFFFFFF, 0x12A124A, 0x2481242, 0x610064, 0x891300, 0x291418, 0xD9640, 0x5B459, 0x41A480, 0xFFFFFFFF, 0x224810C, 0xC06D0,
+    0xFFFFFFFF, 0x2D124C, 0x301C249, 0x6C0002, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x61618, 0x698000, 0x4DC080, 0x1061B, 0xFFFFFFFF,
+    0x36106C0, 0x62658, 0x602490, 0x4490D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x84B0D0, 0x4258602, 0xFFFFFFFF, 0xA2490, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x40C309, 0x248059, 0x89520, 0x6C9800, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000603, 0x25810C, 0x263003, 0x3052649, 0x64C648, 0x3609848,
+    0x300004B, 0xFFFFFFFF, 0x8910D0, 0x31A2C0, 0x128C240, 0xFFFFFFFF, 0xFFFFFFFF, 0x12C4300, 0x30D1289, 0xC04A3, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4C2483, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x309B200, 0x418109, 0x25129B, 0xC249, 0x1B2E0, 0xFFFFFFFF, 0x2CC300,
+    0x3009849, 0x61804C, 0xFFFFFFFF, 0x2910CC, 0xFFFFFFFF, 0x44C9000, 0x12C004C, 0x2849289, 0xB6CB, 0xFFFFFFFF, 0x4A4E1, 0x5281A,
+    0xFFFFFFFF, 0x1241889, 0x31804C, 0xFFFFFFFF, 0x4243049, 0xFFFFFFFF, 0x60945B, 0x92649, 0xFFFFFFFF, 0x26036C0, 0x400661, 0x3013049,
+    0x60A489, 0xFFFFFFFF, 0x18049, 0xFFFFFFFF, 0x2013888, 0xFFFFFFFF, 0x26224B, 0x1261458, 0x3400260, 0xFFFFFFFF, 0x5C01B, 0x1840092,
+    0x2481840, 0x4299, 0x3059618, 0x24D9003, 0xFFFFFFFF, 0x301A248, 0x1902248, 0x9458, 0x3418092, 0x4984B, 0x403109, 0xFFFFFFFF,
+    0x2711000, 0x6C0600, 0x21849, 0xFFFFFFFF, 0x20C16D0, 0x600490, 0x2061618, 0x3848258, 0x2129B, 0x2889448, 0xFFFFFFFF, 0x25150A,
+    0x4496D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x122250, 0xFFFFFFFF, 0xFFFFFFFF, 0xCA4D8, 0xFFFFFFFF, 0x248659, 0x12420DB,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x32404D9, 0x3092018, 0xFFFFFFFF, 0x263602, 0x61A308, 0x513049, 0xFFFFFFFF, 0x26C9218, 0x721000, 0x1249898,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3258308, 0x12A1059, 0x149A800, 0x12492D8, 0x22484D9, 0xC364B, 0x324A291, 0xFFFFFFFF, 0x4309049, 0xFFFFFFFF,
+    0x349B200, 0xFFFFFFFF, 0xFFFFFFFF, 0x1840311, 0x3019498, 0xFFFFFFFF, 0xFFFFFFFF, 0x2889218, 0xFFFFFFFF, 0x6144C, 0x204C618, 0xFFFFFFFF,
+    0x3712000, 0xC9280, 0x16524C0, 0x12C0649, 0x4310248, 0x452800, 0x29110B, 0xCA2A1, 0x848311, 0x30092C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xCB2C3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x34D1600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x18648,
+    0x649890, 0x3112003, 0x403260, 0xFFFFFFFF, 0x920D0, 0x12910, 0x3243308, 0xFFFFFFFF, 0x20C0248, 0x301824B, 0x168B480, 0x48C0018,
+    0xFFFFFFFF, 0x2320248, 0x18400CC, 0x24802A1, 0x42D4, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1712400, 0x1918080, 0x32D2000,
+    0x3252840, 0x200A45B, 0x300C213, 0x30C9218, 0xFFFFFFFF, 0x24448, 0xFFFFFFFF, 0x8E0248, 0xFFFFFFFF, 0x1240698, 0x6C0080, 0x260148B,
+    0xFFFFFFFF, 0x409321, 0x10B480, 0x12400DB, 0x1324B, 0xFFFFFFFF, 0xE3480, 0xFFFFFFFF, 0xFFFFFFFF, 0x12426D8, 0x18418, 0xFFFFFFFF,
+    0x3303248, 0xFFFFFFFF, 0xFFFFFFFF, 0x3649, 0xFFFFFFFF, 0x2880018, 0x3308400, 0x418860, 0x262061, 0xFFFFFFFF, 0x1A45B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1120C3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2009203, 0x3260680, 0xFFFFFFFF, 0x6A12C0, 0x2503, 0x1888003, 0x16D0248,
+    0x32600C9, 0x60085B, 0x842D2, 0x19321, 0x24218, 0x49098, 0x300210C, 0x184B249, 0x9B0C3, 0x304925B, 0xFFFFFFFF, 0x3603018,
+    0x64049, 0x6012C0, 0x89001B, 0xFFFFFFFF, 0xC92C0, 0xFFFFFFFF, 0x300C489, 0x90B080, 0x1249202, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C0291,
+    0x229A448, 0x8001B, 0x2854200, 0x36800C0, 0xFFFFFFFF, 0x4243680, 0x24948A, 0x30D2218, 0x622449, 0xFFFFFFFF, 0x3249643, 0x403860,
+    0x12CA458, 0x6094E0, 0x289B, 0x1B24A, 0xD9818, 0x20C084B, 0x3320002, 0x92112, 0xFFFFFFFF, 0xFFFFFFFF, 0x12894D8, 0x3002498,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3709080, 0xC18D1, 0xFFFFFFFF, 0x84925A, 0x119092, 0xFFFFFFFF, 0x22449, 0x32D2600, 0xFFFFFFFF, 0x6125B,
+    0xFFFFFFFF, 0x61B01A, 0xFFFFFFFF, 0xFFFFFFFF, 0x26C0618, 0x680291, 0x30C9248, 0x6C0683, 0x1300848, 0x16400C0, 0x4930B, 0x4259800,
+    0x600513, 0x304C080, 0xFFFFFFFF, 0xFFFFFFFF, 0x1489309, 0x6980C3, 0x25C488, 0x61, 0x2609249, 0xFFFFFFFF, 0xFFFFFFFF, 0x259300,
+    0x204C308, 0x125B0C9, 0x6480C0, 0xFFFFFFFF, 0x3001242, 0x2486DA, 0x1900600, 0xFFFFFFFF, 0x128A888, 0x49C202, 0x330B000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xC00C3, 0xFFFFFFFF, 0xFFFFFFFF, 0x30006C9, 0x2630C9, 0x9860, 0x1888618, 0xFFFFFFFF, 0xFFFFFFFF, 0x300010B, 0x1242600,
+    0xA889, 0x292888, 0xFFFFFFFF, 0x3002709, 0xFFFFFFFF, 0xFFFFFFFF, 0x1300613, 0x21692, 0x490D8, 0x308C800, 0x248002, 0x12404A3,
+    0x890618, 0xD061B, 0x3603059, 0x308C249, 0x121080, 0x1249803, 0xFFFFFFFF, 0x1318449, 0x4244240, 0x412492, 0x80618, 0x308618,
+    0x21090C0, 0xFFFFFFFF, 0x494242, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x19249, 0x64A48A, 0x2CB848, 0x3003613, 0xFFFFFFFF, 0x2DC,
+    0x1A263, 0x324C242, 0xFFFFFFFF, 0x12CA489, 0x614418, 0x1253000, 0x1B28C, 0x6622C0, 0x3098049, 0x2482482, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2254800, 0xFFFFFFFF, 0x30024D9, 0xFFFFFFFF, 0xFFFFFFFF, 0x1252483, 0xFFFFFFFF, 0x4A488, 0xFFFFFFFF, 0x604242, 0x4D8109, 0xFFFFFFFF,
+    0x2248B, 0xFFFFFFFF, 0xFFFFFFFF, 0x252708, 0x30C9848, 0x125C800, 0xFFFFFFFF, 0x493000, 0xFFFFFFFF, 0xFFFFFFFF, 0x6C06C2, 0xFFFFFFFF,
+    0x2000603, 0x3301840, 0x2DC248, 0x69B280, 0xFFFFFFFF, 0x13002CB, 0x2609849, 0x492480, 0xFFFFFFFF, 0xFFFFFFFF, 0x4240, 0x1B600,
+    0xFFFFFFFF, 0x3001843, 0x4C0661, 0x264249, 0x6CA488, 0x4491280, 0xD804C, 0x12A2250, 0x4C4243, 0x124A4D8, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x34C0260, 0x848049, 0xFFFFFFFF, 0x124061B, 0xFFFFFFFF, 0xFFFFFFFF, 0x4A258, 0x84A649, 0x3293600, 0x2061000, 0x2692248, 0xFFFFFFFF,
+    0x30824C9, 0x62640, 0x3293049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6008D9, 0x4640649, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x325A410, 0x12C1289, 0x60B21B, 0x1300092, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x124984B, 0x14D4400, 0xFFFFFFFF, 0x2092248,
+    0x12A1003, 0x24B660, 0x3648649, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3623200, 0xFFFFFFFF, 0x612418, 0x19289, 0xC3049, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x30C064B, 0x124B2C3, 0xFFFFFFFF, 0x1322240, 0xFFFFFFFF, 0x201C840, 0x30C00CC, 0xFFFFFFFF, 0x1B2CB, 0xFFFFFFFF, 0x4B049,
+    0x148A01B, 0xFFFFFFFF, 0xA69B, 0x2600649, 0x42D2400, 0x2021448, 0x862248, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4A0092,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x210C600, 0x14E2240, 0xFFFFFFFF, 0x5224C, 0x20CA688, 0x3659049, 0x14D1610, 0x4658248, 0x493049, 0x54849,
+    0x10C0C0, 0xFFFFFFFF, 0x1303488, 0x128C000, 0x26C8418, 0xFFFFFFFF, 0xFFFFFFFF, 0x3262, 0xFFFFFFFF, 0x260C448, 0x3093250, 0x2492D8,
+    0x248024B, 0x4289, 0x3059600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30B488, 0x294000, 0xFFFFFFFF, 0xFFFFFFFF, 0x2482291,
+    0x2498080, 0x30D8248, 0x32C80D8, 0x4A858, 0x20C00D8, 0x30180D8, 0x603010, 0x6C0000, 0xCC618, 0x4A299, 0xFFFFFFFF, 0x601498,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2618248, 0x62689, 0x14A0080, 0x61C448, 0x4658018, 0xFFFFFFFF, 0xFFFFFFFF, 0x6816D0, 0xFFFFFFFF,
+    0x6C3080, 0x242D0, 0xFFFFFFFF, 0x3092003, 0xFFFFFFFF, 0xFFFFFFFF, 0x1261210, 0x3400018, 0xCC500, 0xFFFFFFFF, 0x36C00C9, 0xFFFFFFFF,
+    0x124C443, 0xFFFFFFFF, 0x4840010, 0x42442C0, 0x264C049, 0x308691, 0x9210, 0xFFFFFFFF, 0x49603, 0x361001B, 0xFFFFFFFF, 0x30D8013,
+    0x34DB, 0x4483018, 0x26C80D0, 0x40C218, 0x60024A, 0x1253642, 0x3848010, 0x32D1200, 0x3600400, 0x30030CC, 0x2512C3, 0x204C603,
+    0x23643, 0x3691248, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xA2848, 0x1889488, 0x16D00D0, 0x49001B, 0x24841B, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4700003, 0xFFFFFFFF, 0xFFFFFFFF, 0x204B4C9, 0xFFFFFFFF, 0xC9710, 0x32412A1, 0xFFFFFFFF, 0x41801B, 0x124C210, 0x305244A,
+    0x3064080, 0x32580C0, 0x2018018, 0x20D2449, 0x12E1203, 0x899203, 0xC085B, 0x128C049, 0xFFFFFFFF, 0x248084A, 0xFFFFFFFF, 0x48C0003,
+    0x652618, 0x3262440, 0x18400C9, 0x254210, 0x4289080, 0xC603, 0xDB24A, 0xFFFFFFFF, 0x30002CB, 0x12D2610, 0x1250294, 0x1B0DA,
+    0xFFFFFFFF, 0x200A440, 0x300C200, 0x24980C0, 0x1258010, 0xFFFFFFFF, 0xFFFFFFFF, 0x4A899, 0x3018119, 0x3291083, 0x6C1640, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x165B018, 0x300B680, 0x609810, 0x125B602, 0xFFFFFFFF, 0x2009309, 0x2291308, 0x14A00C0, 0x26001A, 0x891258, 0xFFFFFFFF,
+    0x4242880, 0x40301B, 0xFFFFFFFF, 0x621649, 0x32C8003, 0x2880003, 0xFFFFFFFF, 0x44D1010, 0x81258, 0x4289400, 0xFFFFFFFF, 0x4840610,
+    0x12A1648, 0x18D8000, 0x301A600, 0x12498C2, 0xFFFFFFFF, 0xDB018, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C1253, 0x1902049, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x84B010, 0x908000, 0x600848, 0xFFFFFFFF, 0x24202, 0x2889800, 0x1488059, 0x2480509, 0x30C3289, 0xFFFFFFFF, 0xFFFFFFFF, 0x3603002,
+    0xFFFFFFFF, 0x258061, 0xFFFFFFFF, 0x304B848, 0xFFFFFFFF, 0xFFFFFFFF, 0x148B680, 0x12D22C8, 0x1242493, 0xFFFFFFFF, 0x3240891, 0x3303000,
+    0x1090DA, 0x24B010, 0x6C18C0, 0x260010C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x263400, 0x6C1302, 0xFFFFFFFF, 0xFFFFFFFF, 0x66124A,
+    0xFFFFFFFF, 0x1249690, 0x210C0C0, 0xFFFFFFFF, 0x2261240, 0xFFFFFFFF, 0xFFFFFFFF, 0x611258, 0xFFFFFFFF, 0x291003, 0xFFFFFFFF, 0x3002480,
+    0x254810, 0x613848, 0x32E0, 0xC02DC, 0xDA260, 0xFFFFFFFF, 0x184010B, 0x42890C2, 0xFFFFFFFF, 0x1313003, 0x2009463, 0x84A260,
+    0x4310600, 0x1258600, 0x30590C3, 0x3061400, 0x8486C9, 0x4250490, 0x2049294, 0x1243840, 0xFFFFFFFF, 0xFFFFFFFF, 0x848109, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x613, 0x1301850, 0xFFFFFFFF, 0xFFFFFFFF, 0x249240, 0x911018, 0x125A092, 0x3409508, 0x490890, 0xFFFFFFFF, 0x17006C0,
+    0x60929B, 0x2248661, 0x1B002, 0xFFFFFFFF, 0x12A2200, 0x1843610, 0x3648260, 0x1270A, 0xFFFFFFFF, 0xFFFFFFFF, 0x70A250, 0xFFFFFFFF,
+    0x613618, 0xFFFFFFFF, 0xC1689, 0xFFFFFFFF, 0xFFFFFFFF, 0x149C400, 0x1250661, 0x1888603, 0x341B049, 0x708109, 0x84B610, 0x832DA,
+    0x30B2C8, 0x24800, 0xFFFFFFFF, 0xFFFFFFFF, 0x1488659, 0x2049061, 0xFFFFFFFF, 0x2600263, 0xFFFFFFFF, 0x490C9, 0x344A240, 0x1240490,
+    0xB2D8, 0xFFFFFFFF, 0xFFFFFFFF, 0x200C292, 0xFFFFFFFF, 0x3021283, 0xFFFFFFFF, 0x5090C0, 0x2891003, 0xFFFFFFFF, 0x602308, 0x308600,
+    0x12582C8, 0xD2648, 0xFFFFFFFF, 0x2021508, 0x248493, 0xFFFFFFFF, 0x6CB218, 0x3248649, 0x528C9, 0x7190C0, 0x1841842, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x52309, 0xFFFFFFFF, 0x691003, 0x28C9, 0xFFFFFFFF, 0x230B049, 0x360C280, 0xFFFFFFFF, 0x4DA250, 0xFFFFFFFF,
+    0xC08D9, 0xD928B, 0x42492D0, 0x109002, 0xFFFFFFFF, 0x4909, 0xFFFFFFFF, 0xFFFFFFFF, 0x64403, 0x600098, 0x1240260, 0x1253490,
+    0xFFFFFFFF, 0x4B490, 0x424041B, 0x10B049, 0x1242860, 0x6C224B, 0x3064000, 0x1508092, 0x84B2C8, 0xFFFFFFFF, 0x619488, 0x4508248,
+    0x26004D9, 0xFFFFFFFF, 0x3618083, 0x249840, 0xFFFFFFFF, 0x13888, 0x2A1000, 0x2CB603, 0x112249, 0x260659, 0xFFFFFFFF, 0x10709,
+    0xFFFFFFFF, 0x424030A, 0xFFFFFFFF, 0x260092, 0xFFFFFFFF, 0x6496C2, 0xD801A, 0x3261800, 0xFFFFFFFF, 0x124A4C3, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x2003092, 0x59891, 0x11C003, 0x3092D8, 0x6D0649, 0xC4289, 0xFFFFFFFF, 0x592DA, 0xFFFFFFFF, 0x124C500, 0xFFFFFFFF, 0x48400C0,
+    0x4C840, 0x3889600, 0x36D0248, 0x19020C0, 0x6C201B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x603488, 0x6C3018, 0xFFFFFFFF, 0x2121600,
+    0xFFFFFFFF, 0x14880E1, 0x3024440, 0x6C1498, 0x13653, 0xFFFFFFFF, 0x4B709, 0xFFFFFFFF, 0x30212C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x26180D8,
+    0x42400D0, 0x1492450, 0x6A1218, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x40188C, 0x68C448, 0x308083, 0x12509, 0xD3688, 0x34C001B,
+    0x3002061, 0x691603, 0x30A, 0xB203, 0xFFFFFFFF, 0xFFFFFFFF, 0x30004C0, 0x1849600, 0x2908, 0xFFFFFFFF, 0xC9210, 0x4C610,
+    0x3009818, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x49490, 0x10904B, 0x60324B, 0x311880, 0xFFFFFFFF, 0xFFFFFFFF, 0x3619203,
+    0x64449, 0x6000D8, 0x10863, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1258691, 0x1318248, 0x26C3248, 0xFFFFFFFF,
+    0x248860, 0xFFFFFFFF, 0x12580D3, 0x64A842, 0xFFFFFFFF, 0xFFFFFFFF, 0x112848, 0xFFFFFFFF, 0xFFFFFFFF, 0x64A289, 0x526D8, 0x3093242,
+    0x185A000, 0xD3, 0x13308, 0xC2848, 0xFFFFFFFF, 0xFFFFFFFF, 0x248125A, 0x12494CB, 0x1B080, 0x4498000, 0x2003692, 0x24B303,
+    0xFFFFFFFF, 0xA450, 0x32C80C3, 0xFFFFFFFF, 0x5C490, 0x862000, 0x1861200, 0x46D0000, 0x21263, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x6D00C0, 0x509260, 0x65B800, 0x683248, 0xFFFFFFFF, 0x609203, 0x9319, 0x4658000, 0x49709, 0x361B010, 0x9080C9,
+    0x4E2280, 0x21709, 0x242C2, 0x3300061, 0x4251300, 0xFFFFFFFF, 0xFFFFFFFF, 0xC0010, 0x32414D1, 0xFFFFFFFF, 0x20C9309, 0x258121,
+    0x3660003, 0x6C9259, 0xFFFFFFFF, 0x2C8294, 0x24B691, 0xFFFFFFFF, 0x308683, 0x130A442, 0x34C0618, 0x40448B, 0x24B0D3, 0x1903010,
+    0x34C0, 0x22494D1, 0x32486D0, 0x40C200, 0xFFFFFFFF, 0x4D8291, 0x30DA600, 0x6D3018, 0xFFFFFFFF, 0x30030C3, 0x601242, 0x428A2C0,
+    0x96A0, 0xFFFFFFFF, 0x2618000, 0x3009859, 0x12C061B, 0xFFFFFFFF, 0x6C084A, 0xFFFFFFFF, 0x49001A, 0x12C0064, 0x12408A1, 0x125924C,
+    0x4643000, 0xFFFFFFFF, 0xFFFFFFFF, 0x1491800, 0x12418C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4243059, 0x149124B, 0x30D0618, 0x125B,
+    0x1302490, 0x2621800, 0xFFFFFFFF, 0x2488A1, 0xFFFFFFFF, 0x3053450, 0x64A888, 0xFFFFFFFF, 0x499802, 0x24C480, 0xFFFFFFFF, 0x323400,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x3000891, 0x249300, 0x1901240, 0x1B683, 0x293000, 0x2321240, 0xFFFFFFFF, 0x602600, 0x1254418, 0x18509,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x862600, 0x30186C2, 0x12512A1, 0x1889240, 0x2603003, 0xFFFFFFFF, 0x20C0109, 0x604643, 0x4DB0C0, 0x34A0600,
+    0x3109013, 0xFFFFFFFF, 0xFFFFFFFF, 0x124168C, 0x304A488, 0x1318610, 0xFFFFFFFF, 0x610D3, 0xFFFFFFFF, 0x12D9240, 0x891243, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x603509, 0x224804C, 0x260C800, 0xFFFFFFFF, 0xFFFFFFFF, 0x81243, 0x309242, 0x3660600, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2E1240, 0xFFFFFFFF, 0x613000, 0x18893, 0xDB003, 0xFFFFFFFF, 0x1842482, 0x60A708, 0x449018, 0x32C8490, 0xFFFFFFFF,
+    0x3610049, 0x1488613, 0x3018490, 0xFFFFFFFF, 0x1889010, 0x128A700, 0xFFFFFFFF, 0xFFFFFFFF, 0x601850, 0xFFFFFFFF, 0xFFFFFFFF, 0x18A1400,
+    0xFFFFFFFF, 0x3461018, 0x25804C, 0xA4402, 0x1314240, 0x490603, 0xFFFFFFFF, 0x109680, 0x6180A2, 0x452818, 0x310C400, 0x49004B,
+    0x1090C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x12480, 0xFFFFFFFF, 0xFFFFFFFF, 0x418600, 0xFFFFFFFF, 0x1241902, 0x6C9600, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2493049, 0x2062300, 0x3492248, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x308490, 0x180A2, 0x2881840, 0xFFFFFFFF,
+    0x248320, 0x600600, 0x125241A, 0xFFFFFFFF, 0x3080092, 0x300348B, 0x149B049, 0xFFFFFFFF, 0x449848, 0x29304C, 0x164A500, 0xFFFFFFFF,
+    0x24812D8, 0x1909000, 0xFFFFFFFF, 0xC9064, 0x311A240, 0x62253, 0x10C000, 0x12528C0, 0xA4D4, 0x3109610, 0xFFFFFFFF, 0x8480D3,
+    0x30C34C0, 0x30CA240, 0x1300262, 0x29A249, 0xFFFFFFFF, 0xFFFFFFFF, 0x601508, 0x94003, 0xFFFFFFFF, 0xC950A, 0x661003, 0xFFFFFFFF,
+    0x25A8C0, 0x618318, 0x2248649, 0x2892240, 0x54680, 0xFFFFFFFF, 0x168A243, 0x3660, 0xFFFFFFFF, 0xFFFFFFFF, 0x499618, 0x2480648,
+    0xFFFFFFFF, 0x30A2, 0xD0709, 0x20014A0, 0x3000694, 0x2E1289, 0x249A018, 0xFFFFFFFF, 0xFFFFFFFF, 0xDB04B, 0x30000E1, 0x692243,
+    0x2522, 0x18311, 0xFFFFFFFF, 0xFFFFFFFF, 0x20192D2, 0x124201B, 0x30D8083, 0x293880, 0x48420C0, 0xFFFFFFFF, 0x3002121, 0x14A2018,
+    0xB2C3, 0x8A2240, 0xFFFFFFFF, 0xFFFFFFFF, 0x851213, 0x184C280, 0x304A299, 0xFFFFFFFF, 0x325824B, 0xFFFFFFFF, 0x425A003, 0x124921A,
+    0x6C3488, 0xFFFFFFFF, 0x1640308, 0xFFFFFFFF, 0x109109, 0x329C200, 0x6CB200, 0xD3650, 0x128904C, 0xFFFFFFFF, 0x184024B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x226024B, 0xFFFFFFFF, 0x2CB260, 0x25121A, 0x261888, 0x1B260, 0x648308, 0xFFFFFFFF, 0xFFFFFFFF, 0x11B203, 0x2498248,
+    0x6D2400, 0x2A16C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3314, 0x2254218, 0xCB200, 0xFFFFFFFF, 0x30192C0, 0x124024A, 0x46D1200,
+    0xC2908, 0x34C9203, 0x4B482, 0x860083, 0x12D2680, 0xFFFFFFFF, 0xFFFFFFFF, 0x49041B, 0x62292, 0x12D20C2, 0x30CA840, 0x1259658,
+    0xD2400, 0xFFFFFFFF, 0xFFFFFFFF, 0x36D9200, 0x8C2C0, 0x4640291, 0xFFFFFFFF, 0x200001B, 0x2DA680, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xCC109, 0xFFFFFFFF, 0xFFFFFFFF, 0x80860, 0xFFFFFFFF, 0x142D2, 0xFFFFFFFF, 0xFFFFFFFF, 0x2486E1, 0x168A289, 0x9B810, 0x19491,
+    0xFFFFFFFF, 0x49C200, 0x3002263, 0x613649, 0xFFFFFFFF, 0xFFFFFFFF, 0xD3308, 0xFFFFFFFF, 0xFFFFFFFF, 0x30C0293, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xD84C3, 0x84A061, 0x1849259, 0x30D8680, 0x1258403, 0x340A443, 0xFFFFFFFF, 0x148B248, 0x301B0D0, 0x30D80C0, 0x464049, 0xFFFFFFFF,
+    0xE2840, 0x4258013, 0x24801B, 0x6C1488, 0x38480C0, 0xFFFFFFFF, 0x1649200, 0x112000, 0x60131A, 0x1910018, 0x3409309, 0xC9319,
+    0x493248, 0x10C2C8, 0x1249259, 0x14D1258, 0xC2000, 0x512448, 0x3260002, 0x1840848, 0x3648061, 0x13030C2, 0xC0461, 0x2622440,
+    0xFFFFFFFF, 0x25181A, 0x4289248, 0x18D4, 0xFFFFFFFF, 0xFFFFFFFF, 0x49A440, 0x25125C, 0x1858680, 0x186E1, 0x291648, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x618013, 0x1C2C0, 0xC0908, 0x848291, 0x300924B, 0x30182E0, 0xB690, 0x2600061, 0xFFFFFFFF, 0x4A4A2,
+    0x4094DA, 0x14A3400, 0xA3240, 0x3409690, 0x12922C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x10291, 0xFFFFFFFF, 0x3243848, 0x493010,
+    0x1094D8, 0x60A443, 0x12890, 0x26030C3, 0x128941B, 0xFFFFFFFF, 0x68C200, 0xFFFFFFFF, 0x1304480, 0x2260618, 0x16E0003, 0xFFFFFFFF,
+    0x12C924C, 0x94092, 0x45B403, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2481240, 0x264250, 0x30522C0, 0xD8063, 0x84861A, 0x3001299,
+    0x4C4258, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x329101A, 0x309300, 0xC0119, 0xFFFFFFFF, 0xFFFFFFFF, 0x1489242,
+    0xFFFFFFFF, 0x6C2603, 0x50924B, 0xFFFFFFFF, 0x4B291, 0x6922C8, 0x602493, 0x4490DB, 0x648000, 0xFFFFFFFF, 0x84B0C2, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3602092, 0x630C3, 0x3012818, 0x44C, 0x453443, 0xFFFFFFFF, 0x52493, 0xFFFFFFFF, 0x609692,
+    0x1241520, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x128C24A, 0xFFFFFFFF, 0xFFFFFFFF, 0x4309000,
+    0xFFFFFFFF, 0x3400490, 0x12890C3, 0x5C24B, 0x251859, 0xFFFFFFFF, 0x1913, 0xFFFFFFFF, 0xFFFFFFFF, 0x3003098, 0x36D0600, 0x601240,
+    0xFFFFFFFF, 0x509018, 0xFFFFFFFF, 0x848890, 0x90B000, 0x24982C8, 0xFFFFFFFF, 0x2910D0, 0x494C3, 0x44C9003, 0x25B618, 0x124344C,
+    0x214CB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x310A250, 0x261B049, 0x165C240, 0x1850260, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x2C8049, 0x301304C, 0x1851289, 0x892480, 0x2249840, 0xD2480, 0x16E0600, 0xFFFFFFFF, 0x30CA300, 0x3709000,
+    0x3400263, 0xFFFFFFFF, 0xFFFFFFFF, 0x418493, 0x610661, 0x16E0, 0xD1900, 0x128B490, 0x201B049, 0xFFFFFFFF, 0xFFFFFFFF, 0x305904C,
+    0x29401A, 0xD9690, 0x109403, 0xFFFFFFFF, 0x2711002, 0x6C0602, 0xFFFFFFFF, 0x49293, 0x1489840, 0x600492, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x18A0018, 0xFFFFFFFF, 0x148928B, 0x302144A, 0x1250709, 0xFFFFFFFF, 0xFFFFFFFF, 0x150B049, 0x610C3, 0x3462240, 0x125B049, 0x2603490,
+    0xD2803, 0x3300649, 0x12C1889, 0xFFFFFFFF, 0x3603, 0x649061, 0x491289, 0x309201A, 0x10A309, 0xFFFFFFFF, 0x16A1000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3000649, 0x419843, 0x263049, 0xFFFFFFFF, 0xFFFFFFFF, 0x3260648, 0xFFFFFFFF, 0x301A018, 0xFFFFFFFF, 0xFFFFFFFF, 0xD944B,
+    0x3260080, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x6CB2C0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x254458, 0x4512, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x360041B, 0xFFFFFFFF, 0x602860, 0xFFFFFFFF, 0xC9283, 0x8C8092, 0xFFFFFFFF, 0x44C9600, 0x123600, 0x1302018, 0xFFFFFFFF, 0x4C0C0,
+    0x63490, 0x30092C2, 0xFFFFFFFF, 0xFFFFFFFF, 0x42C0248, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x124030B, 0x6C12D8, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3318248, 0xFFFFFFFF, 0x92691, 0x18649, 0xFFFFFFFF, 0x493098, 0x1700308, 0x24B48B, 0x124A68A, 0x32C824B, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x3018248, 0x71C, 0xFFFFFFFF, 0x324B080, 0xFFFFFFFF, 0x18400E1, 0x613260, 0x9C442, 0xFFFFFFFF, 0xFFFFFFFF, 0x26D1210,
+    0x25268A, 0x992D2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3001309, 0x300C210, 0x60364B, 0xFFFFFFFF, 0x448A000, 0xFFFFFFFF, 0x361801A,
+    0x6004DB, 0xFFFFFFFF, 0x130024A, 0xFFFFFFFF, 0x16D9210, 0x616C9, 0x12D8248, 0xFFFFFFFF, 0x125B648, 0xFFFFFFFF, 0xFFFFFFFF, 0x3318018,
+    0xFFFFFFFF, 0x6C20C3, 0x1841B, 0x4491200, 0x36184C0, 0x24869B, 0xFFFFFFFF, 0x124A458, 0xFFFFFFFF, 0x288001B, 0xFFFFFFFF, 0x2480D3,
+    0x12E2003, 0x13700, 0xC0083, 0x128A289, 0x52511, 0x24A6D8, 0xFFFFFFFF, 0x6C92C2, 0xFFFFFFFF, 0xFFFFFFFF, 0x30000CC, 0xFFFFFFFF,
+    0x44904C, 0xFFFFFFFF, 0xC20C3, 0x4965C, 0x30026C8, 0x11C440, 0x46C80C0, 0x29228B, 0x2421A, 0x4909B, 0x41B308, 0xFFFFFFFF,
+    0x314049, 0x130001A, 0xC9880, 0x3603010, 0xFFFFFFFF, 0x124148B, 0x1258858, 0xFFFFFFFF, 0xC92C3, 0x4C6C2, 0x8612C0, 0xFFFFFFFF,
+    0xA12C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x2012449, 0x3010061, 0x30801B, 0x85B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x24948B, 0x30A618,
+    0x3180D8, 0xFFFFFFFF, 0x324C203, 0x522E1, 0x184125A, 0x2898, 0x1B24B, 0xFFFFFFFF, 0x230B018, 0x20C0848, 0x24890A, 0x3084C0,
+    0x224C488, 0xD9261, 0xFFFFFFFF, 0xFFFFFFFF, 0x253249, 0x3300, 0x3404488, 0xFFFFFFFF, 0xFFFFFFFF, 0x1841700, 0x600064, 0x30A500,
+    0xC1310, 0x2002711, 0xFFFFFFFF, 0x40A4A1, 0x2481309, 0x1254488, 0x6D8010, 0x3258003, 0x490403, 0xFFFFFFFF, 0xFFFFFFFF, 0x130084A,
+    0x218C9, 0x16400C3, 0x30A1249, 0x600510, 0x12406DA, 0xB520, 0x2609803, 0x4240890, 0xFFFFFFFF, 0x112210, 0x1240119, 0x106D8,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x113240, 0x264203, 0x10121, 0xFFFFFFFF, 0x4918C0, 0x20C061B, 0x6A2440, 0x428B003, 0xFFFFFFFF,
+    0x3248890, 0x3261240, 0xFFFFFFFF, 0x12E2049, 0x249A600, 0xFFFFFFFF, 0x34C1240, 0xFFFFFFFF, 0xFFFFFFFF, 0x364A2C0, 0x6C9308, 0xC26C3,
+    0x2009249, 0x3000109, 0x680618, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4C258, 0x20C30C0, 0x14A2600, 0x61924C, 0x6C3010, 0x3062203,
+    0x3081900, 0x300A489, 0x248003, 0x1244640, 0x1300059, 0x6DB400, 0xFFFFFFFF, 0x85124B, 0xFFFFFFFF, 0xFFFFFFFF, 0xC319, 0xC9308,
+    0x4244242, 0x26D9240, 0xFFFFFFFF, 0x92260, 0xFFFFFFFF, 0x3412648, 0xFFFFFFFF, 0x1709800, 0x364804C, 0x890, 0xFFFFFFFF, 0x128A658,
+    0x1649690, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xD30C0, 0xFFFFFFFF, 0x69101B, 0x30C004B, 0xFFFFFFFF, 0x3402480, 0xFFFFFFFF,
+    0x4250600, 0x4C02DA, 0x30C2649, 0xFFFFFFFF, 0x292658, 0x654249, 0x46890C0, 0x30182CB, 0x1252480, 0xFFFFFFFF, 0x24C9002, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x601689, 0x1241850, 0xFFFFFFFF, 0xC9690, 0x3258603, 0xFFFFFFFF, 0x699243, 0x1258660, 0xFFFFFFFF, 0x36910C0, 0x49911,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x14D1013, 0x1303449, 0xCB6C8, 0xFFFFFFFF, 0x1840603, 0x603112, 0x13002C8, 0xFFFFFFFF, 0x42C0092, 0x64300,
+    0x249299, 0x4289003, 0x4253, 0x1B618, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x61004C, 0x1B05C, 0x291400, 0x3083603, 0x300128C,
+    0x26490C0, 0x3082CB, 0xFFFFFFFF, 0xC06C0, 0xDA649, 0x84804B, 0x3018098, 0xB44B, 0x4480092, 0xDA092, 0xFFFFFFFF, 0x3000709,
+    0x14A0600, 0xFFFFFFFF, 0xFFFFFFFF, 0xC944A, 0xFFFFFFFF, 0x680661, 0x30C9618, 0x10049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x109293,
+    0xFFFFFFFF, 0x6C0490, 0x3062249, 0x49123, 0xFFFFFFFF, 0x300A4C0, 0x601902, 0x30E4000, 0xFFFFFFFF, 0xFFFFFFFF, 0x61510, 0xFFFFFFFF,
+    0x60C21A, 0x429C000, 0xFFFFFFFF, 0x42400E1, 0x12C0709, 0xFFFFFFFF, 0x1249280, 0x13020D8, 0x2A1848, 0x4018A1, 0xFFFFFFFF, 0x24C689,
+    0x612413, 0xC304C, 0xFFFFFFFF, 0x3308258, 0x249508, 0x30C0648, 0x1253600, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x30004D9, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x340921B, 0x325144A, 0x201C289, 0x301B488, 0x12D224A, 0xFFFFFFFF, 0x188C002, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x61A618,
+    0x6C1840, 0xCC848, 0xFFFFFFFF, 0x719000, 0x698260, 0xFFFFFFFF, 0xFFFFFFFF, 0x4488080, 0x44A2000, 0xFFFFFFFF, 0x248C280, 0x312300,
+    0xFFFFFFFF, 0x2092018, 0xFFFFFFFF, 0x62300, 0xFFFFFFFF, 0x2248, 0xFFFFFFFF, 0xFFFFFFFF, 0xE40C0, 0x1840649, 0x1243318, 0x3490083,
+    0xFFFFFFFF, 0x660092, 0x3000862, 0x2492D2, 0x610649, 0x3660248, 0xFFFFFFFF, 0xD8649, 0xFFFFFFFF, 0x692403, 0xFFFFFFFF, 0x6232C0,
+    0x1B09B, 0x3251218, 0x3610248, 0x3009603, 0x30D824A, 0x32C80C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x33084C0, 0x862018, 0xA201B, 0x44800D8,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x2061049, 0xFFFFFFFF, 0x261824B, 0x3601658, 0x1700649, 0x609218, 0x31A400, 0xFFFFFFFF,
+    0xCA4C0, 0x49720, 0xFFFFFFFF, 0xFFFFFFFF, 0x4643248, 0xFFFFFFFF, 0x64904C, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x1261213, 0x340001B,
+    0x260C218, 0x12A1602, 0xFFFFFFFF, 0xFFFFFFFF, 0x1498, 0xFFFFFFFF, 0x42C9203, 0x3094049, 0x301A003, 0x261488, 0x1C448, 0xC3648,
+    0x2012509, 0x3264200, 0x24C6C8, 0x93310, 0x305B410, 0xFFFFFFFF, 0x49049, 0x17092C0, 0x600248, 0xFFFFFFFF, 0x32D1203, 0x509603,
+    0x4B649, 0x20C9218, 0x60284B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x61C218, 0x32D3240, 0xFFFFFFFF,
+    0x14884C3, 0x3449092, 0x8C491, 0xFFFFFFFF, 0x3240294, 0xFFFFFFFF, 0x52848, 0xFFFFFFFF, 0x89321, 0xFFFFFFFF, 0x44880C0, 0x1299092,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x124C213, 0xFFFFFFFF, 0xD148B, 0x3260400, 0xFFFFFFFF, 0xFFFFFFFF, 0x261261, 0x3490680, 0xC341B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x1843240, 0x30948A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x330C200, 0x254213, 0x61324B, 0xFFFFFFFF, 0x20026CB, 0x3610848,
+    0x30018D8, 0xFFFFFFFF, 0x44A840, 0xFFFFFFFF, 0xFFFFFFFF, 0x84B248, 0x300C203, 0x4310003, 0xFFFFFFFF, 0x1312448, 0xFFFFFFFF, 0x8480CC,
+    0xFFFFFFFF, 0x604658, 0x461092, 0xFFFFFFFF, 0x652500, 0xFFFFFFFF, 0x3461248, 0x609818, 0x1301258, 0xFFFFFFFF, 0xFFFFFFFF, 0x2DA059,
+    0xFFFFFFFF, 0x284B0C0, 0x31A448, 0xCA500, 0xFFFFFFFF, 0x109311, 0x30C90D8, 0x624200, 0x126C8, 0xFFFFFFFF, 0x40148B, 0x2496A1,
+    0x8125B, 0x309258, 0x3681300, 0xFFFFFFFF, 0xFFFFFFFF, 0x24A6C8, 0x613018, 0x98061, 0xFFFFFFFF, 0x341B003, 0xFFFFFFFF, 0x24A109,
+    0x1249309, 0xFFFFFFFF, 0x224B0C0, 0x4964C, 0x3099243, 0x80121, 0x30C2260, 0xFFFFFFFF, 0xC0510, 0x49080, 0x712440, 0x30C06C2,
+    0x9180C0, 0xFFFFFFFF, 0x6522D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x251309, 0x4E4200, 0x23689, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x3303003, 0x148B0C0, 0x30CA488, 0x308000, 0x1891249, 0xFFFFFFFF, 0x4242092, 0x418618, 0x263403,
+    0x6C1300, 0xFFFFFFFF, 0x3248059, 0x522CC, 0x1841242, 0x30A049, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x4006DB, 0xFFFFFFFF, 0x364B049,
+    0x1C243, 0xFFFFFFFF, 0x4941B, 0xFFFFFFFF, 0x18406C9, 0x9B458, 0xFFFFFFFF, 0x2881289, 0xFFFFFFFF, 0x41B0C0, 0x600059, 0x430C,
+    0xFFFFFFFF, 0x2260109, 0xFFFFFFFF, 0x300C802, 0xFFFFFFFF, 0x618449, 0x3061403, 0xFFFFFFFF, 0x3618600, 0xFFFFFFFF, 0x12D2098, 0x11243,
+    0xFFFFFFFF, 0x3240661, 0x26C004C, 0x229A200, 0xFFFFFFFF, 0x61A489, 0x38482C8, 0x3244240, 0xFFFFFFFF, 0x249243, 0x609849, 0x1301299,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x403618, 0x114800, 0x2490260, 0x32C8600, 0x32436C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x2486C2, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x6490C9, 0xFFFFFFFF, 0x20C0049, 0x248109, 0x309299, 0x3400092, 0x2260490, 0x12A4240, 0x24A709, 0xFFFFFFFF, 0xFFFFFFFF, 0x38D9000,
+    0xFFFFFFFF, 0x2C8320, 0x30016D0, 0x27090C0, 0x9298, 0x291293, 0xFFFFFFFF, 0x1488660, 0x68004C, 0x603449, 0x304C403, 0xCB44B,
+    0xFFFFFFFF, 0xFFFFFFFF, 0x20C9849, 0x12D8600, 0x890603, 0xD0600, 0x4B6CA, 0xFFFFFFFF, 0xFFFFFFFF, 0x25C243, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x3259840, 0x1700490, 0x24B610, 0xFFFFFFFF, 0xFFFFFFFF, 0xD264A, 0x494240, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x124DA, 0x128A643,
+    0xFFFFFFFF, 0x3003600, 0xFFFFFFFF, 0x125A308, 0xFFFFFFFF, 0x3248092, 0x70B049, 0xFFFFFFFF, 0x610260, 0xFFFFFFFF, 0x30524C8, 0xD9849,
+    0x2291000, 0xFFFFFFFF, 0x1858098, 0x2308, 0xC3490, 0x2000709, 0x848262, 0x18432C8, 0x30D9448, 0x8A1000, 0xCB218, 0xFFFFFFFF,
+    0x849289, 0x60009B, 0x610709, 0xFFFFFFFF, 0xFFFFFFFF, 0x4B49A, 0x3314000, 0xFFFFFFFF, 0x61B049, 0x210C003, 0x3064002, 0x26C0649,
+    0x229A800, 0xFFFFFFFF, 0x1258094, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x20212D8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x164944B,
+    0x11224B, 0xFFFFFFFF, 0x6C944A, 0xFFFFFFFF, 0x65A300, 0xFFFFFFFF, 0xFFFFFFFF, 0x26009B, 0xFFFFFFFF, 0x224C840, 0x2093488, 0x12A2242,
+    0xFFFFFFFF, 0x20DB, 0xFFFFFFFF, 0x65144B, 0xFFFFFFFF, 0x30920C9, 0x301C200, 0x36492C8, 0x1A4C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x712018,
+    0x2514A1, 0x9891, 0x291890, 0xFFFFFFFF, 0x2018308, 0x3311210, 0x301A0C0, 0xA1448, 0xFFFFFFFF, 0xFFFFFFFF, 0x84B098, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x4508018, 0x2601889, 0xFFFFFFFF, 0x4910C, 0x2DC000, 0x3021880, 0xA3488, 0x2121049, 0xD0649, 0x4240691, 0x112018,
+    0x121083, 0xFFFFFFFF, 0x509109, 0xFFFFFFFF, 0x4124C0, 0xFFFFFFFF, 0x60A68A, 0xFFFFFFFF, 0xFFFFFFFF, 0x2000863, 0xFFFFFFFF, 0x24B092,
+    0x8CB, 0x12519, 0x324B24A, 0xFFFFFFFF, 0x3308248, 0xFFFFFFFF, 0xB200, 0x1309880, 0x510308, 0xFFFFFFFF, 0x24A518, 0x26030A,
+    0x290B, 0x291660, 0xFFFFFFFF, 0x4C613, 0x109602, 0xFFFFFFFF, 0xFFFFFFFF, 0x19718, 0x1640248, 0x3002503, 0x109049, 0x60069B,
+    0x12402, 0xFFFFFFFF, 0xFFFFFFFF, 0x8492C3, 0x36C0403, 0x3024210, 0xA3258, 0xFFFFFFFF, 0x4B4D9, 0x26D8018, 0x4300010, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x2092003, 0xFFFFFFFF, 0x300C2C0, 0x248862, 0x261218, 0x304B0C3, 0xD2459, 0x3300291, 0xFFFFFFFF, 0x2482A4, 0x1243303,
+    0x3840000, 0x64A28B, 0xFFFFFFFF, 0x2492C3, 0x185A003, 0xDB, 0x3401258, 0xFFFFFFFF, 0xFFFFFFFF, 0x3000291, 0x2600D0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x64C2C8, 0x400522, 0x3018683, 0x602018, 0xFFFFFFFF, 0xFFFFFFFF, 0x1289318, 0x712600, 0x862003, 0x603003, 0x14DA280,
+    0x22840, 0xFFFFFFFF, 0x2018908, 0x698018, 0x311092, 0x3849250, 0xFFFFFFFF, 0xFFFFFFFF, 0x61098, 0x609200, 0x44A6D0, 0x291318,
+    0x1318013, 0x129B410, 0x12C0294, 0xFFFFFFFF, 0x1243691, 0x242C9, 0xFFFFFFFF, 0xFFFFFFFF, 0x1840400, 0xFFFFFFFF, 0x464, 0x3054200,
+    0xD3248, 0x42406D0, 0xFFFFFFFF, 0x1689649, 0x320013, 0xFFFFFFFF, 0xFFFFFFFF, 0x5B803, 0x3013291, 0x24900C0, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x33030C0, 0x248204C, 0x1859250, 0x34C3, 0x305B400, 0xFFFFFFFF, 0x1488003, 0x826CB, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x418121, 0x301A490, 0x30A109, 0x2692049, 0x2618003, 0xFFFFFFFF, 0x109649, 0x2489249, 0x6C0848, 0xFFFFFFFF, 0x34C30C0,
+    0xFFFFFFFF, 0x44C9018, 0x1243461, 0x1259250, 0x130301A, 0x3600890, 0x4A00C3, 0x854202, 0x8930C, 0xC709, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x6130A, 0xFFFFFFFF, 0xFFFFFFFF, 0x1253, 0xFFFFFFFF, 0xFFFFFFFF, 0x2C8064, 0xFFFFFFFF, 0x30B013, 0x19643, 0xD2498, 0xFFFFFFFF,
+    0x40425B, 0x2482E3, 0x6DA, 0x13908, 0xFFFFFFFF, 0xFFFFFFFF, 0x20C1240, 0x249303, 0x98294, 0x1B680, 0x4498600, 0xFFFFFFFF,
+    0x860003, 0x12D2602, 0x3652200, 0xFFFFFFFF, 0x16D3000, 0x709300, 0x6221B, 0x30C2482, 0x6C0618, 0x2603000, 0x2880109, 0xFFFFFFFF,
+    0x68125B, 0xFFFFFFFF, 0xFFFFFFFF, 0x29A21A, 0x65924B, 0x52603, 0x683848, 0xFFFFFFFF,
+};
+
+// True if the packed counts of one tile type form complete groups (+ optional pair)
+inline bool IsAgariShape(unsigned int key) {
+    unsigned int bucket = (key * 0x9E3779B1u) >> (32 - AGARI_BUCKET_BITS);
+    unsigned int slot = ((key ^ agariSeeds[bucket]) * 0x85EBCA6Bu) >> (32 - AGARI_SLOT_BITS);
+    return agariSlots[slot] == key;
+}
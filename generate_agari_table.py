@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+Generates agari_table.h for Mahjong Loong
+
+Every way one tile type (values 1-9, 0-4 copies each, at most 14 tiles) can be
+split into groups with or without one pair is enumerated here and stored in a
+perfect-hash table, so the game checks a whole hand with one lookup per type.
+
+Run again only if the rules for groups change:
+    python3 generate_agari_table.py
+"""
+
+from itertools import combinations_with_replacement
+
+OUTPUT_FILE = "agari_table.h"
+
+BUCKET_BITS = 13  # 8192 buckets
+SLOT_BITS = 15    # 32768 slots
+EMPTY_SLOT = 0xFFFFFFFF
+MASK32 = 0xFFFFFFFF
+
+BUCKET_MULTIPLIER = 0x9E3779B1
+SLOT_MULTIPLIER = 0x85EBCA6B
+
+
+def pack_key(counts):
+    # 3 bits per value, value 1 in the lowest bits
+    key = 0
+    for value, count in enumerate(counts):
+        key |= count << (value * 3)
+    return key
+
+
+def bucket_of(key):
+    return ((key * BUCKET_MULTIPLIER) & MASK32) >> (32 - BUCKET_BITS)
+
+
+def slot_of(key, seed):
+    return (((key ^ seed) * SLOT_MULTIPLIER) & MASK32) >> (32 - SLOT_BITS)
+
+
+def enumerate_shapes():
+    # Groups: triplets of 1-9 and consecutives 1-2-3 to 7-8-9
+    groups = [("triplet", v) for v in range(9)] + [("consecutive", v) for v in range(7)]
+    shapes = set()
+
+    for group_count in range(5):  # A hand never has more than 4 groups
+        for combo in combinations_with_replacement(range(len(groups)), group_count):
+            counts = [0] * 9
+            for index in combo:
+                kind, value = groups[index]
+                if kind == "triplet":
+                    counts[value] += 3
+                else:
+                    counts[value] += 1
+                    counts[value + 1] += 1
+                    counts[value + 2] += 1
+            if max(counts) > 4:
+                continue
+            shapes.add(tuple(counts))
+
+            for pair_value in range(9):
+                with_pair = list(counts)
+                with_pair[pair_value] += 2
+                if max(with_pair) <= 4 and sum(with_pair) <= 14:
+                    shapes.add(tuple(with_pair))
+
+    return sorted(pack_key(shape) for shape in shapes)
+
+
+def build_perfect_hash(keys):
+    buckets = [[] for _ in range(1 << BUCKET_BITS)]
+    for key in keys:
+        buckets[bucket_of(key)].append(key)
+
+    slots = [EMPTY_SLOT] * (1 << SLOT_BITS)
+    seeds = [0] * (1 << BUCKET_BITS)
+
+    # Place the biggest buckets first while the table is still empty
+    order = sorted(range(len(buckets)), key=lambda b: -len(buckets[b]))
+    for bucket in order:
+        members = buckets[bucket]
+        if not members:
+            continue
+        for seed in range(1 << 16):
+            wanted = [slot_of(key, seed) for key in members]
+            if len(set(wanted)) == len(wanted) and all(slots[s] == EMPTY_SLOT for s in wanted):
+                for key, s in zip(members, wanted):
+                    slots[s] = key
+                seeds[bucket] = seed
+                break
+        else:
+            raise RuntimeError("No seed found for bucket %d" % bucket)
+
+    return seeds, slots
+
+
+def write_array(out, declaration, values, per_line):
+    out.write(declaration + " = {\n")
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        out.write("    " + ", ".join("0x%X" % v for v in chunk) + ",\n")
+    out.write("};\n\n")
+
+
+def main():
+    print("🐉 Mahjong Loong - Agari Table Generator")
+    print("=" * 40)
+
+    keys = enumerate_shapes()
+    print("✅ Found %d complete tile type shapes" % len(keys))
+
+    seeds, slots = build_perfect_hash(keys)
+    for key in keys:
+        assert slots[slot_of(key, seeds[bucket_of(key)])] == key
+    print("✅ Perfect hash built (%d buckets, %d slots)" % (len(seeds), len(slots)))
+
+    with open(OUTPUT_FILE, "w") as out:
+        out.write("// Generated by generate_agari_table.py - do not edit by hand\n")
+        out.write("//\n")
+        out.write("// Every complete shape of one tile type: values 1-9 with 0-4 copies each,\n")
+        out.write("// split into groups (triplets / consecutives) plus at most one pair.\n")
+        out.write("// Shapes are packed 3 bits per value and stored in a perfect-hash table.\n")
+        out.write("#pragma once\n\n")
+        out.write("const int AGARI_SHAPE_COUNT = %d;\n" % len(keys))
+        out.write("const int AGARI_BUCKET_BITS = %d;\n" % BUCKET_BITS)
+        out.write("const int AGARI_SLOT_BITS = %d;\n" % SLOT_BITS)
+        out.write("const unsigned int AGARI_EMPTY_SLOT = 0x%X;\n\n" % EMPTY_SLOT)
+        write_array(out, "const unsigned short agariSeeds[1 << AGARI_BUCKET_BITS]", seeds, 16)
+        write_array(out, "const unsigned int agariSlots[1 << AGARI_SLOT_BITS]", slots, 12)
+        out.write("// True if the packed counts of one tile type form complete groups (+ optional pair)\n")
+        out.write("inline bool IsAgariShape(unsigned int key) {\n")
+        out.write("    unsigned int bucket = (key * 0x%Xu) >> (32 - AGARI_BUCKET_BITS);\n" % BUCKET_MULTIPLIER)
+        out.write("    unsigned int slot = ((key ^ agariSeeds[bucket]) * 0x%Xu) >> (32 - AGARI_SLOT_BITS);\n" % SLOT_MULTIPLIER)
+        out.write("    return agariSlots[slot] == key;\n")
+        out.write("}\n")
+
+    print("📁 Wrote %s" % OUTPUT_FILE)
+
+
+if __name__ == "__main__":
+    main()
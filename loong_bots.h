@@ -0,0 +1,282 @@
+// Mahjong Loong bots: policies that play GameCore without a player
+//
+// Each tick a policy gets a read-only BotView of the board and the hand and returns a
+// BotAction: a direction, an arrow step and whether to fire the SHIFT power. Policies keep
+// their scratch space in members sized on first use, so a warm Act() never touches the heap.
+#pragma once
+
+#include "loong_core.h"
+
+#include <climits>
+#include <memory>
+
+const Vector2 BOT_MOVES[4] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+
+// What a bot may look at: references into the game, nothing is copied
+struct BotView {
+    const SnakeBody& body;
+    const Occupancy& occupancy; // Segments covering each board cell
+    Vector2 direction;
+    Vector2 food;
+    bool upgradeSpawned;
+    Vector2 upgradeTile;
+    bool latentUpgradeSpawned;
+    Vector2 latentUpgradeTile;
+    const vector<Tile>& tiles;
+    const Tile& nextTile;
+    int arrowPosition;
+    int maxTiles; // Arrow at maxTiles = KEEP (the new tile is discarded)
+    bool shiftPowerReady;
+
+    BotView(GameCore& game)
+        : body(game.snake.body), occupancy(game.snake.occupancy), direction(game.snake.direction), food(game.food.position),
+          upgradeSpawned(game.upgradeSpawned), upgradeTile(game.upgradeTilePosition),
+          latentUpgradeSpawned(game.latentUpgradeSpawned), latentUpgradeTile(game.latentUpgradeTilePosition),
+          tiles(game.mahjongTiles.tiles), nextTile(game.mahjongTiles.nextTile),
+          arrowPosition(game.mahjongTiles.arrowPosition), maxTiles(game.mahjongTiles.maxTiles),
+          shiftPowerReady(game.shiftPowerReady), game(game) {}
+
+    // Moves to the food after BOT_MOVES[move], TileDistanceField::UNREACHABLE off the board
+    // Asking brings the game's food distance field up to date, so only bots that ask pay for it.
+    int FoodMoves(int move) const {
+        Vector2 head = body[0];
+        return game.FoodDistance({head.x + BOT_MOVES[move].x, head.y + BOT_MOVES[move].y});
+    }
+
+private:
+    GameCore& game;
+};
+
+struct BotAction {
+    Vector2 direction = {0, 0}; // {0, 0} = keep going
+    int arrowMove = 0; // -1 left, +1 right, 0 stay
+    bool activateShift = false;
+};
+
+class BotPolicy {
+public:
+    virtual ~BotPolicy() {}
+    virtual void Seed(uint64_t seed) {}
+    virtual BotAction Act(const BotView& view) = 0;
+};
+
+inline bool IsReverse(Vector2 move, Vector2 direction) {
+    return (direction.x != 0 || direction.y != 0) && move.x == -direction.x && move.y == -direction.y;
+}
+
+inline bool InsideBoard(Vector2 cell) {
+    return cell.x >= 0 && cell.y >= 0 && cell.x < cellCount && cell.y < cellCount;
+}
+
+// How well a tile fits the hand: same tile 3, neighbor 2, one gap 1 (per hand tile of its type)
+// Zero tiles never fit, so they are the first to go
+inline int TileFit(const Tile& tile, const vector<Tile>& tiles, int skipIndex) {
+    if (tile.IsZero()) return -1;
+    int fit = 0;
+    for (int i = 0; i < (int)tiles.size(); i++) {
+        if (i == skipIndex || tiles[i].type != tile.type || tiles[i].IsZero()) continue;
+        int gap = abs(tiles[i].value - tile.value);
+        if (gap <= 2) fit += 3 - gap;
+    }
+    return fit;
+}
+
+// Where the arrow should point for the next tile: the worst-fitting hand tile if the new one
+// fits better, otherwise KEEP
+inline int ArrowTarget(const BotView& view) {
+    int worstIndex = -1;
+    int worstFit = INT_MAX;
+    for (int i = 0; i < (int)view.tiles.size(); i++) {
+        int fit = TileFit(view.tiles[i], view.tiles, i);
+        if (fit < worstFit) {
+            worstFit = fit;
+            worstIndex = i;
+        }
+    }
+    if (worstIndex >= 0 && TileFit(view.nextTile, view.tiles, worstIndex) > worstFit) return worstIndex;
+    return view.maxTiles;
+}
+
+// One arrow step toward the target
+inline int ArrowStep(const BotView& view, int target) {
+    if (target == view.arrowPosition) return 0;
+    if (target < view.arrowPosition) return -1;
+    return 1;
+}
+
+// Fire SHIFT when it's ready and the tile coming next doesn't fit the hand at all
+inline bool WantsShift(const BotView& view) {
+    return view.shiftPowerReady && TileFit(view.nextTile, view.tiles, -1) <= 0;
+}
+
+// RANDOM BOT: any direction but straight back, random arrow steps, SHIFT now and then
+class RandomBot : public BotPolicy {
+public:
+    RandomGenerator random;
+
+    void Seed(uint64_t seed) override {
+        random.Seed(seed);
+    }
+
+    BotAction Act(const BotView& view) override {
+        BotAction action;
+        do {
+            action.direction = BOT_MOVES[random.Value(0, 3)];
+        } while (IsReverse(action.direction, view.direction));
+        action.arrowMove = random.Value(-1, 1);
+        action.activateShift = view.shiftPowerReady && random.Value(0, 99) == 0;
+        return action;
+    }
+};
+
+// GREEDY BOT: straight for the food along moves that don't hit a wall or the body next tick
+class GreedyBot : public BotPolicy {
+public:
+    RandomGenerator random; // Breaks ties between equally good moves
+
+    void Seed(uint64_t seed) override {
+        random.Seed(seed);
+    }
+
+    BotAction Act(const BotView& view) override {
+        BotAction action;
+        Vector2 head = view.body[0];
+
+        int bestMove = -1;
+        int bestDistance = INT_MAX;
+        int ties = 0;
+        for (int move = 0; move < 4; move++) {
+            Vector2 next = {head.x + BOT_MOVES[move].x, head.y + BOT_MOVES[move].y};
+            if (IsReverse(BOT_MOVES[move], view.direction)) continue;
+            if (!InsideBoard(next) || view.body.Contains(next)) continue;
+
+            int distance = (int)(fabs(next.x - view.food.x) + fabs(next.y - view.food.y));
+            if (distance < bestDistance) {
+                bestMove = move;
+                bestDistance = distance;
+                ties = 1;
+            } else if (distance == bestDistance && random.Value(0, ties++) == 0) {
+                bestMove = move;
+            }
+        }
+        if (bestMove >= 0) {
+            action.direction = BOT_MOVES[bestMove];
+        } else if (view.direction.x == 0 && view.direction.y == 0) {
+            action.direction = BOT_MOVES[random.Value(0, 3)]; // Boxed in at a hard stop: a stopped snake never dies
+        }
+
+        action.arrowMove = ArrowStep(view, ArrowTarget(view));
+        action.activateShift = WantsShift(view);
+        return action;
+    }
+};
+
+// BFS SURVIVAL BOT: shortest path to the food (the game's food distance field), but only
+// through moves that leave at least a body length of room to move in; when none do, the move
+// with the most room. The room after each move is the size of the open region it enters,
+// from one labelling of the board per tick.
+class BfsBot : public BotPolicy {
+public:
+    RandomGenerator random; // Boxed-in restarts
+    SafeCellFinder regions; // Open regions of this tick, sized for the board on first use
+
+    void Seed(uint64_t seed) override {
+        random.Seed(seed);
+    }
+
+    BotAction Act(const BotView& view) override {
+        BotAction action;
+        action.arrowMove = ArrowStep(view, ArrowTarget(view));
+        action.activateShift = WantsShift(view);
+
+        // The body blocks, except the tail, which moves out of the way this tick (unless growth
+        // left another segment on its cell)
+        const Occupancy& occupancy = view.occupancy;
+        Vector2 tail = view.body.back();
+        int tailIndex = occupancy.OnBoard(tail) ? occupancy.Index(tail) : -1;
+        if (tailIndex >= 0 && occupancy.counts[tailIndex] > 1) tailIndex = -1;
+        regions.Label(occupancy, tailIndex);
+
+        Vector2 head = view.body[0];
+        int bestMove = -1;
+        bool bestSafe = false;
+        int bestDistance = INT_MAX;
+        int bestRoom = -1;
+        for (int move = 0; move < 4; move++) {
+            Vector2 next = {head.x + BOT_MOVES[move].x, head.y + BOT_MOVES[move].y};
+            if (IsReverse(BOT_MOVES[move], view.direction)) continue;
+            int room = regions.RegionArea(next); // 0 off the board or into the body
+            if (room == 0) continue;
+
+            bool safe = room >= (int)view.body.size();
+            int distance = view.FoodMoves(move);
+            if (distance == TileDistanceField::UNREACHABLE) distance = INT_MAX;
+
+            bool better;
+            if (safe != bestSafe) better = safe;
+            else if (safe) better = distance < bestDistance;
+            else better = room > bestRoom;
+            if (bestMove < 0 || better) {
+                bestMove = move;
+                bestSafe = safe;
+                bestDistance = distance;
+                bestRoom = room;
+            }
+        }
+
+        if (bestMove >= 0) {
+            action.direction = BOT_MOVES[bestMove];
+        } else if (view.direction.x == 0 && view.direction.y == 0) {
+            action.direction = BOT_MOVES[random.Value(0, 3)]; // Boxed in at a hard stop: a stopped snake never dies
+        }
+        return action;
+    }
+};
+
+// Policy by name: "random", "greedy" or "bfs" (nullptr for anything else)
+inline unique_ptr<BotPolicy> MakeBot(const string& name) {
+    if (name == "random") return unique_ptr<BotPolicy>(new RandomBot());
+    if (name == "greedy") return unique_ptr<BotPolicy>(new GreedyBot());
+    if (name == "bfs") return unique_ptr<BotPolicy>(new BfsBot());
+    return nullptr;
+}
+
+// Carry out a bot's action the way HandleInput would
+inline void ApplyBotAction(GameCore& game, const BotAction& action) {
+    bool turning = action.direction.x != 0 || action.direction.y != 0;
+    if (turning && !IsReverse(action.direction, game.snake.direction)) {
+        game.snake.direction = action.direction;
+    }
+
+    // The hand can be shorter than maxTiles: past the last tile the arrow goes straight to KEEP
+    MahjongTiles& hand = game.mahjongTiles;
+    int lastTile = (int)hand.tiles.size() - 1;
+    if (action.arrowMove < 0) {
+        if (hand.arrowPosition > lastTile) hand.arrowPosition = lastTile + 1;
+        hand.MoveArrowLeft();
+    } else if (action.arrowMove > 0) {
+        hand.MoveArrowRight();
+        if (hand.arrowPosition > lastTile) hand.arrowPosition = hand.maxTiles;
+    }
+
+    if (action.activateShift && game.shiftPowerReady) {
+        game.ActivateShiftPower();
+    }
+}
+
+// Click through whatever window is waiting (upgrade, choice, extra life) with random picks
+// Returns true if the tick was spent on a window
+inline bool AnswerPromptsAtRandom(GameCore& game, RandomGenerator& random) {
+    if (game.showLoongUpgrade) {
+        if (game.upgradeChoices.empty()) game.showLoongUpgrade = false;
+        else game.ApplyLoongUpgrade(random.Value(0, game.upgradeChoices.size() - 1));
+        return true;
+    }
+    if (game.showChoiceWindow) {
+        if (!game.currentChoices.empty()) game.ApplyChoice(random.Value(0, game.currentChoices.size() - 1));
+        game.showChoiceWindow = false;
+        return true;
+    }
+    game.isInExtraLifeMode = false; // Resume right away after a life is used
+    return false;
+}
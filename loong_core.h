@@ -0,0 +1,5894 @@
+// Mahjong Loong game core: the simulation without rendering, audio, input or wall-clock time
+//
+// Everything the rules need lives here: tiles and win checks, the snake, food, and GameCore
+// (movement, collisions, tile draws, scoring, upgrades, difficulty). Timers advance by the
+// deltaTime the caller passes in, and sounds, music and saves go through GameCore's virtual
+// hooks, so a headless program can include this header on its own and run games without a
+// window. main.cpp puts the raylib front end on top by deriving Game from GameCore.
+//
+// Include raylib.h first when using both; otherwise the plain Vector2/Color below are used.
+#pragma once
+
+#include <iostream>
+#include <array>
+#include <deque>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <type_traits>
+
+#include "agari_table.h" // Generated by generate_agari_table.py
+
+// AVX2 batch win kernel: x86 desktop builds only, used if the CPU has AVX2
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__EMSCRIPTEN__)
+#define LOONG_AVX2_KERNEL
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+// Plain data types shared with raylib (raylib.h defines the same ones)
+#ifndef RL_VECTOR2_TYPE
+#define RL_VECTOR2_TYPE
+typedef struct Vector2 {
+    float x;
+    float y;
+} Vector2;
+#endif
+
+#ifndef RL_COLOR_TYPE
+#define RL_COLOR_TYPE
+typedef struct Color {
+    unsigned char r;
+    unsigned char g;
+    unsigned char b;
+    unsigned char a;
+} Color;
+#endif
+
+// Game states
+enum GameState {
+    TITLE_SCREEN,
+    LOONG_SELECTION,
+    DIFFICULTY_SELECTION,
+    INSTRUCTION_SCREEN,
+    COUNTDOWN,
+    PLAYING,
+    GAME_OVER,
+    CULTIVATION_SUCCESS,
+    LOONG_UPGRADE
+};
+
+// Cultivation Difficulty Levels
+enum DifficultyLevel {
+    FOUNDATION_BUILDING = 0,  // 3 Extra Lives
+    GOLDEN_CORE = 1,          // 1 Life, no Extra Lives
+    NASCENT_SOUL = 2,         // 7->10->13 tiles progression
+    ASCENSION = 3,            // 10 tiles, 5 Mahjongs to win
+    IMMORTAL_SAGE = 4         // 13 tiles, 5 Mahjongs to win
+};
+
+// LOONG Types - Each with unique abilities and upgrade paths
+enum LoongType {
+    BASIC_LOONG = 0,        // Balanced starter dragon
+    FIRE_LOONG = 1,         // Aggressive damage dealer
+    WATER_LOONG = 2,        // Defensive and healing
+    WHITE_LOONG = 3,        // Pure and purifying
+    EARTH_LOONG = 4,        // Slow but powerful
+    WIND_LOONG = 5,         // Fast and agile
+    SHADOW_LOONG = 6,       // Mysterious and tricky
+    CELESTIAL_LOONG = 7,    // Ultimate endgame dragon
+    PATIENCE_LOONG = 8      // Dragon of patience and control
+};
+
+struct LoongUpgrade {
+    string name;
+    string description;
+    int level;
+    int maxLevel;
+
+    LoongUpgrade(string n, string desc, int maxLvl) : name(n), description(desc), level(0), maxLevel(maxLvl) {}
+};
+
+struct LoongData {
+    LoongType type;
+    string name;
+    string description;
+    Color primaryColor;
+    Color secondaryColor;
+    vector<LoongUpgrade> upgrades;
+    int level; // Overall LOONG level (increases every 10 snake age)
+
+    LoongData(LoongType t, string n, string desc, Color primary, Color secondary)
+        : type(t), name(n), description(desc), primaryColor(primary), secondaryColor(secondary), level(0) {}
+};
+
+// Ornate levels
+enum OrnateLevel {
+    LEVEL_1_NONE = 0,
+    LEVEL_2_BASIC = 1,
+    LEVEL_3_INTRICATE = 2,
+    LEVEL_4_DRAGON = 3,
+    LEVEL_5_GOLD_BASIC = 4,
+    LEVEL_6_GOLD_INTRICATE = 5,
+    LEVEL_7_GOLD_DRAGON = 6,
+    LEVEL_8_ORNATE_GOLD = 7,
+    LEVEL_9_MASTER_GOLD = 8,
+    LEVEL_10_LEGENDARY = 9
+};
+
+// Game area size in cells (the snake moves inside cellCount x cellCount)
+inline int cellCount = 20;
+
+// Simulation random numbers: xoshiro256**, small and fast, with the same sequence on every platform
+struct RandomGenerator {
+    uint64_t state[4];
+
+    RandomGenerator() {
+        Seed(0);
+    }
+
+    // splitmix64 spreads the seed over the whole state (never all zero)
+    void Seed(uint64_t seed) {
+        for (int i = 0; i < 4; i++) {
+            seed += 0x9E3779B97F4A7C15ull;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            state[i] = z ^ (z >> 31);
+        }
+    }
+
+    static uint64_t Rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    uint64_t Next() {
+        uint64_t result = Rotl(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = Rotl(state[3], 45);
+        return result;
+    }
+
+    // Skip 2^128 numbers ahead: streams split off this way never overlap
+    void Jump() {
+        static const uint64_t JUMP[4] = {0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull};
+        uint64_t jumped[4] = {0, 0, 0, 0};
+        for (int word = 0; word < 4; word++) {
+            for (int bit = 0; bit < 64; bit++) {
+                if (JUMP[word] & (1ull << bit)) {
+                    for (int i = 0; i < 4; i++) jumped[i] ^= state[i];
+                }
+                Next();
+            }
+        }
+        for (int i = 0; i < 4; i++) state[i] = jumped[i];
+    }
+
+    // Integer in [min, max], same contract as raylib's GetRandomValue
+    int Value(int min, int max) {
+        if (min > max) swap(min, max);
+        uint64_t range = (uint64_t)((int64_t)max - min) + 1;
+        return min + (int)(((Next() >> 32) * range) >> 32);
+    }
+};
+
+// Named streams, so e.g. an extra food roll doesn't change which tiles come next
+enum RandomStream {
+    TILE_STREAM,     // Tile draws and hand shuffles (copied into MahjongTiles::random, which is the live one)
+    FOOD_STREAM,     // Food, upgrade tile and safe respawn positions
+    UPGRADE_STREAM,  // Upgrade choices and their random effects
+    MUSIC_STREAM,    // Track selection in the front end
+    RANDOM_STREAM_COUNT
+};
+
+// All randomness of one run, reproducible from runSeed
+struct GameRandom {
+    uint64_t runSeed = 0;
+    RandomGenerator streams[RANDOM_STREAM_COUNT];
+
+    GameRandom(uint64_t seed = 0) {
+        Seed(seed);
+    }
+
+    void Seed(uint64_t seed) {
+        runSeed = seed;
+        RandomGenerator generator;
+        generator.Seed(seed);
+        for (int stream = 0; stream < RANDOM_STREAM_COUNT; stream++) {
+            streams[stream] = generator;
+            generator.Jump();
+        }
+    }
+
+    int Value(RandomStream stream, int min, int max) {
+        return streams[stream].Value(min, max);
+    }
+};
+
+// Grid cells are whole numbers, so an exact compare is enough
+inline bool SameCell(Vector2 a, Vector2 b) {
+    return a.x == b.x && a.y == b.y;
+}
+
+// GAME LOG: the core's play-by-play on cout, switched off per game (GameCore::SetQuiet)
+// A quiet game never touches cout, so headless tools can run many games on many threads
+// without redirecting the process-wide stream.
+class GameLog {
+public:
+    bool quiet;
+
+    explicit GameLog(bool quiet = false) : quiet(quiet) {}
+
+    template <class T> GameLog& operator<<(const T& value) {
+        if (!quiet) cout << value;
+        return *this;
+    }
+
+    GameLog& operator<<(ostream& (*manipulator)(ostream&)) { // endl
+        if (!quiet) cout << manipulator;
+        return *this;
+    }
+};
+
+// Mahjong tile system
+// Tile types for expanded mahjong
+enum TileType {
+    PLAIN_TILES = 0,     // 1-9 white border (default)
+    HAT_TILES = 1,       // 1-9 with hat symbol
+    DOT_TILES = 2        // 1-9 with dot symbol
+};
+
+struct Tile {
+    int value;      // 0-9 (0 = blank/zero tile)
+    TileType type;  // NUMBERS, LETTERS, or DOTS
+    bool isGold;    // True if this tile is from a KONG
+
+    Tile(int v = 1, TileType t = PLAIN_TILES, bool gold = false) : value(v), type(t), isGold(gold) {}
+
+    bool operator==(const Tile& other) const {
+        return value == other.value && type == other.type;
+    }
+
+    string ToString() const {
+        if (value == 0) {
+            return "0"; // Zero/blank tile
+        }
+        string result = to_string(value);
+        if (type == HAT_TILES) {
+            result += "^"; // Hat symbol
+        } else if (type == DOT_TILES) {
+            result += "."; // Dot symbol
+        }
+        return result;
+    }
+
+    bool IsZero() const {
+        return value == 0;
+    }
+};
+
+// Flat tile histogram: one slot per (value 0-9, type), indexed type * 10 + value
+// Replaces map<pair<int, TileType>, int> so counting never allocates
+struct TileCounts {
+    static const int SLOTS = 30;
+    int counts[SLOTS];
+
+    TileCounts() { Clear(); }
+
+    void Clear() {
+        for (int i = 0; i < SLOTS; i++) counts[i] = 0;
+    }
+
+    static int Index(int value, TileType type) {
+        return (int)type * 10 + value;
+    }
+
+    static pair<int, TileType> Key(int index) {
+        return make_pair(index % 10, (TileType)(index / 10));
+    }
+
+    int& operator[](const pair<int, TileType>& key) { return counts[Index(key.first, key.second)]; }
+    int operator[](const pair<int, TileType>& key) const { return counts[Index(key.first, key.second)]; }
+
+    int& operator[](int index) { return counts[index]; }
+    int operator[](int index) const { return counts[index]; }
+};
+
+// FAST WIN EVALUATOR: groups + pair check that works in place on a TileCounts array
+// Normal hands are answered by the precomputed agari table: one lookup per tile type.
+// Hands the table can't hold (5+ copies of a tile) fall back to a canonical search:
+// the lowest remaining tile must be a pair, a triplet or the start of a consecutive,
+// so each sub-hand has one search order. Search results only depend on the hand,
+// so they are memoized on the packed counts and shared by every caller.
+class WinEvaluator {
+public:
+    static const int MEMO_SIZE = 4096; // Direct-mapped cache, must be a power of two
+
+    struct MemoEntry {
+        unsigned long long low;  // Slots 0-14, 4 bits each
+        unsigned long long high; // Slots 15-29, 4 bits each
+        bool used;
+        bool result;
+    };
+
+    MemoEntry memo[MEMO_SIZE];
+
+    WinEvaluator() {
+        for (int i = 0; i < MEMO_SIZE; i++) {
+            memo[i].used = false;
+        }
+    }
+
+    // True if the counts split into exactly requiredGroups groups plus one pair
+    bool IsWinningHand(TileCounts& counts, int requiredGroups) {
+        int totalTiles = 0;
+        for (int i = 0; i < TileCounts::SLOTS; i++) {
+            totalTiles += counts[i];
+        }
+        if (totalTiles != requiredGroups * 3 + 2) return false;
+
+        int result = CheckAgariTable(counts);
+        if (result >= 0) return result == 1;
+        return CanComplete(counts, totalTiles);
+    }
+
+    // 1 = win, 0 = no win, -1 = the table can't answer (a tile held 5+ times)
+    static int CheckAgariTable(const TileCounts& counts) {
+        int pairGroups = 0; // Tile types that hold the pair
+        bool unknown = false;
+
+        for (int type = 0; type < 3; type++) {
+            int status = TypeStatus(counts, type);
+            if (status == 0) return 0;
+            if (status < 0) unknown = true;
+            else pairGroups += status - 1;
+        }
+
+        if (unknown) return -1;
+        return pairGroups == 1 ? 1 : 0;
+    }
+
+    // One tile type on its own: 1 = complete groups, 2 = complete groups + the pair,
+    // 0 = can't be part of a win, -1 = the table can't answer (a tile held 5+ times)
+    static int TypeStatus(const TileCounts& counts, int type) {
+        // Zero tiles never form consecutives: only triplets and a pair
+        int zeros = counts[type * 10];
+        if (zeros % 3 == 1) return 0;
+
+        unsigned int key = 0;
+        int typeTiles = 0;
+        for (int value = 1; value <= 9; value++) {
+            int count = counts[type * 10 + value];
+            if (count > 4) return -1;
+            key |= (unsigned int)count << ((value - 1) * 3);
+            typeTiles += count;
+        }
+        if (typeTiles % 3 == 1) return 0;
+        if (!IsAgariShape(key)) return 0;
+
+        int pairs = (zeros % 3 == 2 ? 1 : 0) + (typeTiles % 3 == 2 ? 1 : 0);
+        if (pairs > 1) return 0; // Two pairs can never be a win
+        return 1 + pairs;
+    }
+
+    // WAITS: bit (type * 10 + value) set if adding that tile completes the hand
+    // The hand's per-type results are shared; each candidate only re-checks its own type
+    unsigned int WinningTiles(TileCounts& counts, int requiredGroups) {
+        int totalTiles = 0;
+        for (int i = 0; i < TileCounts::SLOTS; i++) {
+            totalTiles += counts[i];
+        }
+        if (totalTiles + 1 != requiredGroups * 3 + 2) return 0;
+
+        int status[3];
+        for (int type = 0; type < 3; type++) {
+            status[type] = TypeStatus(counts, type);
+        }
+
+        unsigned int winningTiles = 0;
+        for (int slot = 0; slot < TileCounts::SLOTS; slot++) {
+            if (slot == 10 || slot == 20) continue; // Only PLAIN has a zero tile
+            int type = slot / 10;
+
+            // A broken type elsewhere can't be fixed by a tile of this type
+            bool othersBroken = false;
+            for (int other = 0; other < 3; other++) {
+                if (other != type && status[other] == 0) othersBroken = true;
+            }
+            if (othersBroken) continue;
+
+            counts[slot]++;
+            int candidate[3] = {status[0], status[1], status[2]};
+            candidate[type] = TypeStatus(counts, type);
+
+            bool wins;
+            if (candidate[0] < 0 || candidate[1] < 0 || candidate[2] < 0) {
+                wins = CanComplete(counts, totalTiles + 1); // Rare: fall back to the search
+            } else {
+                wins = candidate[0] > 0 && candidate[1] > 0 && candidate[2] > 0 &&
+                       (candidate[0] - 1) + (candidate[1] - 1) + (candidate[2] - 1) == 1;
+            }
+            counts[slot]--;
+
+            if (wins) winningTiles |= 1u << slot;
+        }
+        return winningTiles;
+    }
+
+    // A hand holds at most 14 tiles, so every count fits in 4 bits
+    static void PackHand(const TileCounts& counts, unsigned long long& low, unsigned long long& high) {
+        low = 0;
+        high = 0;
+        for (int i = 0; i < 15; i++) {
+            low |= (unsigned long long)counts[i] << (i * 4);
+            high |= (unsigned long long)counts[i + 15] << (i * 4);
+        }
+    }
+
+    bool CanComplete(TileCounts& counts, int remainingTiles) {
+        if (remainingTiles == 0) return true;
+
+        unsigned long long low, high;
+        PackHand(counts, low, high);
+        unsigned long long hash = (low ^ (high * 0x9E3779B97F4A7C15ULL)) * 0xBF58476D1CE4E5B9ULL;
+        MemoEntry& entry = memo[(hash >> 40) & (MEMO_SIZE - 1)];
+        if (entry.used && entry.low == low && entry.high == high) {
+            return entry.result;
+        }
+
+        // Lowest remaining tile (canonical order)
+        int i = 0;
+        while (counts[i] == 0) i++;
+
+        bool pairNeeded = (remainingTiles % 3 == 2);
+        bool result = false;
+
+        // Lowest tile as the pair
+        if (pairNeeded && counts[i] >= 2) {
+            counts[i] -= 2;
+            result = CanComplete(counts, remainingTiles - 2);
+            counts[i] += 2;
+        }
+
+        // Lowest tile as a triplet (zeros included)
+        if (!result && counts[i] >= 3) {
+            counts[i] -= 3;
+            result = CanComplete(counts, remainingTiles - 3);
+            counts[i] += 3;
+        }
+
+        // Lowest tile as the start of a consecutive (1-2-3 to 7-8-9, same type)
+        int value = i % 10;
+        if (!result && value >= 1 && value <= 7 && counts[i + 1] > 0 && counts[i + 2] > 0) {
+            counts[i]--;
+            counts[i + 1]--;
+            counts[i + 2]--;
+            result = CanComplete(counts, remainingTiles - 3);
+            counts[i]++;
+            counts[i + 1]++;
+            counts[i + 2]++;
+        }
+
+        entry.low = low;
+        entry.high = high;
+        entry.used = true;
+        entry.result = result;
+        return result;
+    }
+
+    // BATCH EVALUATION (offline balance analysis): one packed hand per entry
+    // suits[type] = counts of values 1-9, 3 bits each (the agari table key),
+    // plus the zero tile count in bits 27-29
+    struct PackedHand {
+        unsigned int suits[3];
+    };
+
+    static const unsigned int SUIT_KEY_MASK = 0x7FFFFFF;
+    static const unsigned int FIELD_LOW_BITS = 0x1249249;  // Bit 0 of every 3-bit count
+    static const unsigned int FIELD_MID_BITS = 0x2492492;  // Bit 1
+    static const unsigned int FIELD_HIGH_BITS = 0x4924924; // Bit 2
+    static const unsigned int WIN_SIZES = (1u << 5) | (1u << 8) | (1u << 11) | (1u << 14);
+
+    // False if a tile is held more than 7 times (doesn't fit in 3 bits)
+    static bool PackSuits(const TileCounts& counts, PackedHand& hand) {
+        for (int type = 0; type < 3; type++) {
+            unsigned int suit = 0;
+            for (int value = 0; value <= 9; value++) {
+                int count = counts[type * 10 + value];
+                if (count > 7) return false;
+                suit |= (unsigned int)count << (value == 0 ? 27 : (value - 1) * 3);
+            }
+            hand.suits[type] = suit;
+        }
+        return true;
+    }
+
+    static TileCounts UnpackSuits(const PackedHand& hand) {
+        TileCounts counts;
+        for (int type = 0; type < 3; type++) {
+            counts[type * 10] = hand.suits[type] >> 27;
+            for (int value = 1; value <= 9; value++) {
+                counts[type * 10 + value] = (hand.suits[type] >> ((value - 1) * 3)) & 7;
+            }
+        }
+        return counts;
+    }
+
+    // Same answer as MahjongTiles::CheckWinCondition for the hand plus the new tile
+    bool EvaluatePacked(const PackedHand& hand, bool loongEnabled) {
+        int totalTiles = 0;
+        int pairGroups = 0;
+        bool broken = false;
+        bool unknown = false;
+        bool loongWin = false;
+
+        for (int type = 0; type < 3; type++) {
+            unsigned int key = hand.suits[type] & SUIT_KEY_MASK;
+            int zeros = hand.suits[type] >> 27;
+            int typeTiles = 0;
+            bool overFour = false;
+            bool allValues = true;
+            for (int value = 0; value < 9; value++) {
+                int count = (key >> (value * 3)) & 7;
+                typeTiles += count;
+                if (count > 4) overFour = true;
+                if (count == 0) allValues = false;
+            }
+            totalTiles += typeTiles + zeros;
+            if (zeros == 0 && allValues) loongWin = true;
+
+            // Same order of checks as TypeStatus
+            if (broken) continue;
+            if (zeros % 3 == 1) {
+                broken = true;
+            } else if (overFour) {
+                unknown = true;
+            } else {
+                int pairs = (zeros % 3 == 2 ? 1 : 0) + (typeTiles % 3 == 2 ? 1 : 0);
+                if (typeTiles % 3 == 1 || pairs > 1 || !IsAgariShape(key)) broken = true;
+                pairGroups += pairs;
+            }
+        }
+
+        if (!((WIN_SIZES >> totalTiles) & 1u)) return false; // Not 5, 8, 11 or 14 tiles
+        if (loongEnabled && loongWin) return true;
+        if (broken) return false;
+        if (unknown) {
+            TileCounts counts = UnpackSuits(hand);
+            return CanComplete(counts, totalTiles); // Rare: a tile held 5+ times
+        }
+        return pairGroups == 1;
+    }
+
+    // Bit i of winBits[i / 64] = EvaluatePacked(hands[i]); winBits needs (handCount + 63) / 64 words
+    void EvaluateBatch(const PackedHand* hands, int handCount, bool loongEnabled, unsigned long long* winBits) {
+        for (int word = 0; word < (handCount + 63) / 64; word++) {
+            winBits[word] = 0;
+        }
+
+        int done = 0;
+#ifdef LOONG_AVX2_KERNEL
+        if (__builtin_cpu_supports("avx2")) {
+            done = EvaluateBatchAVX2(hands, handCount, loongEnabled, winBits);
+        }
+#endif
+        for (int i = done; i < handCount; i++) {
+            if (EvaluatePacked(hands[i], loongEnabled)) {
+                winBits[i / 64] |= 1ULL << (i % 64);
+            }
+        }
+    }
+
+#ifdef LOONG_AVX2_KERNEL
+    // 8 hands per step, every count field handled with bit tricks and the agari
+    // lookups done with gathers. Hands the table can't answer go through EvaluatePacked.
+    // Returns how many hands were done (a multiple of 8)
+    __attribute__((target("avx2")))
+    int EvaluateBatchAVX2(const PackedHand* hands, int handCount, bool loongEnabled, unsigned long long* winBits) {
+        const __m256i handOffsets = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+        const __m256i keyMask = _mm256_set1_epi32(SUIT_KEY_MASK);
+        const __m256i lowBits = _mm256_set1_epi32(FIELD_LOW_BITS);
+        const __m256i midBits = _mm256_set1_epi32(FIELD_MID_BITS);
+        const __m256i highBits = _mm256_set1_epi32(FIELD_HIGH_BITS);
+        const __m256i evenFields = _mm256_set1_epi32(0x71C71C7); // Counts 1, 3, 5, 7, 9
+        const __m256i sumFields = _mm256_set1_epi32(0x1041041);  // Adds the 6-bit fields into bits 24-29
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i one = _mm256_set1_epi32(1);
+        const __m256i two = _mm256_set1_epi32(2);
+        const __m256i three = _mm256_set1_epi32(3);
+        const __m256i divideBy3 = _mm256_set1_epi32(43); // (x * 43) >> 7 == x / 3 for x < 128
+
+        int done = 0;
+        for (; done + 8 <= handCount; done += 8) {
+            const int* base = (const int*)(hands + done);
+            __m256i broken = zero, unknown = zero, loongWin = zero;
+            __m256i pairGroups = zero, totalTiles = zero;
+
+            for (int type = 0; type < 3; type++) {
+                __m256i suit = _mm256_i32gather_epi32(base + type, handOffsets, 4);
+                __m256i key = _mm256_and_si256(suit, keyMask);
+                __m256i zeros = _mm256_srli_epi32(suit, 27);
+
+                // A count above 4 has bit 2 set plus bit 1 or bit 0
+                __m256i lowUp = _mm256_slli_epi32(_mm256_and_si256(key, lowBits), 2);
+                __m256i midUp = _mm256_slli_epi32(_mm256_and_si256(key, midBits), 1);
+                __m256i overFour = _mm256_and_si256(_mm256_and_si256(key, highBits), _mm256_or_si256(lowUp, midUp));
+                overFour = _mm256_xor_si256(_mm256_cmpeq_epi32(overFour, zero), _mm256_set1_epi32(-1));
+
+                // Tile count of the type: pair up neighbouring fields, then sum with one multiply
+                __m256i paired = _mm256_add_epi32(_mm256_and_si256(key, evenFields),
+                                                  _mm256_and_si256(_mm256_srli_epi32(key, 3), evenFields));
+                __m256i typeTiles = _mm256_srli_epi32(_mm256_mullo_epi32(paired, sumFields), 24);
+                typeTiles = _mm256_and_si256(typeTiles, _mm256_set1_epi32(0x3F));
+                totalTiles = _mm256_add_epi32(totalTiles, _mm256_add_epi32(typeTiles, zeros));
+
+                __m256i tilesMod3 = _mm256_sub_epi32(typeTiles, _mm256_mullo_epi32(three,
+                    _mm256_srli_epi32(_mm256_mullo_epi32(typeTiles, divideBy3), 7)));
+                __m256i zerosMod3 = _mm256_sub_epi32(zeros, _mm256_mullo_epi32(three,
+                    _mm256_srli_epi32(_mm256_mullo_epi32(zeros, divideBy3), 7)));
+
+                // Agari table: same perfect hash as IsAgariShape, seeds read as 16-bit halves
+                __m256i bucket = _mm256_srli_epi32(_mm256_mullo_epi32(key, _mm256_set1_epi32(0x9E3779B1)), 32 - AGARI_BUCKET_BITS);
+                __m256i seedWords = _mm256_i32gather_epi32((const int*)agariSeeds, _mm256_srli_epi32(bucket, 1), 4);
+                __m256i seed = _mm256_srlv_epi32(seedWords, _mm256_slli_epi32(_mm256_and_si256(bucket, one), 4));
+                seed = _mm256_and_si256(seed, _mm256_set1_epi32(0xFFFF));
+                __m256i slot = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_xor_si256(key, seed), _mm256_set1_epi32(0x85EBCA6B)), 32 - AGARI_SLOT_BITS);
+                __m256i found = _mm256_cmpeq_epi32(_mm256_i32gather_epi32((const int*)agariSlots, slot, 4), key);
+
+                // Same order of checks as TypeStatus (a broken type before stays broken)
+                __m256i pairs = _mm256_sub_epi32(zero, _mm256_add_epi32(_mm256_cmpeq_epi32(zerosMod3, two),
+                                                                        _mm256_cmpeq_epi32(tilesMod3, two)));
+                __m256i shapeBroken = _mm256_or_si256(_mm256_cmpeq_epi32(tilesMod3, one),
+                                      _mm256_or_si256(_mm256_cmpgt_epi32(pairs, one),
+                                                      _mm256_xor_si256(found, _mm256_set1_epi32(-1))));
+                __m256i zerosBroken = _mm256_cmpeq_epi32(zerosMod3, one);
+                __m256i typeBroken = _mm256_or_si256(zerosBroken, _mm256_andnot_si256(overFour, shapeBroken));
+                unknown = _mm256_or_si256(unknown, _mm256_andnot_si256(_mm256_or_si256(broken, zerosBroken), overFour));
+                broken = _mm256_or_si256(broken, typeBroken);
+                pairGroups = _mm256_add_epi32(pairGroups, pairs);
+
+                // LOONG: every value 1-9 held and no zero tile of this type
+                __m256i held = _mm256_and_si256(_mm256_or_si256(key, _mm256_or_si256(_mm256_srli_epi32(key, 1), _mm256_srli_epi32(key, 2))), lowBits);
+                loongWin = _mm256_or_si256(loongWin, _mm256_and_si256(_mm256_cmpeq_epi32(held, lowBits), _mm256_cmpeq_epi32(zeros, zero)));
+            }
+
+            // srlv gives 0 for shifts of 32+, so oversized hands fail the size test too
+            __m256i sizeOk = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32(WIN_SIZES), totalTiles), one), one);
+            __m256i mahjongWin = _mm256_andnot_si256(_mm256_or_si256(broken, unknown), _mm256_cmpeq_epi32(pairGroups, one));
+            if (!loongEnabled) loongWin = zero;
+            __m256i win = _mm256_and_si256(sizeOk, _mm256_or_si256(mahjongWin, loongWin));
+
+            unsigned int winMask = _mm256_movemask_ps(_mm256_castsi256_ps(win));
+            unsigned int searchMask = _mm256_movemask_ps(_mm256_castsi256_ps(
+                _mm256_andnot_si256(_mm256_or_si256(win, broken), _mm256_and_si256(sizeOk, unknown))));
+            for (; searchMask != 0; searchMask &= searchMask - 1) {
+                int lane = __builtin_ctz(searchMask);
+                if (EvaluatePacked(hands[done + lane], loongEnabled)) winMask |= 1u << lane;
+            }
+            winBits[done / 64] |= (unsigned long long)winMask << (done % 64);
+        }
+        return done;
+    }
+#endif
+};
+
+inline thread_local WinEvaluator winEvaluator; // Shared memo: results depend only on the hand (one per thread)
+
+// SWAPS FROM MAHJONG (shanten): how many tiles must be swapped before one more tile can win
+// A hand of 3R+1 tiles is split into blocks: groups (3 tiles), partial groups (2 tiles that
+// need one more: 5-5, 5-6, 5-7) and the pair. Leftover tiles can still seed an unfilled group
+// or the pair. Blocks never mix tile types, so each type is searched on its own and the
+// results are combined. Tile pool limits (4 copies, KONG tiles) are not considered.
+class ShantenCalculator {
+public:
+    static const int MEMO_SIZE = 4096; // Direct-mapped cache of per-type results
+    static const int MAX_BLOCKS = 4;   // More than 4 groups / partials never matters
+
+    struct MemoEntry {
+        unsigned long long key;
+        unsigned long long shapes;
+        bool used;
+    };
+
+    MemoEntry memo[MEMO_SIZE];
+
+    ShantenCalculator() {
+        for (int i = 0; i < MEMO_SIZE; i++) {
+            memo[i].used = false;
+        }
+    }
+
+    // One bit per reachable (groups, partials, pair) combination
+    static int ShapeBit(int groups, int partials, int pair) {
+        return ((min(groups, MAX_BLOCKS) * (MAX_BLOCKS + 1) + min(partials, MAX_BLOCKS)) * 2 + pair);
+    }
+
+    // Every block combination one tile type (slots type*10 .. type*10+9) can form
+    unsigned long long TypeShapes(const TileCounts& counts, int type) {
+        int typeCounts[10];
+        unsigned long long key = 0;
+        for (int value = 0; value <= 9; value++) {
+            typeCounts[value] = counts[type * 10 + value];
+            key |= (unsigned long long)typeCounts[value] << (value * 4);
+        }
+
+        MemoEntry& entry = memo[((key * 0x9E3779B97F4A7C15ULL) >> 40) & (MEMO_SIZE - 1)];
+        if (entry.used && entry.key == key) {
+            return entry.shapes;
+        }
+
+        unsigned long long shapes = 0;
+        SearchBlocks(typeCounts, 10, 0, 0, 0, 0, shapes);
+
+        entry.key = key;
+        entry.shapes = shapes;
+        entry.used = true;
+        return shapes;
+    }
+
+    // Block search over the lowest remaining tile (value 0 never starts a consecutive)
+    static void SearchBlocks(int* counts, int slotCount, int index, int groups, int partials, int pair, unsigned long long& shapes) {
+        while (index < slotCount && counts[index] == 0) index++;
+        if (index == slotCount) {
+            shapes |= 1ULL << ShapeBit(groups, partials, pair);
+            return;
+        }
+
+        int value = index % 10;
+        bool next1 = value >= 1 && value <= 8 && counts[index + 1] > 0;
+        bool next2 = value >= 1 && value <= 7 && counts[index + 2] > 0;
+
+        if (counts[index] >= 3) { // Triplet
+            counts[index] -= 3;
+            SearchBlocks(counts, slotCount, index, groups + 1, partials, pair, shapes);
+            counts[index] += 3;
+        }
+        if (next1 && next2) { // Consecutive
+            counts[index]--; counts[index + 1]--; counts[index + 2]--;
+            SearchBlocks(counts, slotCount, index, groups + 1, partials, pair, shapes);
+            counts[index]++; counts[index + 1]++; counts[index + 2]++;
+        }
+        if (counts[index] >= 2) { // The pair, or a partial triplet
+            counts[index] -= 2;
+            if (pair == 0) SearchBlocks(counts, slotCount, index, groups, partials, 1, shapes);
+            SearchBlocks(counts, slotCount, index, groups, partials + 1, pair, shapes);
+            counts[index] += 2;
+        }
+        if (next1) { // Partial consecutive 5-6
+            counts[index]--; counts[index + 1]--;
+            SearchBlocks(counts, slotCount, index, groups, partials + 1, pair, shapes);
+            counts[index]++; counts[index + 1]++;
+        }
+        if (next2) { // Partial consecutive 5-7
+            counts[index]--; counts[index + 2]--;
+            SearchBlocks(counts, slotCount, index, groups, partials + 1, pair, shapes);
+            counts[index]++; counts[index + 2]++;
+        }
+
+        // Leave one copy as a leftover tile
+        counts[index]--;
+        SearchBlocks(counts, slotCount, index, groups, partials, pair, shapes);
+        counts[index]++;
+    }
+
+    // Tiles of the final winning hand the current hand already provides
+    static int UsefulTiles(int groups, int partials, int pair, int handSize, int requiredGroups) {
+        groups = min(groups, requiredGroups);
+        partials = min(partials, requiredGroups - groups);
+        int emptySlots = (requiredGroups - groups - partials) + (1 - pair);
+        int leftovers = handSize - groups * 3 - partials * 2 - pair * 2;
+        return groups * 3 + partials * 2 + pair * 2 + min(leftovers, emptySlots);
+    }
+
+    // Combine the three per-type results into the swap count for the whole hand
+    static int CombineTypes(const unsigned long long typeShapes[3], int handSize, int requiredGroups) {
+        // Merge the first two types, then pair the result with the third (set bits only)
+        unsigned long long merged = 0;
+        for (unsigned long long maskA = typeShapes[0]; maskA; maskA &= maskA - 1) {
+            int a = __builtin_ctzll(maskA);
+            for (unsigned long long maskB = typeShapes[1]; maskB; maskB &= maskB - 1) {
+                int b = __builtin_ctzll(maskB);
+                int pair = (a & 1) + (b & 1);
+                if (pair > 1) continue;
+                int groups = a / 2 / (MAX_BLOCKS + 1) + b / 2 / (MAX_BLOCKS + 1);
+                int partials = a / 2 % (MAX_BLOCKS + 1) + b / 2 % (MAX_BLOCKS + 1);
+                merged |= 1ULL << ShapeBit(groups, partials, pair);
+            }
+        }
+
+        int bestUseful = 0;
+        for (unsigned long long maskA = merged; maskA; maskA &= maskA - 1) {
+            int a = __builtin_ctzll(maskA);
+            for (unsigned long long maskC = typeShapes[2]; maskC; maskC &= maskC - 1) {
+                int c = __builtin_ctzll(maskC);
+                int pair = (a & 1) + (c & 1);
+                if (pair > 1) continue;
+                int groups = a / 2 / (MAX_BLOCKS + 1) + c / 2 / (MAX_BLOCKS + 1);
+                int partials = a / 2 % (MAX_BLOCKS + 1) + c / 2 % (MAX_BLOCKS + 1);
+                bestUseful = max(bestUseful, UsefulTiles(groups, partials, pair, handSize, requiredGroups));
+            }
+        }
+
+        return requiredGroups * 3 + 1 - bestUseful;
+    }
+
+    // BRUTE FORCE: one block search over the whole hand, no per-type split and no memo
+    static int FullRecompute(const TileCounts& counts, int handSize, int requiredGroups) {
+        int allCounts[TileCounts::SLOTS];
+        for (int i = 0; i < TileCounts::SLOTS; i++) allCounts[i] = counts[i];
+
+        int bestUseful = 0;
+        FullSearch(allCounts, 0, 0, 0, 0, handSize, requiredGroups, bestUseful);
+        return requiredGroups * 3 + 1 - bestUseful;
+    }
+
+    static void FullSearch(int* counts, int index, int groups, int partials, int pair, int handSize, int requiredGroups, int& bestUseful) {
+        while (index < TileCounts::SLOTS && counts[index] == 0) index++;
+        if (index == TileCounts::SLOTS) {
+            bestUseful = max(bestUseful, UsefulTiles(groups, partials, pair, handSize, requiredGroups));
+            return;
+        }
+
+        int value = index % 10;
+        bool next1 = value >= 1 && value <= 8 && counts[index + 1] > 0;
+        bool next2 = value >= 1 && value <= 7 && counts[index + 2] > 0;
+
+        if (counts[index] >= 3) {
+            counts[index] -= 3;
+            FullSearch(counts, index, groups + 1, partials, pair, handSize, requiredGroups, bestUseful);
+            counts[index] += 3;
+        }
+        if (next1 && next2) {
+            counts[index]--; counts[index + 1]--; counts[index + 2]--;
+            FullSearch(counts, index, groups + 1, partials, pair, handSize, requiredGroups, bestUseful);
+            counts[index]++; counts[index + 1]++; counts[index + 2]++;
+        }
+        if (counts[index] >= 2) {
+            counts[index] -= 2;
+            if (pair == 0) FullSearch(counts, index, groups, partials, 1, handSize, requiredGroups, bestUseful);
+            FullSearch(counts, index, groups, partials + 1, pair, handSize, requiredGroups, bestUseful);
+            counts[index] += 2;
+        }
+        if (next1) {
+            counts[index]--; counts[index + 1]--;
+            FullSearch(counts, index, groups, partials + 1, pair, handSize, requiredGroups, bestUseful);
+            counts[index]++; counts[index + 1]++;
+        }
+        if (next2) {
+            counts[index]--; counts[index + 2]--;
+            FullSearch(counts, index, groups, partials + 1, pair, handSize, requiredGroups, bestUseful);
+            counts[index]++; counts[index + 2]++;
+        }
+        counts[index]--;
+        FullSearch(counts, index, groups, partials, pair, handSize, requiredGroups, bestUseful);
+        counts[index]++;
+    }
+};
+
+inline thread_local ShantenCalculator shantenCalculator; // Shared memo of per-type block results (one per thread)
+
+// TILE WALL: every tile copy that can still be drawn, in shuffled order
+// positions[] groups the copies by tile, so a chosen tile (weighted draws, KONG)
+// comes out in O(1) just like the top of the wall
+class TileWall {
+public:
+    static const int COPIES = 4; // Copies of each tile in a full wall
+    static const int MAX_TILES = TileCounts::SLOTS * COPIES;
+
+    unsigned char wall[MAX_TILES]; // Slot of every copy, top of the wall at size - 1
+    unsigned char slotIndex[MAX_TILES]; // Where wall[i] sits in positions[wall[i]]
+    unsigned char positions[TileCounts::SLOTS][COPIES]; // Wall index of every copy of a slot
+    int remaining[TileCounts::SLOTS];
+    int size;
+
+    TileWall() {
+        Clear();
+    }
+
+    void Clear() {
+        size = 0;
+        for (int slot = 0; slot < TileCounts::SLOTS; slot++) remaining[slot] = 0;
+    }
+
+    int Size() const { return size; }
+    int Remaining(int slot) const { return remaining[slot]; }
+
+    // Put one copy back at a random depth (one inside-out Fisher-Yates step)
+    void Return(int slot, RandomGenerator& random) {
+        if (remaining[slot] >= COPIES) return; // Never more than 4 of a tile
+        Place(size, slot);
+        size++;
+        Swap(random.Value(0, size - 1), size - 1);
+    }
+
+    int DrawTop() {
+        int slot = wall[size - 1];
+        RemoveAt(size - 1);
+        return slot;
+    }
+
+    // Pull one copy of a chosen tile out of the wall (caller checks Remaining first)
+    void Take(int slot) {
+        RemoveAt(positions[slot][remaining[slot] - 1]);
+    }
+
+    void TakeAll(int slot) {
+        while (remaining[slot] > 0) Take(slot);
+    }
+
+    void Place(int index, int slot) {
+        wall[index] = slot;
+        slotIndex[index] = remaining[slot];
+        positions[slot][remaining[slot]++] = index;
+    }
+
+    void Swap(int a, int b) {
+        int slotA = wall[a], slotB = wall[b];
+        int copyA = slotIndex[a], copyB = slotIndex[b];
+        wall[a] = slotB;
+        slotIndex[a] = copyB;
+        positions[slotB][copyB] = a;
+        wall[b] = slotA;
+        slotIndex[b] = copyA;
+        positions[slotA][copyA] = b;
+    }
+
+    // Swap-remove: the last copy of the slot fills the hole in positions[],
+    // the top of the wall fills the hole in wall[]
+    void RemoveAt(int index) {
+        int slot = wall[index];
+        int lastCopy = positions[slot][--remaining[slot]];
+        positions[slot][slotIndex[index]] = lastCopy;
+        slotIndex[lastCopy] = slotIndex[index];
+
+        size--;
+        if (index != size) {
+            wall[index] = wall[size];
+            slotIndex[index] = slotIndex[size];
+            positions[wall[index]][slotIndex[index]] = index;
+        }
+    }
+};
+
+// WEIGHTED TILE SAMPLER: sum tree over the 30 tile slots
+// Every node holds the sum of its two children, so changing one weight updates 5 nodes
+// and a draw walks from the root down to one leaf
+class TileSampler {
+public:
+    static const int LEAVES = 32; // TileCounts::SLOTS rounded up to a power of two
+
+    float tree[LEAVES * 2]; // tree[1] = total weight, leaf for slot i at LEAVES + i
+
+    TileSampler() {
+        for (int i = 0; i < LEAVES * 2; i++) tree[i] = 0.0f;
+    }
+
+    void SetWeight(int slot, float weight) {
+        int node = LEAVES + slot;
+        tree[node] = weight;
+        for (node /= 2; node >= 1; node /= 2) {
+            tree[node] = tree[node * 2] + tree[node * 2 + 1];
+        }
+    }
+
+    // Set every leaf, then rebuild the sums bottom-up once
+    void SetAllWeights(const float* weights, int count) {
+        for (int i = 0; i < LEAVES; i++) {
+            tree[LEAVES + i] = i < count ? weights[i] : 0.0f;
+        }
+        for (int node = LEAVES - 1; node >= 1; node--) {
+            tree[node] = tree[node * 2] + tree[node * 2 + 1];
+        }
+    }
+
+    float Weight(int slot) const { return tree[LEAVES + slot]; }
+    float TotalWeight() const { return tree[1]; }
+
+    // fraction in [0, 1): picks slot i with probability weight(i) / total
+    int Sample(double fraction) const {
+        double target = fraction * tree[1];
+        int node = 1;
+        while (node < LEAVES) {
+            int left = node * 2;
+            // Never step into an empty subtree, even on float rounding at the edges
+            if (target < tree[left] || tree[left + 1] <= 0.0f) {
+                node = left;
+            } else {
+                target -= tree[left];
+                node = left + 1;
+            }
+        }
+        return node - LEAVES;
+    }
+};
+
+// WAIT TABLE: for every arrow position (each tile + KEEP), which draws win the fruit after
+// Position p is the hand after the current nextTile replaces tile p (KEEP leaves it as is)
+struct WaitTable {
+    static const int MAX_POSITIONS = 14; // 13 tiles + KEEP
+
+    unsigned int winningTiles[MAX_POSITIONS]; // Bit (type * 10 + value) set if that draw wins
+    int winningDraws[MAX_POSITIONS]; // Copies of those tiles still in the pool
+    int positions; // maxTiles + 1 (KEEP is the last one)
+
+    // What the table was built from (rebuilt lazily when any of these change)
+    int tilesVersion;
+    Tile nextTile;
+    int ornateLevel;
+    bool valid;
+
+    WaitTable() : positions(0), tilesVersion(0), ornateLevel(0), valid(false) {
+        for (int i = 0; i < MAX_POSITIONS; i++) {
+            winningTiles[i] = 0;
+            winningDraws[i] = 0;
+        }
+    }
+};
+
+// Enhanced tile popup system - NOW AFTER Tile definitions
+struct NumberPopup {
+    Tile tile;
+    Vector2 position; // Cell the tile was picked up at
+    float timer;
+    bool active;
+
+    NumberPopup() : tile(1, PLAIN_TILES, false), position({0, 0}), timer(0), active(false) {}
+
+    void Show(const Tile& newTile, Vector2 pos) {
+        tile = newTile;
+        position = pos;
+        timer = 1.2f; // Show for 1.2 seconds for better visibility
+        active = true;
+    }
+
+    void Update(float deltaTime) {
+        if (active) {
+            timer -= deltaTime;
+            if (timer <= 0) {
+                active = false;
+            }
+        }
+    }
+};
+
+class MahjongTiles {
+public:
+    static const unsigned int ZERO_TILE_BITS = (1u << 0) | (1u << 10) | (1u << 20); // Zero slot of each type
+    vector<Tile> tiles;
+    int arrowPosition;
+    TileWall wall; // Tiles left to draw: 4 of each enabled tile minus hand, preview, discards and KONGs
+    RandomGenerator random; // Tile stream, seeded by GameCore::SeedRun
+    unsigned int goldTiles; // Bit per TileCounts slot: tiles that are KONG (removed from pool)
+    int maxTiles; // Maximum number of tiles (4, 7, 10, 13)
+    unsigned int availableTypes; // Bit per TileType: which tile types are available
+
+    // Tile tracker system
+    vector<Tile> discardPile; // All tiles we've discarded (for display)
+    TileCounts totalDiscardCounts; // Total count of each tile discarded
+    bool canReshuffle; // Whether reshuffle is available
+    Tile nextTile; // Preview of next tile to be generated
+
+    // SWAPS FROM MAHJONG tracker (kept up to date as the hand changes)
+    TileCounts handCounts; // Histogram of the tiles currently in hand
+    unsigned long long typeShapes[3]; // Per-type block results for the current hand
+    int swapsFromMahjong; // 0 = the right next tile wins
+    bool shantenCrossCheck; // Validate every update against a full recompute
+
+    // WAIT TABLE (see GetWaitTable)
+    WaitTable waitTable;
+
+    // Draw weights for GenerateValidTile, kept in step with the hand and the pool
+    TileSampler tileSampler;
+    float samplerBonus; // probabilityBonus the current weights were built with
+    int tilesVersion; // Bumped whenever the hand, the tile pool or KONG tiles change
+
+    // TILE LOCKING SYSTEM (White LOONG Future Sight)
+    vector<Tile> lockedFutureTiles; // The 3 locked future tiles
+    bool futureTilesLocked; // Are future tiles currently locked?
+    int lockedTilesRemaining; // How many locked tiles are left
+
+    GameLog gameLog; // Not part of the state: left alone by snapshots
+
+    explicit MahjongTiles(GameLog gameLog = GameLog()) : gameLog(gameLog) {
+        arrowPosition = 0;
+        maxTiles = 4; // Start with 4 tiles
+        goldTiles = 0;
+        availableTypes = 1u << PLAIN_TILES; // Start with only plain tiles
+        canReshuffle = false; // Start with no reshuffle available
+
+        // Initialize tile locking system
+        futureTilesLocked = false;
+        lockedTilesRemaining = 0;
+
+        swapsFromMahjong = 0;
+        tilesVersion = 0;
+        samplerBonus = 0.0f;
+#ifdef LOONG_SHANTEN_CHECK
+        shantenCrossCheck = true; // Debug build: validate every tracker update
+#else
+        shantenCrossCheck = false;
+#endif
+
+        // No preview yet (a zero tile never comes from the wall)
+        nextTile = Tile(0, PLAIN_TILES, false);
+        totalDiscardCounts.Clear();
+        GenerateRandomTiles(0); // Start with no latent level selected
+        GenerateNextTile(); // Generate first preview tile
+
+        // Test the advanced Mahjong algorithm on startup
+        // TestMahjongLogic(); // Disabled for release
+    }
+
+    // Everything but shantenCrossCheck, which is a build setting (see GameCore::SaveSnapshot)
+    template <class Archive> void SnapshotFields(Archive& archive) {
+        archive.Field(tiles);
+        archive.Field(arrowPosition);
+        archive.Field(wall);
+        archive.Field(random);
+        archive.Field(goldTiles);
+        archive.Field(maxTiles);
+        archive.Field(availableTypes);
+        archive.Field(discardPile);
+        archive.Field(totalDiscardCounts);
+        archive.Field(canReshuffle);
+        archive.Field(nextTile);
+        archive.Field(handCounts);
+        archive.Field(typeShapes);
+        archive.Field(swapsFromMahjong);
+        archive.Field(waitTable);
+        archive.Field(tileSampler);
+        archive.Field(samplerBonus);
+        archive.Field(tilesVersion);
+        archive.Field(lockedFutureTiles);
+        archive.Field(futureTilesLocked);
+        archive.Field(lockedTilesRemaining);
+    }
+
+    void GenerateRandomTiles(int selectedLatentLevel = 0) {
+        // Reset the wall and gold tiles when drawing new hand (but keep used tiles tracker)
+        gameLog << "Resetting tile pool for new hand..." << endl;
+        goldTiles = 0;
+
+        tiles.clear();
+        FillWall();
+
+        // Add latent cultivation LOONG evolution tiles if a level is selected
+        gameLog << "GenerateRandomTiles called with selectedLatentLevel: " << selectedLatentLevel << endl;
+        if (selectedLatentLevel > 0) {
+            // This will be implemented by calling a function from the Game class
+            // since we need access to the current LOONG type and upgrade tile generation
+            gameLog << "Latent Cultivation Level " << selectedLatentLevel << " selected - evolution tiles will be added by Game class" << endl;
+        }
+
+        // Fill remaining slots with normal tiles
+        for (int i = tiles.size(); i < maxTiles; i++) {
+            Tile newTile = GenerateValidTile(); // Comes off the wall
+            tiles.push_back(newTile);
+        }
+        SortTiles();
+        RebuildHandTrackers();
+        arrowPosition = 0;
+        gameLog << "Generated " << maxTiles << " tiles: ";
+        for (const Tile& tile : tiles) {
+            gameLog << tile.ToString() << " ";
+        }
+        gameLog << endl;
+    }
+
+    void ShuffleExistingHand() {
+        // EARTHQUAKE SHUFFLE: Randomly swap tiles in existing hand without resetting
+        gameLog << "🌍 EARTHQUAKE SHUFFLE: Randomly rearranging existing hand..." << endl;
+
+        if (tiles.size() < 2) return; // Need at least 2 tiles to shuffle
+
+        // Perform multiple random swaps to shuffle the hand
+        int numSwaps = max(2, (int)tiles.size() / 2);
+        for (int i = 0; i < numSwaps; i++) {
+            int index1 = random.Value(0, tiles.size() - 1);
+            int index2 = random.Value(0, tiles.size() - 1);
+
+            if (index1 != index2) {
+                swap(tiles[index1], tiles[index2]);
+                gameLog << "Swapped positions " << index1 << " and " << index2 << endl;
+            }
+        }
+
+        // CRITICAL FIX: Always sort after shuffling
+        SortTiles();
+        CheckShanten(); // Same tiles, new order: nothing to update
+
+        gameLog << "Hand shuffled and sorted! New order: ";
+        for (const Tile& tile : tiles) {
+            gameLog << tile.ToString() << " ";
+        }
+        gameLog << endl;
+    }
+
+    Tile GenerateValidTile(float probabilityBonus = 0.0f) {
+        // Weights are kept up to date incrementally; only a new bonus needs a full refresh
+        if (probabilityBonus != samplerBonus) {
+            samplerBonus = probabilityBonus;
+            RefreshTileWeights();
+        }
+
+        if (wall.Size() == 0) {
+            gameLog << "Warning: No valid tiles available! Auto-reshuffling tile pool..." << endl;
+
+            // Clear gold tiles (except zeros which can KONG multiple times)
+            goldTiles &= ZERO_TILE_BITS;
+
+            // Everything not in hand goes back, so the wall can't come up empty again
+            FillWall();
+            gameLog << "Tile pool reshuffled! Generating new tile..." << endl;
+        }
+
+        int slot;
+        if (samplerBonus == 0.0f) {
+            // Every copy weighs the same: just take the top of the shuffled wall
+            slot = wall.DrawTop();
+        } else {
+            // Weighted random selection: 24 random bits, the full precision of a float
+            double fraction = (random.Value(0, 4095) * 4096.0 + random.Value(0, 4095)) / 16777216.0;
+            slot = tileSampler.Sample(fraction);
+            wall.Take(slot);
+        }
+        pair<int, TileType> chosen = TileCounts::Key(slot);
+
+        tilesVersion++;
+        RefreshTileWeight(slot);
+
+        return Tile(chosen.first, chosen.second, false);
+    }
+
+    void GenerateNextTile(float probabilityBonus = 0.0f) {
+        // Check if we have locked future tiles (White LOONG Future Sight)
+        if (futureTilesLocked && !lockedFutureTiles.empty() && lockedTilesRemaining > 0) {
+            // Use the next locked tile
+            nextTile = lockedFutureTiles[3 - lockedTilesRemaining]; // Get the correct locked tile
+            lockedTilesRemaining--;
+            gameLog << "Next tile (LOCKED): " << nextTile.ToString() << " (" << lockedTilesRemaining << " locked tiles remaining)" << endl;
+
+            // If no more locked tiles, disable the system
+            if (lockedTilesRemaining <= 0) {
+                futureTilesLocked = false;
+                lockedFutureTiles.clear();
+                gameLog << ">>> FUTURE SIGHT EXPIRED: No more locked tiles!" << endl;
+            }
+        } else {
+            // Normal tile generation
+            nextTile = GenerateValidTile(probabilityBonus);
+            gameLog << "Next tile preview: " << nextTile.ToString() << endl;
+        }
+    }
+
+    void SortTiles() {
+        sort(tiles.begin(), tiles.end(), [](const Tile& a, const Tile& b) {
+            if (a.type != b.type) return a.type < b.type; // Sort by type first
+            return a.value < b.value; // Then by value
+        });
+    }
+
+    void MoveArrowLeft() {
+        if (arrowPosition > 0) {
+            arrowPosition--;
+        }
+    }
+
+    void MoveArrowRight() {
+        if (arrowPosition < maxTiles) {  // Now includes KEEP option (position maxTiles)
+            arrowPosition++;
+        }
+    }
+
+    void MoveArrowToFarLeft() {
+        arrowPosition = 0;  // Jump to leftmost position
+    }
+
+    void MoveArrowToFarRight() {
+        arrowPosition = maxTiles;  // Jump to KEEP position
+    }
+
+    void ReplaceTileAtArrow(const Tile& newTile) {
+        if (arrowPosition < maxTiles) {  // Replace tile in hand
+            // Track the old tile before replacing (goes to discard)
+            Tile oldTile = tiles[arrowPosition];
+            AddToDiscardPile(oldTile);
+
+            tiles[arrowPosition] = newTile;
+            SortTiles();
+            UpdateHandTrackers(oldTile, newTile);
+            // Reset arrow to point to the new tile's position after sorting
+            for (int i = 0; i < (int)tiles.size(); i++) {
+                if (tiles[i] == newTile) {
+                    arrowPosition = i;
+                    break;
+                }
+            }
+        } else {
+            // KEEP was selected - new tile goes to discard pile
+            AddToDiscardPile(newTile);
+            gameLog << "KEEP selected - " << newTile.ToString() << " goes to discard pile" << endl;
+        }
+    }
+
+    bool IsKeepSelected() {
+        return arrowPosition == maxTiles; // KEEP is at position maxTiles
+    }
+
+    // Full rebuild of everything that follows the hand (new hand or new hand size)
+    void RebuildHandTrackers() {
+        tilesVersion++;
+        handCounts.Clear();
+        for (const Tile& tile : tiles) {
+            handCounts[{tile.value, tile.type}]++;
+        }
+        RefreshTileWeights();
+        for (int type = 0; type < 3; type++) {
+            typeShapes[type] = shantenCalculator.TypeShapes(handCounts, type);
+        }
+        swapsFromMahjong = ShantenCalculator::CombineTypes(typeShapes, tiles.size(), (maxTiles - 1) / 3);
+        CheckShanten();
+    }
+
+    // Incremental update: only the tile types that changed are searched again
+    void UpdateHandTrackers(const Tile& removedTile, const Tile& addedTile) {
+        tilesVersion++;
+        handCounts[{removedTile.value, removedTile.type}]--;
+        handCounts[{addedTile.value, addedTile.type}]++;
+        RefreshTileWeightsAround(removedTile);
+        RefreshTileWeightsAround(addedTile);
+        typeShapes[removedTile.type] = shantenCalculator.TypeShapes(handCounts, removedTile.type);
+        if (addedTile.type != removedTile.type) {
+            typeShapes[addedTile.type] = shantenCalculator.TypeShapes(handCounts, addedTile.type);
+        }
+        swapsFromMahjong = ShantenCalculator::CombineTypes(typeShapes, tiles.size(), (maxTiles - 1) / 3);
+        CheckShanten();
+    }
+
+    // Call after SetGold from outside: KONG tiles leave the wall
+    void PoolChanged() {
+        for (unsigned int bits = goldTiles; bits != 0; bits &= bits - 1) {
+            wall.TakeAll(__builtin_ctz(bits));
+        }
+        tilesVersion++;
+        RefreshTileWeights();
+    }
+
+    bool IsGold(const pair<int, TileType>& tileKey) const {
+        return (goldTiles >> TileCounts::Index(tileKey.first, tileKey.second)) & 1u;
+    }
+
+    void SetGold(const pair<int, TileType>& tileKey) {
+        goldTiles |= 1u << TileCounts::Index(tileKey.first, tileKey.second);
+    }
+
+    bool HasType(TileType type) const {
+        return (availableTypes >> type) & 1u;
+    }
+
+    void AddType(TileType type) {
+        availableTypes |= 1u << type;
+    }
+
+    int TypeCount() const {
+        return __builtin_popcount(availableTypes);
+    }
+
+    // Tiles out of the wall until the next reshuffle: the hand and the preview
+    TileCounts CountTilesOutsideWall() {
+        TileCounts outside;
+        for (const Tile& tile : tiles) {
+            outside[{tile.value, tile.type}]++;
+        }
+        outside[{nextTile.value, nextTile.type}]++;
+        return outside;
+    }
+
+    // Return copies of one tile until the wall holds all 4 that aren't outside it
+    void TopUpWall(int slot, const TileCounts& outside) {
+        for (int copies = wall.Remaining(slot) + outside[slot]; copies < TileWall::COPIES; copies++) {
+            wall.Return(slot, random);
+        }
+    }
+
+    // Fresh wall: 4 of every enabled non-KONG tile, minus the hand and the preview
+    void FillWall() {
+        wall.Clear();
+        TileCounts outside = CountTilesOutsideWall();
+        for (TileType type : {PLAIN_TILES, HAT_TILES, DOT_TILES}) {
+            if (!HasType(type)) continue;
+            for (int value = 1; value <= 9; value++) {
+                if (IsGold({value, type})) continue;
+                TopUpWall(TileCounts::Index(value, type), outside);
+            }
+        }
+        tilesVersion++;
+        RefreshTileWeights();
+    }
+
+    void AddTypeToWall(TileType type) {
+        TileCounts outside = CountTilesOutsideWall();
+        for (int value = 1; value <= 9; value++) {
+            TopUpWall(TileCounts::Index(value, type), outside);
+        }
+        tilesVersion++;
+        RefreshTileWeights();
+    }
+
+    // Draw weight of one tile slot for GenerateValidTile (0 = can't be drawn)
+    float TileWeight(int slot, float probabilityBonus) {
+        pair<int, TileType> tileKey = TileCounts::Key(slot);
+        int value = tileKey.first;
+        TileType type = tileKey.second;
+        if (value < 1) return 0.0f; // Zeros never come from the pool
+        if (!HasType(type)) return 0.0f;
+
+        // Skip if this tile is gold (KONG)
+        if (IsGold(tileKey)) return 0.0f;
+
+        // Skip if the wall has no copies left
+        int copies = wall.Remaining(slot);
+        if (copies == 0) return 0.0f;
+
+        float weight = 1.0f; // Base weight (always at least 1.0)
+
+        // PROBABILITY BONUS TYPE 1: Held tile boost (for KONG)
+        int heldCount = handCounts[tileKey];
+        if (heldCount > 0) {
+            // Cap the bonus to prevent overwhelming base weight
+            float heldBonus = min(3.0f, (probabilityBonus / 100.0f) * heldCount);
+            weight += heldBonus;
+        }
+
+        // PROBABILITY BONUS TYPE 2: Adjacent tile boost (for consecutive)
+        bool hasAdjacent = handCounts[{value - 1, type}] > 0 || (value < 9 && handCounts[{value + 1, type}] > 0);
+        if (hasAdjacent) {
+            // Cap the adjacent bonus to prevent overwhelming
+            float adjacentBonus = min(2.0f, probabilityBonus / 200.0f);
+            weight += adjacentBonus;
+        }
+
+        return weight * copies; // The weight is per copy still in the wall
+    }
+
+    void RefreshTileWeight(int slot) {
+        tileSampler.SetWeight(slot, TileWeight(slot, samplerBonus));
+    }
+
+    // A held tile changes its own weight and its neighbours' adjacent bonus
+    void RefreshTileWeightsAround(const Tile& tile) {
+        for (int value = max(1, tile.value - 1); value <= min(9, tile.value + 1); value++) {
+            RefreshTileWeight(TileCounts::Index(value, tile.type));
+        }
+    }
+
+    void RefreshTileWeights() {
+        float weights[TileCounts::SLOTS];
+        for (int slot = 0; slot < TileCounts::SLOTS; slot++) {
+            weights[slot] = TileWeight(slot, samplerBonus);
+        }
+        tileSampler.SetAllWeights(weights, TileCounts::SLOTS);
+    }
+
+    // Cross-check mode: compare the tracked value with a brute-force recompute
+    void CheckShanten() {
+        if (!shantenCrossCheck) return;
+
+        TileCounts actualCounts;
+        for (const Tile& tile : tiles) {
+            actualCounts[{tile.value, tile.type}]++;
+        }
+        int requiredGroups = (maxTiles - 1) / 3;
+        int expected = ShantenCalculator::FullRecompute(actualCounts, tiles.size(), requiredGroups);
+
+        // Independent check of the 0 case: some tile must complete the hand
+        bool canWin = false;
+        for (int i = 0; i < TileCounts::SLOTS && !canWin; i++) {
+            TileCounts withTile = actualCounts;
+            withTile[i]++;
+            canWin = winEvaluator.IsWinningHand(withTile, requiredGroups);
+        }
+
+        if (swapsFromMahjong != expected || (swapsFromMahjong == 0) != canWin) {
+            gameLog << "SHANTEN MISMATCH: tracked " << swapsFromMahjong << ", full recompute " << expected
+                 << ", one tile from win: " << (canWin ? "yes" : "no") << endl;
+        }
+    }
+
+    void SetTileCount(int newCount, int currentOrnateLevel = 0) {
+        gameLog << "SetTileCount called with newCount: " << newCount << endl;
+        gameLog << "Current maxTiles: " << maxTiles << ", current tiles.size(): " << tiles.size() << endl;
+
+        if (newCount >= 4 && newCount <= 13) {
+            int oldMaxTiles = maxTiles;
+            maxTiles = newCount;
+
+            // Add new tile types based on ornate level (NOT tile count)
+            if (newCount == 7 && TypeCount() == 1 && currentOrnateLevel >= 1) {
+                AddType(HAT_TILES);
+                AddTypeToWall(HAT_TILES);
+                gameLog << "Added HAT tiles (1^-9^) to available tile types!" << endl;
+            } else if (newCount == 10 && TypeCount() == 2 && currentOrnateLevel >= 2) {
+                AddType(DOT_TILES);
+                AddTypeToWall(DOT_TILES);
+                gameLog << "Added DOT tiles (1.-9.) to available tile types!" << endl;
+            }
+
+            gameLog << "Tile count expanded to " << maxTiles << endl;
+            gameLog << "Available tile types: " << TypeCount() << endl;
+
+            // CRITICAL FIX: Expand existing hand instead of regenerating!
+            if (newCount > oldMaxTiles) {
+                int tilesToAdd = newCount - tiles.size();
+                gameLog << "EXPANDING HAND: Adding " << tilesToAdd << " new tiles to existing hand" << endl;
+
+                // Add new tiles to existing hand without resetting
+                for (int i = 0; i < tilesToAdd; i++) {
+                    Tile newTile = GenerateValidTile(0.0f); // No probability bonus for expansion
+                    tiles.push_back(newTile);
+
+                    gameLog << "Added tile " << newTile.ToString() << " to hand" << endl;
+                }
+
+                // CRITICAL FIX: Always sort after adding new tiles
+                SortTiles();
+                gameLog << "Hand sorted after expansion!" << endl;
+            }
+            RebuildHandTrackers(); // Hand size (and groups needed) changed
+
+            gameLog << "After expansion - tiles.size(): " << tiles.size() << endl;
+        } else {
+            gameLog << "Invalid tile count: " << newCount << " (must be 4-13)" << endl;
+        }
+    }
+
+    void RedrawCompleteHand(int newCount, int currentOrnateLevel = 0) {
+        gameLog << "🎴 COMPLETE HAND REDRAW! " << tiles.size() << " -> " << newCount << " tiles" << endl;
+
+        if (newCount >= 4 && newCount <= 13) {
+            maxTiles = newCount;
+
+            // Add new tile types based on ornate level (NOT tile count)
+            if (newCount == 7 && TypeCount() == 1 && currentOrnateLevel >= 1) {
+                AddType(HAT_TILES);
+                gameLog << "Added HAT tiles (1^-9^) to available tile types!" << endl;
+            } else if (newCount == 10 && TypeCount() == 2 && currentOrnateLevel >= 2) {
+                AddType(DOT_TILES);
+                gameLog << "Added DOT tiles (1.-9.) to available tile types!" << endl;
+            }
+
+            // COMPLETE REDRAW: Clear existing hand and generate new one
+            gameLog << "🎴 Clearing old hand and generating " << newCount << " fresh tiles..." << endl;
+
+            // Clear old hand and put it back into a fresh wall
+            tiles.clear();
+            FillWall();
+
+            // Generate completely new hand
+            for (int i = 0; i < newCount; i++) {
+                Tile newTile = GenerateValidTile(0.0f);
+                tiles.push_back(newTile);
+
+                gameLog << "Generated fresh tile: " << newTile.ToString() << endl;
+            }
+
+            // Sort the new hand
+            SortTiles();
+            RebuildHandTrackers();
+            gameLog << "🎴 HAND COMPLETELY REDRAWN AND SORTED! New hand: ";
+            for (const Tile& tile : tiles) {
+                gameLog << tile.ToString() << " ";
+            }
+            gameLog << endl;
+        } else {
+            gameLog << "Invalid tile count: " << newCount << " (must be 4-13)" << endl;
+        }
+    }
+
+    bool CheckWinCondition(const Tile& newTile, int currentOrnateLevel = 0) {
+        // Count the hand plus the new tile directly (no copy of the hand needed)
+        TileCounts testCounts;
+        for (const Tile& tile : tiles) {
+            testCounts[{tile.value, tile.type}]++;
+        }
+        testCounts[{newTile.value, newTile.type}]++;
+
+        // Win condition check (debug output removed for release)
+
+        // Calculate required groups based on hand size
+        int handSize = tiles.size() + 1;
+        int requiredGroups = 0;
+        if (handSize == 5) requiredGroups = 1; // 4 tiles: 1 group + 1 pair
+        else if (handSize == 8) requiredGroups = 2; // 7 tiles: 2 groups + 1 pair
+        else if (handSize == 11) requiredGroups = 3; // 10 tiles: 3 groups + 1 pair
+        else if (handSize == 14) requiredGroups = 4; // 13 tiles: 4 groups + 1 pair
+        else {
+            gameLog << "Invalid hand size: " << handSize << endl;
+            return false;
+        }
+
+        bool mahjongWin = HasRequiredGroupsAndPair(testCounts, handSize, requiredGroups);
+        bool loongWin = false;
+
+        // Check for LOONG (1-9 consecutive of same type) - only after level 4
+        if (currentOrnateLevel >= LEVEL_4_DRAGON) { // Level 4+ (ornateLevel is 0-based)
+            loongWin = HasLoongWin(testCounts);
+        }
+
+        if (mahjongWin) {
+            gameLog << "WIN: Found " << requiredGroups << " groups + 1 pair!" << endl;
+        }
+        if (loongWin) {
+            gameLog << "LOONG WIN: Found 1-9 consecutive of same type!" << endl;
+        }
+
+        return mahjongWin || loongWin;
+    }
+
+    // CheckWinCondition for many hands at once (hand + new tile already packed together)
+    void CheckWinConditionBatch(const WinEvaluator::PackedHand* hands, int handCount, int currentOrnateLevel, unsigned long long* winBits) {
+        winEvaluator.EvaluateBatch(hands, handCount, currentOrnateLevel >= LEVEL_4_DRAGON, winBits);
+    }
+
+    void SortTilesVector(vector<Tile>& tilesToSort) {
+        sort(tilesToSort.begin(), tilesToSort.end(), [](const Tile& a, const Tile& b) {
+            if (a.type != b.type) return a.type < b.type;
+            return a.value < b.value;
+        });
+    }
+
+    bool CheckKongCondition(const Tile& newTile) {
+        // First check if we have 3 of this tile (same value and type) in current hand
+        int countInHand = 0;
+        for (const Tile& tile : tiles) {
+            if (tile == newTile) {
+                countInHand++;
+            }
+        }
+
+        // KONG only triggers if we have exactly 3 of this tile in hand + 1 new = 4 total
+        if (countInHand == 3) {
+            gameLog << "KONG: Found 3x" << newTile.ToString() << " in hand + 1 new = KONG!" << endl;
+
+            // SPECIAL CASE: Zero tiles can KONG multiple times (don't make them GOLD)
+            if (!newTile.IsZero()) {
+                // Make this tile type GOLD (remove from pool) - except for zeros
+                pair<int, TileType> tileKey = {newTile.value, newTile.type};
+                SetGold(tileKey);
+                wall.TakeAll(TileCounts::Index(newTile.value, newTile.type));
+                RefreshTileWeight(TileCounts::Index(newTile.value, newTile.type));
+                gameLog << "Tile " << newTile.ToString() << " is now GOLD and removed from pool!" << endl;
+            } else {
+                gameLog << "Zero tile KONG! Zeros can KONG multiple times!" << endl;
+            }
+
+            // Mark all instances in hand as gold
+            for (Tile& tile : tiles) {
+                if (tile == newTile) {
+                    tile.isGold = true;
+                }
+            }
+
+            // The KONG tile is scored, not kept: the hand itself is unchanged
+            CheckShanten();
+            tilesVersion++; // ...but the pool lost a tile
+
+            return true;
+        }
+        return false;
+    }
+
+    bool HasRequiredGroupsAndPair(vector<Tile>& sortedTiles, int requiredGroups) {
+        // Simple approach: count all possible groups and pairs, then check if we can form the required combination
+        TileCounts tileCounts;
+        for (const Tile& tile : sortedTiles) {
+            tileCounts[{tile.value, tile.type}]++;
+        }
+
+        return HasRequiredGroupsAndPair(tileCounts, sortedTiles.size(), requiredGroups);
+    }
+
+    bool HasRequiredGroupsAndPair(TileCounts& tileCounts, int handSize, int requiredGroups) {
+        gameLog << "Checking for " << requiredGroups << " groups + 1 pair in hand of " << handSize << " tiles" << endl;
+
+        // Canonical memoized search, no allocations
+        return winEvaluator.IsWinningHand(tileCounts, requiredGroups);
+    }
+
+    // REFERENCE SEARCH: the original exhaustive backtracking, kept for cross-checking the fast evaluator
+    bool TryAllGroupCombinations(const TileCounts& tileCounts, int requiredGroups, int totalTiles) {
+        // Mahjong logic processing (debug output removed for release)
+
+        // Use recursive backtracking to try ALL possible combinations
+        return TryAllPossibleCombinations(tileCounts, requiredGroups, 0, vector<string>());
+    }
+
+    // ADVANCED RECURSIVE MAHJONG ALGORITHM - Handles ALL combinations!
+    bool TryAllPossibleCombinations(const TileCounts& tileCounts, int requiredGroups, int groupsFound, vector<string> foundGroups) {
+        // Base case: if we have enough groups, check for exactly one pair
+        if (groupsFound >= requiredGroups) {
+            int remainingTiles = 0;
+            int pairsFound = 0;
+
+            for (int i = 0; i < TileCounts::SLOTS; i++) {
+                int count = tileCounts[i];
+                if (count > 0) {
+                    remainingTiles += count;
+                    if (count == 2) {
+                        pairsFound++;
+                    } else if (count > 2) {
+                        // More than 2 tiles remaining means invalid
+                        return false;
+                    }
+                }
+            }
+
+            bool validMahjong = (pairsFound == 1 && remainingTiles == 2);
+
+            // Valid Mahjong found (debug output removed for release)
+
+            return validMahjong;
+        }
+
+        // Try to form triplets
+        for (int i = 0; i < TileCounts::SLOTS; i++) {
+            if (tileCounts[i] >= 3) {
+                // Make a copy and try this triplet
+                TileCounts newCounts = tileCounts;
+                newCounts[i] -= 3;
+
+                pair<int, TileType> key = TileCounts::Key(i);
+                vector<string> newGroups = foundGroups;
+                string tripletName = "Triplet " + to_string(key.first);
+                if (key.second == HAT_TILES) tripletName += "^";
+                else if (key.second == DOT_TILES) tripletName += ".";
+                newGroups.push_back(tripletName);
+
+                if (TryAllPossibleCombinations(newCounts, requiredGroups, groupsFound + 1, newGroups)) {
+                    return true;
+                }
+            }
+        }
+
+        // Try to form consecutives
+        for (TileType type : {PLAIN_TILES, HAT_TILES, DOT_TILES}) {
+            for (int start = 1; start <= 7; start++) { // 1-2-3 to 7-8-9
+                pair<int, TileType> tile1 = {start, type};
+                pair<int, TileType> tile2 = {start + 1, type};
+                pair<int, TileType> tile3 = {start + 2, type};
+
+                if (tileCounts[tile1] > 0 && tileCounts[tile2] > 0 && tileCounts[tile3] > 0) {
+                    // Make a copy and try this consecutive
+                    TileCounts newCounts = tileCounts;
+                    newCounts[tile1]--;
+                    newCounts[tile2]--;
+                    newCounts[tile3]--;
+
+                    vector<string> newGroups = foundGroups;
+                    string consecutiveName = "Consecutive " + to_string(start) + "-" + to_string(start+1) + "-" + to_string(start+2);
+                    if (type == HAT_TILES) consecutiveName += "^";
+                    else if (type == DOT_TILES) consecutiveName += ".";
+                    newGroups.push_back(consecutiveName);
+
+                    if (TryAllPossibleCombinations(newCounts, requiredGroups, groupsFound + 1, newGroups)) {
+                        return true;
+                    }
+                }
+            }
+        }
+
+        return false; // No valid combination found
+    }
+
+    // Test function for Mahjong logic - can be called for debugging
+    void TestMahjongLogic() {
+        gameLog << "\n=== TESTING MAHJONG LOGIC ===" << endl;
+
+        // Test case 1: 4-4-5-6-7 (pair + consecutive)
+        TileCounts testCase1;
+        testCase1[{4, PLAIN_TILES}] = 2; // Pair of 4s
+        testCase1[{5, PLAIN_TILES}] = 1;
+        testCase1[{6, PLAIN_TILES}] = 1;
+        testCase1[{7, PLAIN_TILES}] = 1;
+
+        gameLog << "Test 1 - 4-4-5-6-7: ";
+        bool result1 = TryAllGroupCombinations(testCase1, 1, 5);
+        gameLog << (result1 ? "PASS" : "FAIL") << endl;
+
+        // Test case 2: 1-1-1-2-3 (triplet + consecutive)
+        TileCounts testCase2;
+        testCase2[{1, PLAIN_TILES}] = 3; // Triplet of 1s
+        testCase2[{2, PLAIN_TILES}] = 1;
+        testCase2[{3, PLAIN_TILES}] = 1;
+
+        gameLog << "Test 2 - 1-1-1-2-3: ";
+        bool result2 = TryAllGroupCombinations(testCase2, 1, 5);
+        gameLog << (result2 ? "FAIL (should be invalid)" : "PASS") << endl;
+
+        // Test case 3: 1-1-1-2-2 (triplet + pair)
+        TileCounts testCase3;
+        testCase3[{1, PLAIN_TILES}] = 3; // Triplet of 1s
+        testCase3[{2, PLAIN_TILES}] = 2; // Pair of 2s
+
+        gameLog << "Test 3 - 1-1-1-2-2: ";
+        bool result3 = TryAllGroupCombinations(testCase3, 1, 5);
+        gameLog << (result3 ? "PASS" : "FAIL") << endl;
+
+        // Test case 4: fast evaluator must agree with the reference search on random hands
+        int mismatches = 0;
+        for (int test = 0; test < 2000; test++) {
+            int requiredGroups = 1 + test % 4; // 5, 8, 11 and 14 tiles
+            TileCounts randomHand;
+            for (int i = 0; i < requiredGroups * 3 + 2; i++) {
+                randomHand[{random.Value(0, 9), (TileType)random.Value(0, 2)}]++;
+            }
+            bool reference = TryAllGroupCombinations(randomHand, requiredGroups, requiredGroups * 3 + 2);
+            if (winEvaluator.IsWinningHand(randomHand, requiredGroups) != reference) {
+                mismatches++;
+            }
+        }
+        gameLog << "Test 4 - 2000 random hands: " << (mismatches == 0 ? "PASS" : "FAIL") << " (" << mismatches << " mismatches)" << endl;
+
+        gameLog << "=== MAHJONG LOGIC TESTS COMPLETE ===" << endl;
+    }
+
+
+
+    bool HasLoongWin(vector<Tile>& sortedTiles) {
+        TileCounts tileCounts;
+        for (const Tile& tile : sortedTiles) {
+            tileCounts[{tile.value, tile.type}]++;
+        }
+        return HasLoongWin(tileCounts);
+    }
+
+    bool HasLoongWin(const TileCounts& tileCounts) {
+        // Check for LOONG: 1-9 consecutive tiles of the SAME type
+        for (TileType type : {PLAIN_TILES, HAT_TILES, DOT_TILES}) {
+            // The type's values must be exactly 1,2,3,4,5,6,7,8,9 (a zero tile breaks it)
+            if (tileCounts[{0, type}] > 0) continue;
+
+            bool isConsecutive = true;
+            for (int i = 1; i <= 9; i++) {
+                if (tileCounts[{i, type}] == 0) {
+                    isConsecutive = false;
+                    break;
+                }
+            }
+            if (isConsecutive) {
+                // LOONG WIN found (debug output removed for release)
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void AddToDiscardPile(const Tile& tile) {
+        // Add to discard pile
+        discardPile.push_back(tile);
+
+        // Update total discard counts
+        pair<int, TileType> tileKey = {tile.value, tile.type};
+        totalDiscardCounts[tileKey]++;
+
+        // Enable reshuffle if we have discarded tiles
+        canReshuffle = true;
+
+        // Tile added to discard pile (debug output removed for release)
+    }
+
+    void ReshuffleTiles() {
+        if (!canReshuffle) {
+            // No reshuffle available (debug output removed for release)
+            return;
+        }
+
+        // Reshuffling tiles (debug output removed for release)
+
+        // Everything but the hand, the preview and KONG tiles goes back into the wall
+        TileCounts outside = CountTilesOutsideWall();
+        for (TileType type : {PLAIN_TILES, HAT_TILES, DOT_TILES}) {
+            if (!HasType(type)) continue;
+            for (int value = 1; value <= 9; value++) {
+                pair<int, TileType> tileKey = {value, type};
+                int slot = TileCounts::Index(value, type);
+                if (IsGold(tileKey)) {
+                    wall.TakeAll(slot); // KONG tiles stay out
+                } else {
+                    TopUpWall(slot, outside);
+                }
+            }
+        }
+
+        // Clear discard pile and reset counts
+        discardPile.clear();
+        totalDiscardCounts.Clear();
+
+        canReshuffle = false;
+        tilesVersion++;
+        RefreshTileWeights();
+        // Tile pool reset (debug output removed for release)
+    }
+
+    vector<Tile> GetSortedDiscardPile() {
+        vector<Tile> sorted = discardPile;
+        sort(sorted.begin(), sorted.end(), [](const Tile& a, const Tile& b) {
+            if (a.type != b.type) return a.type < b.type;
+            return a.value < b.value;
+        });
+        return sorted;
+    }
+
+    vector<pair<pair<int, TileType>, int>> GetRemainingTiles() {
+        vector<pair<pair<int, TileType>, int>> remaining;
+
+        TileCounts remainingCounts = GetRemainingCounts();
+        for (TileType type : {PLAIN_TILES, HAT_TILES, DOT_TILES}) {
+            if (!HasType(type)) continue;
+            for (int value = 1; value <= 9; value++) {
+                pair<int, TileType> tileKey = {value, type};
+                if (remainingCounts[tileKey] > 0) {
+                    remaining.push_back({tileKey, remainingCounts[tileKey]});
+                }
+            }
+        }
+
+        return remaining;
+    }
+
+    // Same numbers as GetRemainingTiles, as a flat array (0 for tiles that can't be drawn)
+    TileCounts GetRemainingCounts() {
+        TileCounts remaining;
+
+        for (TileType type : {PLAIN_TILES, HAT_TILES, DOT_TILES}) {
+            if (!HasType(type)) continue;
+            for (int value = 1; value <= 9; value++) {
+                // Exact count from the wall (KONG tiles are already out of it)
+                remaining[{value, type}] = wall.Remaining(TileCounts::Index(value, type));
+            }
+        }
+
+        return remaining;
+    }
+
+    // Wait table for the current hand and nextTile, rebuilt only when something changed
+    const WaitTable& GetWaitTable(int currentOrnateLevel = 0) {
+        if (!waitTable.valid || waitTable.tilesVersion != tilesVersion ||
+            !(waitTable.nextTile == nextTile) || waitTable.ornateLevel != currentOrnateLevel) {
+            RefreshWaitTable(currentOrnateLevel);
+        }
+        return waitTable;
+    }
+
+    void RefreshWaitTable(int currentOrnateLevel = 0) {
+        waitTable.positions = min(maxTiles + 1, WaitTable::MAX_POSITIONS);
+        waitTable.tilesVersion = tilesVersion;
+        waitTable.nextTile = nextTile;
+        waitTable.ornateLevel = currentOrnateLevel;
+        waitTable.valid = true;
+
+        // Same group rule as CheckWinCondition: the hand after the swap plus one draw
+        int handSize = tiles.size() + 1;
+        int requiredGroups = 0;
+        if (handSize == 5) requiredGroups = 1;
+        else if (handSize == 8) requiredGroups = 2;
+        else if (handSize == 11) requiredGroups = 3;
+        else if (handSize == 14) requiredGroups = 4;
+
+        TileCounts counts;
+        for (const Tile& tile : tiles) {
+            counts[{tile.value, tile.type}]++;
+        }
+        TileCounts remaining = GetRemainingCounts();
+
+        for (int position = 0; position < waitTable.positions; position++) {
+            bool isKeep = (position == maxTiles);
+            if (!isKeep && position >= (int)tiles.size()) {
+                waitTable.winningTiles[position] = 0; // No tile here (hand shrank)
+                waitTable.winningDraws[position] = 0;
+                continue;
+            }
+
+            // Equal tiles sit next to each other (sorted hand) and give the same answer
+            if (!isKeep && position > 0 && tiles[position] == tiles[position - 1]) {
+                waitTable.winningTiles[position] = waitTable.winningTiles[position - 1];
+                waitTable.winningDraws[position] = waitTable.winningDraws[position - 1];
+                continue;
+            }
+
+            if (!isKeep) {
+                counts[{tiles[position].value, tiles[position].type}]--;
+                counts[{nextTile.value, nextTile.type}]++;
+            }
+
+            unsigned int winning = requiredGroups > 0 ? winEvaluator.WinningTiles(counts, requiredGroups) : 0;
+
+            // LOONG wins count too once they are unlocked
+            if (requiredGroups > 0 && currentOrnateLevel >= LEVEL_4_DRAGON) {
+                for (int slot = 0; slot < TileCounts::SLOTS; slot++) {
+                    if (slot == 10 || slot == 20 || (winning >> slot & 1)) continue;
+                    counts[slot]++;
+                    if (HasLoongWin(counts)) winning |= 1u << slot;
+                    counts[slot]--;
+                }
+            }
+
+            int draws = 0;
+            for (int slot = 0; slot < TileCounts::SLOTS; slot++) {
+                if (winning >> slot & 1) draws += remaining[slot];
+            }
+            waitTable.winningTiles[position] = winning;
+            waitTable.winningDraws[position] = draws;
+
+            if (!isKeep) {
+                counts[{tiles[position].value, tiles[position].type}]++;
+                counts[{nextTile.value, nextTile.type}]--;
+            }
+        }
+    }
+
+private:
+};
+
+// A grid cell packed into two int16 (a head over the wall sits at -1 or cellCount)
+struct BodyCell {
+    int16_t x;
+    int16_t y;
+
+    static BodyCell From(Vector2 cell) {
+        return BodyCell{(int16_t)cell.x, (int16_t)cell.y};
+    }
+
+    Vector2 ToVector2() const {
+        return Vector2{(float)x, (float)y};
+    }
+};
+
+// One contiguous stretch of the body, [first, last)
+struct BodyRun {
+    const BodyCell* first;
+    const BodyCell* last;
+};
+
+// SNAKE BODY: ring buffer of packed cells, head first
+// Capacity is cellCount * cellCount rounded up to a power of two, so a head push or a tail pop
+// is one index step and a mask and a warm snake never allocates. Growth can stack segments
+// past the board's cell count; the ring then doubles. The container calls keep the names
+// deque<Vector2> had, and cells read back as Vector2.
+class SnakeBody {
+public:
+    class const_iterator {
+    public:
+        using iterator_category = input_iterator_tag;
+        using value_type = Vector2;
+        using difference_type = ptrdiff_t;
+        using pointer = void;
+        using reference = Vector2;
+
+        const_iterator(const SnakeBody* body, size_t index) : body(body), index(index) {}
+        Vector2 operator*() const { return (*body)[index]; }
+        const_iterator& operator++() {
+            index++;
+            return *this;
+        }
+        bool operator==(const const_iterator& other) const { return index == other.index; }
+        bool operator!=(const const_iterator& other) const { return index != other.index; }
+
+    private:
+        const SnakeBody* body;
+        size_t index;
+    };
+
+    SnakeBody(initializer_list<Vector2> cells) {
+        *this = cells;
+    }
+
+    SnakeBody& operator=(initializer_list<Vector2> cells) {
+        clear();
+        for (const Vector2& cell : cells) push_back(cell);
+        return *this;
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    Vector2 operator[](size_t index) const { return cells[(head + index) & mask].ToVector2(); }
+    Vector2 front() const { return (*this)[0]; }
+    Vector2 back() const { return (*this)[count - 1]; }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, count); }
+
+    void push_front(Vector2 cell) {
+        if (count == cells.size()) Grow();
+        head = (head - 1) & mask;
+        cells[head] = BodyCell::From(cell);
+        count++;
+    }
+
+    void pop_front() {
+        head = (head + 1) & mask;
+        count--;
+    }
+
+    void push_back(Vector2 cell) {
+        if (count == cells.size()) Grow();
+        cells[(head + count) & mask] = BodyCell::From(cell);
+        count++;
+    }
+
+    void pop_back() {
+        count--;
+    }
+
+    void clear() {
+        if (cells.empty()) Allocate(cellCount * cellCount);
+        head = 0;
+        count = 0;
+    }
+
+    void Set(size_t index, Vector2 cell) {
+        cells[(head + index) & mask] = BodyCell::From(cell);
+    }
+
+    bool Contains(Vector2 cell) const {
+        BodyCell packed = BodyCell::From(cell);
+        for (const BodyRun& run : Runs()) {
+            for (const BodyCell* segment = run.first; segment != run.last; segment++) {
+                if (segment->x == packed.x && segment->y == packed.y) return true;
+            }
+        }
+        return false;
+    }
+
+    // The body in memory order: head side first, the second run is empty unless the ring wraps
+    array<BodyRun, 2> Runs() const {
+        size_t firstLength = min(count, cells.size() - head);
+        const BodyCell* start = cells.data();
+        return {BodyRun{start + head, start + head + firstLength}, BodyRun{start, start + (count - firstLength)}};
+    }
+
+    // Saved as one array head first, loaded unwrapped from slot 0
+    template <class Archive> void SnapshotFields(Archive& archive) {
+        size_t length = archive.Length(count, sizeof(BodyCell));
+        if constexpr (Archive::LOADING) {
+            clear();
+            while (cells.size() < length) Grow();
+            count = length;
+            archive.Raw(cells.data(), length * sizeof(BodyCell));
+        } else {
+            for (const BodyRun& run : Runs()) archive.Raw(run.first, (run.last - run.first) * sizeof(BodyCell));
+        }
+    }
+
+private:
+    vector<BodyCell> cells; // Power-of-two size
+    size_t mask = 0;
+    size_t head = 0; // Slot of body[0]
+    size_t count = 0;
+
+    void Allocate(size_t minimum) {
+        size_t capacity = 16;
+        while (capacity < minimum) capacity *= 2;
+        cells.assign(capacity, BodyCell{0, 0});
+        mask = capacity - 1;
+        head = 0;
+        count = 0;
+    }
+
+    // Double the ring, unwrapping the body to slot 0
+    void Grow() {
+        vector<BodyCell> old = move(cells);
+        size_t length = count;
+        size_t oldHead = head;
+        size_t oldMask = mask;
+        Allocate(max<size_t>(16, old.size() * 2));
+        for (size_t i = 0; i < length; i++) cells[i] = old[(oldHead + i) & oldMask];
+        count = length;
+    }
+};
+
+// Food, upgrade tiles and teleports land this many cells away from the walls
+const int SPAWN_MARGIN = 2;
+
+// FREE CELL SET: board cells packed densely, for O(1) insert, erase and uniform pick
+// A pick depends on the order of cells, which follows the history of inserts and erases, so
+// snapshots keep that order rather than rebuilding it.
+struct FreeCells {
+    vector<uint32_t> cells; // Board index (y * side + x) of each member, in no fixed order
+    vector<int> slots;      // Board index -> place in cells, -1 for non-members
+    int side = 0;
+
+    void Clear(int boardSide) {
+        side = boardSide;
+        cells.clear();
+        slots.assign(side * side, -1);
+    }
+
+    bool Contains(int index) const {
+        return slots[index] >= 0;
+    }
+
+    void Insert(int index) {
+        slots[index] = (int)cells.size();
+        cells.push_back((uint32_t)index);
+    }
+
+    void Erase(int index) {
+        Swap(slots[index], (int)cells.size() - 1);
+        cells.pop_back();
+        slots[index] = -1;
+    }
+
+    // Uniform member other than the excluded cells (up to 4), false when none is left
+    // The excluded members are swapped past the end for the pick and back afterwards, so the
+    // order, and with it every later pick, doesn't depend on what was excluded.
+    bool Pick(RandomGenerator& random, initializer_list<Vector2> excluded, Vector2& cell) {
+        pair<int, int> swaps[4];
+        int swapCount = 0;
+        int last = (int)cells.size();
+        for (Vector2 other : excluded) {
+            if (swapCount == 4) break;
+            if (other.x < 0 || other.y < 0 || other.x >= side || other.y >= side) continue;
+            int slot = slots[(int)other.y * side + (int)other.x];
+            if (slot < 0 || slot >= last) continue;
+            last--;
+            swaps[swapCount++] = {slot, last};
+            Swap(slot, last);
+        }
+        bool found = last > 0;
+        if (found) {
+            int index = cells[random.Value(0, last - 1)];
+            cell = Vector2{(float)(index % side), (float)(index / side)};
+        }
+        while (swapCount > 0) {
+            swapCount--;
+            Swap(swaps[swapCount].first, swaps[swapCount].second);
+        }
+        return found;
+    }
+
+private:
+    void Swap(int a, int b) {
+        swap(cells[a], cells[b]);
+        slots[cells[a]] = a;
+        slots[cells[b]] = b;
+    }
+};
+
+// A number no other grid history has: taken fresh when a grid is rebuilt and when it's copied
+// (a copy goes on on its own), so a cache that followed one history can tell it's looking at another
+struct GridEpoch {
+    uint64_t value = Next();
+
+    GridEpoch() = default;
+    GridEpoch(const GridEpoch&) : value(Next()) {}
+    GridEpoch& operator=(const GridEpoch&) {
+        value = Next();
+        return *this;
+    }
+
+    void Renew() {
+        value = Next();
+    }
+
+    static uint64_t Next() {
+        static atomic<uint64_t> epochs(0);
+        return ++epochs;
+    }
+};
+
+// OCCUPANCY GRID: how many snake segments cover each board cell
+// Growth repeats the tail cell, so segments can stack and cells hold counts, not bits.
+// Segments off the board (a head over the wall) are only counted.
+struct Occupancy {
+    vector<uint16_t> counts; // side * side, row-major
+    int side = 0;
+    int offBoard = 0;
+    FreeCells spawnCells; // Uncovered cells at least SPAWN_MARGIN from the walls
+
+    // The last FLIP_LOG_SIZE cells that went from free to covered or back, for caches that
+    // follow the grid (TileDistanceField): flip i is flips[i % FLIP_LOG_SIZE]
+    static constexpr int FLIP_LOG_SIZE = 256;
+    array<int, FLIP_LOG_SIZE> flips;
+    uint64_t flipCount = 0;
+    GridEpoch epoch;
+
+    void Clear(int boardSide) {
+        side = boardSide;
+        counts.assign(side * side, 0);
+        offBoard = 0;
+        flipCount = 0;
+        epoch.Renew();
+        spawnCells.Clear(side);
+        for (int y = SPAWN_MARGIN; y < side - SPAWN_MARGIN; y++) {
+            for (int x = SPAWN_MARGIN; x < side - SPAWN_MARGIN; x++) {
+                spawnCells.Insert(y * side + x);
+            }
+        }
+    }
+
+    bool OnBoard(Vector2 cell) const {
+        return cell.x >= 0 && cell.y >= 0 && cell.x < side && cell.y < side;
+    }
+
+    int Index(Vector2 cell) const {
+        return (int)cell.y * side + (int)cell.x;
+    }
+
+    bool InSpawnArea(Vector2 cell) const {
+        return cell.x >= SPAWN_MARGIN && cell.y >= SPAWN_MARGIN && cell.x < side - SPAWN_MARGIN && cell.y < side - SPAWN_MARGIN;
+    }
+
+    void Add(Vector2 cell) {
+        if (!OnBoard(cell)) {
+            offBoard++;
+            return;
+        }
+        int index = Index(cell);
+        if (counts[index]++ > 0) return;
+        if (InSpawnArea(cell)) spawnCells.Erase(index);
+        flips[flipCount++ % FLIP_LOG_SIZE] = index;
+    }
+
+    void Remove(Vector2 cell) {
+        if (!OnBoard(cell)) {
+            offBoard--;
+            return;
+        }
+        int index = Index(cell);
+        if (--counts[index] > 0) return;
+        if (InSpawnArea(cell)) spawnCells.Insert(index);
+        flips[flipCount++ % FLIP_LOG_SIZE] = index;
+    }
+
+    // After spawnCells.cells was loaded over the rebuilt set: true if it lists exactly the
+    // uncovered spawn cells
+    bool RestoreSpawnOrder() {
+        FreeCells& free = spawnCells;
+        fill(free.slots.begin(), free.slots.end(), -1);
+        for (int slot = 0; slot < (int)free.cells.size(); slot++) {
+            if (free.cells[slot] >= (uint32_t)(side * side)) return false;
+            int index = (int)free.cells[slot];
+            Vector2 cell = {(float)(index % side), (float)(index / side)};
+            if (!InSpawnArea(cell) || counts[index] > 0 || free.Contains(index)) return false;
+            free.slots[index] = slot;
+        }
+        int uncovered = 0;
+        for (int y = SPAWN_MARGIN; y < side - SPAWN_MARGIN; y++) {
+            for (int x = SPAWN_MARGIN; x < side - SPAWN_MARGIN; x++) {
+                if (counts[y * side + x] == 0) uncovered++;
+            }
+        }
+        return uncovered == (int)free.cells.size();
+    }
+};
+
+// SAFE CELL FINDER: where to put a head that has to land somewhere
+// Picks the largest open region of the occupancy grid, then the cell in it farthest from the
+// walls (lowest row, then column, on a tie), so the head lands with the most room to move.
+// Regions are found by scanline: each row's runs of free cells are joined to the runs they
+// touch in the row above (union-find), so a query is one pass over the counts plus a little
+// work per run. The run list keeps its memory between queries, so a warm finder doesn't
+// allocate. Label / RegionArea give the size of the region around any cell (the BFS bot's
+// room check).
+class SafeCellFinder {
+public:
+    // False when every board cell is covered
+    bool Find(const Occupancy& occupancy, Vector2& cell) {
+        if (!Label(occupancy)) return false;
+        int best = -1;
+        for (int i = 0; i < (int)runs.size(); i++) {
+            if (runs[i].parent != i) continue;
+            const Run& region = runs[i];
+            if (best < 0 || region.area > runs[best].area ||
+                (region.area == runs[best].area && (region.clearance > runs[best].clearance ||
+                 (region.clearance == runs[best].clearance && region.index < runs[best].index)))) {
+                best = i;
+            }
+        }
+        cell = Vector2{(float)(runs[best].index % side), (float)(runs[best].index / side)};
+        return true;
+    }
+
+    // Find the open regions, with the cell at freeIndex (if any) counted as free even when
+    // covered; false when there are none
+    bool Label(const Occupancy& occupancy, int freeIndex = -1) {
+        side = occupancy.side;
+        const uint16_t* counts = occupancy.counts.data();
+        runs.clear();
+        rowStarts.resize(side + 1);
+
+        int aboveFirst = 0, aboveLast = 0; // The runs of the row above
+        for (int y = 0; y < side; y++) {
+            const uint16_t* row = counts + y * side;
+            if (freeIndex >= 0 && freeIndex / side == y) {
+                freedRow.assign(row, row + side);
+                freedRow[freeIndex % side] = 0;
+                row = freedRow.data();
+            }
+            int rowFirst = (int)runs.size();
+            rowStarts[y] = rowFirst;
+            int above = aboveFirst;
+            int x = 0;
+            while (x < side) {
+                if (row[x] > 0) {
+                    x++;
+                    continue;
+                }
+                Run run;
+                run.first = x;
+                while (x < side && row[x] == 0) x++;
+                run.last = x - 1;
+                run.parent = (int)runs.size();
+                run.area = run.last - run.first + 1;
+                // Farthest from the walls: as near the middle column as the run and the row allow
+                int middle = min(run.last, max(run.first, (side - 1) / 2));
+                run.clearance = min(min(middle, side - 1 - middle), min(y, side - 1 - y));
+                run.index = y * side + max(run.first, run.clearance);
+                runs.push_back(run);
+
+                while (above < aboveLast && runs[above].last < run.first) above++;
+                for (int touching = above; touching < aboveLast && runs[touching].first <= run.last; touching++) {
+                    Join(run.parent, touching);
+                }
+            }
+            aboveFirst = rowFirst;
+            aboveLast = (int)runs.size();
+        }
+        rowStarts[side] = (int)runs.size();
+        if (runs.empty()) return false;
+
+        // Fold each run into its region's root; the root's fields become the region's
+        for (int i = 0; i < (int)runs.size(); i++) {
+            int root = Root(i);
+            if (root == i) continue;
+            Run& region = runs[root];
+            const Run& run = runs[i];
+            region.area += run.area;
+            if (run.clearance > region.clearance || (run.clearance == region.clearance && run.index < region.index)) {
+                region.clearance = run.clearance;
+                region.index = run.index;
+            }
+        }
+        return true;
+    }
+
+    // After Label: cells in the open region around cell, 0 when it's covered or off the board
+    int RegionArea(Vector2 cell) {
+        if (cell.x < 0 || cell.y < 0 || cell.x >= side || cell.y >= side) return 0;
+        int x = (int)cell.x, y = (int)cell.y;
+        // The row's last run starting at or before x
+        int low = rowStarts[y], high = rowStarts[y + 1];
+        while (low < high) {
+            int middle = (low + high) / 2;
+            if (runs[middle].first <= x) low = middle + 1;
+            else high = middle;
+        }
+        if (low == rowStarts[y] || runs[low - 1].last < x) return 0;
+        return runs[Root(low - 1)].area;
+    }
+
+private:
+    struct Run {
+        int first, last; // Columns, inclusive
+        int parent;      // Union-find link, a run is a root when it's its own parent
+        int area;        // Cells, the whole region's once folded into the root
+        int clearance;   // Best cell's distance from the nearest wall
+        int index;       // Best cell, y * side + x
+    };
+
+    vector<Run> runs; // Row by row, left to right
+    vector<int> rowStarts; // Row -> its first run; rowStarts[side] = runs.size()
+    vector<uint16_t> freedRow; // The row of Label's free cell, with it cleared
+    int side = 0;
+
+    // The lower run stays the root, so every root is its region's first run in row order
+    int Root(int run) {
+        while (runs[run].parent != run) {
+            runs[run].parent = runs[runs[run].parent].parent;
+            run = runs[run].parent;
+        }
+        return run;
+    }
+
+    void Join(int a, int b) {
+        a = Root(a);
+        b = Root(b);
+        if (a == b) return;
+        if (a < b) runs[b].parent = a;
+        else runs[a].parent = b;
+    }
+};
+
+// TILE DISTANCE FIELD: moves from every cell to one tile without crossing the snake
+// Asking how far the head is from the tile is a look at the head's four neighbours. The field
+// is kept from the tile rather than from the head because the tile stays put: the head moves
+// every tick, which changes nearly every head distance, while the grid only changes in a cell
+// or two (the new head covers one, the tail frees one). Those cells come from the grid's flip
+// log and are patched in:
+// - a freed cell takes its best neighbour + 1, and the decrease spreads breadth-first to the
+//   cells it now shortens;
+// - a covered cell's dependants (cells with no shortest path left that avoids it) are found
+//   level by level, then get their distances again from the cells around them, nearest first.
+// Either way only the cells whose distance changes are touched. A new tile cell, a rebuilt or
+// copied grid, or more flips than the log keeps means a full search from the tile.
+class TileDistanceField {
+public:
+    static constexpr int UNREACHABLE = -1;
+
+    // Moves from cell to the tile through free cells (0 on the tile, UNREACHABLE while it's covered)
+    int Distance(const Occupancy& occupancy, Vector2 tile, Vector2 cell) {
+        if (!occupancy.OnBoard(tile) || !occupancy.OnBoard(cell)) return UNREACHABLE;
+        Sync(occupancy, tile);
+        if (SameCell(cell, tile)) return 0;
+        int side = occupancy.side;
+        int index = occupancy.Index(cell);
+        int x = (int)cell.x, y = (int)cell.y;
+        int best = FAR;
+        if (x > 0) best = min(best, distances[index - 1]);
+        if (x < side - 1) best = min(best, distances[index + 1]);
+        if (y > 0) best = min(best, distances[index - side]);
+        if (y < side - 1) best = min(best, distances[index + side]);
+        return best == FAR ? UNREACHABLE : best + 1;
+    }
+
+    // Cells whose distance the last query had to set, for benchmarks
+    int Touched() const {
+        return touched;
+    }
+
+private:
+    static constexpr int FAR = 1 << 30; // Covered or cut off from the tile
+
+    vector<int> distances;
+    vector<uint8_t> covered;  // The grid as of the last flip applied
+    vector<uint32_t> marks;   // Stamps: 2 * mark = queued as a dependant, 2 * mark + 1 = is one
+    vector<int> queue;
+    vector<int> dependants;
+    vector<pair<int, int>> heap; // (distance, cell), nearest on top
+    uint32_t mark = 0;
+    int side = 0;
+    int root = -1; // Tile cell
+    uint64_t epoch = 0;
+    uint64_t flipsApplied = 0;
+    int touched = 0;
+
+    void Sync(const Occupancy& occupancy, Vector2 tile) {
+        touched = 0;
+        int tileIndex = occupancy.Index(tile);
+        if (root != tileIndex || epoch != occupancy.epoch.value || side != occupancy.side ||
+            occupancy.flipCount - flipsApplied > (uint64_t)Occupancy::FLIP_LOG_SIZE) {
+            Rebuild(occupancy, tileIndex);
+            return;
+        }
+        for (; flipsApplied < occupancy.flipCount; flipsApplied++) {
+            int index = occupancy.flips[flipsApplied % Occupancy::FLIP_LOG_SIZE];
+            covered[index] ^= 1;
+            if (covered[index]) Cover(index);
+            else Free(index);
+        }
+    }
+
+    void Rebuild(const Occupancy& occupancy, int tileIndex) {
+        side = occupancy.side;
+        int cells = side * side;
+        if ((int)marks.size() != cells) {
+            marks.assign(cells, 0);
+            queue.assign(cells, 0);
+            mark = 0;
+        }
+        distances.assign(cells, FAR);
+        covered.resize(cells);
+        for (int i = 0; i < cells; i++) covered[i] = occupancy.counts[i] > 0;
+        root = tileIndex;
+        epoch = occupancy.epoch.value;
+        flipsApplied = occupancy.flipCount;
+        if (covered[root]) return;
+        distances[root] = 0;
+        Spread(root);
+        touched = cells;
+    }
+
+    // Breadth-first from start, lowering every free cell its distance now shortens
+    void Spread(int start) {
+        int head = 0, tail = 0;
+        queue[tail++] = start;
+        while (head < tail) {
+            int index = queue[head++];
+            int next = distances[index] + 1;
+            int x = index % side, y = index / side;
+            int neighbours[4] = {x > 0 ? index - 1 : -1, x < side - 1 ? index + 1 : -1, y > 0 ? index - side : -1, y < side - 1 ? index + side : -1};
+            for (int neighbour : neighbours) {
+                if (neighbour < 0 || covered[neighbour] || distances[neighbour] <= next) continue;
+                distances[neighbour] = next;
+                queue[tail++] = neighbour;
+                touched++;
+            }
+        }
+    }
+
+    int BestNeighbour(int index) const {
+        int x = index % side, y = index / side;
+        int best = FAR;
+        if (x > 0) best = min(best, distances[index - 1]);
+        if (x < side - 1) best = min(best, distances[index + 1]);
+        if (y > 0) best = min(best, distances[index - side]);
+        if (y < side - 1) best = min(best, distances[index + side]);
+        return best;
+    }
+
+    void Free(int index) {
+        int best = index == root ? -1 : BestNeighbour(index);
+        if (best == FAR) return; // Cut off, stays FAR
+        distances[index] = best + 1;
+        touched++;
+        Spread(index);
+    }
+
+    void Cover(int index) {
+        int level = distances[index];
+        distances[index] = FAR;
+        if (level == FAR) return;
+        touched++;
+
+        // Dependants, level by level: a cell is one when none of its parents (free neighbours
+        // one closer to the tile) is left outside the set. Queue order is level order, so a
+        // cell's parents are all decided before the cell is looked at.
+        mark++;
+        uint32_t queued = 2 * mark, dependant = 2 * mark + 1;
+        dependants.clear();
+        int head = 0, tail = 0;
+        auto queueChildren = [&](int parent, int parentLevel) {
+            int x = parent % side, y = parent / side;
+            int neighbours[4] = {x > 0 ? parent - 1 : -1, x < side - 1 ? parent + 1 : -1, y > 0 ? parent - side : -1, y < side - 1 ? parent + side : -1};
+            for (int child : neighbours) {
+                if (child < 0 || covered[child] || distances[child] != parentLevel + 1 || marks[child] >= queued) continue;
+                marks[child] = queued;
+                queue[tail++] = child;
+            }
+        };
+        queueChildren(index, level);
+        while (head < tail) {
+            int cell = queue[head++];
+            int x = cell % side, y = cell / side;
+            int neighbours[4] = {x > 0 ? cell - 1 : -1, x < side - 1 ? cell + 1 : -1, y > 0 ? cell - side : -1, y < side - 1 ? cell + side : -1};
+            bool keepsParent = false;
+            for (int parent : neighbours) {
+                if (parent >= 0 && !covered[parent] && distances[parent] == distances[cell] - 1 && marks[parent] != dependant) {
+                    keepsParent = true;
+                    break;
+                }
+            }
+            if (keepsParent) continue;
+            marks[cell] = dependant;
+            dependants.push_back(cell);
+            queueChildren(cell, distances[cell]);
+        }
+
+        // Their new distances: from the cells around them, nearest first (Dijkstra)
+        for (int cell : dependants) distances[cell] = FAR;
+        heap.clear();
+        for (int cell : dependants) {
+            int best = BestNeighbour(cell);
+            if (best == FAR) continue;
+            distances[cell] = best + 1;
+            heap.push_back({best + 1, cell});
+            push_heap(heap.begin(), heap.end(), greater<pair<int, int>>());
+        }
+        while (!heap.empty()) {
+            pop_heap(heap.begin(), heap.end(), greater<pair<int, int>>());
+            pair<int, int> entry = heap.back();
+            heap.pop_back();
+            int cell = entry.second;
+            if (entry.first != distances[cell]) continue; // Lowered since it was pushed
+            int x = cell % side, y = cell / side;
+            int neighbours[4] = {x > 0 ? cell - 1 : -1, x < side - 1 ? cell + 1 : -1, y > 0 ? cell - side : -1, y < side - 1 ? cell + side : -1};
+            for (int neighbour : neighbours) {
+                if (neighbour < 0 || covered[neighbour] || distances[neighbour] <= entry.first + 1) continue;
+                distances[neighbour] = entry.first + 1;
+                heap.push_back({entry.first + 1, neighbour});
+                push_heap(heap.begin(), heap.end(), greater<pair<int, int>>());
+            }
+        }
+        touched += (int)dependants.size();
+    }
+};
+
+class Snake
+{
+public:
+    // Read body freely, but change it only through the methods below: they keep occupancy
+    // in step, which turns "is this cell on the snake" into one lookup
+    SnakeBody body = {Vector2{10, 10}, Vector2{9, 10}, Vector2{8, 10}, Vector2{7, 10}};
+    Vector2 direction = {1, 0};
+    bool addSegment = false;
+    int segmentsToAdd = 0;
+    Occupancy occupancy;
+
+    Snake()
+    {
+        RebuildOccupancy();
+    }
+
+    void Update()
+    {
+        if (direction.x == 0 && direction.y == 0) return; // Hard stop: don't move or shrink
+
+        PushHead(Vector2{body[0].x + direction.x, body[0].y + direction.y});
+        if (addSegment == true)
+        {
+            addSegment = false;
+        }
+        else if (segmentsToAdd > 0)
+        {
+            segmentsToAdd--;
+        }
+        else
+        {
+            PopTail();
+        }
+    }
+
+    void PushHead(Vector2 cell)
+    {
+        body.push_front(cell);
+        occupancy.Add(cell);
+    }
+
+    void PopHead()
+    {
+        occupancy.Remove(body.front());
+        body.pop_front();
+    }
+
+    void PopTail()
+    {
+        occupancy.Remove(body.back());
+        body.pop_back();
+    }
+
+    // One more segment on the tail cell (it unstacks as the snake moves on)
+    void GrowTail()
+    {
+        Vector2 tail = body.back();
+        body.push_back(tail);
+        occupancy.Add(tail);
+    }
+
+    void MoveHead(Vector2 cell)
+    {
+        occupancy.Remove(body[0]);
+        body.Set(0, cell);
+        occupancy.Add(cell);
+    }
+
+    bool Occupies(Vector2 cell) const
+    {
+        if (occupancy.OnBoard(cell)) return occupancy.counts[occupancy.Index(cell)] > 0;
+        return occupancy.offBoard > 0 && body.Contains(cell);
+    }
+
+    // Another segment on the head's cell
+    bool HeadHitsBody() const
+    {
+        Vector2 head = body[0];
+        if (occupancy.OnBoard(head)) return occupancy.counts[occupancy.Index(head)] > 1;
+        for (size_t i = 1; i < body.size(); i++)
+        {
+            if (SameCell(body[i], head)) return true;
+        }
+        return false;
+    }
+
+    // After body was set as a whole
+    void RebuildOccupancy()
+    {
+        occupancy.Clear(cellCount);
+        for (const Vector2& cell : body) occupancy.Add(cell);
+    }
+
+    void AddSegments(int count)
+    {
+        segmentsToAdd += count;
+    }
+
+    void Reset()
+    {
+        body = {Vector2{10, 10}, Vector2{9, 10}, Vector2{8, 10}, Vector2{7, 10}};
+        direction = {1, 0};
+        segmentsToAdd = 0;
+        RebuildOccupancy();
+    }
+
+    // Free spawn cell other than the excluded ones, false when the snake covers them all
+    bool PickSpawnCell(RandomGenerator& random, Vector2& cell, initializer_list<Vector2> excluded = {})
+    {
+        return occupancy.spawnCells.Pick(random, excluded, cell);
+    }
+
+    // The occupancy grid is rebuilt from the body rather than stored, except for the order
+    // of the free spawn cells, which later picks depend on
+    template <class Archive> void SnapshotFields(Archive& archive)
+    {
+        body.SnapshotFields(archive);
+        archive.Field(direction);
+        archive.Field(addSegment);
+        archive.Field(segmentsToAdd);
+        if (Archive::LOADING) RebuildOccupancy();
+        archive.Field(occupancy.spawnCells.cells);
+        if (Archive::LOADING) archive.Check(occupancy.RestoreSpawnOrder());
+    }
+};
+
+// Where the food waits while the snake covers every spawn cell: off the board, out of reach
+const Vector2 NO_CELL = {-1000, -1000};
+
+class Food
+{
+
+public:
+    Vector2 position;
+
+    Food(Snake& snake, RandomGenerator& random)
+    {
+        Respawn(snake, random);
+    }
+
+    bool Placed() const
+    {
+        return !SameCell(position, NO_CELL);
+    }
+
+    // A free spawn cell (away from the walls for better gameplay), or NO_CELL and false
+    bool Respawn(Snake& snake, RandomGenerator& random)
+    {
+        if (snake.PickSpawnCell(random, position)) return true;
+        position = NO_CELL;
+        return false;
+    }
+};
+
+// Timer step UpdateGameplay gets per tick: one 60 FPS frame, what the spawn timers were tuned with
+const float GAMEPLAY_TICK_DELTA = 1.0f / 60.0f;
+
+// FIXED-STEP TICK SCHEDULER: turns elapsed real time into a whole number of gameplay ticks
+// Time owed is counted in ticks, not seconds, so a speed change only changes how fast the next
+// tick comes due (no phase jump). Catch-up after a hitch is capped and the rest is dropped.
+struct TickScheduler {
+    double baseInterval = 0.2; // Seconds per tick at speed 1.0
+    int maxCatchUpTicks = 4; // Most ticks run for one Advance
+    double owedTicks = 0.0; // Ticks due but not run yet (always < 1 after Advance)
+    double tickLag = 0.0; // Seconds the simulation trails real time after the last Advance
+    long long ticksRun = 0;
+    long long ticksDropped = 0;
+
+    // Add elapsed seconds at the current speed multiplier, returns how many ticks to run now
+    int Advance(double elapsedSeconds, float speedMultiplier) {
+        double interval = baseInterval / speedMultiplier;
+        owedTicks += elapsedSeconds / interval;
+
+        int ticks = (int)owedTicks;
+        if (ticks > maxCatchUpTicks) {
+            ticksDropped += ticks - maxCatchUpTicks;
+            ticks = maxCatchUpTicks;
+            owedTicks -= (int)owedTicks - ticks; // Keep the phase, forget the backlog
+        }
+        owedTicks -= ticks;
+        ticksRun += ticks;
+        tickLag = owedTicks * interval;
+        return ticks;
+    }
+
+    void Reset() {
+        owedTicks = 0.0;
+        tickLag = 0.0;
+    }
+};
+
+// SNAPSHOTS: the whole simulation as one flat blob (GameCore::SaveSnapshot / LoadSnapshot)
+// Every class lists its state once in SnapshotFields(archive); the writer and the reader walk
+// the same list. Plain data is copied byte for byte, containers get a count in front.
+const uint8_t SNAPSHOT_MAGIC[4] = {'L', 'S', 'N', 'P'};
+const uint32_t SNAPSHOT_VERSION = 6; // Bump whenever a SnapshotFields list changes
+
+class SnapshotWriter {
+public:
+    static const bool LOADING = false;
+    vector<uint8_t>& bytes;
+    size_t used = 0; // bytes is only grown, then cut to size by Finish
+
+    SnapshotWriter(vector<uint8_t>& output) : bytes(output) {}
+
+    void Raw(const void* data, size_t size) {
+        if (used + size > bytes.size()) bytes.resize(max(bytes.size() * 2, used + size + 256));
+        if (size > 0) memcpy(bytes.data() + used, data, size);
+        used += size;
+    }
+
+    void Finish() {
+        bytes.resize(used);
+    }
+
+    template <class T> void Field(T& value) {
+        static_assert(is_trivially_copyable<T>::value, "snapshot fields are copied byte for byte");
+        Raw(&value, sizeof(T));
+    }
+
+    template <class A, class B> void Field(pair<A, B>& value) {
+        Field(value.first);
+        Field(value.second);
+    }
+
+    void Field(string& text) {
+        Count(text.size());
+        Raw(text.data(), text.size());
+    }
+
+    template <class T> void Field(vector<T>& items) {
+        Count(items.size());
+        if constexpr (is_trivially_copyable<T>::value) {
+            Raw(items.data(), items.size() * sizeof(T));
+        } else {
+            for (T& item : items) Field(item);
+        }
+    }
+
+    template <class T> void Field(deque<T>& items) {
+        Count(items.size());
+        for (T& item : items) Field(item);
+    }
+
+    template <class K, class V> void Field(map<K, V>& table) {
+        Count(table.size());
+        for (auto& entry : table) {
+            K key = entry.first;
+            Field(key);
+            Field(entry.second);
+        }
+    }
+
+    // A count the reader can only check, for tables both sides build themselves
+    void Count(size_t count) {
+        uint32_t value = (uint32_t)count;
+        Field(value);
+    }
+
+    // The item count of a container that writes its own items, each at least minBytesEach
+    size_t Length(size_t count, size_t) {
+        Count(count);
+        return count;
+    }
+
+    // A consistency check on what was just loaded
+    void Check(bool) {}
+};
+
+class SnapshotReader {
+public:
+    static const bool LOADING = true;
+    const uint8_t* position;
+    const uint8_t* end;
+    bool ok = true; // False once the blob ran out or didn't match
+
+    SnapshotReader(const uint8_t* data, size_t size) : position(data), end(data + size) {}
+
+    void Raw(void* data, size_t size) {
+        if (!ok || (size_t)(end - position) < size) {
+            ok = false;
+            return;
+        }
+        if (size == 0) return;
+        memcpy(data, position, size);
+        position += size;
+    }
+
+    template <class T> void Field(T& value) {
+        static_assert(is_trivially_copyable<T>::value, "snapshot fields are copied byte for byte");
+        Raw(&value, sizeof(T));
+    }
+
+    template <class A, class B> void Field(pair<A, B>& value) {
+        Field(value.first);
+        Field(value.second);
+    }
+
+    void Field(string& text) {
+        uint32_t size = ReadCount(1);
+        text.resize(size);
+        Raw(&text[0], size);
+    }
+
+    // assign/resize keep the capacity, so restoring into a warm game doesn't allocate
+    template <class T> void Field(vector<T>& items) {
+        uint32_t count = ReadCount(is_trivially_copyable<T>::value ? sizeof(T) : 1);
+        items.resize(count);
+        if constexpr (is_trivially_copyable<T>::value) {
+            Raw(items.data(), count * sizeof(T));
+        } else {
+            for (T& item : items) Field(item);
+        }
+    }
+
+    template <class T> void Field(deque<T>& items) {
+        uint32_t count = ReadCount(sizeof(T));
+        items.resize(count);
+        for (T& item : items) Field(item);
+    }
+
+    // Entries come in key order, so the hint makes each one O(1) and existing keys are
+    // overwritten in place; a table with keys the blob doesn't have is rebuilt from scratch
+    template <class K, class V> void Field(map<K, V>& table) {
+        uint32_t count = ReadCount(1);
+        const uint8_t* first = position;
+        for (int attempt = 0; attempt < 2 && ok; attempt++) {
+            auto hint = table.begin();
+            for (uint32_t i = 0; i < count && ok; i++) {
+                K key{};
+                V value{};
+                Field(key);
+                Field(value);
+                hint = std::next(table.insert_or_assign(hint, key, value));
+            }
+            if (table.size() == count) return;
+            table.clear();
+            position = first;
+        }
+    }
+
+    void Count(size_t count) {
+        uint32_t value = 0;
+        Field(value);
+        if (value != count) ok = false;
+    }
+
+    size_t Length(size_t, size_t minBytesEach) {
+        return ReadCount(minBytesEach);
+    }
+
+    void Check(bool valid) {
+        if (!valid) ok = false;
+    }
+
+private:
+    // Counts are checked against the bytes left, so a bad blob can't ask for a huge buffer
+    uint32_t ReadCount(size_t minBytesEach) {
+        uint32_t count = 0;
+        Field(count);
+        if ((size_t)(end - position) / minBytesEach < count) ok = false;
+        return ok ? count : 0;
+    }
+};
+
+// Sounds the rules ask the front end to play
+enum GameSound {
+    SOUND_EAT,
+    SOUND_WALL,
+    SOUND_MAHJONG_WIN
+};
+
+// GAME CORE: all simulation state and rules, no rendering, audio, input or wall clock
+// Hooks default to doing nothing; the raylib Game overrides them to play sounds and save
+class GameCore
+{
+public:
+    GameRandom random; // Every random roll of the run, reproducible from random.runSeed
+    Snake snake = Snake();
+    Food food = Food(snake, random.streams[FOOD_STREAM]);
+    SafeCellFinder safeCells; // Scratch space for teleports and rebirths, not game state
+    // Caches for the distance queries below, not game state
+    TileDistanceField foodDistances;
+    TileDistanceField upgradeDistances;
+    TileDistanceField latentUpgradeDistances;
+    GameState gameState = TITLE_SCREEN;
+    int score = 0;
+    bool allowMove = false;
+    int highScore = 0;
+
+    // Difficulty and High Score System
+    DifficultyLevel selectedDifficulty = FOUNDATION_BUILDING;
+    map<pair<LoongType, DifficultyLevel>, int> loongHighScores; // [LoongType, Difficulty] -> High Score
+    map<pair<LoongType, DifficultyLevel>, bool> difficultyUnlocked; // Track unlocked difficulties
+    int mahjongWinsRequired = 0; // How many Mahjongs needed to win (for higher difficulties)
+    int mahjongWinsAchieved = 0; // How many Mahjongs achieved this run
+
+    // Difficulty system data
+    vector<string> difficultyNames = {
+        "Foundation Building",
+        "Golden Core",
+        "Nascent Soul",
+        "Ascension",
+        "Immortal Sage"
+    };
+
+    vector<string> difficultyDescriptions = {
+        "Start with 3 Extra Lives",
+        "Start with only 1 life, no Extra Lives",
+        "Start with 7 tiles, need 2 Mahjongs to reach 13 tiles",
+        "Start with 10 tiles, need 5 Mahjongs to win",
+        "Start with 13 tiles, need 5 Mahjongs to win"
+    };
+    int mahjongWins = 0;
+    int kongWins = 0;
+    int ornateLevel = LEVEL_1_NONE;
+    int totalWins = 0; // Track total KONG + Mahjong wins for tile expansion
+    int currentTileCount = 4; // Starting with 4 tiles
+    int waterHealingAmount = 0;
+    int windLengthReduction = 0;
+
+    // Sound performance optimization
+    float soundCooldown = 0.1f; // Minimum 100ms between sounds
+
+    MahjongTiles mahjongTiles;
+    GameLog gameLog; // The tiles keep their own copy, SetQuiet switches both
+    NumberPopup numberPopup;
+    float mahjongWinTimer;
+    bool showMahjongWin;
+    float countdownTimer;
+    int countdownNumber;
+    int finalScore = 0; // Store final score for game over screen
+
+    // Age and Choice System
+    int snakeAge = 0; // How many tiles consumed (Age)
+    int snakeLength = 0; // Actual snake body length (Length)
+    bool showChoiceWindow = false;
+    float choiceWindowTimer = 0.0f;
+    int selectedChoice = 0;
+    vector<string> currentChoices;
+    vector<string> currentChoiceDescriptions;
+    bool showKongWin = false;
+    float kongWinTimer = 0.0f;
+    bool showPhoenixRebirth = false;
+    float phoenixRebirthTimer = 0.0f;
+    bool showCosmicWisdom = false;
+    float cosmicWisdomTimer = 0.0f;
+
+    // SHIFT Power System - Tile-based cooldown dragon abilities
+    int shiftCooldownTiles = 0; // Tiles consumed since last use
+    int shiftCooldownMax = 10; // Tiles needed to recharge
+    bool shiftPowerReady = true;
+    string shiftPowerName = "";
+    string shiftPowerDescription = "";
+
+    // New upgrade tile system
+    int tilesConsumed = 0;
+    int nextUpgradeTileAt = 10; // First upgrade at 10 tiles
+    bool upgradeThresholds[4] = {false, false, false, false}; // 10, 33, 66, 100
+    int upgradeThresholdValues[4] = {10, 33, 66, 100};
+
+    // Power-up effects tracking
+    bool slowGrowthActive = false;
+    bool mahjongNerfActive = false;
+    bool speedDemonActive = false;
+    bool luckyNumbersActive = false;
+    bool minimalistActive = false;
+    bool turtleModeActive = false;
+    bool gamblerActive = false;
+    bool perfectionistActive = false;
+    bool collectorActive = false;
+    bool survivorActive = false;
+    bool speedsterActive = false;
+    bool monkActive = false;
+
+    int extraLives = 0;
+    int fruitCounter = 0; // For tracking fruit-based effects
+
+    // Debug UI variables (disabled for release)
+    float currentSpeedMultiplier = 1.0f;
+    float currentProbabilityBonus = 0.0f;
+    bool isInExtraLifeMode = false; // When using extra life
+    int phoenixRebirthCharges = 0; // Phoenix Rebirth charges with bonus scoring
+    string lastExtraLifeType = ""; // Track what type of extra life was used
+
+    // Latent upgrade system
+    map<LoongType, int> loongTotalScores; // Total scores across all runs for each loong
+    map<LoongType, int> loongUpgradeLevel; // Upgrade level (0-5) for each loong
+    vector<int> latentUpgradeThresholds = {250, 500, 1000, 2000, 4000}; // Score thresholds for latent upgrades
+    int selectedLatentLevel = 0; // Currently selected latent cultivation level (0 = none, 1-5 = levels)
+
+    // Latent cultivation upgrade spawning queue - SEPARATE from normal upgrade system
+    vector<LoongType> pendingLatentUpgrades;
+    float latentUpgradeSpawnTimer = 0.0f;
+    float latentUpgradeSpawnDelay = 1.0f; // 1 second between spawns
+    bool latentCultivationSpawned = false; // Track if we've spawned latent cultivation tiles yet
+
+    // Separate latent cultivation tile system
+    Vector2 latentUpgradeTilePosition;
+    bool latentUpgradeSpawned = false;
+    LoongType latentUpgradeTileType;
+
+    // Music tracking (the front end picks tracks by ornate level)
+    int lastOrnateLevel = -1; // Track ornate level changes
+
+    // LOONG System - AMBITIOUS UPGRADE SYSTEM!
+    vector<LoongData> availableLOONGs;
+    LoongType selectedLoongType;
+    int selectedLoongIndex;
+    int loongUpgradeSelection; // For upgrade screen
+    vector<int> upgradeChoices; // 3 random upgrade choices
+    bool showLoongUpgrade;
+
+    // LOONG Effect Tracking Variables
+    float mahjongScoreMultiplier; // Multiplier for Mahjong scores
+    float kongScoreMultiplier; // Multiplier for KONG scores
+    int wallImmunities; // Number of wall collision immunities
+    int teleportCharges; // Number of teleport charges
+    // REMOVED: Legacy auto-complete system
+    int loongWinMultiplier; // LOONG win score multiplier
+    bool phoenixRebirth; // Can revive with full score
+    int phoenixCharges; // Number of phoenix revivals available
+    bool celestialRebirth; // Can revive like basic LOONG
+    int celestialCharges; // Number of celestial revivals available
+
+    // Patience LOONG pause system
+    bool isPaused; // Game is paused
+    float pauseTimer; // How long pause lasts
+    bool canChangeDirection; // Can change direction during pause
+
+    // Bai Ban (White LOONG) zero tile system
+    int purificationCounter; // Counter for automatic purification
+    int purificationThreshold; // Tiles needed for purification (15->10->5)
+    int divineShieldZeros; // How many zeros to remove on death (3->2->1)
+
+    // Cross-LOONG color mixing system
+    vector<LoongType> mixedLoongTypes; // LOONGs we've gained powers from
+
+    // Advanced LOONG Effects
+    int shadowCloneCharges; // Number of shadow clone uses
+    int earthquakeCounter; // Counter for earthquake auto-shuffle
+    int earthquakeThreshold; // Fruits needed for earthquake
+    int tornadoCounter; // Counter for tornado tile swaps
+    int tornadoThreshold; // Fruits needed for tornado
+    int healingCounter; // Counter for healing waters
+    bool graniteWillActive; // Immunity to negative effects
+
+    // NEW UPGRADE TILE SYSTEM
+    Vector2 upgradeTilePosition; // Position of upgrade tile on screen
+    bool upgradeSpawned; // Is there an upgrade tile on screen?
+    LoongType upgradeTileType; // What type of LOONG upgrade this tile gives
+    int tilesConsumedSinceUpgrade; // Track tiles consumed for upgrade spawning
+    int nextUpgradeThreshold; // Next threshold for upgrade spawn (10, 33, 66, 100)
+    bool isGraniteWillActive; // Proper Granite Will immunity state
+
+    GameCore(uint64_t runSeed = 0, bool quiet = false) : random(runSeed), mahjongTiles(GameLog(quiet)), gameLog(quiet)
+    {
+        mahjongTiles.random = random.streams[TILE_STREAM]; // The tile stream travels with the tiles
+
+        // Initialize latent upgrade system
+        InitializeLatentUpgrades();
+
+        mahjongWinTimer = 0;
+        showMahjongWin = false;
+
+        // Initialize LOONG System - GO WILD!
+        InitializeLOONGSystem();
+        selectedLoongType = BASIC_LOONG;
+        selectedLoongIndex = 0;
+        loongUpgradeSelection = 0;
+        showLoongUpgrade = false;
+
+        // Initialize Shift power system
+        InitializeShiftPower();
+
+        // Initialize LOONG effect variables
+        mahjongScoreMultiplier = 1.0f;
+        kongScoreMultiplier = 1.0f;
+        wallImmunities = 0;
+        teleportCharges = 0;
+        // REMOVED: Legacy auto-complete system
+        loongWinMultiplier = 3; // Default LOONG multiplier
+        phoenixRebirth = false;
+        phoenixCharges = 0;
+        celestialRebirth = false;
+        celestialCharges = 0;
+
+        // Initialize pause system
+        isPaused = false;
+        pauseTimer = 0.0f;
+        canChangeDirection = false;
+
+        // Initialize zero tile system
+        purificationCounter = 0;
+        purificationThreshold = 15; // Default: 15 tiles
+        divineShieldZeros = 3; // Default: remove 3 zeros on death
+
+        // Initialize color mixing system
+        mixedLoongTypes.clear();
+
+        // Initialize advanced LOONG effects
+        shadowCloneCharges = 0;
+        earthquakeCounter = 0;
+        earthquakeThreshold = 10; // Default: 10 fruits for earthquake
+        tornadoCounter = 0;
+        tornadoThreshold = 7; // Default: 7 fruits for tornado
+        healingCounter = 0;
+        graniteWillActive = false;
+
+        // Initialize upgrade tile system
+        upgradeSpawned = false;
+        tilesConsumedSinceUpgrade = 0;
+        nextUpgradeThreshold = 10; // First upgrade at 10 tiles
+        isGraniteWillActive = false;
+
+        InitializeDifficultySystem();
+    }
+
+    virtual ~GameCore() {}
+
+    // Front end hooks
+    virtual void PlayGameSound(GameSound sound) {}
+    virtual void SetGameSoundPitch(GameSound sound, float pitch) {}
+    virtual void PlayGameSoundSafe(GameSound sound, float pitch, float cooldown) {} // Skipped within cooldown of the last one
+    virtual void StartGameOverMusic() {}
+    virtual void SaveHighScore() {}
+    virtual void SaveProgressData() {}
+    virtual void LoadProgressData() {}
+
+    // Silence (or bring back) this game's log; the constructor's quiet does it from the start
+    void SetQuiet(bool quiet) {
+        gameLog.quiet = quiet;
+        mahjongTiles.gameLog.quiet = quiet;
+    }
+
+    // Restart every random stream from a run seed: same seed + same inputs = same run
+    void SeedRun(uint64_t runSeed) {
+        random.Seed(runSeed);
+        mahjongTiles.random = random.streams[TILE_STREAM];
+    }
+
+    // Moves from cell (the head, or a cell next to it) to the food / upgrade tiles around the
+    // body, or TileDistanceField::UNREACHABLE (also when there's no such tile on the board or
+    // the body covers it). Not const: they bring the caches up to date first, so one game's
+    // queries mustn't run on two threads at once.
+    int FoodDistance(Vector2 cell) {
+        if (!food.Placed()) return TileDistanceField::UNREACHABLE;
+        return foodDistances.Distance(snake.occupancy, food.position, cell);
+    }
+
+    int UpgradeTileDistance(Vector2 cell) {
+        if (!upgradeSpawned) return TileDistanceField::UNREACHABLE;
+        return upgradeDistances.Distance(snake.occupancy, upgradeTilePosition, cell);
+    }
+
+    int LatentUpgradeTileDistance(Vector2 cell) {
+        if (!latentUpgradeSpawned) return TileDistanceField::UNREACHABLE;
+        return latentUpgradeDistances.Distance(snake.occupancy, latentUpgradeTilePosition, cell);
+    }
+
+    // Hash of the state that decides how the run goes on: random streams (not the front end's
+    // music stream, and the tile stream only as mahjongTiles.random), snake, food, hand, score
+    // and progress. Effect timers are left out.
+    uint64_t StateHash() const {
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&](uint64_t value) {
+            hash = (hash ^ value) * 1099511628211ull;
+            hash ^= hash >> 32;
+        };
+        for (int stream = 0; stream < RANDOM_STREAM_COUNT; stream++) {
+            if (stream == MUSIC_STREAM || stream == TILE_STREAM) continue; // The tile stream is hashed below
+            for (uint64_t word : random.streams[stream].state) mix(word);
+        }
+        for (uint64_t word : mahjongTiles.random.state) mix(word);
+
+        mix(gameState);
+        mix((int64_t)snake.direction.x);
+        mix((int64_t)snake.direction.y);
+        mix(snake.body.size());
+        for (const Vector2& cell : snake.body) mix((int64_t)cell.x << 16 ^ (int64_t)cell.y);
+        mix((int64_t)food.position.x << 16 ^ (int64_t)food.position.y);
+
+        for (const Tile& tile : mahjongTiles.tiles) mix(tile.value << 8 ^ tile.type << 1 ^ tile.isGold);
+        mix(mahjongTiles.nextTile.value << 8 ^ mahjongTiles.nextTile.type);
+        mix(mahjongTiles.arrowPosition);
+
+        mix(score);
+        mix(snakeAge);
+        mix(mahjongWins);
+        mix(mahjongWinsAchieved);
+        mix(kongWins);
+        mix(extraLives);
+        mix(shiftCooldownTiles);
+        return hash;
+    }
+
+    // Start a fresh run of the selected LOONG, difficulty and latent level with every stream
+    // reseeded, so the run depends only on runSeed and the inputs (replays rely on this)
+    void PrepareRun(uint64_t runSeed) {
+        mahjongTiles = MahjongTiles(gameLog); // ResetGame's first draw still sees the last run's hand size and tile types
+        SeedRun(runSeed);
+        for (LoongData& loong : availableLOONGs) { // Upgrades bought in earlier runs
+            loong.level = 0;
+            for (LoongUpgrade& upgrade : loong.upgrades) upgrade.level = 0;
+        }
+        ResetGame();
+        InitializeShiftPower();
+        ApplyDifficultySettings();
+    }
+
+    // Save the whole simulation into blob (overwritten, its memory is reused)
+    void SaveSnapshot(vector<uint8_t>& blob) const {
+        SnapshotWriter writer(blob);
+        writer.Raw(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+        uint32_t version = SNAPSHOT_VERSION;
+        writer.Field(version);
+        const_cast<GameCore*>(this)->SnapshotFields(writer); // The writer only reads
+        writer.Finish();
+    }
+
+    // Restore a SaveSnapshot blob bit for bit (the saved progress stays as it is). False if it isn't one or comes from another
+    // version; a blob that passes the header but is cut off leaves the game half restored.
+    bool LoadSnapshot(const uint8_t* data, size_t size) {
+        if (size < sizeof(SNAPSHOT_MAGIC) || memcmp(data, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) return false;
+        SnapshotReader reader(data + sizeof(SNAPSHOT_MAGIC), size - sizeof(SNAPSHOT_MAGIC));
+        uint32_t version = 0;
+        reader.Field(version);
+        if (!reader.ok || version != SNAPSHOT_VERSION) return false;
+        SnapshotFields(reader);
+        return reader.ok && reader.position == reader.end;
+    }
+
+    // SAVED PROGRESS: what SaveHighScore / SaveProgressData write out (high scores, unlocks,
+    // latent totals and levels). It belongs to the player rather than the run and may already
+    // be on disk, so snapshots leave it out and LoadSnapshot keeps what's in memory; a rewind
+    // copies it around the ticks it simulates again with SaveProgress / LoadProgress.
+    template <class Archive> void ProgressFields(Archive& archive) {
+        archive.Field(highScore);
+        archive.Field(loongHighScores);
+        archive.Field(difficultyUnlocked);
+        archive.Field(loongTotalScores);
+        archive.Field(loongUpgradeLevel);
+    }
+
+    void SaveProgress(vector<uint8_t>& blob) const {
+        SnapshotWriter writer(blob);
+        const_cast<GameCore*>(this)->ProgressFields(writer); // The writer only reads
+        writer.Finish();
+    }
+
+    bool LoadProgress(const uint8_t* data, size_t size) {
+        SnapshotReader reader(data, size);
+        ProgressFields(reader);
+        return reader.ok && reader.position == reader.end;
+    }
+
+    // Every member the rules change, in declaration order, except the saved progress
+    // (ProgressFields). Text that never changes (difficulty names, LOONG names and upgrade
+    // descriptions) isn't stored: only the LOONG and upgrade levels are, and the table shapes
+    // have to match.
+    template <class Archive> void SnapshotFields(Archive& archive) {
+        archive.Field(random.runSeed);
+        for (int stream = 0; stream < RANDOM_STREAM_COUNT; stream++) {
+            if (stream == TILE_STREAM) continue; // Stale after SeedRun: mahjongTiles.random is the one drawn from
+            archive.Field(random.streams[stream]);
+        }
+        snake.SnapshotFields(archive);
+        archive.Field(food.position);
+        archive.Field(gameState);
+        archive.Field(score);
+        archive.Field(allowMove);
+
+        archive.Field(selectedDifficulty);
+        archive.Field(mahjongWinsRequired);
+        archive.Field(mahjongWinsAchieved);
+        archive.Field(mahjongWins);
+        archive.Field(kongWins);
+        archive.Field(ornateLevel);
+        archive.Field(totalWins);
+        archive.Field(currentTileCount);
+        archive.Field(waterHealingAmount);
+        archive.Field(windLengthReduction);
+        archive.Field(soundCooldown);
+
+        mahjongTiles.SnapshotFields(archive);
+        archive.Field(numberPopup);
+        archive.Field(mahjongWinTimer);
+        archive.Field(showMahjongWin);
+        archive.Field(countdownTimer);
+        archive.Field(countdownNumber);
+        archive.Field(finalScore);
+
+        archive.Field(snakeAge);
+        archive.Field(snakeLength);
+        archive.Field(showChoiceWindow);
+        archive.Field(choiceWindowTimer);
+        archive.Field(selectedChoice);
+        archive.Field(currentChoices);
+        archive.Field(currentChoiceDescriptions);
+        archive.Field(showKongWin);
+        archive.Field(kongWinTimer);
+        archive.Field(showPhoenixRebirth);
+        archive.Field(phoenixRebirthTimer);
+        archive.Field(showCosmicWisdom);
+        archive.Field(cosmicWisdomTimer);
+
+        archive.Field(shiftCooldownTiles);
+        archive.Field(shiftCooldownMax);
+        archive.Field(shiftPowerReady);
+        archive.Field(shiftPowerName);
+        archive.Field(shiftPowerDescription);
+
+        archive.Field(tilesConsumed);
+        archive.Field(nextUpgradeTileAt);
+        archive.Field(upgradeThresholds);
+        archive.Field(upgradeThresholdValues);
+
+        archive.Field(slowGrowthActive);
+        archive.Field(mahjongNerfActive);
+        archive.Field(speedDemonActive);
+        archive.Field(luckyNumbersActive);
+        archive.Field(minimalistActive);
+        archive.Field(turtleModeActive);
+        archive.Field(gamblerActive);
+        archive.Field(perfectionistActive);
+        archive.Field(collectorActive);
+        archive.Field(survivorActive);
+        archive.Field(speedsterActive);
+        archive.Field(monkActive);
+
+        archive.Field(extraLives);
+        archive.Field(fruitCounter);
+        archive.Field(currentSpeedMultiplier);
+        archive.Field(currentProbabilityBonus);
+        archive.Field(isInExtraLifeMode);
+        archive.Field(phoenixRebirthCharges);
+        archive.Field(lastExtraLifeType);
+
+        archive.Field(latentUpgradeThresholds);
+        archive.Field(selectedLatentLevel);
+        archive.Field(pendingLatentUpgrades);
+        archive.Field(latentUpgradeSpawnTimer);
+        archive.Field(latentUpgradeSpawnDelay);
+        archive.Field(latentCultivationSpawned);
+        archive.Field(latentUpgradeTilePosition);
+        archive.Field(latentUpgradeSpawned);
+        archive.Field(latentUpgradeTileType);
+        archive.Field(lastOrnateLevel);
+
+        archive.Count(availableLOONGs.size());
+        for (LoongData& loong : availableLOONGs) {
+            archive.Field(loong.level);
+            archive.Count(loong.upgrades.size());
+            for (LoongUpgrade& upgrade : loong.upgrades) archive.Field(upgrade.level);
+        }
+        archive.Field(selectedLoongType);
+        archive.Field(selectedLoongIndex);
+        archive.Field(loongUpgradeSelection);
+        archive.Field(upgradeChoices);
+        archive.Field(showLoongUpgrade);
+
+        archive.Field(mahjongScoreMultiplier);
+        archive.Field(kongScoreMultiplier);
+        archive.Field(wallImmunities);
+        archive.Field(teleportCharges);
+        archive.Field(loongWinMultiplier);
+        archive.Field(phoenixRebirth);
+        archive.Field(phoenixCharges);
+        archive.Field(celestialRebirth);
+        archive.Field(celestialCharges);
+        archive.Field(isPaused);
+        archive.Field(pauseTimer);
+        archive.Field(canChangeDirection);
+        archive.Field(purificationCounter);
+        archive.Field(purificationThreshold);
+        archive.Field(divineShieldZeros);
+        archive.Field(mixedLoongTypes);
+        archive.Field(shadowCloneCharges);
+        archive.Field(earthquakeCounter);
+        archive.Field(earthquakeThreshold);
+        archive.Field(tornadoCounter);
+        archive.Field(tornadoThreshold);
+        archive.Field(healingCounter);
+        archive.Field(graniteWillActive);
+
+        archive.Field(upgradeTilePosition);
+        archive.Field(upgradeSpawned);
+        archive.Field(upgradeTileType);
+        archive.Field(tilesConsumedSinceUpgrade);
+        archive.Field(nextUpgradeThreshold);
+        archive.Field(isGraniteWillActive);
+    }
+
+    void InitializeLOONGSystem() {
+        gameLog << ">>> INITIALIZING EPIC LOONG SYSTEM! <<<" << endl;
+
+        // BASIC LOONG - Balanced Starter Dragon (Mahjong Green)
+        LoongData basicLoong(BASIC_LOONG, "Fa Cai - Green Dragon", "Green Dragon of wealth\nand steady growth",
+                            {34, 139, 34, 255}, {144, 238, 144, 255}); // Dark Green & Light Green (Mahjong colors)
+        basicLoong.upgrades.push_back(LoongUpgrade("Mahjong Mastery", "Mahjong score +25% per level", 5));
+        basicLoong.upgrades.push_back(LoongUpgrade("KONG Power", "KONG score +50% per level", 4));
+        basicLoong.upgrades.push_back(LoongUpgrade("Extra Lives", "Gain +1 extra life per level", 3));
+        basicLoong.upgrades.push_back(LoongUpgrade("Tile Wisdom", "SHIFT: Discard & change to next tile: 8->6->4 tiles", 3));
+        basicLoong.upgrades.push_back(LoongUpgrade("Speed Control", "Reduce speed by 15% per level", 3));
+        availableLOONGs.push_back(basicLoong);
+
+        // FIRE LOONG - Aggressive Damage Dealer (Red Dragon)
+        LoongData fireLoong(FIRE_LOONG, "Hong Zhong - Red Dragon", "Crimson Dragon of success\nand fiery determination",
+                           {220, 20, 60, 255}, {255, 69, 0, 255}); // Deep Red & Orange Red
+        fireLoong.upgrades.push_back(LoongUpgrade("Blazing Mahjong", "Mahjong +50% score +5% speed per level", 4));
+        fireLoong.upgrades.push_back(LoongUpgrade("Inferno KONG", "KONG +75% score +10% speed per level", 3));
+        fireLoong.upgrades.push_back(LoongUpgrade("Speed Demon", "+20% speed +20% score +1 extra life", 3));
+        fireLoong.upgrades.push_back(LoongUpgrade("Burning Tiles", "SHIFT: Change to most held: 12->9->6 tiles", 3));
+        fireLoong.upgrades.push_back(LoongUpgrade("Blazing Rebirth", "Phoenix rebirth +extra score: 1->2->3 charges", 3));
+        availableLOONGs.push_back(fireLoong);
+
+        // WATER LOONG - Defensive and Healing (Blue Dragon)
+        LoongData waterLoong(WATER_LOONG, "Long Wang - Dragon King", "Azure Dragon of flowing\nwisdom and healing",
+                            {30, 144, 255, 255}, {173, 216, 230, 255}); // Dodger Blue & Light Blue
+        waterLoong.upgrades.push_back(LoongUpgrade("Flowing Mahjong", "Mahjong +20% score + heal 1 length per level", 5));
+        waterLoong.upgrades.push_back(LoongUpgrade("Tidal KONG", "KONG +30% score + 2 extra lives per level", 3));
+        waterLoong.upgrades.push_back(LoongUpgrade("Tsunami Shield", "Wall immunity +3 uses per level", 4));
+        waterLoong.upgrades.push_back(LoongUpgrade("Healing Waters", "Reduce length by 2->4->6 every 5 fruits", 4));
+        waterLoong.upgrades.push_back(LoongUpgrade("Tidal Wave", "SHIFT: Heal, Shuffle & Shield: 8 tiles", 3));
+        availableLOONGs.push_back(waterLoong);
+
+        // WHITE LOONG - Purity and Zero Dragon (Bai Ban - White Tile)
+        LoongData whiteLoong(WHITE_LOONG, "Bai Ban - White Tile", "Pure dragon of emptiness\nand zero mastery",
+                            {248, 248, 255, 255}, {220, 220, 220, 255}); // Ghost White & Light Gray
+        whiteLoong.upgrades.push_back(LoongUpgrade("Pure Mahjong", "1->2->3 tiles become 0 after Mahjong", 3));
+        whiteLoong.upgrades.push_back(LoongUpgrade("Sacred KONG", "KONG +40%, four 0 KONG +200%", 3));
+        whiteLoong.upgrades.push_back(LoongUpgrade("Divine Shield", "Remove 3->2->1 zeros on death", 3));
+        whiteLoong.upgrades.push_back(LoongUpgrade("Zero Mastery", "SHIFT: Turn next tile to 0: 10 tiles", 3));
+        whiteLoong.upgrades.push_back(LoongUpgrade("Purification", "Turn leftmost tile to 0: 15->10->5", 3));
+        availableLOONGs.push_back(whiteLoong);
+
+        // EARTH LOONG - Slow but Powerful (Yellow Dragon)
+        LoongData earthLoong(EARTH_LOONG, "Huang Di - Yellow Emperor", "Golden Emperor Dragon\nof earth and stability",
+                            {218, 165, 32, 255}, {255, 215, 0, 255}); // Golden Rod & Gold
+        earthLoong.upgrades.push_back(LoongUpgrade("Mountain Mahjong", "Mahjong +60% score -25% KONG score per level", 3));
+        earthLoong.upgrades.push_back(LoongUpgrade("Boulder KONG", "KONG +100% score -25% Mahjong score per level", 2));
+        earthLoong.upgrades.push_back(LoongUpgrade("Stone Skin", "-15% speed +3 lives -15% score on death", 3));
+        earthLoong.upgrades.push_back(LoongUpgrade("Earthquake", "KONG/consecutive probability +20% per level", 4));
+        earthLoong.upgrades.push_back(LoongUpgrade("Granite Will", "SHIFT: Wall immunity 20-30 hits: 15 tiles", 5));
+        availableLOONGs.push_back(earthLoong);
+
+        // WIND LOONG - Fast and Agile (Azure Dragon)
+        LoongData windLoong(WIND_LOONG, "Qing Long - Azure Dragon", "Blue Dragon of the East\nand swift winds",
+                           {0, 191, 255, 255}, {135, 206, 250, 255}); // Deep Sky Blue & Light Sky Blue
+        windLoong.upgrades.push_back(LoongUpgrade("Gale Mahjong", "Mahjong +60% score +25% speed per level", 5));
+        windLoong.upgrades.push_back(LoongUpgrade("Whirlwind KONG", "KONG +25% score + probability boost per level", 4));
+        windLoong.upgrades.push_back(LoongUpgrade("Lightning Speed", "+25% speed reduce length 1->2->3 every 5 tiles", 3));
+        windLoong.upgrades.push_back(LoongUpgrade("Tornado Tiles", "SHIFT: Replace pointed tile: 6 tiles", 4));
+        windLoong.upgrades.push_back(LoongUpgrade("Wind Walk", "Phase through self +3 times per level", 3));
+        availableLOONGs.push_back(windLoong);
+
+        // SHADOW LOONG - Mysterious and Tricky (Black Dragon)
+        LoongData shadowLoong(SHADOW_LOONG, "Ju Long - Night Dragon", "Shadow Dragon of mystery\nand dimensional power",
+                             {25, 25, 112, 255}, {72, 61, 139, 255}); // Midnight Blue & Dark Slate Blue
+        shadowLoong.upgrades.push_back(LoongUpgrade("Void Mahjong", "Mahjong +35% score hide 3->6->9 tiles from pool", 3));
+        shadowLoong.upgrades.push_back(LoongUpgrade("Dark KONG", "KONG +80% score discard 1->2->3 tiles on KONG", 3));
+        shadowLoong.upgrades.push_back(LoongUpgrade("Shadow Clone", "Duplicate Mahjong win once per level", 2));
+        shadowLoong.upgrades.push_back(LoongUpgrade("Nightmare Tiles", "SHIFT: Force next tile same: 8->6->4 tiles", 3));
+        shadowLoong.upgrades.push_back(LoongUpgrade("Dimensional Rift", "Teleport on collision +3 charges per level", 3));
+        availableLOONGs.push_back(shadowLoong);
+
+        // CELESTIAL LOONG - Ultimate Endgame Dragon (Imperial Dragon)
+        LoongData celestialLoong(CELESTIAL_LOONG, "Shen Long - Divine Dragon", "Divine Imperial Dragon\nof ultimate power",
+                                {255, 215, 0, 255}, {100, 100, 100, 255}); // Gold & Dark Gray (better readability)
+        celestialLoong.upgrades.push_back(LoongUpgrade("Divine Mahjong", "Mahjong +50% score per level", 3));
+        celestialLoong.upgrades.push_back(LoongUpgrade("Heavenly KONG", "KONG +75% score per level", 3));
+        celestialLoong.upgrades.push_back(LoongUpgrade("Celestial Rebirth", "+2 celestial rebirths per level", 3));
+        celestialLoong.upgrades.push_back(LoongUpgrade("Cosmic Wisdom", "SHIFT: Instant MAHJONG redraw: 20->15->10 tiles", 3));
+        celestialLoong.upgrades.push_back(LoongUpgrade("Transcendence", "LOONG multiplier: 4x->5x->6x", 3));
+        availableLOONGs.push_back(celestialLoong);
+
+        // PATIENCE LOONG - Dragon of Patience and Control
+        LoongData patienceLoong(PATIENCE_LOONG, "Ren Long - Patience Dragon", "Serene dragon of patience\nand perfect timing",
+                               {138, 43, 226, 255}, {75, 0, 130, 255}); // Blue Violet & Indigo
+        patienceLoong.upgrades.push_back(LoongUpgrade("Calm Mahjong", "+30% score, -10% speed per level", 3));
+        patienceLoong.upgrades.push_back(LoongUpgrade("Steady KONG", "+35% score, immunity on KONG", 3));
+        patienceLoong.upgrades.push_back(LoongUpgrade("Meditation", "+2 wall immunity per level", 3));
+        patienceLoong.upgrades.push_back(LoongUpgrade("Pause Control", "SHIFT: Pause & change direction: 3->2->1 tiles", 4));
+        patienceLoong.upgrades.push_back(LoongUpgrade("Patience Mastery", "Slower = higher score multiplier", 3));
+        availableLOONGs.push_back(patienceLoong);
+
+        gameLog << "*** LOONG SYSTEM INITIALIZED WITH " << availableLOONGs.size() << " MYTHOLOGICAL DRAGONS! ***" << endl;
+        gameLog << ">>> BAMBOO -> RED -> WHITE -> YELLOW -> AZURE -> SHADOW -> CELESTIAL <<<" << endl;
+        gameLog << "*** Each dragon has 5 unique upgrade paths rooted in Chinese mythology! ***" << endl;
+    }
+
+    void InitializeShiftPower() {
+        // Initialize Shift power based on selected LOONG type
+        switch (selectedLoongType) {
+            case BASIC_LOONG:
+                shiftPowerName = "Tile Wisdom";
+                shiftPowerDescription = "Discard & change to next";
+                shiftCooldownMax = 8; // 8 tiles cooldown
+                break;
+
+            case FIRE_LOONG:
+                shiftPowerName = "Burning Tiles";
+                shiftPowerDescription = "Change tile to most held";
+                shiftCooldownMax = 12; // 12 tiles cooldown
+                break;
+
+            case WATER_LOONG:
+                shiftPowerName = "Tidal Wave";
+                shiftPowerDescription = "Heal snake + shuffle tiles";
+                shiftCooldownMax = 8; // 8 tiles cooldown
+                break;
+
+            case WHITE_LOONG:
+                shiftPowerName = "Zero Mastery";
+                shiftPowerDescription = "Turn next tile to 0";
+                shiftCooldownMax = 10; // Reduced from 15
+                break;
+
+            case EARTH_LOONG:
+                shiftPowerName = "Granite Will";
+                shiftPowerDescription = "Temporary immunity";
+                shiftCooldownMax = 15; // 15 tiles cooldown
+                break;
+
+            case WIND_LOONG:
+                shiftPowerName = "Tornado Tiles";
+                shiftPowerDescription = "Replace pointed tile";
+                shiftCooldownMax = 6; // 6 tiles cooldown
+                break;
+
+            case SHADOW_LOONG:
+                shiftPowerName = "Nightmare Tiles";
+                shiftPowerDescription = "Change to pointed tile";
+                shiftCooldownMax = 8; // 8 tiles cooldown
+                break;
+
+            case CELESTIAL_LOONG:
+                shiftPowerName = "Cosmic Wisdom";
+                shiftPowerDescription = "Instant MAHJONG";
+                shiftCooldownMax = 20; // 20 tiles cooldown
+                break;
+
+            case PATIENCE_LOONG:
+                shiftPowerName = "Pause Control";
+                shiftPowerDescription = "Pause & change direction";
+                shiftCooldownMax = 3; // 3 tiles cooldown (very low)
+                break;
+        }
+
+        // Start with power ready
+        shiftPowerReady = true;
+        shiftCooldownTiles = 0;
+
+        gameLog << "*** SHIFT POWER INITIALIZED: " << shiftPowerName << " ***" << endl;
+    }
+
+    void ActivateShiftPower() {
+        if (!shiftPowerReady) return;
+
+        gameLog << "*** ACTIVATING SHIFT POWER: " << shiftPowerName << " ***" << endl;
+
+        switch (selectedLoongType) {
+            case BASIC_LOONG: {
+                // Tile Wisdom: Discard current tile and change to next one
+                Tile discardedTile = mahjongTiles.nextTile;
+                mahjongTiles.AddToDiscardPile(discardedTile);
+                mahjongTiles.GenerateNextTile(currentProbabilityBonus);
+                gameLog << ">>> TILE WISDOM: Discarded " << discardedTile.ToString() << " and generated new tile!" << endl;
+                break;
+            }
+            case FIRE_LOONG: {
+                // Burning Tiles: Change tile to most held (non-KONG) tile
+                TileCounts heldCounts;
+                for (const Tile& tile : mahjongTiles.tiles) {
+                    pair<int, TileType> key = {tile.value, tile.type};
+                    if (!mahjongTiles.IsGold(key)) { // Not KONG
+                        heldCounts[key]++;
+                    }
+                }
+
+                // Scan value-major so ties still resolve to the lowest (value, type) key
+                pair<int, TileType> mostHeld = {0, PLAIN_TILES};
+                int mostHeldCount = 0;
+                for (int value = 0; value <= 9; value++) {
+                    for (TileType type : {PLAIN_TILES, HAT_TILES, DOT_TILES}) {
+                        if (heldCounts[{value, type}] > mostHeldCount) {
+                            mostHeldCount = heldCounts[{value, type}];
+                            mostHeld = {value, type};
+                        }
+                    }
+                }
+
+                if (mostHeldCount > 0) {
+                    // Discard the original tile and generate the new one
+                    Tile originalTile = mahjongTiles.nextTile;
+                    mahjongTiles.AddToDiscardPile(originalTile);
+                    mahjongTiles.nextTile = Tile(mostHeld.first, mostHeld.second, false);
+                    gameLog << ">>> BURNING TILES: Discarded " << originalTile.ToString() << ", changed to " << mahjongTiles.nextTile.ToString() << " (most held)!" << endl;
+                } else {
+                    gameLog << ">>> BURNING TILES: No non-KONG tiles to copy!" << endl;
+                }
+                break;
+            }
+
+            case WATER_LOONG: {
+                // Tidal Wave: Heal snake and shuffle tiles
+                gameLog << ">>> TIDAL WAVE: Healing and reshuffling!" << endl;
+
+                // Heal snake by reducing length (water healing)
+                int healAmount = min(3, (int)snake.body.size() - 4); // Don't go below 4 segments
+                for (int i = 0; i < healAmount; i++) {
+                    if (snake.body.size() > 4) {
+                        snake.PopTail();
+                    }
+                }
+                gameLog << ">>> HEALING WATERS: Reduced length by " << healAmount << " segments!" << endl;
+
+                // Shuffle tiles (tidal wave effect)
+                mahjongTiles.ReshuffleTiles();
+                gameLog << ">>> TIDAL SHUFFLE: Tiles reshuffled by the wave!" << endl;
+
+                // Grant temporary immunity (water protection)
+                wallImmunities += 2;
+                gameLog << ">>> WATER SHIELD: Gained 2 immunity charges!" << endl;
+                break;
+            }
+
+            case WHITE_LOONG: {
+                // Zero Mastery: Turn next tile into 0 (blank)
+                gameLog << ">>> ZERO MASTERY: Turning next tile into blank!" << endl;
+
+                // Discard the original tile and create a zero tile
+                Tile originalTile = mahjongTiles.nextTile;
+                mahjongTiles.AddToDiscardPile(originalTile);
+                mahjongTiles.nextTile = Tile(0, PLAIN_TILES, false); // Create zero tile
+                gameLog << ">>> ZERO MASTERY: Discarded " << originalTile.ToString() << ", next tile is now 0 (blank)!" << endl;
+
+                // Grant temporary immunity (White LOONG purity power)
+                wallImmunities += 1;
+                gameLog << ">>> DIVINE PURITY: Gained 1 immunity charge! (" << wallImmunities << " total)" << endl;
+                break;
+            }
+
+            case EARTH_LOONG: {
+                // Granite Will: Temporary immunity to walls and own body (20-30 tiles duration)
+                isGraniteWillActive = true; // Activate proper immunity mode
+                wallImmunities += random.Value(UPGRADE_STREAM, 20, 30); // Much longer immunity duration
+                gameLog << ">>> GRANITE WILL: Extended immunity activated! (" << wallImmunities << " hits)" << endl;
+                break;
+            }
+
+            case WIND_LOONG: {
+                // Tornado Tiles: Replace pointed tile with current tile (or discard if KEEP)
+                if (mahjongTiles.IsKeepSelected()) {
+                    // If pointing to KEEP, just discard the current tile
+                    Tile discardedTile = mahjongTiles.nextTile;
+                    mahjongTiles.AddToDiscardPile(discardedTile);
+                    mahjongTiles.GenerateNextTile(currentProbabilityBonus);
+                    gameLog << ">>> TORNADO TILES: Discarded " << discardedTile.ToString() << " (KEEP selected)!" << endl;
+                } else {
+                    // Replace the pointed tile with current tile
+                    int arrowPos = mahjongTiles.arrowPosition;
+                    if (arrowPos >= 0 && arrowPos < (int)mahjongTiles.tiles.size()) {
+                        Tile replacedTile = mahjongTiles.tiles[arrowPos];
+                        mahjongTiles.AddToDiscardPile(replacedTile); // Properly discard the replaced tile
+                        mahjongTiles.tiles[arrowPos] = mahjongTiles.nextTile;
+                        mahjongTiles.SortTiles();
+                        mahjongTiles.UpdateHandTrackers(replacedTile, mahjongTiles.nextTile);
+                        mahjongTiles.GenerateNextTile(currentProbabilityBonus);
+
+                        // Add snake growth for using the ability (wind power gives energy)
+                        snake.GrowTail();
+                        gameLog << ">>> TORNADO TILES: Replaced " << replacedTile.ToString() << " with current tile! Snake grew!" << endl;
+                    }
+                }
+                break;
+            }
+
+            case SHADOW_LOONG: {
+                // Nightmare Tiles: Change current tile to whatever tile we are pointing to
+                if (mahjongTiles.IsKeepSelected()) {
+                    gameLog << ">>> NIGHTMARE TILES: Cannot activate when pointing to KEEP!" << endl;
+                } else {
+                    int arrowPos = mahjongTiles.arrowPosition;
+                    if (arrowPos >= 0 && arrowPos < (int)mahjongTiles.tiles.size()) {
+                        Tile pointedTile = mahjongTiles.tiles[arrowPos];
+
+                        // Check if it's a KONG tile
+                        pair<int, TileType> key = {pointedTile.value, pointedTile.type};
+                        if (mahjongTiles.IsGold(key)) {
+                            gameLog << ">>> NIGHTMARE TILES: Cannot activate on KONG tile!" << endl;
+                        } else {
+                            Tile originalTile = mahjongTiles.nextTile;
+                            mahjongTiles.AddToDiscardPile(originalTile);
+                            mahjongTiles.nextTile = Tile(pointedTile.value, pointedTile.type, false);
+                            gameLog << ">>> NIGHTMARE TILES: Changed " << originalTile.ToString() << " to " << mahjongTiles.nextTile.ToString() << "!" << endl;
+                        }
+                    }
+                }
+                break;
+            }
+
+            case CELESTIAL_LOONG: {
+                // Cosmic Wisdom: Instantly MAHJONG and redraw hand
+                gameLog << ">>> COSMIC WISDOM: Instant MAHJONG and hand redraw!" << endl;
+
+                // Apply instant Mahjong bonus
+                mahjongWins++;
+                mahjongWinsAchieved++; // Track for difficulty system
+                ornateLevel = min(mahjongWins, 3);
+
+                int cosmicPoints = mahjongTiles.tiles.size() * 10; // Higher bonus for instant
+                score += cosmicPoints;
+                gameLog << ">>> COSMIC MAHJONG: " << cosmicPoints << " points!" << endl;
+
+                // Add proper snake growth for instant Mahjong (like normal Mahjong wins)
+                int growthAmount = mahjongTiles.tiles.size(); // Grow by number of tiles used
+                for (int i = 0; i < growthAmount; i++) {
+                    snake.GrowTail(); // Add segments
+                }
+                gameLog << ">>> COSMIC GROWTH: Snake grew by " << growthAmount << " segments!" << endl;
+
+                // Redraw hand completely
+                ExpandTiles();
+                mahjongTiles.GenerateNextTile(currentProbabilityBonus);
+
+                // Show cosmic effect
+                showCosmicWisdom = true;
+                cosmicWisdomTimer = 3.0f;
+                break;
+            }
+
+            case PATIENCE_LOONG: {
+                // Pause Control: Pause game and allow direction change
+                gameLog << ">>> PAUSE CONTROL: Time stops, choose new direction!" << endl;
+
+                // Pause the game temporarily
+                isPaused = true;
+                pauseTimer = 2.0f; // 2 seconds to choose direction
+
+                // Allow direction change during pause
+                canChangeDirection = true;
+
+                // Grant temporary immunity during pause
+                wallImmunities += 1;
+                gameLog << ">>> PATIENCE POWER: Game paused for 2 seconds! Choose direction with WASD!" << endl;
+                break;
+            }
+
+            default:
+                gameLog << "*** No special power for this LOONG type!" << endl;
+                return;
+        }
+
+        // Start cooldown
+        shiftPowerReady = false;
+        shiftCooldownTiles = 0;
+        gameLog << "*** SHIFT POWER ON COOLDOWN: " << shiftCooldownMax << " tiles ***" << endl;
+    }
+
+    void GenerateLoongUpgradeChoices() {
+        upgradeChoices.clear();
+        LoongData& currentLoong = availableLOONGs[selectedLoongIndex];
+
+        // Find upgrades that can still be leveled
+        vector<int> availableUpgrades;
+        for (int i = 0; i < (int)currentLoong.upgrades.size(); i++) {
+            if (currentLoong.upgrades[i].level < currentLoong.upgrades[i].maxLevel) {
+                availableUpgrades.push_back(i);
+            }
+        }
+
+        // If we have upgrades available, pick 3 random ones
+        if (availableUpgrades.size() > 0) {
+            for (int i = 0; i < 3 && availableUpgrades.size() > 0; i++) {
+                int randomIndex = random.Value(UPGRADE_STREAM, 0, availableUpgrades.size() - 1);
+                upgradeChoices.push_back(availableUpgrades[randomIndex]);
+                availableUpgrades.erase(availableUpgrades.begin() + randomIndex);
+            }
+        }
+
+        // Fill remaining slots with random upgrades if needed
+        while (upgradeChoices.size() < 3) {
+            int randomUpgrade = random.Value(UPGRADE_STREAM, 0, currentLoong.upgrades.size() - 1);
+            upgradeChoices.push_back(randomUpgrade);
+        }
+
+        loongUpgradeSelection = 0;
+        showLoongUpgrade = true;
+        gameLog << "🎯 Generated " << upgradeChoices.size() << " upgrade choices for " << currentLoong.name << "!" << endl;
+    }
+
+    void ApplyLoongUpgrade(int upgradeIndex) {
+        if (upgradeIndex < 0 || upgradeIndex >= (int)upgradeChoices.size()) return;
+
+        LoongData& currentLoong = availableLOONGs[selectedLoongIndex];
+        int actualUpgradeIndex = upgradeChoices[upgradeIndex];
+        LoongUpgrade& upgrade = currentLoong.upgrades[actualUpgradeIndex];
+
+        if (upgrade.level < upgrade.maxLevel) {
+            upgrade.level++;
+            currentLoong.level++;
+
+            gameLog << "*** UPGRADED " << upgrade.name << " to level " << upgrade.level << "!" << endl;
+            gameLog << ">>> " << currentLoong.name << " is now level " << currentLoong.level << "!" << endl;
+
+            // Apply upgrade effects (this is where the magic happens!)
+            ApplyUpgradeEffects(currentLoong.type, actualUpgradeIndex, upgrade.level);
+
+            // CROSS-LOONG COLOR MIXING: Add this LOONG to mixed types if it's different
+            if (currentLoong.type != selectedLoongType) {
+                // Check if we already have this LOONG type in our mix
+                bool alreadyMixed = false;
+                for (LoongType mixedType : mixedLoongTypes) {
+                    if (mixedType == currentLoong.type) {
+                        alreadyMixed = true;
+                        break;
+                    }
+                }
+
+                if (!alreadyMixed) {
+                    mixedLoongTypes.push_back(currentLoong.type);
+                    gameLog << "🎨 DRAGON FUSION! Added " << currentLoong.name << " to color mix!" << endl;
+                    gameLog << "🎨 Total mixed LOONGs: " << mixedLoongTypes.size() << " + original = " << (mixedLoongTypes.size() + 1) << " dragons!" << endl;
+                }
+            }
+        }
+
+        upgradeChoices.clear(); // Answered: the choices can't be taken again
+        showLoongUpgrade = false;
+    }
+
+    void ApplyUpgradeEffects(LoongType loongType, int upgradeIndex, int level) {
+        gameLog << "*** APPLYING UPGRADE EFFECTS! ***" << endl;
+
+        // This is where each LOONG's unique abilities get applied!
+        // For now, we'll implement basic effects and expand later
+        switch (loongType) {
+            case BASIC_LOONG:
+                ApplyBasicLoongUpgrade(upgradeIndex, level);
+                break;
+            case FIRE_LOONG:
+                ApplyFireLoongUpgrade(upgradeIndex, level);
+                break;
+            case WATER_LOONG:
+                ApplyWaterLoongUpgrade(upgradeIndex, level);
+                break;
+            case WHITE_LOONG:
+                ApplyWhiteLoongUpgrade(upgradeIndex, level);
+                break;
+            case EARTH_LOONG:
+                ApplyEarthLoongUpgrade(upgradeIndex, level);
+                break;
+            case WIND_LOONG:
+                ApplyWindLoongUpgrade(upgradeIndex, level);
+                break;
+            case SHADOW_LOONG:
+                ApplyShadowLoongUpgrade(upgradeIndex, level);
+                break;
+            case CELESTIAL_LOONG:
+                ApplyCelestialLoongUpgrade(upgradeIndex, level);
+                break;
+            case PATIENCE_LOONG:
+                ApplyPatienceLoongUpgrade(upgradeIndex, level);
+                break;
+        }
+    }
+
+    // BASIC LOONG Upgrade Effects - Balanced and Reliable
+    void ApplyBasicLoongUpgrade(int upgradeIndex, int level) {
+        switch (upgradeIndex) {
+            case 0: // Mahjong Mastery - +25% per level
+                mahjongScoreMultiplier += 0.25f;
+                gameLog << "🎯 Mahjong Mastery Level " << level << ": Mahjong multiplier now " << mahjongScoreMultiplier << "x!" << endl;
+                break;
+            case 1: // KONG Power - +50% per level
+                kongScoreMultiplier += 0.5f;
+                gameLog << "💪 KONG Power Level " << level << ": KONG multiplier now " << kongScoreMultiplier << "x!" << endl;
+                break;
+            case 2: // Extra Lives - +1 basic extra life per level
+                extraLives += 1;
+                gameLog << "❤️ Basic Extra Lives Level " << level << ": Gained 1 basic extra life! Total: " << extraLives << endl;
+                break;
+            case 3: // Tile Wisdom - Reduce SHIFT cooldown
+                // Reduce SHIFT cooldown: 10->8->6 seconds
+                if (selectedLoongType == BASIC_LOONG) {
+                    shiftCooldownMax = 10.0f - (level * 2.0f); // 10, 8, 6 seconds
+                    gameLog << "🧠 Tile Wisdom Level " << level << ": SHIFT cooldown reduced to " << shiftCooldownMax << "s!" << endl;
+                }
+                break;
+            case 4: // Speed Control - -15% speed per level
+                currentSpeedMultiplier *= 0.85f;
+                gameLog << "🐌 Speed Control Level " << level << ": Speed reduced to " << (currentSpeedMultiplier * 100) << "%!" << endl;
+                break;
+        }
+    }
+
+    // FIRE LOONG Upgrade Effects - Aggressive and Powerful
+    void ApplyFireLoongUpgrade(int upgradeIndex, int level) {
+        switch (upgradeIndex) {
+            case 0: // Blazing Mahjong - +40% score +5% speed per level
+                mahjongScoreMultiplier += 0.5f;
+                currentSpeedMultiplier *= 1.05f;
+                gameLog << ">>> Blazing Mahjong Level " << level << ": Mahjong " << mahjongScoreMultiplier << "x, speed " << (currentSpeedMultiplier * 100) << "%!" << endl;
+                break;
+            case 1: // Inferno KONG - +75% score +10% speed per level
+                kongScoreMultiplier += 0.75f;
+                currentSpeedMultiplier *= 1.1f;
+                gameLog << ">>> Inferno KONG Level " << level << ": KONG " << kongScoreMultiplier << "x, speed " << (currentSpeedMultiplier * 100) << "%!" << endl;
+                break;
+            case 2: // Speed Demon - +20% speed +20% score +1 extra life
+                currentSpeedMultiplier *= 1.2f;
+                mahjongScoreMultiplier += 0.2f;
+                kongScoreMultiplier += 0.2f;
+                phoenixRebirthCharges += 1;
+                gameLog << ">>> Speed Demon Level " << level << ": Speed " << (currentSpeedMultiplier * 100) << "%, +20% all scores, +1 Phoenix Rebirth!" << endl;
+                break;
+            case 3: // Burning Tiles - Reduce SHIFT cooldown: 15->12->9s
+                if (selectedLoongType == FIRE_LOONG) {
+                    shiftCooldownMax = 15.0f - (level * 3.0f);
+                    gameLog << ">>> Burning Tiles Level " << level << ": SHIFT cooldown reduced to " << shiftCooldownMax << "s!" << endl;
+                }
+                break;
+            case 4: // Blazing Rebirth - Phoenix rebirth +extra score
+                phoenixRebirth = true;
+                phoenixCharges += 1;
+                phoenixRebirthCharges += 1; // Grant Phoenix Rebirth with bonus score on revival
+                gameLog << ">>> Blazing Rebirth Level " << level << ": Phoenix rebirth " << phoenixCharges << " times with extra score!" << endl;
+                break;
+        }
+    }
+
+    // WATER LOONG Upgrade Effects - Defensive and Healing
+    void ApplyWaterLoongUpgrade(int upgradeIndex, int level) {
+        switch (upgradeIndex) {
+            case 0: // Flowing Mahjong - +20% + heal
+                mahjongScoreMultiplier += 0.2f;
+                if (snake.body.size() > 4) snake.PopTail(); // Heal by reducing length
+                gameLog << "🌊 Flowing Mahjong Level " << level << ": Mahjong multiplier " << mahjongScoreMultiplier << "x + healed 1 length!" << endl;
+                break;
+            case 1: // Tidal KONG - +30% + 2 special extra lives
+                kongScoreMultiplier += 0.3f;
+                phoenixRebirthCharges += 2;
+                gameLog << ">>> Tidal KONG Level " << level << ": KONG multiplier " << kongScoreMultiplier << "x + 2 Phoenix Rebirths!" << endl;
+                break;
+            case 2: // Tsunami Shield - Wall immunity +3 per level
+                wallImmunities += 3;
+                gameLog << ">>> Tsunami Shield Level " << level << ": " << wallImmunities << " wall collision immunities!" << endl;
+                break;
+            case 3: // Healing Waters - Reduce length
+                waterHealingAmount = 2 * level;
+                gameLog << ">>> Healing Waters Level " << level << ": Reduce length by " << waterHealingAmount << " every 5 fruits!" << endl;
+                break;
+            case 4: // Ocean Wisdom - SHIFT power (see next 3 tiles)
+                // This is now a SHIFT power, no passive effect
+                gameLog << ">>> Ocean Wisdom Level " << level << ": SHIFT power enhanced!" << endl;
+                break;
+        }
+    }
+
+    // WHITE LOONG Upgrade Effects - Zero Mastery and Purity
+    void ApplyWhiteLoongUpgrade(int upgradeIndex, int level) {
+        switch (upgradeIndex) {
+            case 0: // Pure Mahjong - 1->2->3 tiles become 0 after Mahjong
+                // This will be handled in the Mahjong win logic
+                gameLog << ">>> Pure Mahjong Level " << level << ": " << level << " tiles become 0 after Mahjong!" << endl;
+                break;
+            case 1: // Sacred KONG - +40% KONG score, +200% for four 0 KONG
+                kongScoreMultiplier += 0.4f;
+                gameLog << ">>> Sacred KONG Level " << level << ": KONG " << kongScoreMultiplier << "x, four 0 KONG +200%!" << endl;
+                break;
+            case 2: // Divine Shield - Remove 3->2->1 zeros on death
+                divineShieldZeros = max(1, 4 - level); // 3, 2, 1 zeros removed
+                gameLog << ">>> Divine Shield Level " << level << ": Remove " << divineShieldZeros << " zeros on death!" << endl;
+                break;
+            case 3: // Zero Mastery - SHIFT power enhanced (cooldown reduction)
+                if (selectedLoongType == WHITE_LOONG) {
+                    shiftCooldownMax = max(2, 10 - (level * 2)); // 8, 6, 4 tiles
+                    gameLog << ">>> Zero Mastery Level " << level << ": SHIFT cooldown reduced to " << shiftCooldownMax << " tiles!" << endl;
+                }
+                break;
+            case 4: // Purification - Turn leftmost tile to 0: 15->10->5 tiles
+                purificationThreshold = max(5, 20 - (level * 5)); // 15, 10, 5 tiles
+                gameLog << ">>> Purification Level " << level << ": Auto-purify leftmost tile every " << purificationThreshold << " tiles!" << endl;
+                break;
+        }
+    }
+
+    // EARTH LOONG Upgrade Effects - Slow but Mighty
+    void ApplyEarthLoongUpgrade(int upgradeIndex, int level) {
+        switch (upgradeIndex) {
+            case 0: // Mountain Mahjong - +60% Mahjong score -25% KONG score
+                mahjongScoreMultiplier += 0.6f;
+                kongScoreMultiplier -= 0.25f;
+                gameLog << "⛰️ Mountain Mahjong Level " << level << ": Mahjong " << mahjongScoreMultiplier << "x, KONG " << kongScoreMultiplier << "x!" << endl;
+                break;
+            case 1: // Boulder KONG - +100% KONG score -25% Mahjong score
+                kongScoreMultiplier += 1.0f;
+                mahjongScoreMultiplier -= 0.25f;
+                gameLog << ">>> Boulder KONG Level " << level << ": KONG " << kongScoreMultiplier << "x, Mahjong " << mahjongScoreMultiplier << "x!" << endl;
+                break;
+            case 2: // Stone Skin - -15% speed +3 lives -15% score on death
+                currentSpeedMultiplier *= 0.85f;
+                extraLives += 3;
+                gameLog << ">>> Stone Skin Level " << level << ": Speed " << (currentSpeedMultiplier * 100) << "%, +3 lives, -15% score on death!" << endl;
+                break;
+            case 3: // Earthquake - KONG/consecutive probability +20%
+                currentProbabilityBonus += 20.0f;
+                gameLog << ">>> Earthquake Level " << level << ": +" << (level * 20) << "% KONG/consecutive probability!" << endl;
+                break;
+            case 4: // Granite Will - SHIFT power (temporary immunity)
+                graniteWillActive = true;
+                isGraniteWillActive = true; // Activate proper Granite Will immunity
+                wallImmunities += random.Value(UPGRADE_STREAM, 15 + level * 5, 25 + level * 5); // Scaling immunity duration
+                gameLog << ">>> Granite Will Level " << level << ": SHIFT power enhanced! (" << wallImmunities << " charges)" << endl;
+                break;
+        }
+    }
+
+    // WIND LOONG Upgrade Effects - Fast and Agile
+    void ApplyWindLoongUpgrade(int upgradeIndex, int level) {
+        switch (upgradeIndex) {
+            case 0: // Gale Mahjong - +50% score +25% speed (buffed for speed penalty)
+                mahjongScoreMultiplier += 0.6f;
+                currentSpeedMultiplier *= 1.25f;
+                gameLog << ">>> Gale Mahjong Level " << level << ": Mahjong " << mahjongScoreMultiplier << "x + Speed " << (currentSpeedMultiplier * 100) << "%!" << endl;
+                break;
+            case 1: // Whirlwind KONG - +25% + probability boost
+                kongScoreMultiplier += 0.25f;
+                currentProbabilityBonus += 15.0f;
+                gameLog << ">>> Whirlwind KONG Level " << level << ": KONG " << kongScoreMultiplier << "x + probability boost!" << endl;
+                break;
+            case 2: // Lightning Speed - +25% speed, reduce length 1->2->3 every 5 tiles
+                currentSpeedMultiplier *= 1.25f;
+                windLengthReduction = level;
+                gameLog << ">>> Lightning Speed Level " << level << ": Speed " << (currentSpeedMultiplier * 100) << "%, reduce length " << windLengthReduction << " every 5 tiles!" << endl;
+                break;
+            case 3: // Tornado Tiles - SHIFT power (instantly get tile)
+                // This is now a SHIFT power
+                gameLog << ">>> Tornado Tiles Level " << level << ": SHIFT power enhanced!" << endl;
+                break;
+            case 4: // Wind Walk - Phase through self +3 times per level
+                wallImmunities += 3; // Use wall immunities for self-phasing too
+                gameLog << ">>> Wind Walk Level " << level << ": Phase through self " << (level * 3) << " times!" << endl;
+                break;
+        }
+    }
+
+    // SHADOW LOONG Upgrade Effects - Mysterious and Tricky (REBALANCED FOR SINGLE PLAYER)
+    void ApplyShadowLoongUpgrade(int upgradeIndex, int level) {
+        switch (upgradeIndex) {
+            case 0: // Void Mahjong - +35% score, hide 3->6->9 tiles from pool
+                mahjongScoreMultiplier += 0.35f;
+                gameLog << ">>> Void Mahjong Level " << level << ": Mahjong " << mahjongScoreMultiplier << "x, hide " << (level * 3) << " tiles from pool!" << endl;
+                break;
+            case 1: // Dark KONG - +80% score, discard 1->2->3 tiles on KONG (high risk/reward)
+                kongScoreMultiplier += 0.8f;
+                gameLog << ">>> Dark KONG Level " << level << ": KONG " << kongScoreMultiplier << "x, discard " << level << " tiles on KONG!" << endl;
+                break;
+            case 2: // Shadow Clone - Duplicate Mahjong win once per level
+                shadowCloneCharges += 1;
+                gameLog << ">>> Shadow Clone Level " << level << ": " << shadowCloneCharges << " shadow clone charges (once per level)!" << endl;
+                break;
+            case 3: // Nightmare Tiles - SHIFT power (force next tile same): 10->8->6s
+                if (selectedLoongType == SHADOW_LOONG) {
+                    shiftCooldownMax = 10.0f - (level * 2.0f);
+                    gameLog << ">>> Nightmare Tiles Level " << level << ": SHIFT cooldown reduced to " << shiftCooldownMax << "s!" << endl;
+                }
+                break;
+            case 4: // Dimensional Rift - Teleport on collision +3 charges per level
+                teleportCharges += 3;
+                gameLog << ">>> Dimensional Rift Level " << level << ": " << teleportCharges << " total teleport charges!" << endl;
+                break;
+        }
+    }
+
+    // CELESTIAL LOONG Upgrade Effects - Ultimate Divine Power (REBALANCED)
+    void ApplyCelestialLoongUpgrade(int upgradeIndex, int level) {
+        switch (upgradeIndex) {
+            case 0: // Divine Mahjong - +50% per level (rebalanced from +100%)
+                mahjongScoreMultiplier += 0.5f;
+                gameLog << ">>> Divine Mahjong Level " << level << ": Mahjong multiplier now " << mahjongScoreMultiplier << "x!" << endl;
+                break;
+            case 1: // Heavenly KONG - +75% per level (rebalanced from +200%)
+                kongScoreMultiplier += 0.75f;
+                gameLog << ">>> Heavenly KONG Level " << level << ": KONG multiplier now " << kongScoreMultiplier << "x!" << endl;
+                break;
+            case 2: // Celestial Rebirth - +2 celestial rebirths (normal revival like Bamboo)
+                celestialRebirth = true;
+                celestialCharges += 2;
+                gameLog << ">>> Celestial Rebirth Level " << level << ": Gained 2 Celestial Rebirths! Total: " << celestialCharges << endl;
+                break;
+            case 3: // Cosmic Wisdom - SHIFT power (instant MAHJONG): 30s cooldown
+                if (selectedLoongType == CELESTIAL_LOONG) {
+                shiftCooldownMax = max(10, 25 - (level * 5)); // Scales down: 20 -> 15 -> 10 tiles
+                gameLog << ">>> Cosmic Wisdom Level " << level << ": SHIFT cooldown reduced to " << shiftCooldownMax << " tiles!" << endl;
+                }
+                break;
+            case 4: // Transcendence - LOONG multiplier (4x->5x->6x)
+                loongWinMultiplier = 3 + level; // 4x, 5x, 6x
+                gameLog << ">>> Transcendence Level " << level << ": LOONG win multiplier is now " << loongWinMultiplier << "x!" << endl;
+                break;
+        }
+    }
+
+    // PATIENCE LOONG Upgrade Effects - Dragon of Patience and Control
+    void ApplyPatienceLoongUpgrade(int upgradeIndex, int level) {
+        switch (upgradeIndex) {
+            case 0: // Calm Mahjong - +30% score, -10% speed per level
+                mahjongScoreMultiplier += 0.3f;
+                currentSpeedMultiplier *= 0.9f; // 10% slower
+                gameLog << ">>> Calm Mahjong Level " << level << ": Mahjong " << mahjongScoreMultiplier << "x, speed " << (currentSpeedMultiplier * 100) << "%!" << endl;
+                break;
+            case 1: // Steady KONG - +35% score, immunity on KONG
+                kongScoreMultiplier += 0.35f;
+                wallImmunities += 1; // Gain immunity on each KONG
+                gameLog << ">>> Steady KONG Level " << level << ": KONG " << kongScoreMultiplier << "x, +1 immunity per KONG!" << endl;
+                break;
+            case 2: // Meditation - +2 wall immunity per level
+                wallImmunities += 2;
+                gameLog << ">>> Meditation Level " << level << ": +" << (level * 2) << " wall immunities! Total: " << wallImmunities << endl;
+                break;
+            case 3: // Pause Control - SHIFT power cooldown reduction: 3->2->1->0
+                if (selectedLoongType == PATIENCE_LOONG) {
+                    shiftCooldownMax = max(0.0f, 3.0f - level); // 3, 2, 1, 0 tiles
+                    gameLog << ">>> Pause Control Level " << level << ": SHIFT cooldown reduced to " << shiftCooldownMax << " tiles!" << endl;
+                }
+                break;
+            case 4: // Patience Mastery - Slower = higher score multiplier
+                // The slower you are, the higher your score multiplier
+                float speedPenalty = 1.0f / currentSpeedMultiplier; // Inverse of speed
+                mahjongScoreMultiplier += speedPenalty * 0.1f; // 10% bonus per speed reduction
+                kongScoreMultiplier += speedPenalty * 0.1f;
+                gameLog << ">>> Patience Mastery Level " << level << ": Score multiplier increased based on patience! Mahjong: " << mahjongScoreMultiplier << "x, KONG: " << kongScoreMultiplier << "x!" << endl;
+                break;
+        }
+    }
+
+    void GenerateChoices() {
+        currentChoices.clear();
+        currentChoiceDescriptions.clear();
+
+        // Create a pool of REBALANCED choices with proper pros and cons
+        vector<pair<string, string>> choicePool = {
+            {"Slow Growth", "PRO: Only gain 1 length every 2 fruits\nCON: Slightly increase speed (10%)"},
+            {"Length Reduction", "PRO: Remove 3 length from snake\nCON: Mahjong gives 20% less points"},
+            {"Speed Demon", "PRO: Extra life (survive 1 collision)\nCON: Increase speed by 50%"},
+            {"Lucky Numbers", "PRO: Current tiles 30% more likely\nCON: Snake grows faster (every 4 fruits)"},
+            {"Minimalist", "PRO: Remove 5 length from snake\nCON: Tile pool depletes 25% faster"},
+            {"Turtle Mode", "PRO: Reduce speed by 50%\nCON: Snake grows every 3 fruits"},
+            {"Gambler", "PRO: Double points from Mahjong/Kong\nCON: Lose 1 length every 10 fruits"},
+            {"Perfectionist", "PRO: Mahjong gives 50% bonus points\nCON: Speed increases 20% after Mahjong"},
+            {"Collector", "PRO: Kong appears 40% more often\nCON: Snake grows 2 per fruit"},
+            {"Survivor", "PRO: Extra life + 30% slower speed\nCON: All scores reduced by 30%"},
+            {"Speedster", "PRO: Triple points from all sources\nCON: Speed increases by 200%"},
+            {"Monk", "PRO: Remove 7 length + 40% slower\nCON: No bonus points from wins"}
+        };
+
+        // Randomly select 3 choices
+        for (int i = 0; i < 3; i++) {
+            int randomIndex = random.Value(UPGRADE_STREAM, 0, choicePool.size() - 1);
+            currentChoices.push_back(choicePool[randomIndex].first);
+            currentChoiceDescriptions.push_back(choicePool[randomIndex].second);
+            choicePool.erase(choicePool.begin() + randomIndex);
+        }
+
+        selectedChoice = 0;
+        showChoiceWindow = true;
+        choiceWindowTimer = 0.0f; // No timer - let player take their time
+    }
+
+    void ApplyChoice(int choiceIndex) {
+        if (choiceIndex < 0 || static_cast<size_t>(choiceIndex) >= currentChoices.size()) return;
+
+        string choice = currentChoices[choiceIndex];
+
+        // Check for Granite Will resistance to negative effects
+        if (graniteWillActive) {
+            // 25% chance per level to resist negative effects
+            int resistanceChance = random.Value(UPGRADE_STREAM, 1, 100);
+            if (resistanceChance <= 25) { // Simplified to 25% for now
+                gameLog << "💎 GRANITE WILL ACTIVATED! Resisting negative effect: " << choice << endl;
+                return; // Skip applying the negative effect
+            }
+        }
+
+        gameLog << "Applied choice: " << choice << endl;
+
+        // Apply the effects based on choice name
+        if (choice == "Slow Growth") {
+            slowGrowthActive = true;
+            gameLog << "Slow Growth activated: Only gain 1 length every 2 fruit" << endl;
+        }
+        else if (choice == "Mahjong Nerf") {
+            mahjongNerfActive = true;
+            if (snake.body.size() > 7) { // Keep minimum size
+                for (int i = 0; i < 3; i++) {
+                    snake.PopTail();
+                }
+            }
+            gameLog << "Mahjong Nerf activated: Removed 3 length, Mahjong no longer adds length" << endl;
+        }
+        else if (choice == "Speed Demon") {
+            speedDemonActive = true;
+            extraLives += 1; // Add to existing extra lives
+            currentSpeedMultiplier *= 1.5f; // Increase speed by 50% (was incorrectly setting to 2.0f)
+            gameLog << "Speed Demon activated: Extra life gained, speed increased by 50%" << endl;
+        }
+        else if (choice == "Lucky Numbers") {
+            luckyNumbersActive = true;
+            currentProbabilityBonus = 30.0f; // 30% bonus chance
+            gameLog << "Lucky Numbers activated: Current tiles 30% more likely to appear" << endl;
+        }
+        else if (choice == "Minimalist") {
+            minimalistActive = true;
+            if (snake.body.size() > 9) { // Keep minimum size
+                for (int i = 0; i < 5; i++) {
+                    snake.PopTail();
+                }
+            }
+            gameLog << "Minimalist activated: Removed 5 length, numbers less likely" << endl;
+        }
+        else if (choice == "Turtle Mode") {
+            turtleModeActive = true;
+            currentSpeedMultiplier *= 0.75f; // FIXED: Multiplicative (25% reduction)
+            gameLog << "Turtle Mode activated: Speed reduced by 25%, every 3 fruits add 1 length" << endl;
+        }
+        else if (choice == "Gambler") {
+            gamblerActive = true;
+            gameLog << "Gambler activated: Double points from Mahjong/Kong, lose 2 length every 7 fruits" << endl;
+        }
+        else if (choice == "Perfectionist") {
+            perfectionistActive = true;
+            gameLog << "Perfectionist activated: Mahjong adds 8 length instead of 5" << endl;
+        }
+        else if (choice == "Collector") {
+            collectorActive = true;
+            gameLog << "Collector activated: Kong more frequent, snake grows 2 per fruit" << endl;
+        }
+        else if (choice == "Survivor") {
+            survivorActive = true;
+            extraLives += 1;
+            currentSpeedMultiplier *= 0.85f; // FIXED: Multiplicative (15% reduction)
+            gameLog << "Survivor activated: Extra life + 15% slower speed, no Mahjong/Kong bonuses" << endl;
+        }
+        else if (choice == "Speedster") {
+            speedsterActive = true;
+            currentSpeedMultiplier *= 1.5f; // FIXED: Multiplicative (50% increase)
+            gameLog << "Speedster activated: Triple points from all sources, speed increased by 50%" << endl;
+        }
+        else if (choice == "Monk") {
+            monkActive = true;
+            if (snake.body.size() > 11) { // Keep minimum size
+                for (int i = 0; i < 7; i++) {
+                    snake.PopTail();
+                }
+            }
+            currentSpeedMultiplier *= 0.8f; // FIXED: Multiplicative (20% reduction)
+            gameLog << "Monk activated: Removed 7 length + 20% slower speed, no Mahjong/Kong bonuses" << endl;
+        }
+
+        gameLog << "Choice applied successfully!" << endl;
+    }
+
+    void ExpandTiles() {
+        gameLog << "ExpandTiles called! Current tile count: " << currentTileCount << endl;
+        gameLog << "Current mahjongTiles.maxTiles: " << mahjongTiles.maxTiles << endl;
+        gameLog << "Current mahjongTiles.tiles.size(): " << mahjongTiles.tiles.size() << endl;
+
+        // COMPLETE HAND REDRAW: 4 -> 7 -> 10 -> 13 (every win)
+        if (currentTileCount == 4) {
+            currentTileCount = 7;
+            mahjongTiles.RedrawCompleteHand(7, ornateLevel);
+            gameLog << "🎴 COMPLETE HAND REDRAW: 4 -> 7 tiles!" << endl;
+        } else if (currentTileCount == 7) {
+            currentTileCount = 10;
+            mahjongTiles.RedrawCompleteHand(10, ornateLevel);
+            gameLog << "🎴 COMPLETE HAND REDRAW: 7 -> 10 tiles!" << endl;
+        } else if (currentTileCount == 10) {
+            currentTileCount = 13;
+            mahjongTiles.RedrawCompleteHand(13, ornateLevel);
+            gameLog << "🎴 COMPLETE HAND REDRAW: 10 -> 13 tiles!" << endl;
+        } else {
+            // At maximum tiles (13) - still redraw for shuffling effect
+            mahjongTiles.RedrawCompleteHand(currentTileCount, ornateLevel);
+            gameLog << "🎴 COMPLETE HAND REDRAW: " << currentTileCount << " tiles (shuffle at max)!" << endl;
+        }
+
+        gameLog << "After redraw - currentTileCount: " << currentTileCount << endl;
+        gameLog << "After redraw - mahjongTiles.maxTiles: " << mahjongTiles.maxTiles << endl;
+        gameLog << "After redraw - mahjongTiles.tiles.size(): " << mahjongTiles.tiles.size() << endl;
+    }
+
+    void ApplyGrowthEffects() {
+        // Track tile consumption for SHIFT cooldown
+        tilesConsumed++;
+        shiftCooldownTiles++;
+        tilesConsumedSinceUpgrade++;
+
+        // WHITE LOONG Purification: Turn leftmost tile to 0 every X tiles
+        if (selectedLoongType == WHITE_LOONG) {
+            purificationCounter++;
+            if (purificationCounter >= purificationThreshold) {
+                purificationCounter = 0;
+
+                // Turn leftmost tile to 0
+                if (!mahjongTiles.tiles.empty()) {
+                    Tile purifiedTile = mahjongTiles.tiles[0];
+                    mahjongTiles.tiles[0] = Tile(0, PLAIN_TILES, false);
+                    mahjongTiles.SortTiles();
+                    mahjongTiles.UpdateHandTrackers(purifiedTile, Tile(0, PLAIN_TILES, false));
+                    gameLog << "🤍 PURIFICATION: Leftmost tile turned to 0!" << endl;
+                }
+            }
+        }
+
+        // Check if SHIFT power is ready
+        if (!shiftPowerReady && shiftCooldownTiles >= shiftCooldownMax) {
+            shiftPowerReady = true;
+            gameLog << "*** SHIFT POWER READY: " << shiftPowerName << " ***" << endl;
+        }
+
+        // NEW UPGRADE TILE SYSTEM: Spawn upgrade tiles at age thresholds
+        if (!upgradeSpawned && snakeAge >= nextUpgradeThreshold) {
+            SpawnUpgradeTile();
+        }
+
+        // CROSS-LOONG UPGRADE SYSTEM: Spawn at specific ages 33, 66, 100
+        if (!upgradeSpawned && (snakeAge == 33 || snakeAge == 66 || snakeAge == 100)) {
+            gameLog << "*** CROSS-LOONG UPGRADE TRIGGERED at age " << snakeAge << "! ***" << endl;
+            SpawnUpgradeTile();
+        }
+
+        if (slowGrowthActive) {
+            // Only grow every 2 fruits
+            if (fruitCounter % 2 == 0) {
+                snake.addSegment = true;
+            }
+        } else if (collectorActive) {
+            // Grow 2 per fruit
+            snake.addSegment = true;
+            snake.AddSegments(1); // Add extra segment
+        } else {
+            // Normal growth
+            snake.addSegment = true;
+        }
+    }
+
+    void ApplyFruitEffects() {
+        // Turtle Mode: Every 3 fruits add 1 length
+        if (turtleModeActive && fruitCounter % 3 == 0) {
+            snake.AddSegments(1);
+        }
+
+        // Lucky Numbers: Every 5 fruits add 1 length
+        if (luckyNumbersActive && fruitCounter % 5 == 0) {
+            snake.AddSegments(1);
+        }
+
+        // Gambler: Lose 2 length every 7 fruits
+        if (gamblerActive && fruitCounter % 7 == 0) {
+            if (snake.body.size() > 5) { // Keep minimum size
+                snake.PopTail();
+                if (snake.body.size() > 5) {
+                    snake.PopTail();
+                }
+            }
+        }
+    }
+
+    // NEW UPGRADE TILE SYSTEM FUNCTIONS
+    void SpawnUpgradeTile() {
+        // Free cell off the snake and the food; with none left it's tried again next fruit
+        Vector2 spawnCell;
+        if (!snake.PickSpawnCell(random.streams[FOOD_STREAM], spawnCell, {food.position})) return;
+
+        // Check if this is a cross-LOONG upgrade (33, 66, 100 age)
+        if (snakeAge == 33 || snakeAge == 66 || snakeAge == 100) {
+            // Cross-LOONG upgrades: Always from other LOONG (no SHIFT powers)
+            vector<LoongType> otherTypes;
+            for (int i = 0; i < 9; i++) { // 9 LOONG types total
+                if (i != (int)selectedLoongType) {
+                    otherTypes.push_back((LoongType)i);
+                }
+            }
+            if (!otherTypes.empty()) {
+                upgradeTileType = otherTypes[random.Value(UPGRADE_STREAM, 0, otherTypes.size() - 1)];
+            } else {
+                upgradeTileType = selectedLoongType; // Fallback
+            }
+            gameLog << "*** CROSS-LOONG UPGRADE at age " << snakeAge << "! ***" << endl;
+        } else {
+            // Regular upgrades: Always current LOONG
+            upgradeTileType = selectedLoongType;
+        }
+
+        upgradeTilePosition = spawnCell;
+        upgradeSpawned = true;
+        gameLog << "*** UPGRADE TILE SPAWNED: " << GetLoongTypeName(upgradeTileType) << " at (" << upgradeTilePosition.x << ", " << upgradeTilePosition.y << ") ***" << endl;
+    }
+
+    string GetLoongTypeName(LoongType type) {
+        switch (type) {
+            case BASIC_LOONG: return "Bamboo";
+            case FIRE_LOONG: return "Fire";
+            case WATER_LOONG: return "Water";
+            case WHITE_LOONG: return "White";
+            case EARTH_LOONG: return "Earth";
+            case WIND_LOONG: return "Wind";
+            case SHADOW_LOONG: return "Shadow";
+            case CELESTIAL_LOONG: return "Celestial";
+            case PATIENCE_LOONG: return "Patience";
+            default: return "Unknown";
+        }
+    }
+
+    string GetPowerName(LoongType t) {
+        switch(t) {
+            case BASIC_LOONG: return "Tile Wisdom";
+            case FIRE_LOONG: return "Burning Tiles";
+            case WATER_LOONG: return "Tidal Wave";
+            case WHITE_LOONG: return "Zero Mastery";
+            case EARTH_LOONG: return "Granite Will";
+            case WIND_LOONG: return "Tornado Tiles";
+            case SHADOW_LOONG: return "Nightmare Tiles";
+            case CELESTIAL_LOONG: return "Cosmic Wisdom";
+            case PATIENCE_LOONG: return "Pause Control";
+            default: return "Unknown";
+        }
+    }
+
+    void UpdateSnakeLength() {
+        snakeLength = snake.body.size();
+    }
+
+    void CollectUpgradeTile() {
+        upgradeSpawned = false;
+        // Don't reset tilesConsumedSinceUpgrade - it's for SHIFT cooldown only
+
+        // FIXED UPGRADE SYSTEM: Every 10 levels - 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, then every 10
+        nextUpgradeThreshold += 10; // Simple: every 10 levels (10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120...)
+
+        // Generate upgrade choices for the collected LOONG type
+        GenerateUpgradeChoicesForLoong(upgradeTileType);
+        gameLog << "*** COLLECTED " << GetLoongTypeName(upgradeTileType) << " UPGRADE TILE! Next threshold: " << nextUpgradeThreshold << " ***" << endl;
+    }
+
+    void CollectLatentUpgradeTile() {
+        latentUpgradeSpawned = false;
+
+        // Generate upgrade choices for the collected latent LOONG type
+        GenerateUpgradeChoicesForLoong(latentUpgradeTileType);
+        gameLog << "*** COLLECTED LATENT CULTIVATION " << GetLoongTypeName(latentUpgradeTileType) << " UPGRADE TILE! ***" << endl;
+    }
+
+    void GenerateUpgradeChoicesForLoong(LoongType loongType) {
+        upgradeChoices.clear();
+
+        // Find the LOONG data for this type
+        int loongIndex = -1;
+        for (int i = 0; i < (int)availableLOONGs.size(); i++) {
+            if (availableLOONGs[i].type == loongType) {
+                loongIndex = i;
+                break;
+            }
+        }
+
+        if (loongIndex == -1) return;
+
+        LoongData& targetLoong = availableLOONGs[loongIndex];
+
+        // Check if this is a cross-LOONG upgrade (other LOONG) or own LOONG
+        bool isCrossLoong = (loongType != selectedLoongType);
+
+        if (isCrossLoong) {
+            // CROSS-LOONG: 2 out of 4 choices (exclude SHIFT powers)
+            vector<int> availableUpgrades;
+            for (int i = 0; i < (int)targetLoong.upgrades.size(); i++) {
+                // Skip SHIFT power upgrades for cross-LOONG
+                bool isShiftPower = false;
+                string upgradeName = targetLoong.upgrades[i].name;
+                if (upgradeName.find("Wisdom") != string::npos ||
+                    upgradeName.find("Tiles") != string::npos ||
+                    upgradeName.find("SHIFT") != string::npos ||
+                    upgradeName.find("Sight") != string::npos ||
+                    upgradeName.find("Will") != string::npos ||
+                    upgradeName.find("Cosmic") != string::npos ||
+                    upgradeName.find("Purification") != string::npos ||
+                    upgradeName.find("Control") != string::npos) {
+                    isShiftPower = true;
+                }
+
+                if (!isShiftPower && targetLoong.upgrades[i].level < targetLoong.upgrades[i].maxLevel) {
+                    availableUpgrades.push_back(i);
+                }
+            }
+
+            // Pick 2 random non-SHIFT upgrades
+            for (int i = 0; i < 2 && availableUpgrades.size() > 0; i++) {
+                int randomIndex = random.Value(UPGRADE_STREAM, 0, availableUpgrades.size() - 1);
+                upgradeChoices.push_back(availableUpgrades[randomIndex]);
+                availableUpgrades.erase(availableUpgrades.begin() + randomIndex);
+            }
+        } else {
+            // OWN LOONG: 3 out of 5 choices (include SHIFT powers)
+            vector<int> availableUpgrades;
+            for (int i = 0; i < (int)targetLoong.upgrades.size(); i++) {
+                if (targetLoong.upgrades[i].level < targetLoong.upgrades[i].maxLevel) {
+                    availableUpgrades.push_back(i);
+                }
+            }
+
+            // Pick 3 random upgrades (including SHIFT powers)
+            for (int i = 0; i < 3 && availableUpgrades.size() > 0; i++) {
+                int randomIndex = random.Value(UPGRADE_STREAM, 0, availableUpgrades.size() - 1);
+                upgradeChoices.push_back(availableUpgrades[randomIndex]);
+                availableUpgrades.erase(availableUpgrades.begin() + randomIndex);
+            }
+        }
+
+        // Set the selected LOONG index temporarily for the upgrade screen
+        int originalIndex = selectedLoongIndex;
+        selectedLoongIndex = loongIndex;
+
+        loongUpgradeSelection = 0;
+        showLoongUpgrade = true;
+
+        // Restore original index after showing upgrade
+        // (This will be handled in the upgrade application)
+    }
+
+    // Countdown and popup timers, advanced by the frame time
+    void UpdateTimers(float deltaTime)
+    {
+        if (gameState == COUNTDOWN) {
+            // Handle countdown - comfortable speed, updated every frame
+            countdownTimer -= deltaTime;
+            if (countdownTimer <= 2.0f && countdownNumber == 3) {
+                countdownNumber = 2;
+                // Play "Two" sound - higher pitch for clarity
+                SetGameSoundPitch(SOUND_EAT, 1.2f);
+                PlayGameSound(SOUND_EAT);
+            } else if (countdownTimer <= 1.0f && countdownNumber == 2) {
+                countdownNumber = 1;
+                // Play "One" sound - even higher pitch
+                SetGameSoundPitch(SOUND_EAT, 1.5f);
+                PlayGameSound(SOUND_EAT);
+            } else if (countdownTimer <= 0.0f) {
+                // Play "Go!" sound - highest pitch
+                SetGameSoundPitch(SOUND_EAT, 2.0f);
+                PlayGameSound(SOUND_EAT);
+                // Reset sound pitch for normal gameplay
+                SetGameSoundPitch(SOUND_EAT, 1.0f);
+                BeginPlaying();
+            }
+        }
+
+        // Update number popup every frame for smooth animation
+        numberPopup.Update(deltaTime);
+
+        // Update mahjong win display every frame
+        if (showMahjongWin) {
+            mahjongWinTimer -= deltaTime;
+            if (mahjongWinTimer <= 0) {
+                showMahjongWin = false;
+            }
+        }
+
+        // Update kong win display every frame
+        if (showKongWin) {
+            kongWinTimer -= deltaTime;
+            if (kongWinTimer <= 0) {
+                showKongWin = false;
+            }
+        }
+
+        // Update phoenix rebirth effect
+        if (showPhoenixRebirth) {
+            phoenixRebirthTimer -= deltaTime;
+            if (phoenixRebirthTimer <= 0) {
+                showPhoenixRebirth = false;
+            }
+        }
+
+        // Update cosmic wisdom effect
+        if (showCosmicWisdom) {
+            cosmicWisdomTimer -= deltaTime;
+            if (cosmicWisdomTimer <= 0) {
+                showCosmicWisdom = false;
+            }
+        }
+
+        // SHIFT power cooldown is now tile-based, updated when tiles are consumed
+
+        // Update choice window (no timer - let player take their time)
+        if (showChoiceWindow) {
+            // No auto-selection - player must choose
+        }
+    }
+
+    void UpdateGameplay(float deltaTime)
+    {
+        // Update latent cultivation upgrade spawning (SEPARATE from normal upgrades)
+        if (!pendingLatentUpgrades.empty() && !latentUpgradeSpawned) {
+            latentUpgradeSpawnTimer -= deltaTime;
+            // Free cell off the snake, food, and normal upgrade tile; with none left the
+            // timer stays run out and the next tick tries again
+            Vector2 spawnCell;
+            if (latentUpgradeSpawnTimer <= 0.0f &&
+                snake.PickSpawnCell(random.streams[FOOD_STREAM], spawnCell, {food.position, upgradeSpawned ? upgradeTilePosition : NO_CELL})) {
+                // Spawn the next latent cultivation tile in queue
+                LoongType nextUpgrade = pendingLatentUpgrades[0];
+                pendingLatentUpgrades.erase(pendingLatentUpgrades.begin());
+
+                // Spawn latent cultivation tile separately from normal upgrades
+                latentUpgradeTileType = nextUpgrade;
+                latentUpgradeTilePosition = spawnCell;
+                latentUpgradeSpawned = true;
+                gameLog << "Spawned latent cultivation tile: " << GetLoongTypeName(nextUpgrade) << " at (" << latentUpgradeTilePosition.x << ", " << latentUpgradeTilePosition.y << ")" << endl;
+
+                // Reset timer for next spawn
+                latentUpgradeSpawnTimer = latentUpgradeSpawnDelay;
+            }
+        }
+
+        if (gameState == PLAYING && !showChoiceWindow && !showLoongUpgrade && !isInExtraLifeMode && !isPaused) // Pause game during choice window, LOONG upgrade, extra life, or ability pause
+        {
+            snake.Update();
+            CheckCollisionWithFood();
+            if (isInExtraLifeMode || gameState != PLAYING) return; // Stop immediately if life used
+            CheckCollisionWithEdges();
+            if (isInExtraLifeMode || gameState != PLAYING) return; // Stop immediately if life used
+            CheckCollisionWithTail();
+        }
+    }
+
+    void BeginPlaying() {
+        gameState = PLAYING;
+
+        // Trigger latent cultivation spawning now that the game has started
+        if (!latentCultivationSpawned && selectedLatentLevel > 0) {
+            SpawnLatentCultivationUpgrades();
+            latentCultivationSpawned = true;
+        }
+    }
+
+    // Start a run the way the menus do, without the countdown (headless runs)
+    void StartRun(LoongType loongType, DifficultyLevel difficulty) {
+        selectedLoongIndex = loongType;
+        selectedLoongType = availableLOONGs[selectedLoongIndex].type;
+        InitializeShiftPower();
+
+        selectedDifficulty = difficulty;
+        ApplyDifficultySettings();
+        BeginPlaying();
+    }
+
+    void StartCountdown() {
+        gameState = COUNTDOWN;
+        countdownTimer = 3.0f; // 3 seconds countdown (comfortable speed)
+        countdownNumber = 3;
+    }
+
+    void ApplyDifficultySettings() {
+        gameLog << "Applying difficulty: " << difficultyNames[selectedDifficulty] << endl;
+
+        // Reset difficulty-specific variables
+        mahjongWinsRequired = 0;
+        mahjongWinsAchieved = 0;
+
+        switch (selectedDifficulty) {
+            case FOUNDATION_BUILDING:
+                // 3 Extra Lives
+                extraLives = 3;
+                phoenixRebirthCharges = 0;
+                mahjongTiles.SetTileCount(4); // Start with 4 tiles
+                // Generate normal tiles
+                mahjongTiles.GenerateRandomTiles(0);
+                break;
+
+            case GOLDEN_CORE:
+                // 1 Life, no Extra Lives
+                extraLives = 0;
+                phoenixRebirthCharges = 0;
+                mahjongTiles.SetTileCount(4); // Start with 4 tiles
+                // Generate normal tiles
+                mahjongTiles.GenerateRandomTiles(0);
+                break;
+
+            case NASCENT_SOUL:
+                // Start with 7 tiles, need 2 Mahjongs to reach 13 tiles
+                extraLives = 1;
+                phoenixRebirthCharges = 0;
+                mahjongTiles.SetTileCount(7); // Start with 7 tiles
+                // Generate normal tiles
+                mahjongTiles.GenerateRandomTiles(0);
+                mahjongWinsRequired = 2; // Need 2 Mahjongs before can win
+                break;
+
+            case ASCENSION:
+                // Start with 10 tiles, need 5 Mahjongs to win
+                extraLives = 1;
+                phoenixRebirthCharges = 0;
+                mahjongTiles.SetTileCount(10); // Start with 10 tiles
+                // Generate normal tiles
+                mahjongTiles.GenerateRandomTiles(0);
+                mahjongWinsRequired = 5; // Need 5 Mahjongs before can win
+                break;
+
+            case IMMORTAL_SAGE:
+                // Start with 13 tiles, need 5 Mahjongs to win
+                extraLives = 1;
+                phoenixRebirthCharges = 0;
+                mahjongTiles.SetTileCount(13); // Start with 13 tiles
+                // Generate normal tiles
+                mahjongTiles.GenerateRandomTiles(0);
+                mahjongWinsRequired = 5; // Need 5 Mahjongs before can win
+                ornateLevel = LEVEL_3_INTRICATE; // Start at ornate level 3.5 (need to reach 4 to win)
+                break;
+        }
+
+        gameLog << "Difficulty applied: Lives=" << extraLives << ", Tiles=" << mahjongTiles.maxTiles
+             << ", MahjongWinsRequired=" << mahjongWinsRequired << endl;
+    }
+
+    void InitializeDifficultySystem() {
+        // Initialize all difficulties as locked except Foundation Building
+        for (int loong = 0; loong < 9; loong++) {
+            for (int diff = 0; diff < 5; diff++) {
+                pair<LoongType, DifficultyLevel> key = {(LoongType)loong, (DifficultyLevel)diff};
+                difficultyUnlocked[key] = (diff == 0 && loong == 0); // Only Fa Cai Foundation Building unlocked initially
+                loongHighScores[key] = 0; // Initialize high scores to 0
+            }
+        }
+
+        // Load saved progress
+        LoadProgressData();
+
+        // Set selectedLoongIndex to first unlocked dragon
+        selectedLoongIndex = 0;
+        for (int i = 0; i < 9; i++) {
+            pair<LoongType, DifficultyLevel> key = {(LoongType)i, FOUNDATION_BUILDING};
+            if (difficultyUnlocked[key]) {
+                selectedLoongIndex = i;
+                break;
+            }
+        }
+
+        gameLog << "Difficulty system initialized with sequential dragon unlocking" << endl;
+    }
+
+    void UnlockNextDifficulty() {
+        // Unlock the next difficulty level for this specific LOONG
+        if (selectedDifficulty < IMMORTAL_SAGE) {
+            DifficultyLevel nextDiff = (DifficultyLevel)(selectedDifficulty + 1);
+            pair<LoongType, DifficultyLevel> nextKey = {selectedLoongType, nextDiff};
+
+            if (!difficultyUnlocked[nextKey]) {
+                difficultyUnlocked[nextKey] = true;
+                gameLog << "🎉 UNLOCKED: " << difficultyNames[nextDiff] << " for "
+                     << availableLOONGs[selectedLoongIndex].name << "! 🎉" << endl;
+            }
+        }
+
+        // Check if we should unlock the next dragon (Foundation Building difficulty only)
+        if (selectedDifficulty == FOUNDATION_BUILDING) {
+            // Dragon unlock order: Fa Cai -> Hong Zhong -> Bai Ban -> Long Wang -> Huang Di -> Qing Long -> Ju Long -> Ren Long -> Shen Long
+            LoongType nextDragon = (LoongType)((int)selectedLoongType + 1);
+            if (nextDragon < 9) { // Valid next dragon exists
+                pair<LoongType, DifficultyLevel> nextDragonKey = {nextDragon, FOUNDATION_BUILDING};
+
+                if (!difficultyUnlocked[nextDragonKey]) {
+                    difficultyUnlocked[nextDragonKey] = true;
+                    gameLog << "🐉 UNLOCKED NEW DRAGON: " << availableLOONGs[(int)nextDragon].name << "! 🐉" << endl;
+                }
+            }
+        }
+
+        // Save progress after unlocking
+        SaveProgressData();
+    }
+
+    void CheckCollisionWithFood()
+    {
+        // Food that found no free cell when it was eaten tries again every tick
+        if (!food.Placed()) food.Respawn(snake, random.streams[FOOD_STREAM]);
+
+        // Check collision with upgrade tile first
+        if (upgradeSpawned && SameCell(snake.body[0], upgradeTilePosition)) {
+            CollectUpgradeTile();
+            return; // Don't process food collision this frame
+        }
+
+        // Check collision with latent cultivation tile
+        if (latentUpgradeSpawned && SameCell(snake.body[0], latentUpgradeTilePosition)) {
+            CollectLatentUpgradeTile();
+            return; // Don't process food collision this frame
+        }
+
+        if (SameCell(snake.body[0], food.position))
+        {
+            // Increase snake age and fruit counter
+            snakeAge++;
+            fruitCounter++;
+
+            // Use the next tile (strategic preview system)
+            Tile newTile = mahjongTiles.nextTile;
+
+            // Generate the next preview tile for next fruit
+            mahjongTiles.GenerateNextTile(currentProbabilityBonus);
+
+            // Show number popup at the snake head
+            numberPopup.Show(newTile, snake.body[0]); // Show the full tile for popup
+
+            // Check for KONG condition first
+            if (mahjongTiles.CheckKongCondition(newTile))
+            {
+                // KONG condition met! Show celebration
+                showKongWin = true;
+                kongWinTimer = 0.8f; // Show briefly
+
+                // Play triumphant "Kong" sound
+                SetGameSoundPitch(SOUND_EAT, 1.8f);
+                PlayGameSound(SOUND_EAT);
+
+                // Apply power-up effects to scoring - KONG gives HALF of Mahjong score
+                int kongPoints = (mahjongTiles.tiles.size() * 5) / 2; // Half of Mahjong score
+
+                // Apply old evolution system multipliers
+                if (gamblerActive) kongPoints *= 2;
+                if (speedsterActive) kongPoints *= 3;
+                if (survivorActive || monkActive) kongPoints = 0; // No bonuses
+
+                UpdateLoongTotalScore(kongPoints); // Update latent upgrade progress
+
+                // Apply LOONG upgrade multipliers! 🐉✨
+                if (kongPoints > 0) {
+                    // WHITE LOONG Sacred KONG: Check for four 0 KONG (200% bonus)
+                    if (selectedLoongType == WHITE_LOONG && newTile.IsZero()) {
+                        // Count zeros in hand
+                        int zeroCount = 0;
+                        for (const Tile& tile : mahjongTiles.tiles) {
+                            if (tile.IsZero()) zeroCount++;
+                        }
+
+                        if (zeroCount >= 3) { // 3 in hand + 1 new = 4 zeros
+                            kongPoints = (int)(kongPoints * 3.0f); // 200% bonus = 3x total
+                            gameLog << "🤍 SACRED KONG: Four 0 KONG! 200% bonus! " << kongPoints << " points!" << endl;
+                        }
+                    }
+
+                    kongPoints = (int)(kongPoints * kongScoreMultiplier);
+                    gameLog << "🐉 LOONG KONG Bonus: " << kongPoints << " points (x" << kongScoreMultiplier << " multiplier)!" << endl;
+                }
+
+                score += kongPoints;
+                UpdateLoongTotalScore(kongPoints); // Update latent upgrade progress
+                if (score > highScore)
+                {
+                    highScore = score;
+                }
+
+                // KONG does NOT give instant win - continue playing with remaining tiles
+                // The KONG tiles are already marked as gold and removed from pool
+                gameLog << "KONG scored " << kongPoints << " points. Continue playing with remaining tiles." << endl;
+            }
+            // Check if this creates a winning combination
+            else if (mahjongTiles.CheckWinCondition(newTile, ornateLevel))
+            {
+                // Check if this is a LOONG win (1-9 consecutive of same type)
+                vector<Tile> testTiles = mahjongTiles.tiles;
+                testTiles.push_back(newTile);
+                mahjongTiles.SortTilesVector(testTiles);
+
+                if (ornateLevel >= 2 && mahjongTiles.HasLoongWin(testTiles) && mahjongWinsAchieved >= mahjongWinsRequired) {
+                    // LOONG WIN! Apply LOONG multiplier and go to cultivation success
+                    gameLog << "LOONG WIN ACHIEVED! CULTIVATION SUCCESS!" << endl;
+
+                    // Apply LOONG win multiplier (default 3x, can be upgraded to 4x, 5x, 6x)
+                    score *= loongWinMultiplier;
+                    gameLog << "🐉 LOONG WIN MULTIPLIER: " << loongWinMultiplier << "x! Final score: " << score << "!" << endl;
+                    if (score > highScore) {
+                        highScore = score;
+                        SaveHighScore();
+                    }
+
+                    // Update LOONG-specific high score
+                    pair<LoongType, DifficultyLevel> currentKey = {selectedLoongType, selectedDifficulty};
+                    if (score > loongHighScores[currentKey]) {
+                        loongHighScores[currentKey] = score;
+                        gameLog << "New LOONG high score for " << availableLOONGs[selectedLoongIndex].name
+                             << " (" << difficultyNames[selectedDifficulty] << "): " << score << endl;
+                    }
+
+                    // Unlock next difficulty since we achieved LOONG
+                    UnlockNextDifficulty();
+
+                    // Go to cultivation success screen
+                    gameState = CULTIVATION_SUCCESS;
+                    PlayGameSound(SOUND_MAHJONG_WIN);
+                    return; // Exit early, don't continue normal game
+                }
+
+                // Normal Mahjong win
+                showMahjongWin = true;
+                mahjongWinTimer = 0.8f; // Show briefly
+
+                // Increase mahjong wins and ornate level (simplified to 0-3)
+                mahjongWins++;
+                mahjongWinsAchieved++; // Track for difficulty system
+                int previousOrnateLevel = ornateLevel;
+                ornateLevel = min(mahjongWins, 3); // 1st win = level 1, 2nd = level 2, 3rd = level 3
+
+                // Show LOONG popup when reaching level 3 for the first time
+                if (ornateLevel == 3 && previousOrnateLevel < 3) {
+                    gameLog << "REACHED FINAL LEVEL! LOONG WIN CONDITION UNLOCKED!" << endl;
+                    // The popup will be shown in the UI
+                }
+
+                // Expand tiles after every Mahjong win
+                ExpandTiles();
+
+                // Note: RedrawCompleteHand() already sorts the hand automatically
+
+                // Play triumphant "Mahjong" sound
+                PlayGameSound(SOUND_MAHJONG_WIN);
+
+                // Apply power-up effects to scoring - new formula: tiles * 5
+                int mahjongPoints = mahjongTiles.tiles.size() * 5; // 4 tiles * 5 = 20 points
+
+                // Apply old evolution system multipliers
+                if (gamblerActive) mahjongPoints *= 2;
+                if (speedsterActive) mahjongPoints *= 3;
+                if (survivorActive || monkActive) mahjongPoints = 0; // No bonuses
+
+                UpdateLoongTotalScore(mahjongPoints); // Update latent upgrade progress
+
+                // Apply LOONG upgrade multipliers! 🐉✨
+                if (mahjongPoints > 0) {
+                    mahjongPoints = (int)(mahjongPoints * mahjongScoreMultiplier);
+
+                    // Check for Shadow Clone effect
+                    if (shadowCloneCharges > 0) {
+                        shadowCloneCharges--;
+                        mahjongPoints *= 2; // Double the points
+                        gameLog << "👥 SHADOW CLONE ACTIVATED! Doubling Mahjong score! Charges remaining: " << shadowCloneCharges << endl;
+                    }
+
+                    gameLog << "🐉 LOONG Mahjong Bonus: " << mahjongPoints << " points (x" << mahjongScoreMultiplier << " multiplier)!" << endl;
+                }
+
+                score += mahjongPoints;
+                UpdateLoongTotalScore(mahjongPoints); // Update latent upgrade progress
+                if (score > highScore)
+                {
+                    highScore = score;
+                }
+
+                // Apply power-up effects to length
+                if (!mahjongNerfActive && !survivorActive && !monkActive) {
+                    int lengthToAdd = 5;
+                    if (perfectionistActive) lengthToAdd = 8;
+                    snake.AddSegments(lengthToAdd);
+                }
+
+                // WHITE LOONG Pure Mahjong: Turn tiles to 0 after Mahjong
+                if (selectedLoongType == WHITE_LOONG) {
+                    // Get Pure Mahjong level (upgrade index 0)
+                    int pureMahjongLevel = 0;
+                    for (const LoongData& loong : availableLOONGs) {
+                        if (loong.type == WHITE_LOONG) {
+                            pureMahjongLevel = loong.upgrades[0].level;
+                            break;
+                        }
+                    }
+
+                    // Turn 1->2->3 tiles to 0 based on upgrade level
+                    if (pureMahjongLevel > 0) {
+                        int tilesToConvert = min(pureMahjongLevel, (int)mahjongTiles.tiles.size());
+                        for (int i = 0; i < tilesToConvert; i++) {
+                            mahjongTiles.tiles[i] = Tile(0, PLAIN_TILES, false); // Convert to zero
+                        }
+                        mahjongTiles.SortTiles();
+                        mahjongTiles.RebuildHandTrackers();
+                        gameLog << ">>> PURE MAHJONG: Converted " << tilesToConvert << " tiles to 0!" << endl;
+                    }
+                }
+
+                // CRITICAL FIX: Generate new next tile without resetting hand
+                mahjongTiles.GenerateNextTile(currentProbabilityBonus);
+            }
+            else
+            {
+                // Normal eat sound - ensure normal pitch (optimized)
+                PlayGameSoundSafe(SOUND_EAT, 1.0f, soundCooldown);
+
+                // Check if KEEP is selected
+                if (mahjongTiles.IsKeepSelected())
+                {
+                    // KEEP at final level: ONLY check for LOONG wins, never Mahjong
+                    if (ornateLevel >= LEVEL_4_DRAGON) {
+                        // At final level, KEEP only allows LOONG wins (risk-reward dynamic)
+                        vector<Tile> testTiles = mahjongTiles.tiles;
+                        testTiles.push_back(newTile);
+                        mahjongTiles.SortTilesVector(testTiles);
+
+                        if (mahjongTiles.HasLoongWin(testTiles) && mahjongWinsAchieved >= mahjongWinsRequired) {
+                            // LOONG WIN! Apply LOONG multiplier and go to cultivation success
+                            gameLog << "LOONG WIN ACHIEVED WITH KEEP! CULTIVATION SUCCESS!" << endl;
+
+                            // Apply LOONG win multiplier (default 3x, can be upgraded to 4x, 5x, 6x)
+                            score *= loongWinMultiplier;
+                            gameLog << "🐉 LOONG WIN MULTIPLIER: " << loongWinMultiplier << "x! Final score: " << score << "!" << endl;
+                            if (score > highScore) {
+                                highScore = score;
+                                SaveHighScore();
+                            }
+
+                            // Update LOONG-specific high score
+                            pair<LoongType, DifficultyLevel> currentKey = {selectedLoongType, selectedDifficulty};
+                            if (score > loongHighScores[currentKey]) {
+                                loongHighScores[currentKey] = score;
+                                gameLog << "New LOONG high score for " << availableLOONGs[selectedLoongIndex].name
+                                     << " (" << difficultyNames[selectedDifficulty] << "): " << score << endl;
+                            }
+
+                            // Unlock next difficulty since we achieved LOONG
+                            UnlockNextDifficulty();
+
+                            // Go to cultivation success screen
+                            gameState = CULTIVATION_SUCCESS;
+                            PlayGameSound(SOUND_MAHJONG_WIN);
+                            return; // Exit early, don't continue normal game
+                        }
+
+                        // KEEP at final level: No Mahjong check, just discard tile
+                        gameLog << "KEEP at final level - aiming for LOONG only! Tile discarded." << endl;
+                    }
+
+                    // Apply growth effects
+                    ApplyGrowthEffects();
+                }
+                else
+                {
+                    // Replace tile at arrow position
+                    mahjongTiles.ReplaceTileAtArrow(newTile);
+                    ApplyGrowthEffects();
+                }
+
+                // Apply fruit-based power-up effects
+                ApplyFruitEffects();
+
+                // Add fruit scoring - +1 point per fruit
+                score += 1;
+                UpdateLoongTotalScore(1); // Update latent upgrade progress
+                if (score > highScore)
+                {
+                    highScore = score;
+                }
+            }
+
+            // OLD AUTOMATIC UPGRADE SYSTEM REMOVED
+            // Now using physical upgrade tiles that must be collected!
+
+            // OLD EVOLUTION SYSTEM REMOVED
+            // Now using upgrade tile system for all progression!
+
+            // Generate new food position
+            food.Respawn(snake, random.streams[FOOD_STREAM]);
+
+            // REMOVED: Legacy Celestial LOONG auto-complete ability
+            // Now only available as SHIFT power
+
+            // Check for Earth LOONG Earthquake auto-shuffle
+            earthquakeCounter++;
+            if (earthquakeCounter >= earthquakeThreshold) {
+                gameLog << "🌍 EARTHQUAKE! Auto-shuffling tiles after " << earthquakeThreshold << " fruits!" << endl;
+                earthquakeCounter = 0;
+
+                // CRITICAL FIX: Shuffle existing hand instead of regenerating
+                mahjongTiles.ShuffleExistingHand();
+
+                // Play earthquake sound (optimized)
+                PlayGameSoundSafe(SOUND_EAT, 0.5f, soundCooldown);
+            }
+
+            // Check for Wind LOONG Tornado tile swaps
+            tornadoCounter++;
+            if (tornadoCounter >= tornadoThreshold) {
+                gameLog << "🌪️ TORNADO! Swapping 2 random tiles after " << tornadoThreshold << " fruits!" << endl;
+                tornadoCounter = 0;
+
+                // Swap 2 random tiles in hand
+                if (mahjongTiles.tiles.size() >= 2) {
+                    int idx1 = mahjongTiles.random.Value(0, mahjongTiles.tiles.size() - 1);
+                    int idx2 = mahjongTiles.random.Value(0, mahjongTiles.tiles.size() - 1);
+                    if (idx1 != idx2) {
+                        swap(mahjongTiles.tiles[idx1], mahjongTiles.tiles[idx2]);
+                        mahjongTiles.SortTiles();
+                    }
+                }
+
+                // Play tornado sound (optimized)
+                PlayGameSoundSafe(SOUND_EAT, 1.8f, soundCooldown);
+            }
+
+            // Check for Water LOONG Healing Waters
+            healingCounter++;
+            if (healingCounter >= 5 && waterHealingAmount > 0) { // Every 5 fruits
+                gameLog << "💧 HEALING WATERS! Reducing length by " << waterHealingAmount << "!" << endl;
+                healingCounter = 0;
+
+                // Reduce snake length (healing effect)
+                for (int i = 0; i < waterHealingAmount; i++) {
+                    if (snake.body.size() > 6) {
+                        snake.PopTail();
+                    }
+                }
+
+                // Play healing sound (optimized)
+                PlayGameSoundSafe(SOUND_EAT, 1.3f, soundCooldown);
+            }
+
+            // Check for Wind LOONG Lightning Speed length reduction
+            if (fruitCounter % 5 == 0 && windLengthReduction > 0) {
+                gameLog << "🌪️ LIGHTNING SPEED! Reducing length by " << windLengthReduction << "!" << endl;
+                for (int i = 0; i < windLengthReduction; i++) {
+                    if (snake.body.size() > 6) {
+                        snake.PopTail();
+                    }
+                }
+            }
+        }
+    }
+
+    void CheckCollisionWithEdges()
+    {
+        if (snake.body[0].x == cellCount || snake.body[0].x == -1 ||
+            snake.body[0].y == cellCount || snake.body[0].y == -1)
+        {
+            // Move head back to previous valid position immediately by shrinking
+            if (snake.body.size() > 1) {
+                snake.PopHead();
+            }
+            snake.direction = {0, 0}; // Hard stop: prevent tunneling through wall
+
+            // Check for wall immunity (Water LOONG Tsunami Shield or Earth/White LOONG Granite Will)
+            if (wallImmunities > 0) {
+                wallImmunities--;
+
+                if (isGraniteWillActive) {
+                    gameLog << ">>> GRANITE WILL IMMUNITY: Stopped at wall! Immunities remaining: " << wallImmunities << endl;
+                } else {
+                    gameLog << ">>> TSUNAMI SHIELD ACTIVATED! Wall collision ignored. Remaining immunities: " << wallImmunities << endl;
+
+                    // Teleport snake to the safest free cell (middle of the largest open region)
+                    Vector2 safePos;
+                    if (safeCells.Find(snake.occupancy, safePos)) snake.MoveHead(safePos);
+                }
+
+                // Play special immunity sound (optimized)
+                PlayGameSoundSafe(SOUND_EAT, 0.8f, soundCooldown);
+
+                return; // Don't die
+            }
+
+            HandleDeath();
+        }
+    }
+
+    void HandleDeath()
+    {
+        // Check for Phoenix Rebirth (Fire LOONG ability)
+        if (phoenixRebirth && phoenixCharges > 0) {
+            phoenixCharges--;
+            gameLog << "🔥🐦 PHOENIX REBIRTH ACTIVATED! Reviving with full score! Charges remaining: " << phoenixCharges << endl;
+
+            // Keep current score (don't reset)
+            // Reset snake position to the safest free cell
+            Vector2 safePos;
+            if (safeCells.Find(snake.occupancy, safePos)) snake.MoveHead(safePos);
+            isInExtraLifeMode = true;
+
+            // Show epic phoenix rebirth effect
+            showPhoenixRebirth = true;
+            phoenixRebirthTimer = 3.0f;
+            PlayGameSoundSafe(SOUND_EAT, 2.0f, 0.0f);
+
+            return; // Don't continue to normal death handling
+        }
+
+        // Use Celestial Rebirth first (normal revival like Bamboo)
+        if (celestialRebirth && celestialCharges > 0) {
+            celestialCharges--;
+            isInExtraLifeMode = true;
+            lastExtraLifeType = "Celestial";
+            gameLog << ">>> CELESTIAL REBIRTH ACTIVATED! Normal revival! Charges remaining: " << celestialCharges << endl;
+            ApplySpecialExtraLifeEffect();
+            PlayGameSoundSafe(SOUND_EAT, 1.0f, soundCooldown); // Different sound for extra life
+        }
+        // Use Phoenix Rebirth second (with bonus scoring + speed penalty)
+        else if (phoenixRebirthCharges > 0) {
+            phoenixRebirthCharges--;
+            isInExtraLifeMode = true;
+            lastExtraLifeType = "Phoenix";
+
+            // PHOENIX REBIRTH BONUS SCORING - Add % of current score
+            int rebirthBonus = score * 0.25f; // 25% of current score
+            score += rebirthBonus;
+
+            // PHOENIX REBIRTH SPEED PENALTY - Boost speed as penalty for power
+            currentSpeedMultiplier *= 1.5f; // 50% faster (penalty)
+            gameLog << ">>> PHOENIX REBIRTH ACTIVATED! Bonus: " << rebirthBonus << " points (25% of score)! Speed boosted to " << (currentSpeedMultiplier * 100) << "%! Charges remaining: " << phoenixRebirthCharges << endl;
+            ApplySpecialExtraLifeEffect();
+            PlayGameSoundSafe(SOUND_EAT, 1.0f, soundCooldown); // Different sound for extra life
+        }
+        // Then use regular extra lives (basic effect)
+        else if (extraLives > 0) {
+            extraLives--;
+            isInExtraLifeMode = true;
+            lastExtraLifeType = "Basic";
+            gameLog << "Basic extra life used! Lives remaining: " << extraLives << endl;
+            PlayGameSoundSafe(SOUND_EAT, 1.0f, soundCooldown); // Different sound for extra life
+        } else {
+            // WHITE LOONG Divine Shield: Remove zeros instead of game over
+            if (selectedLoongType == WHITE_LOONG && divineShieldZeros > 0) {
+                // Count zeros in hand
+                int zerosInHand = 0;
+                for (const Tile& tile : mahjongTiles.tiles) {
+                    if (tile.IsZero()) zerosInHand++;
+                }
+
+                if (zerosInHand > 0) {
+                    // Remove up to divineShieldZeros zeros from hand
+                    int zerosToRemove = min(divineShieldZeros, zerosInHand);
+                    int zerosRemoved = 0;
+
+                    for (int i = 0; i < (int)mahjongTiles.tiles.size() && zerosRemoved < zerosToRemove; i++) {
+                        if (mahjongTiles.tiles[i].IsZero()) {
+                            mahjongTiles.tiles.erase(mahjongTiles.tiles.begin() + i);
+                            zerosRemoved++;
+                            i--; // Adjust index after removal
+                        }
+                    }
+                    mahjongTiles.RebuildHandTrackers();
+                    isInExtraLifeMode = true;
+                    lastExtraLifeType = "Divine Shield";
+
+                    gameLog << "🤍 DIVINE SHIELD ACTIVATED! Removed " << zerosRemoved << " zeros from hand! Continue playing!" << endl;
+
+                    // Play special divine sound (optimized)
+                    PlayGameSoundSafe(SOUND_EAT, 1.8f, soundCooldown);
+
+                    return; // Don't game over
+                }
+            }
+
+            // No extra lives or divine shield, normal game over
+            GameOver();
+        }
+    }
+
+    void ApplySpecialExtraLifeEffect() {
+        // Apply unique effects based on selected LOONG type
+        switch (selectedLoongType) {
+            case BASIC_LOONG:
+                // Basic LOONG: Just basic extra life (no special effect)
+                gameLog << "🐉 Basic LOONG Extra Life: Standard revival!" << endl;
+                break;
+
+            case FIRE_LOONG:
+                // Fire LOONG: If have triple, immediately KONG and remove from pool
+                gameLog << "🔥 Fire LOONG Extra Life: Blazing Revival!" << endl;
+                for (int value = 1; value <= 9; value++) {
+                    for (TileType type : {PLAIN_TILES, HAT_TILES, DOT_TILES}) {
+                        if (!mahjongTiles.HasType(type)) continue;
+                        pair<int, TileType> tileKey = {value, type};
+                        int count = 0;
+                        for (const Tile& tile : mahjongTiles.tiles) {
+                            if (tile.value == value && tile.type == type) count++;
+                        }
+                        if (count >= 3) {
+                            // Auto-KONG this tile
+                            mahjongTiles.SetGold(tileKey);
+                            mahjongTiles.PoolChanged();
+                            gameLog << "🔥 Auto-KONG: " << value << " removed from pool!" << endl;
+                            break;
+                        }
+                    }
+                }
+                break;
+
+            case WATER_LOONG:
+                // Water LOONG: Reduce speed by 50% until eaten 10 tiles
+                gameLog << "💧 Water LOONG Extra Life: Flowing Revival!" << endl;
+                currentSpeedMultiplier *= 0.5f;
+                // TODO: Add counter for 10 tiles to restore speed
+                break;
+
+            case SHADOW_LOONG:
+                // Shadow LOONG: Can cross over own body 3-6-9 times
+                gameLog << "🌑 Shadow LOONG Extra Life: Shadow Revival!" << endl;
+                teleportCharges += 3; // Add shadow teleport charges
+                break;
+
+            default:
+                gameLog << "🐉 Special Extra Life: Mystical revival!" << endl;
+                break;
+        }
+    }
+
+    void GameOver()
+    {
+        // Update global high score
+        if (score > highScore)
+        {
+            highScore = score;
+            SaveHighScore();
+        }
+
+        // Update LOONG-specific high score
+        pair<LoongType, DifficultyLevel> currentKey = {selectedLoongType, selectedDifficulty};
+        if (score > loongHighScores[currentKey]) {
+            loongHighScores[currentKey] = score;
+            gameLog << "New high score for " << availableLOONGs[selectedLoongIndex].name
+                 << " (" << difficultyNames[selectedDifficulty] << "): " << score << endl;
+        }
+
+        // Check if we achieved LOONG (reached ornate level 4) to unlock next difficulty
+        if (ornateLevel >= LEVEL_4_DRAGON) {
+            UnlockNextDifficulty();
+        }
+
+        // Save progress after every game
+        SaveProgressData();
+
+        // Store final score before resetting
+        finalScore = score;
+
+        snake.Reset();
+        food.Respawn(snake, random.streams[FOOD_STREAM]);
+        gameLog << "🎮 STARTING NEW GAME with selectedLatentLevel: " << selectedLatentLevel << endl;
+        mahjongTiles.GenerateRandomTiles(selectedLatentLevel);
+
+        // Reset ornate level and mahjong wins on death
+        ornateLevel = LEVEL_1_NONE;
+        mahjongWins = 0;
+        mahjongWinsAchieved = 0; // Reset difficulty tracking
+
+        // Reset age and choice systems
+        snakeAge = 0;
+        snakeLength = snake.body.size(); // Initialize with starting snake length
+        showChoiceWindow = false;
+        showKongWin = false;
+        showLoongUpgrade = false;
+        fruitCounter = 0;
+
+        // Reset LOONG upgrades (keep selected LOONG but reset temporary effects)
+        currentSpeedMultiplier = 1.0f;
+        currentProbabilityBonus = 0.0f;
+
+        // Reset LOONG effect variables
+        mahjongScoreMultiplier = 1.0f;
+        kongScoreMultiplier = 1.0f;
+        wallImmunities = 0;
+        teleportCharges = 0;
+        // REMOVED: Legacy auto-complete system
+        loongWinMultiplier = 3;
+        phoenixRebirth = false;
+        phoenixCharges = 0;
+        celestialRebirth = false;
+        celestialCharges = 0;
+
+        // Reset zero tile system
+        purificationCounter = 0;
+        purificationThreshold = 15;
+        divineShieldZeros = 3;
+
+        // Reset color mixing system
+        mixedLoongTypes.clear();
+
+        // Reset advanced LOONG effects
+        shadowCloneCharges = 0;
+        earthquakeCounter = 0;
+        earthquakeThreshold = 10;
+        tornadoCounter = 0;
+        tornadoThreshold = 7;
+        healingCounter = 0;
+        graniteWillActive = false;
+
+        // Reset upgrade tile system
+        upgradeSpawned = false;
+        tilesConsumedSinceUpgrade = 0;
+        nextUpgradeThreshold = 10;
+        isGraniteWillActive = false;
+
+        // Reset tile locking system
+        mahjongTiles.futureTilesLocked = false;
+        mahjongTiles.lockedTilesRemaining = 0;
+        mahjongTiles.lockedFutureTiles.clear();
+
+        // Reset all power-up effects
+        slowGrowthActive = false;
+        mahjongNerfActive = false;
+        speedDemonActive = false;
+        luckyNumbersActive = false;
+        minimalistActive = false;
+        turtleModeActive = false;
+        gamblerActive = false;
+        perfectionistActive = false;
+        collectorActive = false;
+        survivorActive = false;
+        speedsterActive = false;
+        monkActive = false;
+        extraLives = 0;
+        phoenixRebirthCharges = 0;
+
+        // Reset debug variables
+        currentSpeedMultiplier = 1.0f;
+        currentProbabilityBonus = 0.0f;
+        isInExtraLifeMode = false;
+        lastExtraLifeType = "";
+        lastOrnateLevel = -1; // Reset music tracking
+
+        // Reset kong wins and tile system
+        kongWins = 0;
+        totalWins = 0;
+        currentTileCount = 4;
+        waterHealingAmount = 0;
+        windLengthReduction = 0;
+
+        // Reset tile system completely
+        mahjongTiles.availableTypes = 1u << PLAIN_TILES; // Back to plain tiles only
+        mahjongTiles.goldTiles = 0; // Clear gold tiles
+        mahjongTiles.FillWall(); // Fresh wall of plain tiles
+
+        mahjongTiles.SetTileCount(4, 0); // Reset to 4 tiles, ornate level 0
+
+        gameState = GAME_OVER;
+        score = 0; // Reset for next game
+        PlayGameSound(SOUND_WALL);
+
+        StartGameOverMusic();
+    }
+
+    void ResetGame() {
+        // Reset game state for new game (similar to HandleDeath but without GAME_OVER)
+        snake.Reset();
+        food.Respawn(snake, random.streams[FOOD_STREAM]);
+        gameLog << "🔄 RESETTING GAME with selectedLatentLevel: " << selectedLatentLevel << endl;
+        mahjongTiles.GenerateRandomTiles(0);
+
+        // Reset ornate level and mahjong wins
+        ornateLevel = LEVEL_1_NONE;
+        mahjongWins = 0;
+        mahjongWinsAchieved = 0; // Reset difficulty tracking
+
+        // Reset age and choice systems
+        snakeAge = 0;
+        snakeLength = snake.body.size(); // Initialize with starting snake length
+        showChoiceWindow = false;
+        showKongWin = false;
+        showLoongUpgrade = false;
+        showPhoenixRebirth = false;
+        showCosmicWisdom = false;
+        fruitCounter = 0;
+
+        // Reset LOONG upgrades (keep selected LOONG but reset temporary effects)
+        currentSpeedMultiplier = 1.0f;
+        currentProbabilityBonus = 0.0f;
+
+        // Reset LOONG effect variables
+        mahjongScoreMultiplier = 1.0f;
+        kongScoreMultiplier = 1.0f;
+        wallImmunities = 0;
+        teleportCharges = 0;
+        // REMOVED: Legacy auto-complete system
+        loongWinMultiplier = 3;
+        phoenixRebirth = false;
+        phoenixCharges = 0;
+        celestialRebirth = false;
+        celestialCharges = 0;
+
+        // Reset zero tile system
+        purificationCounter = 0;
+        purificationThreshold = 15;
+        divineShieldZeros = 3;
+
+        // Reset color mixing system
+        mixedLoongTypes.clear();
+
+        // Reset advanced LOONG effects
+        shadowCloneCharges = 0;
+        earthquakeCounter = 0;
+        earthquakeThreshold = 10;
+        tornadoCounter = 0;
+        tornadoThreshold = 7;
+        healingCounter = 0;
+        graniteWillActive = false;
+
+        // Reset upgrade tile system
+        upgradeSpawned = false;
+        tilesConsumedSinceUpgrade = 0;
+        nextUpgradeThreshold = 10;
+        isGraniteWillActive = false;
+
+        // Reset latent cultivation spawning
+        latentCultivationSpawned = false;
+        pendingLatentUpgrades.clear();
+        latentUpgradeSpawnTimer = 0.0f;
+        latentUpgradeSpawned = false;
+
+        // Reset tile locking system
+        mahjongTiles.futureTilesLocked = false;
+        mahjongTiles.lockedTilesRemaining = 0;
+        mahjongTiles.lockedFutureTiles.clear();
+
+        // Reset all power-up effects
+        slowGrowthActive = false;
+        mahjongNerfActive = false;
+        speedDemonActive = false;
+        luckyNumbersActive = false;
+        minimalistActive = false;
+        turtleModeActive = false;
+        gamblerActive = false;
+        perfectionistActive = false;
+        collectorActive = false;
+        survivorActive = false;
+        speedsterActive = false;
+        monkActive = false;
+        extraLives = 0;
+        phoenixRebirthCharges = 0;
+
+        // Reset debug variables
+        currentSpeedMultiplier = 1.0f;
+        currentProbabilityBonus = 0.0f;
+        isInExtraLifeMode = false;
+        lastExtraLifeType = "";
+        lastOrnateLevel = -1;
+
+        // Reset kong wins and tile system
+        kongWins = 0;
+        totalWins = 0;
+        currentTileCount = 4;
+        waterHealingAmount = 0;
+        windLengthReduction = 0;
+
+        // Reset tile system completely
+        mahjongTiles.availableTypes = 1u << PLAIN_TILES;
+        mahjongTiles.goldTiles = 0;
+        mahjongTiles.FillWall();
+
+        mahjongTiles.SetTileCount(4, 0);
+
+        // CRITICAL FIX: Generate fresh next tile after complete reset
+        mahjongTiles.GenerateNextTile(0.0f);
+        gameLog << "Fresh next tile generated after reset: " << mahjongTiles.nextTile.ToString() << endl;
+
+        score = 0;
+    }
+
+    void CheckCollisionWithTail()
+    {
+        if (snake.HeadHitsBody())
+        {
+            // Move head back to previous valid position immediately by shrinking
+            if (snake.body.size() > 1) {
+                snake.PopHead();
+            }
+            snake.direction = {0, 0}; // Hard stop: prevent tunneling through body
+
+            // Check for Granite Will immunity (Earth/White LOONG)
+            if (isGraniteWillActive && wallImmunities > 0) {
+                wallImmunities--;
+                gameLog << ">>> GRANITE WILL IMMUNITY: Stopped snake! Immunities remaining: " << wallImmunities << endl;
+
+                // Stop the snake instead of death - move back one step
+                if (snake.body.size() > 1) {
+                    snake.MoveHead(snake.body[1]); // Move head back to previous position
+                }
+
+                // Play immunity sound (optimized)
+                PlayGameSoundSafe(SOUND_EAT, 1.5f, soundCooldown);
+
+                return; // Don't die, just stop
+            }
+
+            // Check for teleport charges (Shadow LOONG Dimensional Rift), if there's a free cell to land on
+            Vector2 safePos;
+            if (teleportCharges > 0 && safeCells.Find(snake.occupancy, safePos)) {
+                teleportCharges--;
+                gameLog << ">>> DIMENSIONAL RIFT ACTIVATED! Teleporting to safety! Charges remaining: " << teleportCharges << endl;
+
+                // Teleport snake to the safest free cell
+                snake.MoveHead(safePos);
+
+                // Play special teleport sound (optimized)
+                PlayGameSoundSafe(SOUND_EAT, 0.6f, soundCooldown);
+
+                return; // Don't die
+            }
+
+            HandleDeath();
+        }
+    }
+
+    // Latent upgrade system
+    void InitializeLatentUpgrades() {
+        for (int i = 0; i < 9; i++) {
+            loongTotalScores[(LoongType)i] = 0;
+            loongUpgradeLevel[(LoongType)i] = 0;
+        }
+        gameLog << "Latent upgrade system initialized" << endl;
+    }
+
+    void UpdateLoongTotalScore(int scoreGained) {
+        loongTotalScores[selectedLoongType] += scoreGained;
+
+        // Debug output
+        gameLog << "Updated " << availableLOONGs[selectedLoongIndex].name << " total score: " << loongTotalScores[selectedLoongType] << " (+" << scoreGained << ")" << endl;
+
+        // Check for upgrade level increases
+        int oldLevel = loongUpgradeLevel[selectedLoongType];
+        int newLevel = 0;
+
+        for (int i = 0; i < (int)latentUpgradeThresholds.size(); i++) {
+            if (loongTotalScores[selectedLoongType] >= latentUpgradeThresholds[i]) {
+                newLevel = i + 1;
+            }
+        }
+
+        if (newLevel > oldLevel) {
+            loongUpgradeLevel[selectedLoongType] = newLevel;
+            gameLog << "🎉 " << availableLOONGs[selectedLoongIndex].name << " reached upgrade level " << newLevel << "! Total score: " << loongTotalScores[selectedLoongType] << " 🎉" << endl;
+            // Save immediately when level increases
+            SaveProgressData();
+        }
+    }
+
+    bool HasLatentUpgrade() {
+        return loongUpgradeLevel[selectedLoongType] > 0;
+    }
+
+    void SpawnLatentCultivationUpgrades() {
+        if (selectedLatentLevel <= 0) return;
+
+        gameLog << "🌟 Queuing Latent Cultivation Level " << selectedLatentLevel << " LOONG evolution tiles!" << endl;
+
+        // Clear any existing queue
+        pendingLatentUpgrades.clear();
+
+        // Count how many upgrade tiles to spawn based on level
+        int ownUpgrades = 0;
+        int otherUpgrades = 0;
+
+        if (selectedLatentLevel >= 1) ownUpgrades = 1;
+        if (selectedLatentLevel >= 2) otherUpgrades = 1;
+        if (selectedLatentLevel >= 3) ownUpgrades = 2;
+        if (selectedLatentLevel >= 4) ownUpgrades = 3;
+        if (selectedLatentLevel >= 5) otherUpgrades = 2;
+
+        // Add own LOONG evolution tiles to queue
+        for (int i = 0; i < ownUpgrades; i++) {
+            pendingLatentUpgrades.push_back(selectedLoongType);
+        }
+
+        // Add other LOONG evolution tiles to queue
+        for (int i = 0; i < otherUpgrades; i++) {
+            // Pick a random other LOONG type
+            LoongType otherLoong;
+            do {
+                otherLoong = (LoongType)random.Value(UPGRADE_STREAM, 0, 8);
+            } while (otherLoong == selectedLoongType);
+
+            pendingLatentUpgrades.push_back(otherLoong);
+        }
+
+        // Start the spawning timer
+        latentUpgradeSpawnTimer = 0.5f; // Start spawning after 0.5 seconds
+
+        gameLog << "✅ Queued " << pendingLatentUpgrades.size() << " LOONG evolution tiles for spawning!" << endl;
+    }
+};
@@ -0,0 +1,251 @@
+// Mahjong Loong training environment: implementation of the C API in loong_env.h
+//
+// Per-env state lives in parallel arrays indexed by env (struct of arrays). Every reset and
+// step splits the envs into one contiguous range per thread: the calling thread takes the
+// first range and parked pool threads take the rest, so nothing is queued or allocated per
+// step. Every env keeps the GameCore it was created with: a finished env restarts it in place
+// (GameCore::PrepareRun) with the saved progress it had when new.
+//
+// Build: g++ -std=c++17 -O2 -shared -fPIC -pthread loong_env.cpp -o libloong_env.so
+#include "loong_env.h"
+#include "loong_bots.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+enum EnvTask {
+    ENV_RESET,
+    ENV_STEP
+};
+
+struct LoongEnv {
+    int envCount = 0;
+    uint64_t baseSeed = 0;
+    LoongType loongType = BASIC_LOONG;
+    DifficultyLevel difficulty = FOUNDATION_BUILDING;
+
+    // One entry per env
+    vector<GameCore> games;
+    vector<RandomGenerator> clicks; // Answers to choice and upgrade windows
+    vector<uint64_t> episodes;      // Episodes started so far
+    vector<int> lastScores;         // Score after the previous tick
+    vector<uint8_t> freshProgress;  // SaveProgress of a new GameCore: no unlocks or latent totals
+
+    // The call being run: set by the calling thread before the pool wakes up
+    EnvTask task = ENV_STEP;
+    const int32_t* actions = nullptr;
+    const LoongEnvObs* obs = nullptr;
+    float* rewards = nullptr;
+    uint8_t* dones = nullptr;
+
+    // Thread pool
+    vector<thread> workers;
+    mutex poolMutex;
+    condition_variable wake;
+    condition_variable finished;
+    uint64_t generation = 0; // Bumped once per call
+    int pendingWorkers = 0;
+    bool stopping = false;
+};
+
+// First env of one thread's range
+static int RangeStart(const LoongEnv* env, int thread) {
+    return (int)((long long)env->envCount * thread / ((int)env->workers.size() + 1));
+}
+
+static void StartEpisode(LoongEnv* env, int i) {
+    uint64_t runSeed = env->baseSeed + ((uint64_t)i << 32) + env->episodes[i]++;
+    GameCore& game = env->games[i];
+    game.LoadProgress(env->freshProgress.data(), env->freshProgress.size()); // Episodes don't share progress
+    game.PrepareRun(runSeed);
+    env->clicks[i].Seed(runSeed ^ 0xA5A5A5A5A5A5A5A5ull);
+    game.StartRun(env->loongType, env->difficulty);
+    env->lastScores[i] = game.score;
+}
+
+static void WriteObservation(const LoongEnv* env, int i) {
+    const LoongEnvObs* obs = env->obs;
+    if (!obs) return;
+    const GameCore& game = env->games[i];
+
+    if (obs->board) {
+        int cells = cellCount * cellCount;
+        uint8_t* board = obs->board + (size_t)i * cells;
+        memset(board, LOONG_ENV_EMPTY, cells);
+        auto mark = [&](Vector2 cell, uint8_t value) {
+            if (InsideBoard(cell)) board[(int)cell.y * cellCount + (int)cell.x] = value;
+        };
+        for (const Vector2& cell : game.snake.body) mark(cell, LOONG_ENV_BODY);
+        mark(game.food.position, LOONG_ENV_FOOD);
+        if (game.upgradeSpawned) mark(game.upgradeTilePosition, LOONG_ENV_UPGRADE);
+        if (game.latentUpgradeSpawned) mark(game.latentUpgradeTilePosition, LOONG_ENV_LATENT_UPGRADE);
+        if (!game.snake.body.empty()) mark(game.snake.body[0], LOONG_ENV_HEAD);
+    }
+
+    if (obs->hand_counts) {
+        uint8_t* counts = obs->hand_counts + (size_t)i * LOONG_ENV_HAND_SLOTS;
+        memset(counts, 0, LOONG_ENV_HAND_SLOTS);
+        for (const Tile& tile : game.mahjongTiles.tiles) {
+            counts[tile.type * 10 + tile.value]++;
+        }
+    }
+
+    if (obs->next_tile) {
+        int32_t* nextTile = obs->next_tile + (size_t)i * LOONG_ENV_NEXT_TILE_SIZE;
+        nextTile[0] = game.mahjongTiles.nextTile.value;
+        nextTile[1] = game.mahjongTiles.nextTile.type;
+    }
+
+    if (obs->powers) {
+        float* powers = obs->powers + (size_t)i * LOONG_ENV_POWER_COUNT;
+        powers[LOONG_ENV_SHIFT_READY] = game.shiftPowerReady ? 1.0f : 0.0f;
+        powers[LOONG_ENV_SHIFT_CHARGE] = game.shiftCooldownMax > 0 ? min(1.0f, (float)game.shiftCooldownTiles / game.shiftCooldownMax) : 1.0f;
+        powers[LOONG_ENV_EXTRA_LIVES] = (float)game.extraLives;
+        powers[LOONG_ENV_WALL_IMMUNITIES] = (float)game.wallImmunities;
+        powers[LOONG_ENV_PHOENIX_CHARGES] = (float)game.phoenixRebirthCharges;
+        powers[LOONG_ENV_SPEED] = game.currentSpeedMultiplier;
+        powers[LOONG_ENV_ARROW] = (float)game.mahjongTiles.arrowPosition;
+        powers[LOONG_ENV_MAX_TILES] = (float)game.mahjongTiles.maxTiles;
+    }
+}
+
+// Action code -> BotAction (see loong_env.h)
+static BotAction DecodeAction(int32_t code) {
+    BotAction action;
+    if (code < 0 || code >= LOONG_ENV_ACTION_COUNT) return action;
+    int direction = code % 5;
+    if (direction > 0) action.direction = BOT_MOVES[direction - 1];
+    action.arrowMove = (code / 5) % 3 - 1;
+    action.activateShift = code / 15 == 1;
+    return action;
+}
+
+static void StepEnv(LoongEnv* env, int i) {
+    GameCore& game = env->games[i];
+    if (!AnswerPromptsAtRandom(game, env->clicks[i])) {
+        ApplyBotAction(game, DecodeAction(env->actions ? env->actions[i] : 0));
+    }
+    game.UpdateGameplay(GAMEPLAY_TICK_DELTA);
+    game.UpdateTimers(GAMEPLAY_TICK_DELTA);
+
+    // GameOver() resets the score right away, the run's score is in finalScore
+    bool done = game.gameState != PLAYING;
+    int score = game.gameState == GAME_OVER ? game.finalScore : game.score;
+    if (env->rewards) env->rewards[i] = (float)(score - env->lastScores[i]);
+    if (env->dones) env->dones[i] = done ? 1 : 0;
+    env->lastScores[i] = score;
+
+    if (done) StartEpisode(env, i);
+}
+
+static void RunRange(LoongEnv* env, int first, int last) {
+    for (int i = first; i < last; i++) {
+        if (env->task == ENV_RESET) StartEpisode(env, i);
+        else StepEnv(env, i);
+        WriteObservation(env, i);
+    }
+}
+
+static void WorkerLoop(LoongEnv* env, int thread) {
+    uint64_t seenGeneration = 0;
+    while (true) {
+        {
+            unique_lock<mutex> lock(env->poolMutex);
+            env->wake.wait(lock, [&]() { return env->stopping || env->generation != seenGeneration; });
+            if (env->stopping) return;
+            seenGeneration = env->generation;
+        }
+        RunRange(env, RangeStart(env, thread), RangeStart(env, thread + 1));
+        {
+            lock_guard<mutex> lock(env->poolMutex);
+            if (--env->pendingWorkers == 0) env->finished.notify_one();
+        }
+    }
+}
+
+// Run the current task over every env, the calling thread included
+static void RunAll(LoongEnv* env) {
+    {
+        lock_guard<mutex> lock(env->poolMutex);
+        env->pendingWorkers = (int)env->workers.size();
+        env->generation++;
+    }
+    env->wake.notify_all();
+    RunRange(env, 0, RangeStart(env, 1));
+    {
+        unique_lock<mutex> lock(env->poolMutex);
+        env->finished.wait(lock, [&]() { return env->pendingWorkers == 0; });
+    }
+}
+
+extern "C" {
+
+LoongEnv* loong_env_create(int n_envs, uint64_t seed) {
+    if (n_envs < 1) return nullptr;
+    LoongEnv* env = new LoongEnv();
+    env->envCount = n_envs;
+    env->baseSeed = seed;
+    env->games.reserve(n_envs);
+    for (int i = 0; i < n_envs; i++) env->games.emplace_back(0, true); // Quiet: no game log
+    env->games[0].SaveProgress(env->freshProgress);
+    env->clicks.resize(n_envs);
+    env->episodes.assign(n_envs, 0);
+    env->lastScores.assign(n_envs, 0);
+
+    int threadCount = (int)thread::hardware_concurrency();
+    threadCount = max(1, min(threadCount, n_envs));
+    for (int worker = 1; worker < threadCount; worker++) {
+        env->workers.push_back(thread(WorkerLoop, env, worker));
+    }
+
+    env->task = ENV_RESET;
+    env->obs = nullptr;
+    RunAll(env);
+    return env;
+}
+
+void loong_env_destroy(LoongEnv* env) {
+    if (!env) return;
+    {
+        lock_guard<mutex> lock(env->poolMutex);
+        env->stopping = true;
+    }
+    env->wake.notify_all();
+    for (thread& worker : env->workers) worker.join();
+    delete env;
+}
+
+int loong_env_set_run(LoongEnv* env, int loong_type, int difficulty) {
+    if (loong_type < BASIC_LOONG || loong_type > PATIENCE_LOONG) return 0;
+    if (difficulty < FOUNDATION_BUILDING || difficulty > IMMORTAL_SAGE) return 0;
+    env->loongType = (LoongType)loong_type;
+    env->difficulty = (DifficultyLevel)difficulty;
+    return 1;
+}
+
+int loong_env_num_envs(const LoongEnv* env) {
+    return env->envCount;
+}
+
+int loong_env_board_cells(void) {
+    return cellCount * cellCount;
+}
+
+void loong_env_reset(LoongEnv* env, const LoongEnvObs* obs) {
+    env->task = ENV_RESET;
+    env->obs = obs;
+    RunAll(env);
+}
+
+void loong_env_step(LoongEnv* env, const int32_t* actions, const LoongEnvObs* obs, float* reward, uint8_t* done) {
+    env->task = ENV_STEP;
+    env->actions = actions;
+    env->obs = obs;
+    env->rewards = reward;
+    env->dones = done;
+    RunAll(env);
+}
+
+}
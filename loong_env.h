@@ -0,0 +1,90 @@
+// Mahjong Loong training environment: a C API over many headless GameCore runs
+//
+// One LoongEnv holds n_envs independent games and steps them all at once on a thread pool.
+// Observations, rewards and done flags are written straight into buffers owned by the caller
+// (numpy arrays, for example), laid out env after env, so a step copies nothing back.
+//
+// Build: g++ -std=c++17 -O2 -shared -fPIC -pthread loong_env.cpp -o libloong_env.so
+#pragma once
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+#define LOONG_ENV_API __declspec(dllexport)
+#else
+#define LOONG_ENV_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Board cells (uint8 per cell, row-major, loong_env_board_cells() per env)
+enum {
+    LOONG_ENV_EMPTY = 0,
+    LOONG_ENV_BODY = 1,
+    LOONG_ENV_HEAD = 2,
+    LOONG_ENV_FOOD = 3,
+    LOONG_ENV_UPGRADE = 4,       // Upgrade tile
+    LOONG_ENV_LATENT_UPGRADE = 5 // Latent cultivation tile
+};
+
+// Hand counts: uint8 per (tile type, value), index type * 10 + value (value 0 = zero tile)
+#define LOONG_ENV_HAND_SLOTS 30
+
+// Next tile: int32 pair (value, type) per env
+#define LOONG_ENV_NEXT_TILE_SIZE 2
+
+// Powers: float per env, in this order
+enum {
+    LOONG_ENV_SHIFT_READY = 0,     // 1 when SHIFT can fire
+    LOONG_ENV_SHIFT_CHARGE = 1,    // Tiles eaten since the last SHIFT / tiles needed, 0-1
+    LOONG_ENV_EXTRA_LIVES = 2,
+    LOONG_ENV_WALL_IMMUNITIES = 3,
+    LOONG_ENV_PHOENIX_CHARGES = 4,
+    LOONG_ENV_SPEED = 5,           // Current speed multiplier
+    LOONG_ENV_ARROW = 6,           // Arrow position (maxTiles = KEEP)
+    LOONG_ENV_MAX_TILES = 7,
+    LOONG_ENV_POWER_COUNT = 8
+};
+
+// Actions: one int32 per env, direction + 5 * (arrow step + 1) + 15 * shift
+//   direction: 0 keep, 1 right, 2 left, 3 down, 4 up
+//   arrow step: -1 left, 0 stay, +1 right
+//   shift: 1 fires SHIFT when it's ready
+#define LOONG_ENV_ACTION_COUNT 30
+
+// Where observations go; any pointer may be NULL to skip that part
+typedef struct LoongEnvObs {
+    uint8_t* board;      // n_envs * loong_env_board_cells()
+    uint8_t* hand_counts; // n_envs * LOONG_ENV_HAND_SLOTS
+    int32_t* next_tile;  // n_envs * LOONG_ENV_NEXT_TILE_SIZE
+    float* powers;       // n_envs * LOONG_ENV_POWER_COUNT
+} LoongEnvObs;
+
+typedef struct LoongEnv LoongEnv;
+
+// n_envs games seeded from seed (episode k of env i uses seed + (i << 32) + k), stepped on
+// all cores; returns NULL if n_envs < 1
+LOONG_ENV_API LoongEnv* loong_env_create(int n_envs, uint64_t seed);
+LOONG_ENV_API void loong_env_destroy(LoongEnv* env);
+
+// LOONG and difficulty of every episode started from now on (default 0, 0); returns 0 if
+// either is out of range
+LOONG_ENV_API int loong_env_set_run(LoongEnv* env, int loong_type, int difficulty);
+
+LOONG_ENV_API int loong_env_num_envs(const LoongEnv* env);
+LOONG_ENV_API int loong_env_board_cells(void);
+
+// Start a new episode in every env and write the first observations
+LOONG_ENV_API void loong_env_reset(LoongEnv* env, const LoongEnvObs* obs);
+
+// One gameplay tick in every env. reward (float) is the score gained this tick, done (uint8)
+// is 1 when the episode ended (death or cultivation). Finished envs start their next episode
+// right away, so their observation is already the first one of the new episode.
+LOONG_ENV_API void loong_env_step(LoongEnv* env, const int32_t* actions, const LoongEnvObs* obs,
+                                  float* reward, uint8_t* done);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,440 @@
+// Mahjong Loong replays: a run stored as its setup and the inputs of each tick
+//
+// A run is reproducible from its run seed, LOONG, difficulty and latent level (see
+// GameCore::PrepareRun) plus the inputs HandleInput acted on, stamped with the gameplay tick
+// they came before. Everything is a LEB128 varint:
+//   header: 'L' 'R' 'P' version, run seed, LoongType, DifficultyLevel, latent level
+//   input:  ticks since the previous input, input byte (kind in the low 4 bits, argument in
+//           the high 4 bits; argument 15 = the real argument follows as a varint)
+//   REPLAY_CHECKPOINT every REPLAY_CHECKPOINT_TICKS ticks carries ReplayHash() of the state
+//   REPLAY_END closes the run with the ticks since the last input, then the run's score
+//           (zigzag), mahjongWinsAchieved and final ReplayHash()
+// A typical input takes two bytes, so a 10 minute run is a few KB.
+#pragma once
+
+#include "loong_core.h"
+
+#include <climits>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+const uint8_t REPLAY_MAGIC[3] = {'L', 'R', 'P'};
+const uint8_t REPLAY_VERSION = 5; // Bump whenever the rules play a recorded input differently or StateHash changes
+
+enum ReplayInputKind {
+    REPLAY_DIRECTION = 0,  // Argument: ReplayDirectionCode
+    REPLAY_ARROW = 1,      // Argument: new arrow position
+    REPLAY_RESHUFFLE = 2,
+    REPLAY_SHIFT = 3,      // SHIFT pressed while the power was ready
+    REPLAY_UPGRADE = 4,    // Argument: upgrade window choice
+    REPLAY_CHOICE = 5,     // Argument: choice window choice
+    REPLAY_RESUME = 6,     // Extra life resumed
+    REPLAY_CHECKPOINT = 7, // Argument: ReplayHash() after the tick
+    REPLAY_END = 15
+};
+
+const int REPLAY_ARGUMENT_ESCAPE = 15;
+const int REPLAY_CHECKPOINT_TICKS = 60;
+
+// Directions as small codes: 0 stopped, 1 right, 2 left, 3 down, 4 up
+inline int ReplayDirectionCode(Vector2 direction) {
+    if (direction.x > 0) return 1;
+    if (direction.x < 0) return 2;
+    if (direction.y > 0) return 3;
+    if (direction.y < 0) return 4;
+    return 0;
+}
+
+inline Vector2 ReplayDirection(int code) {
+    const Vector2 directions[5] = {{0, 0}, {1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+    return code >= 0 && code < 5 ? directions[code] : directions[0];
+}
+
+// GameCore::StateHash() folded to 32 bits
+inline uint32_t ReplayHash(const GameCore& game) {
+    uint64_t hash = game.StateHash();
+    return (uint32_t)(hash ^ hash >> 32);
+}
+
+// What a run scored; GameOver() resets the live numbers, so the last live ones are kept
+struct ReplayOutcome {
+    int score = 0;
+    int mahjongWinsAchieved = 0;
+
+    void Update(const GameCore& game) {
+        if (game.gameState == GAME_OVER) {
+            score = game.finalScore;
+        } else {
+            score = game.score;
+            mahjongWinsAchieved = game.mahjongWinsAchieved;
+        }
+    }
+
+    bool operator==(const ReplayOutcome& other) const {
+        return score == other.score && mahjongWinsAchieved == other.mahjongWinsAchieved;
+    }
+};
+
+struct ReplayHeader {
+    uint64_t runSeed = 0;
+    LoongType loongType = BASIC_LOONG;
+    DifficultyLevel difficulty = FOUNDATION_BUILDING;
+    int latentLevel = 0;
+};
+
+inline void AppendVarint(vector<uint8_t>& bytes, uint64_t value) {
+    while (value >= 0x80) {
+        bytes.push_back((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back((uint8_t)value);
+}
+
+inline uint64_t ZigZag(int64_t value) {
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+inline int64_t UnZigZag(uint64_t value) {
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+inline void AppendReplayHeader(vector<uint8_t>& bytes, const ReplayHeader& header) {
+    for (uint8_t byte : REPLAY_MAGIC) bytes.push_back(byte);
+    bytes.push_back(REPLAY_VERSION);
+    AppendVarint(bytes, header.runSeed);
+    AppendVarint(bytes, header.loongType);
+    AppendVarint(bytes, header.difficulty);
+    AppendVarint(bytes, header.latentLevel);
+}
+
+inline void AppendReplayInput(vector<uint8_t>& bytes, uint64_t tickGap, ReplayInputKind kind, uint64_t argument) {
+    AppendVarint(bytes, tickGap);
+    if (argument < REPLAY_ARGUMENT_ESCAPE) {
+        bytes.push_back((uint8_t)(kind | argument << 4));
+    } else {
+        bytes.push_back((uint8_t)(kind | REPLAY_ARGUMENT_ESCAPE << 4));
+        AppendVarint(bytes, argument);
+    }
+}
+
+// REPLAY_END's closing fields
+inline void AppendReplayEnd(vector<uint8_t>& bytes, uint64_t tickGap, const ReplayOutcome& outcome, uint32_t finalHash) {
+    AppendReplayInput(bytes, tickGap, REPLAY_END, 0);
+    AppendVarint(bytes, ZigZag(outcome.score));
+    AppendVarint(bytes, outcome.mahjongWinsAchieved);
+    AppendVarint(bytes, finalHash);
+}
+
+// REPLAY WRITER: the frame appends to a memory buffer, a background thread does the file I/O
+// Flush() only swaps buffers under a lock the writer thread never holds while writing
+class ReplayWriter {
+public:
+    ~ReplayWriter() {
+        Close();
+        Join();
+    }
+
+    bool IsOpen() const {
+        return open;
+    }
+
+    void Open(const string& path) {
+        Join(); // The previous file's thread has had a whole run to finish
+        open = true;
+        closing = false;
+        buffer.clear();
+        pending.clear();
+        worker = thread(&ReplayWriter::WriteLoop, this, path);
+    }
+
+    void Append(const vector<uint8_t>& bytes) {
+        buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+        if (buffer.size() >= FLUSH_BYTES) Flush();
+    }
+
+    void Flush() {
+        if (buffer.empty()) return;
+        {
+            lock_guard<mutex> lock(queueMutex);
+            pending.insert(pending.end(), buffer.begin(), buffer.end());
+        }
+        buffer.clear();
+        wake.notify_one();
+    }
+
+    // Hands the rest to the writer thread, which closes the file when it's written
+    void Close() {
+        if (!open) return;
+        Flush();
+        {
+            lock_guard<mutex> lock(queueMutex);
+            closing = true;
+        }
+        wake.notify_one();
+        open = false;
+    }
+
+private:
+    static const size_t FLUSH_BYTES = 1024;
+
+    bool open = false;
+    vector<uint8_t> buffer; // Frame side
+    vector<uint8_t> pending; // Waiting for the writer thread
+    bool closing = false;
+    mutex queueMutex;
+    condition_variable wake;
+    thread worker;
+
+    void Join() {
+        if (worker.joinable()) worker.join();
+    }
+
+    void WriteLoop(string path) {
+        FILE* file = fopen(path.c_str(), "wb");
+        if (!file) cerr << "Can't write replay " << path << endl;
+        vector<uint8_t> writing;
+        while (true) {
+            bool done;
+            {
+                unique_lock<mutex> lock(queueMutex);
+                wake.wait(lock, [&]() { return closing || !pending.empty(); });
+                writing.swap(pending);
+                done = closing;
+            }
+            if (file && !writing.empty()) {
+                fwrite(writing.data(), 1, writing.size(), file);
+                fflush(file);
+            }
+            writing.clear();
+            if (done) break;
+        }
+        if (file) fclose(file);
+    }
+};
+
+// REPLAY RECORDER: turns a run's inputs into the replay format
+// The front end calls Tick() after every gameplay tick of the run and Record() for every
+// input, in the order HandleInput acts on them
+class ReplayRecorder {
+public:
+    bool IsRecording() const {
+        return writer.IsOpen();
+    }
+
+    void Begin(const string& path, const ReplayHeader& header) {
+        writer.Open(path);
+        ticks = 0;
+        lastInputTick = 0;
+        outcome = ReplayOutcome();
+        scratch.clear();
+        AppendReplayHeader(scratch, header);
+        writer.Append(scratch);
+    }
+
+    void Tick(const GameCore& game) {
+        if (!IsRecording()) return;
+        ticks++;
+        outcome.Update(game);
+        if (ticks % REPLAY_CHECKPOINT_TICKS == 0) Record(REPLAY_CHECKPOINT, ReplayHash(game));
+    }
+
+    void Record(ReplayInputKind kind, uint64_t argument = 0) {
+        if (!IsRecording()) return;
+        scratch.clear();
+        AppendReplayInput(scratch, ticks - lastInputTick, kind, argument);
+        lastInputTick = ticks;
+        writer.Append(scratch);
+    }
+
+    void Finish(const GameCore& game) {
+        if (!IsRecording()) return;
+        scratch.clear();
+        AppendReplayEnd(scratch, ticks - lastInputTick, outcome, ReplayHash(game));
+        writer.Append(scratch);
+        writer.Close();
+    }
+
+private:
+    ReplayWriter writer;
+    uint64_t ticks = 0;
+    uint64_t lastInputTick = 0;
+    ReplayOutcome outcome;
+    vector<uint8_t> scratch; // Reused for every input, so recording doesn't allocate once warm
+};
+
+class ReplayReader {
+public:
+    ReplayReader(const uint8_t* data, size_t size) : next(data), end(data + size) {}
+
+    bool ReadVarint(uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64 && next < end; shift += 7) {
+            uint8_t byte = *next++;
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return true;
+        }
+        return false;
+    }
+
+    bool ReadHeader(ReplayHeader& header) {
+        if (end - next < 4 || next[0] != REPLAY_MAGIC[0] || next[1] != REPLAY_MAGIC[1] ||
+            next[2] != REPLAY_MAGIC[2] || next[3] != REPLAY_VERSION) return false;
+        next += 4;
+        uint64_t loongType, difficulty, latentLevel;
+        if (!ReadVarint(header.runSeed) || !ReadVarint(loongType) || !ReadVarint(difficulty) || !ReadVarint(latentLevel)) return false;
+        if (loongType > PATIENCE_LOONG || difficulty > IMMORTAL_SAGE || latentLevel > 5) return false;
+        header.loongType = (LoongType)loongType;
+        header.difficulty = (DifficultyLevel)difficulty;
+        header.latentLevel = (int)latentLevel;
+        return true;
+    }
+
+    // One input: ticks since the previous one, its kind and argument
+    bool ReadInput(uint64_t& tickGap, ReplayInputKind& kind, uint64_t& argument) {
+        if (!ReadVarint(tickGap) || next >= end) return false;
+        uint8_t byte = *next++;
+        kind = (ReplayInputKind)(byte & 0x0F);
+        argument = byte >> 4;
+        if (argument == REPLAY_ARGUMENT_ESCAPE) return ReadVarint(argument);
+        return true;
+    }
+
+private:
+    const uint8_t* next;
+    const uint8_t* end;
+};
+
+// Set a fresh GameCore up the way the front end starts a run
+inline void StartReplayRun(GameCore& game, const ReplayHeader& header) {
+    game.selectedLoongIndex = header.loongType;
+    game.selectedLoongType = game.availableLOONGs[header.loongType].type;
+    game.selectedDifficulty = header.difficulty;
+    game.selectedLatentLevel = header.latentLevel;
+    game.PrepareRun(header.runSeed);
+    game.BeginPlaying();
+}
+
+// Carry out one recorded input the way HandleInput did; false if the kind or argument is bad,
+// or if it answers a window that isn't open (checkpoints and the end aren't inputs)
+inline bool ApplyReplayInput(GameCore& game, ReplayInputKind kind, uint64_t argument) {
+    switch (kind) {
+        case REPLAY_DIRECTION:
+            if (argument > 4) return false;
+            game.snake.direction = ReplayDirection((int)argument);
+            return true;
+        case REPLAY_ARROW:
+            if (argument > (uint64_t)game.mahjongTiles.maxTiles) return false;
+            game.mahjongTiles.arrowPosition = (int)argument;
+            return true;
+        case REPLAY_RESHUFFLE:
+            game.mahjongTiles.ReshuffleTiles();
+            return true;
+        case REPLAY_SHIFT:
+            if (game.shiftPowerReady) game.ActivateShiftPower();
+            return true;
+        case REPLAY_UPGRADE:
+            if (!game.showLoongUpgrade) return false;
+            game.ApplyLoongUpgrade((int)min<uint64_t>(argument, INT_MAX));
+            return true;
+        case REPLAY_CHOICE:
+            if (!game.showChoiceWindow) return false;
+            game.ApplyChoice((int)min<uint64_t>(argument, INT_MAX));
+            game.showChoiceWindow = false;
+            return true;
+        case REPLAY_RESUME:
+            game.isInExtraLifeMode = false;
+            return true;
+        default:
+            return false;
+    }
+}
+
+struct ReplayVerdict {
+    string error; // Set when the replay can't be read, is cut off or has an input the run can't take
+    ReplayHeader header;
+    uint64_t ticks = 0;
+    ReplayOutcome claimed;  // From REPLAY_END, unless the caller overrides it
+    ReplayOutcome replayed;
+    bool diverged = false;  // A checkpoint (or the final hash) didn't match
+    uint64_t divergenceTick = 0; // Also where an input the run can't take came
+    uint32_t recordedHash = 0;
+    uint32_t replayedHash = 0;
+
+    bool Verified() const {
+        return error.empty() && !diverged && claimed == replayed;
+    }
+};
+
+// Replay a recorded run through the headless core, as fast as it goes. The claim is the
+// outcome stored in the replay; a run that scores differently is forged (or hit a bug), and
+// the first checkpoint that doesn't match tells which tick the runs split at.
+inline ReplayVerdict VerifyReplay(const uint8_t* data, size_t size, uint64_t maxTicks = 10000000) {
+    ReplayVerdict verdict;
+    ReplayReader reader(data, size);
+    if (!reader.ReadHeader(verdict.header)) {
+        verdict.error = "bad header";
+        return verdict;
+    }
+
+    GameCore game(verdict.header.runSeed, true); // Quiet: no game log
+    StartReplayRun(game, verdict.header);
+    verdict.replayed.Update(game);
+
+    auto compare = [&](uint32_t recordedHash) {
+        uint32_t replayedHash = ReplayHash(game);
+        if (replayedHash != recordedHash && !verdict.diverged) {
+            verdict.diverged = true;
+            verdict.divergenceTick = verdict.ticks;
+            verdict.recordedHash = recordedHash;
+            verdict.replayedHash = replayedHash;
+        }
+    };
+
+    while (true) {
+        uint64_t tickGap, argument;
+        ReplayInputKind kind;
+        if (!reader.ReadInput(tickGap, kind, argument)) {
+            verdict.error = "cut off at tick " + to_string(verdict.ticks);
+            return verdict;
+        }
+        if (tickGap > maxTicks - verdict.ticks) {
+            verdict.error = "longer than " + to_string(maxTicks) + " ticks";
+            return verdict;
+        }
+        for (uint64_t tick = 0; tick < tickGap; tick++) {
+            game.UpdateGameplay(GAMEPLAY_TICK_DELTA);
+            verdict.replayed.Update(game);
+        }
+        verdict.ticks += tickGap;
+
+        switch (kind) {
+            case REPLAY_CHECKPOINT:
+                compare((uint32_t)argument);
+                break;
+            case REPLAY_END: {
+                uint64_t score, mahjongWinsAchieved, finalHash;
+                if (!reader.ReadVarint(score) || !reader.ReadVarint(mahjongWinsAchieved) || !reader.ReadVarint(finalHash)) {
+                    verdict.error = "cut off at the end";
+                    return verdict;
+                }
+                verdict.claimed.score = (int)UnZigZag(score);
+                verdict.claimed.mahjongWinsAchieved = (int)mahjongWinsAchieved;
+                compare((uint32_t)finalHash);
+                return verdict;
+            }
+            default:
+                if (!ApplyReplayInput(game, kind, argument)) {
+                    verdict.error = "bad input " + to_string(kind) + " (" + to_string(argument) + ")";
+                    verdict.divergenceTick = verdict.ticks;
+                }
+                break;
+        }
+        if (!verdict.error.empty()) {
+            verdict.error += " at tick " + to_string(verdict.ticks);
+            return verdict;
+        }
+        verdict.replayed.Update(game);
+    }
+}
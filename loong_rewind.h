@@ -0,0 +1,208 @@
+// Mahjong Loong rewind: the last stretch of a run kept in memory, to go back in time or to
+// watch the last death again
+//
+// Every keyframeTicks gameplay ticks the whole game goes into a keyframe (GameCore::SaveSnapshot,
+// a few microseconds), and the inputs HandleInput acts on in between are kept with the tick
+// they came before, like a replay stores them (see loong_replay.h). Going back to tick T
+// restores the newest keyframe at or before T and runs the ticks up to T again with the
+// recorded inputs, so at most keyframeTicks - 1 ticks are simulated again.
+//
+// Keyframes and inputs together stay under budgetBytes: the oldest keyframe goes first. Frames
+// that drop off are reused for new ones, so a warm buffer doesn't allocate.
+//
+// The saved progress (GameCore::ProgressFields) isn't rewound: snapshots leave it out, and the
+// ticks simulated again (to reach a tick, or during a playback) get the progress from before
+// them put back, so nothing they score counts twice. The front end shouldn't save while
+// those ticks run.
+#pragma once
+
+#include "loong_replay.h"
+
+struct RewindInput {
+    uint64_t tick; // Ticks run before the input
+    ReplayInputKind kind;
+    uint64_t argument;
+};
+
+struct RewindKeyframe {
+    uint64_t tick = 0; // Ticks run before the snapshot was taken
+    vector<uint8_t> snapshot;
+    vector<RewindInput> inputs; // From this keyframe up to the next one
+
+    size_t Bytes() const {
+        return snapshot.capacity() + inputs.capacity() * sizeof(RewindInput);
+    }
+};
+
+class RewindBuffer {
+public:
+    static const int DEFAULT_KEYFRAME_TICKS = 10; // 2 s at speed 1
+    static const size_t DEFAULT_BUDGET_BYTES = 1 << 20; // A few minutes of play
+
+    RewindBuffer() {
+        Configure(DEFAULT_KEYFRAME_TICKS, DEFAULT_BUDGET_BYTES);
+    }
+
+    // Changing either drops what's kept
+    void Configure(int keyframeTicks, size_t budgetBytes) {
+        this->keyframeTicks = max(1, keyframeTicks);
+        this->budgetBytes = budgetBytes;
+        Clear();
+        spare.clear();
+    }
+
+    void Clear() {
+        while (!frames.empty()) DropNewest();
+        ticks = 0;
+        endSnapshot.clear();
+        playing = false;
+    }
+
+    bool Empty() const { return frames.empty(); }
+    uint64_t Ticks() const { return ticks; }
+    uint64_t OldestTick() const { return frames.empty() ? ticks : frames.front().tick; }
+    size_t UsedBytes() const { return usedBytes; }
+    size_t BudgetBytes() const { return budgetBytes; }
+    int KeyframeTicks() const { return keyframeTicks; }
+
+    // Start of a run: forget the last one, keyframe at tick 0
+    void Begin(const GameCore& game) {
+        Clear();
+        AddKeyframe(game);
+    }
+
+    // After every gameplay tick of the run
+    void Tick(const GameCore& game) {
+        if (frames.empty() || playing) return;
+        ticks++;
+        if (ticks - frames.back().tick >= (uint64_t)keyframeTicks) AddKeyframe(game);
+    }
+
+    // Every input HandleInput acts on, before the next tick
+    void Record(ReplayInputKind kind, uint64_t argument = 0) {
+        if (frames.empty() || playing) return;
+        vector<RewindInput>& inputs = frames.back().inputs;
+        size_t capacity = inputs.capacity();
+        inputs.push_back({ticks, kind, argument});
+        usedBytes += (inputs.capacity() - capacity) * sizeof(RewindInput);
+        Trim();
+    }
+
+    // The state the run ended in, for StopPlayback
+    void End(const GameCore& game) {
+        if (frames.empty() || playing) return;
+        game.SaveSnapshot(endSnapshot);
+    }
+
+    // Put the game back to how it was after tick ticks (OldestTick() to Ticks()) and forget
+    // everything after it, so the run goes on from there
+    bool RewindTo(GameCore& game, uint64_t tick) {
+        if (playing || !Restore(game, tick)) return false;
+        while (frames.back().tick > tick) DropNewest();
+        vector<RewindInput>& inputs = frames.back().inputs;
+        while (!inputs.empty() && inputs.back().tick >= tick) inputs.pop_back();
+        ticks = tick;
+        endSnapshot.clear();
+        return true;
+    }
+
+    // PLAYBACK: watch the kept ticks again from tick on, one PlaybackTick() per gameplay tick,
+    // without changing what's kept
+    bool StartPlayback(GameCore& game, uint64_t tick) {
+        if (playing || !Restore(game, tick)) return false;
+        playing = true;
+        playbackTick = tick;
+        playbackFrame = FrameAt(tick);
+        return true;
+    }
+
+    bool IsPlaying() const { return playing; }
+
+    // False once every kept tick has been played
+    bool PlaybackTick(GameCore& game) {
+        if (!playing || playbackTick >= ticks) return false;
+        while (playbackFrame + 1 < frames.size() && frames[playbackFrame + 1].tick <= playbackTick) playbackFrame++;
+        ApplyInputs(game, frames[playbackFrame], playbackTick);
+        game.UpdateGameplay(GAMEPLAY_TICK_DELTA);
+        playbackTick++;
+        return true;
+    }
+
+    // Back to where the run ended (or the last kept tick if it hasn't)
+    void StopPlayback(GameCore& game) {
+        if (!playing) return;
+        playing = false;
+        game.LoadProgress(progress.data(), progress.size()); // Kept by the Restore in StartPlayback
+        if (endSnapshot.empty() || !game.LoadSnapshot(endSnapshot.data(), endSnapshot.size())) {
+            Restore(game, ticks);
+        }
+    }
+
+private:
+    int keyframeTicks = DEFAULT_KEYFRAME_TICKS;
+    size_t budgetBytes = DEFAULT_BUDGET_BYTES;
+    deque<RewindKeyframe> frames; // Oldest first
+    vector<RewindKeyframe> spare; // Dropped frames, their memory is reused
+    size_t usedBytes = 0;
+    uint64_t ticks = 0; // Ticks run since Begin
+    vector<uint8_t> endSnapshot;
+    vector<uint8_t> progress; // Saved progress from before the ticks simulated again
+    bool playing = false;
+    uint64_t playbackTick = 0;
+    size_t playbackFrame = 0;
+
+    void AddKeyframe(const GameCore& game) {
+        RewindKeyframe frame;
+        if (!spare.empty()) {
+            frame = move(spare.back());
+            spare.pop_back();
+        }
+        frame.tick = ticks;
+        frame.inputs.clear();
+        game.SaveSnapshot(frame.snapshot);
+        usedBytes += frame.Bytes();
+        frames.push_back(move(frame));
+        Trim();
+    }
+
+    // The newest keyframe always stays, even on its own over budget
+    void Trim() {
+        while (usedBytes > budgetBytes && frames.size() > 1) {
+            usedBytes -= frames.front().Bytes();
+            if (spare.size() < 2) spare.push_back(move(frames.front()));
+            frames.pop_front();
+        }
+    }
+
+    void DropNewest() {
+        usedBytes -= frames.back().Bytes();
+        if (spare.size() < 2) spare.push_back(move(frames.back()));
+        frames.pop_back();
+    }
+
+    // Newest keyframe at or before tick (frames must not be empty)
+    size_t FrameAt(uint64_t tick) const {
+        size_t index = frames.size() - 1;
+        while (index > 0 && frames[index].tick > tick) index--;
+        return index;
+    }
+
+    static void ApplyInputs(GameCore& game, const RewindKeyframe& frame, uint64_t tick) {
+        for (const RewindInput& input : frame.inputs) {
+            if (input.tick == tick) ApplyReplayInput(game, input.kind, input.argument);
+        }
+    }
+
+    bool Restore(GameCore& game, uint64_t tick) {
+        if (frames.empty() || tick < frames.front().tick || tick > ticks) return false;
+        const RewindKeyframe& frame = frames[FrameAt(tick)];
+        game.SaveProgress(progress);
+        if (!game.LoadSnapshot(frame.snapshot.data(), frame.snapshot.size())) return false;
+        for (uint64_t t = frame.tick; t < tick; t++) {
+            ApplyInputs(game, frame, t);
+            game.UpdateGameplay(GAMEPLAY_TICK_DELTA);
+        }
+        game.LoadProgress(progress.data(), progress.size());
+        return true;
+    }
+};
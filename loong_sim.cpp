@@ -0,0 +1,335 @@
+// Mahjong Loong batch simulator: many headless games per LOONG and difficulty, on all cores
+//
+// Every game runs on its own GameCore with its own run seed, played by one of the bots in
+// loong_bots.h (--bot), and the score, age, Mahjong/KONG wins and time to death of each (LOONG, difficulty) pair
+// are reported as CSV or JSON for balance work. Results depend only on --seed, not on the
+// thread count.
+//
+// Build: g++ -std=c++17 -O2 -pthread loong_sim.cpp -o loong_sim
+#include "loong_bots.h"
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+enum SimOutcome {
+    SIM_DIED,
+    SIM_CULTIVATED, // Reached CULTIVATION_SUCCESS
+    SIM_TIMED_OUT   // Still alive after --max-ticks
+};
+
+struct SimResult {
+    int score = 0;
+    int snakeAge = 0;
+    int mahjongWins = 0;
+    int kongWins = 0;
+    long long ticks = 0;
+    double seconds = 0.0; // Game time at the default tick rate and the current speed multiplier
+    SimOutcome outcome = SIM_TIMED_OUT;
+};
+
+// Play one game from start to finish
+SimResult PlaySimGame(BotPolicy& bot, LoongType loongType, DifficultyLevel difficulty, uint64_t runSeed, long long maxTicks) {
+    GameCore game(runSeed, true); // Quiet: no game log
+    RandomGenerator clicks; // Answers to choice and upgrade windows
+    clicks.Seed(runSeed ^ 0xA5A5A5A5A5A5A5A5ull);
+    bot.Seed(runSeed ^ 0x5A5A5A5A5A5A5A5Aull);
+    TickScheduler timing;
+    game.StartRun(loongType, difficulty);
+
+    SimResult result;
+    while (game.gameState == PLAYING && result.ticks < maxTicks) {
+        if (!AnswerPromptsAtRandom(game, clicks)) {
+            ApplyBotAction(game, bot.Act(BotView(game)));
+        }
+        game.UpdateGameplay(GAMEPLAY_TICK_DELTA);
+        game.UpdateTimers(GAMEPLAY_TICK_DELTA);
+        result.seconds += timing.baseInterval / game.currentSpeedMultiplier;
+        result.ticks++;
+
+        // GameOver() resets the run right away, so keep the last live numbers
+        if (game.gameState != GAME_OVER) {
+            result.score = game.score;
+            result.snakeAge = game.snakeAge;
+            result.mahjongWins = game.mahjongWins;
+            result.kongWins = game.kongWins;
+        }
+    }
+
+    if (game.gameState == GAME_OVER) {
+        result.score = game.finalScore;
+        result.outcome = SIM_DIED;
+    } else if (game.gameState == CULTIVATION_SUCCESS) {
+        result.outcome = SIM_CULTIVATED;
+    }
+    return result;
+}
+
+// Games of one (LOONG, difficulty) pair
+struct SimJob {
+    int pair;
+    int firstGame;
+    int gameCount;
+};
+
+// WORK-STEALING POOL: every worker pops jobs from the back of its own queue and steals
+// from the front of the others when it runs dry
+class SimPool {
+public:
+    struct Queue {
+        mutex lock;
+        deque<SimJob> jobs;
+    };
+
+    vector<Queue> queues;
+
+    SimPool(int workerCount) : queues(workerCount) {}
+
+    void Push(int worker, const SimJob& job) {
+        lock_guard<mutex> guard(queues[worker].lock);
+        queues[worker].jobs.push_back(job);
+    }
+
+    bool Pop(int worker, SimJob& job) {
+        {
+            lock_guard<mutex> guard(queues[worker].lock);
+            if (!queues[worker].jobs.empty()) {
+                job = queues[worker].jobs.back();
+                queues[worker].jobs.pop_back();
+                return true;
+            }
+        }
+        for (int offset = 1; offset < (int)queues.size(); offset++) {
+            Queue& victim = queues[(worker + offset) % queues.size()];
+            lock_guard<mutex> guard(victim.lock);
+            if (!victim.jobs.empty()) {
+                job = victim.jobs.front();
+                victim.jobs.pop_front();
+                return true;
+            }
+        }
+        return false; // All jobs are known up front, so empty queues mean we're done
+    }
+};
+
+// Distribution of one metric over the games of one pair
+struct MetricSummary {
+    static const int BINS = 10;
+
+    int count = 0;
+    double mean = 0.0;
+    double minimum = 0.0;
+    double p10 = 0.0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double maximum = 0.0;
+    int histogram[BINS] = {}; // Equal-width bins from minimum to maximum
+
+    MetricSummary(vector<double> values) {
+        count = values.size();
+        if (count == 0) return;
+
+        sort(values.begin(), values.end());
+        double sum = 0.0;
+        for (double value : values) sum += value;
+        mean = sum / count;
+        minimum = values.front();
+        maximum = values.back();
+        p10 = Percentile(values, 0.10);
+        p50 = Percentile(values, 0.50);
+        p90 = Percentile(values, 0.90);
+        p99 = Percentile(values, 0.99);
+
+        double width = (maximum - minimum) / BINS;
+        for (double value : values) {
+            int bin = width > 0.0 ? (int)((value - minimum) / width) : 0;
+            histogram[min(bin, BINS - 1)]++;
+        }
+    }
+
+    // Nearest-rank percentile of sorted values
+    static double Percentile(const vector<double>& sorted, double fraction) {
+        int rank = (int)ceil(fraction * sorted.size());
+        return sorted[max(0, rank - 1)];
+    }
+};
+
+const char* SIM_METRICS[5] = {"score", "snakeAge", "mahjongWins", "kongWins", "timeToDeath"};
+
+vector<double> MetricValues(const vector<SimResult>& results, int metric) {
+    vector<double> values;
+    for (const SimResult& result : results) {
+        switch (metric) {
+            case 0: values.push_back(result.score); break;
+            case 1: values.push_back(result.snakeAge); break;
+            case 2: values.push_back(result.mahjongWins); break;
+            case 3: values.push_back(result.kongWins); break;
+            case 4: if (result.outcome == SIM_DIED) values.push_back(result.seconds); break; // Deaths only
+        }
+    }
+    return values;
+}
+
+string HistogramText(const MetricSummary& summary, const char* separator) {
+    string text;
+    for (int bin = 0; bin < MetricSummary::BINS; bin++) {
+        if (bin > 0) text += separator;
+        text += to_string(summary.histogram[bin]);
+    }
+    return text;
+}
+
+void WriteCsv(ostream& out, const vector<pair<LoongType, DifficultyLevel>>& pairs, const vector<vector<SimResult>>& results) {
+    out << "loong,difficulty,games,died,cultivated,timedOut,metric,count,mean,min,p10,p50,p90,p99,max,histogram" << endl;
+    for (size_t p = 0; p < pairs.size(); p++) {
+        int outcomes[3] = {0, 0, 0};
+        for (const SimResult& result : results[p]) outcomes[result.outcome]++;
+
+        for (int metric = 0; metric < 5; metric++) {
+            MetricSummary summary(MetricValues(results[p], metric));
+            out << pairs[p].first << "," << pairs[p].second << "," << results[p].size() << ","
+                << outcomes[SIM_DIED] << "," << outcomes[SIM_CULTIVATED] << "," << outcomes[SIM_TIMED_OUT] << ","
+                << SIM_METRICS[metric] << "," << summary.count << "," << summary.mean << "," << summary.minimum << ","
+                << summary.p10 << "," << summary.p50 << "," << summary.p90 << "," << summary.p99 << ","
+                << summary.maximum << "," << HistogramText(summary, ";") << endl;
+        }
+    }
+}
+
+void WriteJson(ostream& out, const vector<pair<LoongType, DifficultyLevel>>& pairs, const vector<vector<SimResult>>& results) {
+    out << "[" << endl;
+    for (size_t p = 0; p < pairs.size(); p++) {
+        int outcomes[3] = {0, 0, 0};
+        for (const SimResult& result : results[p]) outcomes[result.outcome]++;
+
+        out << "  {\"loong\": " << pairs[p].first << ", \"difficulty\": " << pairs[p].second
+            << ", \"games\": " << results[p].size() << ", \"died\": " << outcomes[SIM_DIED]
+            << ", \"cultivated\": " << outcomes[SIM_CULTIVATED] << ", \"timedOut\": " << outcomes[SIM_TIMED_OUT]
+            << ", \"metrics\": {" << endl;
+        for (int metric = 0; metric < 5; metric++) {
+            MetricSummary summary(MetricValues(results[p], metric));
+            out << "    \"" << SIM_METRICS[metric] << "\": {\"count\": " << summary.count << ", \"mean\": " << summary.mean
+                << ", \"min\": " << summary.minimum << ", \"p10\": " << summary.p10 << ", \"p50\": " << summary.p50
+                << ", \"p90\": " << summary.p90 << ", \"p99\": " << summary.p99 << ", \"max\": " << summary.maximum
+                << ", \"histogram\": [" << HistogramText(summary, ", ") << "]}" << (metric < 4 ? "," : "") << endl;
+        }
+        out << "  }}" << (p + 1 < pairs.size() ? "," : "") << endl;
+    }
+    out << "]" << endl;
+}
+
+// Usage: [--games N] [--loong 0-8|all] [--difficulty 0-4|all] [--bot random|greedy|bfs]
+//        [--threads N] [--seed S] [--max-ticks N] [--format csv|json] [--out FILE]
+int main(int argc, char** argv) {
+    int gamesPerPair = 100;
+    int onlyLoong = -1;
+    int onlyDifficulty = -1;
+    int threadCount = max(1u, thread::hardware_concurrency());
+    uint64_t baseSeed = 1;
+    long long maxTicks = 50000;
+    string botName = "greedy";
+    string format = "csv";
+    string outPath;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--games") == 0 && i + 1 < argc) gamesPerPair = max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--loong") == 0 && i + 1 < argc) { i++; onlyLoong = strcmp(argv[i], "all") == 0 ? -1 : atoi(argv[i]); }
+        else if (strcmp(argv[i], "--difficulty") == 0 && i + 1 < argc) { i++; onlyDifficulty = strcmp(argv[i], "all") == 0 ? -1 : atoi(argv[i]); }
+        else if (strcmp(argv[i], "--bot") == 0 && i + 1 < argc) botName = argv[++i];
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) threadCount = max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) baseSeed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--max-ticks") == 0 && i + 1 < argc) maxTicks = max(1LL, atoll(argv[++i]));
+        else if (strcmp(argv[i], "--format") == 0 && i + 1 < argc) format = argv[++i];
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) outPath = argv[++i];
+        else {
+            cerr << "Unknown option: " << argv[i] << endl;
+            cerr << "Usage: " << argv[0] << " [--games N] [--loong 0-8|all] [--difficulty 0-4|all] [--bot random|greedy|bfs] [--threads N] [--seed S] [--max-ticks N] [--format csv|json] [--out FILE]" << endl;
+            return 1;
+        }
+    }
+    if (!MakeBot(botName)) {
+        cerr << "Unknown bot: " << botName << " (random, greedy or bfs)" << endl;
+        return 1;
+    }
+    if (format != "csv" && format != "json") {
+        cerr << "Unknown format: " << format << " (csv or json)" << endl;
+        return 1;
+    }
+
+    vector<pair<LoongType, DifficultyLevel>> pairs;
+    for (int loong = 0; loong < 9; loong++) {
+        for (int difficulty = 0; difficulty < 5; difficulty++) {
+            if ((onlyLoong < 0 || onlyLoong == loong) && (onlyDifficulty < 0 || onlyDifficulty == difficulty)) {
+                pairs.push_back({(LoongType)loong, (DifficultyLevel)difficulty});
+            }
+        }
+    }
+    if (pairs.empty()) {
+        cerr << "No (LOONG, difficulty) pair matches --loong " << onlyLoong << " --difficulty " << onlyDifficulty << endl;
+        return 1;
+    }
+
+    // Small jobs, dealt round-robin; stealing evens out the long games
+    const int JOB_GAMES = 4;
+    SimPool pool(threadCount);
+    vector<vector<SimResult>> results(pairs.size(), vector<SimResult>(gamesPerPair));
+    int jobCount = 0;
+    for (size_t p = 0; p < pairs.size(); p++) {
+        for (int first = 0; first < gamesPerPair; first += JOB_GAMES) {
+            pool.Push(jobCount++ % threadCount, {(int)p, first, min(JOB_GAMES, gamesPerPair - first)});
+        }
+    }
+
+    cerr << "Simulating " << gamesPerPair << " games x " << pairs.size() << " pairs on " << threadCount << " threads (" << botName << " bot, seed " << baseSeed << ")" << endl;
+
+    vector<long long> workerTicks(threadCount, 0);
+    vector<double> workerSeconds(threadCount, 0.0);
+    vector<thread> workers;
+    auto start = chrono::steady_clock::now();
+    for (int worker = 0; worker < threadCount; worker++) {
+        workers.push_back(thread([&, worker]() {
+            auto workerStart = chrono::steady_clock::now();
+            unique_ptr<BotPolicy> bot = MakeBot(botName); // Reseeded for every game
+            SimJob job;
+            while (pool.Pop(worker, job)) {
+                for (int game = job.firstGame; game < job.firstGame + job.gameCount; game++) {
+                    // The seed depends only on the pair and game number, never on the thread
+                    uint64_t runSeed = baseSeed + ((uint64_t)job.pair << 32) + game;
+                    SimResult& result = results[job.pair][game];
+                    result = PlaySimGame(*bot, pairs[job.pair].first, pairs[job.pair].second, runSeed, maxTicks);
+                    workerTicks[worker] += result.ticks;
+                }
+            }
+            workerSeconds[worker] = chrono::duration<double>(chrono::steady_clock::now() - workerStart).count();
+        }));
+    }
+    for (thread& worker : workers) worker.join();
+    double totalSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    long long totalTicks = 0;
+    for (int worker = 0; worker < threadCount; worker++) {
+        totalTicks += workerTicks[worker];
+        cerr << "Thread " << worker << ": " << workerTicks[worker] << " ticks, "
+             << (workerSeconds[worker] > 0 ? workerTicks[worker] / workerSeconds[worker] : 0.0) << " ticks/s" << endl;
+    }
+    cerr << "Total: " << totalTicks << " ticks in " << totalSeconds << " s (" << totalTicks / max(totalSeconds, 1e-9) << " ticks/s)" << endl;
+
+    ofstream file;
+    if (!outPath.empty()) {
+        file.open(outPath);
+        if (!file) {
+            cerr << "Can't write " << outPath << endl;
+            return 1;
+        }
+    }
+    ostream& out = outPath.empty() ? cout : file;
+    if (format == "json") WriteJson(out, pairs, results);
+    else WriteCsv(out, pairs, results);
+    return 0;
+}
@@ -0,0 +1,122 @@
+// Mahjong Loong replay verifier: replays recorded runs through the headless core and checks
+// the claimed score and mahjongWinsAchieved, for a local leaderboard
+//
+// Every replay (see loong_replay.h) is replayed with no rendering at full speed, spread over
+// all cores, one replay per job. A replay whose replayed outcome doesn't match the claim is
+// rejected; a checkpoint that doesn't match gives the tick and the state hashes where the
+// replayed run split from the recorded one.
+//
+// Build: g++ -std=c++17 -O2 -pthread loong_verify.cpp -o loong_verify
+#include "loong_replay.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+
+enum VerifyStatus {
+    VERIFY_OK,
+    VERIFY_FORGED,   // Replays fine, but scores something other than the claim
+    VERIFY_DIVERGED, // The replayed run split from the recorded one
+    VERIFY_INVALID   // Unreadable, cut off or too long
+};
+
+struct VerifyJob {
+    string path;
+    ReplayVerdict verdict;
+    VerifyStatus status = VERIFY_INVALID;
+    double milliseconds = 0.0;
+};
+
+const char* VERIFY_STATUS_NAMES[] = {"OK", "FORGED", "DIVERGED", "INVALID"};
+
+// Usage: [--threads N] [--score N] [--mahjongs N] [--max-ticks N] replay.lrp...
+// --score / --mahjongs replace the claim stored in the replays
+int main(int argc, char** argv) {
+    int threadCount = max(1u, thread::hardware_concurrency());
+    int claimedScore = -1;
+    int claimedMahjongs = -1;
+    uint64_t maxTicks = 10000000;
+    vector<VerifyJob> jobs;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) threadCount = max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--score") == 0 && i + 1 < argc) claimedScore = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--mahjongs") == 0 && i + 1 < argc) claimedMahjongs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--max-ticks") == 0 && i + 1 < argc) maxTicks = max(1ULL, strtoull(argv[++i], nullptr, 10));
+        else if (argv[i][0] == '-') {
+            cerr << "Unknown option: " << argv[i] << endl;
+            cerr << "Usage: " << argv[0] << " [--threads N] [--score N] [--mahjongs N] [--max-ticks N] replay.lrp..." << endl;
+            return 1;
+        } else {
+            jobs.push_back(VerifyJob());
+            jobs.back().path = argv[i];
+        }
+    }
+    if (jobs.empty()) {
+        cerr << "Usage: " << argv[0] << " [--threads N] [--score N] [--mahjongs N] [--max-ticks N] replay.lrp..." << endl;
+        return 1;
+    }
+    threadCount = min(threadCount, (int)jobs.size());
+
+    atomic<int> nextJob(0);
+    vector<thread> workers;
+    auto start = chrono::steady_clock::now();
+    for (int worker = 0; worker < threadCount; worker++) {
+        workers.push_back(thread([&]() {
+            vector<uint8_t> bytes;
+            for (int j = nextJob++; j < (int)jobs.size(); j = nextJob++) {
+                VerifyJob& job = jobs[j];
+                ifstream file(job.path, ios::binary);
+                if (!file) {
+                    job.verdict.error = "can't open";
+                    continue;
+                }
+                bytes.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+
+                auto jobStart = chrono::steady_clock::now();
+                job.verdict = VerifyReplay(bytes.data(), bytes.size(), maxTicks);
+                job.milliseconds = chrono::duration<double, milli>(chrono::steady_clock::now() - jobStart).count();
+
+                if (claimedScore >= 0) job.verdict.claimed.score = claimedScore;
+                if (claimedMahjongs >= 0) job.verdict.claimed.mahjongWinsAchieved = claimedMahjongs;
+                if (!job.verdict.error.empty()) job.status = VERIFY_INVALID;
+                else if (job.verdict.diverged) job.status = VERIFY_DIVERGED;
+                else if (!(job.verdict.claimed == job.verdict.replayed)) job.status = VERIFY_FORGED;
+                else job.status = VERIFY_OK;
+            }
+        }));
+    }
+    for (thread& worker : workers) {
+        worker.join();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    int rejected = 0;
+    uint64_t totalTicks = 0;
+    for (const VerifyJob& job : jobs) {
+        const ReplayVerdict& verdict = job.verdict;
+        totalTicks += verdict.ticks;
+        if (job.status != VERIFY_OK) rejected++;
+
+        cout << job.path << ": " << VERIFY_STATUS_NAMES[job.status];
+        if (job.status == VERIFY_INVALID) {
+            cout << " (" << verdict.error << ")" << endl;
+            continue;
+        }
+        cout << " score " << verdict.replayed.score << ", mahjongs " << verdict.replayed.mahjongWinsAchieved;
+        if (job.status == VERIFY_FORGED) {
+            cout << " (claimed " << verdict.claimed.score << ", " << verdict.claimed.mahjongWinsAchieved << ")";
+        }
+        if (job.status == VERIFY_DIVERGED) {
+            cout << " (split at tick " << verdict.divergenceTick << ": recorded hash " << hex << setw(8) << setfill('0') << verdict.recordedHash
+                 << ", replayed " << setw(8) << verdict.replayedHash << dec << setfill(' ') << ")";
+        }
+        cout << ", " << verdict.ticks << " ticks in " << fixed << setprecision(2) << job.milliseconds << " ms" << defaultfloat << endl;
+    }
+
+    cerr << jobs.size() << " replays (" << totalTicks << " ticks) on " << threadCount << " threads in " << seconds << " s, "
+         << rejected << " rejected" << endl;
+    return rejected > 0 ? 1 : 0;
+}
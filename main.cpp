@@ -10,15 +10,36 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <ctime>
+#include <chrono>
+
+#include "loong_core.h" // Game rules, no raylib
+#include "loong_rewind.h" // Replays and rewind
 
 #ifdef PLATFORM_WEB
 #include <emscripten.h>
 #include <emscripten/html5.h>
 #endif
 
+#ifdef LOONG_BENCHMARK
+#include "loong_bots.h"
+#include <chrono>
+#include <climits>
+#endif
+
+#ifdef LOONG_VALIDATOR
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#endif
+
 using namespace std;
 
 
+
 // Define missing color constants
 #ifndef LIGHTBLUE
 #define LIGHTBLUE (Color){173, 216, 230, 255}
@@ -27,80 +48,8 @@ using namespace std;
 #define LIGHTGREEN (Color){144, 238, 144, 255}
 #endif
 
-// Game states
-enum GameState {
-    TITLE_SCREEN,
-    LOONG_SELECTION,
-    DIFFICULTY_SELECTION,
-    INSTRUCTION_SCREEN,
-    COUNTDOWN,
-    PLAYING,
-    GAME_OVER,
-    CULTIVATION_SUCCESS,
-    LOONG_UPGRADE
-};
-
-// Cultivation Difficulty Levels
-enum DifficultyLevel {
-    FOUNDATION_BUILDING = 0,  // 3 Extra Lives
-    GOLDEN_CORE = 1,          // 1 Life, no Extra Lives
-    NASCENT_SOUL = 2,         // 7->10->13 tiles progression
-    ASCENSION = 3,            // 10 tiles, 5 Mahjongs to win
-    IMMORTAL_SAGE = 4         // 13 tiles, 5 Mahjongs to win
-};
-
-// LOONG Types - Each with unique abilities and upgrade paths
-enum LoongType {
-    BASIC_LOONG = 0,        // Balanced starter dragon
-    FIRE_LOONG = 1,         // Aggressive damage dealer
-    WATER_LOONG = 2,        // Defensive and healing
-    WHITE_LOONG = 3,        // Pure and purifying
-    EARTH_LOONG = 4,        // Slow but powerful
-    WIND_LOONG = 5,         // Fast and agile
-    SHADOW_LOONG = 6,       // Mysterious and tricky
-    CELESTIAL_LOONG = 7,    // Ultimate endgame dragon
-    PATIENCE_LOONG = 8      // Dragon of patience and control
-};
-
-struct LoongUpgrade {
-    string name;
-    string description;
-    int level;
-    int maxLevel;
-
-    LoongUpgrade(string n, string desc, int maxLvl) : name(n), description(desc), level(0), maxLevel(maxLvl) {}
-};
-
-struct LoongData {
-    LoongType type;
-    string name;
-    string description;
-    Color primaryColor;
-    Color secondaryColor;
-    vector<LoongUpgrade> upgrades;
-    int level; // Overall LOONG level (increases every 10 snake age)
-
-    LoongData(LoongType t, string n, string desc, Color primary, Color secondary)
-        : type(t), name(n), description(desc), primaryColor(primary), secondaryColor(secondary), level(0) {}
-};
-
-// Ornate levels
-enum OrnateLevel {
-    LEVEL_1_NONE = 0,
-    LEVEL_2_BASIC = 1,
-    LEVEL_3_INTRICATE = 2,
-    LEVEL_4_DRAGON = 3,
-    LEVEL_5_GOLD_BASIC = 4,
-    LEVEL_6_GOLD_INTRICATE = 5,
-    LEVEL_7_GOLD_DRAGON = 6,
-    LEVEL_8_ORNATE_GOLD = 7,
-    LEVEL_9_MASTER_GOLD = 8,
-    LEVEL_10_LEGENDARY = 9
-};
-
 // Game area settings (inner box where snake moves)
 int cellSize = 40;
-int cellCount = 20;
 int gameAreaOffset = 150;
 
 // Total canvas settings (outer area for mouse control + UI)
@@ -111,8 +60,6 @@ int canvasHeight = 1000;
 int uiPanelX = 1400;  // Shifted right to give game area more room
 int uiPanelWidth = 400;
 
-double lastUpdateTime = 0;
-
 // Function to draw simplified ornate background pattern based on level
 void DrawOrnateBackground(int ornateLevel) {
     // Level 0: Plain background (no patterns)
@@ -186,1209 +133,338 @@ void PlaySoundSafe(Sound sound, float pitch, float currentTime, float& lastSound
     }
 }
 
+// Tile popup drawing - NumberPopup itself lives in the core
+void DrawNumberPopup(const NumberPopup& popup) {
+    if (popup.active) {
+        // Popup sits over the cell the tile was picked up at
+        Vector2 position = {
+            gameAreaOffset + popup.position.x * cellSize + cellSize / 2,
+            gameAreaOffset + popup.position.y * cellSize + cellSize / 2
+        };
 
+        // Draw enhanced tile popup with thick colored border
+        Rectangle tileRect = {position.x - 40, position.y - 30, 80, 60};
+        DrawRectangleRec(tileRect, BLACK);
 
-// Mahjong tile system
-// Tile types for expanded mahjong
-enum TileType {
-    PLAIN_TILES = 0,     // 1-9 white border (default)
-    HAT_TILES = 1,       // 1-9 with hat symbol
-    DOT_TILES = 2        // 1-9 with dot symbol
-};
-
-struct Tile {
-    int value;      // 0-9 (0 = blank/zero tile)
-    TileType type;  // NUMBERS, LETTERS, or DOTS
-    bool isGold;    // True if this tile is from a KONG
-
-    Tile(int v = 1, TileType t = PLAIN_TILES, bool gold = false) : value(v), type(t), isGold(gold) {}
-
-    bool operator==(const Tile& other) const {
-        return value == other.value && type == other.type;
-    }
-
-    string ToString() const {
-        if (value == 0) {
-            return "0"; // Zero/blank tile
-        }
-        string result = to_string(value);
-        if (type == HAT_TILES) {
-            result += "^"; // Hat symbol
-        } else if (type == DOT_TILES) {
-            result += "."; // Dot symbol
-        }
-        return result;
-    }
-
-    bool IsZero() const {
-        return value == 0;
-    }
-};
-
-// Enhanced tile popup system - NOW AFTER Tile definitions
-struct NumberPopup {
-    Tile tile;
-    Vector2 position;
-    float timer;
-    bool active;
-
-    NumberPopup() : tile(1, PLAIN_TILES, false), position({0, 0}), timer(0), active(false) {}
-
-    void Show(const Tile& newTile, Vector2 pos) {
-        tile = newTile;
-        position = pos;
-        timer = 1.2f; // Show for 1.2 seconds for better visibility
-        active = true;
-    }
-
-    void Update(float deltaTime) {
-        if (active) {
-            timer -= deltaTime;
-            if (timer <= 0) {
-                active = false;
-            }
-        }
-    }
-
-    void Draw() {
-        if (active) {
-            // Draw enhanced tile popup with thick colored border
-            Rectangle tileRect = {position.x - 40, position.y - 30, 80, 60};
-            DrawRectangleRec(tileRect, BLACK);
-
-            // Thick border color based on tile type
-            Color borderColor = WHITE;
-            if (tile.type == HAT_TILES) borderColor = LIGHTBLUE;
-            else if (tile.type == DOT_TILES) borderColor = LIGHTGREEN;
-
-            DrawRectangleLinesEx(tileRect, 6, borderColor); // Extra thick border
-
-            // Draw "PICKED UP:" label above
-            DrawText("PICKED UP:", position.x - 45, position.y - 55, 16, YELLOW);
-
-            // Draw tile content with type indicator
-            string tileText = to_string(tile.value);
-            if (tile.type == HAT_TILES) tileText += "^";
-            else if (tile.type == DOT_TILES) tileText += ".";
-
-            // Large text with type-specific color
-            Color textColor = WHITE;
-            if (tile.type == HAT_TILES) textColor = LIGHTBLUE;
-            else if (tile.type == DOT_TILES) textColor = LIGHTGREEN;
-
-            int textWidth = MeasureText(tileText.c_str(), 36);
-            DrawText(tileText.c_str(), position.x - textWidth/2, position.y - 18, 36, textColor);
-
-            // Add pulsing effect for extra visibility
-            float pulseAlpha = (sin(timer * 8) + 1) * 0.3f + 0.4f; // Pulse between 0.4 and 1.0
-            Color pulseColor = borderColor;
-            pulseColor.a = (unsigned char)(255 * pulseAlpha);
-            DrawRectangleLinesEx(tileRect, 8, pulseColor); // Outer pulsing border
-        }
-    }
-};
-
-class MahjongTiles {
-public:
-    vector<Tile> tiles;
-    int arrowPosition;
-    map<pair<int, TileType>, int> tileCounts; // Track tile usage (value, type) -> count
-    set<pair<int, TileType>> goldTiles; // Tiles that are KONG (removed from pool)
-    int maxTiles; // Maximum number of tiles (4, 7, 10, 13)
-    vector<TileType> availableTypes; // Which tile types are available
-
-    // Tile tracker system
-    vector<Tile> discardPile; // All tiles we've discarded (for display)
-    map<pair<int, TileType>, int> totalDiscardCounts; // Total count of each tile discarded
-    bool canReshuffle; // Whether reshuffle is available
-    Tile nextTile; // Preview of next tile to be generated
-
-    // TILE LOCKING SYSTEM (White LOONG Future Sight)
-    vector<Tile> lockedFutureTiles; // The 3 locked future tiles
-    bool futureTilesLocked; // Are future tiles currently locked?
-    int lockedTilesRemaining; // How many locked tiles are left
-
-    MahjongTiles() {
-        arrowPosition = 0;
-        maxTiles = 4; // Start with 4 tiles
-        availableTypes.push_back(PLAIN_TILES); // Start with only plain tiles
-        canReshuffle = false; // Start with no reshuffle available
-
-        // Initialize tile locking system
-        futureTilesLocked = false;
-        lockedTilesRemaining = 0;
-
-        // Initialize tile counts for all types (including zero)
-        for (int i = 0; i <= 9; i++) { // Include 0 for zero tiles
-            tileCounts[make_pair(i, PLAIN_TILES)] = 0;
-            tileCounts[make_pair(i, HAT_TILES)] = 0;
-            tileCounts[make_pair(i, DOT_TILES)] = 0;
-            totalDiscardCounts[make_pair(i, PLAIN_TILES)] = 0;
-            totalDiscardCounts[make_pair(i, HAT_TILES)] = 0;
-            totalDiscardCounts[make_pair(i, DOT_TILES)] = 0;
-        }
-        GenerateRandomTiles(0); // Start with no latent level selected
-        GenerateNextTile(); // Generate first preview tile
-
-        // Test the advanced Mahjong algorithm on startup
-        // TestMahjongLogic(); // Disabled for release
-    }
-
-    void GenerateRandomTiles(int selectedLatentLevel = 0) {
-        // Reset tile counts and gold tiles when drawing new hand (but keep used tiles tracker)
-        cout << "Resetting tile pool for new hand..." << endl;
-        tileCounts.clear();
-        goldTiles.clear();
-
-        // Reinitialize tile counts
-        for (int i = 1; i <= 9; i++) {
-            tileCounts[make_pair(i, PLAIN_TILES)] = 0;
-            tileCounts[make_pair(i, HAT_TILES)] = 0;
-            tileCounts[make_pair(i, DOT_TILES)] = 0;
-        }
-
-        tiles.clear();
-
-        // Add latent cultivation LOONG evolution tiles if a level is selected
-        cout << "GenerateRandomTiles called with selectedLatentLevel: " << selectedLatentLevel << endl;
-        if (selectedLatentLevel > 0) {
-            // This will be implemented by calling a function from the Game class
-            // since we need access to the current LOONG type and upgrade tile generation
-            cout << "Latent Cultivation Level " << selectedLatentLevel << " selected - evolution tiles will be added by Game class" << endl;
-        }
-
-        // Fill remaining slots with normal tiles
-        for (int i = tiles.size(); i < maxTiles; i++) {
-            Tile newTile = GenerateValidTile();
-            tiles.push_back(newTile);
-
-            // CRITICAL FIX: Update tile counts for initial hand
-            pair<int, TileType> tileKey = {newTile.value, newTile.type};
-            tileCounts[tileKey]++;
-        }
-        SortTiles();
-        arrowPosition = 0;
-        cout << "Generated " << maxTiles << " tiles: ";
-        for (const Tile& tile : tiles) {
-            cout << tile.ToString() << " ";
-        }
-        cout << endl;
-    }
-
-    void ShuffleExistingHand() {
-        // EARTHQUAKE SHUFFLE: Randomly swap tiles in existing hand without resetting
-        cout << "🌍 EARTHQUAKE SHUFFLE: Randomly rearranging existing hand..." << endl;
-
-        if (tiles.size() < 2) return; // Need at least 2 tiles to shuffle
-
-        // Perform multiple random swaps to shuffle the hand
-        int numSwaps = max(2, (int)tiles.size() / 2);
-        for (int i = 0; i < numSwaps; i++) {
-            int index1 = GetRandomValue(0, tiles.size() - 1);
-            int index2 = GetRandomValue(0, tiles.size() - 1);
-
-            if (index1 != index2) {
-                swap(tiles[index1], tiles[index2]);
-                cout << "Swapped positions " << index1 << " and " << index2 << endl;
-            }
-        }
-
-        // CRITICAL FIX: Always sort after shuffling
-        SortTiles();
-
-        cout << "Hand shuffled and sorted! New order: ";
-        for (const Tile& tile : tiles) {
-            cout << tile.ToString() << " ";
-        }
-        cout << endl;
-    }
-
-    Tile GenerateValidTile(float probabilityBonus = 0.0f) {
-        vector<pair<pair<int, TileType>, float>> weightedOptions; // Tile and weight
-
-        // Find all valid tile options with probability weights
-        for (TileType type : availableTypes) {
-            for (int value = 1; value <= 9; value++) {
-                pair<int, TileType> tileKey = {value, type};
-
-                // Skip if this tile is gold (KONG)
-                if (goldTiles.count(tileKey) > 0) continue;
-
-                // Skip if we already have 3 of this tile
-                if (tileCounts[tileKey] >= 3) continue;
-
-                float weight = 1.0f; // Base weight (always at least 1.0)
-
-                // PROBABILITY BONUS TYPE 1: Held tile boost (for KONG)
-                int heldCount = 0;
-                for (const Tile& tile : tiles) {
-                    if (tile.value == value && tile.type == type) {
-                        heldCount++;
-                    }
-                }
-                if (heldCount > 0) {
-                    // Cap the bonus to prevent overwhelming base weight
-                    float heldBonus = min(3.0f, (probabilityBonus / 100.0f) * heldCount);
-                    weight += heldBonus;
-                }
-
-                // PROBABILITY BONUS TYPE 2: Adjacent tile boost (for consecutive)
-                bool hasAdjacent = false;
-                for (const Tile& tile : tiles) {
-                    if (tile.type == type) {
-                        // Check for adjacent values (±1)
-                        if (abs(tile.value - value) == 1) {
-                            hasAdjacent = true;
-                            break;
-                        }
-                    }
-                }
-                if (hasAdjacent) {
-                    // Cap the adjacent bonus to prevent overwhelming
-                    float adjacentBonus = min(2.0f, probabilityBonus / 200.0f);
-                    weight += adjacentBonus;
-                }
-
-                weightedOptions.push_back({tileKey, weight});
-            }
-        }
-
-        if (weightedOptions.empty()) {
-            cout << "Warning: No valid tiles available! Auto-reshuffling tile pool..." << endl;
-
-            // Reset tile counts to allow all tiles again
-            tileCounts.clear();
-            for (TileType type : availableTypes) {
-                for (int i = 1; i <= 9; i++) {
-                    tileCounts[make_pair(i, type)] = 0;
-                }
-            }
-
-            // Clear gold tiles (except zeros which can KONG multiple times)
-            auto it = goldTiles.begin();
-            while (it != goldTiles.end()) {
-                if (it->first != 0) { // Keep zero tiles as gold if they were gold
-                    it = goldTiles.erase(it);
-                } else {
-                    ++it;
-                }
-            }
-
-            cout << "Tile pool reshuffled! Generating new tile..." << endl;
-
-            // Try again with fresh pool
-            return GenerateValidTile(probabilityBonus);
-        }
-
-        // Weighted random selection
-        float totalWeight = 0.0f;
-        for (const auto& option : weightedOptions) {
-            totalWeight += option.second;
-        }
-
-        float randomValue = GetRandomValue(0, (int)(totalWeight * 100)) / 100.0f;
-        float currentWeight = 0.0f;
-
-        pair<int, TileType> chosen = weightedOptions[0].first; // Fallback
-        for (const auto& option : weightedOptions) {
-            currentWeight += option.second;
-            if (randomValue <= currentWeight) {
-                chosen = option.first;
-                break;
-            }
-        }
-
-        // Increment count
-        tileCounts[chosen]++;
-
-        return Tile(chosen.first, chosen.second, false);
-    }
-
-    void GenerateNextTile(float probabilityBonus = 0.0f) {
-        // Check if we have locked future tiles (White LOONG Future Sight)
-        if (futureTilesLocked && !lockedFutureTiles.empty() && lockedTilesRemaining > 0) {
-            // Use the next locked tile
-            nextTile = lockedFutureTiles[3 - lockedTilesRemaining]; // Get the correct locked tile
-            lockedTilesRemaining--;
-            cout << "Next tile (LOCKED): " << nextTile.ToString() << " (" << lockedTilesRemaining << " locked tiles remaining)" << endl;
-
-            // If no more locked tiles, disable the system
-            if (lockedTilesRemaining <= 0) {
-                futureTilesLocked = false;
-                lockedFutureTiles.clear();
-                cout << ">>> FUTURE SIGHT EXPIRED: No more locked tiles!" << endl;
-            }
-        } else {
-            // Normal tile generation
-            nextTile = GenerateValidTile(probabilityBonus);
-            cout << "Next tile preview: " << nextTile.ToString() << endl;
-        }
-    }
-
-    void SortTiles() {
-        sort(tiles.begin(), tiles.end(), [](const Tile& a, const Tile& b) {
-            if (a.type != b.type) return a.type < b.type; // Sort by type first
-            return a.value < b.value; // Then by value
-        });
-    }
-
-    void MoveArrowLeft() {
-        if (arrowPosition > 0) {
-            arrowPosition--;
-        }
-    }
-
-    void MoveArrowRight() {
-        if (arrowPosition < maxTiles) {  // Now includes KEEP option (position maxTiles)
-            arrowPosition++;
-        }
-    }
-
-    void MoveArrowToFarLeft() {
-        arrowPosition = 0;  // Jump to leftmost position
-    }
-
-    void MoveArrowToFarRight() {
-        arrowPosition = maxTiles;  // Jump to KEEP position
-    }
-
-    void ReplaceTileAtArrow(const Tile& newTile) {
-        if (arrowPosition < maxTiles) {  // Replace tile in hand
-            // Track the old tile before replacing (goes to discard)
-            Tile oldTile = tiles[arrowPosition];
-            AddToDiscardPile(oldTile);
-
-            tiles[arrowPosition] = newTile;
-            SortTiles();
-            // Reset arrow to point to the new tile's position after sorting
-            for (int i = 0; i < (int)tiles.size(); i++) {
-                if (tiles[i] == newTile) {
-                    arrowPosition = i;
-                    break;
-                }
-            }
-        } else {
-            // KEEP was selected - new tile goes to discard pile
-            AddToDiscardPile(newTile);
-            cout << "KEEP selected - " << newTile.ToString() << " goes to discard pile" << endl;
-        }
-    }
-
-    bool IsKeepSelected() {
-        return arrowPosition == maxTiles; // KEEP is at position maxTiles
-    }
-
-    void SetTileCount(int newCount, int currentOrnateLevel = 0) {
-        cout << "SetTileCount called with newCount: " << newCount << endl;
-        cout << "Current maxTiles: " << maxTiles << ", current tiles.size(): " << tiles.size() << endl;
-
-        if (newCount >= 4 && newCount <= 13) {
-            int oldMaxTiles = maxTiles;
-            maxTiles = newCount;
-
-            // Add new tile types based on ornate level (NOT tile count)
-            if (newCount == 7 && availableTypes.size() == 1 && currentOrnateLevel >= 1) {
-                availableTypes.push_back(HAT_TILES);
-                cout << "Added HAT tiles (1^-9^) to available tile types!" << endl;
-            } else if (newCount == 10 && availableTypes.size() == 2 && currentOrnateLevel >= 2) {
-                availableTypes.push_back(DOT_TILES);
-                cout << "Added DOT tiles (1.-9.) to available tile types!" << endl;
-            }
-
-            cout << "Tile count expanded to " << maxTiles << endl;
-            cout << "Available tile types: " << availableTypes.size() << endl;
-
-            // CRITICAL FIX: Expand existing hand instead of regenerating!
-            if (newCount > oldMaxTiles) {
-                int tilesToAdd = newCount - tiles.size();
-                cout << "EXPANDING HAND: Adding " << tilesToAdd << " new tiles to existing hand" << endl;
-
-                // Add new tiles to existing hand without resetting
-                for (int i = 0; i < tilesToAdd; i++) {
-                    Tile newTile = GenerateValidTile(0.0f); // No probability bonus for expansion
-                    tiles.push_back(newTile);
-
-                    // Update tile counts
-                    pair<int, TileType> tileKey = {newTile.value, newTile.type};
-                    tileCounts[tileKey]++;
-
-                    cout << "Added tile " << newTile.ToString() << " to hand" << endl;
-                }
-
-                // CRITICAL FIX: Always sort after adding new tiles
-                SortTiles();
-                cout << "Hand sorted after expansion!" << endl;
-            }
-
-            cout << "After expansion - tiles.size(): " << tiles.size() << endl;
-        } else {
-            cout << "Invalid tile count: " << newCount << " (must be 4-13)" << endl;
-        }
-    }
-
-    void RedrawCompleteHand(int newCount, int currentOrnateLevel = 0) {
-        cout << "🎴 COMPLETE HAND REDRAW! " << tiles.size() << " -> " << newCount << " tiles" << endl;
-
-        if (newCount >= 4 && newCount <= 13) {
-            maxTiles = newCount;
-
-            // Add new tile types based on ornate level (NOT tile count)
-            if (newCount == 7 && availableTypes.size() == 1 && currentOrnateLevel >= 1) {
-                availableTypes.push_back(HAT_TILES);
-                cout << "Added HAT tiles (1^-9^) to available tile types!" << endl;
-            } else if (newCount == 10 && availableTypes.size() == 2 && currentOrnateLevel >= 2) {
-                availableTypes.push_back(DOT_TILES);
-                cout << "Added DOT tiles (1.-9.) to available tile types!" << endl;
-            }
-
-            // COMPLETE REDRAW: Clear existing hand and generate new one
-            cout << "🎴 Clearing old hand and generating " << newCount << " fresh tiles..." << endl;
-
-            // Clear old hand and tile counts
-            tiles.clear();
-            tileCounts.clear();
-
-            // Reinitialize tile counts for all available types
-            for (TileType type : availableTypes) {
-                for (int i = 1; i <= 9; i++) {
-                    tileCounts[make_pair(i, type)] = 0;
-                }
-            }
-
-            // Generate completely new hand
-            for (int i = 0; i < newCount; i++) {
-                Tile newTile = GenerateValidTile(0.0f);
-                tiles.push_back(newTile);
-
-                // CRITICAL FIX: Update tile counts for the new hand
-                pair<int, TileType> tileKey = {newTile.value, newTile.type};
-                tileCounts[tileKey]++;
-
-                cout << "Generated fresh tile: " << newTile.ToString() << endl;
-            }
-
-            // Sort the new hand
-            SortTiles();
-            cout << "🎴 HAND COMPLETELY REDRAWN AND SORTED! New hand: ";
-            for (const Tile& tile : tiles) {
-                cout << tile.ToString() << " ";
-            }
-            cout << endl;
-        } else {
-            cout << "Invalid tile count: " << newCount << " (must be 4-13)" << endl;
-        }
-    }
-
-    bool CheckWinCondition(const Tile& newTile, int currentOrnateLevel = 0) {
-        vector<Tile> testTiles = tiles;
-        testTiles.push_back(newTile);
-        SortTilesVector(testTiles);
-
-        // Win condition check (debug output removed for release)
-
-        // Calculate required groups based on hand size
-        int handSize = testTiles.size();
-        int requiredGroups = 0;
-        if (handSize == 5) requiredGroups = 1; // 4 tiles: 1 group + 1 pair
-        else if (handSize == 8) requiredGroups = 2; // 7 tiles: 2 groups + 1 pair
-        else if (handSize == 11) requiredGroups = 3; // 10 tiles: 3 groups + 1 pair
-        else if (handSize == 14) requiredGroups = 4; // 13 tiles: 4 groups + 1 pair
-        else {
-            cout << "Invalid hand size: " << handSize << endl;
-            return false;
-        }
-
-        bool mahjongWin = HasRequiredGroupsAndPair(testTiles, requiredGroups);
-        bool loongWin = false;
-
-        // Check for LOONG (1-9 consecutive of same type) - only after level 4
-        if (currentOrnateLevel >= LEVEL_4_DRAGON) { // Level 4+ (ornateLevel is 0-based)
-            loongWin = HasLoongWin(testTiles);
-        }
-
-        if (mahjongWin) {
-            cout << "WIN: Found " << requiredGroups << " groups + 1 pair!" << endl;
-        }
-        if (loongWin) {
-            cout << "LOONG WIN: Found 1-9 consecutive of same type!" << endl;
-        }
-
-        return mahjongWin || loongWin;
-    }
-
-    void SortTilesVector(vector<Tile>& tilesToSort) {
-        sort(tilesToSort.begin(), tilesToSort.end(), [](const Tile& a, const Tile& b) {
-            if (a.type != b.type) return a.type < b.type;
-            return a.value < b.value;
-        });
-    }
-
-    bool CheckKongCondition(const Tile& newTile) {
-        // First check if we have 3 of this tile (same value and type) in current hand
-        int countInHand = 0;
-        for (const Tile& tile : tiles) {
-            if (tile == newTile) {
-                countInHand++;
-            }
-        }
-
-        // KONG only triggers if we have exactly 3 of this tile in hand + 1 new = 4 total
-        if (countInHand == 3) {
-            cout << "KONG: Found 3x" << newTile.ToString() << " in hand + 1 new = KONG!" << endl;
-
-            // SPECIAL CASE: Zero tiles can KONG multiple times (don't make them GOLD)
-            if (!newTile.IsZero()) {
-                // Make this tile type GOLD (remove from pool) - except for zeros
-                pair<int, TileType> tileKey = {newTile.value, newTile.type};
-                goldTiles.insert(tileKey);
-                cout << "Tile " << newTile.ToString() << " is now GOLD and removed from pool!" << endl;
-            } else {
-                cout << "Zero tile KONG! Zeros can KONG multiple times!" << endl;
-            }
-
-            // Mark all instances in hand as gold
-            for (Tile& tile : tiles) {
-                if (tile == newTile) {
-                    tile.isGold = true;
-                }
-            }
-
-            return true;
-        }
-        return false;
-    }
-
-    bool HasRequiredGroupsAndPair(vector<Tile>& sortedTiles, int requiredGroups) {
-        // Simple approach: count all possible groups and pairs, then check if we can form the required combination
-        map<pair<int, TileType>, int> tileCounts;
-        for (const Tile& tile : sortedTiles) {
-            tileCounts[{tile.value, tile.type}]++;
-        }
-
-        cout << "Checking for " << requiredGroups << " groups + 1 pair in hand of " << sortedTiles.size() << " tiles" << endl;
-
-        // Try all possible combinations of groups
-        return TryAllGroupCombinations(tileCounts, requiredGroups, sortedTiles.size());
-    }
-
-    bool TryAllGroupCombinations(map<pair<int, TileType>, int> tileCounts, int requiredGroups, int totalTiles) {
-        // Mahjong logic processing (debug output removed for release)
-
-        // Use recursive backtracking to try ALL possible combinations
-        return TryAllPossibleCombinations(tileCounts, requiredGroups, 0, vector<string>());
-    }
-
-    // ADVANCED RECURSIVE MAHJONG ALGORITHM - Handles ALL combinations!
-    bool TryAllPossibleCombinations(map<pair<int, TileType>, int> tileCounts, int requiredGroups, int groupsFound, vector<string> foundGroups) {
-        // Base case: if we have enough groups, check for exactly one pair
-        if (groupsFound >= requiredGroups) {
-            int remainingTiles = 0;
-            int pairsFound = 0;
-
-            for (auto& entry : tileCounts) {
-                if (entry.second > 0) {
-                    remainingTiles += entry.second;
-                    if (entry.second == 2) {
-                        pairsFound++;
-                    } else if (entry.second > 2) {
-                        // More than 2 tiles remaining means invalid
-                        return false;
-                    }
-                }
-            }
-
-            bool validMahjong = (pairsFound == 1 && remainingTiles == 2);
-
-            // Valid Mahjong found (debug output removed for release)
-
-            return validMahjong;
-        }
-
-        // Try to form triplets
-        for (auto& entry : tileCounts) {
-            if (entry.second >= 3) {
-                // Make a copy and try this triplet
-                map<pair<int, TileType>, int> newCounts = tileCounts;
-                newCounts[entry.first] -= 3;
-
-                vector<string> newGroups = foundGroups;
-                string tripletName = "Triplet " + to_string(entry.first.first);
-                if (entry.first.second == HAT_TILES) tripletName += "^";
-                else if (entry.first.second == DOT_TILES) tripletName += ".";
-                newGroups.push_back(tripletName);
-
-                if (TryAllPossibleCombinations(newCounts, requiredGroups, groupsFound + 1, newGroups)) {
-                    return true;
-                }
-            }
-        }
-
-        // Try to form consecutives
-        for (TileType type : {PLAIN_TILES, HAT_TILES, DOT_TILES}) {
-            for (int start = 1; start <= 7; start++) { // 1-2-3 to 7-8-9
-                pair<int, TileType> tile1 = {start, type};
-                pair<int, TileType> tile2 = {start + 1, type};
-                pair<int, TileType> tile3 = {start + 2, type};
-
-                if (tileCounts[tile1] > 0 && tileCounts[tile2] > 0 && tileCounts[tile3] > 0) {
-                    // Make a copy and try this consecutive
-                    map<pair<int, TileType>, int> newCounts = tileCounts;
-                    newCounts[tile1]--;
-                    newCounts[tile2]--;
-                    newCounts[tile3]--;
-
-                    vector<string> newGroups = foundGroups;
-                    string consecutiveName = "Consecutive " + to_string(start) + "-" + to_string(start+1) + "-" + to_string(start+2);
-                    if (type == HAT_TILES) consecutiveName += "^";
-                    else if (type == DOT_TILES) consecutiveName += ".";
-                    newGroups.push_back(consecutiveName);
-
-                    if (TryAllPossibleCombinations(newCounts, requiredGroups, groupsFound + 1, newGroups)) {
-                        return true;
-                    }
-                }
-            }
-        }
-
-        return false; // No valid combination found
-    }
-
-    // Test function for Mahjong logic - can be called for debugging
-    void TestMahjongLogic() {
-        cout << "\n=== TESTING MAHJONG LOGIC ===" << endl;
-
-        // Test case 1: 4-4-5-6-7 (pair + consecutive)
-        map<pair<int, TileType>, int> testCase1;
-        testCase1[{4, PLAIN_TILES}] = 2; // Pair of 4s
-        testCase1[{5, PLAIN_TILES}] = 1;
-        testCase1[{6, PLAIN_TILES}] = 1;
-        testCase1[{7, PLAIN_TILES}] = 1;
-
-        cout << "Test 1 - 4-4-5-6-7: ";
-        bool result1 = TryAllGroupCombinations(testCase1, 1, 5);
-        cout << (result1 ? "PASS" : "FAIL") << endl;
-
-        // Test case 2: 1-1-1-2-3 (triplet + consecutive)
-        map<pair<int, TileType>, int> testCase2;
-        testCase2[{1, PLAIN_TILES}] = 3; // Triplet of 1s
-        testCase2[{2, PLAIN_TILES}] = 1;
-        testCase2[{3, PLAIN_TILES}] = 1;
-
-        cout << "Test 2 - 1-1-1-2-3: ";
-        bool result2 = TryAllGroupCombinations(testCase2, 1, 5);
-        cout << (result2 ? "FAIL (should be invalid)" : "PASS") << endl;
-
-        // Test case 3: 1-1-1-2-2 (triplet + pair)
-        map<pair<int, TileType>, int> testCase3;
-        testCase3[{1, PLAIN_TILES}] = 3; // Triplet of 1s
-        testCase3[{2, PLAIN_TILES}] = 2; // Pair of 2s
-
-        cout << "Test 3 - 1-1-1-2-2: ";
-        bool result3 = TryAllGroupCombinations(testCase3, 1, 5);
-        cout << (result3 ? "PASS" : "FAIL") << endl;
-
-        cout << "=== MAHJONG LOGIC TESTS COMPLETE ===" << endl;
-    }
-
-
-
-    bool HasLoongWin(vector<Tile>& sortedTiles) {
-        // Check for LOONG: 1-9 consecutive tiles of the SAME type
-        map<TileType, set<int>> typeValues;
-        for (const Tile& tile : sortedTiles) {
-            typeValues[tile.type].insert(tile.value);
-        }
-
-        // Check each type for 1-9 consecutive
-        for (auto& typeGroup : typeValues) {
-            set<int>& values = typeGroup.second;
-            if (values.size() == 9) {
-                // Check if we have exactly 1,2,3,4,5,6,7,8,9
-                bool isConsecutive = true;
-                for (int i = 1; i <= 9; i++) {
-                    if (values.count(i) == 0) {
-                        isConsecutive = false;
-                        break;
-                    }
-                }
-                if (isConsecutive) {
-                    // LOONG WIN found (debug output removed for release)
-                    return true;
-                }
-            }
-        }
-        return false;
-    }
-
-    void AddToDiscardPile(const Tile& tile) {
-        // Add to discard pile
-        discardPile.push_back(tile);
-
-        // Update total discard counts
-        pair<int, TileType> tileKey = {tile.value, tile.type};
-        totalDiscardCounts[tileKey]++;
-
-        // Enable reshuffle if we have discarded tiles
-        canReshuffle = true;
-
-        // Tile added to discard pile (debug output removed for release)
-    }
-
-    void ReshuffleTiles() {
-        if (!canReshuffle) {
-            // No reshuffle available (debug output removed for release)
-            return;
-        }
-
-        // Reshuffling tiles (debug output removed for release)
-
-        // Reset tile counts to 0, but respect current hand and KONG tiles
-        for (int i = 1; i <= 9; i++) {
-            for (TileType type : {PLAIN_TILES, HAT_TILES, DOT_TILES}) {
-                pair<int, TileType> tileKey = {i, type};
-                tileCounts[tileKey] = 0;
-
-                // Count tiles in current hand
-                for (const Tile& tile : tiles) {
-                    if (tile.value == i && tile.type == type) {
-                        tileCounts[tileKey]++;
-                    }
-                }
-
-                // KONG tiles count as 4 (max)
-                if (goldTiles.count(tileKey) > 0) {
-                    tileCounts[tileKey] = 4; // Max out KONG tiles
-                }
-            }
-        }
-
-        // Clear discard pile and reset counts
-        discardPile.clear();
-        for (auto& entry : totalDiscardCounts) {
-            entry.second = 0;
-        }
-
-        canReshuffle = false;
-        // Tile pool reset (debug output removed for release)
-    }
-
-    vector<Tile> GetSortedDiscardPile() {
-        vector<Tile> sorted = discardPile;
-        sort(sorted.begin(), sorted.end(), [](const Tile& a, const Tile& b) {
-            if (a.type != b.type) return a.type < b.type;
-            return a.value < b.value;
-        });
-        return sorted;
-    }
+        // Thick border color based on tile type
+        Color borderColor = WHITE;
+        if (popup.tile.type == HAT_TILES) borderColor = LIGHTBLUE;
+        else if (popup.tile.type == DOT_TILES) borderColor = LIGHTGREEN;
 
-    vector<pair<pair<int, TileType>, int>> GetRemainingTiles() {
-        vector<pair<pair<int, TileType>, int>> remaining;
+        DrawRectangleLinesEx(tileRect, 6, borderColor); // Extra thick border
 
-        for (TileType type : availableTypes) {
-            for (int value = 1; value <= 9; value++) {
-                pair<int, TileType> tileKey = {value, type};
+        // Draw "PICKED UP:" label above
+        DrawText("PICKED UP:", position.x - 45, position.y - 55, 16, YELLOW);
 
-                // Calculate remaining count: 4 - current usage
-                int currentCount = tileCounts[tileKey];
-                int remainingCount = 4 - currentCount;
+        // Draw tile content with type indicator
+        string tileText = to_string(popup.tile.value);
+        if (popup.tile.type == HAT_TILES) tileText += "^";
+        else if (popup.tile.type == DOT_TILES) tileText += ".";
 
-                // KONG tiles are maxed out (0 remaining)
-                if (goldTiles.count(tileKey) > 0) {
-                    remainingCount = 0;
-                }
+        // Large text with type-specific color
+        Color textColor = WHITE;
+        if (popup.tile.type == HAT_TILES) textColor = LIGHTBLUE;
+        else if (popup.tile.type == DOT_TILES) textColor = LIGHTGREEN;
 
-                if (remainingCount > 0) {
-                    remaining.push_back({tileKey, remainingCount});
-                }
-            }
-        }
+        int textWidth = MeasureText(tileText.c_str(), 36);
+        DrawText(tileText.c_str(), position.x - textWidth/2, position.y - 18, 36, textColor);
 
-        return remaining;
+        // Add pulsing effect for extra visibility
+        float pulseAlpha = (sin(popup.timer * 8) + 1) * 0.3f + 0.4f; // Pulse between 0.4 and 1.0
+        Color pulseColor = borderColor;
+        pulseColor.a = (unsigned char)(255 * pulseAlpha);
+        DrawRectangleLinesEx(tileRect, 8, pulseColor); // Outer pulsing border
     }
-
-private:
-};
-
-bool ElementInDeque(Vector2 element, deque<Vector2> deque)
-{
-    for (unsigned int i = 0; i < deque.size(); i++)
-    {
-        if (Vector2Equals(deque[i], element))
-        {
-            return true;
-        }
-    }
-    return false;
 }
 
-bool EventTriggered(double interval)
+// Snake drawing and steering - Snake itself lives in the core
+// One segment: i counts from the head
+void DrawSnakeSegment(const Snake& snake, unsigned int i, BodyCell cell, Color bodyColor, Color scaleColor)
 {
-    double currentTime = GetTime();
-    if (currentTime - lastUpdateTime >= interval)
-    {
-        lastUpdateTime = currentTime;
-        return true;
+    float x = cell.x;
+    float y = cell.y;
+    float centerX = gameAreaOffset + x * cellSize + cellSize / 2;
+    float centerY = gameAreaOffset + y * cellSize + cellSize / 2;
+
+    if (i == 0) {
+        // DRAGON HEAD - Triangle with mustache for authentic LOONG look!
+        // Use dragon-specific colors for head (brighter than body)
+        Color headColor = bodyColor;
+        headColor.r = min(255, headColor.r + 50); // Make head brighter than body
+        headColor.g = min(255, headColor.g + 50);
+        headColor.b = min(255, headColor.b + 50);
+        Color accentColor = scaleColor; // Use scale color for accents
+
+        // Main triangular head pointing in movement direction
+        Vector2 tip, left, right;
+        float headSize = cellSize * 0.4f;
+
+        // FIXED: Ensure proper triangle winding for all directions
+        if (snake.direction.x == 1) { // Moving right
+            tip = {centerX + headSize, centerY};
+            left = {centerX - headSize/2, centerY - headSize};
+            right = {centerX - headSize/2, centerY + headSize};
+        } else if (snake.direction.x == -1) { // Moving left
+            tip = {centerX - headSize, centerY};
+            left = {centerX + headSize/2, centerY + headSize}; // FIXED: Swapped order
+            right = {centerX + headSize/2, centerY - headSize};
+        } else if (snake.direction.y == 1) { // Moving down
+            tip = {centerX, centerY + headSize};
+            left = {centerX + headSize, centerY - headSize/2}; // FIXED: Swapped order
+            right = {centerX - headSize, centerY - headSize/2};
+        } else { // Moving up
+            tip = {centerX, centerY - headSize};
+            left = {centerX - headSize, centerY + headSize/2};
+            right = {centerX + headSize, centerY + headSize/2};
+        }
+
+        // Draw dragon head triangle with consistent color
+        DrawTriangle(tip, left, right, headColor);
+        DrawTriangleLines(tip, left, right, BLACK);
+
+        // Dragon eyes (small black circles)
+        float eyeOffset = headSize * 0.3f;
+        if (snake.direction.x != 0) {
+            DrawCircle(centerX - snake.direction.x * eyeOffset/2, centerY - eyeOffset/2, 3, BLACK);
+            DrawCircle(centerX - snake.direction.x * eyeOffset/2, centerY + eyeOffset/2, 3, BLACK);
+        } else {
+            DrawCircle(centerX - eyeOffset/2, centerY - snake.direction.y * eyeOffset/2, 3, BLACK);
+            DrawCircle(centerX + eyeOffset/2, centerY - snake.direction.y * eyeOffset/2, 3, BLACK);
+        }
+
+        // Dragon mustache/whiskers (accent color lines)
+        float whiskerLength = headSize * 0.8f;
+        if (snake.direction.x == 1) { // Right
+            DrawLineEx({centerX - headSize/3, centerY - headSize/2}, {centerX - headSize/3 - whiskerLength, centerY - headSize}, 2, accentColor);
+            DrawLineEx({centerX - headSize/3, centerY + headSize/2}, {centerX - headSize/3 - whiskerLength, centerY + headSize}, 2, accentColor);
+        } else if (snake.direction.x == -1) { // Left
+            DrawLineEx({centerX + headSize/3, centerY - headSize/2}, {centerX + headSize/3 + whiskerLength, centerY - headSize}, 2, accentColor);
+            DrawLineEx({centerX + headSize/3, centerY + headSize/2}, {centerX + headSize/3 + whiskerLength, centerY + headSize}, 2, accentColor);
+        } else if (snake.direction.y == 1) { // Down
+            DrawLineEx({centerX - headSize/2, centerY - headSize/3}, {centerX - headSize, centerY - headSize/3 - whiskerLength}, 2, accentColor);
+            DrawLineEx({centerX + headSize/2, centerY - headSize/3}, {centerX + headSize, centerY - headSize/3 - whiskerLength}, 2, accentColor);
+        } else { // Up
+            DrawLineEx({centerX - headSize/2, centerY + headSize/3}, {centerX - headSize, centerY + headSize/3 + whiskerLength}, 2, accentColor);
+            DrawLineEx({centerX + headSize/2, centerY + headSize/3}, {centerX + headSize, centerY + headSize/3 + whiskerLength}, 2, accentColor);
+        }
+
+    } else if (i == 1 || i % 5 == 0) { // Dragon arms behind head and every 5th segment
+        // DRAGON BODY WITH ARMS - Slimmer, more serpentine with dragon-specific colors
+        float bodyWidth = cellSize * 0.6f; // Slimmer than head
+        float bodyHeight = cellSize * 0.6f;
+        Rectangle bodyRect = {centerX - bodyWidth/2, centerY - bodyHeight/2, bodyWidth, bodyHeight};
+
+        // Draw main body
+        DrawRectangleRounded(bodyRect, 0.8, 6, bodyColor);
+        DrawRectangleRoundedLinesEx(bodyRect, 0.8, 6, 2.0f, BLACK);
+
+        // DRAGON ARMS WITH CLAWS - Extending from sides
+        float armLength = cellSize * 0.4f;
+        float armWidth = 3.0f;
+        Color armColor = scaleColor;
+        Color clawColor = {255, 215, 0, 255}; // Golden claws
+
+        // Left arm
+        Vector2 leftArmStart = {centerX - bodyWidth/2, centerY};
+        Vector2 leftArmEnd = {centerX - bodyWidth/2 - armLength, centerY - armLength/2};
+        DrawLineEx(leftArmStart, leftArmEnd, armWidth, armColor);
+
+        // Left claws (3 small lines)
+        float clawLength = cellSize * 0.15f;
+        DrawLineEx(leftArmEnd, {leftArmEnd.x - clawLength, leftArmEnd.y - clawLength/2}, 2, clawColor);
+        DrawLineEx(leftArmEnd, {leftArmEnd.x - clawLength, leftArmEnd.y}, 2, clawColor);
+        DrawLineEx(leftArmEnd, {leftArmEnd.x - clawLength, leftArmEnd.y + clawLength/2}, 2, clawColor);
+
+        // Right arm
+        Vector2 rightArmStart = {centerX + bodyWidth/2, centerY};
+        Vector2 rightArmEnd = {centerX + bodyWidth/2 + armLength, centerY - armLength/2};
+        DrawLineEx(rightArmStart, rightArmEnd, armWidth, armColor);
+
+        // Right claws (3 small lines)
+        DrawLineEx(rightArmEnd, {rightArmEnd.x + clawLength, rightArmEnd.y - clawLength/2}, 2, clawColor);
+        DrawLineEx(rightArmEnd, {rightArmEnd.x + clawLength, rightArmEnd.y}, 2, clawColor);
+        DrawLineEx(rightArmEnd, {rightArmEnd.x + clawLength, rightArmEnd.y + clawLength/2}, 2, clawColor);
+
+        // Dragon scales (small decorative lines) with dragon-specific color
+        if (i % 2 == 0) { // Every other segment
+            DrawLineEx({centerX - bodyWidth/4, centerY}, {centerX + bodyWidth/4, centerY}, 1, scaleColor);
+        }
+    } else {
+        // REGULAR DRAGON BODY - Slimmer, more serpentine with dragon-specific colors
+        float bodyWidth = cellSize * 0.6f; // Slimmer than head
+        float bodyHeight = cellSize * 0.6f;
+        Rectangle bodyRect = {centerX - bodyWidth/2, centerY - bodyHeight/2, bodyWidth, bodyHeight};
+
+        DrawRectangleRounded(bodyRect, 0.8, 6, bodyColor);
+        DrawRectangleRoundedLinesEx(bodyRect, 0.8, 6, 2.0f, BLACK);
+
+        // Dragon scales (small decorative lines) with dragon-specific color
+        if (i % 2 == 0) { // Every other segment
+            DrawLineEx({centerX - bodyWidth/4, centerY}, {centerX + bodyWidth/4, centerY}, 1, scaleColor);
+        }
     }
-    return false;
 }
 
-class Snake
+void DrawSnake(const Snake& snake, Color bodyColor = {34, 139, 34, 255}, Color scaleColor = {144, 238, 144, 255})
 {
-public:
-    deque<Vector2> body = {Vector2{10, 10}, Vector2{9, 10}, Vector2{8, 10}, Vector2{7, 10}};
-    Vector2 direction = {1, 0};
-    bool addSegment = false;
-    int segmentsToAdd = 0;
-
-    void Draw(Color bodyColor = {34, 139, 34, 255}, Color scaleColor = {144, 238, 144, 255})
-    {
-        for (unsigned int i = 0; i < body.size(); i++)
-        {
-            float x = body[i].x;
-            float y = body[i].y;
-            float centerX = gameAreaOffset + x * cellSize + cellSize / 2;
-            float centerY = gameAreaOffset + y * cellSize + cellSize / 2;
-
-            if (i == 0) {
-                // DRAGON HEAD - Triangle with mustache for authentic LOONG look!
-                // Use dragon-specific colors for head (brighter than body)
-                Color headColor = bodyColor;
-                headColor.r = min(255, headColor.r + 50); // Make head brighter than body
-                headColor.g = min(255, headColor.g + 50);
-                headColor.b = min(255, headColor.b + 50);
-                Color accentColor = scaleColor; // Use scale color for accents
-
-                // Main triangular head pointing in movement direction
-                Vector2 tip, left, right;
-                float headSize = cellSize * 0.4f;
-
-                // FIXED: Ensure proper triangle winding for all directions
-                if (direction.x == 1) { // Moving right
-                    tip = {centerX + headSize, centerY};
-                    left = {centerX - headSize/2, centerY - headSize};
-                    right = {centerX - headSize/2, centerY + headSize};
-                } else if (direction.x == -1) { // Moving left
-                    tip = {centerX - headSize, centerY};
-                    left = {centerX + headSize/2, centerY + headSize}; // FIXED: Swapped order
-                    right = {centerX + headSize/2, centerY - headSize};
-                } else if (direction.y == 1) { // Moving down
-                    tip = {centerX, centerY + headSize};
-                    left = {centerX + headSize, centerY - headSize/2}; // FIXED: Swapped order
-                    right = {centerX - headSize, centerY - headSize/2};
-                } else { // Moving up
-                    tip = {centerX, centerY - headSize};
-                    left = {centerX - headSize, centerY + headSize/2};
-                    right = {centerX + headSize, centerY + headSize/2};
-                }
-
-                // Draw dragon head triangle with consistent color
-                DrawTriangle(tip, left, right, headColor);
-                DrawTriangleLines(tip, left, right, BLACK);
-
-                // Dragon eyes (small black circles)
-                float eyeOffset = headSize * 0.3f;
-                if (direction.x != 0) {
-                    DrawCircle(centerX - direction.x * eyeOffset/2, centerY - eyeOffset/2, 3, BLACK);
-                    DrawCircle(centerX - direction.x * eyeOffset/2, centerY + eyeOffset/2, 3, BLACK);
-                } else {
-                    DrawCircle(centerX - eyeOffset/2, centerY - direction.y * eyeOffset/2, 3, BLACK);
-                    DrawCircle(centerX + eyeOffset/2, centerY - direction.y * eyeOffset/2, 3, BLACK);
-                }
-
-                // Dragon mustache/whiskers (accent color lines)
-                float whiskerLength = headSize * 0.8f;
-                if (direction.x == 1) { // Right
-                    DrawLineEx({centerX - headSize/3, centerY - headSize/2}, {centerX - headSize/3 - whiskerLength, centerY - headSize}, 2, accentColor);
-                    DrawLineEx({centerX - headSize/3, centerY + headSize/2}, {centerX - headSize/3 - whiskerLength, centerY + headSize}, 2, accentColor);
-                } else if (direction.x == -1) { // Left
-                    DrawLineEx({centerX + headSize/3, centerY - headSize/2}, {centerX + headSize/3 + whiskerLength, centerY - headSize}, 2, accentColor);
-                    DrawLineEx({centerX + headSize/3, centerY + headSize/2}, {centerX + headSize/3 + whiskerLength, centerY + headSize}, 2, accentColor);
-                } else if (direction.y == 1) { // Down
-                    DrawLineEx({centerX - headSize/2, centerY - headSize/3}, {centerX - headSize, centerY - headSize/3 - whiskerLength}, 2, accentColor);
-                    DrawLineEx({centerX + headSize/2, centerY - headSize/3}, {centerX + headSize, centerY - headSize/3 - whiskerLength}, 2, accentColor);
-                } else { // Up
-                    DrawLineEx({centerX - headSize/2, centerY + headSize/3}, {centerX - headSize, centerY + headSize/3 + whiskerLength}, 2, accentColor);
-                    DrawLineEx({centerX + headSize/2, centerY + headSize/3}, {centerX + headSize, centerY + headSize/3 + whiskerLength}, 2, accentColor);
-                }
-
-            } else if (i == 1 || i % 5 == 0) { // Dragon arms behind head and every 5th segment
-                // DRAGON BODY WITH ARMS - Slimmer, more serpentine with dragon-specific colors
-                float bodyWidth = cellSize * 0.6f; // Slimmer than head
-                float bodyHeight = cellSize * 0.6f;
-                Rectangle bodyRect = {centerX - bodyWidth/2, centerY - bodyHeight/2, bodyWidth, bodyHeight};
-
-                // Draw main body
-                DrawRectangleRounded(bodyRect, 0.8, 6, bodyColor);
-                DrawRectangleRoundedLinesEx(bodyRect, 0.8, 6, 2.0f, BLACK);
-
-                // DRAGON ARMS WITH CLAWS - Extending from sides
-                float armLength = cellSize * 0.4f;
-                float armWidth = 3.0f;
-                Color armColor = scaleColor;
-                Color clawColor = {255, 215, 0, 255}; // Golden claws
-
-                // Left arm
-                Vector2 leftArmStart = {centerX - bodyWidth/2, centerY};
-                Vector2 leftArmEnd = {centerX - bodyWidth/2 - armLength, centerY - armLength/2};
-                DrawLineEx(leftArmStart, leftArmEnd, armWidth, armColor);
-
-                // Left claws (3 small lines)
-                float clawLength = cellSize * 0.15f;
-                DrawLineEx(leftArmEnd, {leftArmEnd.x - clawLength, leftArmEnd.y - clawLength/2}, 2, clawColor);
-                DrawLineEx(leftArmEnd, {leftArmEnd.x - clawLength, leftArmEnd.y}, 2, clawColor);
-                DrawLineEx(leftArmEnd, {leftArmEnd.x - clawLength, leftArmEnd.y + clawLength/2}, 2, clawColor);
-
-                // Right arm
-                Vector2 rightArmStart = {centerX + bodyWidth/2, centerY};
-                Vector2 rightArmEnd = {centerX + bodyWidth/2 + armLength, centerY - armLength/2};
-                DrawLineEx(rightArmStart, rightArmEnd, armWidth, armColor);
-
-                // Right claws (3 small lines)
-                DrawLineEx(rightArmEnd, {rightArmEnd.x + clawLength, rightArmEnd.y - clawLength/2}, 2, clawColor);
-                DrawLineEx(rightArmEnd, {rightArmEnd.x + clawLength, rightArmEnd.y}, 2, clawColor);
-                DrawLineEx(rightArmEnd, {rightArmEnd.x + clawLength, rightArmEnd.y + clawLength/2}, 2, clawColor);
-
-                // Dragon scales (small decorative lines) with dragon-specific color
-                if (i % 2 == 0) { // Every other segment
-                    DrawLineEx({centerX - bodyWidth/4, centerY}, {centerX + bodyWidth/4, centerY}, 1, scaleColor);
-                }
-            } else {
-                // REGULAR DRAGON BODY - Slimmer, more serpentine with dragon-specific colors
-                float bodyWidth = cellSize * 0.6f; // Slimmer than head
-                float bodyHeight = cellSize * 0.6f;
-                Rectangle bodyRect = {centerX - bodyWidth/2, centerY - bodyHeight/2, bodyWidth, bodyHeight};
-
-                DrawRectangleRounded(bodyRect, 0.8, 6, bodyColor);
-                DrawRectangleRoundedLinesEx(bodyRect, 0.8, 6, 2.0f, BLACK);
-
-                // Dragon scales (small decorative lines) with dragon-specific color
-                if (i % 2 == 0) { // Every other segment
-                    DrawLineEx({centerX - bodyWidth/4, centerY}, {centerX + bodyWidth/4, centerY}, 1, scaleColor);
-                }
-            }
-        }
-    }
-
-    void Update()
+    unsigned int i = 0;
+    for (const BodyRun& run : snake.body.Runs())
     {
-        if (direction.x == 0 && direction.y == 0) return; // Hard stop: don't move or shrink
-
-        body.push_front(Vector2Add(body[0], direction));
-        if (addSegment == true)
-        {
-            addSegment = false;
-        }
-        else if (segmentsToAdd > 0)
-        {
-            segmentsToAdd--;
-        }
-        else
+        for (const BodyCell* cell = run.first; cell != run.last; cell++)
         {
-            body.pop_back();
+            DrawSnakeSegment(snake, i++, *cell, bodyColor, scaleColor);
         }
     }
+}
 
-    void AddSegments(int count)
-    {
-        segmentsToAdd += count;
-    }
-
-    void UpdateDirectionFromMouse(Vector2 mousePos)
-    {
-        // Get snake head position in screen coordinates
-        Vector2 headScreenPos = {
-            gameAreaOffset + body[0].x * cellSize + cellSize / 2,
-            gameAreaOffset + body[0].y * cellSize + cellSize / 2
-        };
-
-        // Calculate direction vector from head to mouse
-        Vector2 directionVector = Vector2Subtract(mousePos, headScreenPos);
-
-        // Normalize to get the primary direction
-        Vector2 newDirection = {0, 0};
-
-        if (abs(directionVector.x) > abs(directionVector.y))
-        {
-            // Horizontal movement is dominant
-            newDirection.x = (directionVector.x > 0) ? 1 : -1;
-            newDirection.y = 0;
-        }
-        else
-        {
-            // Vertical movement is dominant
-            newDirection.x = 0;
-            newDirection.y = (directionVector.y > 0) ? 1 : -1;
-        }
-
-        // Prevent 180-degree turns
-        if (!(newDirection.x == -direction.x && newDirection.y == -direction.y))
-        {
-            direction = newDirection;
-        }
-    }
-
-    void UpdateDirectionFromGamepad(int gamepad)
-    {
-        Vector2 newDirection = {0, 0};
-        float stickX = GetGamepadAxisMovement(gamepad, GAMEPAD_AXIS_LEFT_X);
-        float stickY = GetGamepadAxisMovement(gamepad, GAMEPAD_AXIS_LEFT_Y);
-        float threshold = 0.5f;
-
-        if (IsGamepadButtonPressed(gamepad, GAMEPAD_BUTTON_LEFT_FACE_UP)) newDirection = {0, -1};
-        else if (IsGamepadButtonPressed(gamepad, GAMEPAD_BUTTON_LEFT_FACE_DOWN)) newDirection = {0, 1};
-        else if (IsGamepadButtonPressed(gamepad, GAMEPAD_BUTTON_LEFT_FACE_LEFT)) newDirection = {-1, 0};
-        else if (IsGamepadButtonPressed(gamepad, GAMEPAD_BUTTON_LEFT_FACE_RIGHT)) newDirection = {1, 0};
-        else if (abs(stickX) > threshold || abs(stickY) > threshold) {
-            if (abs(stickX) > abs(stickY)) {
-                newDirection.x = (stickX > 0) ? 1 : -1;
-            } else {
-                newDirection.y = (stickY > 0) ? 1 : -1;
-            }
-        }
-
-        if ((newDirection.x != 0 || newDirection.y != 0) && 
-            !(newDirection.x == -direction.x && newDirection.y == -direction.y))
-        {
-            direction = newDirection;
-        }
-    }
-
-    void Reset()
-    {
-        body = {Vector2{10, 10}, Vector2{9, 10}, Vector2{8, 10}, Vector2{7, 10}};
-        direction = {1, 0};
-        segmentsToAdd = 0;
-    }
-};
-
-class Food
+void UpdateDirectionFromMouse(Snake& snake, Vector2 mousePos)
 {
+    // Get snake head position in screen coordinates
+    Vector2 head = snake.body.front();
+    Vector2 headScreenPos = {
+        gameAreaOffset + head.x * cellSize + cellSize / 2,
+        gameAreaOffset + head.y * cellSize + cellSize / 2
+    };
 
-public:
-    Vector2 position;
-    Texture2D texture;
+    // Calculate direction vector from head to mouse
+    Vector2 directionVector = Vector2Subtract(mousePos, headScreenPos);
 
-    Food(deque<Vector2> snakeBody)
+    // Normalize to get the primary direction
+    Vector2 newDirection = {0, 0};
+
+    if (abs(directionVector.x) > abs(directionVector.y))
     {
-        Image image = LoadImage("Graphics/food.png");
-        texture = LoadTextureFromImage(image);
-        UnloadImage(image);
-        position = GenerateRandomPos(snakeBody);
+        // Horizontal movement is dominant
+        newDirection.x = (directionVector.x > 0) ? 1 : -1;
+        newDirection.y = 0;
     }
-
-    ~Food()
+    else
     {
-        UnloadTexture(texture);
+        // Vertical movement is dominant
+        newDirection.x = 0;
+        newDirection.y = (directionVector.y > 0) ? 1 : -1;
     }
 
-    void Draw(const Tile& nextTile = Tile(1, PLAIN_TILES))
+    // Prevent 180-degree turns
+    if (!(newDirection.x == -snake.direction.x && newDirection.y == -snake.direction.y))
     {
-        // MAHJONG TILE - Authentic Chinese game piece with correct type and color!
-        float centerX = gameAreaOffset + position.x * cellSize + cellSize / 2;
-        float centerY = gameAreaOffset + position.y * cellSize + cellSize / 2;
-        float tileWidth = cellSize * 0.7f;
-        float tileHeight = cellSize * 0.9f;
-
-        // Mahjong tile colors - ivory white with type-specific border
-        Color tileColor = {255, 255, 240, 255}; // Ivory white
-        Color borderColor = {139, 69, 19, 255}; // Default saddle brown border
-        Color shadowColor = {0, 0, 0, 100}; // Semi-transparent shadow
-        Color symbolColor = {220, 20, 60, 255}; // Default crimson for symbols
-
-        // Set colors based on tile type
-        if (nextTile.type == HAT_TILES) {
-            borderColor = {100, 200, 255, 255}; // Bright blue border for hat tiles
-            symbolColor = {0, 100, 255, 255}; // Blue text for hat tiles
-        } else if (nextTile.type == DOT_TILES) {
-            borderColor = {100, 255, 100, 255}; // Bright green border for dot tiles
-            symbolColor = {0, 150, 0, 255}; // Green text for dot tiles
-        }
-
-        // Draw shadow first (offset slightly)
-        Rectangle shadowRect = {centerX - tileWidth/2 + 3, centerY - tileHeight/2 + 3, tileWidth, tileHeight};
-        DrawRectangleRounded(shadowRect, 0.1, 6, shadowColor);
-
-        // Draw main tile body
-        Rectangle tileRect = {centerX - tileWidth/2, centerY - tileHeight/2, tileWidth, tileHeight};
-        DrawRectangleRounded(tileRect, 0.1, 6, tileColor);
-        DrawRectangleRoundedLinesEx(tileRect, 0.1, 6, 3.0f, borderColor); // Thicker border for type visibility
-
-        // Draw Mahjong symbol with type indicator
-        string tileText = to_string(nextTile.value);
-        if (nextTile.type == HAT_TILES) {
-            tileText += "^"; // Hat symbol
-        } else if (nextTile.type == DOT_TILES) {
-            tileText += "."; // Dot symbol
-        }
-
-        // Calculate text position for centering
-        int fontSize = (int)(tileWidth * 0.5f);
-        Vector2 textSize = MeasureTextEx(GetFontDefault(), tileText.c_str(), fontSize, 1);
-        float textX = centerX - textSize.x / 2;
-        float textY = centerY - textSize.y / 2;
-
-        // Draw the number with type symbol and shadow effect
-        DrawTextEx(GetFontDefault(), tileText.c_str(), {textX + 1, textY + 1}, fontSize, 1, {0, 0, 0, 100}); // Shadow
-        DrawTextEx(GetFontDefault(), tileText.c_str(), {textX, textY}, fontSize, 1, symbolColor); // Main text
-
-        // Draw decorative elements based on tile type
-        float dotRadius = 2.0f;
-        if (nextTile.type == HAT_TILES) {
-            // Blue dots for hat tiles
-            Color dotColor = {0, 100, 255, 255};
-            DrawCircle(centerX - tileWidth/3, centerY - tileHeight/3, dotRadius, dotColor);
-            DrawCircle(centerX + tileWidth/3, centerY - tileHeight/3, dotRadius, dotColor);
-            DrawCircle(centerX - tileWidth/3, centerY + tileHeight/3, dotRadius, dotColor);
-            DrawCircle(centerX + tileWidth/3, centerY + tileHeight/3, dotRadius, dotColor);
-        } else if (nextTile.type == DOT_TILES) {
-            // Green dots for dot tiles
-            Color dotColor = {0, 150, 0, 255};
-            DrawCircle(centerX - tileWidth/3, centerY - tileHeight/3, dotRadius, dotColor);
-            DrawCircle(centerX + tileWidth/3, centerY - tileHeight/3, dotRadius, dotColor);
-            DrawCircle(centerX - tileWidth/3, centerY + tileHeight/3, dotRadius, dotColor);
-            DrawCircle(centerX + tileWidth/3, centerY + tileHeight/3, dotRadius, dotColor);
+        snake.direction = newDirection;
+    }
+}
+
+void UpdateDirectionFromGamepad(Snake& snake, int gamepad)
+{
+    Vector2 newDirection = {0, 0};
+    float stickX = GetGamepadAxisMovement(gamepad, GAMEPAD_AXIS_LEFT_X);
+    float stickY = GetGamepadAxisMovement(gamepad, GAMEPAD_AXIS_LEFT_Y);
+    float threshold = 0.5f;
+
+    if (IsGamepadButtonPressed(gamepad, GAMEPAD_BUTTON_LEFT_FACE_UP)) newDirection = {0, -1};
+    else if (IsGamepadButtonPressed(gamepad, GAMEPAD_BUTTON_LEFT_FACE_DOWN)) newDirection = {0, 1};
+    else if (IsGamepadButtonPressed(gamepad, GAMEPAD_BUTTON_LEFT_FACE_LEFT)) newDirection = {-1, 0};
+    else if (IsGamepadButtonPressed(gamepad, GAMEPAD_BUTTON_LEFT_FACE_RIGHT)) newDirection = {1, 0};
+    else if (abs(stickX) > threshold || abs(stickY) > threshold) {
+        if (abs(stickX) > abs(stickY)) {
+            newDirection.x = (stickX > 0) ? 1 : -1;
         } else {
-            // Traditional green dots for plain tiles
-            Color dotColor = {34, 139, 34, 255};
-            DrawCircle(centerX - tileWidth/3, centerY - tileHeight/3, dotRadius, dotColor);
-            DrawCircle(centerX + tileWidth/3, centerY - tileHeight/3, dotRadius, dotColor);
-            DrawCircle(centerX - tileWidth/3, centerY + tileHeight/3, dotRadius, dotColor);
-            DrawCircle(centerX + tileWidth/3, centerY + tileHeight/3, dotRadius, dotColor);
+            newDirection.y = (stickY > 0) ? 1 : -1;
         }
     }
 
-    Vector2 GenerateRandomCell()
+    if ((newDirection.x != 0 || newDirection.y != 0) && 
+        !(newDirection.x == -snake.direction.x && newDirection.y == -snake.direction.y))
     {
-        // Avoid borders (2 cells from edge) for better gameplay
-        float x = GetRandomValue(2, cellCount - 3);
-        float y = GetRandomValue(2, cellCount - 3);
-        return Vector2{x, y};
+        snake.direction = newDirection;
     }
+}
 
-    Vector2 GenerateRandomPos(deque<Vector2> snakeBody)
-    {
-        Vector2 position = GenerateRandomCell();
-        while (ElementInDeque(position, snakeBody))
-        {
-            position = GenerateRandomCell();
-        }
-        return position;
+// Food drawing - Food itself lives in the core
+void DrawFood(const Food& food, const Tile& nextTile = Tile(1, PLAIN_TILES))
+{
+    if (!food.Placed()) return; // Waiting for a free cell
+
+    // MAHJONG TILE - Authentic Chinese game piece with correct type and color!
+    float centerX = gameAreaOffset + food.position.x * cellSize + cellSize / 2;
+    float centerY = gameAreaOffset + food.position.y * cellSize + cellSize / 2;
+    float tileWidth = cellSize * 0.7f;
+    float tileHeight = cellSize * 0.9f;
+
+    // Mahjong tile colors - ivory white with type-specific border
+    Color tileColor = {255, 255, 240, 255}; // Ivory white
+    Color borderColor = {139, 69, 19, 255}; // Default saddle brown border
+    Color shadowColor = {0, 0, 0, 100}; // Semi-transparent shadow
+    Color symbolColor = {220, 20, 60, 255}; // Default crimson for symbols
+
+    // Set colors based on tile type
+    if (nextTile.type == HAT_TILES) {
+        borderColor = {100, 200, 255, 255}; // Bright blue border for hat tiles
+        symbolColor = {0, 100, 255, 255}; // Blue text for hat tiles
+    } else if (nextTile.type == DOT_TILES) {
+        borderColor = {100, 255, 100, 255}; // Bright green border for dot tiles
+        symbolColor = {0, 150, 0, 255}; // Green text for dot tiles
+    }
+
+    // Draw shadow first (offset slightly)
+    Rectangle shadowRect = {centerX - tileWidth/2 + 3, centerY - tileHeight/2 + 3, tileWidth, tileHeight};
+    DrawRectangleRounded(shadowRect, 0.1, 6, shadowColor);
+
+    // Draw main tile body
+    Rectangle tileRect = {centerX - tileWidth/2, centerY - tileHeight/2, tileWidth, tileHeight};
+    DrawRectangleRounded(tileRect, 0.1, 6, tileColor);
+    DrawRectangleRoundedLinesEx(tileRect, 0.1, 6, 3.0f, borderColor); // Thicker border for type visibility
+
+    // Draw Mahjong symbol with type indicator
+    string tileText = to_string(nextTile.value);
+    if (nextTile.type == HAT_TILES) {
+        tileText += "^"; // Hat symbol
+    } else if (nextTile.type == DOT_TILES) {
+        tileText += "."; // Dot symbol
+    }
+
+    // Calculate text food.position for centering
+    int fontSize = (int)(tileWidth * 0.5f);
+    Vector2 textSize = MeasureTextEx(GetFontDefault(), tileText.c_str(), fontSize, 1);
+    float textX = centerX - textSize.x / 2;
+    float textY = centerY - textSize.y / 2;
+
+    // Draw the number with type symbol and shadow effect
+    DrawTextEx(GetFontDefault(), tileText.c_str(), {textX + 1, textY + 1}, fontSize, 1, {0, 0, 0, 100}); // Shadow
+    DrawTextEx(GetFontDefault(), tileText.c_str(), {textX, textY}, fontSize, 1, symbolColor); // Main text
+
+    // Draw decorative elements based on tile type
+    float dotRadius = 2.0f;
+    if (nextTile.type == HAT_TILES) {
+        // Blue dots for hat tiles
+        Color dotColor = {0, 100, 255, 255};
+        DrawCircle(centerX - tileWidth/3, centerY - tileHeight/3, dotRadius, dotColor);
+        DrawCircle(centerX + tileWidth/3, centerY - tileHeight/3, dotRadius, dotColor);
+        DrawCircle(centerX - tileWidth/3, centerY + tileHeight/3, dotRadius, dotColor);
+        DrawCircle(centerX + tileWidth/3, centerY + tileHeight/3, dotRadius, dotColor);
+    } else if (nextTile.type == DOT_TILES) {
+        // Green dots for dot tiles
+        Color dotColor = {0, 150, 0, 255};
+        DrawCircle(centerX - tileWidth/3, centerY - tileHeight/3, dotRadius, dotColor);
+        DrawCircle(centerX + tileWidth/3, centerY - tileHeight/3, dotRadius, dotColor);
+        DrawCircle(centerX - tileWidth/3, centerY + tileHeight/3, dotRadius, dotColor);
+        DrawCircle(centerX + tileWidth/3, centerY + tileHeight/3, dotRadius, dotColor);
+    } else {
+        // Traditional green dots for plain tiles
+        Color dotColor = {34, 139, 34, 255};
+        DrawCircle(centerX - tileWidth/3, centerY - tileHeight/3, dotRadius, dotColor);
+        DrawCircle(centerX + tileWidth/3, centerY - tileHeight/3, dotRadius, dotColor);
+        DrawCircle(centerX - tileWidth/3, centerY + tileHeight/3, dotRadius, dotColor);
+        DrawCircle(centerX + tileWidth/3, centerY + tileHeight/3, dotRadius, dotColor);
     }
-};
+}
 
-class Game
+// RAYLIB FRONT END: window, audio, input and drawing on top of the game core
+class Game : public GameCore
 {
 public:
-    Snake snake = Snake();
-    Food food = Food(snake.body);
-    GameState gameState = TITLE_SCREEN;
-    int score = 0;
-    bool allowMove = false;
     Color green = {173, 204, 96, 255};
     Color darkGreen = {43, 51, 24, 255};
     Color lightGreen = {200, 230, 150, 255};
     Color currentBackgroundColor = {200, 230, 150, 255};
-    int highScore = 0;
 
     // Input and Gamepad state
     float selectRepeatTimer = 0.0f;
@@ -1397,43 +473,17 @@ public:
     bool stickUp = false, stickDown = false, stickLeft = false, stickRight = false;
     bool stickUpLast = false, stickDownLast = false, stickLeftLast = false, stickRightLast = false;
 
-    // Difficulty and High Score System
-    DifficultyLevel selectedDifficulty = FOUNDATION_BUILDING;
-    map<pair<LoongType, DifficultyLevel>, int> loongHighScores; // [LoongType, Difficulty] -> High Score
-    map<pair<LoongType, DifficultyLevel>, bool> difficultyUnlocked; // Track unlocked difficulties
-    int mahjongWinsRequired = 0; // How many Mahjongs needed to win (for higher difficulties)
-    int mahjongWinsAchieved = 0; // How many Mahjongs achieved this run
-
-    // Difficulty system data
-    vector<string> difficultyNames = {
-        "Foundation Building",
-        "Golden Core",
-        "Nascent Soul",
-        "Ascension",
-        "Immortal Sage"
-    };
+    // Mouse hold timing for fine control
+    float leftClickHoldTime = 0.0f;
+    float rightClickHoldTime = 0.0f;
+    const float HOLD_THRESHOLD = 0.3f; // 0.3 seconds to trigger hold
 
-    vector<string> difficultyDescriptions = {
-        "Start with 3 Extra Lives",
-        "Start with only 1 life, no Extra Lives",
-        "Start with 7 tiles, need 2 Mahjongs to reach 13 tiles",
-        "Start with 10 tiles, need 5 Mahjongs to win",
-        "Start with 13 tiles, need 5 Mahjongs to win"
-    };
-    int mahjongWins = 0;
-    int kongWins = 0;
-    int ornateLevel = LEVEL_1_NONE;
-    int totalWins = 0; // Track total KONG + Mahjong wins for tile expansion
-    int currentTileCount = 4; // Starting with 4 tiles
-    int waterHealingAmount = 0;
-    int windLengthReduction = 0;
     Sound eatSound;
     Sound wallSound;
     Sound mahjongWinSound;
 
     // Sound performance optimization
     float lastSoundTime = 0.0f;
-    float soundCooldown = 0.1f; // Minimum 100ms between sounds
     float lastMusicUpdateTime = 0.0f;
     float musicUpdateInterval = 0.016f; // Update music every 16ms (60fps)
 
@@ -1449,73 +499,11 @@ public:
     Music gameOverMusic1; // First game over track
     Music gameOverMusic2; // Second game over track
     Music currentGameOverMusic; // Currently selected game over music
-    MahjongTiles mahjongTiles;
-    NumberPopup numberPopup;
-    float mahjongWinTimer;
-    bool showMahjongWin;
     int titleMenuSelection = 0; // 0=Start, 1=High Score, 2=Exit
     bool musicLoaded = false;
-    float countdownTimer;
-    int countdownNumber;
-    int finalScore = 0; // Store final score for game over screen
-
-    // Mouse hold timing for fine control
-    float leftClickHoldTime = 0.0f;
-    float rightClickHoldTime = 0.0f;
-    const float HOLD_THRESHOLD = 0.3f; // 0.3 seconds to trigger hold
-
-    // Age and Choice System
-    int snakeAge = 0; // How many tiles consumed (Age)
-    int snakeLength = 0; // Actual snake body length (Length)
-    bool showChoiceWindow = false;
-    float choiceWindowTimer = 0.0f;
-    int selectedChoice = 0;
-    vector<string> currentChoices;
-    vector<string> currentChoiceDescriptions;
-    bool showKongWin = false;
-    float kongWinTimer = 0.0f;
-    bool showPhoenixRebirth = false;
-    float phoenixRebirthTimer = 0.0f;
-    bool showCosmicWisdom = false;
-    float cosmicWisdomTimer = 0.0f;
-
-    // SHIFT Power System - Tile-based cooldown dragon abilities
-    int shiftCooldownTiles = 0; // Tiles consumed since last use
-    int shiftCooldownMax = 10; // Tiles needed to recharge
-    bool shiftPowerReady = true;
-    string shiftPowerName = "";
-    string shiftPowerDescription = "";
-
-    // New upgrade tile system
-    int tilesConsumed = 0;
-    int nextUpgradeTileAt = 10; // First upgrade at 10 tiles
-    bool upgradeThresholds[4] = {false, false, false, false}; // 10, 33, 66, 100
-    int upgradeThresholdValues[4] = {10, 33, 66, 100};
-
-    // Power-up effects tracking
-    bool slowGrowthActive = false;
-    bool mahjongNerfActive = false;
-    bool speedDemonActive = false;
-    bool luckyNumbersActive = false;
-    bool minimalistActive = false;
-    bool turtleModeActive = false;
-    bool gamblerActive = false;
-    bool perfectionistActive = false;
-    bool collectorActive = false;
-    bool survivorActive = false;
-    bool speedsterActive = false;
-    bool monkActive = false;
-
-    int extraLives = 0;
-    int fruitCounter = 0; // For tracking fruit-based effects
 
     // Debug UI variables (disabled for release)
     bool showDebugUI = false; // Disabled for release
-    float currentSpeedMultiplier = 1.0f;
-    float currentProbabilityBonus = 0.0f;
-    bool isInExtraLifeMode = false; // When using extra life
-    int phoenixRebirthCharges = 0; // Phoenix Rebirth charges with bonus scoring
-    string lastExtraLifeType = ""; // Track what type of extra life was used
 
     // Audio controls
     bool isMuted = false;
@@ -1524,80 +512,29 @@ public:
     // UI improvements
     bool showBackButton = false; // Show back button in appropriate screens
 
-    // Latent upgrade system
-    map<LoongType, int> loongTotalScores; // Total scores across all runs for each loong
-    map<LoongType, int> loongUpgradeLevel; // Upgrade level (0-5) for each loong
-    vector<int> latentUpgradeThresholds = {250, 500, 1000, 2000, 4000}; // Score thresholds for latent upgrades
-    int selectedLatentLevel = 0; // Currently selected latent cultivation level (0 = none, 1-5 = levels)
-
-    // Latent cultivation upgrade spawning queue - SEPARATE from normal upgrade system
-    vector<LoongType> pendingLatentUpgrades;
-    float latentUpgradeSpawnTimer = 0.0f;
-    float latentUpgradeSpawnDelay = 1.0f; // 1 second between spawns
-    bool latentCultivationSpawned = false; // Track if we've spawned latent cultivation tiles yet
-
-    // Separate latent cultivation tile system
-    Vector2 latentUpgradeTilePosition;
-    bool latentUpgradeSpawned = false;
-    LoongType latentUpgradeTileType;
-
     // Music dictionary system
     Music alternateMusic;
-    int lastOrnateLevel = -1; // Track ornate level changes
     map<int, string> musicMap; // Map ornate level to music file
 
-    // LOONG System - AMBITIOUS UPGRADE SYSTEM!
-    vector<LoongData> availableLOONGs;
-    LoongType selectedLoongType;
-    int selectedLoongIndex;
-    int loongUpgradeSelection; // For upgrade screen
-    vector<int> upgradeChoices; // 3 random upgrade choices
-    bool showLoongUpgrade;
-
-    // LOONG Effect Tracking Variables
-    float mahjongScoreMultiplier; // Multiplier for Mahjong scores
-    float kongScoreMultiplier; // Multiplier for KONG scores
-    int wallImmunities; // Number of wall collision immunities
-    int teleportCharges; // Number of teleport charges
-    // REMOVED: Legacy auto-complete system
-    int loongWinMultiplier; // LOONG win score multiplier
-    bool phoenixRebirth; // Can revive with full score
-    int phoenixCharges; // Number of phoenix revivals available
-    bool celestialRebirth; // Can revive like basic LOONG
-    int celestialCharges; // Number of celestial revivals available
-
-    // Patience LOONG pause system
-    bool isPaused; // Game is paused
-    float pauseTimer; // How long pause lasts
-    bool canChangeDirection; // Can change direction during pause
-
-    // Bai Ban (White LOONG) zero tile system
-    int purificationCounter; // Counter for automatic purification
-    int purificationThreshold; // Tiles needed for purification (15->10->5)
-    int divineShieldZeros; // How many zeros to remove on death (3->2->1)
-
     // Cross-LOONG color mixing system
-    vector<LoongType> mixedLoongTypes; // LOONGs we've gained powers from
     Color originalBodyColor, originalScaleColor; // Original colors
 
-    // Advanced LOONG Effects
-    int shadowCloneCharges; // Number of shadow clone uses
-    int earthquakeCounter; // Counter for earthquake auto-shuffle
-    int earthquakeThreshold; // Fruits needed for earthquake
-    int tornadoCounter; // Counter for tornado tile swaps
-    int tornadoThreshold; // Fruits needed for tornado
-    int healingCounter; // Counter for healing waters
-    bool graniteWillActive; // Immunity to negative effects
-
-    // NEW UPGRADE TILE SYSTEM
-    Vector2 upgradeTilePosition; // Position of upgrade tile on screen
-    bool upgradeSpawned; // Is there an upgrade tile on screen?
-    LoongType upgradeTileType; // What type of LOONG upgrade this tile gives
-    int tilesConsumedSinceUpgrade; // Track tiles consumed for upgrade spawning
-    int nextUpgradeThreshold; // Next threshold for upgrade spawn (10, 33, 66, 100)
-    bool isGraniteWillActive; // Proper Granite Will immunity state
-
-    Game()
+    // Gameplay ticks for the main loop
+    TickScheduler tickScheduler;
+
+    // Replay recording (--record): one replay_<run seed>.lrp file per run
+    bool recordReplays = false;
+    ReplayRecorder replay;
+    Vector2 recordedDirection = {0, 0}; // Controls as last recorded (see RecordControls)
+    int recordedArrowPosition = 0;
+
+    // Rewind (hold Backspace) and watching the last death again (R on the game over screen)
+    static const int DEATH_REPLAY_TICKS = 25; // 5 s at speed 1
+    RewindBuffer rewind;
+    bool rewindHeld = false;
+    bool quietTicks = false; // Ticks simulated again for a rewind play no sounds and save nothing
+
+    Game(uint64_t runSeed) : GameCore(runSeed)
     {
         InitAudioDevice();
         eatSound = LoadSound("Sounds/eat.mp3");
@@ -1622,9 +559,6 @@ public:
             cout << "Failed to load select_loong.mp3" << endl;
         }
 
-        // Initialize latent upgrade system
-        InitializeLatentUpgrades();
-
         // Load final stretch music (random selection)
         finalStretchMusic1 = LoadMusicStream("Sounds/final_stretch/blades_and_beats.mp3");
         if (finalStretchMusic1.stream.buffer != NULL) {
@@ -1670,67 +604,57 @@ public:
         cout << "Music system: Title -> LOONG Selection -> LOONG Theme (Levels 0-3) -> Final Stretch (Level 4+) -> Game Over" << endl;
         // Don't start music yet - wait for game to begin
 
-        mahjongWinTimer = 0;
-        showMahjongWin = false;
         currentBackgroundColor = {8, 35, 8, 255}; // Dark green for basic dragon background
 
-        // Initialize LOONG System - GO WILD!
-        InitializeLOONGSystem();
-        selectedLoongType = BASIC_LOONG;
-        selectedLoongIndex = 0;
-        loongUpgradeSelection = 0;
-        showLoongUpgrade = false;
-
-        // Initialize Shift power system
-        InitializeShiftPower();
-
-        // Initialize LOONG effect variables
-        mahjongScoreMultiplier = 1.0f;
-        kongScoreMultiplier = 1.0f;
-        wallImmunities = 0;
-        teleportCharges = 0;
-        // REMOVED: Legacy auto-complete system
-        loongWinMultiplier = 3; // Default LOONG multiplier
-        phoenixRebirth = false;
-        phoenixCharges = 0;
-        celestialRebirth = false;
-        celestialCharges = 0;
-
-        // Initialize pause system
-        isPaused = false;
-        pauseTimer = 0.0f;
-        canChangeDirection = false;
-
-        // Initialize zero tile system
-        purificationCounter = 0;
-        purificationThreshold = 15; // Default: 15 tiles
-        divineShieldZeros = 3; // Default: remove 3 zeros on death
-
-        // Initialize color mixing system
-        mixedLoongTypes.clear();
-
         // Initialize LOONG image system
         loongImageLoaded = false;
 
-        // Initialize advanced LOONG effects
-        shadowCloneCharges = 0;
-        earthquakeCounter = 0;
-        earthquakeThreshold = 10; // Default: 10 fruits for earthquake
-        tornadoCounter = 0;
-        tornadoThreshold = 7; // Default: 7 fruits for tornado
-        healingCounter = 0;
-        graniteWillActive = false;
-
-        // Initialize upgrade tile system
-        upgradeSpawned = false;
-        tilesConsumedSinceUpgrade = 0;
-        nextUpgradeThreshold = 10; // First upgrade at 10 tiles
-        isGraniteWillActive = false;
-
+        // Saved scores and unlocks: GameCore() can't reach the save hooks, so run the setup again
         LoadHighScore();
         InitializeDifficultySystem();
     }
 
+    // GameCore hooks: play sounds and music, write saves
+    void PlayGameSound(GameSound sound) override {
+        if (quietTicks) return;
+        if (sound == SOUND_MAHJONG_WIN) {
+            PlayTriumphantMahjongSound(mahjongWinSound);
+        } else {
+            PlaySound(sound == SOUND_WALL ? wallSound : eatSound);
+        }
+    }
+
+    void SetGameSoundPitch(GameSound sound, float pitch) override {
+        SetSoundPitch(sound == SOUND_WALL ? wallSound : eatSound, pitch);
+    }
+
+    void PlayGameSoundSafe(GameSound sound, float pitch, float cooldown) override {
+        if (quietTicks) return;
+        PlaySoundSafe(sound == SOUND_WALL ? wallSound : eatSound, pitch, GetTime(), lastSoundTime, cooldown);
+    }
+
+    void StartGameOverMusic() override {
+        // Select and play random game over music
+        if (random.Value(MUSIC_STREAM, 0, 1) == 0) {
+            currentGameOverMusic = gameOverMusic1;
+            cout << "Selected game_over_eng.mp3 for game over" << endl;
+        } else {
+            currentGameOverMusic = gameOverMusic2;
+            cout << "Selected game_over_cn.mp3 for game over" << endl;
+        }
+
+        // Stop all other music and play game over music
+        if (IsMusicStreamPlaying(backgroundMusic)) StopMusicStream(backgroundMusic);
+        if (IsMusicStreamPlaying(alternateMusic)) StopMusicStream(alternateMusic);
+        if (IsMusicStreamPlaying(titleScreenMusic)) StopMusicStream(titleScreenMusic);
+        if (IsMusicStreamPlaying(loongSelectMusic)) StopMusicStream(loongSelectMusic);
+
+        if (currentGameOverMusic.stream.buffer != NULL) {
+            PlayMusicStream(currentGameOverMusic);
+            cout << "Started playing game over music" << endl;
+        }
+    }
+
     // Get dragon colors based on selected LOONG type
     void GetDragonColors(Color& bodyColor, Color& scaleColor) {
         if (selectedLoongIndex >= 0 && selectedLoongIndex < (int)availableLOONGs.size()) {
@@ -1866,806 +790,72 @@ public:
         }
     }
 
-    void InitializeLOONGSystem() {
-        cout << ">>> INITIALIZING EPIC LOONG SYSTEM! <<<" << endl;
-
-        // BASIC LOONG - Balanced Starter Dragon (Mahjong Green)
-        LoongData basicLoong(BASIC_LOONG, "Fa Cai - Green Dragon", "Green Dragon of wealth\nand steady growth",
-                            {34, 139, 34, 255}, {144, 238, 144, 255}); // Dark Green & Light Green (Mahjong colors)
-        basicLoong.upgrades.push_back(LoongUpgrade("Mahjong Mastery", "Mahjong score +25% per level", 5));
-        basicLoong.upgrades.push_back(LoongUpgrade("KONG Power", "KONG score +50% per level", 4));
-        basicLoong.upgrades.push_back(LoongUpgrade("Extra Lives", "Gain +1 extra life per level", 3));
-        basicLoong.upgrades.push_back(LoongUpgrade("Tile Wisdom", "SHIFT: Discard & change to next tile: 8->6->4 tiles", 3));
-        basicLoong.upgrades.push_back(LoongUpgrade("Speed Control", "Reduce speed by 15% per level", 3));
-        availableLOONGs.push_back(basicLoong);
-
-        // FIRE LOONG - Aggressive Damage Dealer (Red Dragon)
-        LoongData fireLoong(FIRE_LOONG, "Hong Zhong - Red Dragon", "Crimson Dragon of success\nand fiery determination",
-                           {220, 20, 60, 255}, {255, 69, 0, 255}); // Deep Red & Orange Red
-        fireLoong.upgrades.push_back(LoongUpgrade("Blazing Mahjong", "Mahjong +50% score +5% speed per level", 4));
-        fireLoong.upgrades.push_back(LoongUpgrade("Inferno KONG", "KONG +75% score +10% speed per level", 3));
-        fireLoong.upgrades.push_back(LoongUpgrade("Speed Demon", "+20% speed +20% score +1 extra life", 3));
-        fireLoong.upgrades.push_back(LoongUpgrade("Burning Tiles", "SHIFT: Change to most held: 12->9->6 tiles", 3));
-        fireLoong.upgrades.push_back(LoongUpgrade("Blazing Rebirth", "Phoenix rebirth +extra score: 1->2->3 charges", 3));
-        availableLOONGs.push_back(fireLoong);
-
-        // WATER LOONG - Defensive and Healing (Blue Dragon)
-        LoongData waterLoong(WATER_LOONG, "Long Wang - Dragon King", "Azure Dragon of flowing\nwisdom and healing",
-                            {30, 144, 255, 255}, {173, 216, 230, 255}); // Dodger Blue & Light Blue
-        waterLoong.upgrades.push_back(LoongUpgrade("Flowing Mahjong", "Mahjong +20% score + heal 1 length per level", 5));
-        waterLoong.upgrades.push_back(LoongUpgrade("Tidal KONG", "KONG +30% score + 2 extra lives per level", 3));
-        waterLoong.upgrades.push_back(LoongUpgrade("Tsunami Shield", "Wall immunity +3 uses per level", 4));
-        waterLoong.upgrades.push_back(LoongUpgrade("Healing Waters", "Reduce length by 2->4->6 every 5 fruits", 4));
-        waterLoong.upgrades.push_back(LoongUpgrade("Tidal Wave", "SHIFT: Heal, Shuffle & Shield: 8 tiles", 3));
-        availableLOONGs.push_back(waterLoong);
-
-        // WHITE LOONG - Purity and Zero Dragon (Bai Ban - White Tile)
-        LoongData whiteLoong(WHITE_LOONG, "Bai Ban - White Tile", "Pure dragon of emptiness\nand zero mastery",
-                            {248, 248, 255, 255}, {220, 220, 220, 255}); // Ghost White & Light Gray
-        whiteLoong.upgrades.push_back(LoongUpgrade("Pure Mahjong", "1->2->3 tiles become 0 after Mahjong", 3));
-        whiteLoong.upgrades.push_back(LoongUpgrade("Sacred KONG", "KONG +40%, four 0 KONG +200%", 3));
-        whiteLoong.upgrades.push_back(LoongUpgrade("Divine Shield", "Remove 3->2->1 zeros on death", 3));
-        whiteLoong.upgrades.push_back(LoongUpgrade("Zero Mastery", "SHIFT: Turn next tile to 0: 10 tiles", 3));
-        whiteLoong.upgrades.push_back(LoongUpgrade("Purification", "Turn leftmost tile to 0: 15->10->5", 3));
-        availableLOONGs.push_back(whiteLoong);
-
-        // EARTH LOONG - Slow but Powerful (Yellow Dragon)
-        LoongData earthLoong(EARTH_LOONG, "Huang Di - Yellow Emperor", "Golden Emperor Dragon\nof earth and stability",
-                            {218, 165, 32, 255}, {255, 215, 0, 255}); // Golden Rod & Gold
-        earthLoong.upgrades.push_back(LoongUpgrade("Mountain Mahjong", "Mahjong +60% score -25% KONG score per level", 3));
-        earthLoong.upgrades.push_back(LoongUpgrade("Boulder KONG", "KONG +100% score -25% Mahjong score per level", 2));
-        earthLoong.upgrades.push_back(LoongUpgrade("Stone Skin", "-15% speed +3 lives -15% score on death", 3));
-        earthLoong.upgrades.push_back(LoongUpgrade("Earthquake", "KONG/consecutive probability +20% per level", 4));
-        earthLoong.upgrades.push_back(LoongUpgrade("Granite Will", "SHIFT: Wall immunity 20-30 hits: 15 tiles", 5));
-        availableLOONGs.push_back(earthLoong);
-
-        // WIND LOONG - Fast and Agile (Azure Dragon)
-        LoongData windLoong(WIND_LOONG, "Qing Long - Azure Dragon", "Blue Dragon of the East\nand swift winds",
-                           {0, 191, 255, 255}, {135, 206, 250, 255}); // Deep Sky Blue & Light Sky Blue
-        windLoong.upgrades.push_back(LoongUpgrade("Gale Mahjong", "Mahjong +60% score +25% speed per level", 5));
-        windLoong.upgrades.push_back(LoongUpgrade("Whirlwind KONG", "KONG +25% score + probability boost per level", 4));
-        windLoong.upgrades.push_back(LoongUpgrade("Lightning Speed", "+25% speed reduce length 1->2->3 every 5 tiles", 3));
-        windLoong.upgrades.push_back(LoongUpgrade("Tornado Tiles", "SHIFT: Replace pointed tile: 6 tiles", 4));
-        windLoong.upgrades.push_back(LoongUpgrade("Wind Walk", "Phase through self +3 times per level", 3));
-        availableLOONGs.push_back(windLoong);
-
-        // SHADOW LOONG - Mysterious and Tricky (Black Dragon)
-        LoongData shadowLoong(SHADOW_LOONG, "Ju Long - Night Dragon", "Shadow Dragon of mystery\nand dimensional power",
-                             {25, 25, 112, 255}, {72, 61, 139, 255}); // Midnight Blue & Dark Slate Blue
-        shadowLoong.upgrades.push_back(LoongUpgrade("Void Mahjong", "Mahjong +35% score hide 3->6->9 tiles from pool", 3));
-        shadowLoong.upgrades.push_back(LoongUpgrade("Dark KONG", "KONG +80% score discard 1->2->3 tiles on KONG", 3));
-        shadowLoong.upgrades.push_back(LoongUpgrade("Shadow Clone", "Duplicate Mahjong win once per level", 2));
-        shadowLoong.upgrades.push_back(LoongUpgrade("Nightmare Tiles", "SHIFT: Force next tile same: 8->6->4 tiles", 3));
-        shadowLoong.upgrades.push_back(LoongUpgrade("Dimensional Rift", "Teleport on collision +3 charges per level", 3));
-        availableLOONGs.push_back(shadowLoong);
-
-        // CELESTIAL LOONG - Ultimate Endgame Dragon (Imperial Dragon)
-        LoongData celestialLoong(CELESTIAL_LOONG, "Shen Long - Divine Dragon", "Divine Imperial Dragon\nof ultimate power",
-                                {255, 215, 0, 255}, {100, 100, 100, 255}); // Gold & Dark Gray (better readability)
-        celestialLoong.upgrades.push_back(LoongUpgrade("Divine Mahjong", "Mahjong +50% score per level", 3));
-        celestialLoong.upgrades.push_back(LoongUpgrade("Heavenly KONG", "KONG +75% score per level", 3));
-        celestialLoong.upgrades.push_back(LoongUpgrade("Celestial Rebirth", "+2 celestial rebirths per level", 3));
-        celestialLoong.upgrades.push_back(LoongUpgrade("Cosmic Wisdom", "SHIFT: Instant MAHJONG redraw: 20->15->10 tiles", 3));
-        celestialLoong.upgrades.push_back(LoongUpgrade("Transcendence", "LOONG multiplier: 4x->5x->6x", 3));
-        availableLOONGs.push_back(celestialLoong);
-
-        // PATIENCE LOONG - Dragon of Patience and Control
-        LoongData patienceLoong(PATIENCE_LOONG, "Ren Long - Patience Dragon", "Serene dragon of patience\nand perfect timing",
-                               {138, 43, 226, 255}, {75, 0, 130, 255}); // Blue Violet & Indigo
-        patienceLoong.upgrades.push_back(LoongUpgrade("Calm Mahjong", "+30% score, -10% speed per level", 3));
-        patienceLoong.upgrades.push_back(LoongUpgrade("Steady KONG", "+35% score, immunity on KONG", 3));
-        patienceLoong.upgrades.push_back(LoongUpgrade("Meditation", "+2 wall immunity per level", 3));
-        patienceLoong.upgrades.push_back(LoongUpgrade("Pause Control", "SHIFT: Pause & change direction: 3->2->1 tiles", 4));
-        patienceLoong.upgrades.push_back(LoongUpgrade("Patience Mastery", "Slower = higher score multiplier", 3));
-        availableLOONGs.push_back(patienceLoong);
-
-        cout << "*** LOONG SYSTEM INITIALIZED WITH " << availableLOONGs.size() << " MYTHOLOGICAL DRAGONS! ***" << endl;
-        cout << ">>> BAMBOO -> RED -> WHITE -> YELLOW -> AZURE -> SHADOW -> CELESTIAL <<<" << endl;
-        cout << "*** Each dragon has 5 unique upgrade paths rooted in Chinese mythology! ***" << endl;
-    }
-
-    void InitializeShiftPower() {
-        // Initialize Shift power based on selected LOONG type
-        switch (selectedLoongType) {
-            case BASIC_LOONG:
-                shiftPowerName = "Tile Wisdom";
-                shiftPowerDescription = "Discard & change to next";
-                shiftCooldownMax = 8; // 8 tiles cooldown
-                break;
-
-            case FIRE_LOONG:
-                shiftPowerName = "Burning Tiles";
-                shiftPowerDescription = "Change tile to most held";
-                shiftCooldownMax = 12; // 12 tiles cooldown
-                break;
-
-            case WATER_LOONG:
-                shiftPowerName = "Tidal Wave";
-                shiftPowerDescription = "Heal snake + shuffle tiles";
-                shiftCooldownMax = 8; // 8 tiles cooldown
-                break;
-
-            case WHITE_LOONG:
-                shiftPowerName = "Zero Mastery";
-                shiftPowerDescription = "Turn next tile to 0";
-                shiftCooldownMax = 10; // Reduced from 15
-                break;
-
-            case EARTH_LOONG:
-                shiftPowerName = "Granite Will";
-                shiftPowerDescription = "Temporary immunity";
-                shiftCooldownMax = 15; // 15 tiles cooldown
-                break;
-
-            case WIND_LOONG:
-                shiftPowerName = "Tornado Tiles";
-                shiftPowerDescription = "Replace pointed tile";
-                shiftCooldownMax = 6; // 6 tiles cooldown
-                break;
-
-            case SHADOW_LOONG:
-                shiftPowerName = "Nightmare Tiles";
-                shiftPowerDescription = "Change to pointed tile";
-                shiftCooldownMax = 8; // 8 tiles cooldown
-                break;
-
-            case CELESTIAL_LOONG:
-                shiftPowerName = "Cosmic Wisdom";
-                shiftPowerDescription = "Instant MAHJONG";
-                shiftCooldownMax = 20; // 20 tiles cooldown
-                break;
-
-            case PATIENCE_LOONG:
-                shiftPowerName = "Pause Control";
-                shiftPowerDescription = "Pause & change direction";
-                shiftCooldownMax = 3; // 3 tiles cooldown (very low)
-                break;
-        }
-
-        // Start with power ready
-        shiftPowerReady = true;
-        shiftCooldownTiles = 0;
-
-        cout << "*** SHIFT POWER INITIALIZED: " << shiftPowerName << " ***" << endl;
-    }
-
     void LoadLoongThemeMusic() {
         // Check if we already have the correct theme loaded
-        static LoongType lastLoadedLoongType = (LoongType)-1;
-        if (lastLoadedLoongType == selectedLoongType && loongThemeMusic.stream.buffer != NULL) {
-            return; // Already loaded correct theme
-        }
-
-        // Unload previous LOONG theme if loaded
-        if (loongThemeMusic.stream.buffer != NULL) {
-            UnloadMusicStream(loongThemeMusic);
-        }
-
-        lastLoadedLoongType = selectedLoongType;
-
-        // Load LOONG-specific theme music
-        string themePath = "";
-        switch (selectedLoongType) {
-            case BASIC_LOONG:
-                themePath = "Sounds/loong_theme/fa_cai.mp3";
-                break;
-            case FIRE_LOONG:
-                themePath = "Sounds/loong_theme/hong_zhong.mp3";
-                break;
-            case WATER_LOONG:
-                themePath = "Sounds/loong_theme/long_wang.mp3";
-                break;
-            case WHITE_LOONG:
-                themePath = "Sounds/loong_theme/bai_ban.mp3";
-                break;
-            case EARTH_LOONG:
-                themePath = "Sounds/loong_theme/huang_di.mp3";
-                break;
-            case WIND_LOONG:
-                themePath = "Sounds/loong_theme/qing_long.mp3";
-                break;
-            case SHADOW_LOONG:
-                themePath = "Sounds/loong_theme/ju_long.mp3";
-                break;
-            case CELESTIAL_LOONG:
-                themePath = "Sounds/loong_theme/shen_long.mp3";
-                break;
-            case PATIENCE_LOONG:
-                themePath = "Sounds/loong_theme/ren_long.mp3";
-                break;
-        }
-
-        if (!themePath.empty()) {
-            loongThemeMusic = LoadMusicStream(themePath.c_str());
-            if (loongThemeMusic.stream.buffer != NULL) {
-                SetMusicVolume(loongThemeMusic, 0.5f);
-                cout << "Successfully loaded LOONG theme: " << themePath << endl;
-
-                // Set this as the background music for ornate levels 0-2
-                backgroundMusic = loongThemeMusic;
-            } else {
-                cout << "Failed to load LOONG theme: " << themePath << endl;
-            }
-        }
-
-        // Set up final stretch music (random selection)
-        if (GetRandomValue(0, 1) == 0) {
-            alternateMusic = finalStretchMusic1;
-            cout << "Selected blades_and_beats.mp3 for final stretch" << endl;
-        } else {
-            alternateMusic = finalStretchMusic2;
-            cout << "Selected blades_and_beats_cn.mp3 for final stretch" << endl;
-        }
-    }
-
-    void ActivateShiftPower() {
-        if (!shiftPowerReady) return;
-
-        cout << "*** ACTIVATING SHIFT POWER: " << shiftPowerName << " ***" << endl;
-
-        switch (selectedLoongType) {
-            case BASIC_LOONG: {
-                // Tile Wisdom: Discard current tile and change to next one
-                Tile discardedTile = mahjongTiles.nextTile;
-                mahjongTiles.AddToDiscardPile(discardedTile);
-                mahjongTiles.GenerateNextTile(currentProbabilityBonus);
-                cout << ">>> TILE WISDOM: Discarded " << discardedTile.ToString() << " and generated new tile!" << endl;
-                break;
-            }
-            case FIRE_LOONG: {
-                // Burning Tiles: Change tile to most held (non-KONG) tile
-                map<pair<int, TileType>, int> heldCounts;
-                for (const Tile& tile : mahjongTiles.tiles) {
-                    pair<int, TileType> key = {tile.value, tile.type};
-                    if (mahjongTiles.goldTiles.count(key) == 0) { // Not KONG
-                        heldCounts[key]++;
-                    }
-                }
-
-                if (!heldCounts.empty()) {
-                    auto mostHeld = max_element(heldCounts.begin(), heldCounts.end(),
-                        [](const auto& a, const auto& b) { return a.second < b.second; });
-
-                    // Discard the original tile and generate the new one
-                    Tile originalTile = mahjongTiles.nextTile;
-                    mahjongTiles.AddToDiscardPile(originalTile);
-                    mahjongTiles.nextTile = Tile(mostHeld->first.first, mostHeld->first.second, false);
-                    cout << ">>> BURNING TILES: Discarded " << originalTile.ToString() << ", changed to " << mahjongTiles.nextTile.ToString() << " (most held)!" << endl;
-                } else {
-                    cout << ">>> BURNING TILES: No non-KONG tiles to copy!" << endl;
-                }
-                break;
-            }
-
-            case WATER_LOONG: {
-                // Tidal Wave: Heal snake and shuffle tiles
-                cout << ">>> TIDAL WAVE: Healing and reshuffling!" << endl;
-
-                // Heal snake by reducing length (water healing)
-                int healAmount = min(3, (int)snake.body.size() - 4); // Don't go below 4 segments
-                for (int i = 0; i < healAmount; i++) {
-                    if (snake.body.size() > 4) {
-                        snake.body.pop_back();
-                    }
-                }
-                cout << ">>> HEALING WATERS: Reduced length by " << healAmount << " segments!" << endl;
-
-                // Shuffle tiles (tidal wave effect)
-                mahjongTiles.ReshuffleTiles();
-                cout << ">>> TIDAL SHUFFLE: Tiles reshuffled by the wave!" << endl;
-
-                // Grant temporary immunity (water protection)
-                wallImmunities += 2;
-                cout << ">>> WATER SHIELD: Gained 2 immunity charges!" << endl;
-                break;
-            }
-
-            case WHITE_LOONG: {
-                // Zero Mastery: Turn next tile into 0 (blank)
-                cout << ">>> ZERO MASTERY: Turning next tile into blank!" << endl;
-
-                // Discard the original tile and create a zero tile
-                Tile originalTile = mahjongTiles.nextTile;
-                mahjongTiles.AddToDiscardPile(originalTile);
-                mahjongTiles.nextTile = Tile(0, PLAIN_TILES, false); // Create zero tile
-                cout << ">>> ZERO MASTERY: Discarded " << originalTile.ToString() << ", next tile is now 0 (blank)!" << endl;
-
-                // Grant temporary immunity (White LOONG purity power)
-                wallImmunities += 1;
-                cout << ">>> DIVINE PURITY: Gained 1 immunity charge! (" << wallImmunities << " total)" << endl;
-                break;
-            }
-
-            case EARTH_LOONG: {
-                // Granite Will: Temporary immunity to walls and own body (20-30 tiles duration)
-                isGraniteWillActive = true; // Activate proper immunity mode
-                wallImmunities += GetRandomValue(20, 30); // Much longer immunity duration
-                cout << ">>> GRANITE WILL: Extended immunity activated! (" << wallImmunities << " hits)" << endl;
-                break;
-            }
-
-            case WIND_LOONG: {
-                // Tornado Tiles: Replace pointed tile with current tile (or discard if KEEP)
-                if (mahjongTiles.IsKeepSelected()) {
-                    // If pointing to KEEP, just discard the current tile
-                    Tile discardedTile = mahjongTiles.nextTile;
-                    mahjongTiles.AddToDiscardPile(discardedTile);
-                    mahjongTiles.GenerateNextTile(currentProbabilityBonus);
-                    cout << ">>> TORNADO TILES: Discarded " << discardedTile.ToString() << " (KEEP selected)!" << endl;
-                } else {
-                    // Replace the pointed tile with current tile
-                    int arrowPos = mahjongTiles.arrowPosition;
-                    if (arrowPos >= 0 && arrowPos < (int)mahjongTiles.tiles.size()) {
-                        Tile replacedTile = mahjongTiles.tiles[arrowPos];
-                        mahjongTiles.AddToDiscardPile(replacedTile); // Properly discard the replaced tile
-                        mahjongTiles.tiles[arrowPos] = mahjongTiles.nextTile;
-                        mahjongTiles.SortTiles();
-                        mahjongTiles.GenerateNextTile(currentProbabilityBonus);
-
-                        // Add snake growth for using the ability (wind power gives energy)
-                        snake.body.push_back(snake.body.back());
-                        cout << ">>> TORNADO TILES: Replaced " << replacedTile.ToString() << " with current tile! Snake grew!" << endl;
-                    }
-                }
-                break;
-            }
-
-            case SHADOW_LOONG: {
-                // Nightmare Tiles: Change current tile to whatever tile we are pointing to
-                if (mahjongTiles.IsKeepSelected()) {
-                    cout << ">>> NIGHTMARE TILES: Cannot activate when pointing to KEEP!" << endl;
-                } else {
-                    int arrowPos = mahjongTiles.arrowPosition;
-                    if (arrowPos >= 0 && arrowPos < (int)mahjongTiles.tiles.size()) {
-                        Tile pointedTile = mahjongTiles.tiles[arrowPos];
-
-                        // Check if it's a KONG tile
-                        pair<int, TileType> key = {pointedTile.value, pointedTile.type};
-                        if (mahjongTiles.goldTiles.count(key) > 0) {
-                            cout << ">>> NIGHTMARE TILES: Cannot activate on KONG tile!" << endl;
-                        } else {
-                            Tile originalTile = mahjongTiles.nextTile;
-                            mahjongTiles.AddToDiscardPile(originalTile);
-                            mahjongTiles.nextTile = Tile(pointedTile.value, pointedTile.type, false);
-                            cout << ">>> NIGHTMARE TILES: Changed " << originalTile.ToString() << " to " << mahjongTiles.nextTile.ToString() << "!" << endl;
-                        }
-                    }
-                }
-                break;
-            }
-
-            case CELESTIAL_LOONG: {
-                // Cosmic Wisdom: Instantly MAHJONG and redraw hand
-                cout << ">>> COSMIC WISDOM: Instant MAHJONG and hand redraw!" << endl;
-
-                // Apply instant Mahjong bonus
-                mahjongWins++;
-                mahjongWinsAchieved++; // Track for difficulty system
-                ornateLevel = min(mahjongWins, 3);
-
-                int cosmicPoints = mahjongTiles.tiles.size() * 10; // Higher bonus for instant
-                score += cosmicPoints;
-                cout << ">>> COSMIC MAHJONG: " << cosmicPoints << " points!" << endl;
-
-                // Add proper snake growth for instant Mahjong (like normal Mahjong wins)
-                int growthAmount = mahjongTiles.tiles.size(); // Grow by number of tiles used
-                for (int i = 0; i < growthAmount; i++) {
-                    snake.body.push_back(snake.body.back()); // Add segments
-                }
-                cout << ">>> COSMIC GROWTH: Snake grew by " << growthAmount << " segments!" << endl;
-
-                // Redraw hand completely
-                ExpandTiles();
-                mahjongTiles.GenerateNextTile(currentProbabilityBonus);
-
-                // Show cosmic effect
-                showCosmicWisdom = true;
-                cosmicWisdomTimer = 3.0f;
-                break;
-            }
-
-            case PATIENCE_LOONG: {
-                // Pause Control: Pause game and allow direction change
-                cout << ">>> PAUSE CONTROL: Time stops, choose new direction!" << endl;
-
-                // Pause the game temporarily
-                isPaused = true;
-                pauseTimer = 2.0f; // 2 seconds to choose direction
-
-                // Allow direction change during pause
-                canChangeDirection = true;
-
-                // Grant temporary immunity during pause
-                wallImmunities += 1;
-                cout << ">>> PATIENCE POWER: Game paused for 2 seconds! Choose direction with WASD!" << endl;
-                break;
-            }
-
-            default:
-                cout << "*** No special power for this LOONG type!" << endl;
-                return;
-        }
-
-        // Start cooldown
-        shiftPowerReady = false;
-        shiftCooldownTiles = 0;
-        cout << "*** SHIFT POWER ON COOLDOWN: " << shiftCooldownMax << " tiles ***" << endl;
-    }
-
-    void GenerateLoongUpgradeChoices() {
-        upgradeChoices.clear();
-        LoongData& currentLoong = availableLOONGs[selectedLoongIndex];
-
-        // Find upgrades that can still be leveled
-        vector<int> availableUpgrades;
-        for (int i = 0; i < (int)currentLoong.upgrades.size(); i++) {
-            if (currentLoong.upgrades[i].level < currentLoong.upgrades[i].maxLevel) {
-                availableUpgrades.push_back(i);
-            }
-        }
-
-        // If we have upgrades available, pick 3 random ones
-        if (availableUpgrades.size() > 0) {
-            for (int i = 0; i < 3 && availableUpgrades.size() > 0; i++) {
-                int randomIndex = GetRandomValue(0, availableUpgrades.size() - 1);
-                upgradeChoices.push_back(availableUpgrades[randomIndex]);
-                availableUpgrades.erase(availableUpgrades.begin() + randomIndex);
-            }
-        }
-
-        // Fill remaining slots with random upgrades if needed
-        while (upgradeChoices.size() < 3) {
-            int randomUpgrade = GetRandomValue(0, currentLoong.upgrades.size() - 1);
-            upgradeChoices.push_back(randomUpgrade);
-        }
-
-        loongUpgradeSelection = 0;
-        showLoongUpgrade = true;
-        cout << "🎯 Generated " << upgradeChoices.size() << " upgrade choices for " << currentLoong.name << "!" << endl;
-    }
-
-    void ApplyLoongUpgrade(int upgradeIndex) {
-        if (upgradeIndex < 0 || upgradeIndex >= (int)upgradeChoices.size()) return;
-
-        LoongData& currentLoong = availableLOONGs[selectedLoongIndex];
-        int actualUpgradeIndex = upgradeChoices[upgradeIndex];
-        LoongUpgrade& upgrade = currentLoong.upgrades[actualUpgradeIndex];
-
-        if (upgrade.level < upgrade.maxLevel) {
-            upgrade.level++;
-            currentLoong.level++;
-
-            cout << "*** UPGRADED " << upgrade.name << " to level " << upgrade.level << "!" << endl;
-            cout << ">>> " << currentLoong.name << " is now level " << currentLoong.level << "!" << endl;
-
-            // Apply upgrade effects (this is where the magic happens!)
-            ApplyUpgradeEffects(currentLoong.type, actualUpgradeIndex, upgrade.level);
-
-            // CROSS-LOONG COLOR MIXING: Add this LOONG to mixed types if it's different
-            if (currentLoong.type != selectedLoongType) {
-                // Check if we already have this LOONG type in our mix
-                bool alreadyMixed = false;
-                for (LoongType mixedType : mixedLoongTypes) {
-                    if (mixedType == currentLoong.type) {
-                        alreadyMixed = true;
-                        break;
-                    }
-                }
-
-                if (!alreadyMixed) {
-                    mixedLoongTypes.push_back(currentLoong.type);
-                    cout << "🎨 DRAGON FUSION! Added " << currentLoong.name << " to color mix!" << endl;
-                    cout << "🎨 Total mixed LOONGs: " << mixedLoongTypes.size() << " + original = " << (mixedLoongTypes.size() + 1) << " dragons!" << endl;
-                }
-            }
+        static LoongType lastLoadedLoongType = (LoongType)-1;
+        if (lastLoadedLoongType == selectedLoongType && loongThemeMusic.stream.buffer != NULL) {
+            return; // Already loaded correct theme
         }
 
-        showLoongUpgrade = false;
-    }
+        // Unload previous LOONG theme if loaded
+        if (loongThemeMusic.stream.buffer != NULL) {
+            UnloadMusicStream(loongThemeMusic);
+        }
 
-    void ApplyUpgradeEffects(LoongType loongType, int upgradeIndex, int level) {
-        cout << "*** APPLYING UPGRADE EFFECTS! ***" << endl;
+        lastLoadedLoongType = selectedLoongType;
 
-        // This is where each LOONG's unique abilities get applied!
-        // For now, we'll implement basic effects and expand later
-        switch (loongType) {
+        // Load LOONG-specific theme music
+        string themePath = "";
+        switch (selectedLoongType) {
             case BASIC_LOONG:
-                ApplyBasicLoongUpgrade(upgradeIndex, level);
+                themePath = "Sounds/loong_theme/fa_cai.mp3";
                 break;
             case FIRE_LOONG:
-                ApplyFireLoongUpgrade(upgradeIndex, level);
+                themePath = "Sounds/loong_theme/hong_zhong.mp3";
                 break;
             case WATER_LOONG:
-                ApplyWaterLoongUpgrade(upgradeIndex, level);
+                themePath = "Sounds/loong_theme/long_wang.mp3";
                 break;
             case WHITE_LOONG:
-                ApplyWhiteLoongUpgrade(upgradeIndex, level);
+                themePath = "Sounds/loong_theme/bai_ban.mp3";
                 break;
             case EARTH_LOONG:
-                ApplyEarthLoongUpgrade(upgradeIndex, level);
+                themePath = "Sounds/loong_theme/huang_di.mp3";
                 break;
             case WIND_LOONG:
-                ApplyWindLoongUpgrade(upgradeIndex, level);
+                themePath = "Sounds/loong_theme/qing_long.mp3";
                 break;
             case SHADOW_LOONG:
-                ApplyShadowLoongUpgrade(upgradeIndex, level);
+                themePath = "Sounds/loong_theme/ju_long.mp3";
                 break;
             case CELESTIAL_LOONG:
-                ApplyCelestialLoongUpgrade(upgradeIndex, level);
+                themePath = "Sounds/loong_theme/shen_long.mp3";
                 break;
             case PATIENCE_LOONG:
-                ApplyPatienceLoongUpgrade(upgradeIndex, level);
-                break;
-        }
-    }
-
-    // BASIC LOONG Upgrade Effects - Balanced and Reliable
-    void ApplyBasicLoongUpgrade(int upgradeIndex, int level) {
-        switch (upgradeIndex) {
-            case 0: // Mahjong Mastery - +25% per level
-                mahjongScoreMultiplier += 0.25f;
-                cout << "🎯 Mahjong Mastery Level " << level << ": Mahjong multiplier now " << mahjongScoreMultiplier << "x!" << endl;
-                break;
-            case 1: // KONG Power - +50% per level
-                kongScoreMultiplier += 0.5f;
-                cout << "💪 KONG Power Level " << level << ": KONG multiplier now " << kongScoreMultiplier << "x!" << endl;
-                break;
-            case 2: // Extra Lives - +1 basic extra life per level
-                extraLives += 1;
-                cout << "❤️ Basic Extra Lives Level " << level << ": Gained 1 basic extra life! Total: " << extraLives << endl;
-                break;
-            case 3: // Tile Wisdom - Reduce SHIFT cooldown
-                // Reduce SHIFT cooldown: 10->8->6 seconds
-                if (selectedLoongType == BASIC_LOONG) {
-                    shiftCooldownMax = 10.0f - (level * 2.0f); // 10, 8, 6 seconds
-                    cout << "🧠 Tile Wisdom Level " << level << ": SHIFT cooldown reduced to " << shiftCooldownMax << "s!" << endl;
-                }
-                break;
-            case 4: // Speed Control - -15% speed per level
-                currentSpeedMultiplier *= 0.85f;
-                cout << "🐌 Speed Control Level " << level << ": Speed reduced to " << (currentSpeedMultiplier * 100) << "%!" << endl;
-                break;
-        }
-    }
-
-    // FIRE LOONG Upgrade Effects - Aggressive and Powerful
-    void ApplyFireLoongUpgrade(int upgradeIndex, int level) {
-        switch (upgradeIndex) {
-            case 0: // Blazing Mahjong - +40% score +5% speed per level
-                mahjongScoreMultiplier += 0.5f;
-                currentSpeedMultiplier *= 1.05f;
-                cout << ">>> Blazing Mahjong Level " << level << ": Mahjong " << mahjongScoreMultiplier << "x, speed " << (currentSpeedMultiplier * 100) << "%!" << endl;
-                break;
-            case 1: // Inferno KONG - +75% score +10% speed per level
-                kongScoreMultiplier += 0.75f;
-                currentSpeedMultiplier *= 1.1f;
-                cout << ">>> Inferno KONG Level " << level << ": KONG " << kongScoreMultiplier << "x, speed " << (currentSpeedMultiplier * 100) << "%!" << endl;
-                break;
-            case 2: // Speed Demon - +20% speed +20% score +1 extra life
-                currentSpeedMultiplier *= 1.2f;
-                mahjongScoreMultiplier += 0.2f;
-                kongScoreMultiplier += 0.2f;
-                phoenixRebirthCharges += 1;
-                cout << ">>> Speed Demon Level " << level << ": Speed " << (currentSpeedMultiplier * 100) << "%, +20% all scores, +1 Phoenix Rebirth!" << endl;
-                break;
-            case 3: // Burning Tiles - Reduce SHIFT cooldown: 15->12->9s
-                if (selectedLoongType == FIRE_LOONG) {
-                    shiftCooldownMax = 15.0f - (level * 3.0f);
-                    cout << ">>> Burning Tiles Level " << level << ": SHIFT cooldown reduced to " << shiftCooldownMax << "s!" << endl;
-                }
-                break;
-            case 4: // Blazing Rebirth - Phoenix rebirth +extra score
-                phoenixRebirth = true;
-                phoenixCharges += 1;
-                phoenixRebirthCharges += 1; // Grant Phoenix Rebirth with bonus score on revival
-                cout << ">>> Blazing Rebirth Level " << level << ": Phoenix rebirth " << phoenixCharges << " times with extra score!" << endl;
-                break;
-        }
-    }
-
-    // WATER LOONG Upgrade Effects - Defensive and Healing
-    void ApplyWaterLoongUpgrade(int upgradeIndex, int level) {
-        switch (upgradeIndex) {
-            case 0: // Flowing Mahjong - +20% + heal
-                mahjongScoreMultiplier += 0.2f;
-                if (snake.body.size() > 4) snake.body.pop_back(); // Heal by reducing length
-                cout << "🌊 Flowing Mahjong Level " << level << ": Mahjong multiplier " << mahjongScoreMultiplier << "x + healed 1 length!" << endl;
-                break;
-            case 1: // Tidal KONG - +30% + 2 special extra lives
-                kongScoreMultiplier += 0.3f;
-                phoenixRebirthCharges += 2;
-                cout << ">>> Tidal KONG Level " << level << ": KONG multiplier " << kongScoreMultiplier << "x + 2 Phoenix Rebirths!" << endl;
-                break;
-            case 2: // Tsunami Shield - Wall immunity +3 per level
-                wallImmunities += 3;
-                cout << ">>> Tsunami Shield Level " << level << ": " << wallImmunities << " wall collision immunities!" << endl;
-                break;
-            case 3: // Healing Waters - Reduce length
-                waterHealingAmount = 2 * level;
-                cout << ">>> Healing Waters Level " << level << ": Reduce length by " << waterHealingAmount << " every 5 fruits!" << endl;
-                break;
-            case 4: // Ocean Wisdom - SHIFT power (see next 3 tiles)
-                // This is now a SHIFT power, no passive effect
-                cout << ">>> Ocean Wisdom Level " << level << ": SHIFT power enhanced!" << endl;
-                break;
-        }
-    }
-
-    // WHITE LOONG Upgrade Effects - Zero Mastery and Purity
-    void ApplyWhiteLoongUpgrade(int upgradeIndex, int level) {
-        switch (upgradeIndex) {
-            case 0: // Pure Mahjong - 1->2->3 tiles become 0 after Mahjong
-                // This will be handled in the Mahjong win logic
-                cout << ">>> Pure Mahjong Level " << level << ": " << level << " tiles become 0 after Mahjong!" << endl;
-                break;
-            case 1: // Sacred KONG - +40% KONG score, +200% for four 0 KONG
-                kongScoreMultiplier += 0.4f;
-                cout << ">>> Sacred KONG Level " << level << ": KONG " << kongScoreMultiplier << "x, four 0 KONG +200%!" << endl;
-                break;
-            case 2: // Divine Shield - Remove 3->2->1 zeros on death
-                divineShieldZeros = max(1, 4 - level); // 3, 2, 1 zeros removed
-                cout << ">>> Divine Shield Level " << level << ": Remove " << divineShieldZeros << " zeros on death!" << endl;
-                break;
-            case 3: // Zero Mastery - SHIFT power enhanced (cooldown reduction)
-                if (selectedLoongType == WHITE_LOONG) {
-                    shiftCooldownMax = max(2, 10 - (level * 2)); // 8, 6, 4 tiles
-                    cout << ">>> Zero Mastery Level " << level << ": SHIFT cooldown reduced to " << shiftCooldownMax << " tiles!" << endl;
-                }
-                break;
-            case 4: // Purification - Turn leftmost tile to 0: 15->10->5 tiles
-                purificationThreshold = max(5, 20 - (level * 5)); // 15, 10, 5 tiles
-                cout << ">>> Purification Level " << level << ": Auto-purify leftmost tile every " << purificationThreshold << " tiles!" << endl;
-                break;
-        }
-    }
-
-    // EARTH LOONG Upgrade Effects - Slow but Mighty
-    void ApplyEarthLoongUpgrade(int upgradeIndex, int level) {
-        switch (upgradeIndex) {
-            case 0: // Mountain Mahjong - +60% Mahjong score -25% KONG score
-                mahjongScoreMultiplier += 0.6f;
-                kongScoreMultiplier -= 0.25f;
-                cout << "⛰️ Mountain Mahjong Level " << level << ": Mahjong " << mahjongScoreMultiplier << "x, KONG " << kongScoreMultiplier << "x!" << endl;
-                break;
-            case 1: // Boulder KONG - +100% KONG score -25% Mahjong score
-                kongScoreMultiplier += 1.0f;
-                mahjongScoreMultiplier -= 0.25f;
-                cout << ">>> Boulder KONG Level " << level << ": KONG " << kongScoreMultiplier << "x, Mahjong " << mahjongScoreMultiplier << "x!" << endl;
-                break;
-            case 2: // Stone Skin - -15% speed +3 lives -15% score on death
-                currentSpeedMultiplier *= 0.85f;
-                extraLives += 3;
-                cout << ">>> Stone Skin Level " << level << ": Speed " << (currentSpeedMultiplier * 100) << "%, +3 lives, -15% score on death!" << endl;
-                break;
-            case 3: // Earthquake - KONG/consecutive probability +20%
-                currentProbabilityBonus += 20.0f;
-                cout << ">>> Earthquake Level " << level << ": +" << (level * 20) << "% KONG/consecutive probability!" << endl;
-                break;
-            case 4: // Granite Will - SHIFT power (temporary immunity)
-                graniteWillActive = true;
-                isGraniteWillActive = true; // Activate proper Granite Will immunity
-                wallImmunities += GetRandomValue(15 + level * 5, 25 + level * 5); // Scaling immunity duration
-                cout << ">>> Granite Will Level " << level << ": SHIFT power enhanced! (" << wallImmunities << " charges)" << endl;
-                break;
-        }
-    }
-
-    // WIND LOONG Upgrade Effects - Fast and Agile
-    void ApplyWindLoongUpgrade(int upgradeIndex, int level) {
-        switch (upgradeIndex) {
-            case 0: // Gale Mahjong - +50% score +25% speed (buffed for speed penalty)
-                mahjongScoreMultiplier += 0.6f;
-                currentSpeedMultiplier *= 1.25f;
-                cout << ">>> Gale Mahjong Level " << level << ": Mahjong " << mahjongScoreMultiplier << "x + Speed " << (currentSpeedMultiplier * 100) << "%!" << endl;
-                break;
-            case 1: // Whirlwind KONG - +25% + probability boost
-                kongScoreMultiplier += 0.25f;
-                currentProbabilityBonus += 15.0f;
-                cout << ">>> Whirlwind KONG Level " << level << ": KONG " << kongScoreMultiplier << "x + probability boost!" << endl;
-                break;
-            case 2: // Lightning Speed - +25% speed, reduce length 1->2->3 every 5 tiles
-                currentSpeedMultiplier *= 1.25f;
-                windLengthReduction = level;
-                cout << ">>> Lightning Speed Level " << level << ": Speed " << (currentSpeedMultiplier * 100) << "%, reduce length " << windLengthReduction << " every 5 tiles!" << endl;
-                break;
-            case 3: // Tornado Tiles - SHIFT power (instantly get tile)
-                // This is now a SHIFT power
-                cout << ">>> Tornado Tiles Level " << level << ": SHIFT power enhanced!" << endl;
-                break;
-            case 4: // Wind Walk - Phase through self +3 times per level
-                wallImmunities += 3; // Use wall immunities for self-phasing too
-                cout << ">>> Wind Walk Level " << level << ": Phase through self " << (level * 3) << " times!" << endl;
+                themePath = "Sounds/loong_theme/ren_long.mp3";
                 break;
         }
-    }
 
-    // SHADOW LOONG Upgrade Effects - Mysterious and Tricky (REBALANCED FOR SINGLE PLAYER)
-    void ApplyShadowLoongUpgrade(int upgradeIndex, int level) {
-        switch (upgradeIndex) {
-            case 0: // Void Mahjong - +35% score, hide 3->6->9 tiles from pool
-                mahjongScoreMultiplier += 0.35f;
-                cout << ">>> Void Mahjong Level " << level << ": Mahjong " << mahjongScoreMultiplier << "x, hide " << (level * 3) << " tiles from pool!" << endl;
-                break;
-            case 1: // Dark KONG - +80% score, discard 1->2->3 tiles on KONG (high risk/reward)
-                kongScoreMultiplier += 0.8f;
-                cout << ">>> Dark KONG Level " << level << ": KONG " << kongScoreMultiplier << "x, discard " << level << " tiles on KONG!" << endl;
-                break;
-            case 2: // Shadow Clone - Duplicate Mahjong win once per level
-                shadowCloneCharges += 1;
-                cout << ">>> Shadow Clone Level " << level << ": " << shadowCloneCharges << " shadow clone charges (once per level)!" << endl;
-                break;
-            case 3: // Nightmare Tiles - SHIFT power (force next tile same): 10->8->6s
-                if (selectedLoongType == SHADOW_LOONG) {
-                    shiftCooldownMax = 10.0f - (level * 2.0f);
-                    cout << ">>> Nightmare Tiles Level " << level << ": SHIFT cooldown reduced to " << shiftCooldownMax << "s!" << endl;
-                }
-                break;
-            case 4: // Dimensional Rift - Teleport on collision +3 charges per level
-                teleportCharges += 3;
-                cout << ">>> Dimensional Rift Level " << level << ": " << teleportCharges << " total teleport charges!" << endl;
-                break;
-        }
-    }
+        if (!themePath.empty()) {
+            loongThemeMusic = LoadMusicStream(themePath.c_str());
+            if (loongThemeMusic.stream.buffer != NULL) {
+                SetMusicVolume(loongThemeMusic, 0.5f);
+                cout << "Successfully loaded LOONG theme: " << themePath << endl;
 
-    // CELESTIAL LOONG Upgrade Effects - Ultimate Divine Power (REBALANCED)
-    void ApplyCelestialLoongUpgrade(int upgradeIndex, int level) {
-        switch (upgradeIndex) {
-            case 0: // Divine Mahjong - +50% per level (rebalanced from +100%)
-                mahjongScoreMultiplier += 0.5f;
-                cout << ">>> Divine Mahjong Level " << level << ": Mahjong multiplier now " << mahjongScoreMultiplier << "x!" << endl;
-                break;
-            case 1: // Heavenly KONG - +75% per level (rebalanced from +200%)
-                kongScoreMultiplier += 0.75f;
-                cout << ">>> Heavenly KONG Level " << level << ": KONG multiplier now " << kongScoreMultiplier << "x!" << endl;
-                break;
-            case 2: // Celestial Rebirth - +2 celestial rebirths (normal revival like Bamboo)
-                celestialRebirth = true;
-                celestialCharges += 2;
-                cout << ">>> Celestial Rebirth Level " << level << ": Gained 2 Celestial Rebirths! Total: " << celestialCharges << endl;
-                break;
-            case 3: // Cosmic Wisdom - SHIFT power (instant MAHJONG): 30s cooldown
-                if (selectedLoongType == CELESTIAL_LOONG) {
-                shiftCooldownMax = max(10, 25 - (level * 5)); // Scales down: 20 -> 15 -> 10 tiles
-                cout << ">>> Cosmic Wisdom Level " << level << ": SHIFT cooldown reduced to " << shiftCooldownMax << " tiles!" << endl;
-                }
-                break;
-            case 4: // Transcendence - LOONG multiplier (4x->5x->6x)
-                loongWinMultiplier = 3 + level; // 4x, 5x, 6x
-                cout << ">>> Transcendence Level " << level << ": LOONG win multiplier is now " << loongWinMultiplier << "x!" << endl;
-                break;
+                // Set this as the background music for ornate levels 0-2
+                backgroundMusic = loongThemeMusic;
+            } else {
+                cout << "Failed to load LOONG theme: " << themePath << endl;
+            }
         }
-    }
 
-    // PATIENCE LOONG Upgrade Effects - Dragon of Patience and Control
-    void ApplyPatienceLoongUpgrade(int upgradeIndex, int level) {
-        switch (upgradeIndex) {
-            case 0: // Calm Mahjong - +30% score, -10% speed per level
-                mahjongScoreMultiplier += 0.3f;
-                currentSpeedMultiplier *= 0.9f; // 10% slower
-                cout << ">>> Calm Mahjong Level " << level << ": Mahjong " << mahjongScoreMultiplier << "x, speed " << (currentSpeedMultiplier * 100) << "%!" << endl;
-                break;
-            case 1: // Steady KONG - +35% score, immunity on KONG
-                kongScoreMultiplier += 0.35f;
-                wallImmunities += 1; // Gain immunity on each KONG
-                cout << ">>> Steady KONG Level " << level << ": KONG " << kongScoreMultiplier << "x, +1 immunity per KONG!" << endl;
-                break;
-            case 2: // Meditation - +2 wall immunity per level
-                wallImmunities += 2;
-                cout << ">>> Meditation Level " << level << ": +" << (level * 2) << " wall immunities! Total: " << wallImmunities << endl;
-                break;
-            case 3: // Pause Control - SHIFT power cooldown reduction: 3->2->1->0
-                if (selectedLoongType == PATIENCE_LOONG) {
-                    shiftCooldownMax = max(0.0f, 3.0f - level); // 3, 2, 1, 0 tiles
-                    cout << ">>> Pause Control Level " << level << ": SHIFT cooldown reduced to " << shiftCooldownMax << " tiles!" << endl;
-                }
-                break;
-            case 4: // Patience Mastery - Slower = higher score multiplier
-                // The slower you are, the higher your score multiplier
-                float speedPenalty = 1.0f / currentSpeedMultiplier; // Inverse of speed
-                mahjongScoreMultiplier += speedPenalty * 0.1f; // 10% bonus per speed reduction
-                kongScoreMultiplier += speedPenalty * 0.1f;
-                cout << ">>> Patience Mastery Level " << level << ": Score multiplier increased based on patience! Mahjong: " << mahjongScoreMultiplier << "x, KONG: " << kongScoreMultiplier << "x!" << endl;
-                break;
+        // Set up final stretch music (random selection)
+        if (random.Value(MUSIC_STREAM, 0, 1) == 0) {
+            alternateMusic = finalStretchMusic1;
+            cout << "Selected blades_and_beats.mp3 for final stretch" << endl;
+        } else {
+            alternateMusic = finalStretchMusic2;
+            cout << "Selected blades_and_beats_cn.mp3 for final stretch" << endl;
         }
     }
 
@@ -2998,331 +1188,6 @@ public:
         }
     }
 
-    void GenerateChoices() {
-        currentChoices.clear();
-        currentChoiceDescriptions.clear();
-
-        // Create a pool of REBALANCED choices with proper pros and cons
-        vector<pair<string, string>> choicePool = {
-            {"Slow Growth", "PRO: Only gain 1 length every 2 fruits\nCON: Slightly increase speed (10%)"},
-            {"Length Reduction", "PRO: Remove 3 length from snake\nCON: Mahjong gives 20% less points"},
-            {"Speed Demon", "PRO: Extra life (survive 1 collision)\nCON: Increase speed by 50%"},
-            {"Lucky Numbers", "PRO: Current tiles 30% more likely\nCON: Snake grows faster (every 4 fruits)"},
-            {"Minimalist", "PRO: Remove 5 length from snake\nCON: Tile pool depletes 25% faster"},
-            {"Turtle Mode", "PRO: Reduce speed by 50%\nCON: Snake grows every 3 fruits"},
-            {"Gambler", "PRO: Double points from Mahjong/Kong\nCON: Lose 1 length every 10 fruits"},
-            {"Perfectionist", "PRO: Mahjong gives 50% bonus points\nCON: Speed increases 20% after Mahjong"},
-            {"Collector", "PRO: Kong appears 40% more often\nCON: Snake grows 2 per fruit"},
-            {"Survivor", "PRO: Extra life + 30% slower speed\nCON: All scores reduced by 30%"},
-            {"Speedster", "PRO: Triple points from all sources\nCON: Speed increases by 200%"},
-            {"Monk", "PRO: Remove 7 length + 40% slower\nCON: No bonus points from wins"}
-        };
-
-        // Randomly select 3 choices
-        for (int i = 0; i < 3; i++) {
-            int randomIndex = GetRandomValue(0, choicePool.size() - 1);
-            currentChoices.push_back(choicePool[randomIndex].first);
-            currentChoiceDescriptions.push_back(choicePool[randomIndex].second);
-            choicePool.erase(choicePool.begin() + randomIndex);
-        }
-
-        selectedChoice = 0;
-        showChoiceWindow = true;
-        choiceWindowTimer = 0.0f; // No timer - let player take their time
-    }
-
-    void ApplyChoice(int choiceIndex) {
-        if (choiceIndex < 0 || static_cast<size_t>(choiceIndex) >= currentChoices.size()) return;
-
-        string choice = currentChoices[choiceIndex];
-
-        // Check for Granite Will resistance to negative effects
-        if (graniteWillActive) {
-            // 25% chance per level to resist negative effects
-            int resistanceChance = GetRandomValue(1, 100);
-            if (resistanceChance <= 25) { // Simplified to 25% for now
-                cout << "💎 GRANITE WILL ACTIVATED! Resisting negative effect: " << choice << endl;
-                return; // Skip applying the negative effect
-            }
-        }
-
-        cout << "Applied choice: " << choice << endl;
-
-        // Apply the effects based on choice name
-        if (choice == "Slow Growth") {
-            slowGrowthActive = true;
-            cout << "Slow Growth activated: Only gain 1 length every 2 fruit" << endl;
-        }
-        else if (choice == "Mahjong Nerf") {
-            mahjongNerfActive = true;
-            if (snake.body.size() > 7) { // Keep minimum size
-                for (int i = 0; i < 3; i++) {
-                    snake.body.pop_back();
-                }
-            }
-            cout << "Mahjong Nerf activated: Removed 3 length, Mahjong no longer adds length" << endl;
-        }
-        else if (choice == "Speed Demon") {
-            speedDemonActive = true;
-            extraLives += 1; // Add to existing extra lives
-            currentSpeedMultiplier *= 1.5f; // Increase speed by 50% (was incorrectly setting to 2.0f)
-            cout << "Speed Demon activated: Extra life gained, speed increased by 50%" << endl;
-        }
-        else if (choice == "Lucky Numbers") {
-            luckyNumbersActive = true;
-            currentProbabilityBonus = 30.0f; // 30% bonus chance
-            cout << "Lucky Numbers activated: Current tiles 30% more likely to appear" << endl;
-        }
-        else if (choice == "Minimalist") {
-            minimalistActive = true;
-            if (snake.body.size() > 9) { // Keep minimum size
-                for (int i = 0; i < 5; i++) {
-                    snake.body.pop_back();
-                }
-            }
-            cout << "Minimalist activated: Removed 5 length, numbers less likely" << endl;
-        }
-        else if (choice == "Turtle Mode") {
-            turtleModeActive = true;
-            currentSpeedMultiplier *= 0.75f; // FIXED: Multiplicative (25% reduction)
-            cout << "Turtle Mode activated: Speed reduced by 25%, every 3 fruits add 1 length" << endl;
-        }
-        else if (choice == "Gambler") {
-            gamblerActive = true;
-            cout << "Gambler activated: Double points from Mahjong/Kong, lose 2 length every 7 fruits" << endl;
-        }
-        else if (choice == "Perfectionist") {
-            perfectionistActive = true;
-            cout << "Perfectionist activated: Mahjong adds 8 length instead of 5" << endl;
-        }
-        else if (choice == "Collector") {
-            collectorActive = true;
-            cout << "Collector activated: Kong more frequent, snake grows 2 per fruit" << endl;
-        }
-        else if (choice == "Survivor") {
-            survivorActive = true;
-            extraLives += 1;
-            currentSpeedMultiplier *= 0.85f; // FIXED: Multiplicative (15% reduction)
-            cout << "Survivor activated: Extra life + 15% slower speed, no Mahjong/Kong bonuses" << endl;
-        }
-        else if (choice == "Speedster") {
-            speedsterActive = true;
-            currentSpeedMultiplier *= 1.5f; // FIXED: Multiplicative (50% increase)
-            cout << "Speedster activated: Triple points from all sources, speed increased by 50%" << endl;
-        }
-        else if (choice == "Monk") {
-            monkActive = true;
-            if (snake.body.size() > 11) { // Keep minimum size
-                for (int i = 0; i < 7; i++) {
-                    snake.body.pop_back();
-                }
-            }
-            currentSpeedMultiplier *= 0.8f; // FIXED: Multiplicative (20% reduction)
-            cout << "Monk activated: Removed 7 length + 20% slower speed, no Mahjong/Kong bonuses" << endl;
-        }
-
-        cout << "Choice applied successfully!" << endl;
-    }
-
-    void ExpandTiles() {
-        cout << "ExpandTiles called! Current tile count: " << currentTileCount << endl;
-        cout << "Current mahjongTiles.maxTiles: " << mahjongTiles.maxTiles << endl;
-        cout << "Current mahjongTiles.tiles.size(): " << mahjongTiles.tiles.size() << endl;
-
-        // COMPLETE HAND REDRAW: 4 -> 7 -> 10 -> 13 (every win)
-        if (currentTileCount == 4) {
-            currentTileCount = 7;
-            mahjongTiles.RedrawCompleteHand(7, ornateLevel);
-            cout << "🎴 COMPLETE HAND REDRAW: 4 -> 7 tiles!" << endl;
-        } else if (currentTileCount == 7) {
-            currentTileCount = 10;
-            mahjongTiles.RedrawCompleteHand(10, ornateLevel);
-            cout << "🎴 COMPLETE HAND REDRAW: 7 -> 10 tiles!" << endl;
-        } else if (currentTileCount == 10) {
-            currentTileCount = 13;
-            mahjongTiles.RedrawCompleteHand(13, ornateLevel);
-            cout << "🎴 COMPLETE HAND REDRAW: 10 -> 13 tiles!" << endl;
-        } else {
-            // At maximum tiles (13) - still redraw for shuffling effect
-            mahjongTiles.RedrawCompleteHand(currentTileCount, ornateLevel);
-            cout << "🎴 COMPLETE HAND REDRAW: " << currentTileCount << " tiles (shuffle at max)!" << endl;
-        }
-
-        cout << "After redraw - currentTileCount: " << currentTileCount << endl;
-        cout << "After redraw - mahjongTiles.maxTiles: " << mahjongTiles.maxTiles << endl;
-        cout << "After redraw - mahjongTiles.tiles.size(): " << mahjongTiles.tiles.size() << endl;
-    }
-
-    void ApplyGrowthEffects() {
-        // Track tile consumption for SHIFT cooldown
-        tilesConsumed++;
-        shiftCooldownTiles++;
-        tilesConsumedSinceUpgrade++;
-
-        // WHITE LOONG Purification: Turn leftmost tile to 0 every X tiles
-        if (selectedLoongType == WHITE_LOONG) {
-            purificationCounter++;
-            if (purificationCounter >= purificationThreshold) {
-                purificationCounter = 0;
-
-                // Turn leftmost tile to 0
-                if (!mahjongTiles.tiles.empty()) {
-                    mahjongTiles.tiles[0] = Tile(0, PLAIN_TILES, false);
-                    mahjongTiles.SortTiles();
-                    cout << "🤍 PURIFICATION: Leftmost tile turned to 0!" << endl;
-                }
-            }
-        }
-
-        // Check if SHIFT power is ready
-        if (!shiftPowerReady && shiftCooldownTiles >= shiftCooldownMax) {
-            shiftPowerReady = true;
-            cout << "*** SHIFT POWER READY: " << shiftPowerName << " ***" << endl;
-        }
-
-        // NEW UPGRADE TILE SYSTEM: Spawn upgrade tiles at age thresholds
-        if (!upgradeSpawned && snakeAge >= nextUpgradeThreshold) {
-            SpawnUpgradeTile();
-        }
-
-        // CROSS-LOONG UPGRADE SYSTEM: Spawn at specific ages 33, 66, 100
-        if (!upgradeSpawned && (snakeAge == 33 || snakeAge == 66 || snakeAge == 100)) {
-            cout << "*** CROSS-LOONG UPGRADE TRIGGERED at age " << snakeAge << "! ***" << endl;
-            SpawnUpgradeTile();
-        }
-
-        if (slowGrowthActive) {
-            // Only grow every 2 fruits
-            if (fruitCounter % 2 == 0) {
-                snake.addSegment = true;
-            }
-        } else if (collectorActive) {
-            // Grow 2 per fruit
-            snake.addSegment = true;
-            snake.AddSegments(1); // Add extra segment
-        } else {
-            // Normal growth
-            snake.addSegment = true;
-        }
-    }
-
-    void ApplyFruitEffects() {
-        // Turtle Mode: Every 3 fruits add 1 length
-        if (turtleModeActive && fruitCounter % 3 == 0) {
-            snake.AddSegments(1);
-        }
-
-        // Lucky Numbers: Every 5 fruits add 1 length
-        if (luckyNumbersActive && fruitCounter % 5 == 0) {
-            snake.AddSegments(1);
-        }
-
-        // Gambler: Lose 2 length every 7 fruits
-        if (gamblerActive && fruitCounter % 7 == 0) {
-            if (snake.body.size() > 5) { // Keep minimum size
-                snake.body.pop_back();
-                if (snake.body.size() > 5) {
-                    snake.body.pop_back();
-                }
-            }
-        }
-    }
-
-    // NEW UPGRADE TILE SYSTEM FUNCTIONS
-    void SpawnUpgradeTile() {
-        // Check if this is a cross-LOONG upgrade (33, 66, 100 age)
-        if (snakeAge == 33 || snakeAge == 66 || snakeAge == 100) {
-            // Cross-LOONG upgrades: Always from other LOONG (no SHIFT powers)
-            vector<LoongType> otherTypes;
-            for (int i = 0; i < 9; i++) { // 9 LOONG types total
-                if (i != (int)selectedLoongType) {
-                    otherTypes.push_back((LoongType)i);
-                }
-            }
-            if (!otherTypes.empty()) {
-                upgradeTileType = otherTypes[GetRandomValue(0, otherTypes.size() - 1)];
-            } else {
-                upgradeTileType = selectedLoongType; // Fallback
-            }
-            cout << "*** CROSS-LOONG UPGRADE at age " << snakeAge << "! ***" << endl;
-        } else {
-            // Regular upgrades: Always current LOONG
-            upgradeTileType = selectedLoongType;
-        }
-
-        // Spawn the upgrade tile at a random position
-        upgradeTilePosition = {
-            (float)GetRandomValue(2, cellCount - 3),
-            (float)GetRandomValue(2, cellCount - 3)
-        };
-
-        // Make sure it doesn't spawn on snake or food
-        while (ElementInDeque(upgradeTilePosition, snake.body) ||
-               (upgradeTilePosition.x == food.position.x && upgradeTilePosition.y == food.position.y)) {
-            upgradeTilePosition = {
-                (float)GetRandomValue(2, cellCount - 3),
-                (float)GetRandomValue(2, cellCount - 3)
-            };
-        }
-
-        upgradeSpawned = true;
-        cout << "*** UPGRADE TILE SPAWNED: " << GetLoongTypeName(upgradeTileType) << " at (" << upgradeTilePosition.x << ", " << upgradeTilePosition.y << ") ***" << endl;
-    }
-
-    string GetLoongTypeName(LoongType type) {
-        switch (type) {
-            case BASIC_LOONG: return "Bamboo";
-            case FIRE_LOONG: return "Fire";
-            case WATER_LOONG: return "Water";
-            case WHITE_LOONG: return "White";
-            case EARTH_LOONG: return "Earth";
-            case WIND_LOONG: return "Wind";
-            case SHADOW_LOONG: return "Shadow";
-            case CELESTIAL_LOONG: return "Celestial";
-            case PATIENCE_LOONG: return "Patience";
-            default: return "Unknown";
-        }
-    }
-
-    string GetPowerName(LoongType t) {
-        switch(t) {
-            case BASIC_LOONG: return "Tile Wisdom";
-            case FIRE_LOONG: return "Burning Tiles";
-            case WATER_LOONG: return "Tidal Wave";
-            case WHITE_LOONG: return "Zero Mastery";
-            case EARTH_LOONG: return "Granite Will";
-            case WIND_LOONG: return "Tornado Tiles";
-            case SHADOW_LOONG: return "Nightmare Tiles";
-            case CELESTIAL_LOONG: return "Cosmic Wisdom";
-            case PATIENCE_LOONG: return "Pause Control";
-            default: return "Unknown";
-        }
-    }
-
-    void UpdateSnakeLength() {
-        snakeLength = snake.body.size();
-    }
-
-    void CollectUpgradeTile() {
-        upgradeSpawned = false;
-        // Don't reset tilesConsumedSinceUpgrade - it's for SHIFT cooldown only
-
-        // FIXED UPGRADE SYSTEM: Every 10 levels - 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, then every 10
-        nextUpgradeThreshold += 10; // Simple: every 10 levels (10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120...)
-
-        // Generate upgrade choices for the collected LOONG type
-        GenerateUpgradeChoicesForLoong(upgradeTileType);
-        cout << "*** COLLECTED " << GetLoongTypeName(upgradeTileType) << " UPGRADE TILE! Next threshold: " << nextUpgradeThreshold << " ***" << endl;
-    }
-
-    void CollectLatentUpgradeTile() {
-        latentUpgradeSpawned = false;
-
-        // Generate upgrade choices for the collected latent LOONG type
-        GenerateUpgradeChoicesForLoong(latentUpgradeTileType);
-        cout << "*** COLLECTED LATENT CULTIVATION " << GetLoongTypeName(latentUpgradeTileType) << " UPGRADE TILE! ***" << endl;
-    }
-
     void DrawLatentUpgradeTile() {
         // Get the color for this LOONG type
         Color upgradeColor = WHITE;
@@ -3395,84 +1260,9 @@ public:
         DrawText(typeName.c_str(), tileX + cellSize/2 - nameWidth/2, tileY - 25, 14, upgradeColor);
     }
 
-    void GenerateUpgradeChoicesForLoong(LoongType loongType) {
-        upgradeChoices.clear();
-
-        // Find the LOONG data for this type
-        int loongIndex = -1;
-        for (int i = 0; i < (int)availableLOONGs.size(); i++) {
-            if (availableLOONGs[i].type == loongType) {
-                loongIndex = i;
-                break;
-            }
-        }
-
-        if (loongIndex == -1) return;
-
-        LoongData& targetLoong = availableLOONGs[loongIndex];
-
-        // Check if this is a cross-LOONG upgrade (other LOONG) or own LOONG
-        bool isCrossLoong = (loongType != selectedLoongType);
-
-        if (isCrossLoong) {
-            // CROSS-LOONG: 2 out of 4 choices (exclude SHIFT powers)
-            vector<int> availableUpgrades;
-            for (int i = 0; i < (int)targetLoong.upgrades.size(); i++) {
-                // Skip SHIFT power upgrades for cross-LOONG
-                bool isShiftPower = false;
-                string upgradeName = targetLoong.upgrades[i].name;
-                if (upgradeName.find("Wisdom") != string::npos ||
-                    upgradeName.find("Tiles") != string::npos ||
-                    upgradeName.find("SHIFT") != string::npos ||
-                    upgradeName.find("Sight") != string::npos ||
-                    upgradeName.find("Will") != string::npos ||
-                    upgradeName.find("Cosmic") != string::npos ||
-                    upgradeName.find("Purification") != string::npos ||
-                    upgradeName.find("Control") != string::npos) {
-                    isShiftPower = true;
-                }
-
-                if (!isShiftPower && targetLoong.upgrades[i].level < targetLoong.upgrades[i].maxLevel) {
-                    availableUpgrades.push_back(i);
-                }
-            }
-
-            // Pick 2 random non-SHIFT upgrades
-            for (int i = 0; i < 2 && availableUpgrades.size() > 0; i++) {
-                int randomIndex = GetRandomValue(0, availableUpgrades.size() - 1);
-                upgradeChoices.push_back(availableUpgrades[randomIndex]);
-                availableUpgrades.erase(availableUpgrades.begin() + randomIndex);
-            }
-        } else {
-            // OWN LOONG: 3 out of 5 choices (include SHIFT powers)
-            vector<int> availableUpgrades;
-            for (int i = 0; i < (int)targetLoong.upgrades.size(); i++) {
-                if (targetLoong.upgrades[i].level < targetLoong.upgrades[i].maxLevel) {
-                    availableUpgrades.push_back(i);
-                }
-            }
-
-            // Pick 3 random upgrades (including SHIFT powers)
-            for (int i = 0; i < 3 && availableUpgrades.size() > 0; i++) {
-                int randomIndex = GetRandomValue(0, availableUpgrades.size() - 1);
-                upgradeChoices.push_back(availableUpgrades[randomIndex]);
-                availableUpgrades.erase(availableUpgrades.begin() + randomIndex);
-            }
-        }
-
-        // Set the selected LOONG index temporarily for the upgrade screen
-        int originalIndex = selectedLoongIndex;
-        selectedLoongIndex = loongIndex;
-
-        loongUpgradeSelection = 0;
-        showLoongUpgrade = true;
-
-        // Restore original index after showing upgrade
-        // (This will be handled in the upgrade application)
-    }
-
     ~Game()
     {
+        rewind.StopPlayback(*this); // Back to the real progress before it's saved
         SaveHighScore();
         UnloadSound(eatSound);
         UnloadSound(wallSound);
@@ -3495,8 +1285,6 @@ public:
         CloseAudioDevice();
     }
 
-
-
     void UpdateMusicAndCountdown()
     {
         float currentTime = GetTime();
@@ -3616,129 +1404,111 @@ public:
             }
         }
 
-        if (gameState == COUNTDOWN) {
-            // Handle countdown - comfortable speed, updated every frame
-            countdownTimer -= GetFrameTime();
-            if (countdownTimer <= 2.0f && countdownNumber == 3) {
-                countdownNumber = 2;
-                // Play "Two" sound - higher pitch for clarity
-                SetSoundPitch(eatSound, 1.2f);
-                PlaySound(eatSound);
-            } else if (countdownTimer <= 1.0f && countdownNumber == 2) {
-                countdownNumber = 1;
-                // Play "One" sound - even higher pitch
-                SetSoundPitch(eatSound, 1.5f);
-                PlaySound(eatSound);
-            } else if (countdownTimer <= 0.0f) {
-                // Play "Go!" sound - highest pitch
-                SetSoundPitch(eatSound, 2.0f);
-                PlaySound(eatSound);
-                // Reset sound pitch for normal gameplay
-                SetSoundPitch(eatSound, 1.0f);
-                gameState = PLAYING;
-
-                // Trigger latent cultivation spawning now that the game has started
-                if (!latentCultivationSpawned && selectedLatentLevel > 0) {
-                    SpawnLatentCultivationUpgrades();
-                    latentCultivationSpawned = true;
-                }
-            }
-        }
+        // Countdown and popup timers
+        bool countingDown = gameState == COUNTDOWN;
+        UpdateTimers(GetFrameTime());
+        if (countingDown && gameState == PLAYING) rewind.Begin(*this); // First keyframe of the run
+    }
 
-        // Update number popup every frame for smooth animation
-        numberPopup.Update(GetFrameTime());
+    void Update()
+    {
+        // Legacy function - calls both updates
+        UpdateMusicAndCountdown();
+        UpdateGameplay(GetFrameTime());
+    }
 
-        // Update mahjong win display every frame
-        if (showMahjongWin) {
-            mahjongWinTimer -= GetFrameTime();
-            if (mahjongWinTimer <= 0) {
-                showMahjongWin = false;
-            }
+    // One gameplay tick from the main loop; a recorded run is closed once it's over
+    void RunGameplayTick()
+    {
+        if (rewind.IsPlaying()) {
+            if (!rewind.PlaybackTick(*this)) StopDeathReplay();
+            return;
         }
+        if (rewindHeld) return; // HandleInput steps back instead
 
-        // Update kong win display every frame
-        if (showKongWin) {
-            kongWinTimer -= GetFrameTime();
-            if (kongWinTimer <= 0) {
-                showKongWin = false;
-            }
+        bool running = gameState == PLAYING;
+        UpdateGameplay(GAMEPLAY_TICK_DELTA); // This now checks if choice window is open
+        if (running) {
+            replay.Tick(*this);
+            rewind.Tick(*this);
         }
-
-        // Update phoenix rebirth effect
-        if (showPhoenixRebirth) {
-            phoenixRebirthTimer -= GetFrameTime();
-            if (phoenixRebirthTimer <= 0) {
-                showPhoenixRebirth = false;
-            }
+        if (gameState != PLAYING && gameState != COUNTDOWN) {
+            replay.Finish(*this);
+            if (running) rewind.End(*this);
         }
+    }
 
-        // Update cosmic wisdom effect
-        if (showCosmicWisdom) {
-            cosmicWisdomTimer -= GetFrameTime();
-            if (cosmicWisdomTimer <= 0) {
-                showCosmicWisdom = false;
-            }
-        }
+    // Every input HandleInput acts on goes to the replay file (--record) and the rewind buffer
+    void RecordInput(ReplayInputKind kind, uint64_t argument = 0)
+    {
+        replay.Record(kind, argument);
+        rewind.Record(kind, argument);
+    }
 
-        // SHIFT power cooldown is now tile-based, updated when tiles are consumed
+    // Direction and arrow are recorded as changes: SyncControls() takes the current values
+    // without recording (so rule-driven changes aren't mistaken for input), RecordControls()
+    // records whatever changed since
+    void SyncControls()
+    {
+        recordedDirection = snake.direction;
+        recordedArrowPosition = mahjongTiles.arrowPosition;
+    }
 
-        // Update choice window (no timer - let player take their time)
-        if (showChoiceWindow) {
-            // No auto-selection - player must choose
+    void RecordControls()
+    {
+        if (!SameCell(snake.direction, recordedDirection)) {
+            RecordInput(REPLAY_DIRECTION, ReplayDirectionCode(snake.direction));
         }
+        if (mahjongTiles.arrowPosition != recordedArrowPosition) {
+            RecordInput(REPLAY_ARROW, mahjongTiles.arrowPosition);
+        }
+        SyncControls();
     }
 
-    void UpdateGameplay()
+    // One tick back per frame while the rewind button is held
+    void StepBack()
     {
-        // Update latent cultivation upgrade spawning (SEPARATE from normal upgrades)
-        if (!pendingLatentUpgrades.empty() && !latentUpgradeSpawned) {
-            latentUpgradeSpawnTimer -= GetFrameTime();
-            if (latentUpgradeSpawnTimer <= 0.0f) {
-                // Spawn the next latent cultivation tile in queue
-                LoongType nextUpgrade = pendingLatentUpgrades[0];
-                pendingLatentUpgrades.erase(pendingLatentUpgrades.begin());
-
-                // Spawn latent cultivation tile separately from normal upgrades
-                latentUpgradeTileType = nextUpgrade;
-                latentUpgradeTilePosition = {
-                    (float)GetRandomValue(2, cellCount - 3),
-                    (float)GetRandomValue(2, cellCount - 3)
-                };
-
-                // Make sure it doesn't spawn on snake, food, or normal upgrade tile
-                while (ElementInDeque(latentUpgradeTilePosition, snake.body) ||
-                       (latentUpgradeTilePosition.x == food.position.x && latentUpgradeTilePosition.y == food.position.y) ||
-                       (upgradeSpawned && latentUpgradeTilePosition.x == upgradeTilePosition.x && latentUpgradeTilePosition.y == upgradeTilePosition.y)) {
-                    latentUpgradeTilePosition = {
-                        (float)GetRandomValue(2, cellCount - 3),
-                        (float)GetRandomValue(2, cellCount - 3)
-                    };
-                }
-
-                latentUpgradeSpawned = true;
-                cout << "Spawned latent cultivation tile: " << GetLoongTypeName(nextUpgrade) << " at (" << latentUpgradeTilePosition.x << ", " << latentUpgradeTilePosition.y << ")" << endl;
-
-                // Reset timer for next spawn
-                latentUpgradeSpawnTimer = latentUpgradeSpawnDelay;
-            }
+        if (rewind.Ticks() <= rewind.OldestTick()) return;
+        if (replay.IsRecording()) {
+            replay.Finish(*this); // The replay can't follow a rewind, it ends here
+            cout << "Replay recording stopped by rewind" << endl;
         }
+        quietTicks = true;
+        rewind.RewindTo(*this, rewind.Ticks() - 1);
+        quietTicks = false;
+        tickScheduler.Reset();
+    }
 
-        if (gameState == PLAYING && !showChoiceWindow && !showLoongUpgrade && !isInExtraLifeMode && !isPaused) // Pause game during choice window, LOONG upgrade, extra life, or ability pause
-        {
-            snake.Update();
-            CheckCollisionWithFood();
-            if (isInExtraLifeMode || gameState != PLAYING) return; // Stop immediately if life used
-            CheckCollisionWithEdges();
-            if (isInExtraLifeMode || gameState != PLAYING) return; // Stop immediately if life used
-            CheckCollisionWithTail();
+    // Play the last ticks before the game over again, then come back to the game over screen
+    void StartDeathReplay()
+    {
+        uint64_t start = rewind.Ticks() > (uint64_t)DEATH_REPLAY_TICKS ? rewind.Ticks() - DEATH_REPLAY_TICKS : 0;
+        quietTicks = true;
+        bool started = rewind.StartPlayback(*this, max(start, rewind.OldestTick()));
+        quietTicks = false;
+        if (started) {
+            tickScheduler.Reset();
+            cout << "Watching the last death again" << endl;
         }
     }
 
-    void Update()
+    void StopDeathReplay()
     {
-        // Legacy function - calls both updates
-        UpdateMusicAndCountdown();
-        UpdateGameplay();
+        rewind.StopPlayback(*this);
+        tickScheduler.Reset();
+    }
+
+    void BeginReplay()
+    {
+        replay.Finish(*this); // A run that ended outside a tick
+        ReplayHeader header;
+        header.runSeed = random.runSeed;
+        header.loongType = selectedLoongType;
+        header.difficulty = selectedDifficulty;
+        header.latentLevel = selectedLatentLevel;
+        string path = "replay_" + to_string(header.runSeed) + ".lrp";
+        replay.Begin(path, header);
+        cout << "Recording replay to " << path << endl;
     }
 
     void HandleInput()
@@ -3964,6 +1734,9 @@ public:
         else if (gameState == INSTRUCTION_SCREEN) {
             // Wait for player to click to start countdown
             if (menuConfirm || IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+                // Every run gets its own seed, so the seed and the inputs replay it
+                PrepareRun((uint64_t)chrono::system_clock::now().time_since_epoch().count());
+                if (recordReplays) BeginReplay();
                 StartCountdown();
                 // Start LOONG theme music when countdown begins
                 if (musicLoaded && backgroundMusic.stream.buffer != NULL) {
@@ -3979,17 +1752,32 @@ public:
         else if (gameState == COUNTDOWN) {
             // No input during countdown
         }
+        else if ((gameState == PLAYING || gameState == GAME_OVER) && rewind.IsPlaying()) {
+            // Watching the last death: a click skips to the end
+            if (menuConfirm || IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+                StopDeathReplay();
+            }
+        }
         else if (gameState == PLAYING) {
+            SyncControls();
+
+            // Hold Backspace (gamepad B) to rewind, one tick per frame
+            rewindHeld = IsKeyDown(KEY_BACKSPACE) || (gpAvailable && IsGamepadButtonDown(gamepad, GAMEPAD_BUTTON_RIGHT_FACE_RIGHT));
+            if (rewindHeld) {
+                StepBack();
+            }
             // Handle extra life mode first
-            if (isInExtraLifeMode) {
+            else if (isInExtraLifeMode) {
                 // Let player move mouse to reposition, then click to continue
                 Vector2 mousePos = GetMousePosition();
-                snake.UpdateDirectionFromMouse(mousePos);
+                UpdateDirectionFromMouse(snake, mousePos);
                 if (gpAvailable) {
-                    snake.UpdateDirectionFromGamepad(gamepad);
+                    UpdateDirectionFromGamepad(snake, gamepad);
                 }
+                RecordControls();
 
                 if (menuConfirm || IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+                    RecordInput(REPLAY_RESUME);
                     isInExtraLifeMode = false;
                     cout << "Extra life resumed!" << endl;
                 }
@@ -4030,6 +1818,7 @@ public:
 
                 // Confirm upgrade selection
                 if (menuConfirm || IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+                    RecordInput(REPLAY_UPGRADE, loongUpgradeSelection);
                     ApplyLoongUpgrade(loongUpgradeSelection);
                     cout << "🐉 LOONG UPGRADE APPLIED! 🐉" << endl;
                 }
@@ -4066,14 +1855,9 @@ public:
                     }
                 }
 
-                // Left click to confirm choice
+                // Left click or Enter/Space to confirm choice
                 if (menuConfirm || IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
-                    ApplyChoice(selectedChoice);
-                    showChoiceWindow = false;
-                }
-
-                // Enter/Space to confirm choice
-                if (menuConfirm) {
+                    RecordInput(REPLAY_CHOICE, selectedChoice);
                     ApplyChoice(selectedChoice);
                     showChoiceWindow = false;
                 }
@@ -4143,15 +1927,21 @@ public:
                     mahjongTiles.MoveArrowRight(); // Wheel down = move right
                 }
 
+                RecordControls();
+
                 // Space bar for reshuffle
                 if (IsKeyPressed(KEY_SPACE) || (gpAvailable && IsGamepadButtonPressed(gamepad, GAMEPAD_BUTTON_RIGHT_FACE_UP))) {
+                    RecordInput(REPLAY_RESHUFFLE);
                     mahjongTiles.ReshuffleTiles();
+                    SyncControls();
                 }
 
                 // SHIFT key for dragon special power
                 if (IsKeyPressed(KEY_LEFT_SHIFT) || IsKeyPressed(KEY_RIGHT_SHIFT) || (gpAvailable && IsGamepadButtonPressed(gamepad, GAMEPAD_BUTTON_RIGHT_FACE_LEFT))) {
                     if (shiftPowerReady) {
+                        RecordInput(REPLAY_SHIFT);
                         ActivateShiftPower();
+                        SyncControls();
                     } else {
                         int tilesNeeded = shiftCooldownMax - shiftCooldownTiles;
                         cout << "*** SHIFT POWER ON COOLDOWN: " << tilesNeeded << " tiles remaining ***" << endl;
@@ -4160,8 +1950,13 @@ public:
             }
         }
         else if (gameState == GAME_OVER) {
+            rewindHeld = false;
+            // R (gamepad Y) watches the last seconds before the death again
+            if ((IsKeyPressed(KEY_R) || (gpAvailable && IsGamepadButtonPressed(gamepad, GAMEPAD_BUTTON_RIGHT_FACE_UP))) && !rewind.Empty()) {
+                StartDeathReplay();
+            }
             // Return to LOONG selection for new game
-            if (menuConfirm || IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+            else if (menuConfirm || IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
                 // Reset game state completely
                 ResetGame();
                 gameState = LOONG_SELECTION;
@@ -4196,12 +1991,6 @@ public:
         stickRightLast = stickRight;
     }
 
-    void StartCountdown() {
-        gameState = COUNTDOWN;
-        countdownTimer = 3.0f; // 3 seconds countdown (comfortable speed)
-        countdownNumber = 3;
-    }
-
     void Draw()
     {
         if (gameState == TITLE_SCREEN) {
@@ -4248,6 +2037,13 @@ public:
             if (showCosmicWisdom) {
                 DrawCosmicWisdomEffect();
             }
+
+            // Rewind and death replay banners
+            const char* banner = rewind.IsPlaying() ? "REPLAY - Click to Skip" : (rewindHeld ? "<< REWIND" : nullptr);
+            if (banner) {
+                int bannerWidth = MeasureText(banner, 30);
+                DrawText(banner, canvasWidth/2 - bannerWidth/2, 20, 30, GOLD);
+            }
         }
     }
 
@@ -4377,125 +2173,6 @@ public:
         DrawLatentUpgradeInfo();
     }
 
-    void ApplyDifficultySettings() {
-        cout << "Applying difficulty: " << difficultyNames[selectedDifficulty] << endl;
-
-        // Reset difficulty-specific variables
-        mahjongWinsRequired = 0;
-        mahjongWinsAchieved = 0;
-
-        switch (selectedDifficulty) {
-            case FOUNDATION_BUILDING:
-                // 3 Extra Lives
-                extraLives = 3;
-                phoenixRebirthCharges = 0;
-                mahjongTiles.SetTileCount(4); // Start with 4 tiles
-                // Generate normal tiles
-                mahjongTiles.GenerateRandomTiles(0);
-                break;
-
-            case GOLDEN_CORE:
-                // 1 Life, no Extra Lives
-                extraLives = 0;
-                phoenixRebirthCharges = 0;
-                mahjongTiles.SetTileCount(4); // Start with 4 tiles
-                // Generate normal tiles
-                mahjongTiles.GenerateRandomTiles(0);
-                break;
-
-            case NASCENT_SOUL:
-                // Start with 7 tiles, need 2 Mahjongs to reach 13 tiles
-                extraLives = 1;
-                phoenixRebirthCharges = 0;
-                mahjongTiles.SetTileCount(7); // Start with 7 tiles
-                // Generate normal tiles
-                mahjongTiles.GenerateRandomTiles(0);
-                mahjongWinsRequired = 2; // Need 2 Mahjongs before can win
-                break;
-
-            case ASCENSION:
-                // Start with 10 tiles, need 5 Mahjongs to win
-                extraLives = 1;
-                phoenixRebirthCharges = 0;
-                mahjongTiles.SetTileCount(10); // Start with 10 tiles
-                // Generate normal tiles
-                mahjongTiles.GenerateRandomTiles(0);
-                mahjongWinsRequired = 5; // Need 5 Mahjongs before can win
-                break;
-
-            case IMMORTAL_SAGE:
-                // Start with 13 tiles, need 5 Mahjongs to win
-                extraLives = 1;
-                phoenixRebirthCharges = 0;
-                mahjongTiles.SetTileCount(13); // Start with 13 tiles
-                // Generate normal tiles
-                mahjongTiles.GenerateRandomTiles(0);
-                mahjongWinsRequired = 5; // Need 5 Mahjongs before can win
-                ornateLevel = LEVEL_3_INTRICATE; // Start at ornate level 3.5 (need to reach 4 to win)
-                break;
-        }
-
-        cout << "Difficulty applied: Lives=" << extraLives << ", Tiles=" << mahjongTiles.maxTiles
-             << ", MahjongWinsRequired=" << mahjongWinsRequired << endl;
-    }
-
-    void InitializeDifficultySystem() {
-        // Initialize all difficulties as locked except Foundation Building
-        for (int loong = 0; loong < 9; loong++) {
-            for (int diff = 0; diff < 5; diff++) {
-                pair<LoongType, DifficultyLevel> key = {(LoongType)loong, (DifficultyLevel)diff};
-                difficultyUnlocked[key] = (diff == 0 && loong == 0); // Only Fa Cai Foundation Building unlocked initially
-                loongHighScores[key] = 0; // Initialize high scores to 0
-            }
-        }
-
-        // Load saved progress
-        LoadProgressData();
-
-        // Set selectedLoongIndex to first unlocked dragon
-        selectedLoongIndex = 0;
-        for (int i = 0; i < 9; i++) {
-            pair<LoongType, DifficultyLevel> key = {(LoongType)i, FOUNDATION_BUILDING};
-            if (difficultyUnlocked[key]) {
-                selectedLoongIndex = i;
-                break;
-            }
-        }
-
-        cout << "Difficulty system initialized with sequential dragon unlocking" << endl;
-    }
-
-    void UnlockNextDifficulty() {
-        // Unlock the next difficulty level for this specific LOONG
-        if (selectedDifficulty < IMMORTAL_SAGE) {
-            DifficultyLevel nextDiff = (DifficultyLevel)(selectedDifficulty + 1);
-            pair<LoongType, DifficultyLevel> nextKey = {selectedLoongType, nextDiff};
-
-            if (!difficultyUnlocked[nextKey]) {
-                difficultyUnlocked[nextKey] = true;
-                cout << "🎉 UNLOCKED: " << difficultyNames[nextDiff] << " for "
-                     << availableLOONGs[selectedLoongIndex].name << "! 🎉" << endl;
-            }
-        }
-
-        // Check if we should unlock the next dragon (Foundation Building difficulty only)
-        if (selectedDifficulty == FOUNDATION_BUILDING) {
-            // Dragon unlock order: Fa Cai -> Hong Zhong -> Bai Ban -> Long Wang -> Huang Di -> Qing Long -> Ju Long -> Ren Long -> Shen Long
-            LoongType nextDragon = (LoongType)((int)selectedLoongType + 1);
-            if (nextDragon < 9) { // Valid next dragon exists
-                pair<LoongType, DifficultyLevel> nextDragonKey = {nextDragon, FOUNDATION_BUILDING};
-
-                if (!difficultyUnlocked[nextDragonKey]) {
-                    difficultyUnlocked[nextDragonKey] = true;
-                    cout << "🐉 UNLOCKED NEW DRAGON: " << availableLOONGs[(int)nextDragon].name << "! 🐉" << endl;
-                }
-            }
-        }
-
-        // Save progress after unlocking
-        SaveProgressData();
-    }
-
     void DrawCountdownScreen()
     {
         // Draw game background
@@ -4543,6 +2220,11 @@ public:
         // Draw try again instruction
         int tryAgainWidth = MeasureText("Click to Try Again", 30);
         DrawText("Click to Try Again", canvasWidth/2 - tryAgainWidth/2, canvasHeight/2 + 150, 30, GRAY);
+
+        if (!rewind.Empty()) {
+            int watchWidth = MeasureText("Press R to watch your last moves", 24);
+            DrawText("Press R to watch your last moves", canvasWidth/2 - watchWidth/2, canvasHeight/2 + 200, 24, DARKGRAY);
+        }
     }
 
     void DrawCultivationSuccessScreen()
@@ -4609,7 +2291,7 @@ public:
             DrawCompactTileDisplay();
 
             // Draw game objects - show next tile with correct type and color
-            food.Draw(mahjongTiles.nextTile);
+            DrawFood(food, mahjongTiles.nextTile);
 
             // Draw upgrade tile if spawned
             if (upgradeSpawned) {
@@ -4624,7 +2306,7 @@ public:
             // Get dragon colors based on selected LOONG
             Color dragonBodyColor, dragonScaleColor;
             GetDragonColors(dragonBodyColor, dragonScaleColor);
-            snake.Draw(dragonBodyColor, dragonScaleColor);
+            DrawSnake(snake, dragonBodyColor, dragonScaleColor);
 
             // Draw mouse position indicator
             Vector2 mousePos = GetMousePosition();
@@ -4632,7 +2314,7 @@ public:
             DrawCircleV(mousePos, 3, green);
 
             // Draw number popup
-            numberPopup.Draw();
+            DrawNumberPopup(numberPopup);
 
             // Draw mahjong win celebration
             if (showMahjongWin) {
@@ -4670,6 +2352,13 @@ public:
         // Title in large white text
         DrawText("Current Tiles:", tileDisplayX, tileDisplayY, 24, WHITE);
 
+        // Swaps-from-Mahjong tracker next to the title
+        if (mahjongTiles.swapsFromMahjong == 0) {
+            DrawText("ONE TILE FROM MAHJONG!", tileDisplayX + 200, tileDisplayY + 4, 20, GOLD);
+        } else {
+            DrawText(TextFormat("Swaps from Mahjong: %d", mahjongTiles.swapsFromMahjong), tileDisplayX + 200, tileDisplayY + 4, 20, LIGHTGRAY);
+        }
+
         // Draw tiles horizontally
         for (int i = 0; i < (int)mahjongTiles.tiles.size(); i++)
         {
@@ -4985,7 +2674,7 @@ public:
     void DrawDebugUI()
     {
         // Draw debug panel on bottom-left for better visibility
-        int debugHeight = 220;
+        int debugHeight = 255;
         Rectangle debugBg = {10, (float)(canvasHeight - debugHeight - 10), 320, (float)debugHeight};
         DrawRectangleRec(debugBg, {0, 0, 0, 180});
         DrawRectangleLinesEx(debugBg, 2, YELLOW);
@@ -5055,6 +2744,18 @@ public:
         }
         sprintf(musicText, "Music: %s (L%d)", currentMusicName.c_str(), currentLevel);
         DrawText(musicText, 20, startY + 200, 12, GOLD);
+
+        // Tick scheduler health
+        char tickText[80];
+        sprintf(tickText, "Tick lag: %.1f ms | Dropped ticks: %lld", tickScheduler.tickLag * 1000.0, tickScheduler.ticksDropped);
+        DrawText(tickText, 20, startY + 215, 12, WHITE);
+
+        // Moves the head needs around the body ("-" when walled off or not on the board)
+        auto moves = [](int distance) { return distance == TileDistanceField::UNREACHABLE ? string("-") : to_string(distance); };
+        Vector2 head = snake.body[0];
+        string distanceText = "Moves to food: " + moves(FoodDistance(head)) + " | upgrade: " + moves(UpgradeTileDistance(head)) +
+                              " | latent: " + moves(LatentUpgradeTileDistance(head));
+        DrawText(distanceText.c_str(), 20, startY + 230, 12, WHITE);
     }
 
     void DrawExtraLifeOverlay()
@@ -5064,892 +2765,83 @@ public:
             DrawRectangle(0, 0, canvasWidth, canvasHeight, {100, 0, 255, 120}); // Purple for special
         } else {
             DrawRectangle(0, 0, canvasWidth, canvasHeight, {255, 0, 0, 100}); // Red for basic
-        }
-
-        // Draw different messages based on extra life type
-        if (lastExtraLifeType == "Special") {
-            int msgWidth = MeasureText("🐉 SPECIAL EXTRA LIFE! 🐉", 48);
-            DrawText("🐉 SPECIAL EXTRA LIFE! 🐉", canvasWidth/2 - msgWidth/2, canvasHeight/2 - 80, 48, GOLD);
-
-            int effectWidth = MeasureText("LOONG Power Activated!", 32);
-            DrawText("LOONG Power Activated!", canvasWidth/2 - effectWidth/2, canvasWidth/2 - 40, 32, WHITE);
-        } else {
-            int msgWidth = MeasureText("BASIC EXTRA LIFE", 60);
-            DrawText("BASIC EXTRA LIFE", canvasWidth/2 - msgWidth/2, canvasHeight/2 - 60, 60, WHITE);
-        }
-
-        int instWidth = MeasureText("Move mouse to reposition, then LEFT CLICK to continue", 24);
-        DrawText("Move mouse to reposition, then LEFT CLICK to continue",
-                canvasWidth/2 - instWidth/2, canvasHeight/2 + 20, 24, YELLOW);
-
-        // Show both types of lives remaining
-        char livesText[100];
-        sprintf(livesText, "Celestial: %d | Phoenix: %d | Basic: %d", celestialCharges, phoenixRebirthCharges, extraLives);
-        int livesWidth = MeasureText(livesText, 24);
-        DrawText(livesText, canvasWidth/2 - livesWidth/2, canvasHeight/2 + 60, 24, WHITE);
-    }
-
-    void DrawPhoenixRebirthEffect()
-    {
-        // Draw epic phoenix rebirth effect
-        static float effectTimer = 0.0f;
-        effectTimer += GetFrameTime();
-
-        // Pulsing fire overlay
-        float alpha = (sin(effectTimer * 10) + 1) * 0.5f * 150; // Pulsing between 0-150
-        DrawRectangle(0, 0, canvasWidth, canvasHeight, {255, 100, 0, (unsigned char)alpha});
-
-        // Phoenix rebirth message with fire colors
-        int msgWidth = MeasureText("🔥🐦 PHOENIX REBIRTH! 🐦🔥", 48);
-        Color fireColor = {255, (unsigned char)(150 + sin(effectTimer * 8) * 50), 0, 255};
-        DrawText("🔥🐦 PHOENIX REBIRTH! 🐦🔥", canvasWidth/2 - msgWidth/2, canvasHeight/2 - 40, 48, fireColor);
-
-        // Charges remaining
-        char chargesText[50];
-        sprintf(chargesText, "Phoenix Charges Remaining: %d", phoenixCharges);
-        int chargesWidth = MeasureText(chargesText, 24);
-        DrawText(chargesText, canvasWidth/2 - chargesWidth/2, canvasHeight/2 + 20, 24, GOLD);
-
-        // Reset timer after 3 seconds
-        if (effectTimer > 3.0f) {
-            effectTimer = 0.0f;
-        }
-    }
-
-    void DrawCosmicWisdomEffect()
-    {
-        // Draw cosmic auto-complete effect
-        static float cosmicTimer = 0.0f;
-        cosmicTimer += GetFrameTime();
-
-        // Cosmic blue/purple overlay
-        float alpha = (sin(cosmicTimer * 12) + 1) * 0.5f * 120; // Pulsing cosmic effect
-        DrawRectangle(0, 0, canvasWidth, canvasHeight, {100, 0, 255, (unsigned char)alpha});
-
-        // Cosmic wisdom message
-        int msgWidth = MeasureText("🌌✨ COSMIC WISDOM! ✨🌌", 48);
-        Color cosmicColor = {(unsigned char)(150 + sin(cosmicTimer * 6) * 50), 100, 255, 255};
-        DrawText("🌌✨ COSMIC WISDOM! ✨🌌", canvasWidth/2 - msgWidth/2, canvasHeight/2 - 40, 48, cosmicColor);
-
-        // Auto-complete message
-        int autoWidth = MeasureText("Hand Auto-Completed!", 24);
-        DrawText("Hand Auto-Completed!", canvasWidth/2 - autoWidth/2, canvasHeight/2 + 20, 24, WHITE);
-
-        // Reset timer after 2 seconds
-        if (cosmicTimer > 2.0f) {
-            cosmicTimer = 0.0f;
-        }
-    }
-
-    void CheckCollisionWithFood()
-    {
-        // Check collision with upgrade tile first
-        if (upgradeSpawned && Vector2Equals(snake.body[0], upgradeTilePosition)) {
-            CollectUpgradeTile();
-            return; // Don't process food collision this frame
-        }
-
-        // Check collision with latent cultivation tile
-        if (latentUpgradeSpawned && Vector2Equals(snake.body[0], latentUpgradeTilePosition)) {
-            CollectLatentUpgradeTile();
-            return; // Don't process food collision this frame
-        }
-
-        if (Vector2Equals(snake.body[0], food.position))
-        {
-            // Increase snake age and fruit counter
-            snakeAge++;
-            fruitCounter++;
-
-            // Use the next tile (strategic preview system)
-            Tile newTile = mahjongTiles.nextTile;
-
-            // Generate the next preview tile for next fruit
-            mahjongTiles.GenerateNextTile(currentProbabilityBonus);
-
-            // Show number popup near snake head
-            Vector2 headPos = {
-                gameAreaOffset + snake.body[0].x * cellSize + cellSize / 2,
-                gameAreaOffset + snake.body[0].y * cellSize + cellSize / 2
-            };
-            numberPopup.Show(newTile, headPos); // Show the full tile for popup
-
-            // Check for KONG condition first
-            if (mahjongTiles.CheckKongCondition(newTile))
-            {
-                // KONG condition met! Show celebration
-                showKongWin = true;
-                kongWinTimer = 0.8f; // Show briefly
-
-                // Play triumphant "Kong" sound
-                SetSoundPitch(eatSound, 1.8f);
-                PlaySound(eatSound);
-
-                // Apply power-up effects to scoring - KONG gives HALF of Mahjong score
-                int kongPoints = (mahjongTiles.tiles.size() * 5) / 2; // Half of Mahjong score
-
-                // Apply old evolution system multipliers
-                if (gamblerActive) kongPoints *= 2;
-                if (speedsterActive) kongPoints *= 3;
-                if (survivorActive || monkActive) kongPoints = 0; // No bonuses
-
-                UpdateLoongTotalScore(kongPoints); // Update latent upgrade progress
-
-                // Apply LOONG upgrade multipliers! 🐉✨
-                if (kongPoints > 0) {
-                    // WHITE LOONG Sacred KONG: Check for four 0 KONG (200% bonus)
-                    if (selectedLoongType == WHITE_LOONG && newTile.IsZero()) {
-                        // Count zeros in hand
-                        int zeroCount = 0;
-                        for (const Tile& tile : mahjongTiles.tiles) {
-                            if (tile.IsZero()) zeroCount++;
-                        }
-
-                        if (zeroCount >= 3) { // 3 in hand + 1 new = 4 zeros
-                            kongPoints = (int)(kongPoints * 3.0f); // 200% bonus = 3x total
-                            cout << "🤍 SACRED KONG: Four 0 KONG! 200% bonus! " << kongPoints << " points!" << endl;
-                        }
-                    }
-
-                    kongPoints = (int)(kongPoints * kongScoreMultiplier);
-                    cout << "🐉 LOONG KONG Bonus: " << kongPoints << " points (x" << kongScoreMultiplier << " multiplier)!" << endl;
-                }
-
-                score += kongPoints;
-                UpdateLoongTotalScore(kongPoints); // Update latent upgrade progress
-                if (score > highScore)
-                {
-                    highScore = score;
-                }
-
-                // KONG does NOT give instant win - continue playing with remaining tiles
-                // The KONG tiles are already marked as gold and removed from pool
-                cout << "KONG scored " << kongPoints << " points. Continue playing with remaining tiles." << endl;
-            }
-            // Check if this creates a winning combination
-            else if (mahjongTiles.CheckWinCondition(newTile, ornateLevel))
-            {
-                // Check if this is a LOONG win (1-9 consecutive of same type)
-                vector<Tile> testTiles = mahjongTiles.tiles;
-                testTiles.push_back(newTile);
-                mahjongTiles.SortTilesVector(testTiles);
-
-                if (ornateLevel >= 2 && mahjongTiles.HasLoongWin(testTiles) && mahjongWinsAchieved >= mahjongWinsRequired) {
-                    // LOONG WIN! Apply LOONG multiplier and go to cultivation success
-                    cout << "LOONG WIN ACHIEVED! CULTIVATION SUCCESS!" << endl;
-
-                    // Apply LOONG win multiplier (default 3x, can be upgraded to 4x, 5x, 6x)
-                    score *= loongWinMultiplier;
-                    cout << "🐉 LOONG WIN MULTIPLIER: " << loongWinMultiplier << "x! Final score: " << score << "!" << endl;
-                    if (score > highScore) {
-                        highScore = score;
-                        SaveHighScore();
-                    }
-
-                    // Update LOONG-specific high score
-                    pair<LoongType, DifficultyLevel> currentKey = {selectedLoongType, selectedDifficulty};
-                    if (score > loongHighScores[currentKey]) {
-                        loongHighScores[currentKey] = score;
-                        cout << "New LOONG high score for " << availableLOONGs[selectedLoongIndex].name
-                             << " (" << difficultyNames[selectedDifficulty] << "): " << score << endl;
-                    }
-
-                    // Unlock next difficulty since we achieved LOONG
-                    UnlockNextDifficulty();
-
-                    // Go to cultivation success screen
-                    gameState = CULTIVATION_SUCCESS;
-                    PlayTriumphantMahjongSound(mahjongWinSound);
-                    return; // Exit early, don't continue normal game
-                }
-
-                // Normal Mahjong win
-                showMahjongWin = true;
-                mahjongWinTimer = 0.8f; // Show briefly
-
-                // Increase mahjong wins and ornate level (simplified to 0-3)
-                mahjongWins++;
-                mahjongWinsAchieved++; // Track for difficulty system
-                int previousOrnateLevel = ornateLevel;
-                ornateLevel = min(mahjongWins, 3); // 1st win = level 1, 2nd = level 2, 3rd = level 3
-
-                // Show LOONG popup when reaching level 3 for the first time
-                if (ornateLevel == 3 && previousOrnateLevel < 3) {
-                    cout << "REACHED FINAL LEVEL! LOONG WIN CONDITION UNLOCKED!" << endl;
-                    // The popup will be shown in the UI
-                }
-
-                // Expand tiles after every Mahjong win
-                ExpandTiles();
-
-                // Note: RedrawCompleteHand() already sorts the hand automatically
-
-                // Play triumphant "Mahjong" sound
-                PlayTriumphantMahjongSound(mahjongWinSound);
-
-                // Apply power-up effects to scoring - new formula: tiles * 5
-                int mahjongPoints = mahjongTiles.tiles.size() * 5; // 4 tiles * 5 = 20 points
-
-                // Apply old evolution system multipliers
-                if (gamblerActive) mahjongPoints *= 2;
-                if (speedsterActive) mahjongPoints *= 3;
-                if (survivorActive || monkActive) mahjongPoints = 0; // No bonuses
-
-                UpdateLoongTotalScore(mahjongPoints); // Update latent upgrade progress
-
-                // Apply LOONG upgrade multipliers! 🐉✨
-                if (mahjongPoints > 0) {
-                    mahjongPoints = (int)(mahjongPoints * mahjongScoreMultiplier);
-
-                    // Check for Shadow Clone effect
-                    if (shadowCloneCharges > 0) {
-                        shadowCloneCharges--;
-                        mahjongPoints *= 2; // Double the points
-                        cout << "👥 SHADOW CLONE ACTIVATED! Doubling Mahjong score! Charges remaining: " << shadowCloneCharges << endl;
-                    }
-
-                    cout << "🐉 LOONG Mahjong Bonus: " << mahjongPoints << " points (x" << mahjongScoreMultiplier << " multiplier)!" << endl;
-                }
-
-                score += mahjongPoints;
-                UpdateLoongTotalScore(mahjongPoints); // Update latent upgrade progress
-                if (score > highScore)
-                {
-                    highScore = score;
-                }
-
-                // Apply power-up effects to length
-                if (!mahjongNerfActive && !survivorActive && !monkActive) {
-                    int lengthToAdd = 5;
-                    if (perfectionistActive) lengthToAdd = 8;
-                    snake.AddSegments(lengthToAdd);
-                }
-
-                // WHITE LOONG Pure Mahjong: Turn tiles to 0 after Mahjong
-                if (selectedLoongType == WHITE_LOONG) {
-                    // Get Pure Mahjong level (upgrade index 0)
-                    int pureMahjongLevel = 0;
-                    for (const LoongData& loong : availableLOONGs) {
-                        if (loong.type == WHITE_LOONG) {
-                            pureMahjongLevel = loong.upgrades[0].level;
-                            break;
-                        }
-                    }
-
-                    // Turn 1->2->3 tiles to 0 based on upgrade level
-                    if (pureMahjongLevel > 0) {
-                        int tilesToConvert = min(pureMahjongLevel, (int)mahjongTiles.tiles.size());
-                        for (int i = 0; i < tilesToConvert; i++) {
-                            mahjongTiles.tiles[i] = Tile(0, PLAIN_TILES, false); // Convert to zero
-                        }
-                        mahjongTiles.SortTiles();
-                        cout << ">>> PURE MAHJONG: Converted " << tilesToConvert << " tiles to 0!" << endl;
-                    }
-                }
-
-                // CRITICAL FIX: Generate new next tile without resetting hand
-                mahjongTiles.GenerateNextTile(currentProbabilityBonus);
-            }
-            else
-            {
-                // Normal eat sound - ensure normal pitch (optimized)
-                PlaySoundSafe(eatSound, 1.0f, GetTime(), lastSoundTime, soundCooldown);
-
-                // Check if KEEP is selected
-                if (mahjongTiles.IsKeepSelected())
-                {
-                    // KEEP at final level: ONLY check for LOONG wins, never Mahjong
-                    if (ornateLevel >= LEVEL_4_DRAGON) {
-                        // At final level, KEEP only allows LOONG wins (risk-reward dynamic)
-                        vector<Tile> testTiles = mahjongTiles.tiles;
-                        testTiles.push_back(newTile);
-                        mahjongTiles.SortTilesVector(testTiles);
-
-                        if (mahjongTiles.HasLoongWin(testTiles) && mahjongWinsAchieved >= mahjongWinsRequired) {
-                            // LOONG WIN! Apply LOONG multiplier and go to cultivation success
-                            cout << "LOONG WIN ACHIEVED WITH KEEP! CULTIVATION SUCCESS!" << endl;
-
-                            // Apply LOONG win multiplier (default 3x, can be upgraded to 4x, 5x, 6x)
-                            score *= loongWinMultiplier;
-                            cout << "🐉 LOONG WIN MULTIPLIER: " << loongWinMultiplier << "x! Final score: " << score << "!" << endl;
-                            if (score > highScore) {
-                                highScore = score;
-                                SaveHighScore();
-                            }
-
-                            // Update LOONG-specific high score
-                            pair<LoongType, DifficultyLevel> currentKey = {selectedLoongType, selectedDifficulty};
-                            if (score > loongHighScores[currentKey]) {
-                                loongHighScores[currentKey] = score;
-                                cout << "New LOONG high score for " << availableLOONGs[selectedLoongIndex].name
-                                     << " (" << difficultyNames[selectedDifficulty] << "): " << score << endl;
-                            }
-
-                            // Unlock next difficulty since we achieved LOONG
-                            UnlockNextDifficulty();
-
-                            // Go to cultivation success screen
-                            gameState = CULTIVATION_SUCCESS;
-                            PlayTriumphantMahjongSound(mahjongWinSound);
-                            return; // Exit early, don't continue normal game
-                        }
-
-                        // KEEP at final level: No Mahjong check, just discard tile
-                        cout << "KEEP at final level - aiming for LOONG only! Tile discarded." << endl;
-                    }
-
-                    // Apply growth effects
-                    ApplyGrowthEffects();
-                }
-                else
-                {
-                    // Replace tile at arrow position
-                    mahjongTiles.ReplaceTileAtArrow(newTile);
-                    ApplyGrowthEffects();
-                }
-
-                // Apply fruit-based power-up effects
-                ApplyFruitEffects();
-
-                // Add fruit scoring - +1 point per fruit
-                score += 1;
-                UpdateLoongTotalScore(1); // Update latent upgrade progress
-                if (score > highScore)
-                {
-                    highScore = score;
-                }
-            }
-
-            // OLD AUTOMATIC UPGRADE SYSTEM REMOVED
-            // Now using physical upgrade tiles that must be collected!
-
-            // OLD EVOLUTION SYSTEM REMOVED
-            // Now using upgrade tile system for all progression!
-
-            // Generate new food position
-            food.position = food.GenerateRandomPos(snake.body);
-
-            // REMOVED: Legacy Celestial LOONG auto-complete ability
-            // Now only available as SHIFT power
-
-            // Check for Earth LOONG Earthquake auto-shuffle
-            earthquakeCounter++;
-            if (earthquakeCounter >= earthquakeThreshold) {
-                cout << "🌍 EARTHQUAKE! Auto-shuffling tiles after " << earthquakeThreshold << " fruits!" << endl;
-                earthquakeCounter = 0;
-
-                // CRITICAL FIX: Shuffle existing hand instead of regenerating
-                mahjongTiles.ShuffleExistingHand();
-
-                // Play earthquake sound (optimized)
-                PlaySoundSafe(eatSound, 0.5f, GetTime(), lastSoundTime, soundCooldown);
-            }
-
-            // Check for Wind LOONG Tornado tile swaps
-            tornadoCounter++;
-            if (tornadoCounter >= tornadoThreshold) {
-                cout << "🌪️ TORNADO! Swapping 2 random tiles after " << tornadoThreshold << " fruits!" << endl;
-                tornadoCounter = 0;
-
-                // Swap 2 random tiles in hand
-                if (mahjongTiles.tiles.size() >= 2) {
-                    int idx1 = GetRandomValue(0, mahjongTiles.tiles.size() - 1);
-                    int idx2 = GetRandomValue(0, mahjongTiles.tiles.size() - 1);
-                    if (idx1 != idx2) {
-                        swap(mahjongTiles.tiles[idx1], mahjongTiles.tiles[idx2]);
-                        mahjongTiles.SortTiles();
-                    }
-                }
-
-                // Play tornado sound (optimized)
-                PlaySoundSafe(eatSound, 1.8f, GetTime(), lastSoundTime, soundCooldown);
-            }
-
-            // Check for Water LOONG Healing Waters
-            healingCounter++;
-            if (healingCounter >= 5 && waterHealingAmount > 0) { // Every 5 fruits
-                cout << "💧 HEALING WATERS! Reducing length by " << waterHealingAmount << "!" << endl;
-                healingCounter = 0;
-
-                // Reduce snake length (healing effect)
-                for (int i = 0; i < waterHealingAmount; i++) {
-                    if (snake.body.size() > 6) {
-                        snake.body.pop_back();
-                    }
-                }
-
-                // Play healing sound (optimized)
-                PlaySoundSafe(eatSound, 1.3f, GetTime(), lastSoundTime, soundCooldown);
-            }
-
-            // Check for Wind LOONG Lightning Speed length reduction
-            if (fruitCounter % 5 == 0 && windLengthReduction > 0) {
-                cout << "🌪️ LIGHTNING SPEED! Reducing length by " << windLengthReduction << "!" << endl;
-                for (int i = 0; i < windLengthReduction; i++) {
-                    if (snake.body.size() > 6) {
-                        snake.body.pop_back();
-                    }
-                }
-            }
-        }
-    }
-
-    void CheckCollisionWithEdges()
-    {
-        if (snake.body[0].x == cellCount || snake.body[0].x == -1 ||
-            snake.body[0].y == cellCount || snake.body[0].y == -1)
-        {
-            // Move head back to previous valid position immediately by shrinking
-            if (snake.body.size() > 1) {
-                snake.body.pop_front();
-            }
-            snake.direction = {0, 0}; // Hard stop: prevent tunneling through wall
-
-            // Check for wall immunity (Water LOONG Tsunami Shield or Earth/White LOONG Granite Will)
-            if (wallImmunities > 0) {
-                wallImmunities--;
-
-                if (isGraniteWillActive) {
-                    cout << ">>> GRANITE WILL IMMUNITY: Stopped at wall! Immunities remaining: " << wallImmunities << endl;
-                } else {
-                    cout << ">>> TSUNAMI SHIELD ACTIVATED! Wall collision ignored. Remaining immunities: " << wallImmunities << endl;
-
-                    // Teleport snake to safe position (center of screen)
-                    snake.body[0].x = cellCount / 2;
-                    snake.body[0].y = cellCount / 2;
-                }
-
-                // Play special immunity sound (optimized)
-                PlaySoundSafe(eatSound, 0.8f, GetTime(), lastSoundTime, soundCooldown);
-
-                return; // Don't die
-            }
-
-            HandleDeath();
-        }
-    }
-
-    void HandleDeath()
-    {
-        // Check for Phoenix Rebirth (Fire LOONG ability)
-        if (phoenixRebirth && phoenixCharges > 0) {
-            phoenixCharges--;
-            cout << "🔥🐦 PHOENIX REBIRTH ACTIVATED! Reviving with full score! Charges remaining: " << phoenixCharges << endl;
-
-            // Keep current score (don't reset)
-            // Reset snake position
-            snake.body[0] = {(float)(cellCount/2), (float)(cellCount/2)};
-            isInExtraLifeMode = true;
-
-            // Show epic phoenix rebirth effect
-            showPhoenixRebirth = true;
-            phoenixRebirthTimer = 3.0f;
-            PlaySoundSafe(eatSound, 2.0f, GetTime(), lastSoundTime, 0.0f);
-
-            return; // Don't continue to normal death handling
-        }
-
-        // Use Celestial Rebirth first (normal revival like Bamboo)
-        if (celestialRebirth && celestialCharges > 0) {
-            celestialCharges--;
-            isInExtraLifeMode = true;
-            lastExtraLifeType = "Celestial";
-            cout << ">>> CELESTIAL REBIRTH ACTIVATED! Normal revival! Charges remaining: " << celestialCharges << endl;
-            ApplySpecialExtraLifeEffect();
-            PlaySoundSafe(eatSound, 1.0f, GetTime(), lastSoundTime, soundCooldown); // Different sound for extra life
-        }
-        // Use Phoenix Rebirth second (with bonus scoring + speed penalty)
-        else if (phoenixRebirthCharges > 0) {
-            phoenixRebirthCharges--;
-            isInExtraLifeMode = true;
-            lastExtraLifeType = "Phoenix";
-
-            // PHOENIX REBIRTH BONUS SCORING - Add % of current score
-            int rebirthBonus = score * 0.25f; // 25% of current score
-            score += rebirthBonus;
-
-            // PHOENIX REBIRTH SPEED PENALTY - Boost speed as penalty for power
-            currentSpeedMultiplier *= 1.5f; // 50% faster (penalty)
-            cout << ">>> PHOENIX REBIRTH ACTIVATED! Bonus: " << rebirthBonus << " points (25% of score)! Speed boosted to " << (currentSpeedMultiplier * 100) << "%! Charges remaining: " << phoenixRebirthCharges << endl;
-            ApplySpecialExtraLifeEffect();
-            PlaySoundSafe(eatSound, 1.0f, GetTime(), lastSoundTime, soundCooldown); // Different sound for extra life
-        }
-        // Then use regular extra lives (basic effect)
-        else if (extraLives > 0) {
-            extraLives--;
-            isInExtraLifeMode = true;
-            lastExtraLifeType = "Basic";
-            cout << "Basic extra life used! Lives remaining: " << extraLives << endl;
-            PlaySoundSafe(eatSound, 1.0f, GetTime(), lastSoundTime, soundCooldown); // Different sound for extra life
-        } else {
-            // WHITE LOONG Divine Shield: Remove zeros instead of game over
-            if (selectedLoongType == WHITE_LOONG && divineShieldZeros > 0) {
-                // Count zeros in hand
-                int zerosInHand = 0;
-                for (const Tile& tile : mahjongTiles.tiles) {
-                    if (tile.IsZero()) zerosInHand++;
-                }
-
-                if (zerosInHand > 0) {
-                    // Remove up to divineShieldZeros zeros from hand
-                    int zerosToRemove = min(divineShieldZeros, zerosInHand);
-                    int zerosRemoved = 0;
-
-                    for (int i = 0; i < (int)mahjongTiles.tiles.size() && zerosRemoved < zerosToRemove; i++) {
-                        if (mahjongTiles.tiles[i].IsZero()) {
-                            mahjongTiles.tiles.erase(mahjongTiles.tiles.begin() + i);
-                            zerosRemoved++;
-                            i--; // Adjust index after removal
-                        }
-                    }
-                    isInExtraLifeMode = true;
-                    lastExtraLifeType = "Divine Shield";
+        }
 
-                    cout << "🤍 DIVINE SHIELD ACTIVATED! Removed " << zerosRemoved << " zeros from hand! Continue playing!" << endl;
+        // Draw different messages based on extra life type
+        if (lastExtraLifeType == "Special") {
+            int msgWidth = MeasureText("🐉 SPECIAL EXTRA LIFE! 🐉", 48);
+            DrawText("🐉 SPECIAL EXTRA LIFE! 🐉", canvasWidth/2 - msgWidth/2, canvasHeight/2 - 80, 48, GOLD);
 
-                    // Play special divine sound (optimized)
-                    PlaySoundSafe(eatSound, 1.8f, GetTime(), lastSoundTime, soundCooldown);
+            int effectWidth = MeasureText("LOONG Power Activated!", 32);
+            DrawText("LOONG Power Activated!", canvasWidth/2 - effectWidth/2, canvasWidth/2 - 40, 32, WHITE);
+        } else {
+            int msgWidth = MeasureText("BASIC EXTRA LIFE", 60);
+            DrawText("BASIC EXTRA LIFE", canvasWidth/2 - msgWidth/2, canvasHeight/2 - 60, 60, WHITE);
+        }
 
-                    return; // Don't game over
-                }
-            }
+        int instWidth = MeasureText("Move mouse to reposition, then LEFT CLICK to continue", 24);
+        DrawText("Move mouse to reposition, then LEFT CLICK to continue",
+                canvasWidth/2 - instWidth/2, canvasHeight/2 + 20, 24, YELLOW);
 
-            // No extra lives or divine shield, normal game over
-            GameOver();
-        }
+        // Show both types of lives remaining
+        char livesText[100];
+        sprintf(livesText, "Celestial: %d | Phoenix: %d | Basic: %d", celestialCharges, phoenixRebirthCharges, extraLives);
+        int livesWidth = MeasureText(livesText, 24);
+        DrawText(livesText, canvasWidth/2 - livesWidth/2, canvasHeight/2 + 60, 24, WHITE);
     }
 
-    void ApplySpecialExtraLifeEffect() {
-        // Apply unique effects based on selected LOONG type
-        switch (selectedLoongType) {
-            case BASIC_LOONG:
-                // Basic LOONG: Just basic extra life (no special effect)
-                cout << "🐉 Basic LOONG Extra Life: Standard revival!" << endl;
-                break;
+    void DrawPhoenixRebirthEffect()
+    {
+        // Draw epic phoenix rebirth effect
+        static float effectTimer = 0.0f;
+        effectTimer += GetFrameTime();
 
-            case FIRE_LOONG:
-                // Fire LOONG: If have triple, immediately KONG and remove from pool
-                cout << "🔥 Fire LOONG Extra Life: Blazing Revival!" << endl;
-                for (int value = 1; value <= 9; value++) {
-                    for (TileType type : mahjongTiles.availableTypes) {
-                        pair<int, TileType> tileKey = {value, type};
-                        int count = 0;
-                        for (const Tile& tile : mahjongTiles.tiles) {
-                            if (tile.value == value && tile.type == type) count++;
-                        }
-                        if (count >= 3) {
-                            // Auto-KONG this tile
-                            mahjongTiles.goldTiles.insert(tileKey);
-                            cout << "🔥 Auto-KONG: " << value << " removed from pool!" << endl;
-                            break;
-                        }
-                    }
-                }
-                break;
+        // Pulsing fire overlay
+        float alpha = (sin(effectTimer * 10) + 1) * 0.5f * 150; // Pulsing between 0-150
+        DrawRectangle(0, 0, canvasWidth, canvasHeight, {255, 100, 0, (unsigned char)alpha});
 
-            case WATER_LOONG:
-                // Water LOONG: Reduce speed by 50% until eaten 10 tiles
-                cout << "💧 Water LOONG Extra Life: Flowing Revival!" << endl;
-                currentSpeedMultiplier *= 0.5f;
-                // TODO: Add counter for 10 tiles to restore speed
-                break;
+        // Phoenix rebirth message with fire colors
+        int msgWidth = MeasureText("🔥🐦 PHOENIX REBIRTH! 🐦🔥", 48);
+        Color fireColor = {255, (unsigned char)(150 + sin(effectTimer * 8) * 50), 0, 255};
+        DrawText("🔥🐦 PHOENIX REBIRTH! 🐦🔥", canvasWidth/2 - msgWidth/2, canvasHeight/2 - 40, 48, fireColor);
 
-            case SHADOW_LOONG:
-                // Shadow LOONG: Can cross over own body 3-6-9 times
-                cout << "🌑 Shadow LOONG Extra Life: Shadow Revival!" << endl;
-                teleportCharges += 3; // Add shadow teleport charges
-                break;
+        // Charges remaining
+        char chargesText[50];
+        sprintf(chargesText, "Phoenix Charges Remaining: %d", phoenixCharges);
+        int chargesWidth = MeasureText(chargesText, 24);
+        DrawText(chargesText, canvasWidth/2 - chargesWidth/2, canvasHeight/2 + 20, 24, GOLD);
 
-            default:
-                cout << "🐉 Special Extra Life: Mystical revival!" << endl;
-                break;
+        // Reset timer after 3 seconds
+        if (effectTimer > 3.0f) {
+            effectTimer = 0.0f;
         }
     }
 
-    void GameOver()
+    void DrawCosmicWisdomEffect()
     {
-        // Update global high score
-        if (score > highScore)
-        {
-            highScore = score;
-            SaveHighScore();
-        }
+        // Draw cosmic auto-complete effect
+        static float cosmicTimer = 0.0f;
+        cosmicTimer += GetFrameTime();
 
-        // Update LOONG-specific high score
-        pair<LoongType, DifficultyLevel> currentKey = {selectedLoongType, selectedDifficulty};
-        if (score > loongHighScores[currentKey]) {
-            loongHighScores[currentKey] = score;
-            cout << "New high score for " << availableLOONGs[selectedLoongIndex].name
-                 << " (" << difficultyNames[selectedDifficulty] << "): " << score << endl;
-        }
-
-        // Check if we achieved LOONG (reached ornate level 4) to unlock next difficulty
-        if (ornateLevel >= LEVEL_4_DRAGON) {
-            UnlockNextDifficulty();
-        }
-
-        // Save progress after every game
-        SaveProgressData();
-
-        // Store final score before resetting
-        finalScore = score;
-
-        snake.Reset();
-        food.position = food.GenerateRandomPos(snake.body);
-        cout << "🎮 STARTING NEW GAME with selectedLatentLevel: " << selectedLatentLevel << endl;
-        mahjongTiles.GenerateRandomTiles(selectedLatentLevel);
-
-        // Reset ornate level and mahjong wins on death
-        ornateLevel = LEVEL_1_NONE;
-        mahjongWins = 0;
-        mahjongWinsAchieved = 0; // Reset difficulty tracking
-
-        // Reset age and choice systems
-        snakeAge = 0;
-        snakeLength = snake.body.size(); // Initialize with starting snake length
-        showChoiceWindow = false;
-        showKongWin = false;
-        showLoongUpgrade = false;
-        fruitCounter = 0;
-
-        // Reset LOONG upgrades (keep selected LOONG but reset temporary effects)
-        currentSpeedMultiplier = 1.0f;
-        currentProbabilityBonus = 0.0f;
-
-        // Reset LOONG effect variables
-        mahjongScoreMultiplier = 1.0f;
-        kongScoreMultiplier = 1.0f;
-        wallImmunities = 0;
-        teleportCharges = 0;
-        // REMOVED: Legacy auto-complete system
-        loongWinMultiplier = 3;
-        phoenixRebirth = false;
-        phoenixCharges = 0;
-        celestialRebirth = false;
-        celestialCharges = 0;
-
-        // Reset zero tile system
-        purificationCounter = 0;
-        purificationThreshold = 15;
-        divineShieldZeros = 3;
-
-        // Reset color mixing system
-        mixedLoongTypes.clear();
-
-        // Reset advanced LOONG effects
-        shadowCloneCharges = 0;
-        earthquakeCounter = 0;
-        earthquakeThreshold = 10;
-        tornadoCounter = 0;
-        tornadoThreshold = 7;
-        healingCounter = 0;
-        graniteWillActive = false;
-
-        // Reset upgrade tile system
-        upgradeSpawned = false;
-        tilesConsumedSinceUpgrade = 0;
-        nextUpgradeThreshold = 10;
-        isGraniteWillActive = false;
-
-        // Reset tile locking system
-        mahjongTiles.futureTilesLocked = false;
-        mahjongTiles.lockedTilesRemaining = 0;
-        mahjongTiles.lockedFutureTiles.clear();
-
-        // Reset all power-up effects
-        slowGrowthActive = false;
-        mahjongNerfActive = false;
-        speedDemonActive = false;
-        luckyNumbersActive = false;
-        minimalistActive = false;
-        turtleModeActive = false;
-        gamblerActive = false;
-        perfectionistActive = false;
-        collectorActive = false;
-        survivorActive = false;
-        speedsterActive = false;
-        monkActive = false;
-        extraLives = 0;
-        phoenixRebirthCharges = 0;
-
-        // Reset debug variables
-        currentSpeedMultiplier = 1.0f;
-        currentProbabilityBonus = 0.0f;
-        isInExtraLifeMode = false;
-        lastExtraLifeType = "";
-        lastOrnateLevel = -1; // Reset music tracking
-
-        // Reset kong wins and tile system
-        kongWins = 0;
-        totalWins = 0;
-        currentTileCount = 4;
-        waterHealingAmount = 0;
-        windLengthReduction = 0;
-
-        // Reset tile system completely
-        mahjongTiles.availableTypes.clear();
-        mahjongTiles.availableTypes.push_back(PLAIN_TILES); // Back to plain tiles only
-        mahjongTiles.goldTiles.clear(); // Clear gold tiles
-        mahjongTiles.tileCounts.clear(); // Clear tile counts
-
-        // Reinitialize tile counts
-        for (int i = 1; i <= 9; i++) {
-            mahjongTiles.tileCounts[make_pair(i, PLAIN_TILES)] = 0;
-            mahjongTiles.tileCounts[make_pair(i, HAT_TILES)] = 0;
-            mahjongTiles.tileCounts[make_pair(i, DOT_TILES)] = 0;
-        }
-
-        mahjongTiles.SetTileCount(4, 0); // Reset to 4 tiles, ornate level 0
-
-        gameState = GAME_OVER;
-        score = 0; // Reset for next game
-        PlaySound(wallSound);
+        // Cosmic blue/purple overlay
+        float alpha = (sin(cosmicTimer * 12) + 1) * 0.5f * 120; // Pulsing cosmic effect
+        DrawRectangle(0, 0, canvasWidth, canvasHeight, {100, 0, 255, (unsigned char)alpha});
 
-        // Select and play random game over music
-        if (GetRandomValue(0, 1) == 0) {
-            currentGameOverMusic = gameOverMusic1;
-            cout << "Selected game_over_eng.mp3 for game over" << endl;
-        } else {
-            currentGameOverMusic = gameOverMusic2;
-            cout << "Selected game_over_cn.mp3 for game over" << endl;
-        }
+        // Cosmic wisdom message
+        int msgWidth = MeasureText("🌌✨ COSMIC WISDOM! ✨🌌", 48);
+        Color cosmicColor = {(unsigned char)(150 + sin(cosmicTimer * 6) * 50), 100, 255, 255};
+        DrawText("🌌✨ COSMIC WISDOM! ✨🌌", canvasWidth/2 - msgWidth/2, canvasHeight/2 - 40, 48, cosmicColor);
 
-        // Stop all other music and play game over music
-        if (IsMusicStreamPlaying(backgroundMusic)) StopMusicStream(backgroundMusic);
-        if (IsMusicStreamPlaying(alternateMusic)) StopMusicStream(alternateMusic);
-        if (IsMusicStreamPlaying(titleScreenMusic)) StopMusicStream(titleScreenMusic);
-        if (IsMusicStreamPlaying(loongSelectMusic)) StopMusicStream(loongSelectMusic);
+        // Auto-complete message
+        int autoWidth = MeasureText("Hand Auto-Completed!", 24);
+        DrawText("Hand Auto-Completed!", canvasWidth/2 - autoWidth/2, canvasHeight/2 + 20, 24, WHITE);
 
-        if (currentGameOverMusic.stream.buffer != NULL) {
-            PlayMusicStream(currentGameOverMusic);
-            cout << "Started playing game over music" << endl;
+        // Reset timer after 2 seconds
+        if (cosmicTimer > 2.0f) {
+            cosmicTimer = 0.0f;
         }
     }
 
-    void ResetGame() {
-        // Reset game state for new game (similar to HandleDeath but without GAME_OVER)
-        snake.Reset();
-        food.position = food.GenerateRandomPos(snake.body);
-        cout << "🔄 RESETTING GAME with selectedLatentLevel: " << selectedLatentLevel << endl;
-        mahjongTiles.GenerateRandomTiles(0);
-
-        // Reset ornate level and mahjong wins
-        ornateLevel = LEVEL_1_NONE;
-        mahjongWins = 0;
-        mahjongWinsAchieved = 0; // Reset difficulty tracking
-
-        // Reset age and choice systems
-        snakeAge = 0;
-        snakeLength = snake.body.size(); // Initialize with starting snake length
-        showChoiceWindow = false;
-        showKongWin = false;
-        showLoongUpgrade = false;
-        showPhoenixRebirth = false;
-        showCosmicWisdom = false;
-        fruitCounter = 0;
-
-        // Reset LOONG upgrades (keep selected LOONG but reset temporary effects)
-        currentSpeedMultiplier = 1.0f;
-        currentProbabilityBonus = 0.0f;
-
-        // Reset LOONG effect variables
-        mahjongScoreMultiplier = 1.0f;
-        kongScoreMultiplier = 1.0f;
-        wallImmunities = 0;
-        teleportCharges = 0;
-        // REMOVED: Legacy auto-complete system
-        loongWinMultiplier = 3;
-        phoenixRebirth = false;
-        phoenixCharges = 0;
-        celestialRebirth = false;
-        celestialCharges = 0;
-
-        // Reset zero tile system
-        purificationCounter = 0;
-        purificationThreshold = 15;
-        divineShieldZeros = 3;
-
-        // Reset color mixing system
-        mixedLoongTypes.clear();
-
-        // Reset advanced LOONG effects
-        shadowCloneCharges = 0;
-        earthquakeCounter = 0;
-        earthquakeThreshold = 10;
-        tornadoCounter = 0;
-        tornadoThreshold = 7;
-        healingCounter = 0;
-        graniteWillActive = false;
-
-        // Reset upgrade tile system
-        upgradeSpawned = false;
-        tilesConsumedSinceUpgrade = 0;
-        nextUpgradeThreshold = 10;
-        isGraniteWillActive = false;
-
-        // Reset latent cultivation spawning
-        latentCultivationSpawned = false;
-        pendingLatentUpgrades.clear();
-        latentUpgradeSpawnTimer = 0.0f;
-        latentUpgradeSpawned = false;
-
-        // Reset tile locking system
-        mahjongTiles.futureTilesLocked = false;
-        mahjongTiles.lockedTilesRemaining = 0;
-        mahjongTiles.lockedFutureTiles.clear();
-
-        // Reset all power-up effects
-        slowGrowthActive = false;
-        mahjongNerfActive = false;
-        speedDemonActive = false;
-        luckyNumbersActive = false;
-        minimalistActive = false;
-        turtleModeActive = false;
-        gamblerActive = false;
-        perfectionistActive = false;
-        collectorActive = false;
-        survivorActive = false;
-        speedsterActive = false;
-        monkActive = false;
-        extraLives = 0;
-        phoenixRebirthCharges = 0;
-
-        // Reset debug variables
-        currentSpeedMultiplier = 1.0f;
-        currentProbabilityBonus = 0.0f;
-        isInExtraLifeMode = false;
-        lastExtraLifeType = "";
-        lastOrnateLevel = -1;
-
-        // Reset kong wins and tile system
-        kongWins = 0;
-        totalWins = 0;
-        currentTileCount = 4;
-        waterHealingAmount = 0;
-        windLengthReduction = 0;
-
-        // Reset tile system completely
-        mahjongTiles.availableTypes.clear();
-        mahjongTiles.availableTypes.push_back(PLAIN_TILES);
-        mahjongTiles.goldTiles.clear();
-        mahjongTiles.tileCounts.clear();
-
-        // Reinitialize tile counts
-        for (int i = 1; i <= 9; i++) {
-            mahjongTiles.tileCounts[make_pair(i, PLAIN_TILES)] = 0;
-            mahjongTiles.tileCounts[make_pair(i, HAT_TILES)] = 0;
-            mahjongTiles.tileCounts[make_pair(i, DOT_TILES)] = 0;
-        }
-
-        mahjongTiles.SetTileCount(4, 0);
-
-        // CRITICAL FIX: Generate fresh next tile after complete reset
-        mahjongTiles.GenerateNextTile(0.0f);
-        cout << "Fresh next tile generated after reset: " << mahjongTiles.nextTile.ToString() << endl;
-
-        score = 0;
-    }
-
     void LoadHighScore()
     {
 #ifdef PLATFORM_WEB
@@ -5977,8 +2869,16 @@ public:
 #endif
     }
 
-    void SaveHighScore()
+    // Ticks a rewind simulates again (quietly, or as the death replay) were played once
+    // already, and the progress they score doesn't stay (see RewindBuffer)
+    bool RewoundTicks() const
+    {
+        return quietTicks || rewind.IsPlaying();
+    }
+
+    void SaveHighScore() override
     {
+        if (RewoundTicks()) return;
 #ifdef PLATFORM_WEB
         // For web version, save to localStorage
         EM_ASM({
@@ -5995,7 +2895,8 @@ public:
 #endif
     }
 
-    void SaveProgressData() {
+    void SaveProgressData() override {
+        if (RewoundTicks()) return;
 #ifdef PLATFORM_WEB
         // For web version, save to localStorage as JSON-like string
         string progressData = "";
@@ -6072,7 +2973,7 @@ public:
 #endif
     }
 
-    void LoadProgressData() {
+    void LoadProgressData() override {
 #ifdef PLATFORM_WEB
         // For web version, try to load from localStorage
         char* progressData = (char*)EM_ASM_PTR({
@@ -6196,58 +3097,6 @@ public:
 #endif
     }
 
-    void CheckCollisionWithTail()
-    {
-        deque<Vector2> headlessBody = snake.body;
-        headlessBody.pop_front();
-        if (ElementInDeque(snake.body[0], headlessBody))
-        {
-            // Move head back to previous valid position immediately by shrinking
-            if (snake.body.size() > 1) {
-                snake.body.pop_front();
-            }
-            snake.direction = {0, 0}; // Hard stop: prevent tunneling through body
-
-            // Check for Granite Will immunity (Earth/White LOONG)
-            if (isGraniteWillActive && wallImmunities > 0) {
-                wallImmunities--;
-                cout << ">>> GRANITE WILL IMMUNITY: Stopped snake! Immunities remaining: " << wallImmunities << endl;
-
-                // Stop the snake instead of death - move back one step
-                if (snake.body.size() > 1) {
-                    snake.body[0] = snake.body[1]; // Move head back to previous position
-                }
-
-                // Play immunity sound (optimized)
-                PlaySoundSafe(eatSound, 1.5f, GetTime(), lastSoundTime, soundCooldown);
-
-                return; // Don't die, just stop
-            }
-
-            // Check for teleport charges (Shadow LOONG Dimensional Rift)
-            if (teleportCharges > 0) {
-                teleportCharges--;
-                cout << ">>> DIMENSIONAL RIFT ACTIVATED! Teleporting to safety! Charges remaining: " << teleportCharges << endl;
-
-                // Teleport snake to random safe position
-                Vector2 safePos;
-                do {
-                    safePos.x = GetRandomValue(2, cellCount - 3);
-                    safePos.y = GetRandomValue(2, cellCount - 3);
-                } while (ElementInDeque(safePos, snake.body));
-
-                snake.body[0] = safePos;
-
-                // Play special teleport sound (optimized)
-                PlaySoundSafe(eatSound, 0.6f, GetTime(), lastSoundTime, soundCooldown);
-
-                return; // Don't die
-            }
-
-            HandleDeath();
-        }
-    }
-
     // Latent upgrade display
     void DrawLatentUpgradeInfo() {
         int upgradeX = canvasWidth - 450;
@@ -6401,92 +3250,900 @@ public:
             }
         }
     }
+};
+
+#ifdef LOONG_BENCHMARK
+// FRUIT BENCHMARK: Average cost of one CheckCollisionWithFood call on a full hand
+// Build with -DLOONG_BENCHMARK; runs on GameCore, gameplay logging is muted while timing
+void RunFruitBenchmark(int fruits = 20000) {
+    GameCore game(12345); // No window, audio or save files
+
+    // Late-game setup: 13 tiles, all three tile types, probability bonus active
+    game.gameState = PLAYING;
+    game.ornateLevel = LEVEL_3_INTRICATE;
+    game.currentTileCount = 13;
+    game.currentProbabilityBonus = 100.0f;
+    game.mahjongWinsRequired = INT_MAX; // Never leave PLAYING through a LOONG win
+    game.nextUpgradeThreshold = INT_MAX; // No upgrade tiles blocking the food
+    game.mahjongTiles.availableTypes = (1u << PLAIN_TILES) | (1u << HAT_TILES) | (1u << DOT_TILES);
+    game.mahjongTiles.RedrawCompleteHand(13, LEVEL_3_INTRICATE);
+    game.mahjongTiles.GenerateNextTile(game.currentProbabilityBonus);
+
+    streambuf* savedBuffer = cout.rdbuf(nullptr);
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < fruits; i++) {
+        game.mahjongTiles.arrowPosition = i % (game.mahjongTiles.maxTiles + 1);
+        game.food.position = game.snake.body[0];
+        game.CheckCollisionWithFood();
+    }
+    auto end = chrono::steady_clock::now();
+    cout.rdbuf(savedBuffer);
+
+    double totalUs = chrono::duration<double, micro>(end - start).count();
+    cout << "=== FRUIT BENCHMARK ===" << endl;
+    cout << "Fruits eaten: " << fruits << " (Mahjong wins: " << game.mahjongWins << ")" << endl;
+    cout << "CheckCollisionWithFood: " << totalUs / fruits << " us per fruit" << endl;
+}
+
+// TILE DRAW BENCHMARK: GenerateValidTile at 13 tiles with several KONG tiles out of the pool
+void RunTileDrawBenchmark(int draws = 200000) {
+    MahjongTiles mahjong;
+    mahjong.random.Seed(12345);
+    mahjong.availableTypes = (1u << PLAIN_TILES) | (1u << HAT_TILES) | (1u << DOT_TILES);
+    mahjong.RedrawCompleteHand(13, LEVEL_3_INTRICATE);
+
+    // Four KONGs, one or more per tile type
+    for (pair<int, TileType> tileKey : {make_pair(1, PLAIN_TILES), make_pair(5, HAT_TILES),
+                                        make_pair(9, DOT_TILES), make_pair(7, PLAIN_TILES)}) {
+        mahjong.SetGold(tileKey);
+    }
+    mahjong.PoolChanged();
+
+    // Every draw is discarded, and the discards are reshuffled in before the wall runs dry
+    // (an empty wall would clear the KONGs)
+    streambuf* savedBuffer = cout.rdbuf(nullptr);
+    long long valueSum = 0;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < draws; i++) {
+        Tile tile = mahjong.GenerateValidTile(100.0f);
+        valueSum += tile.value;
+        mahjong.AddToDiscardPile(tile);
+        if (mahjong.wall.Size() < 8) mahjong.ReshuffleTiles();
+    }
+    auto end = chrono::steady_clock::now();
+    cout.rdbuf(savedBuffer);
+
+    double totalUs = chrono::duration<double, micro>(end - start).count();
+    cout << "=== TILE DRAW BENCHMARK ===" << endl;
+    cout << "Tiles drawn: " << draws << " (KONGs: " << __builtin_popcount(mahjong.goldTiles) << ", value sum: " << valueSum << ")" << endl;
+    cout << "GenerateValidTile: " << totalUs / draws << " us per draw" << endl;
+}
+
+// BATCH WIN BENCHMARK: CheckWinConditionBatch vs one CheckWinCondition call per hand
+void RunBatchWinBenchmark(int hands = 200000) {
+    MahjongTiles mahjong;
+    RandomGenerator random; // Test hands
+    random.Seed(12345);
+    const int ornateLevel = LEVEL_4_DRAGON; // LOONG wins count too
+
+    // Near-complete 5/8/11/14-tile hands with zeros and some LOONG runs, half with one tile swapped
+    vector<TileCounts> testHands;
+    vector<WinEvaluator::PackedHand> packedHands;
+    while ((int)testHands.size() < hands) {
+        TileCounts hand;
+        int groups = random.Value(1, 4);
+        if (groups == 4 && random.Value(0, 9) == 0) {
+            TileType type = (TileType)random.Value(0, 2);
+            for (int value = 1; value <= 9; value++) hand[{value, type}]++;
+            for (int extra = 0; extra < 5; extra++) hand[{random.Value(1, 9), (TileType)random.Value(0, 2)}]++;
+        } else {
+            for (int group = 0; group <= groups; group++) {
+                TileType type = (TileType)random.Value(0, 2);
+                int value = random.Value(0, 9);
+                if (value == 0) type = PLAIN_TILES; // Only plain zeros exist
+                if (group == groups) {
+                    hand[{value, type}] += 2; // Pair
+                } else if (value == 0 || random.Value(0, 1) == 0) {
+                    hand[{value, type}] += 3; // Triplet
+                } else {
+                    int start = random.Value(1, 7); // Consecutive
+                    for (int offset = 0; offset < 3; offset++) hand[{start + offset, type}]++;
+                }
+            }
+        }
+        if (random.Value(0, 1) == 0) {
+            int slot = 0;
+            while (hand[slot] == 0) slot = random.Value(0, TileCounts::SLOTS - 1);
+            hand[slot]--;
+            hand[{random.Value(0, 9), (TileType)random.Value(0, 2)}]++;
+        }
+
+        WinEvaluator::PackedHand packed;
+        if (!WinEvaluator::PackSuits(hand, packed)) continue; // 8+ copies of a tile
+        testHands.push_back(hand);
+        packedHands.push_back(packed);
+    }
+
+    // CheckWinCondition takes a hand plus the new tile
+    vector<vector<Tile>> handTiles(hands);
+    vector<Tile> newTiles(hands);
+    for (int i = 0; i < hands; i++) {
+        for (int slot = 0; slot < TileCounts::SLOTS; slot++) {
+            for (int copy = 0; copy < testHands[i][slot]; copy++) {
+                pair<int, TileType> tileKey = TileCounts::Key(slot);
+                handTiles[i].push_back(Tile(tileKey.first, tileKey.second, false));
+            }
+        }
+        newTiles[i] = handTiles[i].back();
+        handTiles[i].pop_back();
+    }
+
+    streambuf* savedBuffer = cout.rdbuf(nullptr);
+    vector<bool> referenceWins(hands);
+    auto referenceStart = chrono::steady_clock::now();
+    for (int i = 0; i < hands; i++) {
+        mahjong.tiles.swap(handTiles[i]);
+        referenceWins[i] = mahjong.CheckWinCondition(newTiles[i], ornateLevel);
+        mahjong.tiles.swap(handTiles[i]);
+    }
+    auto referenceEnd = chrono::steady_clock::now();
+    cout.rdbuf(savedBuffer);
+
+    vector<bool> scalarWins(hands);
+    auto scalarStart = chrono::steady_clock::now();
+    for (int i = 0; i < hands; i++) {
+        scalarWins[i] = winEvaluator.EvaluatePacked(packedHands[i], ornateLevel >= LEVEL_4_DRAGON);
+    }
+    auto scalarEnd = chrono::steady_clock::now();
+
+    vector<unsigned long long> winBits((hands + 63) / 64);
+    auto batchStart = chrono::steady_clock::now();
+    mahjong.CheckWinConditionBatch(packedHands.data(), hands, ornateLevel, winBits.data());
+    auto batchEnd = chrono::steady_clock::now();
+
+    int wins = 0, mismatches = 0;
+    for (int i = 0; i < hands; i++) {
+        bool batchWin = (winBits[i / 64] >> (i % 64)) & 1;
+        if (referenceWins[i]) wins++;
+        if (scalarWins[i] != referenceWins[i] || batchWin != referenceWins[i]) mismatches++;
+    }
+
+    string kernel = "scalar";
+#ifdef LOONG_AVX2_KERNEL
+    if (__builtin_cpu_supports("avx2")) kernel = "AVX2";
+#endif
+    double referenceSeconds = chrono::duration<double>(referenceEnd - referenceStart).count();
+    double scalarSeconds = chrono::duration<double>(scalarEnd - scalarStart).count();
+    double batchSeconds = chrono::duration<double>(batchEnd - batchStart).count();
+    cout << "=== BATCH WIN BENCHMARK ===" << endl;
+    cout << "Hands checked: " << hands << " (wins: " << wins << ", mismatches: " << mismatches << ")" << endl;
+    cout << "CheckWinCondition: " << hands / referenceSeconds / 1e6 << " M hands/s" << endl;
+    cout << "Packed scalar: " << hands / scalarSeconds / 1e6 << " M hands/s" << endl;
+    cout << "Batch (" << kernel << "): " << hands / batchSeconds / 1e6 << " M hands/s" << endl;
+}
+
+// WIN CHECK BENCHMARK: fast evaluator vs the reference search on late-game 14-tile hands
+void RunWinCheckBenchmark(int hands = 20000) {
+    MahjongTiles mahjong;
+    RandomGenerator random; // Test hands
+    random.Seed(12345);
+
+    // Near-complete hands: 4 random groups + 1 pair, half of them with one tile swapped out
+    vector<TileCounts> testHands(hands);
+    for (TileCounts& hand : testHands) {
+        for (int group = 0; group < 5; group++) {
+            TileType type = (TileType)random.Value(0, 2);
+            if (group == 4) {
+                hand[{random.Value(1, 9), type}] += 2; // Pair
+            } else if (random.Value(0, 1) == 0) {
+                hand[{random.Value(1, 9), type}] += 3; // Triplet
+            } else {
+                int start = random.Value(1, 7); // Consecutive
+                hand[{start, type}]++;
+                hand[{start + 1, type}]++;
+                hand[{start + 2, type}]++;
+            }
+        }
+        if (random.Value(0, 1) == 0) {
+            int slot = 0;
+            while (hand[slot] == 0) slot = random.Value(0, TileCounts::SLOTS - 1);
+            hand[slot]--;
+            hand[{random.Value(1, 9), (TileType)random.Value(0, 2)}]++;
+        }
+    }
+
+    int referenceWins = 0;
+    auto referenceStart = chrono::steady_clock::now();
+    for (const TileCounts& hand : testHands) {
+        if (mahjong.TryAllGroupCombinations(hand, 4, 14)) referenceWins++;
+    }
+    auto referenceEnd = chrono::steady_clock::now();
+
+    int searchWins = 0;
+    auto searchStart = chrono::steady_clock::now();
+    for (const TileCounts& hand : testHands) {
+        TileCounts counts = hand;
+        if (winEvaluator.CanComplete(counts, 14)) searchWins++;
+    }
+    auto searchEnd = chrono::steady_clock::now();
+
+    int tableWins = 0;
+    auto tableStart = chrono::steady_clock::now();
+    for (const TileCounts& hand : testHands) {
+        TileCounts counts = hand;
+        if (winEvaluator.IsWinningHand(counts, 4)) tableWins++;
+    }
+    auto tableEnd = chrono::steady_clock::now();
+
+    double referenceUs = chrono::duration<double, micro>(referenceEnd - referenceStart).count();
+    double searchUs = chrono::duration<double, micro>(searchEnd - searchStart).count();
+    double tableUs = chrono::duration<double, micro>(tableEnd - tableStart).count();
+    cout << "=== WIN CHECK BENCHMARK ===" << endl;
+    cout << "Hands checked: " << hands << " (wins: " << referenceWins << " reference, " << searchWins << " search, " << tableWins << " table)" << endl;
+    cout << "Reference search: " << referenceUs / hands << " us per hand" << endl;
+    cout << "Memoized search: " << searchUs / hands << " us per hand" << endl;
+    cout << "Agari table: " << tableUs / hands << " us per hand" << endl;
+}
+
+// TAIL COLLISION BENCHMARK: CheckCollisionWithTail on long snakes vs the old check, which
+// copied the body twice and compared every segment
+void RunTailCollisionBenchmark(int checks = 100000) {
+    cout << "=== TAIL COLLISION BENCHMARK ===" << endl;
+    for (int length : {50, 150, 300, 390}) {
+        // Back and forth over the rows from the top left, head last: nothing overlaps the head
+        streambuf* savedBuffer = cout.rdbuf(nullptr);
+        GameCore game(12345);
+        cout.rdbuf(savedBuffer);
+        game.snake.body.clear();
+        for (int i = 0; i < length; i++) {
+            int row = i / cellCount;
+            int column = row % 2 == 0 ? i % cellCount : cellCount - 1 - i % cellCount;
+            game.snake.body.push_front({(float)column, (float)row});
+        }
+        game.snake.RebuildOccupancy();
+
+        int referenceHits = 0;
+        auto referenceStart = chrono::steady_clock::now();
+        for (int i = 0; i < checks; i++) {
+            deque<Vector2> headlessBody(game.snake.body.begin(), game.snake.body.end());
+            headlessBody.pop_front();
+            deque<Vector2> scanned = headlessBody; // ElementInDeque took its deque by value
+            for (const Vector2& cell : scanned) {
+                if (SameCell(cell, game.snake.body[0])) {
+                    referenceHits++;
+                    break;
+                }
+            }
+        }
+        auto referenceEnd = chrono::steady_clock::now();
+
+        auto gridStart = chrono::steady_clock::now();
+        for (int i = 0; i < checks; i++) {
+            game.CheckCollisionWithTail();
+        }
+        auto gridEnd = chrono::steady_clock::now();
+
+        double referenceUs = chrono::duration<double, micro>(referenceEnd - referenceStart).count();
+        double gridUs = chrono::duration<double, micro>(gridEnd - gridStart).count();
+        cout << "Length " << length << ": copy + scan " << referenceUs / checks << " us, occupancy grid "
+             << gridUs / checks * 1000.0 << " ns (" << referenceHits << " hits, still alive: " << (game.gameState != GAME_OVER) << ")" << endl;
+    }
+}
+
+// SAFE CELL BENCHMARK: SafeCellFinder::Find on boards from the game's 20 x 20 up to 128 x 128,
+// each with its top half covered by a coiled snake (open corridors between the coils) and a
+// wall splitting the bottom half into two regions
+void RunSafeCellBenchmark(int queries = 2000) {
+    cout << "=== SAFE CELL BENCHMARK ===" << endl;
+    for (int side : {20, 64, 128}) {
+        Occupancy occupancy;
+        occupancy.Clear(side);
+        for (int y = 0; y < side / 2; y++) {
+            for (int x = 0; x < side; x++) {
+                if (y % 2 == 0 || y == side / 2 - 1 || x == (y % 4 == 1 ? side - 1 : 0)) occupancy.Add({(float)x, (float)y});
+            }
+        }
+        for (int y = side / 2; y < side; y++) {
+            occupancy.Add({(float)(side / 3), (float)y});
+        }
+
+        SafeCellFinder finder;
+        Vector2 cell = {0, 0};
+        int found = 0;
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < queries; i++) {
+            if (finder.Find(occupancy, cell)) found++;
+        }
+        double us = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+        cout << side << " x " << side << ": " << us / queries << " us per query, lands on (" << cell.x << ", " << cell.y
+             << "), " << found << "/" << queries << " found" << endl;
+    }
+}
+
+// DISTANCE FIELD BENCHMARK: head-to-tile distances each tick from TileDistanceField vs a
+// search of the whole board every tick, on boards from 20 x 20 to 512 x 512
+// The snake fills the top quarter in coils and heads down through the open part, and the
+// food and the two upgrade tiles sit below it.
+void RunDistanceFieldBenchmark() {
+    cout << "=== DISTANCE FIELD BENCHMARK ===" << endl;
+    int savedCellCount = cellCount;
+    for (int side : {20, 128, 512}) {
+        cellCount = side;
+        Snake snake;
+        snake.body.clear();
+        int rows = side / 4;
+        for (int i = 0; i < rows * side; i++) {
+            int row = i / side;
+            int column = row % 2 == 0 ? i % side : side - 1 - i % side;
+            snake.body.push_front({(float)column, (float)row});
+        }
+        snake.RebuildOccupancy();
+        snake.direction = {0, 1};
+        Vector2 targets[3] = {{(float)(side / 2), (float)(side * 3 / 4)}, {(float)(side / 4), (float)(side - 2)}, {(float)(side - 3), (float)(side / 2 + 1)}};
+        int ticks = side / 2;
+
+        TileDistanceField fields[3];
+        vector<int> fullDistances(side * side);
+        vector<int> fullQueue(side * side);
+        double fieldUs = 0.0, fullUs = 0.0;
+        long long touched = 0, checksum = 0;
+        int mismatches = 0;
+        for (int tick = 0; tick < ticks; tick++) {
+            snake.Update();
+
+            auto fieldStart = chrono::steady_clock::now();
+            int fieldAnswers[3];
+            for (int t = 0; t < 3; t++) fieldAnswers[t] = fields[t].Distance(snake.occupancy, targets[t], snake.body[0]);
+            auto fieldEnd = chrono::steady_clock::now();
+            for (int t = 0; t < 3; t++) touched += fields[t].Touched();
+
+            // Whole board from scratch, the way a per-tick rebuild would
+            fill(fullDistances.begin(), fullDistances.end(), TileDistanceField::UNREACHABLE);
+            int head = 0, tail = 0;
+            int start = (int)snake.body[0].y * side + (int)snake.body[0].x;
+            fullDistances[start] = 0;
+            fullQueue[tail++] = start;
+            while (head < tail) {
+                int index = fullQueue[head++];
+                int x = index % side, y = index / side;
+                int neighbours[4] = {x > 0 ? index - 1 : -1, x < side - 1 ? index + 1 : -1, y > 0 ? index - side : -1, y < side - 1 ? index + side : -1};
+                for (int next : neighbours) {
+                    if (next < 0 || snake.occupancy.counts[next] > 0 || fullDistances[next] != TileDistanceField::UNREACHABLE) continue;
+                    fullDistances[next] = fullDistances[index] + 1;
+                    fullQueue[tail++] = next;
+                }
+            }
+            auto fullEnd = chrono::steady_clock::now();
 
-    // Latent upgrade system
-    void InitializeLatentUpgrades() {
-        for (int i = 0; i < 9; i++) {
-            loongTotalScores[(LoongType)i] = 0;
-            loongUpgradeLevel[(LoongType)i] = 0;
+            for (int t = 0; t < 3; t++) {
+                int expected = fullDistances[(int)targets[t].y * side + (int)targets[t].x];
+                if (fieldAnswers[t] != expected) mismatches++;
+                checksum += fieldAnswers[t];
+            }
+            fieldUs += chrono::duration<double, micro>(fieldEnd - fieldStart).count();
+            fullUs += chrono::duration<double, micro>(fullEnd - fieldEnd).count();
         }
-        cout << "Latent upgrade system initialized" << endl;
+        cout << side << " x " << side << " (length " << snake.body.size() << "): field " << fieldUs / ticks << " us per tick ("
+             << touched / ticks << " cells updated), whole board " << fullUs / ticks << " us, " << mismatches
+             << " mismatches (checksum " << checksum << ")" << endl;
+    }
+    cellCount = savedCellCount;
+}
+
+// One bot-driven gameplay tick, the way loong_sim plays
+void PlayBotTick(GameCore& game, BotPolicy& bot, RandomGenerator& clicks) {
+    if (!AnswerPromptsAtRandom(game, clicks)) {
+        ApplyBotAction(game, bot.Act(BotView(game)));
+    }
+    game.UpdateGameplay(GAMEPLAY_TICK_DELTA);
+    game.UpdateTimers(GAMEPLAY_TICK_DELTA);
+}
+
+// SNAPSHOT BENCHMARK: SaveSnapshot / LoadSnapshot cost on a long run, and the round-trip check
+// The restored game has to save the same bytes, hash the same and play on tick for tick
+// like the original; a cut-off blob has to be refused
+void RunSnapshotBenchmark(int snapshots = 20000, int checkTicks = 2000) {
+    streambuf* savedBuffer = cout.rdbuf(nullptr);
+    GameCore game(12345);
+    game.StartRun(FIRE_LOONG, FOUNDATION_BUILDING);
+    BfsBot bot;
+    bot.Seed(12345);
+    RandomGenerator clicks;
+    clicks.Seed(54321);
+    int ticksPlayed = 0;
+    for (; ticksPlayed < 1500 && game.gameState == PLAYING; ticksPlayed++) {
+        PlayBotTick(game, bot, clicks); // Grow the snake, the discards and the upgrades
+    }
+
+    vector<uint8_t> blob;
+    size_t snapshotLength = game.snake.body.size();
+    auto saveStart = chrono::steady_clock::now();
+    for (int i = 0; i < snapshots; i++) {
+        game.SaveSnapshot(blob);
+    }
+    auto saveEnd = chrono::steady_clock::now();
+
+    GameCore restored(99); // Different seed, still on the title screen
+    int mismatches = 0;
+    if (restored.LoadSnapshot(blob.data(), blob.size() - 1)) mismatches++;
+    auto loadStart = chrono::steady_clock::now();
+    for (int i = 0; i < snapshots; i++) {
+        if (!restored.LoadSnapshot(blob.data(), blob.size())) mismatches++;
+    }
+    auto loadEnd = chrono::steady_clock::now();
+
+    vector<uint8_t> restoredBlob;
+    restored.SaveSnapshot(restoredBlob);
+    if (restoredBlob != blob) mismatches++;
+
+    BfsBot restoredBot = bot;
+    RandomGenerator restoredClicks = clicks;
+    int ticksChecked = 0;
+    for (; ticksChecked < checkTicks && game.gameState == PLAYING; ticksChecked++) {
+        if (restored.StateHash() != game.StateHash()) mismatches++;
+        PlayBotTick(game, bot, clicks);
+        PlayBotTick(restored, restoredBot, restoredClicks);
+    }
+    vector<uint8_t> finalBlob;
+    game.SaveSnapshot(finalBlob);
+    restored.SaveSnapshot(restoredBlob);
+    if (restoredBlob != finalBlob) mismatches++;
+    cout.rdbuf(savedBuffer);
+
+    double saveUs = chrono::duration<double, micro>(saveEnd - saveStart).count();
+    double loadUs = chrono::duration<double, micro>(loadEnd - loadStart).count();
+    cout << "=== SNAPSHOT BENCHMARK ===" << endl;
+    cout << "Snapshot: " << blob.size() << " bytes after " << ticksPlayed << " ticks (length " << snapshotLength << ")" << endl;
+    cout << "SaveSnapshot: " << saveUs / snapshots << " us" << endl;
+    cout << "LoadSnapshot: " << loadUs / snapshots << " us" << endl;
+    cout << "Round trip: " << ticksChecked << " ticks replayed from the copy, " << mismatches << " mismatches" << endl;
+}
+
+// The input a bot gives this tick as a replay input, false for none: windows take their first
+// pick, an extra life resumes at once, otherwise the bot may turn
+bool BotReplayInput(GameCore& game, BotPolicy& bot, ReplayInputKind& kind, uint64_t& argument) {
+    argument = 0;
+    if (game.showLoongUpgrade) kind = REPLAY_UPGRADE;
+    else if (game.showChoiceWindow) kind = REPLAY_CHOICE;
+    else if (game.isInExtraLifeMode) kind = REPLAY_RESUME;
+    else {
+        BotAction action = bot.Act(BotView(game));
+        bool turning = action.direction.x != 0 || action.direction.y != 0;
+        if (!turning || IsReverse(action.direction, game.snake.direction) || SameCell(action.direction, game.snake.direction)) return false;
+        kind = REPLAY_DIRECTION;
+        argument = ReplayDirectionCode(action.direction);
+    }
+    return true;
+}
+
+// A bot run recorded the way ReplayRecorder stores it, built in memory; inserted inputs go in
+// before the tick they're stamped with
+vector<uint8_t> EncodeReplay(const ReplayHeader& header, const vector<RewindInput>& inputs, uint64_t ticks,
+                             const ReplayOutcome& outcome, uint32_t finalHash) {
+    vector<uint8_t> bytes;
+    AppendReplayHeader(bytes, header);
+    uint64_t lastTick = 0;
+    for (const RewindInput& input : inputs) {
+        AppendReplayInput(bytes, input.tick - lastTick, input.kind, input.argument);
+        lastTick = input.tick;
+    }
+    AppendReplayEnd(bytes, ticks - lastTick, outcome, finalHash);
+    return bytes;
+}
+
+// REPLAY CHECK: VerifyReplay on bot runs, honest and forged
+// The honest run has to verify; the same run with upgrade or choice inputs added while no
+// window is open (the old way to buy LOONG levels) has to be refused at the tick they came
+void RunReplayCheck(int runs = 8, int maxTicks = 3000) {
+    streambuf* savedBuffer = cout.rdbuf(nullptr);
+    int honestOk = 0, forgedRefused = 0, forgedRuns = 0, mistakes = 0;
+    for (int run = 0; run < runs; run++) {
+        ReplayHeader header;
+        header.runSeed = 1000 + run;
+        header.loongType = (LoongType)(run % (PATIENCE_LOONG + 1));
+        GameCore game(header.runSeed);
+        StartReplayRun(game, header);
+        BfsBot bot;
+        bot.Seed(run);
+
+        // Play through ApplyReplayInput only, keeping every input and a checkpoint each
+        // REPLAY_CHECKPOINT_TICKS ticks
+        vector<RewindInput> inputs;
+        ReplayOutcome outcome;
+        outcome.Update(game);
+        uint64_t firstUpgradeTick = 0;
+        uint64_t tick = 0;
+        auto input = [&](ReplayInputKind kind, uint64_t argument) {
+            if (!ApplyReplayInput(game, kind, argument)) mistakes++;
+            inputs.push_back({tick, kind, argument});
+        };
+        for (; tick < (uint64_t)maxTicks && game.gameState == PLAYING; ) {
+            ReplayInputKind kind;
+            uint64_t argument;
+            if (BotReplayInput(game, bot, kind, argument)) {
+                input(kind, argument);
+                if (kind == REPLAY_UPGRADE && firstUpgradeTick == 0) firstUpgradeTick = tick + 1;
+            }
+            game.UpdateGameplay(GAMEPLAY_TICK_DELTA);
+            outcome.Update(game);
+            tick++;
+            if (tick % REPLAY_CHECKPOINT_TICKS == 0) inputs.push_back({tick, REPLAY_CHECKPOINT, ReplayHash(game)});
+        }
+        uint32_t finalHash = ReplayHash(game);
+
+        vector<uint8_t> honest = EncodeReplay(header, inputs, tick, outcome, finalHash);
+        if (VerifyReplay(honest.data(), honest.size()).Verified()) honestOk++;
+        if (firstUpgradeTick == 0 || firstUpgradeTick >= tick) continue;
+
+        // Nine more picks from the closed upgrade window, then a choice nobody offered
+        for (ReplayInputKind kind : {REPLAY_UPGRADE, REPLAY_CHOICE}) {
+            vector<RewindInput> forged = inputs;
+            size_t at = 0;
+            while (at < forged.size() && forged[at].tick < firstUpgradeTick) at++;
+            forged.insert(forged.begin() + at, kind == REPLAY_UPGRADE ? 9 : 1, {firstUpgradeTick, kind, 0});
+            vector<uint8_t> bytes = EncodeReplay(header, forged, tick, outcome, finalHash);
+            ReplayVerdict verdict = VerifyReplay(bytes.data(), bytes.size());
+            forgedRuns++;
+            if (!verdict.error.empty() && verdict.divergenceTick == firstUpgradeTick) forgedRefused++;
+        }
+    }
+    cout.rdbuf(savedBuffer);
+
+    cout << "=== REPLAY CHECK ===" << endl;
+    cout << "Honest runs verified: " << honestOk << " / " << runs << " (" << mistakes << " inputs refused while recording)" << endl;
+    cout << "Forged runs refused at the forged tick: " << forgedRefused << " / " << forgedRuns << endl;
+}
+
+// GameCore that keeps what it would have written to disk, saving nothing while rewound ticks
+// run, like the front end
+struct SaveProbe : GameCore {
+    bool rewound = false;
+    int savedHighScore = 0;
+    map<LoongType, int> savedTotalScores;
+
+    SaveProbe(uint64_t runSeed) : GameCore(runSeed) {}
+
+    void SaveHighScore() override {
+        if (!rewound) savedHighScore = highScore;
     }
 
-    void UpdateLoongTotalScore(int scoreGained) {
-        loongTotalScores[selectedLoongType] += scoreGained;
+    void SaveProgressData() override {
+        if (!rewound) savedTotalScores = loongTotalScores;
+    }
+};
 
-        // Debug output
-        cout << "Updated " << availableLOONGs[selectedLoongIndex].name << " total score: " << loongTotalScores[selectedLoongType] << " (+" << scoreGained << ")" << endl;
+// REWIND CHECK: the saved progress survives a rewind
+// A high score saved mid-run stays after rewinding past it and dying with a lower score,
+// and the latent totals neither go back nor count the rewound or replayed ticks twice
+void RunRewindCheck(int runs = 8, int ticks = 600) {
+    streambuf* savedBuffer = cout.rdbuf(nullptr);
+    int failures = 0;
+    for (int run = 0; run < runs; run++) {
+        SaveProbe game(2000 + run);
+        game.StartRun((LoongType)(run % (PATIENCE_LOONG + 1)), FOUNDATION_BUILDING);
+        game.mahjongWinsRequired = INT_MAX; // Stay in the run
+        BfsBot bot;
+        bot.Seed(run);
+        RewindBuffer rewind;
+        rewind.Begin(game);
+
+        int recordHigh = 0;
+        for (int tick = 0; tick < ticks && game.gameState == PLAYING; tick++) {
+            ReplayInputKind kind;
+            uint64_t argument;
+            if (BotReplayInput(game, bot, kind, argument)) {
+                rewind.Record(kind, argument);
+                ApplyReplayInput(game, kind, argument);
+            }
+            game.UpdateGameplay(GAMEPLAY_TICK_DELTA);
+            rewind.Tick(game);
+            if (tick == ticks / 2) { // A record saved the way a Mahjong win saves one
+                recordHigh = game.highScore = max(game.highScore, game.score) + 1000;
+                game.SaveHighScore();
+            }
+        }
+        if (game.gameState != PLAYING || recordHigh == 0) continue;
+        map<LoongType, int> totalScores = game.loongTotalScores;
+
+        // Watch the last ticks again, then rewind to before the record and die there
+        game.rewound = true;
+        rewind.StartPlayback(game, rewind.Ticks() - rewind.Ticks() / 4);
+        while (rewind.PlaybackTick(game)) {}
+        rewind.StopPlayback(game);
+        rewind.RewindTo(game, rewind.OldestTick());
+        game.rewound = false;
+        if (game.highScore != recordHigh || game.loongTotalScores != totalScores) failures++;
+
+        game.GameOver();
+        if (game.savedHighScore != recordHigh || game.savedTotalScores != totalScores) failures++;
+    }
+    cout.rdbuf(savedBuffer);
+
+    cout << "=== REWIND CHECK ===" << endl;
+    cout << "Saved progress after rewinding past a record and dying: " << failures << " failures in " << runs << " runs" << endl;
+}
+#endif
 
-        // Check for upgrade level increases
-        int oldLevel = loongUpgradeLevel[selectedLoongType];
-        int newLevel = 0;
+#ifdef LOONG_VALIDATOR
+// HAND VALIDATOR: every legal hand (hand + new tile) of one size over the enabled tile types,
+// checked by the reference search, the agari table and the batch kernel on all cores
+// Build with -DLOONG_VALIDATOR (see README); no window is opened
+struct ValidatorStats {
+    long long hands = 0;
+    long long mahjongWins = 0;
+    long long loongWins = 0;
+    long long tableMismatches = 0;
+    long long batchMismatches = 0;
+    double referenceSeconds = 0.0;
+    double tableSeconds = 0.0;
+    double batchSeconds = 0.0;
+
+    void Add(const ValidatorStats& other) {
+        hands += other.hands;
+        mahjongWins += other.mahjongWins;
+        loongWins += other.loongWins;
+        tableMismatches += other.tableMismatches;
+        batchMismatches += other.batchMismatches;
+        referenceSeconds += other.referenceSeconds;
+        tableSeconds += other.tableSeconds;
+        batchSeconds += other.batchSeconds;
+    }
+};
 
-        for (int i = 0; i < (int)latentUpgradeThresholds.size(); i++) {
-            if (loongTotalScores[selectedLoongType] >= latentUpgradeThresholds[i]) {
-                newLevel = i + 1;
+class HandValidator {
+public:
+    static const int CHUNK = 4096;    // Hands evaluated per timing block
+    static const int PREFIX_KINDS = 4; // Work items = counts of the first 4 tile kinds
+    static const int MAX_REPORTED = 10;
+
+    int handSize;
+    int requiredGroups;
+    bool runReference;
+    vector<int> kinds; // TileCounts slots that can appear: plain 0-9, then 1-9 of each other type
+    vector<vector<int>> workItems;
+    atomic<int> nextWorkItem;
+    mutex statsMutex;
+    ValidatorStats totals;
+    int reported;
+
+    HandValidator(int size, int tileTypes, bool reference) : nextWorkItem(0) {
+        handSize = size;
+        requiredGroups = (size - 2) / 3;
+        runReference = reference;
+        reported = 0;
+
+        kinds.push_back(TileCounts::Index(0, PLAIN_TILES)); // Only plain has a zero tile
+        for (int type = 0; type < tileTypes; type++) {
+            for (int value = 1; value <= 9; value++) {
+                kinds.push_back(TileCounts::Index(value, (TileType)type));
             }
         }
 
-        if (newLevel > oldLevel) {
-            loongUpgradeLevel[selectedLoongType] = newLevel;
-            cout << "🎉 " << availableLOONGs[selectedLoongIndex].name << " reached upgrade level " << newLevel << "! Total score: " << loongTotalScores[selectedLoongType] << " 🎉" << endl;
-            // Save immediately when level increases
-            SaveProgressData();
+        vector<int> prefix;
+        BuildWorkItems(prefix, 0);
+    }
+
+    void BuildWorkItems(vector<int>& prefix, int tilesUsed) {
+        if ((int)prefix.size() == PREFIX_KINDS) {
+            workItems.push_back(prefix);
+            return;
+        }
+        for (int count = 0; count <= 4 && tilesUsed + count <= handSize; count++) {
+            prefix.push_back(count);
+            BuildWorkItems(prefix, tilesUsed + count);
+            prefix.pop_back();
         }
     }
 
-    bool HasLatentUpgrade() {
-        return loongUpgradeLevel[selectedLoongType] > 0;
+    void Run(int threadCount) {
+        // One rules object and one evaluator (memo) per thread
+        streambuf* savedBuffer = cout.rdbuf(nullptr);
+        vector<MahjongTiles> rules(threadCount);
+        vector<WinEvaluator> evaluators(threadCount);
+        cout.rdbuf(savedBuffer);
+
+        vector<thread> workers;
+        for (int i = 0; i < threadCount; i++) {
+            workers.push_back(thread(&HandValidator::Worker, this, &rules[i], &evaluators[i]));
+        }
+        for (thread& worker : workers) {
+            worker.join();
+        }
     }
 
-    void SpawnLatentCultivationUpgrades() {
-        if (selectedLatentLevel <= 0) return;
+    struct Chunk {
+        TileCounts hands[CHUNK];
+        WinEvaluator::PackedHand packed[CHUNK];
+        int size = 0;
+    };
+
+    void Worker(MahjongTiles* rules, WinEvaluator* evaluator) {
+        ValidatorStats stats;
+        Chunk* chunk = new Chunk();
+
+        for (int item = nextWorkItem++; item < (int)workItems.size(); item = nextWorkItem++) {
+            TileCounts counts;
+            int tilesUsed = 0;
+            for (int k = 0; k < PREFIX_KINDS; k++) {
+                counts[kinds[k]] = workItems[item][k];
+                tilesUsed += workItems[item][k];
+            }
+            Enumerate(counts, PREFIX_KINDS, handSize - tilesUsed, *chunk, rules, evaluator, stats);
+        }
+        if (chunk->size > 0) EvaluateChunk(*chunk, rules, evaluator, stats);
+        delete chunk;
 
-        cout << "🌟 Queuing Latent Cultivation Level " << selectedLatentLevel << " LOONG evolution tiles!" << endl;
+        lock_guard<mutex> lock(statsMutex);
+        totals.Add(stats);
+    }
 
-        // Clear any existing queue
-        pendingLatentUpgrades.clear();
+    void Enumerate(TileCounts& counts, int kind, int remainingTiles, Chunk& chunk,
+                   MahjongTiles* rules, WinEvaluator* evaluator, ValidatorStats& stats) {
+        if (remainingTiles == 0) {
+            chunk.hands[chunk.size] = counts;
+            WinEvaluator::PackSuits(counts, chunk.packed[chunk.size]);
+            if (++chunk.size == CHUNK) EvaluateChunk(chunk, rules, evaluator, stats);
+            return;
+        }
+        if (kind == (int)kinds.size()) return;
+        if (remainingTiles > 4 * ((int)kinds.size() - kind)) return; // Can't place them all
 
-        // Count how many upgrade tiles to spawn based on level
-        int ownUpgrades = 0;
-        int otherUpgrades = 0;
+        for (int count = min(4, remainingTiles); count >= 0; count--) {
+            counts[kinds[kind]] = count;
+            Enumerate(counts, kind + 1, remainingTiles - count, chunk, rules, evaluator, stats);
+        }
+        counts[kinds[kind]] = 0;
+    }
 
-        if (selectedLatentLevel >= 1) ownUpgrades = 1;
-        if (selectedLatentLevel >= 2) otherUpgrades = 1;
-        if (selectedLatentLevel >= 3) ownUpgrades = 2;
-        if (selectedLatentLevel >= 4) ownUpgrades = 3;
-        if (selectedLatentLevel >= 5) otherUpgrades = 2;
+    void EvaluateChunk(Chunk& chunk, MahjongTiles* rules, WinEvaluator* evaluator, ValidatorStats& stats) {
+        bool referenceWins[CHUNK];
+        bool loongWins[CHUNK];
+        bool tableWins[CHUNK];
+        unsigned long long batchBits[2][CHUNK / 64];
 
-        // Add own LOONG evolution tiles to queue
-        for (int i = 0; i < ownUpgrades; i++) {
-            pendingLatentUpgrades.push_back(selectedLoongType);
+        auto referenceStart = chrono::steady_clock::now();
+        if (runReference) {
+            for (int i = 0; i < chunk.size; i++) {
+                referenceWins[i] = rules->TryAllGroupCombinations(chunk.hands[i], requiredGroups, handSize);
+                loongWins[i] = rules->HasLoongWin(chunk.hands[i]);
+            }
         }
+        auto tableStart = chrono::steady_clock::now();
+        for (int i = 0; i < chunk.size; i++) {
+            TileCounts counts = chunk.hands[i];
+            tableWins[i] = evaluator->IsWinningHand(counts, requiredGroups);
+        }
+        auto batchStart = chrono::steady_clock::now();
+        evaluator->EvaluateBatch(chunk.packed, chunk.size, false, batchBits[0]); // Before LEVEL_4_DRAGON
+        evaluator->EvaluateBatch(chunk.packed, chunk.size, true, batchBits[1]);  // LOONG wins allowed
+        auto batchEnd = chrono::steady_clock::now();
+
+        stats.referenceSeconds += chrono::duration<double>(tableStart - referenceStart).count();
+        stats.tableSeconds += chrono::duration<double>(batchStart - tableStart).count();
+        stats.batchSeconds += chrono::duration<double>(batchEnd - batchStart).count() / 2;
 
-        // Add other LOONG evolution tiles to queue
-        for (int i = 0; i < otherUpgrades; i++) {
-            // Pick a random other LOONG type
-            LoongType otherLoong;
-            do {
-                otherLoong = (LoongType)(rand() % 9);
-            } while (otherLoong == selectedLoongType);
+        for (int i = 0; i < chunk.size; i++) {
+            // Without the reference, the table is the baseline for the batch kernel
+            bool mahjongWin = runReference ? referenceWins[i] : tableWins[i];
+            bool loongWin = runReference ? loongWins[i] : rules->HasLoongWin(chunk.hands[i]);
+            bool batchPlain = (batchBits[0][i / 64] >> (i % 64)) & 1;
+            bool batchLoong = (batchBits[1][i / 64] >> (i % 64)) & 1;
 
-            pendingLatentUpgrades.push_back(otherLoong);
+            if (mahjongWin) stats.mahjongWins++;
+            if (loongWin) stats.loongWins++;
+            if (runReference && tableWins[i] != mahjongWin) {
+                stats.tableMismatches++;
+                Report("agari table", chunk.hands[i], mahjongWin, tableWins[i]);
+            }
+            if (batchPlain != mahjongWin || batchLoong != (mahjongWin || loongWin)) {
+                stats.batchMismatches++;
+                Report("batch kernel", chunk.hands[i], mahjongWin || loongWin, batchLoong);
+            }
         }
+        stats.hands += chunk.size;
+        chunk.size = 0;
+    }
 
-        // Start the spawning timer
-        latentUpgradeSpawnTimer = 0.5f; // Start spawning after 0.5 seconds
+    void Report(const char* evaluatorName, const TileCounts& counts, bool expected, bool got) {
+        lock_guard<mutex> lock(statsMutex);
+        if (reported++ >= MAX_REPORTED) return;
 
-        cout << "✅ Queued " << pendingLatentUpgrades.size() << " LOONG evolution tiles for spawning!" << endl;
+        cout << "MISMATCH (" << evaluatorName << "): ";
+        for (int slot = 0; slot < TileCounts::SLOTS; slot++) {
+            pair<int, TileType> tileKey = TileCounts::Key(slot);
+            for (int copy = 0; copy < counts[slot]; copy++) {
+                cout << Tile(tileKey.first, tileKey.second, false).ToString() << " ";
+            }
+        }
+        cout << "expected " << (expected ? "win" : "no win") << ", got " << (got ? "win" : "no win") << endl;
     }
 };
 
-int main()
+// Usage: [--size 5|8|11|14] [--types 1-3] [--threads N] [--no-reference]
+// Without --size, every hand size is checked with the most tile types the game allows for it
+int RunHandValidator(int argc, char** argv) {
+    int onlySize = 0;
+    int tileTypes = 0;
+    int threadCount = max(1u, thread::hardware_concurrency());
+    bool runReference = true;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) onlySize = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--types") == 0 && i + 1 < argc) tileTypes = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) threadCount = max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--no-reference") == 0) runReference = false;
+        else {
+            cout << "Unknown option: " << argv[i] << endl;
+            cout << "Usage: " << argv[0] << " [--size 5|8|11|14] [--types 1-3] [--threads N] [--no-reference]" << endl;
+            return 1;
+        }
+    }
+
+    string kernel = "scalar";
+#ifdef LOONG_AVX2_KERNEL
+    if (__builtin_cpu_supports("avx2")) kernel = "AVX2";
+#endif
+
+    long long totalMismatches = 0;
+    for (int size : {5, 8, 11, 14}) {
+        if (onlySize != 0 && size != onlySize) continue;
+        // HAT tiles join at 7 tiles and DOT tiles at 10 (SetTileCount)
+        int types = tileTypes != 0 ? min(3, max(1, tileTypes)) : (size == 5 ? 1 : size == 8 ? 2 : 3);
+
+        HandValidator validator(size, types, runReference);
+        auto start = chrono::steady_clock::now();
+        validator.Run(threadCount);
+        double wallSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        const ValidatorStats& stats = validator.totals;
+        cout << "=== HAND VALIDATOR: " << size << " tiles, " << types << " tile type(s) ===" << endl;
+        cout << "Hands: " << stats.hands << " (Mahjong wins: " << stats.mahjongWins << ", LOONG wins: " << stats.loongWins
+             << ") in " << wallSeconds << " s on " << threadCount << " thread(s)" << endl;
+        cout << "Mismatches: agari table " << stats.tableMismatches << ", batch kernel " << stats.batchMismatches << endl;
+        if (runReference) {
+            cout << "Reference search: " << stats.hands / stats.referenceSeconds / 1e6 << " M hands/s per thread" << endl;
+        }
+        cout << "Agari table: " << stats.hands / stats.tableSeconds / 1e6 << " M hands/s per thread" << endl;
+        cout << "Batch (" << kernel << "): " << stats.hands / stats.batchSeconds / 1e6 << " M hands/s per thread" << endl;
+        totalMismatches += stats.tableMismatches + stats.batchMismatches;
+    }
+
+    return totalMismatches == 0 ? 0 : 1;
+}
+#endif
+
+int main(int argc, char** argv)
 {
+#ifdef LOONG_VALIDATOR
+    return RunHandValidator(argc, argv);
+#endif
+
+#ifdef LOONG_BENCHMARK
+    RunFruitBenchmark();
+    RunTileDrawBenchmark();
+    RunWinCheckBenchmark();
+    RunBatchWinBenchmark();
+    RunSnapshotBenchmark();
+    RunReplayCheck();
+    RunRewindCheck();
+    RunTailCollisionBenchmark();
+    RunSafeCellBenchmark();
+    RunDistanceFieldBenchmark();
+    return 0;
+#endif
+
     cout << "Starting the Mahjong Snake game..." << endl;
     InitWindow(canvasWidth, canvasHeight, "Mahjong Snake - Mouse + Tile Matching");
     SetTargetFPS(60);
 
-    Game game = Game();
+    Game game = Game((uint64_t)time(NULL)); // New run seed every launch
+    for (int i = 1; i < argc; i++) {
+        if (string(argv[i]) == "--record") game.recordReplays = true;
+        if (string(argv[i]) == "--rewind-mb" && i + 1 < argc) {
+            double megabytes = max(0.0, atof(argv[++i]));
+            game.rewind.Configure(RewindBuffer::DEFAULT_KEYFRAME_TICKS, (size_t)(megabytes * 1024 * 1024));
+        }
+    }
+    auto lastFrameTime = chrono::steady_clock::now(); // Monotonic, unlike GetTime across clock changes
 
     while (WindowShouldClose() == false)
     {
@@ -6498,13 +4155,13 @@ int main()
         // Always update music and countdown for responsiveness
         game.UpdateMusicAndCountdown();
 
-        // Apply speed multiplier from power-ups
-        float baseSpeed = 0.2f;
-        float actualSpeed = baseSpeed / game.currentSpeedMultiplier;
-
-        if (EventTriggered(actualSpeed)) // Speed affected by power-ups
-        {
-            game.UpdateGameplay(); // This now checks if choice window is open
+        // Run every gameplay tick owed since the last frame (speed affected by power-ups)
+        auto now = chrono::steady_clock::now();
+        double elapsed = chrono::duration<double>(now - lastFrameTime).count();
+        lastFrameTime = now;
+        int ticks = game.tickScheduler.Advance(elapsed, game.currentSpeedMultiplier);
+        for (int tick = 0; tick < ticks; tick++) {
+            game.RunGameplayTick();
         }
 
         // Game drawing
@@ -6512,6 +4169,7 @@ int main()
 
         EndDrawing();
     }
+    game.replay.Finish(game);
     CloseWindow();
     return 0;
 }
\ No newline at end of file